@@ -4,11 +4,19 @@
 
 #include <boost/hash2/fnv1a.hpp>
 #include <boost/hash2/siphash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/ghash.hpp>
 #include <boost/hash2/xxhash.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
 #include <boost/hash2/sha2.hpp>
 #include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/legacy/murmur3.hpp>
+#include <boost/hash2/legacy/spooky2.hpp>
 #include <boost/hash2/hash_append.hpp>
 #include <boost/hash2/get_integral_result.hpp>
 #include <boost/core/type_name.hpp>
@@ -39,6 +47,61 @@ template<class Hash> void test_( unsigned char const * p, int N, int M )
     std::printf( "%s (N=%d): %u: %lld ms, %.2f MB/s\n", boost::core::type_name<Hash>().c_str(), N, r, ms, 1000.0 * N * M / ms / 1048576 );
 }
 
+// HMAC is used on separate messages, so it's measured per message; the key
+// setup, the two hash computations over the padded key, either happens for
+// each message (setup) or once, in an hmac_key the messages start from
+
+template<class Hash> void test_hmac_( unsigned char const * p, int N, int M )
+{
+    typedef typename Hash::result_type result_type;
+
+    unsigned char const key[ 32 ] = { 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b };
+
+    boost::hash2::hmac_key<Hash> const k( key, sizeof( key ) );
+
+    typedef std::chrono::steady_clock clock_type;
+
+    unsigned r = 0;
+
+    {
+        clock_type::time_point t1 = clock_type::now();
+
+        for( int i = 0; i < M; ++i )
+        {
+            boost::hash2::hmac<Hash> h( key, sizeof( key ) );
+            h.update( p, N );
+
+            result_type x = h.result();
+            r += x[ 0 ];
+        }
+
+        clock_type::time_point t2 = clock_type::now();
+
+        long long ms = std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count();
+
+        std::printf( "%s, with setup (N=%d): %u: %lld ms, %.2f MB/s\n", boost::core::type_name< boost::hash2::hmac<Hash> >().c_str(), N, r, ms, 1000.0 * N * M / ms / 1048576 );
+    }
+
+    {
+        clock_type::time_point t1 = clock_type::now();
+
+        for( int i = 0; i < M; ++i )
+        {
+            boost::hash2::hmac<Hash> h( k );
+            h.update( p, N );
+
+            result_type x = h.result();
+            r += x[ 0 ];
+        }
+
+        clock_type::time_point t2 = clock_type::now();
+
+        long long ms = std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count();
+
+        std::printf( "%s, from hmac_key (N=%d): %u: %lld ms, %.2f MB/s\n", boost::core::type_name< boost::hash2::hmac<Hash> >().c_str(), N, r, ms, 1000.0 * N * M / ms / 1048576 );
+    }
+}
+
 extern unsigned char data[];
 
 void test( int N, int M )
@@ -47,10 +110,14 @@ void test( int N, int M )
 
     test_<fnv1a_32>( data, N, M );
     test_<fnv1a_64>( data, N, M );
+    test_<fnv1a_64_wide>( data, N, M );
     test_<xxhash_32>( data, N, M );
     test_<xxhash_64>( data, N, M );
     test_<siphash_32>( data, N, M );
     test_<siphash_64>( data, N, M );
+    test_<polymur_64>( data, N, M );
+    test_<poly1305>( data, N, M );
+    test_<ghash>( data, N, M );
     test_<md5_128>( data, N, M );
     test_<sha1_160>( data, N, M );
     test_<sha2_256>( data, N, M );
@@ -61,6 +128,40 @@ void test( int N, int M )
     test_<sha2_512_256>( data, N, M );
     test_<ripemd_160>( data, N, M );
     test_<ripemd_128>( data, N, M );
+    test_<murmur3_32>( data, N, M );
+    test_<murmur3_128>( data, N, M );
+    test_<spooky2_128>( data, N, M );
+
+    puts( "--" );
+}
+
+// a message per iteration, with a finalization each, is much slower than
+// streaming the same bytes, so fewer iterations are made
+
+int const hmac_divisor = 256;
+
+void test_hmac( int N, int M )
+{
+    using namespace boost::hash2;
+
+    M /= hmac_divisor;
+
+    test_hmac_<md5_128>( data, N, M );
+    test_hmac_<sha1_160>( data, N, M );
+    test_hmac_<sha2_256>( data, N, M );
+    test_hmac_<sha2_224>( data, N, M );
+    test_hmac_<sha2_512>( data, N, M );
+    test_hmac_<sha2_384>( data, N, M );
+    test_hmac_<sha2_512_224>( data, N, M );
+    test_hmac_<sha2_512_256>( data, N, M );
+    test_hmac_<sha3_256>( data, N, M );
+    test_hmac_<sha3_224>( data, N, M );
+    test_hmac_<sha3_512>( data, N, M );
+    test_hmac_<sha3_384>( data, N, M );
+    test_hmac_<ripemd_160>( data, N, M );
+    test_hmac_<ripemd_128>( data, N, M );
+    test_hmac_<blake2b_512>( data, N, M );
+    test_hmac_<blake2s_256>( data, N, M );
 
     puts( "--" );
 }
@@ -79,6 +180,10 @@ int main()
     test( N1, M1 );
     test( N2, M2 );
     test( N3, M3 );
+
+    test_hmac( N1, M1 );
+    test_hmac( N2, M2 );
+    test_hmac( N3, M3 );
 }
 
 unsigned char data[ N1 ];
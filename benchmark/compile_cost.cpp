@@ -0,0 +1,307 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures the cost of hashing at compile time, by compiling constexpr.cpp
+// with -fsyntax-only for every hash algorithm, and reports
+//
+// * the compile time per hashed key, over that of the no_hash baseline,
+//   the minimum over --repeat compilations;
+// * with --steps, the constexpr evaluation steps taken by hashing a single
+//   key, found by bisecting -fconstexpr-steps (Clang) or
+//   -fconstexpr-ops-limit (GCC) for the smallest limit that compiles.
+//
+// The compiler command, along with the include paths it needs, follows
+// the "--" argument, for example
+//
+//   compile_cost --source=constexpr.cpp -- g++ -std=c++17 -I include
+//
+// Usage: compile_cost --source=file [--algorithm=name] [--count=n]
+//                     [--size=n] [--repeat=n] [--steps] -- compiler...
+
+#include <chrono>
+#include <string>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static char const* names[] =
+{
+    "fnv1a_32", "fnv1a_64", "xxhash_32", "xxhash_64", "xxh3_64", "xxh3_128",
+    "siphash_32", "siphash_64", "crc32c",
+    "md5_128", "sha1_160", "sha2_256", "sha2_512",
+    "sha3_256", "sha3_512", "ripemd_160", "blake2s_256", "blake2b_512", "blake3",
+};
+
+static char const* opt_source = 0;
+static char const* opt_algorithm = 0;
+static unsigned long opt_count = 64;
+static unsigned long opt_size = 64;
+static int opt_repeat = 3;
+static bool opt_steps = false;
+
+static std::string compiler;
+static bool is_clang = false;
+
+#if defined(_WIN32)
+static char const* const null_device = "NUL";
+#else
+static char const* const null_device = "/dev/null";
+#endif
+
+// compiles the source with the given parameters and extra options;
+// returns whether it compiled, and its time in ms in *ms
+
+static bool compile( char const* algorithm, unsigned long count, std::string const& extra, double* ms )
+{
+    std::string cmd = compiler;
+
+    cmd += " -fsyntax-only -DBOOST_HASH2_CX_ALGORITHM=";
+    cmd += algorithm;
+    cmd += " -DBOOST_HASH2_CX_COUNT=" + std::to_string( count );
+    cmd += " -DBOOST_HASH2_CX_SIZE=" + std::to_string( opt_size );
+    cmd += extra;
+    cmd += " \"";
+    cmd += opt_source;
+    cmd += "\" >";
+    cmd += null_device;
+    cmd += " 2>&1";
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    int r = std::system( cmd.c_str() );
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    if( ms )
+    {
+        *ms = std::chrono::duration<double, std::milli>( t2 - t1 ).count();
+    }
+
+    return r == 0;
+}
+
+// the minimum compile time in ms over opt_repeat compilations; -1 on error
+
+static double compile_time( char const* algorithm )
+{
+    double r = -1;
+
+    for( int i = 0; i < opt_repeat; ++i )
+    {
+        double ms = 0;
+
+        if( !compile( algorithm, opt_count, "", &ms ) )
+        {
+            return -1;
+        }
+
+        if( r < 0 || ms < r ) r = ms;
+    }
+
+    return r;
+}
+
+// the constexpr steps for hashing a single key, to within 1%; 0 on error
+
+static unsigned long constexpr_steps( char const* algorithm )
+{
+    std::string const option = is_clang? " -fconstexpr-steps=": " -fconstexpr-loop-limit=100000000 -fconstexpr-ops-limit=";
+
+    unsigned long lo = 0;
+    unsigned long hi = 1024;
+
+    // find an upper bound
+
+    while( !compile( algorithm, 1, option + std::to_string( hi ), 0 ) )
+    {
+        lo = hi;
+        hi *= 2;
+
+        if( hi > 1ul << 30 ) return 0;
+    }
+
+    while( hi - lo > hi / 100 )
+    {
+        unsigned long mid = lo + ( hi - lo ) / 2;
+
+        if( compile( algorithm, 1, option + std::to_string( mid ), 0 ) )
+        {
+            hi = mid;
+        }
+        else
+        {
+            lo = mid;
+        }
+    }
+
+    return hi;
+}
+
+static void usage()
+{
+    std::fputs(
+
+        "usage: compile_cost --source=file [--algorithm=name] [--count=n]\n"
+        "                    [--size=n] [--repeat=n] [--steps] -- compiler...\n",
+
+        stderr
+    );
+}
+
+static bool parse_option( char const* arg )
+{
+    if( std::strcmp( arg, "--steps" ) == 0 )
+    {
+        opt_steps = true;
+        return true;
+    }
+
+    char const* v = std::strchr( arg, '=' );
+    if( v == 0 ) return false;
+
+    std::string const name( arg, v );
+    ++v;
+
+    if( name == "--source" )
+    {
+        opt_source = v;
+    }
+    else if( name == "--algorithm" )
+    {
+        opt_algorithm = v;
+    }
+    else if( name == "--count" )
+    {
+        opt_count = std::strtoul( v, 0, 10 );
+        if( opt_count == 0 ) return false;
+    }
+    else if( name == "--size" )
+    {
+        opt_size = std::strtoul( v, 0, 10 );
+    }
+    else if( name == "--repeat" )
+    {
+        opt_repeat = std::atoi( v );
+        if( opt_repeat < 1 ) return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+int main( int argc, char const* argv[] )
+{
+    int i = 1;
+
+    for( ; i < argc && std::strcmp( argv[ i ], "--" ) != 0; ++i )
+    {
+        if( !parse_option( argv[ i ] ) )
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    if( opt_source == 0 || i + 1 >= argc )
+    {
+        usage();
+        return 2;
+    }
+
+    for( ++i; i < argc; ++i )
+    {
+        if( !compiler.empty() ) compiler += ' ';
+
+        compiler += '"';
+        compiler += argv[ i ];
+        compiler += '"';
+    }
+
+    if( opt_steps )
+    {
+        std::string cmd = compiler + " --version 2>&1";
+
+#if defined(_WIN32)
+        std::FILE* f = _popen( cmd.c_str(), "r" );
+#else
+        std::FILE* f = popen( cmd.c_str(), "r" );
+#endif
+
+        if( f )
+        {
+            char buffer[ 256 ] = {};
+            is_clang = std::fgets( buffer, sizeof( buffer ), f ) && std::strstr( buffer, "clang" );
+
+#if defined(_WIN32)
+            _pclose( f );
+#else
+            pclose( f );
+#endif
+        }
+    }
+
+    double const baseline = compile_time( "no_hash" );
+
+    if( baseline < 0 )
+    {
+        std::fprintf( stderr, "compile_cost: '%s' doesn't compile with the given compiler command\n", opt_source );
+        return 1;
+    }
+
+    unsigned long const baseline_steps = opt_steps? constexpr_steps( "no_hash" ): 0;
+
+    std::printf( "%lu keys of %lu bytes; baseline %.0f ms", opt_count, opt_size, baseline );
+
+    if( opt_steps )
+    {
+        std::printf( ", %lu steps", baseline_steps );
+    }
+
+    std::printf( "\n\n" );
+
+    bool found = false;
+
+    for( char const* name: names )
+    {
+        if( opt_algorithm != 0 && std::strcmp( opt_algorithm, name ) != 0 ) continue;
+
+        found = true;
+
+        double const ms = compile_time( name );
+
+        if( ms < 0 )
+        {
+            std::printf( "%-12s: doesn't compile\n", name );
+            continue;
+        }
+
+        std::printf( "%-12s: %8.0f ms, %8.3f ms/key", name, ms, ( ms - baseline ) / opt_count );
+
+        if( opt_steps )
+        {
+            unsigned long const steps = constexpr_steps( name );
+
+            if( steps != 0 )
+            {
+                std::printf( ", %8lu steps/key", steps > baseline_steps? steps - baseline_steps: 0ul );
+            }
+            else
+            {
+                std::printf( ", %8s steps/key", "-" );
+            }
+        }
+
+        std::printf( "\n" );
+        std::fflush( stdout );
+    }
+
+    if( !found )
+    {
+        std::fprintf( stderr, "compile_cost: unknown algorithm '%s'\n", opt_algorithm );
+        return 2;
+    }
+}
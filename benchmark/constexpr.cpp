@@ -0,0 +1,128 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Hashes BOOST_HASH2_CX_COUNT keys of BOOST_HASH2_CX_SIZE bytes each at
+// compile time, with the algorithm BOOST_HASH2_CX_ALGORITHM, each in a
+// separate constant evaluation. With no_hash as the algorithm, it does
+// everything except the hashing, which gives the baseline.
+//
+// compile_cost.cpp compiles this file with varying parameters, and
+// measures the compile time and the constexpr evaluation steps.
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+# error This file requires C++14 constexpr
+#endif
+
+#if !defined(BOOST_HASH2_CX_ALGORITHM)
+# define BOOST_HASH2_CX_ALGORITHM sha2_256
+#endif
+
+#if !defined(BOOST_HASH2_CX_COUNT)
+# define BOOST_HASH2_CX_COUNT 64
+#endif
+
+#if !defined(BOOST_HASH2_CX_SIZE)
+# define BOOST_HASH2_CX_SIZE 64
+#endif
+
+using namespace boost::hash2;
+
+struct no_hash
+{
+    using result_type = std::uint64_t;
+
+    constexpr void update( unsigned char const* /*p*/, std::size_t /*n*/ )
+    {
+    }
+
+    constexpr result_type result()
+    {
+        return 0;
+    }
+};
+
+using H = BOOST_HASH2_CX_ALGORITHM;
+
+// get_integral_result isn't constexpr
+
+constexpr std::uint64_t to_uint64( std::uint64_t v )
+{
+    return v;
+}
+
+template<std::size_t M> constexpr std::uint64_t to_uint64( digest<M> const& v )
+{
+    std::uint64_t r = 0;
+
+    for( std::size_t i = 0; i < 8; ++i )
+    {
+        r = r << 8 | v.data()[ i ];
+    }
+
+    return r;
+}
+
+std::size_t const N = BOOST_HASH2_CX_SIZE;
+
+template<std::size_t I> constexpr std::uint64_t hash_key()
+{
+    unsigned char key[ N + 1 ] = {};
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( I * 131 + i * 7 );
+    }
+
+    H h;
+    h.update( key, N );
+
+    return to_uint64( h.result() );
+}
+
+// a constant evaluation per key
+
+template<std::size_t I> struct hashed_key
+{
+    static constexpr std::uint64_t value = hash_key<I>();
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<std::size_t I> constexpr std::uint64_t hashed_key<I>::value;
+
+#endif
+
+template<std::size_t... I> std::uint64_t sum( boost::mp11::index_sequence<I...> )
+{
+    std::uint64_t r = 0;
+
+    int a[] = { ( r += hashed_key<I>::value, 0 )... };
+    (void)a;
+
+    return r;
+}
+
+int main()
+{
+    std::printf( "%llu\n", static_cast<unsigned long long>( sum( boost::mp11::make_index_sequence<BOOST_HASH2_CX_COUNT>() ) ) );
+}
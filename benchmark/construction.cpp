@@ -0,0 +1,223 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures the fixed costs of the hash algorithms, separately: the
+// construction by H(), H(seed), and H(p, n), with a 16 and a 64 byte
+// seed; the copy of a prototype, as in hash_with_byte_seed in
+// unordered.cpp; and result() after an 8 byte update. All in ns.
+//
+// A byte seed that costs more to apply than a copy costs is better
+// applied once, to a prototype that is copied for each message.
+//
+// Usage: construction [number of operations per measurement]
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+typedef std::chrono::steady_clock clock_type;
+
+static std::size_t N = 1048576;
+
+// keeps the compiler from eliminating the construction of x
+
+BOOST_NOINLINE void escape_( void const* )
+{
+}
+
+template<class T> inline void escape( T const& x )
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    __asm__ __volatile__( "" : : "r"( &x ) : "memory" );
+
+#else
+
+    escape_( &x );
+
+#endif
+}
+
+static double ns_per_op( clock_type::time_point t1, clock_type::time_point t2 )
+{
+    return std::chrono::duration<double, std::nano>( t2 - t1 ).count() / N;
+}
+
+template<class H> BOOST_NOINLINE double test_default()
+{
+    clock_type::time_point t1 = clock_type::now();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        H h;
+        escape( h );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    return ns_per_op( t1, t2 );
+}
+
+template<class H> BOOST_NOINLINE double test_seed()
+{
+    clock_type::time_point t1 = clock_type::now();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        H h( i + 1 );
+        escape( h );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    return ns_per_op( t1, t2 );
+}
+
+template<class H> BOOST_NOINLINE double test_byte_seed( std::size_t n )
+{
+    unsigned char seed[ 128 ] = {};
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        seed[ 0 ] = static_cast<unsigned char>( i );
+
+        H h( seed, n );
+        escape( h );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    return ns_per_op( t1, t2 );
+}
+
+template<class H> BOOST_NOINLINE double test_copy()
+{
+    unsigned char const seed[ 16 ] = { 1, 2, 3 };
+    H const h0( seed, sizeof( seed ) );
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        escape( h0 );
+
+        H h( h0 );
+        escape( h );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    return ns_per_op( t1, t2 );
+}
+
+// the time of a copy, an update of 8 bytes and a result, less that of
+// the copy alone
+
+template<class H> BOOST_NOINLINE double test_result( double copy )
+{
+    unsigned char const seed[ 16 ] = { 1, 2, 3 };
+    H const h0( seed, sizeof( seed ) );
+
+    unsigned char const data[ 8 ] = {};
+
+    std::uint64_t q = 0;
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        escape( h0 );
+
+        H h( h0 );
+
+        h.update( data, 8 );
+        q += boost::hash2::get_integral_result<std::uint64_t>( h.result() );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    escape( q );
+
+    return ns_per_op( t1, t2 ) - copy;
+}
+
+template<class H> void test( char const* name )
+{
+    double const t1 = test_default<H>();
+    double const t2 = test_seed<H>();
+    double const t3 = test_byte_seed<H>( 16 );
+    double const t4 = test_byte_seed<H>( 64 );
+    double const t5 = test_copy<H>();
+    double const t6 = test_result<H>( t5 );
+
+    std::printf( "%-22s %8.1f %8.1f %8.1f %8.1f %8.1f %8.1f\n", name, t1, t2, t3, t4, t5, t6 );
+}
+
+int main( int argc, char const* argv[] )
+{
+    if( argc > 1 )
+    {
+        N = std::strtoul( argv[ 1 ], 0, 10 );
+        if( N == 0 ) N = 1;
+    }
+
+    std::printf( "%zu operations per measurement; ns/op\n\n", N );
+    std::printf( "%-22s %8s %8s %8s %8s %8s %8s\n\n", "hash", "H()", "H(seed)", "H(p,16)", "H(p,64)", "copy", "result" );
+
+    using namespace boost::hash2;
+
+    test<fnv1a_32>( "fnv1a_32" );
+    test<fnv1a_64>( "fnv1a_64" );
+    test<fnv1a_64_wide>( "fnv1a_64_wide" );
+    test<mix64>( "mix64" );
+    test<xxhash_32>( "xxhash_32" );
+    test<xxhash_64>( "xxhash_64" );
+    test<xxh3_64>( "xxh3_64" );
+    test<xxh3_128>( "xxh3_128" );
+    test<rapidhash_64>( "rapidhash_64" );
+    test<polymur_64>( "polymur_64" );
+    test<highwayhash_64>( "highwayhash_64" );
+    test<siphash13_64>( "siphash13_64" );
+    test<siphash_64>( "siphash_64" );
+    test<md5_128>( "md5_128" );
+    test<sha1_160>( "sha1_160" );
+    test<sha2_256>( "sha2_256" );
+    test<sha2_512>( "sha2_512" );
+    test<sha3_256>( "sha3_256" );
+    test<blake2b_512>( "blake2b_512" );
+    test<blake2s_256>( "blake2s_256" );
+    test<blake3>( "blake3" );
+    test<ripemd_160>( "ripemd_160" );
+
+    std::puts( "" );
+
+    test<hmac_md5_128>( "hmac_md5_128" );
+    test<hmac_sha1_160>( "hmac_sha1_160" );
+    test<hmac_sha2_256>( "hmac_sha2_256" );
+    test<hmac_sha2_512>( "hmac_sha2_512" );
+    test<hmac<sha3_256>>( "hmac<sha3_256>" );
+    test<hmac<blake2s_256>>( "hmac<blake2s_256>" );
+}
@@ -0,0 +1,303 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures hash_append of objects, rather than of byte buffers: integers,
+// strings, pairs, tuples, described structs, std::map, std::unordered_map,
+// std::vector<double>, and nested containers. For each object type and
+// hash algorithm, it reports the time per object, in ns, from constructing
+// the algorithm to calling result(), and the mean number of update calls
+// and of bytes per object, as counted by counting_hash.
+//
+// This is the baseline against which changes to the hash_append overloads
+// are measured; the update calls show how well they batch small writes.
+//
+// Usage: objects [number of objects hashed per type and algorithm]
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/counting_hash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/describe/class.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <map>
+#include <random>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+// object types
+
+struct record
+{
+    std::uint32_t id;
+    std::string name;
+    double score;
+    std::uint16_t flags;
+};
+
+BOOST_DESCRIBE_STRUCT(record, (), (id, name, score, flags))
+
+using small_tuple = std::tuple<std::uint32_t, std::uint16_t, double>;
+using nested = std::vector<std::vector<std::string>>;
+
+static std::mt19937_64 rng;
+
+// strings of 4 to 40 characters
+
+static std::string make_string()
+{
+    static char const chars[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+    std::size_t n = 4 + rng() % 37;
+
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += chars[ rng() % 36 ];
+    }
+
+    return r;
+}
+
+static double make_double()
+{
+    return std::uniform_real_distribution<double>( -1000, 1000 )( rng );
+}
+
+// measurement
+
+typedef std::chrono::steady_clock clock_type;
+
+static std::size_t objects = 1048576;
+
+template<class H, class T> BOOST_NOINLINE void test_( char const* name, std::vector<T> const& v )
+{
+    using namespace boost::hash2;
+
+    // the update calls, on one pass
+
+    std::uint64_t calls = 0, bytes = 0;
+
+    for( T const& x: v )
+    {
+        counting_hash<H> h;
+        hash_append( h, {}, x );
+
+        calls += h.counts().update_calls;
+        bytes += h.counts().bytes;
+    }
+
+    // the time, on as many passes as needed to hash `objects` objects
+
+    std::size_t const passes = ( objects + v.size() - 1 ) / v.size();
+
+    std::uint64_t q = 0;
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( std::size_t i = 0; i < passes; ++i )
+    {
+        for( T const& x: v )
+        {
+            H h;
+            hash_append( h, {}, x );
+
+            q += get_integral_result<std::uint64_t>( h.result() );
+        }
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    double const n = static_cast<double>( passes * v.size() );
+    double const ns = std::chrono::duration<double, std::nano>( t2 - t1 ).count() / n;
+
+    std::printf( "%-16s %10.1f %8.1f %10.1f  (q=%llu)\n", name, ns, static_cast<double>( calls ) / v.size(), static_cast<double>( bytes ) / v.size(), static_cast<unsigned long long>( q ) );
+}
+
+template<class T> void test( char const* type, std::vector<T> const& v )
+{
+    using namespace boost::hash2;
+
+    std::printf( "%s:\n\n", type );
+
+    test_<fnv1a_32>( "fnv1a_32", v );
+    test_<fnv1a_64>( "fnv1a_64", v );
+    test_<fnv1a_64_wide>( "fnv1a_64_wide", v );
+    test_<mix64>( "mix64", v );
+    test_<xxhash_32>( "xxhash_32", v );
+    test_<xxhash_64>( "xxhash_64", v );
+    test_<xxh3_64>( "xxh3_64", v );
+    test_<xxh3_128>( "xxh3_128", v );
+    test_<rapidhash_64>( "rapidhash_64", v );
+    test_<polymur_64>( "polymur_64", v );
+    test_<highwayhash_64>( "highwayhash_64", v );
+    test_<siphash13_64>( "siphash13_64", v );
+    test_<siphash_64>( "siphash_64", v );
+    test_<md5_128>( "md5_128", v );
+    test_<sha1_160>( "sha1_160", v );
+    test_<sha2_256>( "sha2_256", v );
+    test_<sha2_512>( "sha2_512", v );
+    test_<sha3_256>( "sha3_256", v );
+    test_<blake2b_512>( "blake2b_512", v );
+    test_<blake2s_256>( "blake2s_256", v );
+    test_<blake3>( "blake3", v );
+    test_<ripemd_160>( "ripemd_160", v );
+
+    std::puts( "" );
+}
+
+int main( int argc, char const* argv[] )
+{
+    if( argc > 1 )
+    {
+        objects = std::strtoul( argv[ 1 ], 0, 10 );
+        if( objects == 0 ) objects = 1;
+    }
+
+    // the objects of each type; the sets are small enough to stay in
+    // the cache, so that the times are those of the hashing
+
+    std::size_t const m = 1024;
+
+    std::printf( "%zu objects per type and algorithm; ns/object, update calls/object, bytes/object\n\n", objects );
+    std::printf( "%-16s %10s %8s %10s\n\n", "hash", "ns", "calls", "bytes" );
+
+    {
+        std::vector<std::uint64_t> v;
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            v.push_back( rng() );
+        }
+
+        test( "std::uint64_t", v );
+    }
+
+    {
+        std::vector<std::string> v;
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            v.push_back( make_string() );
+        }
+
+        test( "std::string", v );
+    }
+
+    {
+        std::vector<std::pair<std::uint32_t, std::string>> v;
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            v.push_back( { static_cast<std::uint32_t>( rng() ), make_string() } );
+        }
+
+        test( "std::pair<std::uint32_t, std::string>", v );
+    }
+
+    {
+        std::vector<small_tuple> v;
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            v.push_back( small_tuple( static_cast<std::uint32_t>( rng() ), static_cast<std::uint16_t>( rng() ), make_double() ) );
+        }
+
+        test( "std::tuple<std::uint32_t, std::uint16_t, double>", v );
+    }
+
+    {
+        std::vector<record> v;
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            v.push_back( { static_cast<std::uint32_t>( rng() ), make_string(), make_double(), static_cast<std::uint16_t>( rng() ) } );
+        }
+
+        test( "described struct { std::uint32_t, std::string, double, std::uint16_t }", v );
+    }
+
+    {
+        std::vector<std::map<std::string, int>> v( m / 16 );
+
+        for( auto& x: v )
+        {
+            for( int j = 0; j < 16; ++j )
+            {
+                x[ make_string() ] = static_cast<int>( rng() );
+            }
+        }
+
+        test( "std::map<std::string, int>, 16 elements", v );
+    }
+
+    {
+        std::vector<std::unordered_map<std::string, int>> v( m / 16 );
+
+        for( auto& x: v )
+        {
+            for( int j = 0; j < 16; ++j )
+            {
+                x[ make_string() ] = static_cast<int>( rng() );
+            }
+        }
+
+        test( "std::unordered_map<std::string, int>, 16 elements", v );
+    }
+
+    {
+        std::vector<std::vector<double>> v( m / 16 );
+
+        for( auto& x: v )
+        {
+            for( int j = 0; j < 64; ++j )
+            {
+                x.push_back( make_double() );
+            }
+        }
+
+        test( "std::vector<double>, 64 elements", v );
+    }
+
+    {
+        std::vector<nested> v( m / 16 );
+
+        for( auto& x: v )
+        {
+            x.resize( 4 );
+
+            for( auto& y: x )
+            {
+                for( int j = 0; j < 4; ++j )
+                {
+                    y.push_back( make_string() );
+                }
+            }
+        }
+
+        test( "std::vector<std::vector<std::string>>, 4x4 elements", v );
+    }
+}
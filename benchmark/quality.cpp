@@ -0,0 +1,814 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// A statistical quality harness, in the spirit of SMHasher, that works
+// with any type satisfying the HashAlgorithm requirements. For each
+// algorithm, it runs:
+//
+// * avalanche: flipping any input bit should flip each output bit with
+//   probability 1/2; reports the worst bias over all pairs of bits, for
+//   the first 128 output bits;
+// * differential: keys that differ in up to 3 bits should collide no more
+//   often than random ones;
+// * sparse: the keys with few bits set should collide no more often than
+//   random ones;
+// * permutation: the keys formed by concatenating blocks from a small set,
+//   in all orders, should collide no more often than random ones;
+// * distribution: for the sparse and the permutation keys, each window of
+//   output bits should fill its buckets uniformly.
+//
+// Collisions are counted on the whole result, up to its first 64 bits,
+// and on its first 32 bits, and compared with the number expected from
+// a random function. A test fails when its outcome has a probability
+// below 1e-6 for a random function. The speed of the algorithm, for 16
+// byte keys and for 256 KiB blocks, is reported alongside.
+//
+// The work is split over all the hardware threads.
+//
+// Usage: quality [--algorithm=name] [--threads=n] [--quick]
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/legacy/murmur3.hpp>
+#include <boost/hash2/legacy/spooky2.hpp>
+#include <boost/mp11.hpp>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+using namespace boost::mp11;
+using namespace boost::hash2;
+
+using hashes = mp_list<
+
+    fnv1a_32,
+    fnv1a_64,
+    fnv1a_64_wide,
+    xxhash_32,
+    xxhash_64,
+    xxh3_64,
+    xxh3_128,
+    rapidhash_64,
+    aes_hash_128,
+    highwayhash_64,
+    highwayhash_128,
+    highwayhash_256,
+    siphash_32,
+    siphash_64,
+    siphash13_32,
+    siphash13_64,
+    crc32c,
+    md5_128,
+    sha1_160,
+    sha2_256,
+    sha2_224,
+    sha2_512,
+    sha2_384,
+    sha2_512_256,
+    sha2_512_224,
+    sha3_256,
+    sha3_224,
+    sha3_512,
+    sha3_384,
+    ripemd_160,
+    ripemd_128,
+    blake2b_512,
+    blake2s_256,
+    blake3,
+    k12,
+    murmur3_32,
+    murmur3_128,
+    spooky2_128
+
+>;
+
+constexpr char const* names[] = {
+
+    "fnv1a_32",
+    "fnv1a_64",
+    "fnv1a_64_wide",
+    "xxhash_32",
+    "xxhash_64",
+    "xxh3_64",
+    "xxh3_128",
+    "rapidhash_64",
+    "aes_hash_128",
+    "highwayhash_64",
+    "highwayhash_128",
+    "highwayhash_256",
+    "siphash_32",
+    "siphash_64",
+    "siphash13_32",
+    "siphash13_64",
+    "crc32c",
+    "md5_128",
+    "sha1_160",
+    "sha2_256",
+    "sha2_224",
+    "sha2_512",
+    "sha2_384",
+    "sha2_512_256",
+    "sha2_512_224",
+    "sha3_256",
+    "sha3_224",
+    "sha3_512",
+    "sha3_384",
+    "ripemd_160",
+    "ripemd_128",
+    "blake2b_512",
+    "blake2s_256",
+    "blake3",
+    "k12",
+    "murmur3_32",
+    "murmur3_128",
+    "spooky2_128"
+
+};
+
+static_assert( sizeof( names ) / sizeof( names[ 0 ] ) == mp_size<hashes>::value, "names doesn't match hashes" );
+
+// options
+
+static char const* opt_algorithm = 0;
+static unsigned opt_threads = 0;
+static bool opt_quick = false;
+
+// outcomes with a lower probability for a random function fail
+
+static double const p_fail = 1e-6;
+
+// the result of an algorithm, as bytes
+
+template<class R> static typename std::enable_if<std::is_integral<R>::value, std::size_t>::type result_bytes( R const& r, unsigned char* p )
+{
+    for( std::size_t i = 0; i < sizeof( R ); ++i )
+    {
+        p[ i ] = static_cast<unsigned char>( r >> ( 8 * i ) );
+    }
+
+    return sizeof( R );
+}
+
+template<class R> static typename std::enable_if<!std::is_integral<R>::value, std::size_t>::type result_bytes( R const& r, unsigned char* p )
+{
+    std::memcpy( p, r.data(), r.size() );
+    return r.size();
+}
+
+std::size_t const max_result_size = 64;
+
+template<class H> static std::size_t hash_bytes( unsigned char const* p, std::size_t n, unsigned char* r )
+{
+    H h;
+    h.update( p, n );
+
+    return result_bytes( h.result(), r );
+}
+
+// the first 64 bits of the result
+
+template<class H> static std::uint64_t hash64( unsigned char const* p, std::size_t n )
+{
+    unsigned char r[ max_result_size ];
+    std::size_t m = hash_bytes<H>( p, n, r );
+
+    std::uint64_t x = 0;
+
+    for( std::size_t i = 0; i < m && i < 8; ++i )
+    {
+        x |= static_cast<std::uint64_t>( r[ i ] ) << ( 8 * i );
+    }
+
+    return x;
+}
+
+template<class H> static int result_bits()
+{
+    unsigned char r[ max_result_size ];
+    return static_cast<int>( hash_bytes<H>( 0, 0, r ) * 8 );
+}
+
+// threads
+
+template<class F> static void parallel_for( std::size_t n, F f )
+{
+    unsigned t = opt_threads;
+
+    if( t > n ) t = static_cast<unsigned>( n );
+    if( t == 0 ) t = 1;
+
+    std::vector<std::thread> th;
+
+    for( unsigned i = 1; i < t; ++i )
+    {
+        th.emplace_back( [&, i]{ f( n * i / t, n * ( i + 1 ) / t, i ); } );
+    }
+
+    f( 0, n / t, 0 );
+
+    for( std::thread& x: th )
+    {
+        x.join();
+    }
+}
+
+// statistics
+
+// P(X >= k), X Poisson with mean lambda
+
+static double poisson_tail( std::uint64_t k, double lambda )
+{
+    if( k == 0 ) return 1;
+    if( lambda <= 0 ) return 0;
+
+    double s = 0;
+
+    for( std::uint64_t i = k;; ++i )
+    {
+        double t = std::exp( -lambda + i * std::log( lambda ) - std::lgamma( i + 1.0 ) );
+
+        s += t;
+
+        if( i > lambda && t < s * 1e-16 ) break;
+    }
+
+    return std::min( s, 1.0 );
+}
+
+// P(Z >= z), Z standard normal
+
+static double normal_tail( double z )
+{
+    return 0.5 * std::erfc( z / std::sqrt( 2.0 ) );
+}
+
+static int failures;
+
+static void verdict( double p )
+{
+    if( p < p_fail )
+    {
+        std::printf( "  FAIL\n" );
+        ++failures;
+    }
+    else
+    {
+        std::printf( "  ok\n" );
+    }
+}
+
+// key lists
+
+struct key_list
+{
+    std::vector<unsigned char> data;
+    std::vector<std::size_t> offsets; // offsets[ i ] to offsets[ i + 1 ]
+
+    key_list(): offsets( 1, 0 )
+    {
+    }
+
+    std::size_t size() const
+    {
+        return offsets.size() - 1;
+    }
+
+    unsigned char const* key( std::size_t i ) const
+    {
+        return data.data() + offsets[ i ];
+    }
+
+    std::size_t length( std::size_t i ) const
+    {
+        return offsets[ i + 1 ] - offsets[ i ];
+    }
+
+    void push_back( unsigned char const* p, std::size_t n )
+    {
+        data.insert( data.end(), p, p + n );
+        offsets.push_back( data.size() );
+    }
+};
+
+// the keys of n bytes with up to k bits set
+
+static void make_sparse( key_list& keys, std::vector<unsigned char>& key, std::size_t start, int k )
+{
+    keys.push_back( key.data(), key.size() );
+
+    if( k == 0 ) return;
+
+    for( std::size_t i = start; i < key.size() * 8; ++i )
+    {
+        key[ i / 8 ] ^= static_cast<unsigned char>( 1 << ( i % 8 ) );
+        make_sparse( keys, key, i + 1, k - 1 );
+        key[ i / 8 ] ^= static_cast<unsigned char>( 1 << ( i % 8 ) );
+    }
+}
+
+static key_list sparse_keys( std::size_t n, int k )
+{
+    key_list keys;
+    std::vector<unsigned char> key( n );
+
+    make_sparse( keys, key, 0, k );
+    return keys;
+}
+
+// the concatenations of 1 to m blocks from blocks, in every order
+
+static void make_permutations( key_list& keys, std::vector<std::uint32_t> const& blocks, std::vector<unsigned char>& key, int m )
+{
+    if( !key.empty() )
+    {
+        keys.push_back( key.data(), key.size() );
+    }
+
+    if( m == 0 ) return;
+
+    for( std::uint32_t b: blocks )
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            key.push_back( static_cast<unsigned char>( b >> ( 8 * i ) ) );
+        }
+
+        make_permutations( keys, blocks, key, m - 1 );
+
+        key.resize( key.size() - 4 );
+    }
+}
+
+static key_list permutation_keys( std::vector<std::uint32_t> const& blocks, int m )
+{
+    key_list keys;
+    std::vector<unsigned char> key;
+
+    make_permutations( keys, blocks, key, m );
+    return keys;
+}
+
+// collisions and distribution
+
+static std::uint64_t count_collisions( std::vector<std::uint64_t> v, std::uint64_t mask )
+{
+    for( std::uint64_t& x: v )
+    {
+        x &= mask;
+    }
+
+    std::sort( v.begin(), v.end() );
+
+    std::uint64_t r = 0;
+
+    for( std::size_t i = 1; i < v.size(); ++i )
+    {
+        r += v[ i ] == v[ i - 1 ];
+    }
+
+    return r;
+}
+
+static void report_collisions( char const* test, char const* keys, std::vector<std::uint64_t> const& v, int bits )
+{
+    double const pairs = 0.5 * v.size() * ( v.size() - 1.0 );
+
+    // the whole result, up to 64 bits, and its first 32 bits
+
+    int const widths[] = { std::min( bits, 64 ), 32 };
+
+    for( int b: widths )
+    {
+        if( b == 32 && widths[ 0 ] <= 32 ) break;
+
+        std::uint64_t const mask = b == 64? ~std::uint64_t( 0 ): ( std::uint64_t( 1 ) << b ) - 1;
+
+        // the expected number of colliding pairs approximates that of
+        // colliding keys well while it's small relative to their number
+        double const expected = pairs / std::ldexp( 1.0, b );
+
+        std::uint64_t const c = count_collisions( v, mask );
+
+        std::printf( "  %-12s %-28s %zu keys, %2d bits: %llu collisions, %.2f expected", test, keys, v.size(), b, static_cast<unsigned long long>( c ), expected );
+        verdict( poisson_tail( c, expected ) );
+    }
+}
+
+// each window of w output bits, at every offset, is used as a bucket
+// index; a chi-square statistic over the buckets is computed for each,
+// and the worst is reported as a z-score
+
+static void report_distribution( char const* keys, std::vector<std::uint64_t> const& v, int bits )
+{
+    if( bits > 64 ) bits = 64;
+
+    int w = 8;
+
+    while( w < 16 && ( std::size_t( 1 ) << ( w + 1 ) ) * 8 <= v.size() ) ++w;
+
+    std::size_t const m = std::size_t( 1 ) << w;
+    double const expected = static_cast<double>( v.size() ) / m;
+
+    double worst = 0;
+    int worst_offset = 0;
+
+    std::vector<std::uint32_t> counts( m );
+
+    for( int k = 0; k + w <= bits; ++k )
+    {
+        std::fill( counts.begin(), counts.end(), 0 );
+
+        for( std::uint64_t x: v )
+        {
+            ++counts[ ( x >> k ) & ( m - 1 ) ];
+        }
+
+        double chi2 = 0;
+
+        for( std::uint32_t c: counts )
+        {
+            chi2 += ( c - expected ) * ( c - expected ) / expected;
+        }
+
+        double const df = m - 1.0;
+        double const z = ( chi2 - df ) / std::sqrt( 2 * df );
+
+        if( z > worst )
+        {
+            worst = z;
+            worst_offset = k;
+        }
+    }
+
+    std::printf( "  %-12s %-28s %zu keys, %2d bit windows: worst z=%.2f at bit %d", "distribution", keys, v.size(), w, worst, worst_offset );
+    verdict( ( bits - w + 1 ) * normal_tail( worst ) );
+}
+
+template<class H> static std::vector<std::uint64_t> hash_keys( key_list const& keys )
+{
+    std::vector<std::uint64_t> v( keys.size() );
+
+    parallel_for( keys.size(), [&]( std::size_t first, std::size_t last, unsigned ){
+
+        for( std::size_t i = first; i < last; ++i )
+        {
+            v[ i ] = hash64<H>( keys.key( i ), keys.length( i ) );
+        }
+    });
+
+    return v;
+}
+
+// tests
+
+template<class H> static void test_avalanche( std::size_t n, std::size_t reps )
+{
+    int const in_bits = static_cast<int>( n * 8 );
+
+    // the first 128 bits of longer results
+    int const out_bits = std::min( result_bits<H>(), 128 );
+
+    std::size_t const cells = static_cast<std::size_t>( in_bits ) * out_bits;
+
+    std::vector< std::vector<std::uint32_t> > counts( opt_threads, std::vector<std::uint32_t>( cells ) );
+
+    parallel_for( reps, [&]( std::size_t first, std::size_t last, unsigned t ){
+
+        std::mt19937_64 rng( first );
+
+        std::vector<unsigned char> key( n );
+
+        unsigned char r1[ max_result_size ], r2[ max_result_size ];
+
+        std::uint32_t* c = counts[ t ].data();
+
+        for( std::size_t i = first; i < last; ++i )
+        {
+            for( unsigned char& ch: key )
+            {
+                ch = static_cast<unsigned char>( rng() );
+            }
+
+            hash_bytes<H>( key.data(), n, r1 );
+
+            for( int j = 0; j < in_bits; ++j )
+            {
+                key[ j / 8 ] ^= static_cast<unsigned char>( 1 << ( j % 8 ) );
+
+                hash_bytes<H>( key.data(), n, r2 );
+
+                key[ j / 8 ] ^= static_cast<unsigned char>( 1 << ( j % 8 ) );
+
+                std::uint32_t* cj = c + static_cast<std::size_t>( j ) * out_bits;
+
+                for( int k = 0; k < out_bits; ++k )
+                {
+                    cj[ k ] += ( ( r1[ k / 8 ] ^ r2[ k / 8 ] ) >> ( k % 8 ) ) & 1;
+                }
+            }
+        }
+    });
+
+    double worst = 0;
+
+    for( std::size_t i = 0; i < cells; ++i )
+    {
+        std::uint64_t c = 0;
+
+        for( unsigned t = 0; t < opt_threads; ++t )
+        {
+            c += counts[ t ][ i ];
+        }
+
+        worst = std::max( worst, std::abs( 2.0 * c - static_cast<double>( reps ) ) );
+    }
+
+    // 2c - reps has a standard deviation of sqrt(reps)
+    double const z = worst / std::sqrt( static_cast<double>( reps ) );
+
+    char keys[ 32 ];
+    std::snprintf( keys, sizeof( keys ), "%zu byte keys", n );
+
+    std::printf( "  %-12s %-28s %zu reps: worst bias %.3f%%", "avalanche", keys, reps, 100 * worst / reps );
+    verdict( cells * 2 * normal_tail( z ) );
+}
+
+// pairs of keys that differ in up to k bits
+
+static void make_diffs( std::vector< std::vector<unsigned char> >& diffs, std::vector<unsigned char>& d, std::size_t start, int k )
+{
+    for( std::size_t i = start; i < d.size() * 8; ++i )
+    {
+        d[ i / 8 ] ^= static_cast<unsigned char>( 1 << ( i % 8 ) );
+
+        diffs.push_back( d );
+
+        if( k > 1 )
+        {
+            make_diffs( diffs, d, i + 1, k - 1 );
+        }
+
+        d[ i / 8 ] ^= static_cast<unsigned char>( 1 << ( i % 8 ) );
+    }
+}
+
+template<class H> static void test_differential( std::size_t n, int k, std::size_t reps )
+{
+    std::vector< std::vector<unsigned char> > diffs;
+
+    {
+        std::vector<unsigned char> d( n );
+        make_diffs( diffs, d, 0, k );
+    }
+
+    int const bits = std::min( result_bits<H>(), 64 );
+
+    std::vector<std::uint64_t> collisions( opt_threads );
+
+    parallel_for( reps, [&]( std::size_t first, std::size_t last, unsigned t ){
+
+        std::mt19937_64 rng( first + 0x9E3779B97F4A7C15ull );
+
+        std::vector<unsigned char> key( n ), key2( n );
+
+        for( std::size_t i = first; i < last; ++i )
+        {
+            for( unsigned char& ch: key )
+            {
+                ch = static_cast<unsigned char>( rng() );
+            }
+
+            std::uint64_t const h1 = hash64<H>( key.data(), n );
+
+            for( std::vector<unsigned char> const& d: diffs )
+            {
+                for( std::size_t j = 0; j < n; ++j )
+                {
+                    key2[ j ] = key[ j ] ^ d[ j ];
+                }
+
+                collisions[ t ] += hash64<H>( key2.data(), n ) == h1;
+            }
+        }
+    });
+
+    std::uint64_t c = 0;
+
+    for( std::uint64_t x: collisions ) c += x;
+
+    double const expected = static_cast<double>( diffs.size() ) * reps / std::ldexp( 1.0, bits );
+
+    char keys[ 40 ];
+    std::snprintf( keys, sizeof( keys ), "%zu byte keys, up to %d bits", n, k );
+
+    std::printf( "  %-12s %-28s %zu pairs, %2d bits: %llu collisions, %.2f expected", "differential", keys, diffs.size() * reps, bits, static_cast<unsigned long long>( c ), expected );
+    verdict( poisson_tail( c, expected ) );
+}
+
+template<class H> static void test_sparse( std::size_t n, int k )
+{
+    key_list const keys = sparse_keys( n, k );
+    std::vector<std::uint64_t> const v = hash_keys<H>( keys );
+
+    char name[ 40 ];
+    std::snprintf( name, sizeof( name ), "%zu byte keys, up to %d bits", n, k );
+
+    report_collisions( "sparse", name, v, result_bits<H>() );
+    report_distribution( name, v, result_bits<H>() );
+}
+
+template<class H> static void test_permutation( char const* name, std::vector<std::uint32_t> const& blocks, int m )
+{
+    key_list const keys = permutation_keys( blocks, m );
+    std::vector<std::uint64_t> const v = hash_keys<H>( keys );
+
+    report_collisions( "permutation", name, v, result_bits<H>() );
+    report_distribution( name, v, result_bits<H>() );
+}
+
+template<class H> static void test_speed()
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    std::vector<unsigned char> buffer( 256 * 1024, 0x5A );
+
+    double small_ns = 0;
+
+    {
+        std::uint64_t x = 0;
+        std::size_t m = 0;
+
+        clock_type::time_point t1 = clock_type::now(), t2;
+
+        do
+        {
+            for( int i = 0; i < 1024; ++i )
+            {
+                buffer[ 0 ] = static_cast<unsigned char>( x );
+                x += hash64<H>( buffer.data(), 16 );
+            }
+
+            m += 1024;
+            t2 = clock_type::now();
+        }
+        while( t2 - t1 < std::chrono::milliseconds( 50 ) );
+
+        small_ns = std::chrono::duration<double, std::nano>( t2 - t1 ).count() / m;
+
+        buffer[ 1 ] = static_cast<unsigned char>( x );
+    }
+
+    double bulk_gbs = 0;
+
+    {
+        std::uint64_t x = 0;
+        std::size_t m = 0;
+
+        clock_type::time_point t1 = clock_type::now(), t2;
+
+        do
+        {
+            x += hash64<H>( buffer.data(), buffer.size() );
+
+            ++m;
+            t2 = clock_type::now();
+        }
+        while( t2 - t1 < std::chrono::milliseconds( 100 ) );
+
+        bulk_gbs = m * buffer.size() / std::chrono::duration<double, std::nano>( t2 - t1 ).count();
+
+        buffer[ 1 ] = static_cast<unsigned char>( x );
+    }
+
+    std::printf( "  %-12s %.1f ns/hash for 16 byte keys, %.2f GB/s for 256 KiB blocks\n", "speed", small_ns, bulk_gbs );
+}
+
+template<class H> static void test( char const* name )
+{
+    std::printf( "%s (%d bits)\n\n", name, result_bits<H>() );
+
+    test_speed<H>();
+
+    std::size_t const reps = opt_quick? 10000: 100000;
+
+    for( std::size_t n: { 4, 8, 16, 32 } )
+    {
+        test_avalanche<H>( n, reps );
+    }
+
+    test_differential<H>( 8, 3, opt_quick? 100: 1000 );
+    test_differential<H>( 16, 2, opt_quick? 100: 1000 );
+
+    test_sparse<H>( 4, opt_quick? 5: 6 );
+    test_sparse<H>( 8, opt_quick? 3: 4 );
+    test_sparse<H>( 16, 3 );
+    test_sparse<H>( 64, 2 );
+    test_sparse<H>( 128, opt_quick? 1: 2 );
+
+    int const m = opt_quick? 5: 6;
+
+    test_permutation<H>( "low bits, 8 blocks", { 0, 1, 2, 3, 4, 5, 6, 7 }, m );
+    test_permutation<H>( "high bits, 8 blocks", { 0, 1u << 29, 2u << 29, 3u << 29, 4u << 29, 5u << 29, 6u << 29, 7u << 29 }, m );
+    test_permutation<H>( "0 and 0x80000000 blocks", { 0, 0x80000000u }, opt_quick? 14: 17 );
+    test_permutation<H>( "0 and 1 blocks", { 0, 1 }, opt_quick? 14: 17 );
+
+    std::puts( "" );
+}
+
+static void usage()
+{
+    std::fputs( "usage: quality [--algorithm=name] [--threads=n] [--quick]\n", stderr );
+}
+
+int main( int argc, char const* argv[] )
+{
+    for( int i = 1; i < argc; ++i )
+    {
+        if( std::strncmp( argv[ i ], "--algorithm=", 12 ) == 0 )
+        {
+            opt_algorithm = argv[ i ] + 12;
+
+            if( std::find_if( std::begin( names ), std::end( names ), []( char const* name ){ return std::strcmp( name, opt_algorithm ) == 0; } ) == std::end( names ) )
+            {
+                std::fprintf( stderr, "quality: unknown algorithm '%s'\n", opt_algorithm );
+                return 2;
+            }
+        }
+        else if( std::strncmp( argv[ i ], "--threads=", 10 ) == 0 )
+        {
+            opt_threads = static_cast<unsigned>( std::atoi( argv[ i ] + 10 ) );
+        }
+        else if( std::strcmp( argv[ i ], "--quick" ) == 0 )
+        {
+            opt_quick = true;
+        }
+        else
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    if( opt_threads == 0 )
+    {
+        opt_threads = std::thread::hardware_concurrency();
+    }
+
+    if( opt_threads == 0 )
+    {
+        opt_threads = 1;
+    }
+
+    std::printf( "%u threads%s\n\n", opt_threads, opt_quick? ", quick": "" );
+
+    std::vector<std::string> failed;
+
+    mp_for_each< mp_iota<mp_size<hashes>> >([&](auto I){
+
+        using H = mp_at<hashes, decltype(I)>;
+        char const* name = names[ I ];
+
+        if( opt_algorithm != 0 && std::strcmp( opt_algorithm, name ) != 0 ) return;
+
+        int const f = failures;
+
+        test<H>( name );
+
+        if( failures != f )
+        {
+            failed.push_back( name + std::string( " (" ) + std::to_string( failures - f ) + ")" );
+        }
+    });
+
+    std::printf( "%d failed tests\n", failures );
+
+    for( std::string const& s: failed )
+    {
+        std::printf( "  %s\n", s.c_str() );
+    }
+}
@@ -0,0 +1,501 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures how hashing scales over cores. For each hash algorithm, and
+// for 1, 2, 4, ... threads up to --threads, each thread repeatedly hashes
+// its own buffer of --size bytes for --time ms; the aggregate throughput
+// in GB/s is reported, along with the scaling efficiency, the throughput
+// divided by that of one thread times the number of threads. When the
+// efficiency drops while the cores are still idle, the hashing is limited
+// by the memory bandwidth, rather than by the speed of each core.
+//
+// Two more modes are measured alongside the algorithms:
+//
+// * sha2_256_multi4, where each thread hashes the four quarters of its
+//   buffer as independent messages, with sha2_256_multi<4>;
+// * blake3_tree, where the buffers of all threads form a single message,
+//   hashed with blake3::update_parallel on that many threads.
+//
+// On Linux, thread i is pinned to the i-th CPU that the process may run
+// on. With --placement=local (the default), each thread fills its own
+// buffer after being pinned, so that on a NUMA machine the buffer is
+// placed on the node of its thread (first touch). With --placement=remote,
+// the main thread fills all buffers, so that they all end up on its node,
+// which gives the cost of hashing memory attached to another socket.
+// (The workers of update_parallel bind themselves to the node of the part
+// they hash, so blake3_tree is insensitive to the pinning of its threads.)
+//
+// Usage: scaling [--algorithm=name] [--threads=n] [--size=n] [--time=ms]
+//                [--placement=local|remote] [--format=text|csv]
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/mp11.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+# include <pthread.h>
+# include <sched.h>
+# define HAS_AFFINITY
+#endif
+
+using namespace boost::mp11;
+using namespace boost::hash2;
+
+// the modes that aren't a plain hash algorithm
+
+struct sha2_256_multi4
+{
+};
+
+struct blake3_tree
+{
+};
+
+using hashes = mp_list<
+
+    fnv1a_64,
+    xxhash_64,
+    xxh3_64,
+    siphash_64,
+    crc32c,
+    md5_128,
+    sha1_160,
+    sha2_256,
+    sha2_512,
+    sha3_256,
+    blake2b_512,
+    blake2s_256,
+    blake3,
+    sha2_256_multi4,
+    blake3_tree
+
+>;
+
+constexpr char const* names[] = {
+
+    "fnv1a_64",
+    "xxhash_64",
+    "xxh3_64",
+    "siphash_64",
+    "crc32c",
+    "md5_128",
+    "sha1_160",
+    "sha2_256",
+    "sha2_512",
+    "sha3_256",
+    "blake2b_512",
+    "blake2s_256",
+    "blake3",
+    "sha2_256_multi4",
+    "blake3_tree",
+};
+
+static_assert( sizeof( names ) / sizeof( names[0] ) == mp_size<hashes>::value, "names and hashes must match" );
+
+enum class placement { local, remote };
+enum class format { text, csv };
+
+static char const* opt_algorithm = 0;
+static unsigned opt_threads = 0;
+static std::size_t opt_size = 8 * 1024 * 1024;
+static double opt_time = 200; // ms
+static placement opt_placement = placement::local;
+static format opt_format = format::text;
+
+// CPUs
+
+static std::vector<int> cpus;
+
+static void init_cpus()
+{
+#if defined(HAS_AFFINITY)
+
+    cpu_set_t set;
+    CPU_ZERO( &set );
+
+    if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 )
+    {
+        for( int i = 0; i < CPU_SETSIZE; ++i )
+        {
+            if( CPU_ISSET( i, &set ) ) cpus.push_back( i );
+        }
+    }
+
+#endif
+}
+
+// pins the calling thread to the i-th available CPU, when possible
+
+static void pin_thread( unsigned i )
+{
+#if defined(HAS_AFFINITY)
+
+    if( cpus.empty() ) return;
+
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    CPU_SET( cpus[ i % cpus.size() ], &set );
+
+    pthread_setaffinity_np( pthread_self(), sizeof( set ), &set );
+
+#else
+
+    (void)i;
+
+#endif
+}
+
+static void fill( unsigned char* p, std::size_t n, unsigned seed )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        p[ i ] = static_cast<unsigned char>( i * 0x9D + seed * 0x3B );
+    }
+}
+
+// hashing a buffer
+
+template<class H> static std::uint64_t hash_buffer( H*, unsigned char const* p, std::size_t n )
+{
+    H h;
+    h.update( p, n );
+
+    return get_integral_result<std::uint64_t>( h.result() );
+}
+
+static std::uint64_t hash_buffer( sha2_256_multi4*, unsigned char const* p, std::size_t n )
+{
+    std::size_t const m = n / 4;
+    unsigned char const* q[ 4 ] = { p, p + m, p + 2 * m, p + 3 * m };
+
+    sha2_256_multi<4> h;
+    h.update( q, m );
+
+    std::array<digest<32>, 4> const r = h.result();
+
+    return r[ 0 ][ 0 ] ^ r[ 1 ][ 0 ] ^ r[ 2 ][ 0 ] ^ r[ 3 ][ 0 ];
+}
+
+// the threads
+
+struct thread_result
+{
+    std::uint64_t bytes = 0;
+    double seconds = 0;
+    std::uint64_t sink = 0;
+};
+
+// releases the threads at once, after all of them have filled their buffers
+
+struct start_gate
+{
+    std::atomic<unsigned> ready{ 0 };
+    std::atomic<bool> go{ false };
+    std::atomic<bool> stop{ false };
+};
+
+template<class H> static void worker( unsigned i, unsigned char* p, start_gate& gate, thread_result& r )
+{
+    pin_thread( i );
+
+    if( opt_placement == placement::local )
+    {
+        fill( p, opt_size, i );
+    }
+
+    ++gate.ready;
+
+    while( !gate.go.load( std::memory_order_acquire ) )
+    {
+        std::this_thread::yield();
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    do
+    {
+        r.sink += hash_buffer( static_cast<H*>( 0 ), p, opt_size );
+        r.bytes += opt_size;
+    }
+    while( !gate.stop.load( std::memory_order_relaxed ) );
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    r.seconds = std::chrono::duration<double>( t2 - t1 ).count();
+}
+
+static std::uint64_t sink = 0;
+
+// the aggregate throughput of t threads, in GB/s
+
+template<class H> static double measure( unsigned t )
+{
+    std::unique_ptr<unsigned char[]> buffer( new unsigned char[ opt_size * t ] );
+
+    if( opt_placement == placement::remote )
+    {
+        fill( buffer.get(), opt_size * t, 0 );
+    }
+
+    start_gate gate;
+    std::vector<thread_result> results( t );
+
+    std::vector<std::thread> th;
+
+    for( unsigned i = 0; i < t; ++i )
+    {
+        th.emplace_back( worker<H>, i, buffer.get() + opt_size * i, std::ref( gate ), std::ref( results[ i ] ) );
+    }
+
+    while( gate.ready.load() != t )
+    {
+        std::this_thread::yield();
+    }
+
+    gate.go.store( true, std::memory_order_release );
+
+    std::this_thread::sleep_for( std::chrono::duration<double, std::milli>( opt_time ) );
+
+    gate.stop.store( true, std::memory_order_relaxed );
+
+    for( std::thread& x: th )
+    {
+        x.join();
+    }
+
+    double r = 0;
+
+    for( thread_result const& x: results )
+    {
+        r += x.bytes / x.seconds / 1e9;
+        sink += x.sink;
+    }
+
+    return r;
+}
+
+// blake3_tree hashes a single message of t buffers on t threads
+
+template<> double measure<blake3_tree>( unsigned t )
+{
+    std::size_t const n = opt_size * t;
+    std::unique_ptr<unsigned char[]> buffer( new unsigned char[ n ] );
+
+    if( opt_placement == placement::remote )
+    {
+        fill( buffer.get(), n, 0 );
+    }
+    else
+    {
+        // update_parallel splits the message into contiguous parts, one
+        // per thread, so each part is placed on the node of a thread
+
+        std::vector<std::thread> th;
+
+        for( unsigned i = 0; i < t; ++i )
+        {
+            th.emplace_back( [&, i]{ pin_thread( i ); fill( buffer.get() + opt_size * i, opt_size, i ); } );
+        }
+
+        for( std::thread& x: th )
+        {
+            x.join();
+        }
+    }
+
+    std::uint64_t bytes = 0;
+
+    auto t1 = std::chrono::steady_clock::now();
+    auto t2 = t1;
+
+    do
+    {
+        blake3 h;
+        h.update_parallel( buffer.get(), n, t );
+
+        sink += get_integral_result<std::uint64_t>( h.result() );
+        bytes += n;
+
+        t2 = std::chrono::steady_clock::now();
+    }
+    while( std::chrono::duration<double, std::milli>( t2 - t1 ).count() < opt_time );
+
+    return bytes / std::chrono::duration<double>( t2 - t1 ).count() / 1e9;
+}
+
+static std::vector<unsigned> thread_counts()
+{
+    std::vector<unsigned> r;
+
+    for( unsigned t = 1; t < opt_threads; t *= 2 )
+    {
+        r.push_back( t );
+    }
+
+    r.push_back( opt_threads );
+
+    return r;
+}
+
+static void usage()
+{
+    std::fputs(
+
+        "usage: scaling [--algorithm=name] [--threads=n] [--size=n] [--time=ms]\n"
+        "               [--placement=local|remote] [--format=text|csv]\n",
+
+        stderr
+    );
+}
+
+static bool parse_option( char const* arg )
+{
+    char const* v = std::strchr( arg, '=' );
+    if( v == 0 ) return false;
+
+    std::string const name( arg, v );
+    ++v;
+
+    if( name == "--algorithm" )
+    {
+        opt_algorithm = v;
+    }
+    else if( name == "--threads" )
+    {
+        opt_threads = static_cast<unsigned>( std::atoi( v ) );
+    }
+    else if( name == "--size" )
+    {
+        opt_size = std::strtoul( v, 0, 10 );
+        if( opt_size < 4 ) return false;
+    }
+    else if( name == "--time" )
+    {
+        opt_time = std::atof( v );
+        if( !( opt_time > 0 ) ) return false;
+    }
+    else if( name == "--placement" )
+    {
+        if( std::strcmp( v, "local" ) == 0 ) opt_placement = placement::local;
+        else if( std::strcmp( v, "remote" ) == 0 ) opt_placement = placement::remote;
+        else return false;
+    }
+    else if( name == "--format" )
+    {
+        if( std::strcmp( v, "text" ) == 0 ) opt_format = format::text;
+        else if( std::strcmp( v, "csv" ) == 0 ) opt_format = format::csv;
+        else return false;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+int main( int argc, char const* argv[] )
+{
+    for( int i = 1; i < argc; ++i )
+    {
+        if( !parse_option( argv[ i ] ) )
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    if( opt_algorithm != 0 && std::find_if( std::begin( names ), std::end( names ), []( char const* name ){ return std::strcmp( name, opt_algorithm ) == 0; } ) == std::end( names ) )
+    {
+        std::fprintf( stderr, "scaling: unknown algorithm '%s'\n", opt_algorithm );
+        return 2;
+    }
+
+    init_cpus();
+
+    if( opt_threads == 0 )
+    {
+        opt_threads = std::thread::hardware_concurrency();
+    }
+
+    if( opt_threads == 0 )
+    {
+        opt_threads = 1;
+    }
+
+    std::vector<unsigned> const tc = thread_counts();
+
+    if( opt_format == format::text )
+    {
+        std::printf( "%zu bytes per thread, %s placement, %zu CPUs available\n\n", opt_size, opt_placement == placement::local? "local": "remote", cpus.size() );
+    }
+    else
+    {
+        std::printf( "algorithm,threads,gbps,efficiency\n" );
+    }
+
+    mp_for_each< mp_iota<mp_size<hashes>> >([&](auto I){
+
+        using H = mp_at<hashes, decltype(I)>;
+        char const* name = names[ I ];
+
+        if( opt_algorithm != 0 && std::strcmp( opt_algorithm, name ) != 0 ) return;
+
+        double base = 0;
+
+        for( unsigned t: tc )
+        {
+            double const r = measure<H>( t );
+
+            if( t == 1 ) base = r;
+
+            double const e = r / ( base * t );
+
+            if( opt_format == format::text )
+            {
+                std::printf( "%-16s %4u threads: %8.2f GB/s, %5.1f%% efficiency\n", name, t, r, e * 100 );
+            }
+            else
+            {
+                std::printf( "%s,%u,%.3f,%.4f\n", name, t, r, e );
+            }
+
+            std::fflush( stdout );
+        }
+
+        if( opt_format == format::text )
+        {
+            std::puts( "" );
+        }
+    });
+
+    if( opt_format == format::text )
+    {
+        std::printf( "(%llu)\n", static_cast<unsigned long long>( sink ) );
+    }
+}
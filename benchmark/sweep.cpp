@@ -0,0 +1,903 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures every hash algorithm over input sizes from 0 to 1 MiB, in
+// two modes:
+//
+// * throughput, where the inputs are independent of each other, so that
+//   the processor can overlap consecutive hashes, as when hashing many
+//   unrelated keys;
+// * latency, where the first bytes of each input are the result of the
+//   previous hash, so that each hash must finish before the next starts,
+//   as in a hash table lookup that depends on the previous one.
+//
+// Each hash is constructed, updated with the whole input, and finalized,
+// and its time is reported in ns/hash and cycles/byte, with the standard
+// deviation over the samples. The cycles are TSC cycles, where available.
+//
+// With --counters, on Linux, the hardware performance counters are read
+// through perf_event_open during the samples, and the core cycles, the
+// instructions, the branch misses, and the L1D read misses per byte are
+// reported as well, along with the instructions per cycle. Counters that
+// can't be opened, because the processor or the virtual machine doesn't
+// provide them, or perf_event_paranoid forbids it, are reported as absent.
+//
+// Usage: sweep [--format=text|json|csv] [--mode=throughput|latency|both]
+//              [--algorithm=name] [--min-size=n] [--max-size=n]
+//              [--samples=n] [--time=ms] [--output=file] [--counters]
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/legacy/murmur3.hpp>
+#include <boost/hash2/legacy/spooky2.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/mp11.hpp>
+#include <boost/config.hpp>
+#include <boost/version.hpp>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+
+#if defined(_MSC_VER) && ( defined(_M_X64) || defined(_M_IX86) )
+# include <intrin.h>
+# define HAS_RDTSC
+#elif ( defined(__GNUC__) || defined(__clang__) ) && ( defined(__x86_64__) || defined(__i386__) )
+# include <x86intrin.h>
+# define HAS_RDTSC
+#endif
+
+#if defined(__linux__)
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+# define HAS_PERF_EVENT
+#endif
+
+using namespace boost::mp11;
+using namespace boost::hash2;
+
+using hashes = mp_list<
+
+    fnv1a_32,
+    fnv1a_64,
+    fnv1a_64_wide,
+    xxhash_32,
+    xxhash_64,
+    xxh3_64,
+    xxh3_128,
+    rapidhash_64,
+    aes_hash_128,
+    highwayhash_64,
+    highwayhash_128,
+    highwayhash_256,
+    siphash_32,
+    siphash_64,
+    siphash13_32,
+    siphash13_64,
+    crc32c,
+    md5_128,
+    sha1_160,
+    sha2_256,
+    sha2_224,
+    sha2_512,
+    sha2_384,
+    sha2_512_256,
+    sha2_512_224,
+    sha3_256,
+    sha3_224,
+    sha3_512,
+    sha3_384,
+    ripemd_160,
+    ripemd_128,
+    blake2b_512,
+    blake2s_256,
+    blake3,
+    k12,
+    murmur3_32,
+    murmur3_128,
+    spooky2_128
+
+>;
+
+constexpr char const* names[] = {
+
+    "fnv1a_32",
+    "fnv1a_64",
+    "fnv1a_64_wide",
+    "xxhash_32",
+    "xxhash_64",
+    "xxh3_64",
+    "xxh3_128",
+    "rapidhash_64",
+    "aes_hash_128",
+    "highwayhash_64",
+    "highwayhash_128",
+    "highwayhash_256",
+    "siphash_32",
+    "siphash_64",
+    "siphash13_32",
+    "siphash13_64",
+    "crc32c",
+    "md5_128",
+    "sha1_160",
+    "sha2_256",
+    "sha2_224",
+    "sha2_512",
+    "sha2_384",
+    "sha2_512_256",
+    "sha2_512_224",
+    "sha3_256",
+    "sha3_224",
+    "sha3_512",
+    "sha3_384",
+    "ripemd_160",
+    "ripemd_128",
+    "blake2b_512",
+    "blake2s_256",
+    "blake3",
+    "k12",
+    "murmur3_32",
+    "murmur3_128",
+    "spooky2_128"
+
+};
+
+static_assert( sizeof( names ) / sizeof( names[ 0 ] ) == mp_size<hashes>::value, "names doesn't match hashes" );
+
+// options
+
+enum class format { text, json, csv };
+
+static format opt_format = format::text;
+static bool opt_throughput = true;
+static bool opt_latency = true;
+static char const* opt_algorithm = 0;
+static std::size_t opt_min_size = 0;
+static std::size_t opt_max_size = 1024 * 1024;
+static int opt_samples = 10;
+static double opt_time = 2; // ms per sample
+static bool opt_counters = false;
+
+static std::FILE* out = stdout;
+
+// keeps the results from being optimized out
+static std::uint64_t volatile sink;
+
+static std::vector<unsigned char> data;
+
+// 0, the powers of two, and the odd sizes one short of them, at which the
+// block-based algorithms do the most work on the tail
+
+static std::vector<std::size_t> sizes()
+{
+    std::vector<std::size_t> r;
+
+    if( opt_min_size == 0 ) r.push_back( 0 );
+
+    for( std::size_t n = 1; n <= opt_max_size; n *= 2 )
+    {
+        if( n > 2 && n - 1 >= opt_min_size ) r.push_back( n - 1 );
+        if( n >= opt_min_size ) r.push_back( n );
+    }
+
+    return r;
+}
+
+static std::uint64_t cycles()
+{
+#if defined(HAS_RDTSC)
+
+    return __rdtsc();
+
+#else
+
+    return 0;
+
+#endif
+}
+
+// hardware performance counters
+
+enum
+{
+    counter_cycles,
+    counter_instructions,
+    counter_branch_misses,
+    counter_l1d_misses,
+
+    counter_count
+};
+
+static char const* const counter_names[ counter_count ] = { "cycles", "instructions", "branch misses", "L1D read misses" };
+
+// -1 when not open
+static int counter_fds[ counter_count ] = { -1, -1, -1, -1 };
+
+// returns the number of counters opened
+
+static int open_counters()
+{
+    int r = 0;
+
+#if defined(HAS_PERF_EVENT)
+
+    struct event
+    {
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+
+    event const events[ counter_count ] = {
+
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | ( PERF_COUNT_HW_CACHE_OP_READ << 8 ) | ( PERF_COUNT_HW_CACHE_RESULT_MISS << 16 ) },
+    };
+
+    for( int i = 0; i < counter_count; ++i )
+    {
+        perf_event_attr pe;
+        std::memset( &pe, 0, sizeof( pe ) );
+
+        pe.type = events[ i ].type;
+        pe.size = sizeof( pe );
+        pe.config = events[ i ].config;
+        pe.disabled = 1;
+        pe.exclude_kernel = 1;
+        pe.exclude_hv = 1;
+
+        // when there are more events than counters, the kernel multiplexes
+        // them, and the values are scaled by the fraction of the time counted
+        pe.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        counter_fds[ i ] = static_cast<int>( syscall( SYS_perf_event_open, &pe, 0, -1, -1, 0 ) );
+
+        if( counter_fds[ i ] >= 0 )
+        {
+            ++r;
+        }
+        else
+        {
+            std::fprintf( stderr, "sweep: the %s counter is unavailable: %s\n", counter_names[ i ], std::strerror( errno ) );
+        }
+    }
+
+#else
+
+    std::fprintf( stderr, "sweep: --counters is only supported on Linux\n" );
+
+#endif
+
+    return r;
+}
+
+static void control_counters( unsigned long request )
+{
+#if defined(HAS_PERF_EVENT)
+
+    for( int fd: counter_fds )
+    {
+        if( fd >= 0 ) ioctl( fd, request, 0 );
+    }
+
+#else
+
+    (void)request;
+
+#endif
+}
+
+static void reset_counters()
+{
+#if defined(HAS_PERF_EVENT)
+
+    control_counters( PERF_EVENT_IOC_RESET );
+
+#endif
+}
+
+static void start_counters()
+{
+#if defined(HAS_PERF_EVENT)
+
+    control_counters( PERF_EVENT_IOC_ENABLE );
+
+#endif
+}
+
+static void stop_counters()
+{
+#if defined(HAS_PERF_EVENT)
+
+    control_counters( PERF_EVENT_IOC_DISABLE );
+
+#endif
+}
+
+// the counts since the last reset; -1 for the counters not open, or
+// that didn't get to run
+
+static void read_counters( double (&v)[ counter_count ] )
+{
+    for( int i = 0; i < counter_count; ++i )
+    {
+        v[ i ] = -1;
+
+#if defined(HAS_PERF_EVENT)
+
+        std::uint64_t w[ 3 ]; // value, time enabled, time running
+
+        if( counter_fds[ i ] >= 0 && read( counter_fds[ i ], w, sizeof( w ) ) == sizeof( w ) && w[ 2 ] != 0 )
+        {
+            v[ i ] = static_cast<double>( w[ 0 ] ) * w[ 1 ] / w[ 2 ];
+        }
+
+#endif
+    }
+}
+
+static void close_counters()
+{
+#if defined(HAS_PERF_EVENT)
+
+    for( int& fd: counter_fds )
+    {
+        if( fd >= 0 ) close( fd );
+        fd = -1;
+    }
+
+#endif
+}
+
+struct statistic
+{
+    double mean;
+    double stddev;
+    double min;
+};
+
+static statistic compute( std::vector<double> const& v )
+{
+    statistic r = { 0, 0, v[ 0 ] };
+
+    for( double x: v )
+    {
+        r.mean += x;
+        r.min = std::min( r.min, x );
+    }
+
+    r.mean /= v.size();
+
+    if( v.size() > 1 )
+    {
+        for( double x: v )
+        {
+            r.stddev += ( x - r.mean ) * ( x - r.mean );
+        }
+
+        r.stddev = std::sqrt( r.stddev / ( v.size() - 1 ) );
+    }
+
+    return r;
+}
+
+// runs m hashes of n bytes; in latency mode, the first bytes of each input
+// are the result of the previous hash
+
+template<class H> static void run( std::size_t n, std::size_t m, bool latency )
+{
+    unsigned char* p = data.data();
+
+    std::uint64_t x = 0;
+
+    for( std::size_t i = 0; i < m; ++i )
+    {
+        H h;
+        h.update( p, n );
+
+        std::uint64_t r = get_integral_result<std::uint64_t>( h.result() );
+
+        if( latency )
+        {
+            std::memcpy( p, &r, n < 8? n: 8 );
+        }
+
+        x += r;
+    }
+
+    sink = x;
+}
+
+struct result
+{
+    char const* algorithm;
+    char const* mode;
+    std::size_t size;
+
+    std::size_t hashes; // per sample
+
+    statistic ns_per_hash;
+    statistic cycles_per_hash;
+
+    // per hash, over all samples; -1 when unavailable
+    double counters[ counter_count ];
+};
+
+typedef std::chrono::steady_clock clock_type;
+
+template<class H> static result measure( char const* name, std::size_t n, bool latency )
+{
+    // the number of hashes per sample, such that a sample takes opt_time ms
+
+    std::size_t m = 1;
+
+    for( ;; )
+    {
+        clock_type::time_point t1 = clock_type::now();
+
+        run<H>( n, m, latency );
+
+        clock_type::time_point t2 = clock_type::now();
+
+        double ms = std::chrono::duration<double, std::milli>( t2 - t1 ).count();
+
+        if( ms >= opt_time ) break;
+
+        if( ms < opt_time / 16 )
+        {
+            m *= 16;
+        }
+        else
+        {
+            m = static_cast<std::size_t>( m * opt_time / ms ) + 1;
+        }
+    }
+
+    std::vector<double> ns( opt_samples ), cy( opt_samples );
+
+    reset_counters();
+
+    for( int i = 0; i < opt_samples; ++i )
+    {
+        start_counters();
+
+        clock_type::time_point t1 = clock_type::now();
+        std::uint64_t c1 = cycles();
+
+        run<H>( n, m, latency );
+
+        std::uint64_t c2 = cycles();
+        clock_type::time_point t2 = clock_type::now();
+
+        stop_counters();
+
+        ns[ i ] = std::chrono::duration<double, std::nano>( t2 - t1 ).count() / m;
+        cy[ i ] = static_cast<double>( c2 - c1 ) / m;
+    }
+
+    result r = { name, latency? "latency": "throughput", n, m, compute( ns ), compute( cy ), {} };
+
+    read_counters( r.counters );
+
+    for( double& x: r.counters )
+    {
+        if( x >= 0 ) x /= static_cast<double>( m ) * opt_samples;
+    }
+
+    return r;
+}
+
+// output
+
+static bool first_result = true;
+
+static void print_header()
+{
+    switch( opt_format )
+    {
+    case format::text:
+
+        std::fprintf( out, "%-14s %-10s %8s %12s %8s %11s %8s %10s", "algorithm", "mode", "size", "ns/hash", "stddev", "cycles/byte", "stddev", "MB/s" );
+
+        if( opt_counters )
+        {
+            std::fprintf( out, " %10s %10s %6s %10s %10s", "cyc/B", "instr/B", "IPC", "brmiss/B", "L1Dmiss/B" );
+        }
+
+        std::fprintf( out, "\n" );
+        break;
+
+    case format::json:
+
+        std::fprintf( out, "{\n" );
+        std::fprintf( out, "  \"benchmark\": \"sweep\",\n" );
+        std::fprintf( out, "  \"boost_version\": %d,\n", BOOST_VERSION );
+        std::fprintf( out, "  \"compiler\": \"%s\",\n", BOOST_COMPILER );
+        std::fprintf( out, "  \"platform\": \"%s\",\n", BOOST_PLATFORM );
+
+#if defined(HAS_RDTSC)
+
+        std::fprintf( out, "  \"cycles\": \"rdtsc\",\n" );
+
+#else
+
+        std::fprintf( out, "  \"cycles\": null,\n" );
+
+#endif
+
+        std::fprintf( out, "  \"results\": [" );
+        break;
+
+    case format::csv:
+
+        std::fprintf( out, "algorithm,mode,size,hashes_per_sample,ns_per_hash,ns_per_hash_stddev,ns_per_hash_min,cycles_per_hash,cycles_per_hash_stddev,cycles_per_byte,cycles_per_byte_stddev" );
+
+        if( opt_counters )
+        {
+            std::fprintf( out, ",core_cycles_per_byte,instructions_per_byte,instructions_per_cycle,branch_misses_per_byte,l1d_misses_per_byte" );
+        }
+
+        std::fprintf( out, "\n" );
+        break;
+    }
+}
+
+// the derived counter values; -1 when not available
+
+enum
+{
+    derived_cycles_per_byte,
+    derived_instructions_per_byte,
+    derived_ipc,
+    derived_branch_misses_per_byte,
+    derived_l1d_misses_per_byte,
+
+    derived_count
+};
+
+static char const* const derived_names[ derived_count ] = { "core_cycles_per_byte", "instructions_per_byte", "instructions_per_cycle", "branch_misses_per_byte", "l1d_misses_per_byte" };
+
+static void print_counters( result const& r )
+{
+    double const* c = r.counters;
+
+    auto per_byte = [&]( double x ){ return x >= 0 && r.size? x / r.size: -1; };
+
+    double const v[ derived_count ] = {
+
+        per_byte( c[ counter_cycles ] ),
+        per_byte( c[ counter_instructions ] ),
+        c[ counter_instructions ] >= 0 && c[ counter_cycles ] > 0? c[ counter_instructions ] / c[ counter_cycles ]: -1,
+        per_byte( c[ counter_branch_misses ] ),
+        per_byte( c[ counter_l1d_misses ] ),
+    };
+
+    for( int i = 0; i < derived_count; ++i )
+    {
+        switch( opt_format )
+        {
+        case format::text:
+
+            if( v[ i ] >= 0 )
+            {
+                std::fprintf( out, i == derived_ipc? " %6.2f": " %10.4f", v[ i ] );
+            }
+            else
+            {
+                std::fprintf( out, i == derived_ipc? " %6s": " %10s", "-" );
+            }
+
+            break;
+
+        case format::json:
+
+            if( v[ i ] >= 0 )
+            {
+                std::fprintf( out, ", \"%s\": %.4f", derived_names[ i ], v[ i ] );
+            }
+            else
+            {
+                std::fprintf( out, ", \"%s\": null", derived_names[ i ] );
+            }
+
+            break;
+
+        case format::csv:
+
+            if( v[ i ] >= 0 )
+            {
+                std::fprintf( out, ",%.4f", v[ i ] );
+            }
+            else
+            {
+                std::fprintf( out, "," );
+            }
+
+            break;
+        }
+    }
+}
+
+static void print( result const& r )
+{
+#if defined(HAS_RDTSC)
+
+    bool const has_cycles = true;
+
+#else
+
+    bool const has_cycles = false;
+
+#endif
+
+    // cycles/byte, and its standard deviation, aren't defined for size 0
+
+    double const cpb = r.size? r.cycles_per_hash.mean / r.size: 0;
+    double const cpb_sd = r.size? r.cycles_per_hash.stddev / r.size: 0;
+
+    double const sd_percent = r.ns_per_hash.mean > 0? 100 * r.ns_per_hash.stddev / r.ns_per_hash.mean: 0;
+
+    switch( opt_format )
+    {
+    case format::text:
+
+        std::fprintf( out, "%-14s %-10s %8zu %12.2f %7.1f%% ", r.algorithm, r.mode, r.size, r.ns_per_hash.mean, sd_percent );
+
+        if( has_cycles && r.size )
+        {
+            std::fprintf( out, "%11.3f %7.1f%% ", cpb, cpb > 0? 100 * cpb_sd / cpb: 0 );
+        }
+        else
+        {
+            std::fprintf( out, "%11s %8s ", "-", "-" );
+        }
+
+        std::fprintf( out, "%10.1f", r.ns_per_hash.mean > 0? r.size * 1e3 / r.ns_per_hash.mean / 1.048576: 0 );
+
+        if( opt_counters ) print_counters( r );
+
+        std::fprintf( out, "\n" );
+        break;
+
+    case format::json:
+
+        std::fprintf( out, "%s\n    { \"algorithm\": \"%s\", \"mode\": \"%s\", \"size\": %zu, \"hashes_per_sample\": %zu, ",
+            first_result? "": ",", r.algorithm, r.mode, r.size, r.hashes );
+
+        std::fprintf( out, "\"ns_per_hash\": %.4f, \"ns_per_hash_stddev\": %.4f, \"ns_per_hash_min\": %.4f, ",
+            r.ns_per_hash.mean, r.ns_per_hash.stddev, r.ns_per_hash.min );
+
+        if( has_cycles )
+        {
+            std::fprintf( out, "\"cycles_per_hash\": %.2f, \"cycles_per_hash_stddev\": %.2f, ", r.cycles_per_hash.mean, r.cycles_per_hash.stddev );
+        }
+        else
+        {
+            std::fprintf( out, "\"cycles_per_hash\": null, \"cycles_per_hash_stddev\": null, " );
+        }
+
+        if( has_cycles && r.size )
+        {
+            std::fprintf( out, "\"cycles_per_byte\": %.4f, \"cycles_per_byte_stddev\": %.4f", cpb, cpb_sd );
+        }
+        else
+        {
+            std::fprintf( out, "\"cycles_per_byte\": null, \"cycles_per_byte_stddev\": null" );
+        }
+
+        if( opt_counters ) print_counters( r );
+
+        std::fprintf( out, " }" );
+        break;
+
+    case format::csv:
+
+        std::fprintf( out, "%s,%s,%zu,%zu,%.4f,%.4f,%.4f,", r.algorithm, r.mode, r.size, r.hashes, r.ns_per_hash.mean, r.ns_per_hash.stddev, r.ns_per_hash.min );
+
+        if( has_cycles )
+        {
+            std::fprintf( out, "%.2f,%.2f,", r.cycles_per_hash.mean, r.cycles_per_hash.stddev );
+        }
+        else
+        {
+            std::fprintf( out, ",," );
+        }
+
+        if( has_cycles && r.size )
+        {
+            std::fprintf( out, "%.4f,%.4f", cpb, cpb_sd );
+        }
+        else
+        {
+            std::fprintf( out, "," );
+        }
+
+        if( opt_counters ) print_counters( r );
+
+        std::fprintf( out, "\n" );
+        break;
+    }
+
+    first_result = false;
+    std::fflush( out );
+}
+
+static void print_footer()
+{
+    if( opt_format == format::json )
+    {
+        std::fprintf( out, "\n  ]\n}\n" );
+    }
+}
+
+static void usage()
+{
+    std::fputs(
+
+        "usage: sweep [--format=text|json|csv] [--mode=throughput|latency|both]\n"
+        "             [--algorithm=name] [--min-size=n] [--max-size=n]\n"
+        "             [--samples=n] [--time=ms] [--output=file] [--counters]\n",
+
+        stderr
+    );
+}
+
+static bool parse_option( char const* arg )
+{
+    if( std::strcmp( arg, "--counters" ) == 0 )
+    {
+        opt_counters = true;
+        return true;
+    }
+
+    char const* v = std::strchr( arg, '=' );
+    if( v == 0 ) return false;
+
+    std::string const name( arg, v );
+    ++v;
+
+    if( name == "--format" )
+    {
+        if( std::strcmp( v, "text" ) == 0 ) opt_format = format::text;
+        else if( std::strcmp( v, "json" ) == 0 ) opt_format = format::json;
+        else if( std::strcmp( v, "csv" ) == 0 ) opt_format = format::csv;
+        else return false;
+    }
+    else if( name == "--mode" )
+    {
+        if( std::strcmp( v, "throughput" ) == 0 ) { opt_throughput = true; opt_latency = false; }
+        else if( std::strcmp( v, "latency" ) == 0 ) { opt_throughput = false; opt_latency = true; }
+        else if( std::strcmp( v, "both" ) == 0 ) { opt_throughput = true; opt_latency = true; }
+        else return false;
+    }
+    else if( name == "--algorithm" )
+    {
+        opt_algorithm = v;
+    }
+    else if( name == "--min-size" )
+    {
+        opt_min_size = std::strtoul( v, 0, 10 );
+    }
+    else if( name == "--max-size" )
+    {
+        opt_max_size = std::strtoul( v, 0, 10 );
+    }
+    else if( name == "--samples" )
+    {
+        opt_samples = std::atoi( v );
+        if( opt_samples < 1 ) return false;
+    }
+    else if( name == "--time" )
+    {
+        opt_time = std::atof( v );
+        if( !( opt_time > 0 ) ) return false;
+    }
+    else if( name == "--output" )
+    {
+        out = std::fopen( v, "w" );
+
+        if( out == 0 )
+        {
+            std::perror( v );
+            std::exit( 1 );
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+int main( int argc, char const* argv[] )
+{
+    for( int i = 1; i < argc; ++i )
+    {
+        if( !parse_option( argv[ i ] ) )
+        {
+            usage();
+            return 2;
+        }
+    }
+
+    if( opt_algorithm != 0 && std::find_if( std::begin( names ), std::end( names ), []( char const* name ){ return std::strcmp( name, opt_algorithm ) == 0; } ) == std::end( names ) )
+    {
+        std::fprintf( stderr, "sweep: unknown algorithm '%s'\n", opt_algorithm );
+        return 2;
+    }
+
+    data.resize( opt_max_size );
+
+    for( std::size_t i = 0; i < data.size(); ++i )
+    {
+        data[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    std::vector<std::size_t> const sz = sizes();
+
+    if( opt_counters && open_counters() == 0 )
+    {
+        std::fprintf( stderr, "sweep: no hardware performance counters are available\n" );
+    }
+
+    print_header();
+
+    mp_for_each< mp_iota<mp_size<hashes>> >([&](auto I){
+
+        using H = mp_at<hashes, decltype(I)>;
+        char const* name = names[ I ];
+
+        if( opt_algorithm != 0 && std::strcmp( opt_algorithm, name ) != 0 ) return;
+
+        if( opt_throughput )
+        {
+            for( std::size_t n: sz )
+            {
+                print( measure<H>( name, n, false ) );
+            }
+        }
+
+        if( opt_latency )
+        {
+            for( std::size_t n: sz )
+            {
+                print( measure<H>( name, n, true ) );
+            }
+        }
+    });
+
+    print_footer();
+
+    close_counters();
+
+    if( out != stdout )
+    {
+        std::fclose( out );
+    }
+}
@@ -7,12 +7,16 @@
 #include <boost/hash2/fnv1a.hpp>
 #include <boost/hash2/siphash.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/highwayhash.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
 #include <boost/hash2/sha2.hpp>
 #include <boost/hash2/ripemd.hpp>
 #include <boost/hash2/hash_append.hpp>
 #include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/batch_find.hpp>
 #include <boost/unordered/unordered_flat_set.hpp>
 #include <boost/core/type_name.hpp>
 #include <cstdint>
@@ -123,12 +127,34 @@ template<class V, class S> BOOST_NOINLINE void test4( int N, V const& v, char co
 
     clock_type::time_point t3 = clock_type::now();
 
+    std::size_t q2 = 0;
+
+    {
+        using iterator = typename S::const_iterator;
+
+        int const M = 256;
+        iterator r[ M ];
+
+        for( int i = 0; i < 16 * N; i += M )
+        {
+            boost::hash2::batch_find( s, v.begin() + i, v.begin() + i + M, r );
+
+            for( int j = 0; j < M; ++j )
+            {
+                q2 += r[ j ] != s.end();
+            }
+        }
+    }
+
+    clock_type::time_point t4 = clock_type::now();
+
     long long ms1 = std::chrono::duration_cast<std::chrono::milliseconds>( t2 - t1 ).count();
     long long ms2 = std::chrono::duration_cast<std::chrono::milliseconds>( t3 - t2 ).count();
+    long long ms3 = std::chrono::duration_cast<std::chrono::milliseconds>( t4 - t3 ).count();
 
     std::size_t n = s.bucket_count();
 
-    std::printf( "%s: n=%zu, q=%zu, %lld + %lld = %lld ms\n", hash, n, q, ms1, ms2, ms1 + ms2 );
+    std::printf( "%s: n=%zu, q=%zu, %lld + %lld = %lld ms (batch_find: q=%zu, %lld ms)\n", hash, n, q, ms1, ms2, ms1 + ms2, q2, ms3 );
 }
 
 template<class K, class H, class V> void test2( int N, V const& v )
@@ -207,8 +233,12 @@ int main()
 
     test2<K, boost::hash2::fnv1a_32>( N, v );
     test2<K, boost::hash2::fnv1a_64>( N, v );
+    test2<K, boost::hash2::fnv1a_64_wide>( N, v );
     test2<K, boost::hash2::xxhash_32>( N, v );
     test2<K, boost::hash2::xxhash_64>( N, v );
+    test2<K, boost::hash2::rapidhash_64>( N, v );
+    test2<K, boost::hash2::aes_hash_128>( N, v );
+    test2<K, boost::hash2::highwayhash_64>( N, v );
     test2<K, boost::hash2::siphash_32>( N, v );
     test2<K, boost::hash2::siphash_64>( N, v );
     test2<K, boost::hash2::md5_128>( N, v );
@@ -0,0 +1,390 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Measures the hash algorithms in boost::unordered_flat_map and in
+// std::unordered_map, over several key distributions: URL-like strings,
+// UUIDs, sequential integers, pointers, and small tuples. For each, it
+// reports the time per insertion, per successful lookup, with the keys
+// looked up uniformly and following a Zipfian distribution, and per
+// failed lookup, in ns, followed by the probe lengths.
+//
+// For std::unordered_map, the probe lengths are the mean number of nodes
+// visited by a successful and a failed lookup, and the longest bucket.
+// For boost::unordered_flat_map, they are the mean probe lengths of the
+// insertions and the lookups, as reported by get_stats(); define
+// BOOST_UNORDERED_ENABLE_STATS (Boost 1.86 or later) to enable them. The
+// times then include the cost of collecting them.
+//
+// Usage: workloads [number of keys]
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/unordered/unordered_flat_map.hpp>
+#include <boost/container_hash/hash.hpp>
+#include <boost/config.hpp>
+#include <unordered_map>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+template<class K, class H> class hash_without_seed
+{
+public:
+
+    using is_avalanching = std::true_type;
+
+    std::size_t operator()( K const& v ) const
+    {
+        H h;
+        boost::hash2::hash_append( h, {}, v );
+
+        return boost::hash2::get_integral_result<std::size_t>( h.result() );
+    }
+};
+
+// key sets
+
+template<class K> struct key_set
+{
+    char const* name;
+
+    // inserted
+    std::vector<K> keys;
+
+    // not inserted
+    std::vector<K> missing;
+};
+
+struct node
+{
+    std::uint64_t data[ 4 ];
+};
+
+using uuid = std::array<unsigned char, 16>;
+using small_tuple = std::tuple<std::uint32_t, std::uint16_t, std::uint8_t>;
+
+static std::mt19937_64 rng;
+
+static std::string make_url( std::uint64_t k )
+{
+    char buffer[ 128 ];
+
+    std::snprintf( buffer, sizeof( buffer ), "https://www.host%u.example.com/api/v%u/items/%llu?session=%08x",
+        static_cast<unsigned>( k % 1000 ), static_cast<unsigned>( k % 3 + 1 ),
+        static_cast<unsigned long long>( k ), static_cast<unsigned>( k * 0x9E3779B9u ) );
+
+    return buffer;
+}
+
+static uuid make_uuid()
+{
+    uuid r;
+
+    std::uint64_t x = rng(), y = rng();
+
+    for( int i = 0; i < 8; ++i )
+    {
+        r[ i ] = static_cast<unsigned char>( x >> ( 8 * i ) );
+        r[ i + 8 ] = static_cast<unsigned char>( y >> ( 8 * i ) );
+    }
+
+    // version 4, variant 1
+    r[ 6 ] = static_cast<unsigned char>( ( r[ 6 ] & 0x0F ) | 0x40 );
+    r[ 8 ] = static_cast<unsigned char>( ( r[ 8 ] & 0x3F ) | 0x80 );
+
+    return r;
+}
+
+// the inserted keys are the first n of v, the missing ones the rest
+
+template<class K> static key_set<K> split( char const* name, std::vector<K> v, std::size_t n )
+{
+    key_set<K> r;
+
+    r.name = name;
+    r.keys.assign( v.begin(), v.begin() + n );
+    r.missing.assign( v.begin() + n, v.end() );
+
+    return r;
+}
+
+// lookup streams, as indices into the inserted keys
+
+static std::vector<std::size_t> uniform_lookups( std::size_t n )
+{
+    std::vector<std::size_t> r( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r[ i ] = i;
+    }
+
+    std::shuffle( r.begin(), r.end(), rng );
+
+    return r;
+}
+
+// the key of rank i is looked up with probability proportional to
+// 1 / (i + 1); the ranks are assigned to the keys at random
+
+static std::vector<std::size_t> zipf_lookups( std::size_t n )
+{
+    std::vector<double> cdf( n );
+
+    double s = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        s += 1.0 / ( i + 1 );
+        cdf[ i ] = s;
+    }
+
+    std::vector<std::size_t> const rank = uniform_lookups( n );
+
+    std::uniform_real_distribution<double> dist( 0, s );
+
+    std::vector<std::size_t> r( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::size_t j = std::lower_bound( cdf.begin(), cdf.end(), dist( rng ) ) - cdf.begin();
+        r[ i ] = rank[ j < n? j: n - 1 ];
+    }
+
+    return r;
+}
+
+static std::vector<std::size_t> uniform, zipf;
+
+// probe lengths
+
+template<class K, class V, class H, class E, class A> static std::string probe_stats( std::unordered_map<K, V, H, E, A> const& m, key_set<K> const& ks )
+{
+    double hit = 0;
+    std::size_t longest = 0;
+
+    for( std::size_t b = 0; b < m.bucket_count(); ++b )
+    {
+        std::size_t s = m.bucket_size( b );
+
+        // the keys of a bucket of s are found after 1, 2, ..., s nodes
+        hit += s * ( s + 1 ) / 2.0;
+
+        longest = std::max( longest, s );
+    }
+
+    hit /= m.size();
+
+    double miss = 0;
+
+    for( K const& k: ks.missing )
+    {
+        miss += m.bucket_size( m.bucket( k ) );
+    }
+
+    miss /= ks.missing.size();
+
+    char buffer[ 128 ];
+    std::snprintf( buffer, sizeof( buffer ), "nodes hit=%.2f miss=%.2f longest=%zu", hit, miss, longest );
+
+    return buffer;
+}
+
+template<class K, class V, class H, class E, class A> static std::string probe_stats( boost::unordered_flat_map<K, V, H, E, A> const& m, key_set<K> const& )
+{
+#if defined(BOOST_UNORDERED_ENABLE_STATS)
+
+    auto const st = m.get_stats();
+
+    char buffer[ 128 ];
+
+    std::snprintf( buffer, sizeof( buffer ), "probes insert=%.2f hit=%.2f miss=%.2f",
+        st.insertion.probe_length.average, st.successful_lookup.probe_length.average, st.unsuccessful_lookup.probe_length.average );
+
+    return buffer;
+
+#else
+
+    (void)m;
+    return "-";
+
+#endif
+}
+
+// the benchmark
+
+typedef std::chrono::steady_clock clock_type;
+
+static double ns_per_op( clock_type::time_point t1, clock_type::time_point t2, std::size_t n )
+{
+    return std::chrono::duration<double, std::nano>( t2 - t1 ).count() / n;
+}
+
+template<class M, class K> BOOST_NOINLINE void test_map( char const* container, char const* hash, key_set<K> const& ks, M m )
+{
+    std::size_t const n = ks.keys.size();
+
+    clock_type::time_point t1 = clock_type::now();
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        m.emplace( ks.keys[ i ], static_cast<std::uint32_t>( i ) );
+    }
+
+    clock_type::time_point t2 = clock_type::now();
+
+    std::size_t q = 0;
+
+    for( std::size_t i: uniform )
+    {
+        q += m.find( ks.keys[ i ] )->second;
+    }
+
+    clock_type::time_point t3 = clock_type::now();
+
+    for( std::size_t i: zipf )
+    {
+        q += m.find( ks.keys[ i ] )->second;
+    }
+
+    clock_type::time_point t4 = clock_type::now();
+
+    for( K const& k: ks.missing )
+    {
+        q += m.count( k );
+    }
+
+    clock_type::time_point t5 = clock_type::now();
+
+    std::printf( "%-10s %-14s %-14s %8.1f %8.1f %8.1f %8.1f  %s (q=%zu)\n", ks.name, container, hash,
+        ns_per_op( t1, t2, n ), ns_per_op( t2, t3, uniform.size() ), ns_per_op( t3, t4, zipf.size() ), ns_per_op( t4, t5, ks.missing.size() ),
+        probe_stats( m, ks ).c_str(), q );
+}
+
+template<class K, class H> void test_hash( char const* name, key_set<K> const& ks )
+{
+    test_map( "flat_map", name, ks, boost::unordered_flat_map<K, std::uint32_t, H>() );
+    test_map( "std", name, ks, std::unordered_map<K, std::uint32_t, H>() );
+}
+
+template<class K> void test( key_set<K> const& ks )
+{
+    using namespace boost::hash2;
+
+    test_hash<K, boost::hash<K>>( "boost::hash", ks );
+    test_hash<K, hash_without_seed<K, fnv1a_32>>( "fnv1a_32", ks );
+    test_hash<K, hash_without_seed<K, fnv1a_64>>( "fnv1a_64", ks );
+    test_hash<K, hash_without_seed<K, mix32>>( "mix32", ks );
+    test_hash<K, hash_without_seed<K, mix64>>( "mix64", ks );
+    test_hash<K, hash_without_seed<K, xxhash_32>>( "xxhash_32", ks );
+    test_hash<K, hash_without_seed<K, xxhash_64>>( "xxhash_64", ks );
+    test_hash<K, hash_without_seed<K, xxh3_64>>( "xxh3_64", ks );
+    test_hash<K, hash_without_seed<K, xxh3_128>>( "xxh3_128", ks );
+    test_hash<K, hash_without_seed<K, siphash13_64>>( "siphash13_64", ks );
+    test_hash<K, hash_without_seed<K, siphash_64>>( "siphash_64", ks );
+    test_hash<K, hash_without_seed<K, md5_128>>( "md5_128", ks );
+    test_hash<K, hash_without_seed<K, sha2_256>>( "sha2_256", ks );
+
+    std::puts( "" );
+}
+
+int main( int argc, char const* argv[] )
+{
+    std::size_t n = 262144;
+
+    if( argc > 1 )
+    {
+        n = std::strtoul( argv[ 1 ], 0, 10 );
+        if( n == 0 ) n = 1;
+    }
+
+    uniform = uniform_lookups( n );
+    zipf = zipf_lookups( n );
+
+    std::printf( "%zu keys; insert, hit, zipf hit, and miss in ns/op, then the probe lengths\n\n", n );
+
+    std::printf( "%-10s %-14s %-14s %8s %8s %8s %8s  %s\n\n", "keys", "container", "hash", "insert", "hit", "zipf", "miss", "probes" );
+
+    {
+        std::vector<std::string> v;
+
+        for( std::size_t i = 0; i < 2 * n; ++i )
+        {
+            v.push_back( make_url( rng() ) );
+        }
+
+        test( split( "url", v, n ) );
+    }
+
+    {
+        std::vector<uuid> v;
+
+        for( std::size_t i = 0; i < 2 * n; ++i )
+        {
+            v.push_back( make_uuid() );
+        }
+
+        test( split( "uuid", v, n ) );
+    }
+
+    {
+        std::vector<std::uint64_t> v;
+
+        for( std::size_t i = 0; i < 2 * n; ++i )
+        {
+            v.push_back( i );
+        }
+
+        test( split( "sequential", v, n ) );
+    }
+
+    {
+        // as returned by the allocator, which places them at a fixed stride
+        std::vector<node> nodes( 2 * n );
+
+        std::vector<node const*> v;
+
+        for( std::size_t i = 0; i < 2 * n; ++i )
+        {
+            v.push_back( &nodes[ i ] );
+        }
+
+        test( split( "pointer", v, n ) );
+    }
+
+    {
+        // (id, port, flags)-like tuples, with few distinct values in the
+        // second and third members
+
+        std::vector<small_tuple> v;
+
+        for( std::size_t i = 0; i < 2 * n; ++i )
+        {
+            std::uint64_t k = rng();
+            v.push_back( small_tuple( static_cast<std::uint32_t>( i ), static_cast<std::uint16_t>( 8000 + k % 16 ), static_cast<std::uint8_t>( k >> 32 & 3 ) ) );
+        }
+
+        std::shuffle( v.begin(), v.end(), rng );
+
+        test( split( "tuple", v, n ) );
+    }
+}
@@ -8,53 +8,25 @@
 #include <boost/hash2/sha1.hpp>
 #include <boost/hash2/sha2.hpp>
 #include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/hash_file.hpp>
+#include <boost/hash2/hash_directory.hpp>
+#include <boost/hash2/digest_cache.hpp>
+#include <boost/hash2/multi_hash.hpp>
+#include <boost/hash2/executor.hpp>
 #include <boost/mp11.hpp>
-#include <array>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <system_error>
+#include <thread>
+#include <tuple>
+#include <vector>
 #include <cerrno>
 #include <cstdio>
-
-template<class Hash> void hash2sum( std::FILE* f, char const* fn )
-{
-    Hash hash;
-
-    int const N = 4096;
-    unsigned char buffer[ N ];
-
-    for( ;; )
-    {
-        std::size_t n = std::fread( buffer, 1, N, f );
-
-        if( std::ferror( f ) )
-        {
-            std::fprintf( stderr, "'%s': read error: %s\n", fn, std::strerror( errno ) );
-            return;
-        }
-
-        if( n == 0 ) break;
-
-        hash.update( buffer, n );
-    }
-
-    std::string digest = to_string( hash.result() );
-
-    std::printf( "%s *%s\n", digest.c_str(), fn );
-}
-
-template<class Hash> void hash2sum( char const* fn )
-{
-    std::FILE* f = std::fopen( fn, "rb" );
-
-    if( f == 0 )
-    {
-        std::fprintf( stderr, "'%s': open error: %s\n", fn, std::strerror( errno ) );
-    }
-    else
-    {
-        hash2sum<Hash>( f, fn );
-        std::fclose( f );
-    }
-}
+#include <cstdlib>
+#include <cstring>
 
 using namespace boost::mp11;
 using namespace boost::hash2;
@@ -89,16 +61,457 @@ constexpr char const* names[] = {
 
 };
 
+// With --all, the digests of all the algorithms are computed in a single
+// pass over each file
+
+using all_hashes = mp_rename<hashes, multi_hash>;
+
+template<class R> std::string format( R const& r, char const* fn )
+{
+    return to_string( r ) + " *" + fn;
+}
+
+template<class... R> std::string format( std::tuple<R...> const& r, char const* fn )
+{
+    std::string s;
+
+    mp_for_each< mp_iota_c<sizeof...(R)> >([&](auto I){
+
+        if( I > 0 ) s += '\n';
+
+        s += names[ I ];
+        s += ' ';
+        s += format( std::get<I>( r ), fn );
+
+    });
+
+    return s;
+}
+
+// With --cache, the digests of the files that haven't changed since the
+// last run are taken from the cache file; it holds a digest per algorithm,
+// so it isn't used with --all
+
+template<class Hash> struct cached_hash_file
+{
+    static typename Hash::result_type call( char const* fn, std::error_code& ec, file_backend backend, digest_cache* cache )
+    {
+        if( cache )
+        {
+            return cache->hash_file<Hash>( fn, ec, backend );
+        }
+        else
+        {
+            return hash_file<Hash>( fn, ec, backend );
+        }
+    }
+};
+
+template<class... H> struct cached_hash_file< multi_hash<H...> >
+{
+    static typename multi_hash<H...>::result_type call( char const* fn, std::error_code& ec, file_backend backend, digest_cache* /*cache*/ )
+    {
+        return hash_file< multi_hash<H...> >( fn, ec, backend );
+    }
+};
+
+// Returns the output line, or the error message
+
+template<class Hash> std::string hash2sum( char const* fn, file_backend backend, digest_cache* cache, bool& ok )
+{
+    std::error_code ec;
+
+    // by default, hash_file maps large files, and reads small ones; with
+    // --backend af_alg, the kernel computes the digests it supports
+
+    typename Hash::result_type r = cached_hash_file<Hash>::call( fn, ec, backend, cache );
+
+    if( ec )
+    {
+        ok = false;
+        return std::string( "'" ) + fn + "': " + ec.message();
+    }
+
+    ok = true;
+    return format( r, fn );
+}
+
+// Calls f( i, ok ) for i in [0, n) on ex, and prints the nonempty lines
+// it returns in the order of i, to stdout when ok is set and to stderr
+// otherwise
+
+template<class F> void run_parallel( std::size_t n, task_executor& ex, F f )
+{
+    std::vector<std::string> lines( n );
+    std::unique_ptr<bool[]> ok( new bool[ n ]() );
+    std::unique_ptr<bool[]> done( new bool[ n ]() );
+
+    std::atomic<std::size_t> next( 0 );
+
+    std::mutex mx;
+    std::size_t printed = 0;
+
+    auto work = [&]{
+
+        for( ;; )
+        {
+            std::size_t i = next++;
+            if( i >= n ) break;
+
+            bool r = false;
+            std::string line = f( i, r );
+
+            std::lock_guard<std::mutex> lock( mx );
+
+            lines[ i ] = std::move( line );
+            ok[ i ] = r;
+            done[ i ] = true;
+
+            // print the results that are now complete, in order
+
+            for( ; printed < n && done[ printed ]; ++printed )
+            {
+                if( !lines[ printed ].empty() )
+                {
+                    std::fprintf( ok[ printed ]? stdout: stderr, "%s\n", lines[ printed ].c_str() );
+                    lines[ printed ].clear();
+                }
+            }
+        }
+    };
+
+    bulk_execute( ex, std::min<std::size_t>( n, ex.concurrency() ), [&]( std::size_t ){ work(); } );
+}
+
+// Hashes the files on ex, and prints the results in the order of the files
+
+template<class Hash> void hash2sum( std::vector<char const*> const& files, task_executor& ex, file_backend backend, digest_cache* cache )
+{
+    run_parallel( files.size(), ex, [&]( std::size_t i, bool& ok ){
+
+        return hash2sum<Hash>( files[ i ], backend, cache, ok );
+
+    });
+}
+
+// Prints one digest for each directory tree, whose files are hashed
+// on ex. Returns the exit code
+
+template<class Hash> int hash2sum_recursive( std::vector<char const*> const& dirs, task_executor& ex, digest_cache* cache )
+{
+    int r = 0;
+
+    for( char const* dir: dirs )
+    {
+        std::error_code ec;
+        typename Hash::result_type d = cache? hash_directory<Hash>( dir, ec, ex, *cache ): hash_directory<Hash>( dir, ec, ex );
+
+        if( ec )
+        {
+            std::fprintf( stderr, "'%s': %s\n", dir, ec.message().c_str() );
+            r = 1;
+        }
+        else
+        {
+            std::printf( "%s\n", format( d, dir ).c_str() );
+        }
+    }
+
+    return r;
+}
+
+// Reads the whole file into s
+
+bool read_file( char const* fn, std::string& s )
+{
+    std::FILE* f = std::fopen( fn, "rb" );
+
+    if( f == 0 )
+    {
+        return false;
+    }
+
+    char buffer[ 65536 ];
+
+    for( ;; )
+    {
+        std::size_t n = std::fread( buffer, 1, sizeof( buffer ), f );
+        s.append( buffer, n );
+
+        if( n < sizeof( buffer ) ) break;
+    }
+
+    bool r = !std::ferror( f );
+
+    std::fclose( f );
+    return r;
+}
+
+// Verifies the files listed in the manifests, in the `digest *filename`
+// format that hash2sum prints (or `digest  filename`), on ex;
+// prints the failures, and a summary line. Returns the exit code
+
+template<class Hash> int hash2sum_check( std::vector<char const*> const& manifests, task_executor& ex, file_backend backend, digest_cache* cache )
+{
+    using R = typename Hash::result_type;
+
+    struct entry
+    {
+        R digest;
+        std::string fn;
+    };
+
+    std::vector<entry> entries;
+    std::size_t malformed = 0;
+    std::size_t unreadable = 0;
+
+    for( char const* mf: manifests )
+    {
+        std::string s;
+
+        if( !read_file( mf, s ) )
+        {
+            std::fprintf( stderr, "'%s': %s\n", mf, std::strerror( errno ) );
+            ++unreadable;
+            continue;
+        }
+
+        char const* p = s.data();
+        char const* end = p + s.size();
+
+        while( p != end )
+        {
+            char const* first = p;
+            char const* last = static_cast<char const*>( std::memchr( p, '\n', end - p ) );
+
+            if( last == 0 )
+            {
+                p = last = end;
+            }
+            else
+            {
+                p = last + 1;
+            }
+
+            if( last != first && last[ -1 ] == '\r' ) --last;
+            if( first == last ) continue;
+
+            // the digest is parsed with the hex decoder of from_chars
+
+            R d;
+            char const* q = from_chars( first, last, d );
+
+            if( q == 0 || last - q < 3 || q[ 0 ] != ' ' || ( q[ 1 ] != '*' && q[ 1 ] != ' ' ) )
+            {
+                ++malformed;
+                continue;
+            }
+
+            entries.push_back( entry{ d, std::string( q + 2, last ) } );
+        }
+    }
+
+    std::size_t const n = entries.size();
+
+    // 0: OK, 1: FAILED, 2: couldn't be read
+
+    std::vector<unsigned char> status( n );
+
+    run_parallel( n, ex, [&]( std::size_t i, bool& ok ) -> std::string {
+
+        char const* fn = entries[ i ].fn.c_str();
+
+        std::error_code ec;
+        typename Hash::result_type r = cached_hash_file<Hash>::call( fn, ec, backend, cache );
+
+        if( ec )
+        {
+            status[ i ] = 2;
+
+            ok = false;
+            return std::string( "'" ) + fn + "': FAILED open or read: " + ec.message();
+        }
+
+        // mismatches are the normal output, and go to stdout
+
+        ok = true;
+
+        if( r != entries[ i ].digest )
+        {
+            status[ i ] = 1;
+            return std::string( fn ) + ": FAILED";
+        }
+
+        return std::string();
+    });
+
+    std::size_t ok = 0;
+    std::size_t failed = 0;
+    std::size_t first = n;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( status[ i ] == 0 ) ++ok;
+        if( status[ i ] == 1 ) ++failed;
+        if( status[ i ] == 2 ) ++unreadable;
+
+        if( status[ i ] != 0 && first == n ) first = i;
+    }
+
+    std::printf( "summary: files=%zu ok=%zu failed=%zu unreadable=%zu malformed=%zu", n, ok, failed, unreadable, malformed );
+
+    if( first < n )
+    {
+        std::printf( " first_failure=%s", entries[ first ].fn.c_str() );
+    }
+
+    std::printf( "\n" );
+
+    return ok == n && unreadable == 0 && malformed == 0? 0: 1;
+}
+
 int main( int argc, char const* argv[] )
 {
-    if( argc < 2 )
+    unsigned jobs = std::thread::hardware_concurrency();
+
+    file_backend backend = file_backend::automatic;
+
+    char const* cache_path = nullptr;
+
+    bool all = false;
+    bool check = false;
+    bool recursive = false;
+
+    int i = 1;
+
+    for( ; i < argc; i += 2 )
     {
-        std::fputs( "usage: hash2sum <hash> <files...>\n", stderr );
+        if( std::strcmp( argv[i], "--all" ) == 0 )
+        {
+            all = true;
+            --i;
+        }
+        else if( std::strcmp( argv[i], "-c" ) == 0 || std::strcmp( argv[i], "--check" ) == 0 )
+        {
+            check = true;
+            --i;
+        }
+        else if( std::strcmp( argv[i], "-r" ) == 0 || std::strcmp( argv[i], "--recursive" ) == 0 )
+        {
+            recursive = true;
+            --i;
+        }
+        else if( i + 1 == argc )
+        {
+            break;
+        }
+        else if( std::strcmp( argv[i], "-j" ) == 0 || std::strcmp( argv[i], "--jobs" ) == 0 )
+        {
+            jobs = static_cast<unsigned>( std::atoi( argv[i+1] ) );
+        }
+        else if( std::strcmp( argv[i], "--backend" ) == 0 )
+        {
+            std::string b( argv[i+1] );
+
+            if( b == "read" ) backend = file_backend::read;
+            else if( b == "mmap" ) backend = file_backend::mmap;
+            else if( b == "direct" ) backend = file_backend::direct;
+            else if( b == "uring" ) backend = file_backend::uring;
+            else if( b == "af_alg" ) backend = file_backend::af_alg;
+            else if( b != "auto" )
+            {
+                std::fprintf( stderr, "hash2sum: unknown backend '%s'; use auto, read, mmap, direct, uring, or af_alg\n", b.c_str() );
+                return 2;
+            }
+        }
+        else if( std::strcmp( argv[i], "--cache" ) == 0 )
+        {
+            cache_path = argv[i+1];
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if( jobs == 0 )
+    {
+        jobs = 1;
+    }
+
+    // a single pool, shared by all the hashing that follows
+
+    work_stealing_executor ex( jobs );
+
+    if( i >= argc )
+    {
+        std::fputs( "usage: hash2sum [--jobs N] [--backend auto|read|mmap|direct|uring|af_alg] [--cache FILE] <hash> <files...>\n"
+                    "       hash2sum [--jobs N] [--backend auto|read|mmap|direct|uring|af_alg] --all <files...>\n"
+                    "       hash2sum [--jobs N] [--backend auto|read|mmap|direct|uring|af_alg] [--cache FILE] <hash> -c <manifests...>\n"
+                    "       hash2sum [--jobs N] [--cache FILE] <hash> -r <directories...>\n", stderr );
+        return 2;
+    }
+
+    if( all )
+    {
+        if( check || recursive || cache_path )
+        {
+            std::fputs( "hash2sum: --all can't be used with -c, -r, or --cache\n", stderr );
+            return 2;
+        }
+
+        std::vector<char const*> files( argv + i, argv + argc );
+        hash2sum<all_hashes>( files, ex, backend, nullptr );
+
+        return 0;
+    }
+
+    std::string hash( argv[i++] );
+
+    // -c and -r may also follow the hash algorithm, as with sha256sum
+
+    if( i < argc && ( std::strcmp( argv[i], "-c" ) == 0 || std::strcmp( argv[i], "--check" ) == 0 ) )
+    {
+        check = true;
+        ++i;
+    }
+    else if( i < argc && ( std::strcmp( argv[i], "-r" ) == 0 || std::strcmp( argv[i], "--recursive" ) == 0 ) )
+    {
+        recursive = true;
+        ++i;
+    }
+
+    if( check && recursive )
+    {
+        std::fputs( "hash2sum: -c can't be used with -r\n", stderr );
         return 2;
     }
 
-    std::string hash( argv[1] );
+    std::vector<char const*> files( argv + i, argv + argc );
+
+    // the files whose size, mtime and ctime haven't changed since their
+    // digests were stored in the cache aren't read again
+
+    digest_cache cache_;
+    digest_cache* cache = nullptr;
+
+    if( cache_path )
+    {
+        std::error_code ec;
+        cache_.open( cache_path, ec );
+
+        if( ec )
+        {
+            std::fprintf( stderr, "hash2sum: '%s': %s; continuing without a cache\n", cache_path, ec.message().c_str() );
+        }
+        else
+        {
+            cache = &cache_;
+        }
+    }
+
     bool found = false;
+    int r = 0;
 
     mp_for_each< mp_iota<mp_size<hashes>> >([&](auto I){
 
@@ -106,9 +519,17 @@ int main( int argc, char const* argv[] )
         {
             using Hash = mp_at_c<hashes, I>;
 
-            for( int i = 2; i < argc; ++i )
+            if( check )
+            {
+                r = hash2sum_check<Hash>( files, ex, backend, cache );
+            }
+            else if( recursive )
             {
-                hash2sum<Hash>( argv[i] );
+                r = hash2sum_recursive<Hash>( files, ex, cache );
+            }
+            else
+            {
+                hash2sum<Hash>( files, ex, backend, cache );
             }
 
             found = true;
@@ -127,4 +548,6 @@ int main( int argc, char const* argv[] )
 
         return 1;
     }
+
+    return r;
 }
@@ -0,0 +1,339 @@
+#ifndef BOOST_HASH2_ACCELERATOR_HPP_INCLUDED
+#define BOOST_HASH2_ACCELERATOR_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// accelerator, the interface of a hardware engine that computes hashes
+// and HMACs of batches of messages asynchronously, and digest_batch,
+// which hashes a batch on one, with the small messages hashed by the
+// multi-buffer CPU code while the engine works on the large ones
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/detail/af_alg.hpp>
+#include <boost/hash2/detail/multi_buffer.hpp>
+#include <system_error>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// a message of a batch, and where its digest goes
+
+struct offload_message
+{
+    void const* data;
+    std::size_t size;
+
+    unsigned char* digest;
+};
+
+// a batch of messages, all hashed with the same algorithm and key
+
+struct offload_batch
+{
+    // the name of the hash algorithm in the Linux kernel crypto API,
+    // such as "sha256"
+    char const* algorithm;
+
+    // whether the digests are HMACs, with the key [key, key+key_size),
+    // of at most the block size of the algorithm
+    bool hmac;
+
+    unsigned char const* key;
+    std::size_t key_size;
+
+    std::size_t digest_size;
+
+    offload_message const* messages;
+    std::size_t size;
+};
+
+class accelerator
+{
+public:
+
+    virtual ~accelerator() {}
+
+    // messages shorter than this are faster to hash on the CPU than to
+    // hand over to the engine
+
+    virtual std::size_t offload_size() const noexcept = 0;
+
+    // starts computing the digests of the messages of b, which remains
+    // valid until poll returns true for it; returns false, without
+    // setting ec, when the engine doesn't implement the algorithm
+
+    virtual bool submit( offload_batch const& b, std::error_code& ec ) = 0;
+
+    // processes the completions of the engine; returns true once all
+    // digests of b have been written, or once it has failed, with ec set
+
+    virtual bool poll( offload_batch const& b, std::error_code& ec ) = 0;
+};
+
+namespace detail
+{
+
+// offload_traits<H>, the algorithm and the multi-buffer implementation
+// of H, for H a hash algorithm or hmac<H>
+
+template<class H> struct offload_traits
+{
+    using hash_type = H;
+    static constexpr bool keyed = false;
+
+    using multi = multi_lane<H>;
+
+    template<std::size_t N, class M = multi> static typename M::template type<N> make_multi( unsigned char const*, std::size_t )
+    {
+        return typename M::template type<N>();
+    }
+};
+
+template<class H> struct offload_traits< hmac<H> >
+{
+    using hash_type = H;
+    static constexpr bool keyed = true;
+
+    using multi = hmac_multi<H>;
+
+    template<std::size_t N, class M = multi> static typename M::template type<N> make_multi( unsigned char const* key, std::size_t n )
+    {
+        return typename M::template type<N>( hmac_key<H>( key, n ) );
+    }
+};
+
+// hashes the messages j of [p, p+n) on the CPU, those whose size isn't
+// at least m; runs of hash_batch_size of equal size by the multi-lane
+// code of H, when it has it
+
+template<class H, class R> void digest_batch_cpu( unsigned char const* key, std::size_t kn, void const* const* p, std::size_t const* s, std::size_t n, std::size_t m, R* r, std::false_type )
+{
+    for( std::size_t j = 0; j < n; ++j )
+    {
+        if( s[ j ] >= m ) continue;
+
+        H h( key, kn );
+        h.update( p[ j ], s[ j ] );
+
+        r[ j ] = h.result();
+    }
+}
+
+template<class H, class R> void digest_batch_cpu( unsigned char const* key, std::size_t kn, void const* const* p, std::size_t const* s, std::size_t n, std::size_t m, R* r, std::true_type )
+{
+    constexpr std::size_t N = hash_batch_size;
+
+    using traits = offload_traits<H>;
+    using multi_type = typename traits::multi::template type<N>;
+
+    multi_type const h0 = traits::template make_multi<N>( key, kn );
+
+    void const* q[ N ];
+    std::size_t k[ N ];
+
+    std::size_t i = 0;
+
+    for( std::size_t j = 0; j < n; ++j )
+    {
+        if( s[ j ] >= m ) continue;
+
+        if( i != 0 && s[ j ] != s[ k[ 0 ] ] )
+        {
+            // the run of equal sizes ends short of N
+
+            for( std::size_t t = 0; t < i; ++t )
+            {
+                H h( key, kn );
+                h.update( q[ t ], s[ k[ t ] ] );
+
+                r[ k[ t ] ] = h.result();
+            }
+
+            i = 0;
+        }
+
+        q[ i ] = p[ j ];
+        k[ i ] = j;
+
+        if( ++i == N )
+        {
+            multi_type h( h0 );
+            h.update( q, s[ j ] );
+
+            typename multi_type::result_type rm = h.result();
+
+            for( std::size_t t = 0; t < N; ++t )
+            {
+                r[ k[ t ] ] = rm[ t ];
+            }
+
+            i = 0;
+        }
+    }
+
+    for( std::size_t t = 0; t < i; ++t )
+    {
+        H h( key, kn );
+        h.update( q[ t ], s[ k[ t ] ] );
+
+        r[ k[ t ] ] = h.result();
+    }
+}
+
+template<class H, class R> void digest_batch_cpu( unsigned char const* key, std::size_t kn, void const* const* p, std::size_t const* s, std::size_t n, std::size_t m, R* r )
+{
+    detail::digest_batch_cpu<H>( key, kn, p, s, n, m, r, std::integral_constant<bool, offload_traits<H>::multi::value>() );
+}
+
+template<class H, class It, class OutIt> OutIt digest_batch_( accelerator* acc, unsigned char const* key, std::size_t kn, It first, It last, OutIt out )
+{
+    using traits = offload_traits<H>;
+    using hash_type = typename traits::hash_type;
+    using result_type = typename H::result_type;
+
+    std::vector<void const*> p;
+    std::vector<std::size_t> s;
+
+    for( ; first != last; ++first )
+    {
+        p.push_back( ( *first ).data() );
+        s.push_back( ( *first ).size() );
+    }
+
+    std::size_t const n = p.size();
+
+    std::vector<result_type> r( n );
+
+    // the messages of at least m bytes go to the engine
+
+    std::size_t m = static_cast<std::size_t>( -1 );
+
+    std::vector<offload_message> v;
+
+    // HMAC keys longer than the block size are hashed first, as RFC 2104
+    // specifies, so that the engine only sees short keys
+
+    unsigned char const* bkey = traits::keyed? key: 0;
+    std::size_t bkn = traits::keyed? kn: 0;
+
+    typename hash_type::result_type hkey = {};
+
+    if( bkn > static_cast<std::size_t>( hash_type::block_size ) )
+    {
+        hash_type h;
+        h.update( key, kn );
+
+        hkey = h.result();
+
+        bkey = hkey.data();
+        bkn = hkey.size();
+    }
+
+    offload_batch b = { detail::af_alg_traits<hash_type>::name(), traits::keyed, bkey, bkn, result_type().size(), 0, 0 };
+
+    bool offloaded = false;
+
+    if( acc != 0 && b.algorithm != 0 )
+    {
+        m = acc->offload_size();
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            if( s[ j ] >= m )
+            {
+                offload_message q = { p[ j ], s[ j ], r[ j ].data() };
+                v.push_back( q );
+            }
+        }
+
+        b.messages = v.data();
+        b.size = v.size();
+
+        std::error_code ec;
+
+        offloaded = b.size != 0 && acc->submit( b, ec ) && !ec;
+
+        if( !offloaded )
+        {
+            m = static_cast<std::size_t>( -1 );
+        }
+    }
+
+    // the CPU hashes the small messages while the engine works
+
+    detail::digest_batch_cpu<H>( key, kn, p.data(), s.data(), n, m, r.data() );
+
+    if( offloaded )
+    {
+        std::error_code ec;
+
+        while( !acc->poll( b, ec ) )
+        {
+        }
+
+        if( ec )
+        {
+            // the engine failed; its messages are hashed here
+
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                if( s[ j ] < m ) continue;
+
+                H h( key, kn );
+                h.update( p[ j ], s[ j ] );
+
+                r[ j ] = h.result();
+            }
+        }
+    }
+
+    for( std::size_t j = 0; j < n; ++j )
+    {
+        *out++ = r[ j ];
+    }
+
+    return out;
+}
+
+} // namespace detail
+
+// digest_batch, stores in successive positions of out the digests
+// H().update( x.data(), x.size() ).result() of the contiguous byte
+// ranges x in [first, last); those of at least acc.offload_size()
+// bytes are computed by acc, when it implements H
+
+template<class H, class It, class OutIt> OutIt digest_batch( accelerator& acc, It first, It last, OutIt out )
+{
+    return detail::digest_batch_<H>( &acc, 0, 0, first, last, out );
+}
+
+// digest_batch, for H an hmac<>; the digests are those of H( key, n )
+
+template<class H, class It, class OutIt> OutIt digest_batch( accelerator& acc, unsigned char const* key, std::size_t n, It first, It last, OutIt out )
+{
+    static_assert( detail::offload_traits<H>::keyed, "H must be an hmac<>" );
+    return detail::digest_batch_<H>( &acc, key, n, first, last, out );
+}
+
+// digest_batch, without an accelerator, by the multi-buffer CPU code
+
+template<class H, class It, class OutIt> OutIt digest_batch( It first, It last, OutIt out )
+{
+    return detail::digest_batch_<H>( 0, 0, 0, first, last, out );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_ACCELERATOR_HPP_INCLUDED
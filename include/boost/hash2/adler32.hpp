@@ -0,0 +1,212 @@
+#ifndef BOOST_HASH2_ADLER32_HPP_INCLUDED
+#define BOOST_HASH2_ADLER32_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Adler-32, https://datatracker.ietf.org/doc/html/rfc1950#section-8
+
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/adler32_x86.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+class adler32
+{
+private:
+
+    static constexpr std::uint32_t M = 65521;
+
+    // the largest n for which the sums can't overflow before the
+    // reduction, as in zlib
+
+    static constexpr std::size_t N = 5552;
+
+    std::uint32_t a_ = 1;
+    std::uint32_t b_ = 0;
+
+public:
+
+    typedef std::uint32_t result_type;
+
+    constexpr adler32() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit adler32( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR adler32( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( adler32, "adler32", n );
+
+        std::uint32_t a = a_;
+        std::uint32_t b = b_;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( n >= 64 && !detail::is_constant_evaluated() && detail::has_x86_ssse3() )
+        {
+            std::size_t const m = n & ~static_cast<std::size_t>( 31 );
+
+            detail::adler32_update_ssse3( a, b, p, m );
+
+            p += m;
+            n -= m;
+        }
+
+#endif
+
+        while( n != 0 )
+        {
+            std::size_t m = n < N? n: N;
+
+            n -= m;
+
+            for( ; m != 0; --m )
+            {
+                a += *p++;
+                b += a;
+            }
+
+            a %= M;
+            b %= M;
+        }
+
+        a_ = a;
+        b_ = b;
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // same as update( p, n ) with n zero bytes; a zero byte leaves a
+    // unchanged, and adds a to b
+
+    BOOST_CXX14_CONSTEXPR void update_zeros( std::uint64_t n )
+    {
+        b_ = static_cast<std::uint32_t>( ( b_ + n % M * a_ ) % M );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint32_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( adler32, "adler32" );
+
+        std::uint32_t r = ( b_ << 16 ) | a_;
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        a_ = ( a_ + 0xFF ) % M;
+        b_ = ( b_ + a_ ) % M;
+
+        return r;
+    }
+
+    // Given adler_a, the Adler-32 of a message A, and adler_b, the Adler-32
+    // of a message B of length len_b, returns the Adler-32 of the
+    // concatenation of A and B
+
+    static BOOST_CXX14_CONSTEXPR std::uint32_t combine( std::uint32_t adler_a, std::uint32_t adler_b, std::uint64_t len_b )
+    {
+        std::uint32_t const r = static_cast<std::uint32_t>( len_b % M );
+
+        std::uint32_t a = adler_a & 0xFFFF;
+        std::uint32_t b = static_cast<std::uint32_t>( static_cast<std::uint64_t>( r ) * a % M );
+
+        // B is summed starting from a = 1, b = 0, and A from a = 1,
+        // so the 1 is counted twice, and len_b times in b
+
+        a += ( adler_b & 0xFFFF ) + M - 1;
+        b += ( adler_a >> 16 ) + ( adler_b >> 16 ) + M - r;
+
+        if( a >= M ) a -= M;
+        if( a >= M ) a -= M;
+
+        if( b >= 2 * M ) b -= 2 * M;
+        if( b >= M ) b -= M;
+
+        return ( b << 16 ) | a;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u32( self.a_ );
+        ar.u32( self.b_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 9;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        adler32 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || tmp.a_ >= M || tmp.b_ >= M ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+constexpr std::uint32_t adler32::M;
+constexpr std::size_t adler32::N;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_ADLER32_HPP_INCLUDED
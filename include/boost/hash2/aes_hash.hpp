@@ -0,0 +1,379 @@
+#ifndef BOOST_HASH2_AES_HASH_HPP_INCLUDED
+#define BOOST_HASH2_AES_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// A fast keyed hash built from AES encryption rounds, in the style
+// of aHash and GxHash (but not compatible with either)
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/aes.hpp>
+#include <boost/hash2/detail/aes_hash_x86.hpp>
+#include <boost/hash2/detail/aes_hash_arm.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void>
+struct aes_hash_constants
+{
+    // the first 80 bytes of the fractional part of pi; the first 16 are
+    // xored into the key, the next 48 derive the other round keys from
+    // it, and the last 16 are xored into them to give the initial lanes
+
+    constexpr static unsigned char const pi[ 80 ] =
+    {
+        0x24, 0x3F, 0x6A, 0x88, 0x85, 0xA3, 0x08, 0xD3, 0x13, 0x19, 0x8A, 0x2E, 0x03, 0x70, 0x73, 0x44,
+        0xA4, 0x09, 0x38, 0x22, 0x29, 0x9F, 0x31, 0xD0, 0x08, 0x2E, 0xFA, 0x98, 0xEC, 0x4E, 0x6C, 0x89,
+        0x45, 0x28, 0x21, 0xE6, 0x38, 0xD0, 0x13, 0x77, 0xBE, 0x54, 0x66, 0xCF, 0x34, 0xE9, 0x0C, 0x6C,
+        0xC0, 0xAC, 0x29, 0xB7, 0xC9, 0x7C, 0x50, 0xDD, 0x3F, 0x84, 0xD5, 0xB5, 0xB5, 0x47, 0x09, 0x17,
+        0x92, 0x16, 0xD5, 0xD9, 0x89, 0x79, 0xFB, 0x1B, 0xD1, 0x31, 0x0B, 0xA6, 0x98, 0xDF, 0xB5, 0xAC,
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr unsigned char const aes_hash_constants<T>::pi[ 80 ];
+
+#endif
+
+} // namespace detail
+
+// The input is absorbed in 64 byte blocks into four independent 16 byte
+// lanes, with two AES rounds per 16 bytes, which runs at close to the AES
+// throughput of the processor. The final partial block is zero-padded,
+// and the lanes are folded together with the length, followed by two
+// more rounds.
+//
+// The four round keys are derived from the seed, so that, when it's
+// random and secret, the results can't be predicted by an attacker, and
+// aes_hash_128 can be used for hash tables keyed by untrusted input. It's
+// not a cryptographic hash function or a MAC.
+
+class aes_hash_128
+{
+private:
+
+    static constexpr std::size_t N = 64;
+
+    // the four round keys
+    unsigned char k_[ 64 ] = {};
+
+    // the four lanes
+    unsigned char a_[ 64 ] = {};
+
+    unsigned char buffer_[ N ] = {};
+
+    std::uint64_t n_ = 0;
+
+private:
+
+    // computes k_[ 16..63 ] and a_ from k_[ 0..15 ]
+
+    BOOST_CXX14_CONSTEXPR void init()
+    {
+        unsigned char const* pi = detail::aes_hash_constants<>::pi;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_aes() )
+        {
+            detail::aes_hash_init_x86( k_, a_, pi + 16 );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::aes_hash_init_arm( k_, a_, pi + 16 );
+            return;
+        }
+
+#endif
+
+        for( int i = 1; i < 4; ++i )
+        {
+            detail::memcpy( k_ + i * 16, k_ + i * 16 - 16, 16 );
+            detail::aes_encrypt_round( k_ + i * 16, pi + i * 16 );
+        }
+
+        for( int i = 0; i < 64; ++i )
+        {
+            a_[ i ] = static_cast<unsigned char>( k_[ i ] ^ pi[ 64 + i % 16 ] );
+        }
+    }
+
+    // absorbs n blocks of 64 bytes
+
+    BOOST_CXX14_CONSTEXPR void blocks( unsigned char const* p, std::size_t n )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_aes() )
+        {
+            detail::aes_hash_blocks_x86( k_, a_, p, n );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::aes_hash_blocks_arm( k_, a_, p, n );
+            return;
+        }
+
+#endif
+
+        for( ; n > 0; --n, p += 64 )
+        {
+            for( int i = 0; i < 64; ++i )
+            {
+                a_[ i ] ^= p[ i ];
+            }
+
+            for( int j = 0; j < 4; ++j )
+            {
+                detail::aes_encrypt_round( a_ + j * 16, k_ );
+                detail::aes_encrypt_round( a_ + j * 16, k_ + 16 );
+            }
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void fold( unsigned char const w[ 16 ], unsigned char r[ 16 ] ) const
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_aes() )
+        {
+            detail::aes_hash_final_x86( k_, a_, w, r );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::aes_hash_final_arm( k_, a_, w, r );
+            return;
+        }
+
+#endif
+
+        for( int i = 0; i < 16; ++i )
+        {
+            r[ i ] = static_cast<unsigned char>( a_[ i ] ^ w[ i ] );
+        }
+
+        detail::aes_encrypt_round( r, k_ + 32 );
+
+        for( int j = 1; j < 4; ++j )
+        {
+            for( int i = 0; i < 16; ++i )
+            {
+                r[ i ] ^= a_[ j * 16 + i ];
+            }
+
+            detail::aes_encrypt_round( r, k_ + 32 + ( j & 1 ) * 16 );
+        }
+
+        detail::aes_encrypt_round( r, k_ );
+        detail::aes_encrypt_round( r, k_ + 16 );
+    }
+
+public:
+
+    typedef digest<16> result_type;
+
+    BOOST_CXX14_CONSTEXPR aes_hash_128()
+    {
+        detail::memcpy( k_, detail::aes_hash_constants<>::pi, 16 );
+        init();
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit aes_hash_128( std::uint64_t seed )
+    {
+        detail::write64le( k_ + 0, seed );
+        detail::write64le( k_ + 8, seed );
+
+        for( int i = 0; i < 16; ++i )
+        {
+            k_[ i ] ^= detail::aes_hash_constants<>::pi[ i ];
+        }
+
+        init();
+    }
+
+    // A 16 byte seed is used as the key directly, as with siphash_64;
+    // other seeds are hashed
+
+    BOOST_CXX14_CONSTEXPR aes_hash_128( unsigned char const * p, std::size_t n )
+    {
+        detail::memcpy( k_, detail::aes_hash_constants<>::pi, 16 );
+
+        if( n == 16 )
+        {
+            for( int i = 0; i < 16; ++i )
+            {
+                k_[ i ] ^= p[ i ];
+            }
+
+            init();
+        }
+        else
+        {
+            init();
+
+            if( n != 0 )
+            {
+                BOOST_HASH2_STATS_SUSPEND();
+                update( p, n );
+                result();
+                BOOST_HASH2_STATS_RESUME();
+            }
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( aes_hash_128, "aes_hash_128", n );
+
+        if( n == 0 ) return;
+
+        std::size_t m = static_cast<std::size_t>( n_ % N );
+
+        n_ += n;
+
+        if( m > 0 )
+        {
+            std::size_t k = N - m;
+
+            if( n < k )
+            {
+                detail::memcpy( buffer_ + m, p, n );
+                return;
+            }
+
+            detail::memcpy( buffer_ + m, p, k );
+
+            p += k;
+            n -= k;
+
+            blocks( buffer_, 1 );
+        }
+
+        if( n >= N )
+        {
+            blocks( p, n / N );
+
+            p += n / N * N;
+            n %= N;
+        }
+
+        detail::memcpy( buffer_, p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( aes_hash_128, "aes_hash_128" );
+
+        std::size_t m = static_cast<std::size_t>( n_ % N );
+
+        if( m > 0 )
+        {
+            detail::memset( buffer_ + m, 0, N - m );
+            blocks( buffer_, 1 );
+        }
+
+        unsigned char w[ 16 ] = {};
+        detail::write64le( w, n_ );
+
+        result_type r;
+        fold( w, r.data() );
+
+        // clear buffered plaintext
+        detail::memset( buffer_, 0, N );
+
+        // rekey with the result, so that repeated calls return a
+        // pseudorandom sequence
+
+        for( int i = 0; i < 16; ++i )
+        {
+            k_[ i ] ^= r.data()[ i ];
+        }
+
+        init();
+
+        n_ = 0;
+
+        return r;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.bytes( self.k_ );
+        ar.bytes( self.a_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 201;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        aes_hash_128 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_AES_HASH_HPP_INCLUDED
@@ -0,0 +1,380 @@
+#ifndef BOOST_HASH2_ANY_HASH_HPP_INCLUDED
+#define BOOST_HASH2_ANY_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// any_hash, a hash algorithm chosen at run time, and
+// any_hash_registry, which creates one by name or multihash code
+
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the result of H, as bytes; integral results are stored little endian
+
+template<class R> typename std::enable_if<std::is_integral<R>::value, std::size_t>::type any_hash_result_size()
+{
+    return sizeof( R );
+}
+
+template<class R> typename std::enable_if<!std::is_integral<R>::value, std::size_t>::type any_hash_result_size()
+{
+    return R().size();
+}
+
+template<class R> typename std::enable_if<std::is_integral<R>::value>::type any_hash_write_result( unsigned char* p, R r )
+{
+    for( std::size_t i = 0; i < sizeof( R ); ++i )
+    {
+        p[ i ] = static_cast<unsigned char>( static_cast<std::uint64_t>( r ) >> ( i * 8 ) );
+    }
+}
+
+template<class R> typename std::enable_if<!std::is_integral<R>::value>::type any_hash_write_result( unsigned char* p, R const& r )
+{
+    std::memcpy( p, r.data(), r.size() );
+}
+
+// The buffer is kept next to the wrapped hash algorithm, so that update
+// calls are only dispatched once it's full, and an any_hash is one pointer
+
+struct any_hash_base
+{
+    static constexpr std::size_t buffer_size = 4096;
+
+    unsigned char buffer_[ buffer_size ];
+    std::size_t m_ = 0;
+
+    virtual ~any_hash_base() {}
+
+    virtual any_hash_base* clone() const = 0;
+
+    virtual void update( unsigned char const* p, std::size_t n ) = 0;
+
+    virtual std::size_t result_size() const = 0;
+    virtual void result( unsigned char* p ) = 0;
+
+    void flush()
+    {
+        if( m_ > 0 )
+        {
+            update( buffer_, m_ );
+            m_ = 0;
+        }
+    }
+};
+
+template<class H> struct any_hash_impl: any_hash_base
+{
+    H h_;
+
+    explicit any_hash_impl( H const& h ): h_( h )
+    {
+    }
+
+    any_hash_base* clone() const override
+    {
+        return new any_hash_impl( *this );
+    }
+
+    void update( unsigned char const* p, std::size_t n ) override
+    {
+        h_.update( p, n );
+    }
+
+    std::size_t result_size() const override
+    {
+        return detail::any_hash_result_size<typename H::result_type>();
+    }
+
+    void result( unsigned char* p ) override
+    {
+        detail::any_hash_write_result( p, h_.result() );
+    }
+};
+
+} // namespace detail
+
+class any_hash_registry;
+
+class any_hash
+{
+private:
+
+    friend class any_hash_registry;
+
+    std::unique_ptr<detail::any_hash_base> p_;
+
+    static constexpr std::size_t N = detail::any_hash_base::buffer_size;
+
+public:
+
+    using result_type = std::vector<unsigned char>;
+
+    // an empty any_hash, on which only operator bool and assignment are valid
+
+    any_hash() = default;
+
+    template<class H, class En = typename std::enable_if<!std::is_same<typename std::decay<H>::type, any_hash>::value>::type>
+    explicit any_hash( H const& h ): p_( new detail::any_hash_impl<H>( h ) )
+    {
+    }
+
+    any_hash( any_hash const& r ): p_( r.p_? r.p_->clone(): nullptr )
+    {
+    }
+
+    any_hash( any_hash&& r ) = default;
+
+    any_hash& operator=( any_hash const& r )
+    {
+        any_hash( r ).swap( *this );
+        return *this;
+    }
+
+    any_hash& operator=( any_hash&& r ) = default;
+
+    void swap( any_hash& r ) noexcept
+    {
+        p_.swap( r.p_ );
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return p_ != nullptr;
+    }
+
+    void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_ASSERT( p_ );
+
+        detail::any_hash_base& b = *p_;
+
+        if( n <= N - b.m_ )
+        {
+            if( n > 0 )
+            {
+                std::memcpy( b.buffer_ + b.m_, p, n );
+                b.m_ += n;
+            }
+
+            return;
+        }
+
+        b.flush();
+
+        if( n >= N )
+        {
+            // large writes bypass the buffer
+            b.update( p, n );
+        }
+        else
+        {
+            std::memcpy( b.buffer_, p, n );
+            b.m_ = n;
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // the size of the values returned by result()
+
+    std::size_t result_size() const
+    {
+        BOOST_ASSERT( p_ );
+        return p_->result_size();
+    }
+
+    result_type result()
+    {
+        BOOST_ASSERT( p_ );
+
+        p_->flush();
+
+        result_type r( p_->result_size() );
+        p_->result( r.data() );
+
+        return r;
+    }
+};
+
+inline void swap( any_hash& a, any_hash& b ) noexcept
+{
+    a.swap( b );
+}
+
+// Maps algorithm names and multihash codes, https://github.com/multiformats/multicodec,
+// to hash algorithms. A default-constructed registry is empty; builtin() has the
+// cryptographic hash algorithms of the library.
+
+class any_hash_registry
+{
+private:
+
+    struct entry
+    {
+        std::string name;
+        std::uint64_t code;
+        detail::any_hash_base* (*make)( unsigned char const* p, std::size_t n );
+    };
+
+    std::vector<entry> entries_;
+
+    template<class H> static detail::any_hash_base* make_( unsigned char const* p, std::size_t n )
+    {
+        return new detail::any_hash_impl<H>( H( p, n ) );
+    }
+
+    entry const* find( std::string const& name ) const noexcept
+    {
+        for( entry const& e: entries_ )
+        {
+            if( e.name == name ) return &e;
+        }
+
+        return nullptr;
+    }
+
+    entry const* find( std::uint64_t code ) const noexcept
+    {
+        if( code == no_code ) return nullptr;
+
+        for( entry const& e: entries_ )
+        {
+            if( e.code == code ) return &e;
+        }
+
+        return nullptr;
+    }
+
+    static any_hash make_any( entry const* e, unsigned char const* p, std::size_t n )
+    {
+        any_hash r;
+
+        if( e )
+        {
+            r.p_.reset( e->make( p, n ) );
+        }
+
+        return r;
+    }
+
+public:
+
+    // for algorithms without a multihash code
+
+    static constexpr std::uint64_t no_code = ~static_cast<std::uint64_t>( 0 );
+
+    // registers H under name and code; returns false, and does nothing,
+    // when one of them is already taken
+
+    template<class H> bool add( std::string const& name, std::uint64_t code = no_code )
+    {
+        if( find( name ) || find( code ) ) return false;
+
+        entries_.push_back( entry{ name, code, &make_<H> } );
+        return true;
+    }
+
+    // an any_hash holding H( p, n ), or an empty one when name
+    // or code isn't registered
+
+    any_hash make( std::string const& name, unsigned char const* p = nullptr, std::size_t n = 0 ) const
+    {
+        return make_any( find( name ), p, n );
+    }
+
+    any_hash make( std::uint64_t code, unsigned char const* p = nullptr, std::size_t n = 0 ) const
+    {
+        return make_any( find( code ), p, n );
+    }
+
+    bool contains( std::string const& name ) const noexcept
+    {
+        return find( name ) != nullptr;
+    }
+
+    bool contains( std::uint64_t code ) const noexcept
+    {
+        return find( code ) != nullptr;
+    }
+
+    // the registered names, in the order in which they were added
+
+    std::vector<std::string> names() const
+    {
+        std::vector<std::string> r;
+
+        for( entry const& e: entries_ )
+        {
+            r.push_back( e.name );
+        }
+
+        return r;
+    }
+
+    static any_hash_registry const& builtin()
+    {
+        static any_hash_registry const r = make_builtin();
+        return r;
+    }
+
+private:
+
+    static any_hash_registry make_builtin()
+    {
+        any_hash_registry r;
+
+        r.add<md5_128>( "md5_128", 0xD5 );
+        r.add<sha1_160>( "sha1_160", 0x11 );
+        r.add<sha2_256>( "sha2_256", 0x12 );
+        r.add<sha2_224>( "sha2_224", 0x1013 );
+        r.add<sha2_512>( "sha2_512", 0x13 );
+        r.add<sha2_384>( "sha2_384", 0x20 );
+        r.add<sha2_512_256>( "sha2_512_256", 0x1015 );
+        r.add<sha2_512_224>( "sha2_512_224", 0x1014 );
+        r.add<sha3_256>( "sha3_256", 0x16 );
+        r.add<sha3_224>( "sha3_224", 0x17 );
+        r.add<sha3_512>( "sha3_512", 0x14 );
+        r.add<sha3_384>( "sha3_384", 0x15 );
+        r.add<ripemd_160>( "ripemd_160", 0x1053 );
+        r.add<ripemd_128>( "ripemd_128", 0x1052 );
+        r.add<blake2b_512>( "blake2b_512", 0xB240 );
+        r.add<blake2s_256>( "blake2s_256", 0xB260 );
+        r.add<blake3>( "blake3", 0x1E );
+
+        return r;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_ANY_HASH_HPP_INCLUDED
@@ -0,0 +1,209 @@
+#ifndef BOOST_HASH2_ASYNC_HASH_HPP_INCLUDED
+#define BOOST_HASH2_ASYNC_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// async_hash, an asynchronous operation for Boost.Asio that hashes the
+// data read from a stream
+//
+// This header requires Boost.Asio; the rest of the library doesn't
+
+#include <boost/asio/async_result.hpp>
+#include <boost/asio/buffer.hpp>
+#include <boost/asio/compose.hpp>
+#include <boost/asio/error.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/system/error_code.hpp>
+#include <boost/assert.hpp>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// with a hash executor, reads that return at least this many bytes are
+// hashed on it; shorter ones take less time to hash than to post
+
+std::size_t const async_hash_offload_size = 64 * 1024;
+
+template<class H, class Self> struct async_hash_update
+{
+    H* h;
+    unsigned char const* p;
+    std::size_t n;
+
+    Self self;
+
+    void operator()()
+    {
+        h->update( p, n );
+
+        // resume on the executor of the operation
+        asio::post( std::move( self ) );
+    }
+};
+
+template<class H, class AsyncReadStream, class Executor> class async_hash_op
+{
+private:
+
+    AsyncReadStream& s_;
+    H& h_;
+
+    unsigned char* p_;
+    std::size_t n_;
+
+    std::uint64_t remaining_;
+    std::uint64_t total_;
+
+    bool until_eof_;
+
+    Executor ex_;
+    std::size_t offload_size_;
+
+    // the result of the last read, while its bytes are being hashed on ex_
+    boost::system::error_code ec_;
+    bool started_;
+
+private:
+
+    template<class Self> void read( Self& self )
+    {
+        std::size_t n = n_;
+
+        if( remaining_ < n )
+        {
+            n = static_cast<std::size_t>( remaining_ );
+        }
+
+        // a read of zero bytes, once remaining_ is zero, completes at once
+        // without blocking, and so does the operation
+        s_.async_read_some( asio::mutable_buffer( p_, n ), std::move( self ) );
+    }
+
+    template<class Self> void next( Self& self )
+    {
+        boost::system::error_code ec = ec_;
+
+        if( ec == asio::error::eof && until_eof_ )
+        {
+            ec.clear();
+        }
+        else if( !ec && remaining_ != 0 )
+        {
+            read( self );
+            return;
+        }
+
+        self.complete( ec, total_ );
+    }
+
+public:
+
+    async_hash_op( AsyncReadStream& s, H& h, asio::mutable_buffer buffer, std::uint64_t size, Executor const& ex, std::size_t offload_size ):
+        s_( s ), h_( h ), p_( static_cast<unsigned char*>( buffer.data() ) ), n_( buffer.size() ),
+        remaining_( size ), total_( 0 ), until_eof_( size == static_cast<std::uint64_t>( -1 ) ), ex_( ex ), offload_size_( offload_size ), started_( false )
+    {
+    }
+
+    // starts the operation, or resumes it after the bytes of a read
+    // have been hashed on ex_
+
+    template<class Self> void operator()( Self& self )
+    {
+        if( !started_ )
+        {
+            started_ = true;
+            read( self );
+        }
+        else
+        {
+            next( self );
+        }
+    }
+
+    // a read has completed
+
+    template<class Self> void operator()( Self& self, boost::system::error_code ec, std::size_t n )
+    {
+        ec_ = ec;
+
+        remaining_ -= n;
+        total_ += n;
+
+        if( n >= offload_size_ )
+        {
+            // moving self moves *this, ex_ included
+            Executor ex( ex_ );
+
+            // the hash executor resumes *this through self
+            asio::post( ex, async_hash_update<H, Self>{ &h_, p_, n, std::move( self ) } );
+            return;
+        }
+
+        // hashed where the data was read, while it's still in the cache
+        h_.update( p_, n );
+
+        next( self );
+    }
+};
+
+} // namespace detail
+
+// reads size bytes from s, or up to the end of the stream when size is
+// std::uint64_t(-1), into buffer, and passes each block to h.update as
+// its read completes, without copying it. The completion signature is
+// void( boost::system::error_code, std::uint64_t ), the second argument
+// being the number of bytes hashed. Reaching the end of the stream
+// before size bytes completes with asio::error::eof
+//
+// buffer must not be empty; it and h must remain valid until the
+// operation completes
+
+template<class H, class AsyncReadStream, class CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(typename AsyncReadStream::executor_type)>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void( boost::system::error_code, std::uint64_t ))
+async_hash( AsyncReadStream& s, H& h, asio::mutable_buffer buffer, std::uint64_t size,
+    CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(typename AsyncReadStream::executor_type) )
+{
+    BOOST_ASSERT( buffer.size() != 0 );
+
+    typedef typename AsyncReadStream::executor_type executor_type;
+
+    return asio::async_compose<CompletionToken, void( boost::system::error_code, std::uint64_t )>(
+
+        detail::async_hash_op<H, AsyncReadStream, executor_type>( s, h, buffer, size, s.get_executor(), static_cast<std::size_t>( -1 ) ),
+        token, s
+    );
+}
+
+// as above, but reads that return at least 64 KiB are hashed on the
+// executor ex, such as a strand of a thread pool, so that hashing them
+// doesn't block the event loop of s. The next read is started after
+// the bytes of the previous one have been hashed
+
+template<class Executor, class H, class AsyncReadStream, class CompletionToken BOOST_ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(typename AsyncReadStream::executor_type)>
+BOOST_ASIO_INITFN_AUTO_RESULT_TYPE(CompletionToken, void( boost::system::error_code, std::uint64_t ))
+async_hash( Executor const& ex, AsyncReadStream& s, H& h, asio::mutable_buffer buffer, std::uint64_t size,
+    CompletionToken&& token BOOST_ASIO_DEFAULT_COMPLETION_TOKEN(typename AsyncReadStream::executor_type) )
+{
+    BOOST_ASSERT( buffer.size() != 0 );
+
+    return asio::async_compose<CompletionToken, void( boost::system::error_code, std::uint64_t )>(
+
+        detail::async_hash_op<H, AsyncReadStream, Executor>( s, h, buffer, size, ex, detail::async_hash_offload_size ),
+        token, s
+    );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_ASYNC_HASH_HPP_INCLUDED
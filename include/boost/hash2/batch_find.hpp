@@ -0,0 +1,157 @@
+#ifndef BOOST_HASH2_BATCH_FIND_HPP_INCLUDED
+#define BOOST_HASH2_BATCH_FIND_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// batch_find, looking up a range of keys in an unordered container
+
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// keys are looked up in groups of this size
+
+constexpr std::size_t batch_find_size = 8;
+
+// the node based containers have a bucket interface, through which the
+// first node of the bucket of a key can be reached without a lookup
+
+template<class Map, class En = void> struct has_bucket_interface: std::false_type
+{
+};
+
+template<class Map> struct has_bucket_interface<Map, decltype(
+    std::declval<Map const&>().bucket( std::declval<typename Map::key_type const&>() ),
+    std::declval<Map const&>().begin( std::size_t() ) != std::declval<Map const&>().end( std::size_t() ),
+    void() )>: std::true_type
+{
+};
+
+// the bucket indices of a group of keys are computed first, then the
+// buckets are loaded and their first nodes prefetched, and only then are
+// the keys looked up, so that the cache misses of the group overlap
+// instead of following one another
+
+template<class Map, class It, class OutIt> OutIt batch_find_( Map const& m, It first, It last, OutIt out, std::true_type )
+{
+    constexpr std::size_t N = batch_find_size;
+
+    std::size_t b[ N ];
+
+    while( first != last )
+    {
+        It it = first;
+        std::size_t n = 0;
+
+        for( ; n < N && it != last; ++n, ++it )
+        {
+            b[ n ] = m.bucket( *it );
+        }
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            auto p = m.begin( b[ j ] );
+
+            if( p != m.end( b[ j ] ) )
+            {
+                detail::prefetch( std::addressof( *p ) );
+            }
+        }
+
+        for( ; first != it; ++first )
+        {
+            *out++ = m.find( *first );
+        }
+    }
+
+    return out;
+}
+
+template<class Map, class It, class OutIt> OutIt batch_find_contiguous( Map const& m, It first, It last, OutIt out, std::false_type )
+{
+    for( ; first != last; ++first )
+    {
+        *out++ = m.find( *first );
+    }
+
+    return out;
+}
+
+// the contents of the key batch_find_size positions ahead are prefetched
+
+template<class Map, class It, class OutIt> OutIt batch_find_contiguous( Map const& m, It first, It last, OutIt out, std::true_type )
+{
+    It ahead = first;
+
+    for( std::size_t i = 0; i < batch_find_size && ahead != last; ++i, ++ahead )
+    {
+        detail::prefetch_range( *ahead );
+    }
+
+    for( ; first != last; ++first )
+    {
+        if( ahead != last )
+        {
+            detail::prefetch_range( *ahead );
+            ++ahead;
+        }
+
+        *out++ = m.find( *first );
+    }
+
+    return out;
+}
+
+template<class Map, class It, class OutIt> OutIt batch_find_( Map const& m, It first, It last, OutIt out, std::false_type )
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    return detail::batch_find_contiguous( m, first, last, out, container_hash::is_contiguous_range<T>() );
+}
+
+} // namespace detail
+
+// batch_find, stores in successive positions of out the iterators that
+// m.find( *it ) returns, for each it in [first, last)
+//
+// containers with a bucket interface, such as std::unordered_map and
+// boost::unordered_map, have the buckets of a group of keys prefetched
+// ahead of the lookups; open addressing containers don't expose their
+// bucket arrays, so for them only the contents of the keys are prefetched
+
+template<class Map, class It, class OutIt> OutIt batch_find( Map const& m, It first, It last, OutIt out )
+{
+    using T = typename std::iterator_traits<It>::value_type;
+
+    // bucket() is only called with the key type itself, so that no
+    // temporary keys are constructed
+
+    using use_buckets = std::integral_constant<bool, detail::has_bucket_interface<Map>::value && std::is_same<T, typename Map::key_type>::value>;
+
+    if( m.empty() )
+    {
+        return detail::batch_find_( m, first, last, out, std::false_type() );
+    }
+    else
+    {
+        return detail::batch_find_( m, first, last, out, use_buckets() );
+    }
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BATCH_FIND_HPP_INCLUDED
@@ -0,0 +1,684 @@
+#ifndef BOOST_HASH2_BINARY_FUSE_FILTER_HPP_INCLUDED
+#define BOOST_HASH2_BINARY_FUSE_FILTER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// binary_fuse_filter, an approximate membership filter over a static set
+// of keys (Graf and Lemire 2022), and binary_fuse_filter_view, which
+// queries one in place from its serialized form
+
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// The keys are split by hash into shards of about fuse_shard_size keys,
+// and each shard is a 3-wise binary fuse filter with 8 bit fingerprints,
+// built independently. A shard of m keys has segment_count + 2 segments
+// of 2^k fingerprints each; a key maps to one fingerprint in each of
+// three consecutive segments, and is in the filter when the xor of the
+// three is its own fingerprint.
+//
+// The serialized form, all integers little-endian:
+//
+//   8 bytes     "hash2fus"
+//   8 bytes     n, the number of distinct keys
+//   8 bytes     the seed of the hash algorithm
+//   8 bytes     S, the number of shards
+//   16 * S      for each shard, the offset of its fingerprints, and its
+//               segment count shifted left by 16, plus the number of the
+//               attempt that succeeded shifted left by 8, plus k
+//   F           the fingerprints, padded with zeros to a multiple of 8
+
+constexpr std::size_t fuse_shard_size = std::size_t( 1 ) << 20;
+constexpr std::size_t fuse_header_size = 32;
+constexpr std::size_t fuse_record_size = 16;
+constexpr unsigned fuse_max_segment_bits = 18;
+
+// queries are hashed and prefetched in groups of this size
+
+constexpr std::size_t fuse_batch_size = 16;
+
+inline std::size_t fuse_shard_count( std::uint64_t n ) noexcept
+{
+    return n == 0? 1: static_cast<std::size_t>( ( n + fuse_shard_size - 1 ) / fuse_shard_size );
+}
+
+// the hash value of a key within its shard; each attempt to build
+// the shard uses a different bijection of the key hash value
+
+inline std::uint64_t fuse_mix( std::uint64_t h, unsigned attempt ) noexcept
+{
+    h += attempt * 0x9E3779B97F4A7C15ull;
+
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+
+    return h;
+}
+
+inline unsigned char fuse_fingerprint( std::uint64_t x ) noexcept
+{
+    return static_cast<unsigned char>( x ^ x >> 32 );
+}
+
+// the segment count and size of a shard of m keys, as in the reference
+// implementation
+
+struct fuse_shape
+{
+    std::size_t segment_count;
+    unsigned segment_bits;
+
+    std::size_t size() const noexcept
+    {
+        return segment_count == 0? 0: ( segment_count + 2 ) << segment_bits;
+    }
+};
+
+inline fuse_shape fuse_shape_for( std::size_t m ) noexcept
+{
+    if( m == 0 ) return { 0, 0 };
+
+    int k = static_cast<int>( std::floor( std::log( static_cast<double>( m ) ) / std::log( 3.33 ) + 2.25 ) );
+
+    if( k > static_cast<int>( fuse_max_segment_bits ) ) k = fuse_max_segment_bits;
+
+    std::size_t const length = std::size_t( 1 ) << k;
+
+    std::size_t capacity = 0;
+
+    if( m > 1 )
+    {
+        double const factor = (std::max)( 1.125, 0.875 + 0.25 * std::log( 1000000.0 ) / std::log( static_cast<double>( m ) ) );
+        capacity = static_cast<std::size_t>( std::floor( m * factor + 0.5 ) );
+    }
+
+    std::size_t segments = ( capacity + length - 1 ) / length;
+
+    segments = segments <= 2? 1: segments - 2;
+
+    return { segments, static_cast<unsigned>( k ) };
+}
+
+// the three positions of the key with shard hash value x
+
+BOOST_FORCEINLINE void fuse_positions( std::uint64_t x, std::size_t segment_count, unsigned segment_bits, std::size_t* q ) noexcept
+{
+    std::uint64_t const length = std::uint64_t( 1 ) << segment_bits;
+    std::uint64_t const mask = length - 1;
+
+    std::uint64_t h0;
+    detail::mul128( x, static_cast<std::uint64_t>( segment_count ) << segment_bits, h0 );
+
+    std::uint64_t const h1 = ( h0 + length ) ^ ( ( x >> 18 ) & mask );
+    std::uint64_t const h2 = ( h0 + 2 * length ) ^ ( x & mask );
+
+    q[ 0 ] = static_cast<std::size_t>( h0 );
+    q[ 1 ] = static_cast<std::size_t>( h1 );
+    q[ 2 ] = static_cast<std::size_t>( h2 );
+}
+
+// a query, from the key hash value to the three fingerprints to xor
+
+struct fuse_probe
+{
+    unsigned char const* f; // the fingerprints of the shard; null for an empty one
+    std::size_t q[ 3 ];
+    unsigned char fp;
+};
+
+inline fuse_probe fuse_probe_for( unsigned char const* p, std::size_t shards, std::uint64_t h ) noexcept
+{
+    std::size_t const j = hash2::reduce( h, shards );
+
+    unsigned char const* r = p + fuse_header_size + j * fuse_record_size;
+
+    std::uint64_t const offset = detail::read64le( r );
+    std::uint64_t const shape = detail::read64le( r + 8 );
+
+    fuse_probe pr = { nullptr, { 0, 0, 0 }, 0 };
+
+    std::size_t const segment_count = static_cast<std::size_t>( shape >> 16 );
+
+    if( segment_count == 0 ) return pr;
+
+    std::uint64_t const x = detail::fuse_mix( h, ( shape >> 8 ) & 0xFF );
+
+    pr.f = p + fuse_header_size + shards * fuse_record_size + offset;
+    pr.fp = detail::fuse_fingerprint( x );
+
+    detail::fuse_positions( x, segment_count, shape & 0xFF, pr.q );
+
+    return pr;
+}
+
+BOOST_FORCEINLINE bool fuse_test( fuse_probe const& pr ) noexcept
+{
+    return pr.f != nullptr && ( pr.f[ pr.q[ 0 ] ] ^ pr.f[ pr.q[ 1 ] ] ^ pr.f[ pr.q[ 2 ] ] ) == pr.fp;
+}
+
+// the key hash value, as hash_batch computes it
+
+template<class H, class Flavor, class T> std::uint64_t fuse_hash( H const& h0, T const& v )
+{
+    H h( h0 );
+    hash2::hash_append( h, Flavor(), v );
+
+    return hash2::get_integral_result<std::uint64_t>( h.result() );
+}
+
+// the batch query; the keys are hashed with hash_batch, and the
+// fingerprints of a group are prefetched before any of them is read
+
+template<class H, class Flavor, class It> void fuse_test_batch( unsigned char const* p, std::size_t shards, std::uint64_t seed, It first, It last, bool* out )
+{
+    constexpr std::size_t N = fuse_batch_size;
+
+    typename H::result_type r[ N ];
+    fuse_probe pr[ N ];
+
+    while( first != last )
+    {
+        It it = first;
+        std::size_t n = 0;
+
+        for( ; n < N && it != last; ++n, ++it )
+        {
+        }
+
+        hash2::hash_batch<H, Flavor>( first, it, r, seed );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            pr[ i ] = detail::fuse_probe_for( p, shards, hash2::get_integral_result<std::uint64_t>( r[ i ] ) );
+
+            if( pr[ i ].f != nullptr )
+            {
+                detail::prefetch( pr[ i ].f + pr[ i ].q[ 0 ] );
+                detail::prefetch( pr[ i ].f + pr[ i ].q[ 1 ] );
+                detail::prefetch( pr[ i ].f + pr[ i ].q[ 2 ] );
+            }
+        }
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            *out++ = detail::fuse_test( pr[ i ] );
+        }
+
+        first = it;
+    }
+}
+
+// checks the serialized form of size n at p, and returns the number of
+// shards, or 0 if it's invalid
+
+inline std::size_t fuse_validate( unsigned char const* p, std::size_t n ) noexcept
+{
+    if( n < fuse_header_size || std::memcmp( p, "hash2fus", 8 ) != 0 ) return 0;
+
+    std::uint64_t const shards = detail::read64le( p + 24 );
+
+    if( shards == 0 || shards > ( n - fuse_header_size ) / fuse_record_size ) return 0;
+
+    unsigned char const* r = p + fuse_header_size;
+
+    std::uint64_t offset = 0;
+
+    for( std::uint64_t j = 0; j < shards; ++j, r += fuse_record_size )
+    {
+        std::uint64_t const shape = detail::read64le( r + 8 );
+
+        if( detail::read64le( r ) != offset ) return 0;
+
+        std::uint64_t const segment_count = shape >> 16;
+        unsigned const k = shape & 0xFF;
+
+        if( k > fuse_max_segment_bits || segment_count > ( n >> k ) ) return 0;
+
+        if( segment_count != 0 )
+        {
+            offset += ( segment_count + 2 ) << k;
+        }
+
+        if( offset > n ) return 0;
+    }
+
+    std::size_t const header = fuse_header_size + static_cast<std::size_t>( shards ) * fuse_record_size;
+
+    if( n - header != ( offset + 7 ) / 8 * 8 ) return 0;
+
+    return static_cast<std::size_t>( shards );
+}
+
+// builds one shard from the hash values of its keys, by peeling: a
+// position that only one key maps to can be assigned last, so the keys
+// are removed from such positions until none are left, and then the
+// fingerprints are assigned in the reverse order
+
+class fuse_shard_builder
+{
+private:
+
+    std::vector<unsigned char> count_; // the key count times 4, plus the xor of the key indices (0, 1, 2) in the key positions
+    std::vector<std::uint64_t> xor_; // the xor of the keys
+    std::vector<std::size_t> queue_;
+    std::vector<std::uint64_t> order_;
+    std::vector<unsigned char> index_;
+
+    bool peel( std::uint64_t const* h, std::size_t m, fuse_shape s, unsigned attempt )
+    {
+        std::size_t const size = s.size();
+
+        count_.assign( size, 0 );
+        xor_.assign( size, 0 );
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            std::uint64_t const x = detail::fuse_mix( h[ i ], attempt );
+
+            std::size_t q[ 3 ];
+            detail::fuse_positions( x, s.segment_count, s.segment_bits, q );
+
+            for( unsigned k = 0; k < 3; ++k )
+            {
+                // more than 63 keys in one position
+
+                if( count_[ q[ k ] ] >= 252 ) return false;
+
+                count_[ q[ k ] ] = static_cast<unsigned char>( ( count_[ q[ k ] ] + 4 ) ^ k );
+                xor_[ q[ k ] ] ^= x;
+            }
+        }
+
+        queue_.clear();
+
+        for( std::size_t i = 0; i < size; ++i )
+        {
+            if( count_[ i ] >> 2 == 1 ) queue_.push_back( i );
+        }
+
+        order_.clear();
+        index_.clear();
+
+        while( !queue_.empty() )
+        {
+            std::size_t const i = queue_.back();
+            queue_.pop_back();
+
+            if( count_[ i ] >> 2 != 1 ) continue;
+
+            std::uint64_t const x = xor_[ i ];
+            unsigned const k0 = count_[ i ] & 3;
+
+            order_.push_back( x );
+            index_.push_back( static_cast<unsigned char>( k0 ) );
+
+            std::size_t q[ 3 ];
+            detail::fuse_positions( x, s.segment_count, s.segment_bits, q );
+
+            for( unsigned k = 0; k < 3; ++k )
+            {
+                std::size_t const j = q[ k ];
+
+                count_[ j ] = static_cast<unsigned char>( ( count_[ j ] - 4 ) ^ k );
+                xor_[ j ] ^= x;
+
+                if( k != k0 && count_[ j ] >> 2 == 1 ) queue_.push_back( j );
+            }
+        }
+
+        return order_.size() == m;
+    }
+
+public:
+
+    // the keys of a shard, h[0..m), are sorted and deduplicated in
+    // place when the first attempt fails; returns the number of distinct
+    // keys, and stores the attempt that succeeded
+
+    std::size_t build( std::uint64_t* h, std::size_t m, fuse_shape s, unsigned char* f, unsigned& attempt )
+    {
+        if( s.segment_count == 0 ) return 0;
+
+        for( attempt = 0;; ++attempt )
+        {
+            // the same key twice can never be peeled
+
+            if( attempt == 1 )
+            {
+                std::sort( h, h + m );
+                m = static_cast<std::size_t>( std::unique( h, h + m ) - h );
+            }
+
+            BOOST_ASSERT( attempt < 256 );
+
+            if( peel( h, m, s, attempt ) ) break;
+        }
+
+        for( std::size_t i = m; i > 0; --i )
+        {
+            std::uint64_t const x = order_[ i - 1 ];
+            unsigned const k = index_[ i - 1 ];
+
+            std::size_t q[ 3 ];
+            detail::fuse_positions( x, s.segment_count, s.segment_bits, q );
+
+            f[ q[ k ] ] = static_cast<unsigned char>( detail::fuse_fingerprint( x ) ^ f[ q[ ( k + 1 ) % 3 ] ] ^ f[ q[ ( k + 2 ) % 3 ] ] );
+        }
+
+        return m;
+    }
+};
+
+} // namespace detail
+
+// binary_fuse_filter<T, H, Flavor>, an approximate membership filter
+// over a static set of keys; may_contain returns true for all of them,
+// and for about 0.4% (1/256) of the other values, using about 9 bits
+// per key for large sets, with three memory accesses per query.
+//
+// The serialized form, data() and data_size(), can be stored, and then
+// mapped into memory and queried in place with binary_fuse_filter_view.
+
+template<class T, class H, class Flavor = default_flavor> class binary_fuse_filter
+{
+private:
+
+    std::vector<unsigned char> data_;
+
+    H h_;
+    std::size_t n_ = 0;
+    std::size_t shards_ = 1;
+
+private:
+
+    template<class It> static void hash_keys( It first, std::size_t n, std::uint64_t* out, task_executor& /*ex*/, std::false_type )
+    {
+        hash_range( first, n, out );
+    }
+
+    // random access keys are hashed in parallel
+
+    template<class It> static void hash_keys( It first, std::size_t n, std::uint64_t* out, task_executor& ex, std::true_type )
+    {
+        run_parallel( ex, n, [&]( std::size_t i, std::size_t j ){ hash_range( first + i, j - i, out + i ); } );
+    }
+
+    template<class It> static void hash_range( It first, std::size_t n, std::uint64_t* out )
+    {
+        constexpr std::size_t N = 256;
+
+        typename H::result_type r[ N ];
+
+        while( n > 0 )
+        {
+            std::size_t const m = n < N? n: N;
+
+            It last = std::next( first, m );
+            hash2::hash_batch<H, Flavor>( first, last, r, 0 );
+
+            for( std::size_t i = 0; i < m; ++i )
+            {
+                out[ i ] = hash2::get_integral_result<std::uint64_t>( r[ i ] );
+            }
+
+            first = last;
+
+            out += m;
+            n -= m;
+        }
+    }
+
+    // calls f( i, j ) for the consecutive subranges [i, j) of [0, n), one per task
+
+    template<class F> static void run_parallel( task_executor& ex, std::size_t n, F const& f )
+    {
+        std::size_t const parts = detail::parallel_parts( ex, n, 1 );
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){ f( n * t / parts, n * ( t + 1 ) / parts ); } );
+    }
+
+    template<class It> void init( It first, It last, task_executor& ex )
+    {
+        static_assert( std::is_same<typename std::remove_cv<typename std::iterator_traits<It>::value_type>::type, T>::value, "The keys must be of type T" );
+
+        std::size_t const n = static_cast<std::size_t>( std::distance( first, last ) );
+
+        std::vector<std::uint64_t> h( n );
+        hash_keys( first, n, h.data(), ex, std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>() );
+
+        // the keys, by shard
+
+        std::size_t const shards = detail::fuse_shard_count( n );
+
+        std::vector<std::size_t> start( shards + 1 );
+        std::vector<std::uint64_t> g( n );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            ++start[ hash2::reduce( h[ i ], shards ) + 1 ];
+        }
+
+        for( std::size_t j = 0; j < shards; ++j )
+        {
+            start[ j + 1 ] += start[ j ];
+        }
+
+        {
+            std::vector<std::size_t> next( start.begin(), start.end() - 1 );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                g[ next[ hash2::reduce( h[ i ], shards ) ]++ ] = h[ i ];
+            }
+        }
+
+        h.clear();
+        h.shrink_to_fit();
+
+        // the shape of a shard depends on the number of its keys before
+        // deduplication, so that its fingerprints can be placed up front
+
+        std::vector<detail::fuse_shape> shape( shards );
+        std::vector<std::size_t> offset( shards + 1 );
+
+        for( std::size_t j = 0; j < shards; ++j )
+        {
+            shape[ j ] = detail::fuse_shape_for( start[ j + 1 ] - start[ j ] );
+            offset[ j + 1 ] = offset[ j ] + shape[ j ].size();
+        }
+
+        std::size_t const header = detail::fuse_header_size + shards * detail::fuse_record_size;
+
+        data_.assign( header + ( offset[ shards ] + 7 ) / 8 * 8, 0 );
+
+        unsigned char* p = data_.data();
+
+        // the shards, in parallel
+
+        std::vector<std::size_t> distinct( shards );
+        std::vector<unsigned> attempt( shards );
+
+        run_parallel( ex, shards, [&]( std::size_t i, std::size_t j ){
+
+            detail::fuse_shard_builder fb;
+
+            for( ; i < j; ++i )
+            {
+                distinct[ i ] = fb.build( g.data() + start[ i ], start[ i + 1 ] - start[ i ], shape[ i ], p + header + offset[ i ], attempt[ i ] );
+            }
+        });
+
+        // serialize
+
+        std::size_t m = 0;
+
+        std::memcpy( p, "hash2fus", 8 );
+        detail::write64le( p + 16, 0 );
+        detail::write64le( p + 24, shards );
+
+        unsigned char* r = p + detail::fuse_header_size;
+
+        for( std::size_t j = 0; j < shards; ++j, r += detail::fuse_record_size )
+        {
+            detail::write64le( r, offset[ j ] );
+            detail::write64le( r + 8, static_cast<std::uint64_t>( shape[ j ].segment_count ) << 16 | attempt[ j ] << 8 | shape[ j ].segment_bits );
+
+            m += distinct[ j ];
+        }
+
+        detail::write64le( p + 8, m );
+
+        n_ = m;
+        shards_ = shards;
+    }
+
+public:
+
+    using value_type = T;
+    using hash_type = H;
+
+    // builds the filter for the keys in [first, last), on up to `threads`
+    // threads; threads == 0 means std::thread::hardware_concurrency()
+
+    template<class It> binary_fuse_filter( It first, It last, unsigned threads = 0 ): h_( 0 )
+    {
+        thread_executor ex( threads );
+        init( first, last, ex );
+    }
+
+    // same, but builds it on ex
+
+    template<class It> binary_fuse_filter( It first, It last, task_executor& ex ): h_( 0 )
+    {
+        init( first, last, ex );
+    }
+
+    // the number of distinct keys
+
+    std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+    bool may_contain( T const& v ) const
+    {
+        std::uint64_t h = detail::fuse_hash<H, Flavor>( h_, v );
+        return detail::fuse_test( detail::fuse_probe_for( data_.data(), shards_, h ) );
+    }
+
+    // stores may_contain( *it ) into successive positions of out, for each
+    // it in [first, last), with the cache misses of a group overlapped
+
+    template<class It> void may_contain( It first, It last, bool* out ) const
+    {
+        detail::fuse_test_batch<H, Flavor>( data_.data(), shards_, 0, first, last, out );
+    }
+
+    // the serialized form
+
+    unsigned char const* data() const noexcept
+    {
+        return data_.data();
+    }
+
+    std::size_t data_size() const noexcept
+    {
+        return data_.size();
+    }
+};
+
+// binary_fuse_filter_view<T, H, Flavor>, queries the serialized form of a
+// binary_fuse_filter in place, without copying it; the memory must
+// outlive the view
+
+template<class T, class H, class Flavor = default_flavor> class binary_fuse_filter_view
+{
+private:
+
+    unsigned char const* p_ = nullptr;
+
+    H h_;
+    std::uint64_t seed_ = 0;
+    std::size_t n_ = 0;
+    std::size_t shards_ = 0;
+
+public:
+
+    using value_type = T;
+    using hash_type = H;
+
+    binary_fuse_filter_view() = default;
+
+    // checks the serialized form [p, p+n), and on success, refers to it
+
+    bool load( unsigned char const* p, std::size_t n )
+    {
+        std::size_t shards = detail::fuse_validate( p, n );
+
+        if( shards == 0 ) return false;
+
+        p_ = p;
+        seed_ = detail::read64le( p + 16 );
+        h_ = H( seed_ );
+        n_ = static_cast<std::size_t>( detail::read64le( p + 8 ) );
+        shards_ = shards;
+
+        return true;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+    bool may_contain( T const& v ) const
+    {
+        BOOST_ASSERT( p_ != nullptr );
+
+        std::uint64_t h = detail::fuse_hash<H, Flavor>( h_, v );
+        return detail::fuse_test( detail::fuse_probe_for( p_, shards_, h ) );
+    }
+
+    template<class It> void may_contain( It first, It last, bool* out ) const
+    {
+        BOOST_ASSERT( p_ != nullptr );
+
+        detail::fuse_test_batch<H, Flavor>( p_, shards_, seed_, first, last, out );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BINARY_FUSE_FILTER_HPP_INCLUDED
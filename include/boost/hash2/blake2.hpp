@@ -0,0 +1,597 @@
+#ifndef BOOST_HASH2_BLAKE2_HPP_INCLUDED
+#define BOOST_HASH2_BLAKE2_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// BLAKE2b and BLAKE2s, https://www.blake2.net/blake2.pdf
+// https://datatracker.ietf.org/doc/html/rfc7693
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/blake2_x86.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void>
+struct blake2_constants
+{
+    constexpr static std::uint64_t const IV64[ 8 ] =
+    {
+        0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+        0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179,
+    };
+
+    constexpr static std::uint32_t const IV32[ 8 ] =
+    {
+        0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+    };
+
+    constexpr static unsigned char const S[ 10 ][ 16 ] =
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+        { 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 },
+        { 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 },
+        {  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 },
+        {  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 },
+        {  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 },
+        { 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 },
+        { 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 },
+        {  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 },
+        { 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 },
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr std::uint64_t blake2_constants<T>::IV64[ 8 ];
+
+template<class T>
+constexpr std::uint32_t blake2_constants<T>::IV32[ 8 ];
+
+template<class T>
+constexpr unsigned char blake2_constants<T>::S[ 10 ][ 16 ];
+
+#endif
+
+// Word: the state word type
+// Algo: supplies IV( i ), write( p, w ) and compress( state, block, t0, t1, f0 )
+// N: the block size; the key and the digest are at most N/2 bytes
+
+template<class Word, class Algo, int N>
+struct blake2_base
+{
+    Word state_[ 8 ] = {};
+    Word t_[ 2 ] = {};
+
+    // the final state for a keyed hash of the empty message
+    Word keyed_state_[ 8 ] = {};
+
+    unsigned char buffer_[ N ] = {};
+    std::size_t m_ = 0; // 0 <= m_ <= N
+
+    // The last block must be compressed with the finalization flag set,
+    // so a full buffer is only compressed once more input arrives;
+    // m_ == 0 therefore only when no input has been seen since init
+
+    BOOST_CXX14_CONSTEXPR void init( std::size_t key_len )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            state_[ i ] = Algo::IV( i );
+        }
+
+        // parameter block: digest length, key length, fanout 1, depth 1
+
+        state_[ 0 ] ^= static_cast<Word>( 0x01010000 | ( key_len << 8 ) | ( N / 2 ) );
+
+        t_[ 0 ] = t_[ 1 ] = 0;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            keyed_state_[ i ] = 0;
+        }
+
+        detail::memset( buffer_, 0, N );
+        m_ = 0;
+    }
+
+    BOOST_CXX14_CONSTEXPR void init_keyed( unsigned char const* key, std::size_t n )
+    {
+        BOOST_ASSERT( n <= N / 2 );
+
+        init( n );
+
+        if( n != 0 )
+        {
+            // The key, padded with zeroes, forms the first block. It's
+            // compressed immediately, so that it isn't retained; since
+            // it's the last block when no input follows, the digest of
+            // the empty message is computed here as well
+
+            unsigned char block[ N ] = {};
+            detail::memcpy( block, key, n );
+
+            for( int i = 0; i < 8; ++i )
+            {
+                keyed_state_[ i ] = state_[ i ];
+            }
+
+            increment( N );
+
+            Algo::compress( keyed_state_, block, t_[ 0 ], t_[ 1 ], static_cast<Word>( -1 ) );
+            Algo::compress( state_, block, t_[ 0 ], t_[ 1 ], 0 );
+
+            detail::memset( block, 0, N );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void increment( std::size_t n )
+    {
+        t_[ 0 ] += static_cast<Word>( n );
+        t_[ 1 ] += t_[ 0 ] < n;
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_ASSERT( m_ <= N );
+
+        if( n == 0 ) return;
+
+        {
+            std::size_t k = N - m_;
+
+            if( n <= k )
+            {
+                detail::memcpy( buffer_ + m_, p, n );
+                m_ += n;
+
+                return;
+            }
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+
+            increment( N );
+            Algo::compress( state_, buffer_, t_[ 0 ], t_[ 1 ], 0 );
+        }
+
+        BOOST_ASSERT( n > 0 );
+
+        while( n > N )
+        {
+            increment( N );
+            Algo::compress( state_, p, t_[ 0 ], t_[ 1 ], 0 );
+
+            p += N;
+            n -= N;
+        }
+
+        detail::memcpy( buffer_, p, n );
+        m_ = n;
+
+        BOOST_ASSERT( m_ <= N );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR void finalize( unsigned char* out )
+    {
+        if( m_ == 0 && t_[ 0 ] == N && t_[ 1 ] == 0 )
+        {
+            // keyed, and no input followed the key block
+
+            for( int i = 0; i < 8; ++i )
+            {
+                state_[ i ] = keyed_state_[ i ];
+            }
+        }
+        else
+        {
+            increment( m_ );
+
+            detail::memset( buffer_ + m_, 0, N - m_ );
+            Algo::compress( state_, buffer_, t_[ 0 ], t_[ 1 ], static_cast<Word>( -1 ) );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            Algo::write( out + i * sizeof( Word ), state_[ i ] );
+        }
+
+        // restart from the digest, so that repeated calls to result()
+        // return a pseudorandom sequence and no plaintext is retained
+
+        init( 0 );
+        update( out, N / 2 );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.words( self.t_ );
+        ar.words( self.keyed_state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 18 * sizeof( Word ) + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        blake2_base tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ <= N ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+struct blake2b_base: public blake2_base<std::uint64_t, blake2b_base, 128>
+{
+    BOOST_CXX14_CONSTEXPR static std::uint64_t IV( int i )
+    {
+        return blake2_constants<>::IV64[ i ];
+    }
+
+    BOOST_CXX14_CONSTEXPR static void write( unsigned char* p, std::uint64_t v )
+    {
+        detail::write64le( p, v );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void G( std::uint64_t v[ 16 ], int a, int b, int c, int d, std::uint64_t x, std::uint64_t y )
+    {
+        v[ a ] = v[ a ] + v[ b ] + x;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 32 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 24 );
+        v[ a ] = v[ a ] + v[ b ] + y;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 16 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 63 );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void compress( std::uint64_t state[ 8 ], unsigned char const block[ 128 ], std::uint64_t t0, std::uint64_t t1, std::uint64_t f0 )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            if( detail::has_x86_avx2() )
+            {
+                detail::blake2b_compress_avx2( state, block, t0, t1, f0 );
+                return;
+            }
+
+            if( detail::has_x86_sse41() )
+            {
+                detail::blake2b_compress_sse41( state, block, t0, t1, f0 );
+                return;
+            }
+        }
+
+#endif
+
+        std::uint64_t m[ 16 ] = {};
+
+        for( int i = 0; i < 16; ++i )
+        {
+            m[ i ] = detail::read64le( block + i * 8 );
+        }
+
+        std::uint64_t v[ 16 ] = {};
+
+        for( int i = 0; i < 8; ++i )
+        {
+            v[ i ] = state[ i ];
+            v[ i + 8 ] = IV( i );
+        }
+
+        v[ 12 ] ^= t0;
+        v[ 13 ] ^= t1;
+        v[ 14 ] ^= f0;
+
+        for( int r = 0; r < 12; ++r )
+        {
+            unsigned char const* s = blake2_constants<>::S[ r % 10 ];
+
+            G( v, 0, 4,  8, 12, m[ s[  0 ] ], m[ s[  1 ] ] );
+            G( v, 1, 5,  9, 13, m[ s[  2 ] ], m[ s[  3 ] ] );
+            G( v, 2, 6, 10, 14, m[ s[  4 ] ], m[ s[  5 ] ] );
+            G( v, 3, 7, 11, 15, m[ s[  6 ] ], m[ s[  7 ] ] );
+            G( v, 0, 5, 10, 15, m[ s[  8 ] ], m[ s[  9 ] ] );
+            G( v, 1, 6, 11, 12, m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            G( v, 2, 7,  8, 13, m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            G( v, 3, 4,  9, 14, m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            state[ i ] ^= v[ i ] ^ v[ i + 8 ];
+        }
+    }
+};
+
+struct blake2s_base: public blake2_base<std::uint32_t, blake2s_base, 64>
+{
+    BOOST_CXX14_CONSTEXPR static std::uint32_t IV( int i )
+    {
+        return blake2_constants<>::IV32[ i ];
+    }
+
+    BOOST_CXX14_CONSTEXPR static void write( unsigned char* p, std::uint32_t v )
+    {
+        detail::write32le( p, v );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void G( std::uint32_t v[ 16 ], int a, int b, int c, int d, std::uint32_t x, std::uint32_t y )
+    {
+        v[ a ] = v[ a ] + v[ b ] + x;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 16 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 12 );
+        v[ a ] = v[ a ] + v[ b ] + y;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 8 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 7 );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void compress( std::uint32_t state[ 8 ], unsigned char const block[ 64 ], std::uint32_t t0, std::uint32_t t1, std::uint32_t f0 )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_sse41() )
+        {
+            detail::blake2s_compress_sse41( state, block, t0, t1, f0 );
+            return;
+        }
+
+#endif
+
+        std::uint32_t m[ 16 ] = {};
+
+        for( int i = 0; i < 16; ++i )
+        {
+            m[ i ] = detail::read32le( block + i * 4 );
+        }
+
+        std::uint32_t v[ 16 ] = {};
+
+        for( int i = 0; i < 8; ++i )
+        {
+            v[ i ] = state[ i ];
+            v[ i + 8 ] = IV( i );
+        }
+
+        v[ 12 ] ^= t0;
+        v[ 13 ] ^= t1;
+        v[ 14 ] ^= f0;
+
+        for( int r = 0; r < 10; ++r )
+        {
+            unsigned char const* s = blake2_constants<>::S[ r ];
+
+            G( v, 0, 4,  8, 12, m[ s[  0 ] ], m[ s[  1 ] ] );
+            G( v, 1, 5,  9, 13, m[ s[  2 ] ], m[ s[  3 ] ] );
+            G( v, 2, 6, 10, 14, m[ s[  4 ] ], m[ s[  5 ] ] );
+            G( v, 3, 7, 11, 15, m[ s[  6 ] ], m[ s[  7 ] ] );
+            G( v, 0, 5, 10, 15, m[ s[  8 ] ], m[ s[  9 ] ] );
+            G( v, 1, 6, 11, 12, m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            G( v, 2, 7,  8, 13, m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            G( v, 3, 4,  9, 14, m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            state[ i ] ^= v[ i ] ^ v[ i + 8 ];
+        }
+    }
+};
+
+} // namespace detail
+
+class blake2b_512: detail::blake2b_base
+{
+public:
+
+    using result_type = digest<64>;
+
+    static constexpr int block_size = 128;
+
+    BOOST_CXX14_CONSTEXPR blake2b_512()
+    {
+        init( 0 );
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit blake2b_512( std::uint64_t seed )
+    {
+        init( 0 );
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            init_keyed( tmp, 8 );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR blake2b_512( unsigned char const * p, std::size_t n )
+    {
+        init( 0 );
+
+        if( n > 64 )
+        {
+            // keys longer than the maximum are hashed first
+
+            BOOST_HASH2_STATS_SUSPEND();
+
+            update( p, n );
+
+            result_type key = result();
+
+            BOOST_HASH2_STATS_RESUME();
+            init_keyed( key.data(), key.size() );
+        }
+        else if( n != 0 )
+        {
+            init_keyed( p, n );
+        }
+    }
+
+    using detail::blake2b_base::state_size;
+    using detail::blake2b_base::save_state;
+    using detail::blake2b_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( blake2b_512, "blake2b_512", n );
+        detail::blake2b_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( blake2b_512, "blake2b_512" );
+
+        result_type digest;
+        finalize( digest.data() );
+
+        return digest;
+    }
+};
+
+class blake2s_256: detail::blake2s_base
+{
+public:
+
+    using result_type = digest<32>;
+
+    static constexpr int block_size = 64;
+
+    BOOST_CXX14_CONSTEXPR blake2s_256()
+    {
+        init( 0 );
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit blake2s_256( std::uint64_t seed )
+    {
+        init( 0 );
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            init_keyed( tmp, 8 );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR blake2s_256( unsigned char const * p, std::size_t n )
+    {
+        init( 0 );
+
+        if( n > 32 )
+        {
+            // keys longer than the maximum are hashed first
+
+            BOOST_HASH2_STATS_SUSPEND();
+
+            update( p, n );
+
+            result_type key = result();
+
+            BOOST_HASH2_STATS_RESUME();
+            init_keyed( key.data(), key.size() );
+        }
+        else if( n != 0 )
+        {
+            init_keyed( p, n );
+        }
+    }
+
+    using detail::blake2s_base::state_size;
+    using detail::blake2s_base::save_state;
+    using detail::blake2s_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( blake2s_256, "blake2s_256", n );
+        detail::blake2s_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( blake2s_256, "blake2s_256" );
+
+        result_type digest;
+        finalize( digest.data() );
+
+        return digest;
+    }
+};
+
+using hmac_blake2b_512 = hmac<blake2b_512>;
+using hmac_blake2s_256 = hmac<blake2s_256>;
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BLAKE2_HPP_INCLUDED
@@ -0,0 +1,963 @@
+#ifndef BOOST_HASH2_BLAKE3_HPP_INCLUDED
+#define BOOST_HASH2_BLAKE3_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// BLAKE3, https://github.com/BLAKE3-team/BLAKE3-specs/blob/master/blake3.pdf
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/blake3_x86.hpp>
+#include <boost/hash2/detail/blake3_arm.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/numa.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void>
+struct blake3_constants
+{
+    constexpr static std::uint32_t const IV[ 8 ] =
+    {
+        0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19,
+    };
+
+    // the message word order for each round, the successive powers of the message permutation
+
+    constexpr static unsigned char const S[ 7 ][ 16 ] =
+    {
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 },
+        {  2,  6,  3, 10,  7,  0,  4, 13,  1, 11, 12,  5,  9, 14, 15,  8 },
+        {  3,  4, 10, 12, 13,  2,  7, 14,  6,  5,  9,  0, 11, 15,  8,  1 },
+        { 10,  7, 12,  9, 14,  3, 13, 15,  4,  0, 11,  2,  5,  8,  1,  6 },
+        { 12, 13,  9, 11, 15, 10, 14,  8,  7,  2,  5,  3,  0,  1,  6,  4 },
+        {  9, 14, 11,  5,  8, 12, 15,  1, 13,  3,  0, 10,  2,  6,  4,  7 },
+        { 11, 15,  5,  0,  1,  9,  8,  6, 14, 10,  2, 12,  3,  4,  7, 13 },
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr std::uint32_t blake3_constants<T>::IV[ 8 ];
+
+template<class T>
+constexpr unsigned char blake3_constants<T>::S[ 7 ][ 16 ];
+
+#endif
+
+struct blake3_core
+{
+    static constexpr std::size_t block_len = 64;
+    static constexpr std::size_t chunk_len = 1024;
+    static constexpr std::size_t out_len = 32;
+
+    static constexpr std::size_t max_simd_degree = 8;
+
+    // inputs at least this long are split into two tasks by update_parallel
+    static constexpr std::size_t parallel_min_len = 256 * 1024;
+
+    static constexpr std::uint32_t CHUNK_START = 1;
+    static constexpr std::uint32_t CHUNK_END = 2;
+    static constexpr std::uint32_t PARENT = 4;
+    static constexpr std::uint32_t ROOT = 8;
+
+    // compression function
+
+    BOOST_CXX14_CONSTEXPR static void g( std::uint32_t v[ 16 ], int a, int b, int c, int d, std::uint32_t x, std::uint32_t y )
+    {
+        v[ a ] = v[ a ] + v[ b ] + x;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 16 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 12 );
+        v[ a ] = v[ a ] + v[ b ] + y;
+        v[ d ] = detail::rotr( v[ d ] ^ v[ a ], 8 );
+        v[ c ] = v[ c ] + v[ d ];
+        v[ b ] = detail::rotr( v[ b ] ^ v[ c ], 7 );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void compress( std::uint32_t v[ 16 ], std::uint32_t const cv[ 8 ], unsigned char const* block, std::uint32_t n, std::uint64_t counter, std::uint32_t flags )
+    {
+        std::uint32_t m[ 16 ] = {};
+
+        for( int i = 0; i < 16; ++i )
+        {
+            m[ i ] = detail::read32le( block + i * 4 );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            v[ i ] = cv[ i ];
+        }
+
+        for( int i = 0; i < 4; ++i )
+        {
+            v[ i + 8 ] = blake3_constants<>::IV[ i ];
+        }
+
+        v[ 12 ] = static_cast<std::uint32_t>( counter );
+        v[ 13 ] = static_cast<std::uint32_t>( counter >> 32 );
+        v[ 14 ] = n;
+        v[ 15 ] = flags;
+
+        for( int r = 0; r < 7; ++r )
+        {
+            unsigned char const* s = blake3_constants<>::S[ r ];
+
+            g( v, 0, 4,  8, 12, m[ s[  0 ] ], m[ s[  1 ] ] );
+            g( v, 1, 5,  9, 13, m[ s[  2 ] ], m[ s[  3 ] ] );
+            g( v, 2, 6, 10, 14, m[ s[  4 ] ], m[ s[  5 ] ] );
+            g( v, 3, 7, 11, 15, m[ s[  6 ] ], m[ s[  7 ] ] );
+            g( v, 0, 5, 10, 15, m[ s[  8 ] ], m[ s[  9 ] ] );
+            g( v, 1, 6, 11, 12, m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            g( v, 2, 7,  8, 13, m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            g( v, 3, 4,  9, 14, m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR static void compress_in_place( std::uint32_t cv[ 8 ], unsigned char const* block, std::uint32_t n, std::uint64_t counter, std::uint32_t flags )
+    {
+        std::uint32_t v[ 16 ] = {};
+        compress( v, cv, block, n, counter, flags );
+
+        for( int i = 0; i < 8; ++i )
+        {
+            cv[ i ] = v[ i ] ^ v[ i + 8 ];
+        }
+    }
+
+    // compression of several inputs of the same length
+
+    static std::size_t simd_degree() noexcept
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( detail::has_x86_avx2() ) return 8;
+        if( detail::has_x86_sse41() ) return 4;
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+        return 4;
+
+#endif
+
+        return 1;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::size_t degree()
+    {
+        return detail::is_constant_evaluated()? 1: simd_degree();
+    }
+
+    BOOST_CXX14_CONSTEXPR static void hash_one( unsigned char const* p, std::size_t blocks, std::uint64_t counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char* out )
+    {
+        std::uint32_t cv[ 8 ] = {};
+
+        for( int i = 0; i < 8; ++i )
+        {
+            cv[ i ] = blake3_constants<>::IV[ i ];
+        }
+
+        std::uint32_t block_flags = flags | flags_start;
+
+        for( std::size_t k = 0; k < blocks; ++k, p += block_len )
+        {
+            if( k + 1 == blocks )
+            {
+                block_flags |= flags_end;
+            }
+
+            compress_in_place( cv, p, block_len, counter, block_flags );
+            block_flags = flags;
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32le( out + i * 4, cv[ i ] );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR static void hash_many( unsigned char const* const* inputs, std::size_t n, std::size_t blocks, std::uint64_t counter, bool increment_counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char* out )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            if( n >= 8 && detail::has_x86_avx2() )
+            {
+                do
+                {
+                    detail::blake3_hash_many_avx2( inputs, blocks, blake3_constants<>::IV, counter, increment_counter, flags, flags_start, flags_end, blake3_constants<>::S, out );
+
+                    inputs += 8;
+                    n -= 8;
+                    counter += increment_counter? 8: 0;
+                    out += 8 * out_len;
+                }
+                while( n >= 8 );
+            }
+
+            if( n >= 4 && detail::has_x86_sse41() )
+            {
+                do
+                {
+                    detail::blake3_hash_many_sse41( inputs, blocks, blake3_constants<>::IV, counter, increment_counter, flags, flags_start, flags_end, blake3_constants<>::S, out );
+
+                    inputs += 4;
+                    n -= 4;
+                    counter += increment_counter? 4: 0;
+                    out += 4 * out_len;
+                }
+                while( n >= 4 );
+            }
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            while( n >= 4 )
+            {
+                detail::blake3_hash_many_neon( inputs, blocks, blake3_constants<>::IV, counter, increment_counter, flags, flags_start, flags_end, blake3_constants<>::S, out );
+
+                inputs += 4;
+                n -= 4;
+                counter += increment_counter? 4: 0;
+                out += 4 * out_len;
+            }
+        }
+
+#endif
+
+        for( ; n > 0; --n )
+        {
+            hash_one( *inputs, blocks, counter, flags, flags_start, flags_end, out );
+
+            ++inputs;
+            counter += increment_counter? 1: 0;
+            out += out_len;
+        }
+    }
+
+    // the inputs of the final compression for a node
+
+    struct output
+    {
+        std::uint32_t cv[ 8 ];
+        unsigned char block[ block_len ];
+        std::uint64_t counter;
+        std::uint32_t n;
+        std::uint32_t flags;
+
+        BOOST_CXX14_CONSTEXPR void chaining_value( unsigned char out[ out_len ] ) const
+        {
+            std::uint32_t v[ 16 ] = {};
+            compress( v, cv, block, n, counter, flags );
+
+            for( int i = 0; i < 8; ++i )
+            {
+                detail::write32le( out + i * 4, v[ i ] ^ v[ i + 8 ] );
+            }
+        }
+    };
+
+    BOOST_CXX14_CONSTEXPR static output parent_output( unsigned char const block[ block_len ] )
+    {
+        output r = {};
+
+        for( int i = 0; i < 8; ++i )
+        {
+            r.cv[ i ] = blake3_constants<>::IV[ i ];
+        }
+
+        detail::memcpy( r.block, block, block_len );
+
+        r.counter = 0;
+        r.n = block_len;
+        r.flags = PARENT;
+
+        return r;
+    }
+
+    // the first n bytes of the extended output of the root node o; output
+    // block k is the compression of o with counter k, whose 16 words are
+    // v[i] ^ v[i+8] followed by v[i+8] ^ cv[i]
+
+    BOOST_CXX14_CONSTEXPR static void root_output_bytes( output const& o, unsigned char* out, std::size_t n )
+    {
+        std::uint64_t counter = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && n >= 8 * block_len && detail::has_x86_avx2() )
+        {
+            do
+            {
+                detail::blake3_xof_many_avx2( o.cv, o.block, o.n, counter, o.flags | ROOT, out );
+
+                counter += 8;
+                out += 8 * block_len;
+                n -= 8 * block_len;
+            }
+            while( n >= 8 * block_len );
+        }
+
+#endif
+
+        while( n > 0 )
+        {
+            std::uint32_t v[ 16 ] = {};
+            compress( v, o.cv, o.block, o.n, counter, o.flags | ROOT );
+
+            unsigned char w[ block_len ] = {};
+
+            for( int i = 0; i < 8; ++i )
+            {
+                detail::write32le( w + i * 4, v[ i ] ^ v[ i + 8 ] );
+                detail::write32le( w + 32 + i * 4, v[ i + 8 ] ^ o.cv[ i ] );
+            }
+
+            std::size_t k = n < block_len? n: block_len;
+            detail::memcpy( out, w, k );
+
+            ++counter;
+            out += k;
+            n -= k;
+        }
+    }
+
+    struct chunk_state
+    {
+        std::uint32_t cv[ 8 ];
+        std::uint64_t chunk_counter;
+        unsigned char buf[ block_len ];
+        std::size_t buf_len;
+        std::size_t blocks_compressed;
+
+        BOOST_CXX14_CONSTEXPR void init( std::uint64_t counter )
+        {
+            for( int i = 0; i < 8; ++i )
+            {
+                cv[ i ] = blake3_constants<>::IV[ i ];
+            }
+
+            chunk_counter = counter;
+
+            detail::memset( buf, 0, block_len );
+            buf_len = 0;
+
+            blocks_compressed = 0;
+        }
+
+        BOOST_CXX14_CONSTEXPR std::size_t len() const
+        {
+            return block_len * blocks_compressed + buf_len;
+        }
+
+        BOOST_CXX14_CONSTEXPR std::uint32_t start_flag() const
+        {
+            return blocks_compressed == 0? CHUNK_START: 0;
+        }
+
+        BOOST_CXX14_CONSTEXPR std::size_t fill_buf( unsigned char const* p, std::size_t n )
+        {
+            std::size_t k = block_len - buf_len;
+
+            if( k > n )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buf + buf_len, p, k );
+            buf_len += k;
+
+            return k;
+        }
+
+        // the last block is kept in buf, as it may need the CHUNK_END flag
+
+        BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+        {
+            if( buf_len > 0 )
+            {
+                std::size_t k = fill_buf( p, n );
+
+                p += k;
+                n -= k;
+
+                if( n > 0 )
+                {
+                    compress_in_place( cv, buf, block_len, chunk_counter, start_flag() );
+                    ++blocks_compressed;
+
+                    detail::memset( buf, 0, block_len );
+                    buf_len = 0;
+                }
+            }
+
+            while( n > block_len )
+            {
+                compress_in_place( cv, p, block_len, chunk_counter, start_flag() );
+                ++blocks_compressed;
+
+                p += block_len;
+                n -= block_len;
+            }
+
+            fill_buf( p, n );
+        }
+
+        BOOST_CXX14_CONSTEXPR output get_output() const
+        {
+            output r = {};
+
+            for( int i = 0; i < 8; ++i )
+            {
+                r.cv[ i ] = cv[ i ];
+            }
+
+            detail::memcpy( r.block, buf, block_len );
+
+            r.counter = chunk_counter;
+            r.n = static_cast<std::uint32_t>( buf_len );
+            r.flags = start_flag() | CHUNK_END;
+
+            return r;
+        }
+    };
+
+    // subtree compression
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t round_down_to_power_of_2( std::uint64_t x )
+    {
+        std::uint64_t r = 1;
+
+        while( x >> 1 >= r )
+        {
+            r <<= 1;
+        }
+
+        return r;
+    }
+
+    // the length of the left subtree of a node with n input bytes, n > chunk_len
+
+    BOOST_CXX14_CONSTEXPR static std::size_t left_subtree_len( std::size_t n )
+    {
+        std::size_t full_chunks = ( n - 1 ) / chunk_len;
+        return static_cast<std::size_t>( round_down_to_power_of_2( full_chunks ) ) * chunk_len;
+    }
+
+    // compresses up to degree() chunks, the last of which may be partial;
+    // returns the number of chaining values written to out
+
+    BOOST_CXX14_CONSTEXPR static std::size_t compress_chunks( unsigned char const* p, std::size_t n, std::uint64_t counter, unsigned char* out )
+    {
+        unsigned char const* chunks[ max_simd_degree ] = {};
+        std::size_t k = 0;
+
+        while( n >= chunk_len )
+        {
+            chunks[ k++ ] = p;
+
+            p += chunk_len;
+            n -= chunk_len;
+        }
+
+        hash_many( chunks, k, chunk_len / block_len, counter, true, 0, CHUNK_START, CHUNK_END, out );
+
+        if( n > 0 )
+        {
+            chunk_state st = {};
+
+            st.init( counter + k );
+            st.update( p, n );
+
+            st.get_output().chaining_value( out + k * out_len );
+
+            ++k;
+        }
+
+        return k;
+    }
+
+    // compresses pairs of adjacent chaining values into parents, an odd last one is passed unchanged;
+    // returns the number of chaining values written to out
+
+    BOOST_CXX14_CONSTEXPR static std::size_t compress_parents( unsigned char const* cvs, std::size_t n, unsigned char* out )
+    {
+        unsigned char const* parents[ max_simd_degree ] = {};
+        std::size_t k = 0;
+
+        while( n - 2 * k >= 2 )
+        {
+            parents[ k ] = cvs + 2 * k * out_len;
+            ++k;
+        }
+
+        hash_many( parents, k, 1, 0, false, PARENT, 0, 0, out );
+
+        if( n > 2 * k )
+        {
+            detail::memcpy( out + k * out_len, cvs + 2 * k * out_len, out_len );
+            ++k;
+        }
+
+        return k;
+    }
+
+    // compresses the subtree of n input bytes starting at chunk `counter`,
+    // using all SIMD lanes; returns the number of chaining values written,
+    // at most max( degree(), 2 )
+
+    BOOST_CXX14_CONSTEXPR static std::size_t compress_subtree_wide( unsigned char const* p, std::size_t n, std::uint64_t counter, unsigned char* out, task_executor* ex, unsigned threads )
+    {
+        std::size_t d = degree();
+
+        if( n <= d * chunk_len )
+        {
+            return compress_chunks( p, n, counter, out );
+        }
+
+        std::size_t left_n = left_subtree_len( n );
+        std::uint64_t right_counter = counter + left_n / chunk_len;
+
+        unsigned char cv_array[ 2 * max_simd_degree * out_len ] = {};
+
+        if( d == 1 && left_n > chunk_len )
+        {
+            d = 2;
+        }
+
+        unsigned char* right_cvs = cv_array + d * out_len;
+
+        std::size_t left_k = 0;
+        std::size_t right_k = 0;
+
+        if( threads > 1 && left_n >= parallel_min_len )
+        {
+            compress_subtrees_threaded( p, left_n, n - left_n, counter, right_counter, cv_array, right_cvs, *ex, threads, left_k, right_k );
+        }
+        else
+        {
+            left_k = compress_subtree_wide( p, left_n, counter, cv_array, nullptr, 1 );
+            right_k = compress_subtree_wide( p + left_n, n - left_n, right_counter, right_cvs, nullptr, 1 );
+        }
+
+        // a left subtree of one chunk implies a right subtree of one chunk;
+        // return both, rather than compressing them into a parent
+
+        if( left_k == 1 )
+        {
+            detail::memcpy( out, cv_array, 2 * out_len );
+            return 2;
+        }
+
+        return compress_parents( cv_array, left_k + right_k, out );
+    }
+
+    static void compress_subtrees_threaded( unsigned char const* p, std::size_t left_n, std::size_t right_n, std::uint64_t counter, std::uint64_t right_counter, unsigned char* left_cvs, unsigned char* right_cvs, task_executor& ex, unsigned threads, std::size_t& left_k, std::size_t& right_k )
+    {
+        unsigned const left_threads = threads - threads / 2;
+        unsigned const right_threads = threads / 2;
+
+        hash2::bulk_execute( ex, 2, [&]( std::size_t i ){
+
+            if( i == 0 )
+            {
+                detail::numa_bind_worker( p );
+                left_k = compress_subtree_wide( p, left_n, counter, left_cvs, &ex, left_threads );
+            }
+            else
+            {
+                detail::numa_bind_worker( p + left_n );
+                right_k = compress_subtree_wide( p + left_n, right_n, right_counter, right_cvs, &ex, right_threads );
+            }
+        });
+    }
+
+    // compresses the subtree of n > chunk_len input bytes down to the two
+    // chaining values of the children of its root
+
+    BOOST_CXX14_CONSTEXPR static void compress_subtree_to_parent_node( unsigned char const* p, std::size_t n, std::uint64_t counter, unsigned char out[ 2 * out_len ], task_executor* ex, unsigned threads )
+    {
+        unsigned char cv_array[ max_simd_degree * out_len ] = {};
+        std::size_t k = compress_subtree_wide( p, n, counter, cv_array, ex, threads );
+
+        unsigned char tmp[ max_simd_degree * out_len ] = {};
+
+        while( k > 2 )
+        {
+            k = compress_parents( cv_array, k, tmp );
+            detail::memcpy( cv_array, tmp, k * out_len );
+        }
+
+        detail::memcpy( out, cv_array, 2 * out_len );
+    }
+};
+
+} // namespace detail
+
+class blake3
+{
+private:
+
+    using core = detail::blake3_core;
+
+    static constexpr std::size_t max_depth = 54; // enough for 2^64 bytes
+
+    core::chunk_state chunk_ = {};
+
+    unsigned char cv_stack_[ max_depth * core::out_len ] = {};
+    std::size_t cv_stack_len_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void init()
+    {
+        chunk_.init( 0 );
+
+        detail::memset( cv_stack_, 0, sizeof( cv_stack_ ) );
+        cv_stack_len_ = 0;
+    }
+
+    // merges the completed subtrees on the stack, so that it holds as many
+    // chaining values as there are set bits in the number of chunks so far;
+    // the merge is lazy, as the last chaining value may turn out to be the root
+
+    BOOST_CXX14_CONSTEXPR void merge_cv_stack( std::uint64_t total_chunks )
+    {
+        std::size_t post_merge_len = 0;
+
+        for( std::uint64_t x = total_chunks; x != 0; x &= x - 1 )
+        {
+            ++post_merge_len;
+        }
+
+        while( cv_stack_len_ > post_merge_len )
+        {
+            unsigned char* block = cv_stack_ + ( cv_stack_len_ - 2 ) * core::out_len;
+
+            core::parent_output( block ).chaining_value( block );
+            --cv_stack_len_;
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void push_cv( unsigned char const cv[ core::out_len ], std::uint64_t counter )
+    {
+        merge_cv_stack( counter );
+
+        BOOST_ASSERT( cv_stack_len_ < max_depth );
+
+        detail::memcpy( cv_stack_ + cv_stack_len_ * core::out_len, cv, core::out_len );
+        ++cv_stack_len_;
+    }
+
+    BOOST_CXX14_CONSTEXPR void update_( unsigned char const* p, std::size_t n, task_executor* ex, unsigned threads )
+    {
+        if( n == 0 ) return;
+
+        if( chunk_.len() > 0 )
+        {
+            std::size_t k = core::chunk_len - chunk_.len();
+
+            if( k > n )
+            {
+                k = n;
+            }
+
+            chunk_.update( p, k );
+
+            p += k;
+            n -= k;
+
+            if( n == 0 ) return;
+
+            // more input follows, so the chunk is complete and isn't the root
+
+            unsigned char cv[ core::out_len ] = {};
+            chunk_.get_output().chaining_value( cv );
+
+            push_cv( cv, chunk_.chunk_counter );
+            chunk_.init( chunk_.chunk_counter + 1 );
+        }
+
+        // hash complete subtrees directly from the input, keeping at least one
+        // byte for the chunk state
+
+        while( n > core::chunk_len )
+        {
+            std::uint64_t subtree_len = core::round_down_to_power_of_2( n );
+            std::uint64_t const count_so_far = chunk_.chunk_counter * core::chunk_len;
+
+            // the subtree must be aligned to its size
+
+            while( ( ( subtree_len - 1 ) & count_so_far ) != 0 )
+            {
+                subtree_len /= 2;
+            }
+
+            std::uint64_t const subtree_chunks = subtree_len / core::chunk_len;
+
+            if( subtree_len <= core::chunk_len )
+            {
+                core::chunk_state st = {};
+
+                st.init( chunk_.chunk_counter );
+                st.update( p, static_cast<std::size_t>( subtree_len ) );
+
+                unsigned char cv[ core::out_len ] = {};
+                st.get_output().chaining_value( cv );
+
+                push_cv( cv, st.chunk_counter );
+            }
+            else
+            {
+                // push the two children of the subtree root, as it
+                // may turn out to be the root of the whole tree
+
+                unsigned char cv_pair[ 2 * core::out_len ] = {};
+                core::compress_subtree_to_parent_node( p, static_cast<std::size_t>( subtree_len ), chunk_.chunk_counter, cv_pair, ex, threads );
+
+                push_cv( cv_pair, chunk_.chunk_counter );
+                push_cv( cv_pair + core::out_len, chunk_.chunk_counter + subtree_chunks / 2 );
+            }
+
+            chunk_.chunk_counter += subtree_chunks;
+
+            p += subtree_len;
+            n -= static_cast<std::size_t>( subtree_len );
+        }
+
+        if( n > 0 )
+        {
+            chunk_.update( p, n );
+            merge_cv_stack( chunk_.chunk_counter );
+        }
+    }
+
+    // the inputs of the compression of the root node
+
+    BOOST_CXX14_CONSTEXPR core::output root_output() const
+    {
+        core::output out = {};
+
+        if( cv_stack_len_ == 0 )
+        {
+            out = chunk_.get_output();
+        }
+        else
+        {
+            std::size_t k = cv_stack_len_;
+
+            if( chunk_.len() > 0 )
+            {
+                out = chunk_.get_output();
+            }
+            else
+            {
+                // the input ended with a subtree; its two children are on the stack
+
+                k -= 2;
+                out = core::parent_output( cv_stack_ + k * core::out_len );
+            }
+
+            while( k > 0 )
+            {
+                --k;
+
+                unsigned char block[ core::block_len ] = {};
+
+                detail::memcpy( block, cv_stack_ + k * core::out_len, core::out_len );
+                out.chaining_value( block + core::out_len );
+
+                out = core::parent_output( block );
+            }
+        }
+
+        return out;
+    }
+
+public:
+
+    using result_type = digest<32>;
+
+    static constexpr int block_size = 64;
+
+    BOOST_CXX14_CONSTEXPR blake3()
+    {
+        init();
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit blake3( std::uint64_t seed )
+    {
+        init();
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR blake3( unsigned char const * p, std::size_t n )
+    {
+        init();
+
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( blake3, "blake3", n );
+
+        update_( p, n, nullptr, 1 );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // same as update, but compresses large inputs on up to `threads` threads;
+    // threads == 0 means std::thread::hardware_concurrency()
+
+    void update_parallel( void const* pv, std::size_t n, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        update_parallel( pv, n, ex );
+    }
+
+    // same, but compresses the subtrees on ex
+
+    void update_parallel( void const* pv, std::size_t n, task_executor& ex )
+    {
+        BOOST_HASH2_STATS_UPDATE( blake3, "blake3", n );
+
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update_( p, n, &ex, ex.concurrency() );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( blake3, "blake3" );
+
+        core::output out = root_output();
+
+        std::uint32_t v[ 16 ] = {};
+        core::compress( v, out.cv, out.block, out.n, 0, out.flags | core::ROOT );
+
+        result_type digest;
+
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32le( digest.data() + i * 4, v[ i ] ^ v[ i + 8 ] );
+        }
+
+        // restart from the digest, so that repeated calls return a
+        // pseudorandom sequence and no plaintext is retained
+
+        init();
+        BOOST_HASH2_STATS_SUSPEND();
+        update( digest.data(), digest.size() );
+        BOOST_HASH2_STATS_RESUME();
+
+        return digest;
+    }
+
+    // the first n bytes of the BLAKE3 extended output (XOF) of the input so
+    // far; the first 32 are the value result() would return. The state is
+    // not changed
+    //
+    // the output blocks are independent, and on x86 processors with AVX2,
+    // are computed eight at a time
+
+    BOOST_CXX14_CONSTEXPR void squeeze( unsigned char* out, std::size_t n ) const
+    {
+        core::root_output_bytes( root_output(), out, n );
+    }
+
+    void squeeze( void* out, std::size_t n ) const
+    {
+        squeeze( static_cast<unsigned char*>( out ), n );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.chunk_.cv );
+        ar.u64( self.chunk_.chunk_counter );
+        ar.bytes( self.chunk_.buf );
+        ar.u64( self.chunk_.buf_len );
+        ar.u64( self.chunk_.blocks_compressed );
+
+        ar.bytes( self.cv_stack_ );
+        ar.u64( self.cv_stack_len_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 32 + 8 + core::block_len + 16 + max_depth * core::out_len + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        blake3 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.chunk_.buf_len <= core::block_len && tmp.chunk_.blocks_compressed <= core::chunk_len / core::block_len && tmp.cv_stack_len_ <= max_depth ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BLAKE3_HPP_INCLUDED
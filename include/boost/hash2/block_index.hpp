@@ -0,0 +1,514 @@
+#ifndef BOOST_HASH2_BLOCK_INDEX_HPP_INCLUDED
+#define BOOST_HASH2_BLOCK_INDEX_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// block_index<H>, a sidecar file holding the digests of the blocks of a
+// data file and their Merkle root, with which any byte range of the file
+// can be verified by hashing only the blocks it touches
+
+#include <boost/hash2/merkle_tree.hpp>
+#include <boost/hash2/hash_file.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/config.hpp>
+#include <atomic>
+#include <system_error>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the sidecar file is a header of this size, followed by the root and
+// the leaf digests of the tree:
+//
+//   magic: 16 bytes
+//   algorithm, digest size, block size, file size, block count: 8 bytes
+//     each, little endian
+//   8 zero bytes
+
+std::size_t const block_index_header_size = 64;
+
+char const block_index_magic[ 16 ] = { 'b', 'o', 'o', 's', 't', '.', 'h', 'a', 's', 'h', '2', '.', 'b', 'x', '0', '1' };
+
+// identifies the algorithm H by the digest it computes for a fixed
+// message, as digest_cache does
+
+template<class H> std::uint64_t block_index_algorithm()
+{
+    static std::uint64_t const r = []{
+
+        H h;
+        h.update( "boost.hash2.block_index", 23 );
+
+        typename H::result_type d = h.result();
+        return detail::read64le( d.data() );
+
+    }();
+
+    return r;
+}
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+// a read-only mapping of [offset, offset + n) of a file; offset is
+// rounded down to a page boundary
+
+class file_mapping
+{
+private:
+
+    void* p_;
+    std::size_t n_;
+    std::size_t skip_;
+
+public:
+
+    file_mapping(): p_( MAP_FAILED ), n_( 0 ), skip_( 0 )
+    {
+    }
+
+    file_mapping( file_mapping const& ) = delete;
+    file_mapping& operator=( file_mapping const& ) = delete;
+
+    ~file_mapping()
+    {
+        if( p_ != MAP_FAILED ) ::munmap( p_, n_ );
+    }
+
+    bool map( int fd, std::uint64_t offset, std::uint64_t n )
+    {
+        std::uint64_t const page = static_cast<std::uint64_t>( ::sysconf( _SC_PAGESIZE ) );
+
+        skip_ = static_cast<std::size_t>( offset % page );
+        offset -= skip_;
+
+        if( n > static_cast<std::size_t>( -1 ) - skip_ )
+        {
+            errno = EOVERFLOW;
+            return false;
+        }
+
+        n_ = static_cast<std::size_t>( n ) + skip_;
+        p_ = ::mmap( 0, n_, PROT_READ, MAP_PRIVATE, fd, static_cast< ::off_t >( offset ) );
+
+        return p_ != MAP_FAILED;
+    }
+
+    void advise( int advice ) const noexcept
+    {
+        ::madvise( p_, n_, advice );
+    }
+
+    unsigned char const* data() const noexcept
+    {
+        return static_cast<unsigned char const*>( p_ ) + skip_;
+    }
+};
+
+inline bool file_write( int fd, void const* p, std::size_t n ) noexcept
+{
+    unsigned char const* q = static_cast<unsigned char const*>( p );
+
+    while( n > 0 )
+    {
+        ::ssize_t r = ::write( fd, q, n );
+
+        if( r < 0 )
+        {
+            if( errno == EINTR ) continue;
+            return false;
+        }
+
+        q += r;
+        n -= static_cast<std::size_t>( r );
+    }
+
+    return true;
+}
+
+#endif
+
+} // namespace detail
+
+// block_index<H>
+//
+// the leaves of the tree are the digests merkle_tree<H> computes for the
+// blocks of the file, and the sidecar stores them together with the root;
+// loading the sidecar recomputes the root from the leaves, so that a
+// damaged sidecar is detected, and the root can be checked against one
+// kept elsewhere
+//
+// verify maps the blocks a range touches, and hashes them in parallel
+
+template<class H> class block_index
+{
+public:
+
+    using hash_type = H;
+    using digest_type = typename H::result_type;
+
+private:
+
+    merkle_tree<H> tree_;
+    std::uint64_t file_size_;
+
+public:
+
+    explicit block_index( std::size_t block_size = 1024 * 1024 ): tree_( block_size ), file_size_( 0 )
+    {
+    }
+
+    std::size_t block_size() const noexcept
+    {
+        return tree_.block_size();
+    }
+
+    std::size_t block_count() const noexcept
+    {
+        return tree_.leaf_count();
+    }
+
+    std::uint64_t file_size() const noexcept
+    {
+        return file_size_;
+    }
+
+    digest_type root() const
+    {
+        return tree_.root();
+    }
+
+    merkle_tree<H> const& tree() const noexcept
+    {
+        return tree_;
+    }
+
+    // builds the index of the file path, mapping it into memory and
+    // hashing its blocks on ex
+
+    void build( char const* path, std::error_code& ec, task_executor& ex )
+    {
+        ec.clear();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        detail::file_descriptor fd( detail::file_open( path, 0 ) );
+
+        if( fd.get() < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        struct ::stat st;
+
+        if( ::fstat( fd.get(), &st ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        if( !S_ISREG( st.st_mode ) )
+        {
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        std::uint64_t const size = static_cast<std::uint64_t>( st.st_size );
+
+        if( size == 0 )
+        {
+            tree_.build( nullptr, 0, ex );
+            file_size_ = 0;
+
+            return;
+        }
+
+        detail::file_mapping m;
+
+        if( !m.map( fd.get(), 0, size ) )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        m.advise( MADV_SEQUENTIAL );
+
+        tree_.build( m.data(), static_cast<std::size_t>( size ), ex );
+        file_size_ = size;
+
+#else
+
+        (void)path;
+        (void)ex;
+
+        ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+    }
+
+    // same, on up to threads threads; threads == 0 means
+    // std::thread::hardware_concurrency()
+
+    void build( char const* path, std::error_code& ec, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        build( path, ec, ex );
+    }
+
+    // writes the sidecar file path, replacing it if it exists
+
+    void save( char const* path, std::error_code& ec ) const
+    {
+        ec.clear();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        std::size_t const N = digest_type().size();
+        std::size_t const n = block_count();
+
+        std::vector<unsigned char> buffer( detail::block_index_header_size + ( n + 1 ) * N );
+
+        unsigned char* p = buffer.data();
+
+        std::memcpy( p, detail::block_index_magic, sizeof( detail::block_index_magic ) );
+
+        detail::write64le( p + 16, detail::block_index_algorithm<H>() );
+        detail::write64le( p + 24, N );
+        detail::write64le( p + 32, block_size() );
+        detail::write64le( p + 40, file_size_ );
+        detail::write64le( p + 48, n );
+
+        p += detail::block_index_header_size;
+
+        digest_type const r = root();
+
+        std::memcpy( p, r.data(), N );
+        p += N;
+
+        for( std::size_t i = 0; i < n; ++i, p += N )
+        {
+            std::memcpy( p, tree_.leaf( i ).data(), N );
+        }
+
+        int fd = ::open( path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644 );
+
+        if( fd < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        detail::file_descriptor guard( fd );
+
+        if( !detail::file_write( fd, buffer.data(), buffer.size() ) )
+        {
+            ec.assign( errno, std::system_category() );
+        }
+
+#else
+
+        (void)path;
+        ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+    }
+
+    // reads the sidecar file path; fails with invalid_argument if it
+    // isn't one for H, or its root doesn't match its leaves
+
+    void load( char const* path, std::error_code& ec )
+    {
+        ec.clear();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        detail::file_descriptor fd( detail::file_open( path, 0 ) );
+
+        if( fd.get() < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        std::size_t const N = digest_type().size();
+
+        unsigned char header[ detail::block_index_header_size ];
+
+        std::ptrdiff_t r = detail::file_read( fd.get(), header, sizeof( header ) );
+
+        if( r < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        std::uint64_t const bs = detail::read64le( header + 32 );
+        std::uint64_t const size = detail::read64le( header + 40 );
+        std::uint64_t const n = detail::read64le( header + 48 );
+
+        if( static_cast<std::size_t>( r ) != sizeof( header ) || std::memcmp( header, detail::block_index_magic, sizeof( detail::block_index_magic ) ) != 0 ||
+            detail::read64le( header + 16 ) != detail::block_index_algorithm<H>() || detail::read64le( header + 24 ) != N ||
+            bs == 0 || bs > static_cast<std::size_t>( -1 ) || n != ( size + bs - 1 ) / bs || n >= static_cast<std::size_t>( -1 ) / N - 1 )
+        {
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        std::size_t const m = static_cast<std::size_t>( n + 1 ) * N;
+
+        std::vector<unsigned char> buffer( m + 1 );
+
+        r = detail::file_read( fd.get(), buffer.data(), m + 1 );
+
+        if( r < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        if( static_cast<std::size_t>( r ) != m )
+        {
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        std::vector<digest_type> leaves( static_cast<std::size_t>( n ) );
+
+        for( std::size_t i = 0; i < leaves.size(); ++i )
+        {
+            std::memcpy( leaves[ i ].data(), buffer.data() + ( i + 1 ) * N, N );
+        }
+
+        merkle_tree<H> tree( static_cast<std::size_t>( bs ) );
+        tree.assign( leaves.begin(), leaves.end() );
+
+        if( std::memcmp( tree.root().data(), buffer.data(), N ) != 0 )
+        {
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        tree_ = std::move( tree );
+        file_size_ = size;
+
+#else
+
+        (void)path;
+        ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+    }
+
+    // checks the blocks of the file path that [offset, offset + n) touches
+    // against the index, hashing them on ex; returns false if one of them
+    // differs, or the file size isn't the one indexed, or the range
+    // extends past it
+
+    bool verify( char const* path, std::uint64_t offset, std::uint64_t n, std::error_code& ec, task_executor& ex ) const
+    {
+        ec.clear();
+
+        if( offset > file_size_ || n > file_size_ - offset ) return false;
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        detail::file_descriptor fd( detail::file_open( path, 0 ) );
+
+        if( fd.get() < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return false;
+        }
+
+        struct ::stat st;
+
+        if( ::fstat( fd.get(), &st ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return false;
+        }
+
+        if( static_cast<std::uint64_t>( st.st_size ) != file_size_ ) return false;
+
+        if( n == 0 ) return true;
+
+        std::uint64_t const B = block_size();
+
+        std::size_t const first = static_cast<std::size_t>( offset / B );
+        std::size_t const last = static_cast<std::size_t>( ( offset + n - 1 ) / B ) + 1;
+
+        std::uint64_t const begin = first * B;
+        std::uint64_t const end = last * B < file_size_? last * B: file_size_;
+
+        detail::file_mapping m;
+
+        if( !m.map( fd.get(), begin, end - begin ) )
+        {
+            ec.assign( errno, std::system_category() );
+            return false;
+        }
+
+        m.advise( MADV_SEQUENTIAL );
+
+        std::size_t const blocks = last - first;
+
+        unsigned const parts = detail::parallel_parts( ex, blocks, 1 );
+        std::size_t const k = blocks / parts;
+
+        std::atomic<bool> ok( true );
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+            std::size_t const i1 = first + t * k;
+            std::size_t const i2 = t + 1 < parts? i1 + k: last;
+
+            for( std::size_t i = i1; i < i2 && ok.load( std::memory_order_relaxed ); ++i )
+            {
+                std::uint64_t const p = i * B;
+                std::size_t const q = static_cast<std::size_t>( file_size_ - p < B? file_size_ - p: B );
+
+                if( merkle_tree<H>::hash_leaf( m.data() + ( p - begin ), q ) != tree_.leaf( i ) )
+                {
+                    ok.store( false, std::memory_order_relaxed );
+                }
+            }
+        });
+
+        return ok.load( std::memory_order_relaxed );
+
+#else
+
+        (void)path;
+        (void)ex;
+
+        ec = std::make_error_code( std::errc::function_not_supported );
+        return false;
+
+#endif
+    }
+
+    bool verify( char const* path, std::uint64_t offset, std::uint64_t n, std::error_code& ec, unsigned threads = 0 ) const
+    {
+        thread_executor ex( threads );
+        return verify( path, offset, n, ec, ex );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BLOCK_INDEX_HPP_INCLUDED
@@ -0,0 +1,385 @@
+#ifndef BOOST_HASH2_BLOOM_FILTER_HPP_INCLUDED
+#define BOOST_HASH2_BLOOM_FILTER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// n 64 bit words, starting at a multiple of A words
+
+class aligned_words
+{
+private:
+
+    std::vector<std::uint64_t> v_;
+    std::uint64_t* p_ = nullptr;
+    std::size_t n_ = 0;
+    std::size_t a_ = 1;
+
+public:
+
+    aligned_words( std::size_t n, std::size_t a ): v_( n + a - 1 ), n_( n ), a_( a )
+    {
+        std::uintptr_t addr = reinterpret_cast<std::uintptr_t>( v_.data() );
+        std::uintptr_t mask = a * 8 - 1;
+
+        p_ = v_.data() + ( ( mask + 1 - ( addr & mask ) ) & mask ) / 8;
+    }
+
+    aligned_words( aligned_words const& r ): aligned_words( r.n_, r.a_ )
+    {
+        std::copy( r.p_, r.p_ + n_, p_ );
+    }
+
+    aligned_words( aligned_words&& r ) noexcept: v_( std::move( r.v_ ) ), p_( r.p_ ), n_( r.n_ ), a_( r.a_ )
+    {
+        r.p_ = nullptr;
+        r.n_ = 0;
+    }
+
+    aligned_words& operator=( aligned_words r ) noexcept
+    {
+        v_.swap( r.v_ );
+        std::swap( p_, r.p_ );
+        std::swap( n_, r.n_ );
+        std::swap( a_, r.a_ );
+
+        return *this;
+    }
+
+    std::uint64_t* data() noexcept { return p_; }
+    std::uint64_t const* data() const noexcept { return p_; }
+
+    std::size_t size() const noexcept { return n_; }
+};
+
+// a cheap remix of a 64 bit hash value, for the next bit position
+
+BOOST_FORCEINLINE std::uint64_t bloom_remix( std::uint64_t h ) noexcept
+{
+    std::uint64_t hi;
+    std::uint64_t lo = detail::mul128( h, 0x9E3779B97F4A7C15ull, hi );
+
+    return hi ^ lo;
+}
+
+constexpr unsigned log2_pow2( std::size_t n ) noexcept
+{
+    return n <= 1? 0: 1 + log2_pow2( n / 2 );
+}
+
+} // namespace detail
+
+// bloom_filter<T, H, K, BlockSize, Flavor>, a blocked Bloom filter
+//
+// each value sets K bits within a single block of BlockSize bytes;
+// BlockSize 8 gives a register-blocked filter, and 64, the default,
+// a cache-line-blocked one
+
+template<class T, class H, std::size_t K, std::size_t BlockSize = 64, class Flavor = default_flavor> class bloom_filter
+{
+private:
+
+    static_assert( K > 0, "K must be positive" );
+    static_assert( BlockSize >= 8 && BlockSize <= 64 && ( BlockSize & ( BlockSize - 1 ) ) == 0, "BlockSize must be 8, 16, 32 or 64" );
+
+    static constexpr std::size_t W = BlockSize / 8;
+    static constexpr unsigned S = 64 - detail::log2_pow2( BlockSize * 8 );
+
+    // values are hashed and prefetched in groups of this size
+
+    static constexpr std::size_t batch_size = 16;
+
+    H h_;
+    std::size_t n_;
+    detail::aligned_words w_;
+
+private:
+
+    std::uint64_t* block( std::uint64_t h ) noexcept
+    {
+        return w_.data() + hash2::reduce( h, n_ ) * W;
+    }
+
+    std::uint64_t const* block( std::uint64_t h ) const noexcept
+    {
+        return w_.data() + hash2::reduce( h, n_ ) * W;
+    }
+
+    static void set_bits( std::uint64_t* p, std::uint64_t h ) noexcept
+    {
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            h = detail::bloom_remix( h );
+
+            std::size_t j = static_cast<std::size_t>( h >> S );
+            p[ j / 64 ] |= std::uint64_t( 1 ) << ( j % 64 );
+        }
+    }
+
+    static bool test_bits( std::uint64_t const* p, std::uint64_t h ) noexcept
+    {
+        bool r = true;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            h = detail::bloom_remix( h );
+
+            std::size_t j = static_cast<std::size_t>( h >> S );
+            r &= ( p[ j / 64 ] >> ( j % 64 ) ) & 1;
+        }
+
+        return r;
+    }
+
+    static std::size_t block_count( std::size_t m ) noexcept
+    {
+        std::size_t n = ( m + BlockSize * 8 - 1 ) / ( BlockSize * 8 );
+        return n > 0? n: 1;
+    }
+
+public:
+
+    using value_type = T;
+    using hash_type = H;
+
+    // m is the number of bits, rounded up to a multiple of the block size
+
+    explicit bloom_filter( std::size_t m ): h_(), n_( block_count( m ) ), w_( n_ * W, W )
+    {
+    }
+
+    bloom_filter( std::size_t m, std::uint64_t seed ): h_( seed ), n_( block_count( m ) ), w_( n_ * W, W )
+    {
+    }
+
+    bloom_filter( std::size_t m, unsigned char const* seed, std::size_t n ): h_( seed, n ), n_( block_count( m ) ), w_( n_ * W, W )
+    {
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return n_ * BlockSize * 8;
+    }
+
+    void clear() noexcept
+    {
+        std::fill( w_.data(), w_.data() + w_.size(), std::uint64_t( 0 ) );
+    }
+
+    void insert( T const& v )
+    {
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+        set_bits( block( h ), h );
+    }
+
+    bool may_contain( T const& v ) const
+    {
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+        return test_bits( block( h ), h );
+    }
+
+    // the batch operations hash a group of values and prefetch their
+    // blocks before accessing them, overlapping the cache misses
+
+    template<class It> void insert( It first, It last )
+    {
+        std::uint64_t h[ batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = detail::hash_value64<H, Flavor, T>( h_, *first );
+                detail::prefetch( block( h[ n ] ) );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                set_bits( block( h[ i ] ), h[ i ] );
+            }
+        }
+    }
+
+    template<class It> void may_contain( It first, It last, bool* out ) const
+    {
+        std::uint64_t h[ batch_size ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < batch_size && first != last; ++n, ++first )
+            {
+                h[ n ] = detail::hash_value64<H, Flavor, T>( h_, *first );
+                detail::prefetch( block( h[ n ] ) );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                *out++ = test_bits( block( h[ i ] ), h[ i ] );
+            }
+        }
+    }
+};
+
+// counting_bloom_filter<T, H, K, Flavor>, a cache-line-blocked counting
+// Bloom filter with 4 bit saturating counters, 128 to a line; a counter
+// that has saturated is never decremented
+
+template<class T, class H, std::size_t K, class Flavor = default_flavor> class counting_bloom_filter
+{
+private:
+
+    static_assert( K > 0, "K must be positive" );
+
+    static constexpr std::size_t W = 8;
+    static constexpr unsigned S = 64 - 7;
+
+    H h_;
+    std::size_t n_;
+    detail::aligned_words w_;
+
+private:
+
+    std::uint64_t* block( std::uint64_t h ) noexcept
+    {
+        return w_.data() + hash2::reduce( h, n_ ) * W;
+    }
+
+    std::uint64_t const* block( std::uint64_t h ) const noexcept
+    {
+        return w_.data() + hash2::reduce( h, n_ ) * W;
+    }
+
+    static unsigned get( std::uint64_t const* p, std::size_t j ) noexcept
+    {
+        return static_cast<unsigned>( p[ j / 16 ] >> ( j % 16 * 4 ) ) & 0x0F;
+    }
+
+    static bool test_counters( std::uint64_t const* p, std::uint64_t h ) noexcept
+    {
+        bool r = true;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            h = detail::bloom_remix( h );
+            r &= get( p, static_cast<std::size_t>( h >> S ) ) != 0;
+        }
+
+        return r;
+    }
+
+    static std::size_t block_count( std::size_t m ) noexcept
+    {
+        std::size_t n = ( m + 127 ) / 128;
+        return n > 0? n: 1;
+    }
+
+public:
+
+    using value_type = T;
+    using hash_type = H;
+
+    // m is the number of counters, rounded up to a multiple of 128
+
+    explicit counting_bloom_filter( std::size_t m ): h_(), n_( block_count( m ) ), w_( n_ * W, W )
+    {
+    }
+
+    counting_bloom_filter( std::size_t m, std::uint64_t seed ): h_( seed ), n_( block_count( m ) ), w_( n_ * W, W )
+    {
+    }
+
+    counting_bloom_filter( std::size_t m, unsigned char const* seed, std::size_t n ): h_( seed, n ), n_( block_count( m ) ), w_( n_ * W, W )
+    {
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return n_ * 128;
+    }
+
+    void clear() noexcept
+    {
+        std::fill( w_.data(), w_.data() + w_.size(), std::uint64_t( 0 ) );
+    }
+
+    void insert( T const& v )
+    {
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+        std::uint64_t* p = block( h );
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            h = detail::bloom_remix( h );
+            std::size_t j = static_cast<std::size_t>( h >> S );
+
+            if( get( p, j ) != 0x0F )
+            {
+                p[ j / 16 ] += std::uint64_t( 1 ) << ( j % 16 * 4 );
+            }
+        }
+    }
+
+    // v must have been inserted; returns false, and does nothing,
+    // when it's certainly not in the filter
+
+    bool erase( T const& v )
+    {
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+        std::uint64_t* p = block( h );
+
+        if( !test_counters( p, h ) ) return false;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            h = detail::bloom_remix( h );
+            std::size_t j = static_cast<std::size_t>( h >> S );
+
+            unsigned c = get( p, j );
+
+            // c can be zero when v wasn't inserted after all, and
+            // its counters were reached through other values
+
+            if( c != 0 && c != 0x0F )
+            {
+                p[ j / 16 ] -= std::uint64_t( 1 ) << ( j % 16 * 4 );
+            }
+        }
+
+        return true;
+    }
+
+    bool may_contain( T const& v ) const
+    {
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+        return test_counters( block( h ), h );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BLOOM_FILTER_HPP_INCLUDED
@@ -0,0 +1,183 @@
+#ifndef BOOST_HASH2_BUCKETER_HPP_INCLUDED
+#define BOOST_HASH2_BUCKETER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// bucketer<H>, deterministic assignment of keys, such as user ids, to the
+// buckets of an experiment, and hash-based sampling
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/assert.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// bucketer<H, Flavor>
+//
+// the experiment is hashed once, by the constructor, into a 64 bit salt,
+// and a key is hashed by H( salt ) after hash_append( h, Flavor(), key ),
+// so that the batch member functions can use hash_batch, and with it the
+// multi-lane kernels of H
+//
+// the buckets are obtained from the 64 bit result with reduce, and the
+// position in [0, 1) from its high 53 bits
+
+template<class H, class Flavor = default_flavor> class bucketer
+{
+private:
+
+    // the number of keys hashed at a time by the batch functions
+    static constexpr std::size_t block = 256;
+
+    std::uint64_t salt_;
+    H h0_;
+
+    template<class T> static std::uint64_t make_salt( T const& experiment, std::uint64_t seed )
+    {
+        H h( seed );
+        hash2::hash_append( h, Flavor(), experiment );
+
+        return hash2::get_integral_result<std::uint64_t>( h.result() );
+    }
+
+    // the positions below rate are those below threshold( rate ) * 2^-53
+
+    static std::uint64_t threshold( double rate ) noexcept
+    {
+        double const m = 9007199254740992.0; // 2^53
+
+        if( !( rate > 0 ) ) return 0;
+        if( rate >= 1 ) return static_cast<std::uint64_t>( m );
+
+        double const x = rate * m;
+        std::uint64_t r = static_cast<std::uint64_t>( x );
+
+        return r + ( static_cast<double>( r ) < x );
+    }
+
+    static double to_position( std::uint64_t x ) noexcept
+    {
+        return static_cast<double>( x >> 11 ) * ( 1.0 / 9007199254740992.0 );
+    }
+
+    // calls f( it, x ) for the 64 bit hash value x of each key *it, with
+    // it the iterator to the key
+
+    template<class It, class F> void for_each_hash( It first, It last, F f ) const
+    {
+        typename H::result_type r[ block ];
+
+        while( first != last )
+        {
+            It it = first;
+            std::size_t n = 0;
+
+            for( ; n < block && it != last; ++n, ++it );
+
+            hash2::hash_batch<H, Flavor>( first, it, r, salt_ );
+
+            for( std::size_t i = 0; i < n; ++i, ++first )
+            {
+                f( first, hash2::get_integral_result<std::uint64_t>( r[ i ] ) );
+            }
+        }
+    }
+
+public:
+
+    using hash_type = H;
+
+    // the salt is the hash of experiment, which can be any type
+    // hash_append supports, such as a name or a numeric id
+
+    template<class T> explicit bucketer( T const& experiment, std::uint64_t seed = 0 ): salt_( make_salt( experiment, seed ) ), h0_( salt_ )
+    {
+    }
+
+    std::uint64_t salt() const noexcept
+    {
+        return salt_;
+    }
+
+    // the 64 bit hash value of key in the experiment
+
+    template<class K> std::uint64_t hash_value( K const& key ) const
+    {
+        H h( h0_ );
+        hash2::hash_append( h, Flavor(), key );
+
+        return hash2::get_integral_result<std::uint64_t>( h.result() );
+    }
+
+    // the bucket of key in [0, n); the probabilities of the buckets
+    // differ from 1/n by less than 2^-64
+
+    template<class K> std::size_t bucket( K const& key, std::size_t n ) const
+    {
+        BOOST_ASSERT( n > 0 );
+        return hash2::reduce( hash_value( key ), n );
+    }
+
+    // the position of key in [0, 1), a multiple of 2^-53
+
+    template<class K> double position( K const& key ) const
+    {
+        return to_position( hash_value( key ) );
+    }
+
+    // whether key is in the sample of the given rate, i.e. whether its
+    // position is below rate; samples of lower rates are subsets of
+    // those of higher rates
+
+    template<class K> bool sampled( K const& key, double rate ) const
+    {
+        return ( hash_value( key ) >> 11 ) < threshold( rate );
+    }
+
+    // the batch versions; It is a forward iterator
+
+    template<class It, class OutIt> OutIt hash_values( It first, It last, OutIt out ) const
+    {
+        for_each_hash( first, last, [&]( It, std::uint64_t x ){ *out++ = x; } );
+        return out;
+    }
+
+    template<class It, class OutIt> OutIt buckets( It first, It last, std::size_t n, OutIt out ) const
+    {
+        BOOST_ASSERT( n > 0 );
+
+        for_each_hash( first, last, [&]( It, std::uint64_t x ){ *out++ = hash2::reduce( x, n ); } );
+        return out;
+    }
+
+    template<class It, class OutIt> OutIt positions( It first, It last, OutIt out ) const
+    {
+        for_each_hash( first, last, [&]( It, std::uint64_t x ){ *out++ = to_position( x ); } );
+        return out;
+    }
+
+    // copies the keys in the sample to out
+
+    template<class It, class OutIt> OutIt sample( It first, It last, double rate, OutIt out ) const
+    {
+        std::uint64_t const t = threshold( rate );
+
+        for_each_hash( first, last, [&]( It it, std::uint64_t x ){ if( ( x >> 11 ) < t ) *out++ = *it; } );
+        return out;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BUCKETER_HPP_INCLUDED
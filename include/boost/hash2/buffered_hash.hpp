@@ -0,0 +1,181 @@
+#ifndef BOOST_HASH2_BUFFERED_HASH_HPP_INCLUDED
+#define BOOST_HASH2_BUFFERED_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// buffered_hash<H, N>, coalesces small update calls into a local buffer
+
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// exposes H::block_size, when present
+
+template<class H, class En = void> struct buffered_hash_base
+{
+};
+
+template<class H> struct buffered_hash_base<H, decltype( (void)H::block_size )>
+{
+    static constexpr int block_size = H::block_size;
+};
+
+} // namespace detail
+
+// With Scrub == false, the buffer isn't cleared after being passed to H
+
+template<class H, std::size_t N = 64, bool Scrub = true> class buffered_hash: public detail::buffered_hash_base<H>
+{
+private:
+
+    static_assert( N >= 8, "The buffer size must be at least 8" );
+
+    H h_;
+
+    unsigned char buffer_[ N ] = {};
+    std::size_t m_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void flush()
+    {
+        if( m_ > 0 )
+        {
+            h_.update( buffer_, m_ );
+
+            if( Scrub )
+            {
+                // clear buffered plaintext
+                detail::memset( buffer_, 0, m_ );
+            }
+
+            m_ = 0;
+        }
+    }
+
+public:
+
+    using result_type = typename H::result_type;
+
+    buffered_hash() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit buffered_hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR buffered_hash( unsigned char const * p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_ASSERT( m_ <= N );
+
+        if( n == 0 ) return;
+
+        if( n <= N - m_ )
+        {
+            detail::memcpy( buffer_ + m_, p, n );
+            m_ += n;
+
+            return;
+        }
+
+        flush();
+
+        if( n >= N )
+        {
+            // large writes bypass the buffer
+            h_.update( p, n );
+        }
+        else
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        if( N - m_ < 8 )
+        {
+            flush();
+        }
+
+        detail::write64le( buffer_ + m_, w );
+        m_ += 8;
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        flush();
+        return h_.result();
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.nested( self.h_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + H::state_size + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        buffered_hash tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ <= N ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_BUFFERED_HASH_HPP_INCLUDED
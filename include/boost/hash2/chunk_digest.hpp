@@ -0,0 +1,319 @@
+#ifndef BOOST_HASH2_CHUNK_DIGEST_HPP_INCLUDED
+#define BOOST_HASH2_CHUNK_DIGEST_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fastcdc.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+# include <atomic>
+# include <thread>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class H> struct chunk_record
+{
+    std::uint64_t offset;
+    std::size_t size;
+    typename H::result_type digest;
+};
+
+// chunk_digester<H, Chunker>, splits a stream into content-defined chunks
+// and computes a digest of each
+//
+// the chunk boundaries of a buffer are found by one task, while the
+// chunks found so far are hashed by the others; the records are passed
+// to the callback in stream order
+
+template<class H, class Chunker = fastcdc> class chunk_digester
+{
+private:
+
+    Chunker c_;
+    H h_;
+
+    // the executor passed to the constructor, or, when null, te_
+
+    task_executor* ex_;
+    thread_executor te_;
+
+    // the bytes of the incomplete chunk at the end of the input so far
+
+    std::vector<unsigned char> carry_;
+    std::uint64_t offset_ = 0;
+
+    std::vector< chunk_record<H> > records_;
+    std::vector<unsigned char const*> data_;
+
+private:
+
+    task_executor& executor_() noexcept
+    {
+        return ex_? *ex_: te_;
+    }
+
+    void hash_record( std::size_t i )
+    {
+        H h( h_ );
+        h.update( data_[ i ], records_[ i ].size );
+
+        records_[ i ].digest = h.result();
+    }
+
+    void add_record( unsigned char const* p, std::size_t n, std::size_t i )
+    {
+        records_[ i ].offset = offset_;
+        records_[ i ].size = n;
+        data_[ i ] = p;
+
+        offset_ += n;
+    }
+
+    // finds the chunks of [p, p + n), storing them from records_[ i ] on;
+    // returns the number of complete chunks, and the length of the
+    // incomplete one at the end in m
+
+    template<class F> std::size_t find_chunks( unsigned char const* p, std::size_t n, std::size_t i, std::size_t& m, F publish )
+    {
+        std::size_t const max = c_.max_size();
+
+        std::size_t k = i;
+
+        while( n > 0 )
+        {
+            std::size_t r = c_.next( p, n );
+
+            if( r == n && n < max ) break;
+
+            add_record( p, r, k++ );
+            publish( k );
+
+            p += r;
+            n -= r;
+        }
+
+        m = n;
+        return k;
+    }
+
+    // finds the chunks, and hashes them on the executor
+
+    std::size_t process( unsigned char const* p, std::size_t n, std::size_t i, std::size_t& m )
+    {
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+        task_executor& ex = executor_();
+
+        unsigned const parts = ex.concurrency();
+
+        if( parts > 1 && n >= 2 * c_.max_size() )
+        {
+            // records [0, published) are ready to be hashed; tasks claim
+            // them through next
+
+            std::atomic<std::size_t> published( i );
+            std::atomic<std::size_t> next( 0 );
+            std::atomic<bool> started( false );
+            std::atomic<bool> done( false );
+
+            auto work = [&]{
+
+                for( ;; )
+                {
+                    std::size_t j = next.fetch_add( 1, std::memory_order_relaxed );
+
+                    for( ;; )
+                    {
+                        if( j < published.load( std::memory_order_acquire ) ) break;
+
+                        if( done.load( std::memory_order_acquire ) )
+                        {
+                            if( j < published.load( std::memory_order_acquire ) ) break;
+                            return;
+                        }
+
+                        std::this_thread::yield();
+                    }
+
+                    hash_record( j );
+                }
+            };
+
+            std::size_t k = 0;
+
+            hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+                if( t == 0 )
+                {
+                    started.store( true, std::memory_order_release );
+
+                    k = find_chunks( p, n, i, m, [&]( std::size_t j ){ published.store( j, std::memory_order_release ); } );
+
+                    done.store( true, std::memory_order_release );
+
+                    // this task helps with the remaining chunks
+                }
+                else if( !started.load( std::memory_order_acquire ) )
+                {
+                    // waiting for chunks from a task that hasn't started
+                    // could deadlock; it will hash them itself
+
+                    return;
+                }
+
+                work();
+            });
+
+            return k;
+        }
+
+#endif
+
+        std::size_t k = find_chunks( p, n, i, m, []( std::size_t ){} );
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            hash_record( j );
+        }
+
+        return k;
+    }
+
+public:
+
+    using hash_type = H;
+    using chunker_type = Chunker;
+    using record_type = chunk_record<H>;
+
+    // threads == 0 means std::thread::hardware_concurrency()
+
+    explicit chunk_digester( Chunker const& c, unsigned threads = 0 ): c_( c ), h_(), ex_( nullptr ), te_( threads )
+    {
+        carry_.reserve( c_.max_size() );
+    }
+
+    chunk_digester( Chunker const& c, H const& h, unsigned threads = 0 ): c_( c ), h_( h ), ex_( nullptr ), te_( threads )
+    {
+        carry_.reserve( c_.max_size() );
+    }
+
+    // the chunks are hashed on ex, which must outlive the digester
+
+    chunk_digester( Chunker const& c, task_executor& ex ): c_( c ), h_(), ex_( &ex ), te_( 1 )
+    {
+        carry_.reserve( c_.max_size() );
+    }
+
+    chunk_digester( Chunker const& c, H const& h, task_executor& ex ): c_( c ), h_( h ), ex_( &ex ), te_( 1 )
+    {
+        carry_.reserve( c_.max_size() );
+    }
+
+    // the offset of the first byte not yet passed to f
+
+    std::uint64_t offset() const noexcept
+    {
+        return offset_;
+    }
+
+    // calls f( record_type const& ) for each chunk of the stream that ends
+    // in [p, p + n); the incomplete chunk at the end is kept for the next
+    // call. Chunks are hashed in parallel only for inputs of at least two
+    // maximum chunk sizes, so large buffers should be passed
+
+    template<class F> void update( void const* pv, std::size_t n, F f )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::size_t const max = c_.max_size();
+
+        // an upper bound on the number of chunks
+
+        std::size_t const nmax = ( carry_.size() + n ) / c_.min_size() + 2;
+
+        if( records_.size() < nmax )
+        {
+            records_.resize( nmax );
+            data_.resize( nmax );
+        }
+
+        std::size_t i = 0;
+
+        if( !carry_.empty() )
+        {
+            // the chunk that starts with the carried bytes ends within the
+            // first max - carry_.size() bytes of the input
+
+            std::size_t m0 = carry_.size();
+            std::size_t k = std::min( n, max - m0 );
+
+            carry_.insert( carry_.end(), p, p + k );
+
+            std::size_t r = c_.next( carry_.data(), carry_.size() );
+
+            if( r == carry_.size() && r < max )
+            {
+                // still incomplete; all the input is now in carry_
+                BOOST_ASSERT( k == n );
+                return;
+            }
+
+            // the chunk can't end inside the bytes carried over, since
+            // they contained no boundary
+
+            BOOST_ASSERT( r >= m0 );
+
+            add_record( carry_.data(), r, i++ );
+
+            p += r - m0;
+            n -= r - m0;
+        }
+
+        std::size_t m = 0;
+        std::size_t k = process( p, n, i, m );
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            f( static_cast<record_type const&>( records_[ j ] ) );
+        }
+
+        carry_.assign( p + n - m, p + n );
+    }
+
+    // calls f for the final, incomplete, chunk, if there is one, and
+    // starts a new stream
+
+    template<class F> void finish( F f )
+    {
+        if( !carry_.empty() )
+        {
+            H h( h_ );
+            h.update( carry_.data(), carry_.size() );
+
+            record_type r = { offset_, carry_.size(), h.result() };
+
+            f( static_cast<record_type const&>( r ) );
+        }
+
+        carry_.clear();
+        offset_ = 0;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CHUNK_DIGEST_HPP_INCLUDED
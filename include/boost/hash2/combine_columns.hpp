@@ -0,0 +1,73 @@
+#ifndef BOOST_HASH2_COMBINE_COLUMNS_HPP_INCLUDED
+#define BOOST_HASH2_COMBINE_COLUMNS_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// combine_columns, combining the hash values of k columns into one hash
+// value per row, for keys of several columns
+
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/combine_columns_x86.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// stores in out[ i ], for i in [0, n), the value that mix64( seed ), after
+// hash_append of std::make_tuple( columns[ 0 ][ i ], ..., columns[ k - 1 ][ i ] ),
+// would return from result(); that is, each column value is xored into the
+// state, which is passed through the SplitMix64 finalizer
+//
+// out may be one of the columns
+
+inline void combine_columns( std::uint64_t const* const columns[], std::size_t k, std::size_t n, std::uint64_t* out, std::uint64_t seed = 0 ) noexcept
+{
+    // the state after the seed, and the length term of the result, are the
+    // same for all rows
+
+    std::uint64_t h0 = 0;
+    std::uint64_t m = 8 * static_cast<std::uint64_t>( k );
+
+    if( seed != 0 )
+    {
+        h0 = detail::mix_finalize( seed );
+        m += 8;
+    }
+
+    std::uint64_t const l = m * detail::mix_const<std::uint64_t>::length;
+
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_avx2() )
+    {
+        i = detail::combine_columns_avx2( columns, k, n, out, h0, l );
+    }
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        std::uint64_t h = h0;
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            h = detail::mix_finalize( h ^ columns[ j ][ i ] );
+        }
+
+        out[ i ] = h ^ l;
+    }
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_COMBINE_COLUMNS_HPP_INCLUDED
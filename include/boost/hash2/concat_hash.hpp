@@ -0,0 +1,276 @@
+#ifndef BOOST_HASH2_CONCAT_HASH_HPP_INCLUDED
+#define BOOST_HASH2_CONCAT_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// concat_hash<H>, a polynomial hash modulo 2^61-1 whose value for the
+// concatenation of two messages is computed from their values, for ropes
+// and other trees that cache the hashes of their subtrees
+
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The value of the bytes c[0], ..., c[n-1] is
+//
+//     ( c[0] + 1 ) * k^(n-1) + ( c[1] + 1 ) * k^(n-2) + ... + ( c[n-1] + 1 )
+//
+// modulo 2^61-1, where k is derived from the seed with H. The value of the
+// concatenation of A and B is value( A ) * k^size( B ) + value( B ), so a
+// tree that keeps value() and power() == k^size() for each subtree only
+// recomputes the path from an edited leaf to the root.
+//
+// The digits are the bytes plus one, so that leading zero bytes aren't
+// lost; two distinct messages of at most n bytes collide for at most n - 1
+// of the about 2^61 values of k.
+
+template<class H> class concat_hash
+{
+private:
+
+    static constexpr std::uint64_t P = ( std::uint64_t( 1 ) << 61 ) - 1;
+
+    static constexpr std::size_t N = 8;
+
+    // k_[ i ] == k^(i+1)
+
+    std::uint64_t k_[ N ];
+
+    std::uint64_t h_ = 0;
+    std::uint64_t kn_ = 1; // k^n_
+    std::uint64_t n_ = 0;
+
+private:
+
+    // ( hi, lo ) += a * b
+
+    BOOST_FORCEINLINE static void mul_add( std::uint64_t& lo, std::uint64_t& hi, std::uint64_t a, std::uint64_t b ) noexcept
+    {
+        std::uint64_t h = 0;
+        std::uint64_t l = detail::mul128( a, b, h );
+
+        lo += l;
+        hi += h + ( lo < l );
+    }
+
+    // ( hi, lo ) mod P, for ( hi, lo ) < 2^124
+
+    BOOST_FORCEINLINE static std::uint64_t reduce( std::uint64_t lo, std::uint64_t hi ) noexcept
+    {
+        std::uint64_t x = ( lo & P ) + ( ( lo >> 61 ) | ( hi << 3 ) );
+
+        x = ( x & P ) + ( x >> 61 );
+
+        return x >= P? x - P: x;
+    }
+
+    static std::uint64_t mul( std::uint64_t a, std::uint64_t b ) noexcept
+    {
+        std::uint64_t lo = 0, hi = 0;
+        mul_add( lo, hi, a, b );
+
+        return reduce( lo, hi );
+    }
+
+    // k is the first integral result of h in [2, P)
+
+    void init( H& h )
+    {
+        std::uint64_t k = 0;
+
+        do
+        {
+            k = hash2::get_integral_result<std::uint64_t>( h.result() ) & P;
+        }
+        while( k < 2 || k == P );
+
+        k_[ 0 ] = k;
+
+        for( std::size_t i = 1; i < N; ++i )
+        {
+            k_[ i ] = mul( k_[ i - 1 ], k );
+        }
+    }
+
+    // the products of a block of eight bytes, and of h with k^8, stay
+    // below 2^123, so a block needs a single reduction
+
+    std::uint64_t block( std::uint64_t h, unsigned char const* p ) const noexcept
+    {
+        std::uint64_t lo = p[ 7 ] + 1u, hi = 0;
+
+        mul_add( lo, hi, h, k_[ 7 ] );
+        mul_add( lo, hi, p[ 0 ] + 1u, k_[ 6 ] );
+        mul_add( lo, hi, p[ 1 ] + 1u, k_[ 5 ] );
+        mul_add( lo, hi, p[ 2 ] + 1u, k_[ 4 ] );
+        mul_add( lo, hi, p[ 3 ] + 1u, k_[ 3 ] );
+        mul_add( lo, hi, p[ 4 ] + 1u, k_[ 2 ] );
+        mul_add( lo, hi, p[ 5 ] + 1u, k_[ 1 ] );
+        mul_add( lo, hi, p[ 6 ] + 1u, k_[ 0 ] );
+
+        return reduce( lo, hi );
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+
+    concat_hash()
+    {
+        H h;
+        init( h );
+    }
+
+    explicit concat_hash( std::uint64_t seed )
+    {
+        H h( seed );
+        init( h );
+    }
+
+    concat_hash( unsigned char const* p, std::size_t n )
+    {
+        H h( p, n );
+        init( h );
+    }
+
+    void update( unsigned char const* p, std::size_t n ) noexcept
+    {
+        n_ += n;
+
+        std::uint64_t h = h_;
+        std::uint64_t kn = kn_;
+
+        while( n >= N )
+        {
+            h = block( h, p );
+            kn = mul( kn, k_[ N - 1 ] );
+
+            p += N;
+            n -= N;
+        }
+
+        if( n > 0 )
+        {
+            std::uint64_t lo = p[ n - 1 ] + 1u, hi = 0;
+
+            mul_add( lo, hi, h, k_[ n - 1 ] );
+
+            for( std::size_t i = 0; i + 1 < n; ++i )
+            {
+                mul_add( lo, hi, p[ i ] + 1u, k_[ n - 2 - i ] );
+            }
+
+            h = reduce( lo, hi );
+            kn = mul( kn, k_[ n - 1 ] );
+        }
+
+        h_ = h;
+        kn_ = kn;
+    }
+
+    void update( void const* pv, std::size_t n ) noexcept
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // value(), after which the state advances
+
+    result_type result() noexcept
+    {
+        std::uint64_t r = h_;
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp[ 1 ] = { 0xFF };
+        update( tmp, 1 );
+
+        return r;
+    }
+
+    // the polynomial value of the bytes so far, in [0, 2^61-1)
+
+    std::uint64_t value() const noexcept
+    {
+        return h_;
+    }
+
+    // k^size()
+
+    std::uint64_t power() const noexcept
+    {
+        return kn_;
+    }
+
+    std::uint64_t size() const noexcept
+    {
+        return n_;
+    }
+
+    // k^n, in O(log n)
+
+    std::uint64_t power( std::uint64_t n ) const noexcept
+    {
+        std::uint64_t r = 1;
+        std::uint64_t x = k_[ 0 ];
+
+        for( ; n != 0; n >>= 1 )
+        {
+            if( n & 1 ) r = mul( r, x );
+            x = mul( x, x );
+        }
+
+        return r;
+    }
+
+    // Given value_a, the value of a message A, value_b, the value of a
+    // message B, and power_b, k^size( B ), returns the value of the
+    // concatenation of A and B. The power of the concatenation is
+    // combine( power_a, 0, power_b )
+
+    static std::uint64_t combine( std::uint64_t value_a, std::uint64_t value_b, std::uint64_t power_b ) noexcept
+    {
+        BOOST_ASSERT( value_a < P && value_b < P && power_b < P );
+
+        std::uint64_t lo = value_b, hi = 0;
+        mul_add( lo, hi, value_a, power_b );
+
+        return reduce( lo, hi );
+    }
+
+    // appends the bytes passed to x, in constant time; x must have
+    // been constructed with the same seed
+
+    void append( concat_hash const& x ) noexcept
+    {
+        BOOST_ASSERT( k_[ 0 ] == x.k_[ 0 ] );
+
+        h_ = combine( h_, x.h_, x.kn_ );
+        kn_ = mul( kn_, x.kn_ );
+        n_ += x.n_;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H> constexpr std::uint64_t concat_hash<H>::P;
+template<class H> constexpr std::size_t concat_hash<H>::N;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CONCAT_HASH_HPP_INCLUDED
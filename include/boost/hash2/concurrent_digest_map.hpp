@@ -0,0 +1,359 @@
+#ifndef BOOST_HASH2_CONCURRENT_DIGEST_MAP_HPP_INCLUDED
+#define BOOST_HASH2_CONCURRENT_DIGEST_MAP_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// concurrent_digest_map, an insert-only concurrent hash table keyed by
+// digest<N>, with lock-free lookups
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/digest_hasher.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/config.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the bytes of x equal to b, as a mask of their high bits; exact, unlike
+// the usual "has a zero byte" test, which can report false positives
+
+inline std::uint64_t match_bytes( std::uint64_t x, unsigned char b ) noexcept
+{
+    std::uint64_t const lo7 = 0x7F7F7F7F7F7F7F7Full;
+
+    x ^= 0x0101010101010101ull * b;
+    return ~( ( ( x & lo7 ) + lo7 ) | x | lo7 );
+}
+
+// the index of the lowest byte whose high bit is set in m
+
+inline unsigned lowest_byte( std::uint64_t m ) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return static_cast<unsigned>( __builtin_ctzll( m ) ) / 8;
+
+#else
+
+    unsigned i = 0;
+
+    while( ( m & 0x80 ) == 0 )
+    {
+        m >>= 8;
+        ++i;
+    }
+
+    return i;
+
+#endif
+}
+
+} // namespace detail
+
+// concurrent_digest_map<N, T, Shards>
+//
+// the table is split into Shards independent shards, each an open
+// addressing table of groups of 16 slots, probed quadratically; a group
+// has 16 one byte fingerprints, 0 for an empty slot, held in two atomic
+// words and matched eight bytes at a time
+//
+// the key and the value are written into an empty slot before its
+// fingerprint is published with a release store, and entries are never
+// removed or modified, so that find needs no locks; insertions take the
+// mutex of their shard
+//
+// the digest bits are used as the hash: the low byte selects the shard,
+// the next byte is the fingerprint, and the rest the first group
+
+template<std::size_t N, class T, std::size_t Shards = 64> class concurrent_digest_map
+{
+private:
+
+    static_assert( N >= 8, "concurrent_digest_map requires a digest of at least 8 bytes" );
+    static_assert( Shards > 0 && Shards <= 256 && ( Shards & ( Shards - 1 ) ) == 0, "Shards must be a power of two no larger than 256" );
+
+    static constexpr std::size_t G = 16;
+
+    struct entry
+    {
+        digest<N> key;
+        T value;
+    };
+
+    struct group
+    {
+        std::atomic<std::uint64_t> fp[ 2 ];
+        alignas( entry ) unsigned char slots[ G ][ sizeof( entry ) ];
+
+        entry* slot( std::size_t i ) noexcept
+        {
+            return static_cast<entry*>( static_cast<void*>( slots[ i ] ) );
+        }
+    };
+
+    // separate cache lines, so that the writers of one shard don't
+    // invalidate the lines the readers of another use
+
+    struct shard
+    {
+        unsigned char pad1_[ 64 ];
+
+        std::unique_ptr<group[]> groups;
+        std::size_t mask;
+        std::size_t limit;
+
+        std::mutex mx;
+        std::atomic<std::size_t> size;
+
+        unsigned char pad2_[ 64 ];
+    };
+
+    std::unique_ptr<shard[]> shards_;
+    std::size_t capacity_;
+
+private:
+
+    static std::uint64_t hash( digest<N> const& k ) noexcept
+    {
+        return detail::read64le( k.data() );
+    }
+
+    static unsigned char fingerprint( std::uint64_t h ) noexcept
+    {
+        unsigned char r = static_cast<unsigned char>( h >> 8 );
+        return r + ( r == 0 );
+    }
+
+    static std::size_t group_count( std::size_t capacity ) noexcept
+    {
+        // the shard sizes vary around capacity / Shards; leave some room,
+        // and keep the load below 7/8
+
+        std::size_t m = capacity / Shards;
+        m += m / 8 + G;
+
+        std::size_t n = ( m * 8 / 7 + G - 1 ) / G;
+
+        std::size_t r = 1;
+        while( r < n ) r *= 2;
+
+        return r;
+    }
+
+    // the entry for k in s, or nullptr, and the group and slot of the
+    // first empty slot on the probe sequence otherwise (for insertions);
+    // the fingerprint words are loaded with acquire, and a slot is only
+    // read after its published fingerprint has been observed
+
+    static entry* probe( shard const& s, digest<N> const& k, std::uint64_t h, group*& eg, unsigned& ei ) noexcept
+    {
+        unsigned char const fp = fingerprint( h );
+
+        std::size_t g = static_cast<std::size_t>( h >> 16 ) & s.mask;
+
+        for( std::size_t i = 0; i <= s.mask; ++i )
+        {
+            group& gr = s.groups[ g ];
+
+            for( unsigned w = 0; w < 2; ++w )
+            {
+                std::uint64_t x = gr.fp[ w ].load( std::memory_order_acquire );
+
+                for( std::uint64_t m = detail::match_bytes( x, fp ); m != 0; m &= m - 1 )
+                {
+                    entry* p = gr.slot( w * 8 + detail::lowest_byte( m ) );
+
+                    if( digest_equal()( p->key, k ) ) return p;
+                }
+
+                std::uint64_t e = detail::match_bytes( x, 0 );
+
+                if( e != 0 )
+                {
+                    // the entries are placed in the first group with an
+                    // empty slot, so k isn't in a later one
+
+                    eg = &gr;
+                    ei = w * 8 + detail::lowest_byte( e );
+
+                    return nullptr;
+                }
+            }
+
+            g = ( g + i + 1 ) & s.mask;
+        }
+
+        eg = nullptr;
+        return nullptr;
+    }
+
+public:
+
+    using key_type = digest<N>;
+    using mapped_type = T;
+
+    static constexpr std::size_t shard_count = Shards;
+
+    explicit concurrent_digest_map( std::size_t capacity ): shards_( new shard[ Shards ] ), capacity_( 0 )
+    {
+        std::size_t const n = group_count( capacity );
+
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            shard& s = shards_[ i ];
+
+            s.groups.reset( new group[ n ] );
+            s.mask = n - 1;
+            s.limit = n * G / 8 * 7;
+            s.size.store( 0, std::memory_order_relaxed );
+
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                s.groups[ j ].fp[ 0 ].store( 0, std::memory_order_relaxed );
+                s.groups[ j ].fp[ 1 ].store( 0, std::memory_order_relaxed );
+            }
+
+            capacity_ += s.limit;
+        }
+    }
+
+    concurrent_digest_map( concurrent_digest_map const& ) = delete;
+    concurrent_digest_map& operator=( concurrent_digest_map const& ) = delete;
+
+    ~concurrent_digest_map()
+    {
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            shard& s = shards_[ i ];
+
+            for( std::size_t j = 0; j <= s.mask; ++j )
+            {
+                group& gr = s.groups[ j ];
+
+                for( unsigned w = 0; w < 2; ++w )
+                {
+                    std::uint64_t x = gr.fp[ w ].load( std::memory_order_relaxed );
+
+                    for( std::uint64_t m = ~detail::match_bytes( x, 0 ) & 0x8080808080808080ull; m != 0; m &= m - 1 )
+                    {
+                        gr.slot( w * 8 + detail::lowest_byte( m ) )->~entry();
+                    }
+                }
+            }
+        }
+    }
+
+    // the number of entries that can be inserted; an insertion can fail
+    // earlier, when the shard of its key is full
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        std::size_t r = 0;
+
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            r += shards_[ i ].size.load( std::memory_order_relaxed );
+        }
+
+        return r;
+    }
+
+    // lock-free; the returned pointer remains valid for the lifetime of
+    // the map
+
+    T const* find( digest<N> const& k ) const noexcept
+    {
+        std::uint64_t h = hash( k );
+
+        group* eg;
+        unsigned ei;
+
+        entry const* p = probe( shards_[ h & ( Shards - 1 ) ], k, h, eg, ei );
+        return p? &p->value: nullptr;
+    }
+
+    bool contains( digest<N> const& k ) const noexcept
+    {
+        return find( k ) != nullptr;
+    }
+
+    void prefetch( digest<N> const& k ) const noexcept
+    {
+        std::uint64_t h = hash( k );
+        shard const& s = shards_[ h & ( Shards - 1 ) ];
+
+        detail::prefetch( &s.groups[ static_cast<std::size_t>( h >> 16 ) & s.mask ] );
+    }
+
+    // the value for k, constructed from a... if k is not present; the
+    // second member is true if it has been inserted, and the first is
+    // nullptr if k is not present and its shard is full
+
+    template<class... A> std::pair<T const*, bool> emplace( digest<N> const& k, A&&... a )
+    {
+        std::uint64_t h = hash( k );
+        shard& s = shards_[ h & ( Shards - 1 ) ];
+
+        std::lock_guard<std::mutex> lock( s.mx );
+
+        group* eg;
+        unsigned ei;
+
+        if( entry* p = probe( s, k, h, eg, ei ) )
+        {
+            return { &p->value, false };
+        }
+
+        if( eg == nullptr || s.size.load( std::memory_order_relaxed ) >= s.limit )
+        {
+            return { nullptr, false };
+        }
+
+        entry* p = ::new( static_cast<void*>( eg->slot( ei ) ) ) entry{ k, T( std::forward<A>( a )... ) };
+
+        // only this thread writes the fingerprints of the shard
+
+        std::atomic<std::uint64_t>& x = eg->fp[ ei / 8 ];
+        x.store( x.load( std::memory_order_relaxed ) | std::uint64_t( fingerprint( h ) ) << ( ei % 8 * 8 ), std::memory_order_release );
+
+        s.size.store( s.size.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+
+        return { &p->value, true };
+    }
+
+    std::pair<T const*, bool> insert( digest<N> const& k, T const& v )
+    {
+        return emplace( k, v );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<std::size_t N, class T, std::size_t Shards> constexpr std::size_t concurrent_digest_map<N, T, Shards>::shard_count;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CONCURRENT_DIGEST_MAP_HPP_INCLUDED
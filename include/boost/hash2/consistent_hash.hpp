@@ -0,0 +1,527 @@
+#ifndef BOOST_HASH2_CONSISTENT_HASH_HPP_INCLUDED
+#define BOOST_HASH2_CONSISTENT_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/has_hash_batch.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// jump_consistent_hash, Lamping and Veach, "A Fast, Minimal Memory,
+// Consistent Hash Algorithm", https://arxiv.org/abs/1406.2294
+
+inline BOOST_CXX14_CONSTEXPR int jump_consistent_hash( std::uint64_t key, int buckets ) noexcept
+{
+    BOOST_ASSERT( buckets > 0 );
+
+    std::int64_t b = -1;
+    std::int64_t j = 0;
+
+    while( j < buckets )
+    {
+        b = j;
+
+        key = key * 2862933555777941757ull + 1;
+        j = static_cast<std::int64_t>( static_cast<double>( b + 1 ) * ( static_cast<double>( std::int64_t( 1 ) << 31 ) / static_cast<double>( ( key >> 33 ) + 1 ) ) );
+    }
+
+    return static_cast<int>( b );
+}
+
+namespace detail
+{
+
+// the score of the pair ( key, node ) is the 64 bit result of h after
+// update( p, 16 ), p being the little-endian key hash followed by the
+// little-endian node hash
+
+template<class H> void rendezvous_scores( H const& h, std::uint64_t k, std::uint64_t const* w, std::size_t n, std::uint64_t* out, std::false_type )
+{
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        unsigned char buffer[ 16 ];
+
+        detail::write64le( buffer + 0, k );
+        detail::write64le( buffer + 8, w[ i ] );
+
+        H h2( h );
+        h2.update( buffer, 16 );
+
+        out[ i ] = hash2::get_integral_result<std::uint64_t>( h2.result() );
+    }
+}
+
+// the messages all have the same length, and are hashed in parallel by
+// H::hash_batch, eight at a time
+
+template<class H> void rendezvous_scores( H const& h, std::uint64_t k, std::uint64_t const* w, std::size_t n, std::uint64_t* out, std::true_type )
+{
+    unsigned char buffer[ 8 ][ 16 ];
+    unsigned char const* p[ 8 ];
+    std::size_t m[ 8 ];
+
+    for( std::size_t j = 0; j < 8; ++j )
+    {
+        detail::write64le( buffer[ j ], k );
+
+        p[ j ] = buffer[ j ];
+        m[ j ] = 16;
+    }
+
+    for( std::size_t i = 0; i < n; i += 8 )
+    {
+        std::size_t r = n - i < 8? n - i: 8;
+
+        for( std::size_t j = 0; j < r; ++j )
+        {
+            detail::write64le( buffer[ j ] + 8, w[ i + j ] );
+        }
+
+        h.hash_batch( p, m, r, out + i );
+    }
+}
+
+} // namespace detail
+
+// rendezvous_hash<N, H, Flavor>, highest random weight selection among
+// a set of nodes
+//
+// the node hashes are computed once, at construction; a selection hashes
+// the key once, then scores the ( key, node ) pairs, in batches when H
+// has a hash_batch member
+
+template<class N, class H, class Flavor = default_flavor> class rendezvous_hash
+{
+private:
+
+    // the number of scores computed on the stack at a time
+
+    static constexpr std::size_t batch_size = 64;
+
+    H h_;
+
+    std::vector<N> nodes_;
+    std::vector<std::uint64_t> w_;
+
+private:
+
+    void init()
+    {
+        w_.reserve( nodes_.size() );
+
+        for( N const& x: nodes_ )
+        {
+            w_.push_back( detail::hash_value64<H, Flavor>( h_, x ) );
+        }
+    }
+
+public:
+
+    using node_type = N;
+    using hash_type = H;
+
+    template<class It> rendezvous_hash( It first, It last ): h_(), nodes_( first, last )
+    {
+        init();
+    }
+
+    template<class It> rendezvous_hash( It first, It last, std::uint64_t seed ): h_( seed ), nodes_( first, last )
+    {
+        init();
+    }
+
+    template<class It> rendezvous_hash( It first, It last, unsigned char const* seed, std::size_t n ): h_( seed, n ), nodes_( first, last )
+    {
+        init();
+    }
+
+    std::vector<N> const& nodes() const noexcept
+    {
+        return nodes_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return nodes_.size();
+    }
+
+    // the index of the node with the highest score for v
+
+    template<class T> std::size_t select_index( T const& v ) const
+    {
+        BOOST_ASSERT( !nodes_.empty() );
+
+        std::uint64_t k = detail::hash_value64<H, Flavor>( h_, v );
+
+        std::size_t r = 0;
+        std::uint64_t s = 0;
+
+        std::uint64_t out[ batch_size ];
+
+        for( std::size_t i = 0; i < w_.size(); i += batch_size )
+        {
+            std::size_t n = w_.size() - i;
+            if( n > batch_size ) n = batch_size;
+
+            detail::rendezvous_scores( h_, k, w_.data() + i, n, out, detail::has_hash_batch<H>() );
+
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                if( ( i == 0 && j == 0 ) || out[ j ] > s )
+                {
+                    r = i + j;
+                    s = out[ j ];
+                }
+            }
+        }
+
+        return r;
+    }
+
+    template<class T> N const& select( T const& v ) const
+    {
+        return nodes_[ select_index( v ) ];
+    }
+};
+
+namespace detail
+{
+
+inline bool maglev_is_prime( std::size_t m ) noexcept
+{
+    if( m < 2 ) return false;
+
+    for( std::size_t d = 2; d * d <= m; ++d )
+    {
+        if( m % d == 0 ) return false;
+    }
+
+    return true;
+}
+
+// receives the results of hash_batch, and writes the table entries of
+// the keys to out
+
+template<std::size_t M, class OutIt> class maglev_writer
+{
+private:
+
+    std::uint32_t const* table_;
+
+public:
+
+    OutIt out;
+
+    maglev_writer( std::uint32_t const* table, OutIt o ): table_( table ), out( o )
+    {
+    }
+
+    maglev_writer& operator*() noexcept
+    {
+        return *this;
+    }
+
+    maglev_writer& operator++() noexcept
+    {
+        return *this;
+    }
+
+    maglev_writer& operator++( int ) noexcept
+    {
+        return *this;
+    }
+
+    template<class R> maglev_writer& operator=( R const& r )
+    {
+        *out++ = table_[ hash2::get_integral_result<std::uint64_t>( r ) % M ];
+        return *this;
+    }
+};
+
+} // namespace detail
+
+// maglev_table<N, H, Flavor, M>, the lookup table of Maglev hashing;
+// Eisenbud et al., "Maglev: A Fast and Reliable Software Network Load
+// Balancer", NSDI 2016
+//
+// each node has a permutation of the M entries of the table, with an
+// offset and a skip derived from the two halves of one 64 bit hash of
+// the node; the nodes, in order, take turns claiming the next entry of
+// their permutations that hasn't been claimed yet. Each node ends up
+// with M / size() entries, rounded up or down
+//
+// the offsets and skips are kept, so that a change of membership only
+// hashes the node added, before the table is filled again
+
+template<class N, class H, class Flavor = default_flavor, std::size_t M = 65537> class maglev_table
+{
+private:
+
+    static_assert( M > 1 && M < 0xFFFFFFFFu, "M must be a prime number that fits in 32 bits" );
+
+    struct permutation
+    {
+        std::uint32_t next; // the offset, at the start of a fill
+        std::uint32_t skip;
+    };
+
+    std::uint64_t seed_;
+    H h_;
+
+    std::vector<N> nodes_;
+    std::vector<permutation> p_;
+
+    // the index of the node of each entry
+
+    std::vector<std::uint32_t> table_;
+
+private:
+
+    permutation make_permutation( N const& x ) const
+    {
+        std::uint64_t const w = detail::hash_value64<H, Flavor>( h_, x );
+
+        permutation r;
+
+        r.next = static_cast<std::uint32_t>( ( w >> 32 ) % M );
+        r.skip = static_cast<std::uint32_t>( ( w & 0xFFFFFFFFu ) % ( M - 1 ) + 1 );
+
+        return r;
+    }
+
+    // the entries taken are tracked in a bitmap of M bits, which stays in
+    // the cache while the table is being written
+
+    void fill()
+    {
+        std::size_t const n = nodes_.size();
+
+        if( n == 0 )
+        {
+            table_.clear();
+            return;
+        }
+
+        BOOST_ASSERT( n < M );
+
+        table_.resize( M );
+
+        std::vector<permutation> p( p_ );
+        std::vector<std::uint64_t> taken( ( M + 63 ) / 64 );
+
+        std::size_t filled = 0;
+
+        for( ;; )
+        {
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                std::uint32_t c = p[ i ].next;
+                std::uint32_t const skip = p[ i ].skip;
+
+                while( taken[ c / 64 ] >> ( c % 64 ) & 1 )
+                {
+                    c += skip;
+                    if( c >= M ) c -= M;
+                }
+
+                taken[ c / 64 ] |= std::uint64_t( 1 ) << ( c % 64 );
+                table_[ c ] = static_cast<std::uint32_t>( i );
+
+                c += skip;
+                if( c >= M ) c -= M;
+
+                p[ i ].next = c;
+
+                if( ++filled == M ) return;
+            }
+        }
+    }
+
+    // the number of entries whose node differs from that in the old table;
+    // the nodes after the one removed, if any, have moved down by one index
+
+    std::size_t moved( std::vector<std::uint32_t> const& old, std::uint32_t removed ) const noexcept
+    {
+        if( old.size() != table_.size() ) return M;
+
+        std::size_t r = 0;
+
+        for( std::size_t c = 0; c < M; ++c )
+        {
+            std::uint32_t i = old[ c ];
+
+            if( i == removed )
+            {
+                ++r;
+                continue;
+            }
+
+            if( i > removed ) --i;
+
+            r += table_[ c ] != i;
+        }
+
+        return r;
+    }
+
+    template<class It, class OutIt> OutIt select_indices_( It first, It last, OutIt out, std::false_type ) const
+    {
+        detail::maglev_writer<M, OutIt> w( table_.data(), out );
+        return hash2::hash_batch<H, Flavor>( first, last, w, seed_ ).out;
+    }
+
+    // contiguous ranges are hashed without their size, as by hash<T>
+
+    template<class It, class OutIt> OutIt select_indices_( It first, It last, OutIt out, std::true_type ) const
+    {
+        for( ; first != last; ++first )
+        {
+            *out++ = select_index( *first );
+        }
+
+        return out;
+    }
+
+public:
+
+    using node_type = N;
+    using hash_type = H;
+
+    static constexpr std::size_t table_size = M;
+
+    explicit maglev_table( std::uint64_t seed = 0 ): seed_( seed ), h_( seed )
+    {
+        BOOST_ASSERT( detail::maglev_is_prime( M ) );
+    }
+
+    template<class It> maglev_table( It first, It last, std::uint64_t seed = 0 ): seed_( seed ), h_( seed ), nodes_( first, last )
+    {
+        BOOST_ASSERT( detail::maglev_is_prime( M ) );
+
+        p_.reserve( nodes_.size() );
+
+        for( N const& x: nodes_ )
+        {
+            p_.push_back( make_permutation( x ) );
+        }
+
+        fill();
+    }
+
+    std::vector<N> const& nodes() const noexcept
+    {
+        return nodes_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return nodes_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return nodes_.empty();
+    }
+
+    // the index of the node of each of the M entries; empty when there
+    // are no nodes
+
+    std::vector<std::uint32_t> const& table() const noexcept
+    {
+        return table_;
+    }
+
+    // adds x as the last node, and returns the number of entries whose
+    // node has changed
+
+    std::size_t insert( N const& x )
+    {
+        BOOST_ASSERT( nodes_.size() + 1 < M );
+
+        permutation const p = make_permutation( x );
+
+        nodes_.push_back( x );
+        p_.push_back( p );
+
+        std::vector<std::uint32_t> old( std::move( table_ ) );
+
+        table_.clear();
+        fill();
+
+        return moved( old, static_cast<std::uint32_t>( -1 ) );
+    }
+
+    // removes node i, and returns the number of entries whose node has
+    // changed; the nodes after it move down by one index
+
+    std::size_t erase( std::size_t i )
+    {
+        BOOST_ASSERT( i < nodes_.size() );
+
+        nodes_.erase( nodes_.begin() + i );
+        p_.erase( p_.begin() + i );
+
+        std::vector<std::uint32_t> old( std::move( table_ ) );
+
+        table_.clear();
+        fill();
+
+        return moved( old, static_cast<std::uint32_t>( i ) );
+    }
+
+    // the index of the node for v, from the entry at the 64 bit hash value
+    // of v, as hash<T, H, Flavor> computes it, modulo M
+
+    template<class T> std::size_t select_index( T const& v ) const
+    {
+        BOOST_ASSERT( !nodes_.empty() );
+        return table_[ detail::hash_value64<H, Flavor>( h_, v ) % M ];
+    }
+
+    template<class T> N const& select( T const& v ) const
+    {
+        return nodes_[ select_index( v ) ];
+    }
+
+    // stores select_index( *it ) in successive positions of out, for each
+    // it in [first, last); the keys are hashed with hash_batch, so several
+    // at a time when H has multi-lane kernels
+
+    template<class It, class OutIt> OutIt select_indices( It first, It last, OutIt out ) const
+    {
+        BOOST_ASSERT( first == last || !nodes_.empty() );
+
+        using T = typename std::iterator_traits<It>::value_type;
+        return select_indices_( first, last, out, container_hash::is_contiguous_range<T>() );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class N, class H, class Flavor, std::size_t M> constexpr std::size_t maglev_table<N, H, Flavor, M>::table_size;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CONSISTENT_HASH_HPP_INCLUDED
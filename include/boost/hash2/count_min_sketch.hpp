@@ -0,0 +1,346 @@
+#ifndef BOOST_HASH2_COUNT_MIN_SKETCH_HPP_INCLUDED
+#define BOOST_HASH2_COUNT_MIN_SKETCH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_indices.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/assert.hpp>
+#include <algorithm>
+#include <utility>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// count_min_sketch<H, D, Flavor>, a Count-Min sketch with D rows
+//
+// a value is hashed once; the D counter positions are derived from the
+// result with hash_indices
+
+template<class H, std::size_t D = 4, class Flavor = default_flavor> class count_min_sketch
+{
+private:
+
+    static_assert( D > 0, "D must be positive" );
+
+    // values are hashed and prefetched in groups of this size
+
+    static constexpr std::size_t batch_size = 8;
+
+    H h_;
+    std::size_t w_;
+    std::vector<std::uint64_t> c_;
+
+private:
+
+    template<class T> void indices( T const& v, std::size_t* p ) const
+    {
+        hash2::hash_indices<H, Flavor>( h_, v, D, w_, p );
+
+        for( std::size_t i = 0; i < D; ++i )
+        {
+            p[ i ] += i * w_;
+        }
+    }
+
+    std::uint64_t estimate_at( std::size_t const* p ) const noexcept
+    {
+        std::uint64_t r = c_[ p[ 0 ] ];
+
+        for( std::size_t i = 1; i < D; ++i )
+        {
+            r = std::min( r, c_[ p[ i ] ] );
+        }
+
+        return r;
+    }
+
+    std::uint64_t insert_at( std::size_t const* p, std::uint64_t n ) noexcept
+    {
+        std::uint64_t r = c_[ p[ 0 ] ] += n;
+
+        for( std::size_t i = 1; i < D; ++i )
+        {
+            r = std::min( r, c_[ p[ i ] ] += n );
+        }
+
+        return r;
+    }
+
+    // conservative update: a counter is only raised up to the new
+    // estimate, which reduces the overestimation
+
+    std::uint64_t insert_conservative_at( std::size_t const* p, std::uint64_t n ) noexcept
+    {
+        std::uint64_t r = estimate_at( p ) + n;
+
+        for( std::size_t i = 0; i < D; ++i )
+        {
+            c_[ p[ i ] ] = std::max( c_[ p[ i ] ], r );
+        }
+
+        return r;
+    }
+
+public:
+
+    using hash_type = H;
+
+    static constexpr std::size_t depth = D;
+
+    explicit count_min_sketch( std::size_t width ): h_(), w_( width ), c_( D * width )
+    {
+        BOOST_ASSERT( width > 0 );
+    }
+
+    count_min_sketch( std::size_t width, std::uint64_t seed ): h_( seed ), w_( width ), c_( D * width )
+    {
+        BOOST_ASSERT( width > 0 );
+    }
+
+    count_min_sketch( std::size_t width, unsigned char const* seed, std::size_t n ): h_( seed, n ), w_( width ), c_( D * width )
+    {
+        BOOST_ASSERT( width > 0 );
+    }
+
+    std::size_t width() const noexcept
+    {
+        return w_;
+    }
+
+    void clear() noexcept
+    {
+        std::fill( c_.begin(), c_.end(), std::uint64_t( 0 ) );
+    }
+
+    // these return the estimate of v after the update
+
+    template<class T> std::uint64_t insert( T const& v, std::uint64_t n = 1 )
+    {
+        std::size_t p[ D ];
+        indices( v, p );
+
+        return insert_at( p, n );
+    }
+
+    template<class T> std::uint64_t insert_conservative( T const& v, std::uint64_t n = 1 )
+    {
+        std::size_t p[ D ];
+        indices( v, p );
+
+        return insert_conservative_at( p, n );
+    }
+
+    template<class T> std::uint64_t estimate( T const& v ) const
+    {
+        std::size_t p[ D ];
+        indices( v, p );
+
+        return estimate_at( p );
+    }
+
+    // the batch operations hash a group of values and prefetch their
+    // counters before accessing them; It must be dereferenceable, so
+    // that insert( 5, 2 ) is a single insert
+
+    template<class It, class = decltype( *std::declval<It const&>() )> void insert( It first, It last )
+    {
+        std::size_t p[ batch_size ][ D ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < batch_size && first != last; ++n, ++first )
+            {
+                indices( *first, p[ n ] );
+
+                for( std::size_t i = 0; i < D; ++i )
+                {
+                    detail::prefetch( &c_[ p[ n ][ i ] ] );
+                }
+            }
+
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                insert_at( p[ j ], 1 );
+            }
+        }
+    }
+
+    template<class It, class = decltype( *std::declval<It const&>() )> void insert_conservative( It first, It last )
+    {
+        std::size_t p[ batch_size ][ D ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < batch_size && first != last; ++n, ++first )
+            {
+                indices( *first, p[ n ] );
+
+                for( std::size_t i = 0; i < D; ++i )
+                {
+                    detail::prefetch( &c_[ p[ n ][ i ] ] );
+                }
+            }
+
+            for( std::size_t j = 0; j < n; ++j )
+            {
+                insert_conservative_at( p[ j ], 1 );
+            }
+        }
+    }
+
+    // r must have the same width and seed; conservative updates
+    // can't be merged exactly, the result is an overestimate
+
+    void merge( count_min_sketch const& r )
+    {
+        BOOST_ASSERT( w_ == r.w_ );
+
+        for( std::size_t i = 0; i < c_.size(); ++i )
+        {
+            c_[ i ] += r.c_[ i ];
+        }
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, std::size_t D, class Flavor> constexpr std::size_t count_min_sketch<H, D, Flavor>::depth;
+
+#endif
+
+// heavy_hitters<T, H, D, Flavor>, the k values with the highest counts,
+// approximately, tracked with a conservatively updated count_min_sketch
+//
+// the candidates are only searched when the estimate of the inserted
+// value reaches the smallest candidate count, so most inserts cost a
+// single hash and D counter updates
+
+template<class T, class H, std::size_t D = 4, class Flavor = default_flavor> class heavy_hitters
+{
+private:
+
+    count_min_sketch<H, D, Flavor> s_;
+
+    std::size_t k_;
+    std::vector< std::pair<T, std::uint64_t> > top_;
+
+    // the position of the smallest count in top_
+
+    std::size_t min_ = 0;
+
+private:
+
+    void update_min() noexcept
+    {
+        min_ = 0;
+
+        for( std::size_t i = 1; i < top_.size(); ++i )
+        {
+            if( top_[ i ].second < top_[ min_ ].second ) min_ = i;
+        }
+    }
+
+public:
+
+    using value_type = T;
+
+    heavy_hitters( std::size_t k, std::size_t width ): s_( width ), k_( k )
+    {
+        top_.reserve( k );
+    }
+
+    heavy_hitters( std::size_t k, std::size_t width, std::uint64_t seed ): s_( width, seed ), k_( k )
+    {
+        top_.reserve( k );
+    }
+
+    heavy_hitters( std::size_t k, std::size_t width, unsigned char const* seed, std::size_t n ): s_( width, seed, n ), k_( k )
+    {
+        top_.reserve( k );
+    }
+
+    void insert( T const& v, std::uint64_t n = 1 )
+    {
+        std::uint64_t e = s_.insert_conservative( v, n );
+
+        if( k_ == 0 ) return;
+
+        if( top_.size() == k_ && e <= top_[ min_ ].second ) return;
+
+        for( std::size_t i = 0; i < top_.size(); ++i )
+        {
+            if( top_[ i ].first == v )
+            {
+                top_[ i ].second = e;
+
+                if( i == min_ ) update_min();
+                return;
+            }
+        }
+
+        if( top_.size() < k_ )
+        {
+            top_.emplace_back( v, e );
+        }
+        else
+        {
+            top_[ min_ ] = std::make_pair( v, e );
+        }
+
+        update_min();
+    }
+
+    template<class It, class = decltype( *std::declval<It const&>() )> void insert( It first, It last )
+    {
+        for( ; first != last; ++first )
+        {
+            insert( *first );
+        }
+    }
+
+    std::uint64_t estimate( T const& v ) const
+    {
+        return s_.estimate( v );
+    }
+
+    // the candidates, by decreasing estimated count
+
+    std::vector< std::pair<T, std::uint64_t> > top() const
+    {
+        std::vector< std::pair<T, std::uint64_t> > r( top_ );
+
+        std::stable_sort( r.begin(), r.end(), []( std::pair<T, std::uint64_t> const& a, std::pair<T, std::uint64_t> const& b ){ return a.second > b.second; } );
+
+        return r;
+    }
+
+    count_min_sketch<H, D, Flavor> const& sketch() const noexcept
+    {
+        return s_;
+    }
+
+    void clear() noexcept
+    {
+        s_.clear();
+        top_.clear();
+        min_ = 0;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_COUNT_MIN_SKETCH_HPP_INCLUDED
@@ -0,0 +1,161 @@
+#ifndef BOOST_HASH2_COUNTING_HASH_HPP_INCLUDED
+#define BOOST_HASH2_COUNTING_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// counting_hash<H>, records the update calls made to H
+
+#include <boost/hash2/detail/has_update_word.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// exposes H::block_size, when present
+
+template<class H, class En = void> struct counting_hash_base
+{
+};
+
+template<class H> struct counting_hash_base<H, decltype( (void)H::block_size )>
+{
+    static constexpr int block_size = H::block_size;
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H> constexpr int counting_hash_base<H, decltype( (void)H::block_size )>::block_size;
+
+#endif
+
+// the number of significant bits in n; 0 for n == 0
+
+BOOST_CXX14_CONSTEXPR int bit_width( std::uint64_t n )
+{
+    int r = 0;
+
+    while( n != 0 )
+    {
+        ++r;
+        n >>= 1;
+    }
+
+    return r;
+}
+
+} // namespace detail
+
+struct update_counts
+{
+    // the number of calls to update, update_word included
+    std::uint64_t update_calls = 0;
+
+    // the number of calls to update_word
+    std::uint64_t update_word_calls = 0;
+
+    // the total number of bytes passed to update and update_word
+    std::uint64_t bytes = 0;
+
+    // the number of calls to result
+    std::uint64_t result_calls = 0;
+
+    // size_histogram[ 0 ] is the number of update calls with n == 0,
+    // size_histogram[ k ] the number of those with 2^(k-1) <= n < 2^k
+    std::uint64_t size_histogram[ 65 ] = {};
+};
+
+template<class H> class counting_hash: public detail::counting_hash_base<H>
+{
+private:
+
+    H h_;
+    update_counts counts_;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void count( std::size_t n )
+    {
+        ++counts_.update_calls;
+        counts_.bytes += n;
+
+        ++counts_.size_histogram[ detail::bit_width( n ) ];
+    }
+
+public:
+
+    using result_type = typename H::result_type;
+
+    counting_hash() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit counting_hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR counting_hash( unsigned char const * p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        count( n );
+        h_.update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // only present when H::update_word is, so that hash_append makes
+    // the same calls as it would with H
+
+    template<class H2 = H>
+    BOOST_CXX14_CONSTEXPR typename std::enable_if<detail::has_update_word<H2>::value>::type update_word( std::uint64_t w )
+    {
+        count( 8 );
+        ++counts_.update_word_calls;
+
+        h_.update_word( w );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        ++counts_.result_calls;
+        return h_.result();
+    }
+
+    // the recorded calls
+
+    BOOST_CXX14_CONSTEXPR update_counts const& counts() const noexcept
+    {
+        return counts_;
+    }
+
+    BOOST_CXX14_CONSTEXPR void reset_counts() noexcept
+    {
+        counts_ = update_counts();
+    }
+
+    // the wrapped hash algorithm
+
+    BOOST_CXX14_CONSTEXPR H const& hasher() const noexcept
+    {
+        return h_;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_COUNTING_HASH_HPP_INCLUDED
@@ -0,0 +1,363 @@
+#ifndef BOOST_HASH2_CRC32C_HPP_INCLUDED
+#define BOOST_HASH2_CRC32C_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// CRC-32C (Castagnoli), https://datatracker.ietf.org/doc/html/rfc3720#appendix-B.4
+
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/crc32c_x86.hpp>
+#include <boost/hash2/detail/crc32c_arm.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/numa.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class = void>
+struct crc32c_constants
+{
+    // the reflected polynomial, 0x1EDC6F41 with the bit order reversed
+
+    static constexpr std::uint32_t P = 0x82f63b78;
+
+    constexpr static std::uint32_t const table[ 256 ] =
+    {
+        0x00000000, 0xf26b8303, 0xe13b70f7, 0x1350f3f4, 0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+        0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b, 0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+        0x105ec76f, 0xe235446c, 0xf165b798, 0x030e349b, 0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+        0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54, 0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+        0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a, 0xe72719c1, 0x154c9ac2, 0x061c6936, 0xf477ea35,
+        0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5, 0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+        0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45, 0xf779deae, 0x05125dad, 0x1642ae59, 0xe4292d5a,
+        0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a, 0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+        0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48, 0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+        0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687, 0x0c38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+        0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927, 0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+        0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8, 0x1c661503, 0xee0d9600, 0xfd5d65f4, 0x0f36e6f7,
+        0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096, 0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+        0xeb1fcbad, 0x197448ae, 0x0a24bb5a, 0xf84f3859, 0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+        0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9, 0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+        0xfb410cc2, 0x092a8fc1, 0x1a7a7c35, 0xe811ff36, 0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+        0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c, 0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+        0x082f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043, 0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+        0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3, 0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+        0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0x0b21572c, 0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+        0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652, 0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+        0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d, 0xef087a76, 0x1d63f975, 0x0e330a81, 0xfc588982,
+        0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d, 0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+        0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2, 0xff56bd19, 0x0d3d3e1a, 0x1e6dcdee, 0xec064eed,
+        0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530, 0x0417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+        0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff, 0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+        0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f, 0x144976b4, 0xe622f5b7, 0xf5720643, 0x07198540,
+        0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90, 0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+        0xe330a81a, 0x115b2b19, 0x020bd8ed, 0xf0605bee, 0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+        0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321, 0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+        0xf36e6f75, 0x0105ec76, 0x12551f82, 0xe03e9c81, 0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+        0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e, 0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr std::uint32_t crc32c_constants<T>::P;
+
+template<class T>
+constexpr std::uint32_t crc32c_constants<T>::table[ 256 ];
+
+#endif
+
+// a * b mod P, in the reflected representation, where 0x80000000 is x^0
+
+inline BOOST_CXX14_CONSTEXPR std::uint32_t crc32c_multiply( std::uint32_t a, std::uint32_t b )
+{
+    std::uint32_t r = 0;
+
+    for( std::uint32_t m = 0x80000000u; m != 0; m >>= 1 )
+    {
+        if( a & m )
+        {
+            r ^= b;
+        }
+
+        b = ( b & 1 )? ( b >> 1 ) ^ crc32c_constants<>::P: b >> 1;
+    }
+
+    return r;
+}
+
+// x^(8n) mod P
+
+inline BOOST_CXX14_CONSTEXPR std::uint32_t crc32c_shift( std::uint64_t n )
+{
+    std::uint32_t r = 0x80000000u; // x^0
+    std::uint32_t q = 0x00800000u; // x^8
+
+    while( n != 0 )
+    {
+        if( n & 1 )
+        {
+            r = crc32c_multiply( q, r );
+        }
+
+        q = crc32c_multiply( q, q );
+        n >>= 1;
+    }
+
+    return r;
+}
+
+} // namespace detail
+
+class crc32c
+{
+private:
+
+    std::uint32_t st_ = 0xFFFFFFFFu;
+
+public:
+
+    typedef std::uint32_t result_type;
+
+    constexpr crc32c() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit crc32c( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR crc32c( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( crc32c, "crc32c", n );
+
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_sse42() )
+        {
+            if( detail::has_x86_sse42_pclmul() )
+            {
+                st_ = detail::crc32c_update_pclmul( st_, p, n );
+            }
+            else
+            {
+                st_ = detail::crc32c_update_sse42( st_, p, n );
+            }
+
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_CRC32_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+#if defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)
+
+            st_ = detail::crc32c_update_arm_pmull( st_, p, n );
+
+#else
+
+            st_ = detail::crc32c_update_arm( st_, p, n );
+
+#endif
+
+            return;
+        }
+
+#endif
+
+        std::uint32_t c = st_;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            c = ( c >> 8 ) ^ detail::crc32c_constants<>::table[ ( c ^ p[ i ] ) & 0xFF ];
+        }
+
+        st_ = c;
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // same as update( p, n ) with n zero bytes, in O(log n)
+
+    BOOST_CXX14_CONSTEXPR void update_zeros( std::uint64_t n )
+    {
+        st_ = detail::crc32c_multiply( detail::crc32c_shift( n ), st_ );
+    }
+
+private:
+
+    static std::uint32_t segment( unsigned char const* p, std::size_t n )
+    {
+        // runs on the threads of the executor, and is counted as a part
+        // of the update_parallel call
+
+        BOOST_HASH2_STATS_SUSPEND();
+
+        crc32c h;
+        h.update( p, n );
+
+        std::uint32_t r = h.result();
+
+        BOOST_HASH2_STATS_RESUME();
+
+        return r;
+    }
+
+public:
+
+    // same as update, but checksums large inputs in segments on up to
+    // `threads` threads, and merges the segment CRCs with combine;
+    // threads == 0 means std::thread::hardware_concurrency()
+
+    void update_parallel( void const* pv, std::size_t n, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        update_parallel( pv, n, ex );
+    }
+
+    // same, but runs the segments on ex
+
+    void update_parallel( void const* pv, std::size_t n, task_executor& ex )
+    {
+        BOOST_HASH2_STATS_UPDATE( crc32c, "crc32c", n );
+
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        // below 1 MiB per segment, running a task costs more than it saves
+
+        std::size_t const min_segment = 1024 * 1024;
+
+        unsigned const parts = detail::parallel_parts( ex, n, min_segment );
+
+        if( parts > 1 )
+        {
+            std::size_t const k = n / parts;
+
+            std::vector<std::uint32_t> crcs( parts, 0 );
+
+            hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+                std::size_t const m = t + 1 < parts? k: n - t * k;
+
+                detail::numa_bind_worker( p + t * k );
+                crcs[ t ] = segment( p + t * k, m );
+            });
+
+            std::uint32_t c = ~st_;
+
+            for( unsigned i = 0; i < parts; ++i )
+            {
+                std::size_t const m = i + 1 < parts? k: n - i * k;
+                c = combine( c, crcs[ i ], m );
+            }
+
+            st_ = ~c;
+            return;
+        }
+
+        BOOST_HASH2_STATS_SUSPEND();
+        update( p, n );
+        BOOST_HASH2_STATS_RESUME();
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint32_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( crc32c, "crc32c" );
+
+        std::uint32_t r = ~st_;
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        st_ = ( st_ >> 8 ) ^ detail::crc32c_constants<>::table[ ( st_ ^ 0xFF ) & 0xFF ];
+
+        return r;
+    }
+
+    // Given crc_a, the CRC of a message A, and crc_b, the CRC of a message B
+    // of length len_b, returns the CRC of the concatenation of A and B
+
+    static BOOST_CXX14_CONSTEXPR std::uint32_t combine( std::uint32_t crc_a, std::uint32_t crc_b, std::uint64_t len_b )
+    {
+        return detail::crc32c_multiply( detail::crc32c_shift( len_b ), crc_a ) ^ crc_b;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u32( self.st_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 5;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        crc32c tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CRC32C_HPP_INCLUDED
@@ -0,0 +1,280 @@
+#ifndef BOOST_HASH2_CRC64_HPP_INCLUDED
+#define BOOST_HASH2_CRC64_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// CRC-64/XZ, with the ECMA-182 polynomial, used by xz
+// CRC-64/NVME, the NVM Express end-to-end data protection CRC
+
+#include <boost/hash2/detail/crc_reflected.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class = void>
+struct crc64_xz_constants
+{
+    // the reflected ECMA-182 polynomial, 0x42F0E1EBA9EA3693 with the bit order reversed
+
+    static constexpr std::uint64_t P = 0xc96c5795d7870f42ull;
+
+    // the name of the algorithm in the usage statistics
+
+    static constexpr char const* name()
+    {
+        return "crc64_xz";
+    }
+
+    constexpr static std::uint64_t const table[ 256 ] =
+    {
+        0x0000000000000000ull, 0xb32e4cbe03a75f6full, 0xf4843657a840a05bull, 0x47aa7ae9abe7ff34ull,
+        0x7bd0c384ff8f5e33ull, 0xc8fe8f3afc28015cull, 0x8f54f5d357cffe68ull, 0x3c7ab96d5468a107ull,
+        0xf7a18709ff1ebc66ull, 0x448fcbb7fcb9e309ull, 0x0325b15e575e1c3dull, 0xb00bfde054f94352ull,
+        0x8c71448d0091e255ull, 0x3f5f08330336bd3aull, 0x78f572daa8d1420eull, 0xcbdb3e64ab761d61ull,
+        0x7d9ba13851336649ull, 0xceb5ed8652943926ull, 0x891f976ff973c612ull, 0x3a31dbd1fad4997dull,
+        0x064b62bcaebc387aull, 0xb5652e02ad1b6715ull, 0xf2cf54eb06fc9821ull, 0x41e11855055bc74eull,
+        0x8a3a2631ae2dda2full, 0x39146a8fad8a8540ull, 0x7ebe1066066d7a74ull, 0xcd905cd805ca251bull,
+        0xf1eae5b551a2841cull, 0x42c4a90b5205db73ull, 0x056ed3e2f9e22447ull, 0xb6409f5cfa457b28ull,
+        0xfb374270a266cc92ull, 0x48190ecea1c193fdull, 0x0fb374270a266cc9ull, 0xbc9d3899098133a6ull,
+        0x80e781f45de992a1ull, 0x33c9cd4a5e4ecdceull, 0x7463b7a3f5a932faull, 0xc74dfb1df60e6d95ull,
+        0x0c96c5795d7870f4ull, 0xbfb889c75edf2f9bull, 0xf812f32ef538d0afull, 0x4b3cbf90f69f8fc0ull,
+        0x774606fda2f72ec7ull, 0xc4684a43a15071a8ull, 0x83c230aa0ab78e9cull, 0x30ec7c140910d1f3ull,
+        0x86ace348f355aadbull, 0x3582aff6f0f2f5b4ull, 0x7228d51f5b150a80ull, 0xc10699a158b255efull,
+        0xfd7c20cc0cdaf4e8ull, 0x4e526c720f7dab87ull, 0x09f8169ba49a54b3ull, 0xbad65a25a73d0bdcull,
+        0x710d64410c4b16bdull, 0xc22328ff0fec49d2ull, 0x85895216a40bb6e6ull, 0x36a71ea8a7ace989ull,
+        0x0adda7c5f3c4488eull, 0xb9f3eb7bf06317e1ull, 0xfe5991925b84e8d5ull, 0x4d77dd2c5823b7baull,
+        0x64b62bcaebc387a1ull, 0xd7986774e864d8ceull, 0x90321d9d438327faull, 0x231c512340247895ull,
+        0x1f66e84e144cd992ull, 0xac48a4f017eb86fdull, 0xebe2de19bc0c79c9ull, 0x58cc92a7bfab26a6ull,
+        0x9317acc314dd3bc7ull, 0x2039e07d177a64a8ull, 0x67939a94bc9d9b9cull, 0xd4bdd62abf3ac4f3ull,
+        0xe8c76f47eb5265f4ull, 0x5be923f9e8f53a9bull, 0x1c4359104312c5afull, 0xaf6d15ae40b59ac0ull,
+        0x192d8af2baf0e1e8ull, 0xaa03c64cb957be87ull, 0xeda9bca512b041b3ull, 0x5e87f01b11171edcull,
+        0x62fd4976457fbfdbull, 0xd1d305c846d8e0b4ull, 0x96797f21ed3f1f80ull, 0x2557339fee9840efull,
+        0xee8c0dfb45ee5d8eull, 0x5da24145464902e1ull, 0x1a083bacedaefdd5ull, 0xa9267712ee09a2baull,
+        0x955cce7fba6103bdull, 0x267282c1b9c65cd2ull, 0x61d8f8281221a3e6ull, 0xd2f6b4961186fc89ull,
+        0x9f8169ba49a54b33ull, 0x2caf25044a02145cull, 0x6b055fede1e5eb68ull, 0xd82b1353e242b407ull,
+        0xe451aa3eb62a1500ull, 0x577fe680b58d4a6full, 0x10d59c691e6ab55bull, 0xa3fbd0d71dcdea34ull,
+        0x6820eeb3b6bbf755ull, 0xdb0ea20db51ca83aull, 0x9ca4d8e41efb570eull, 0x2f8a945a1d5c0861ull,
+        0x13f02d374934a966ull, 0xa0de61894a93f609ull, 0xe7741b60e174093dull, 0x545a57dee2d35652ull,
+        0xe21ac88218962d7aull, 0x5134843c1b317215ull, 0x169efed5b0d68d21ull, 0xa5b0b26bb371d24eull,
+        0x99ca0b06e7197349ull, 0x2ae447b8e4be2c26ull, 0x6d4e3d514f59d312ull, 0xde6071ef4cfe8c7dull,
+        0x15bb4f8be788911cull, 0xa6950335e42fce73ull, 0xe13f79dc4fc83147ull, 0x521135624c6f6e28ull,
+        0x6e6b8c0f1807cf2full, 0xdd45c0b11ba09040ull, 0x9aefba58b0476f74ull, 0x29c1f6e6b3e0301bull,
+        0xc96c5795d7870f42ull, 0x7a421b2bd420502dull, 0x3de861c27fc7af19ull, 0x8ec62d7c7c60f076ull,
+        0xb2bc941128085171ull, 0x0192d8af2baf0e1eull, 0x4638a2468048f12aull, 0xf516eef883efae45ull,
+        0x3ecdd09c2899b324ull, 0x8de39c222b3eec4bull, 0xca49e6cb80d9137full, 0x7967aa75837e4c10ull,
+        0x451d1318d716ed17ull, 0xf6335fa6d4b1b278ull, 0xb199254f7f564d4cull, 0x02b769f17cf11223ull,
+        0xb4f7f6ad86b4690bull, 0x07d9ba1385133664ull, 0x4073c0fa2ef4c950ull, 0xf35d8c442d53963full,
+        0xcf273529793b3738ull, 0x7c0979977a9c6857ull, 0x3ba3037ed17b9763ull, 0x888d4fc0d2dcc80cull,
+        0x435671a479aad56dull, 0xf0783d1a7a0d8a02ull, 0xb7d247f3d1ea7536ull, 0x04fc0b4dd24d2a59ull,
+        0x3886b22086258b5eull, 0x8ba8fe9e8582d431ull, 0xcc0284772e652b05ull, 0x7f2cc8c92dc2746aull,
+        0x325b15e575e1c3d0ull, 0x8175595b76469cbfull, 0xc6df23b2dda1638bull, 0x75f16f0cde063ce4ull,
+        0x498bd6618a6e9de3ull, 0xfaa59adf89c9c28cull, 0xbd0fe036222e3db8ull, 0x0e21ac88218962d7ull,
+        0xc5fa92ec8aff7fb6ull, 0x76d4de52895820d9ull, 0x317ea4bb22bfdfedull, 0x8250e80521188082ull,
+        0xbe2a516875702185ull, 0x0d041dd676d77eeaull, 0x4aae673fdd3081deull, 0xf9802b81de97deb1ull,
+        0x4fc0b4dd24d2a599ull, 0xfceef8632775faf6ull, 0xbb44828a8c9205c2ull, 0x086ace348f355aadull,
+        0x34107759db5dfbaaull, 0x873e3be7d8faa4c5ull, 0xc094410e731d5bf1ull, 0x73ba0db070ba049eull,
+        0xb86133d4dbcc19ffull, 0x0b4f7f6ad86b4690ull, 0x4ce50583738cb9a4ull, 0xffcb493d702be6cbull,
+        0xc3b1f050244347ccull, 0x709fbcee27e418a3ull, 0x3735c6078c03e797ull, 0x841b8ab98fa4b8f8ull,
+        0xadda7c5f3c4488e3ull, 0x1ef430e13fe3d78cull, 0x595e4a08940428b8ull, 0xea7006b697a377d7ull,
+        0xd60abfdbc3cbd6d0ull, 0x6524f365c06c89bfull, 0x228e898c6b8b768bull, 0x91a0c532682c29e4ull,
+        0x5a7bfb56c35a3485ull, 0xe955b7e8c0fd6beaull, 0xaeffcd016b1a94deull, 0x1dd181bf68bdcbb1ull,
+        0x21ab38d23cd56ab6ull, 0x9285746c3f7235d9ull, 0xd52f0e859495caedull, 0x6601423b97329582ull,
+        0xd041dd676d77eeaaull, 0x636f91d96ed0b1c5ull, 0x24c5eb30c5374ef1ull, 0x97eba78ec690119eull,
+        0xab911ee392f8b099ull, 0x18bf525d915feff6ull, 0x5f1528b43ab810c2ull, 0xec3b640a391f4fadull,
+        0x27e05a6e926952ccull, 0x94ce16d091ce0da3ull, 0xd3646c393a29f297ull, 0x604a2087398eadf8ull,
+        0x5c3099ea6de60cffull, 0xef1ed5546e415390ull, 0xa8b4afbdc5a6aca4ull, 0x1b9ae303c601f3cbull,
+        0x56ed3e2f9e224471ull, 0xe5c372919d851b1eull, 0xa26908783662e42aull, 0x114744c635c5bb45ull,
+        0x2d3dfdab61ad1a42ull, 0x9e13b115620a452dull, 0xd9b9cbfcc9edba19ull, 0x6a978742ca4ae576ull,
+        0xa14cb926613cf817ull, 0x1262f598629ba778ull, 0x55c88f71c97c584cull, 0xe6e6c3cfcadb0723ull,
+        0xda9c7aa29eb3a624ull, 0x69b2361c9d14f94bull, 0x2e184cf536f3067full, 0x9d36004b35545910ull,
+        0x2b769f17cf112238ull, 0x9858d3a9ccb67d57ull, 0xdff2a94067518263ull, 0x6cdce5fe64f6dd0cull,
+        0x50a65c93309e7c0bull, 0xe388102d33392364ull, 0xa4226ac498dedc50ull, 0x170c267a9b79833full,
+        0xdcd7181e300f9e5eull, 0x6ff954a033a8c131ull, 0x28532e49984f3e05ull, 0x9b7d62f79be8616aull,
+        0xa707db9acf80c06dull, 0x14299724cc279f02ull, 0x5383edcd67c06036ull, 0xe0ada17364673f59ull,
+    };
+
+    // see crc_clmul_x86.hpp
+
+    constexpr static std::uint64_t const clmul[ 13 ] =
+    {
+        0x8260adf2381ad81cull, 0xf31fd9271e228b79ull,
+        0x6ae3efbb9dd441f3ull, 0x081f6054a7842df4ull,
+        0xb5ea1af9c013aca4ull, 0x69a35d91c3730254ull,
+        0x60095b008a9efa44ull, 0x3be653a30fe1af51ull,
+        0xe05dd497ca393ae4ull, 0xdabe95afc7875f40ull,
+        0xdabe95afc7875f40ull, 0x4e1f23360b94b1eaull,
+        0xc96c5795d7870f42ull,
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr std::uint64_t crc64_xz_constants<T>::P;
+
+template<class T>
+constexpr std::uint64_t crc64_xz_constants<T>::table[ 256 ];
+
+template<class T>
+constexpr std::uint64_t crc64_xz_constants<T>::clmul[ 13 ];
+
+#endif
+
+template<class = void>
+struct crc64_nvme_constants
+{
+    // the reflected NVMe polynomial, 0xAD93D23594C93659 with the bit order reversed
+
+    static constexpr std::uint64_t P = 0x9a6c9329ac4bc9b5ull;
+
+    // the name of the algorithm in the usage statistics
+
+    static constexpr char const* name()
+    {
+        return "crc64_nvme";
+    }
+
+    constexpr static std::uint64_t const table[ 256 ] =
+    {
+        0x0000000000000000ull, 0x7f6ef0c830358979ull, 0xfedde190606b12f2ull, 0x81b31158505e9b8bull,
+        0xc962e5739841b68full, 0xb60c15bba8743ff6ull, 0x37bf04e3f82aa47dull, 0x48d1f42bc81f2d04ull,
+        0xa61cecb46814fe75ull, 0xd9721c7c5821770cull, 0x58c10d24087fec87ull, 0x27affdec384a65feull,
+        0x6f7e09c7f05548faull, 0x1010f90fc060c183ull, 0x91a3e857903e5a08ull, 0xeecd189fa00bd371ull,
+        0x78e0ff3b88be6f81ull, 0x078e0ff3b88be6f8ull, 0x863d1eabe8d57d73ull, 0xf953ee63d8e0f40aull,
+        0xb1821a4810ffd90eull, 0xceecea8020ca5077ull, 0x4f5ffbd87094cbfcull, 0x30310b1040a14285ull,
+        0xdefc138fe0aa91f4ull, 0xa192e347d09f188dull, 0x2021f21f80c18306ull, 0x5f4f02d7b0f40a7full,
+        0x179ef6fc78eb277bull, 0x68f0063448deae02ull, 0xe943176c18803589ull, 0x962de7a428b5bcf0ull,
+        0xf1c1fe77117cdf02ull, 0x8eaf0ebf2149567bull, 0x0f1c1fe77117cdf0ull, 0x7072ef2f41224489ull,
+        0x38a31b04893d698dull, 0x47cdebccb908e0f4ull, 0xc67efa94e9567b7full, 0xb9100a5cd963f206ull,
+        0x57dd12c379682177ull, 0x28b3e20b495da80eull, 0xa900f35319033385ull, 0xd66e039b2936bafcull,
+        0x9ebff7b0e12997f8ull, 0xe1d10778d11c1e81ull, 0x606216208142850aull, 0x1f0ce6e8b1770c73ull,
+        0x8921014c99c2b083ull, 0xf64ff184a9f739faull, 0x77fce0dcf9a9a271ull, 0x08921014c99c2b08ull,
+        0x4043e43f0183060cull, 0x3f2d14f731b68f75ull, 0xbe9e05af61e814feull, 0xc1f0f56751dd9d87ull,
+        0x2f3dedf8f1d64ef6ull, 0x50531d30c1e3c78full, 0xd1e00c6891bd5c04ull, 0xae8efca0a188d57dull,
+        0xe65f088b6997f879ull, 0x9931f84359a27100ull, 0x1882e91b09fcea8bull, 0x67ec19d339c963f2ull,
+        0xd75adabd7a6e2d6full, 0xa8342a754a5ba416ull, 0x29873b2d1a053f9dull, 0x56e9cbe52a30b6e4ull,
+        0x1e383fcee22f9be0ull, 0x6156cf06d21a1299ull, 0xe0e5de5e82448912ull, 0x9f8b2e96b271006bull,
+        0x71463609127ad31aull, 0x0e28c6c1224f5a63ull, 0x8f9bd7997211c1e8ull, 0xf0f5275142244891ull,
+        0xb824d37a8a3b6595ull, 0xc74a23b2ba0eececull, 0x46f932eaea507767ull, 0x3997c222da65fe1eull,
+        0xafba2586f2d042eeull, 0xd0d4d54ec2e5cb97ull, 0x5167c41692bb501cull, 0x2e0934dea28ed965ull,
+        0x66d8c0f56a91f461ull, 0x19b6303d5aa47d18ull, 0x980521650afae693ull, 0xe76bd1ad3acf6feaull,
+        0x09a6c9329ac4bc9bull, 0x76c839faaaf135e2ull, 0xf77b28a2faafae69ull, 0x8815d86aca9a2710ull,
+        0xc0c42c4102850a14ull, 0xbfaadc8932b0836dull, 0x3e19cdd162ee18e6ull, 0x41773d1952db919full,
+        0x269b24ca6b12f26dull, 0x59f5d4025b277b14ull, 0xd846c55a0b79e09full, 0xa72835923b4c69e6ull,
+        0xeff9c1b9f35344e2ull, 0x90973171c366cd9bull, 0x1124202993385610ull, 0x6e4ad0e1a30ddf69ull,
+        0x8087c87e03060c18ull, 0xffe938b633338561ull, 0x7e5a29ee636d1eeaull, 0x0134d92653589793ull,
+        0x49e52d0d9b47ba97ull, 0x368bddc5ab7233eeull, 0xb738cc9dfb2ca865ull, 0xc8563c55cb19211cull,
+        0x5e7bdbf1e3ac9decull, 0x21152b39d3991495ull, 0xa0a63a6183c78f1eull, 0xdfc8caa9b3f20667ull,
+        0x97193e827bed2b63ull, 0xe877ce4a4bd8a21aull, 0x69c4df121b863991ull, 0x16aa2fda2bb3b0e8ull,
+        0xf86737458bb86399ull, 0x8709c78dbb8deae0ull, 0x06bad6d5ebd3716bull, 0x79d4261ddbe6f812ull,
+        0x3105d23613f9d516ull, 0x4e6b22fe23cc5c6full, 0xcfd833a67392c7e4ull, 0xb0b6c36e43a74e9dull,
+        0x9a6c9329ac4bc9b5ull, 0xe50263e19c7e40ccull, 0x64b172b9cc20db47ull, 0x1bdf8271fc15523eull,
+        0x530e765a340a7f3aull, 0x2c608692043ff643ull, 0xadd397ca54616dc8ull, 0xd2bd67026454e4b1ull,
+        0x3c707f9dc45f37c0ull, 0x431e8f55f46abeb9ull, 0xc2ad9e0da4342532ull, 0xbdc36ec59401ac4bull,
+        0xf5129aee5c1e814full, 0x8a7c6a266c2b0836ull, 0x0bcf7b7e3c7593bdull, 0x74a18bb60c401ac4ull,
+        0xe28c6c1224f5a634ull, 0x9de29cda14c02f4dull, 0x1c518d82449eb4c6ull, 0x633f7d4a74ab3dbfull,
+        0x2bee8961bcb410bbull, 0x548079a98c8199c2ull, 0xd53368f1dcdf0249ull, 0xaa5d9839ecea8b30ull,
+        0x449080a64ce15841ull, 0x3bfe706e7cd4d138ull, 0xba4d61362c8a4ab3ull, 0xc52391fe1cbfc3caull,
+        0x8df265d5d4a0eeceull, 0xf29c951de49567b7ull, 0x732f8445b4cbfc3cull, 0x0c41748d84fe7545ull,
+        0x6bad6d5ebd3716b7ull, 0x14c39d968d029fceull, 0x95708ccedd5c0445ull, 0xea1e7c06ed698d3cull,
+        0xa2cf882d2576a038ull, 0xdda178e515432941ull, 0x5c1269bd451db2caull, 0x237c997575283bb3ull,
+        0xcdb181ead523e8c2ull, 0xb2df7122e51661bbull, 0x336c607ab548fa30ull, 0x4c0290b2857d7349ull,
+        0x04d364994d625e4dull, 0x7bbd94517d57d734ull, 0xfa0e85092d094cbfull, 0x856075c11d3cc5c6ull,
+        0x134d926535897936ull, 0x6c2362ad05bcf04full, 0xed9073f555e26bc4ull, 0x92fe833d65d7e2bdull,
+        0xda2f7716adc8cfb9ull, 0xa54187de9dfd46c0ull, 0x24f29686cda3dd4bull, 0x5b9c664efd965432ull,
+        0xb5517ed15d9d8743ull, 0xca3f8e196da80e3aull, 0x4b8c9f413df695b1ull, 0x34e26f890dc31cc8ull,
+        0x7c339ba2c5dc31ccull, 0x035d6b6af5e9b8b5ull, 0x82ee7a32a5b7233eull, 0xfd808afa9582aa47ull,
+        0x4d364994d625e4daull, 0x3258b95ce6106da3ull, 0xb3eba804b64ef628ull, 0xcc8558cc867b7f51ull,
+        0x8454ace74e645255ull, 0xfb3a5c2f7e51db2cull, 0x7a894d772e0f40a7ull, 0x05e7bdbf1e3ac9deull,
+        0xeb2aa520be311aafull, 0x944455e88e0493d6ull, 0x15f744b0de5a085dull, 0x6a99b478ee6f8124ull,
+        0x224840532670ac20ull, 0x5d26b09b16452559ull, 0xdc95a1c3461bbed2ull, 0xa3fb510b762e37abull,
+        0x35d6b6af5e9b8b5bull, 0x4ab846676eae0222ull, 0xcb0b573f3ef099a9ull, 0xb465a7f70ec510d0ull,
+        0xfcb453dcc6da3dd4ull, 0x83daa314f6efb4adull, 0x0269b24ca6b12f26ull, 0x7d0742849684a65full,
+        0x93ca5a1b368f752eull, 0xeca4aad306bafc57ull, 0x6d17bb8b56e467dcull, 0x12794b4366d1eea5ull,
+        0x5aa8bf68aecec3a1ull, 0x25c64fa09efb4ad8ull, 0xa4755ef8cea5d153ull, 0xdb1bae30fe90582aull,
+        0xbcf7b7e3c7593bd8ull, 0xc399472bf76cb2a1ull, 0x422a5673a732292aull, 0x3d44a6bb9707a053ull,
+        0x759552905f188d57ull, 0x0afba2586f2d042eull, 0x8b48b3003f739fa5ull, 0xf42643c80f4616dcull,
+        0x1aeb5b57af4dc5adull, 0x6585ab9f9f784cd4ull, 0xe436bac7cf26d75full, 0x9b584a0fff135e26ull,
+        0xd389be24370c7322ull, 0xace74eec0739fa5bull, 0x2d545fb4576761d0ull, 0x523aaf7c6752e8a9ull,
+        0xc41748d84fe75459ull, 0xbb79b8107fd2dd20ull, 0x3acaa9482f8c46abull, 0x45a459801fb9cfd2ull,
+        0x0d75adabd7a6e2d6ull, 0x721b5d63e7936bafull, 0xf3a84c3bb7cdf024ull, 0x8cc6bcf387f8795dull,
+        0x620ba46c27f3aa2cull, 0x1d6554a417c62355ull, 0x9cd645fc4798b8deull, 0xe3b8b53477ad31a7ull,
+        0xab69411fbfb21ca3ull, 0xd407b1d78f8795daull, 0x55b4a08fdfd90e51ull, 0x2ada5047efec8728ull,
+    };
+
+    // see crc_clmul_x86.hpp
+
+    constexpr static std::uint64_t const clmul[ 13 ] =
+    {
+        0x37ccd3e14069cabcull, 0xa043808c0f782663ull,
+        0x0c32cdb31e18a84aull, 0x62242240ace5045aull,
+        0xbdd7ac0ee1a4a0f0ull, 0xa3ffdc1fe8e82a8bull,
+        0xb0bc2e589204f500ull, 0xe1e0bb9d45d7a44cull,
+        0xeadc41fd2ba3d420ull, 0x21e9761e252621acull,
+        0x21e9761e252621acull, 0x13f67d194d77cfbbull,
+        0x9a6c9329ac4bc9b5ull,
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr std::uint64_t crc64_nvme_constants<T>::P;
+
+template<class T>
+constexpr std::uint64_t crc64_nvme_constants<T>::table[ 256 ];
+
+template<class T>
+constexpr std::uint64_t crc64_nvme_constants<T>::clmul[ 13 ];
+
+#endif
+
+} // namespace detail
+
+// CRC-64/XZ, also known as CRC-64/GO-ECMA
+
+class crc64_xz: public detail::crc_reflected_impl<std::uint64_t, detail::crc64_xz_constants<>>
+{
+public:
+
+    crc64_xz() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit crc64_xz( std::uint64_t seed ): detail::crc_reflected_impl<std::uint64_t, detail::crc64_xz_constants<>>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR crc64_xz( unsigned char const * p, std::size_t n ): detail::crc_reflected_impl<std::uint64_t, detail::crc64_xz_constants<>>( p, n )
+    {
+    }
+};
+
+// CRC-64/NVME, from the NVM Express NVM Command Set Specification
+
+class crc64_nvme: public detail::crc_reflected_impl<std::uint64_t, detail::crc64_nvme_constants<>>
+{
+public:
+
+    crc64_nvme() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit crc64_nvme( std::uint64_t seed ): detail::crc_reflected_impl<std::uint64_t, detail::crc64_nvme_constants<>>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR crc64_nvme( unsigned char const * p, std::size_t n ): detail::crc_reflected_impl<std::uint64_t, detail::crc64_nvme_constants<>>( p, n )
+    {
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CRC64_HPP_INCLUDED
@@ -0,0 +1,474 @@
+#ifndef BOOST_HASH2_CUCKOO_FILTER_HPP_INCLUDED
+#define BOOST_HASH2_CUCKOO_FILTER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// cuckoo_filter, a concurrent approximate membership filter that supports
+// deletion (Fan et al. 2014)
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/config.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the 16 bit lanes of x equal to f, as a mask of their high bits; exact,
+// like match_bytes in concurrent_digest_map.hpp
+
+inline std::uint64_t match_lanes16( std::uint64_t x, std::uint16_t f ) noexcept
+{
+    std::uint64_t const lo15 = 0x7FFF7FFF7FFF7FFFull;
+
+    x ^= 0x0001000100010001ull * f;
+    return ~( ( ( x & lo15 ) + lo15 ) | x | lo15 );
+}
+
+// the index of the lowest lane whose high bit is set in m
+
+inline unsigned lowest_lane16( std::uint64_t m ) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return static_cast<unsigned>( __builtin_ctzll( m ) ) / 16;
+
+#else
+
+    unsigned i = 0;
+
+    while( ( m & 0x8000 ) == 0 )
+    {
+        m >>= 16;
+        ++i;
+    }
+
+    return i;
+
+#endif
+}
+
+// the number of buckets visited by the search for a free slot
+
+constexpr std::size_t cuckoo_max_nodes = 512;
+
+// queries are hashed and prefetched in groups of this size
+
+constexpr std::size_t cuckoo_batch_size = 16;
+
+} // namespace detail
+
+// cuckoo_filter<T, H, Shards, Flavor>
+//
+// the filter is split into Shards independent shards; a shard is an array
+// of buckets of four 16 bit fingerprints, 0 for an empty slot, each bucket
+// an atomic 64 bit word whose four fingerprints are matched at once
+//
+// one 64 bit hash value gives the shard (the low byte), the fingerprint
+// (the next two bytes) and the first bucket; the second bucket is derived
+// from the first and the fingerprint, so that a fingerprint can be moved
+// between its two buckets without the key
+//
+// queries take no locks; modifications take the mutex of their shard. A
+// fingerprint placed in, or removed from, a single slot is published with
+// one store, but a chain of relocations is bracketed by increments of the
+// version of the shard, and a query that didn't find its fingerprint is
+// repeated when the version has changed while it was reading the buckets
+
+template<class T, class H, std::size_t Shards = 64, class Flavor = default_flavor> class cuckoo_filter
+{
+private:
+
+    static_assert( Shards > 0 && Shards <= 256 && ( Shards & ( Shards - 1 ) ) == 0, "Shards must be a power of two no larger than 256" );
+
+    // separate cache lines, so that the writers of one shard don't
+    // invalidate the lines the readers of another use
+
+    struct shard
+    {
+        unsigned char pad1_[ 64 ];
+
+        std::unique_ptr< std::atomic<std::uint64_t>[] > buckets;
+
+        std::mutex mx;
+        std::atomic<std::uint64_t> version;
+        std::atomic<std::size_t> size;
+
+        unsigned char pad2_[ 64 ];
+    };
+
+    struct node
+    {
+        std::size_t bucket;
+        std::size_t parent; // the index of the parent node, or npos for the two roots
+        unsigned lane; // the lane of the parent bucket whose fingerprint goes here
+    };
+
+    static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+    H h_;
+
+    std::unique_ptr<shard[]> shards_;
+    std::size_t n_; // buckets per shard
+
+private:
+
+    static std::uint16_t fingerprint( std::uint64_t h ) noexcept
+    {
+        std::uint16_t r = static_cast<std::uint16_t>( h >> 8 );
+        return static_cast<std::uint16_t>( r + ( r == 0 ) );
+    }
+
+    std::size_t first_bucket( std::uint64_t h ) const noexcept
+    {
+        return hash2::reduce( h, n_ );
+    }
+
+    // ( c - i ) mod n, where c depends only on the fingerprint; applied
+    // twice, it gives back i
+
+    std::size_t other_bucket( std::size_t i, std::uint16_t f ) const noexcept
+    {
+        std::size_t const c = hash2::reduce( f * 0x9E3779B97F4A7C15ull, n_ );
+        return c >= i? c - i: c + n_ - i;
+    }
+
+    static std::uint16_t lane( std::uint64_t x, unsigned k ) noexcept
+    {
+        return static_cast<std::uint16_t>( x >> ( k * 16 ) );
+    }
+
+    static std::uint64_t with_lane( std::uint64_t x, unsigned k, std::uint16_t f ) noexcept
+    {
+        return ( x & ~( std::uint64_t( 0xFFFF ) << ( k * 16 ) ) ) | std::uint64_t( f ) << ( k * 16 );
+    }
+
+    // stores f into a free slot of bucket i, if there's one; under the mutex
+
+    static bool place( std::atomic<std::uint64_t>& b, std::uint16_t f ) noexcept
+    {
+        std::uint64_t const x = b.load( std::memory_order_relaxed );
+        std::uint64_t const e = detail::match_lanes16( x, 0 );
+
+        if( e == 0 ) return false;
+
+        b.store( with_lane( x, detail::lowest_lane16( e ), f ), std::memory_order_release );
+        return true;
+    }
+
+    // whether the path to node k already goes through bucket i
+
+    static bool on_path( node const* nodes, std::size_t k, std::size_t i ) noexcept
+    {
+        for( ; k != npos; k = nodes[ k ].parent )
+        {
+            if( nodes[ k ].bucket == i ) return true;
+        }
+
+        return false;
+    }
+
+    // a breadth-first search for a chain of relocations ending in a free
+    // slot, which is then carried out from the free slot back
+
+    bool relocate( shard& s, std::size_t i1, std::size_t i2, std::uint16_t f ) noexcept
+    {
+        node nodes[ detail::cuckoo_max_nodes ];
+
+        nodes[ 0 ] = { i1, npos, 0 };
+        nodes[ 1 ] = { i2, npos, 0 };
+
+        std::size_t m = i1 == i2? 1: 2;
+
+        for( std::size_t k = 0; k < m; ++k )
+        {
+            std::uint64_t const x = s.buckets[ nodes[ k ].bucket ].load( std::memory_order_relaxed );
+
+            for( unsigned j = 0; j < 4; ++j )
+            {
+                std::size_t const i = other_bucket( nodes[ k ].bucket, lane( x, j ) );
+
+                if( on_path( nodes, k, i ) ) continue;
+
+                if( detail::match_lanes16( s.buckets[ i ].load( std::memory_order_relaxed ), 0 ) != 0 )
+                {
+                    s.version.fetch_add( 1, std::memory_order_acq_rel );
+
+                    // each fingerprint is copied into its new slot before
+                    // its old slot is overwritten
+
+                    std::size_t to = i;
+                    std::size_t from = k;
+                    unsigned l = j;
+
+                    for( ;; )
+                    {
+                        std::atomic<std::uint64_t>& b = s.buckets[ nodes[ from ].bucket ];
+                        place( s.buckets[ to ], lane( b.load( std::memory_order_relaxed ), l ) );
+
+                        if( nodes[ from ].parent == npos )
+                        {
+                            b.store( with_lane( b.load( std::memory_order_relaxed ), l, f ), std::memory_order_release );
+                            break;
+                        }
+
+                        // the slot just vacated is now free
+
+                        b.store( with_lane( b.load( std::memory_order_relaxed ), l, 0 ), std::memory_order_release );
+
+                        to = nodes[ from ].bucket;
+                        l = nodes[ from ].lane;
+                        from = nodes[ from ].parent;
+                    }
+
+                    s.version.fetch_add( 1, std::memory_order_release );
+                    return true;
+                }
+
+                if( m < detail::cuckoo_max_nodes )
+                {
+                    nodes[ m++ ] = { i, k, j };
+                }
+            }
+        }
+
+        return false;
+    }
+
+    bool contains( std::uint64_t h ) const noexcept
+    {
+        shard const& s = shards_[ h & ( Shards - 1 ) ];
+
+        std::uint16_t const f = fingerprint( h );
+
+        std::size_t const i1 = first_bucket( h );
+        std::size_t const i2 = other_bucket( i1, f );
+
+        for( ;; )
+        {
+            std::uint64_t const v = s.version.load( std::memory_order_acquire );
+
+            std::uint64_t const x1 = s.buckets[ i1 ].load( std::memory_order_acquire );
+            std::uint64_t const x2 = s.buckets[ i2 ].load( std::memory_order_acquire );
+
+            if( ( detail::match_lanes16( x1, f ) | detail::match_lanes16( x2, f ) ) != 0 ) return true;
+
+            // an odd version means a relocation in progress
+
+            if( ( v & 1 ) == 0 && s.version.load( std::memory_order_acquire ) == v ) return false;
+        }
+    }
+
+    void prefetch( std::uint64_t h ) const noexcept
+    {
+        shard const& s = shards_[ h & ( Shards - 1 ) ];
+
+        std::size_t const i1 = first_bucket( h );
+
+        detail::prefetch( &s.buckets[ i1 ] );
+        detail::prefetch( &s.buckets[ other_bucket( i1, fingerprint( h ) ) ] );
+    }
+
+    void init()
+    {
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            shard& s = shards_[ i ];
+
+            s.buckets.reset( new std::atomic<std::uint64_t>[ n_ ] );
+            s.version.store( 0, std::memory_order_relaxed );
+            s.size.store( 0, std::memory_order_relaxed );
+
+            for( std::size_t j = 0; j < n_; ++j )
+            {
+                s.buckets[ j ].store( 0, std::memory_order_relaxed );
+            }
+        }
+    }
+
+    static std::size_t bucket_count( std::size_t m ) noexcept
+    {
+        std::size_t n = ( m + Shards * 4 - 1 ) / ( Shards * 4 );
+        return n > 0? n: 1;
+    }
+
+public:
+
+    using value_type = T;
+    using hash_type = H;
+
+    static constexpr std::size_t shard_count = Shards;
+
+    // m is the number of slots, rounded up to a multiple of 4 * Shards;
+    // insertions start failing at a load of about 95%
+
+    explicit cuckoo_filter( std::size_t m ): h_(), shards_( new shard[ Shards ] ), n_( bucket_count( m ) )
+    {
+        init();
+    }
+
+    cuckoo_filter( std::size_t m, std::uint64_t seed ): h_( seed ), shards_( new shard[ Shards ] ), n_( bucket_count( m ) )
+    {
+        init();
+    }
+
+    cuckoo_filter( std::size_t m, unsigned char const* seed, std::size_t n ): h_( seed, n ), shards_( new shard[ Shards ] ), n_( bucket_count( m ) )
+    {
+        init();
+    }
+
+    cuckoo_filter( cuckoo_filter const& ) = delete;
+    cuckoo_filter& operator=( cuckoo_filter const& ) = delete;
+
+    std::size_t capacity() const noexcept
+    {
+        return Shards * n_ * 4;
+    }
+
+    std::size_t size() const noexcept
+    {
+        std::size_t r = 0;
+
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            r += shards_[ i ].size.load( std::memory_order_relaxed );
+        }
+
+        return r;
+    }
+
+    // returns false when there's no room for v; the filter is unchanged
+    // then. A value can be inserted more than once, and then needs to be
+    // erased as many times
+
+    bool insert( T const& v )
+    {
+        std::uint64_t const h = detail::hash_value64<H, Flavor>( h_, v );
+
+        shard& s = shards_[ h & ( Shards - 1 ) ];
+
+        std::uint16_t const f = fingerprint( h );
+
+        std::size_t const i1 = first_bucket( h );
+        std::size_t const i2 = other_bucket( i1, f );
+
+        std::lock_guard<std::mutex> lock( s.mx );
+
+        if( place( s.buckets[ i1 ], f ) || place( s.buckets[ i2 ], f ) || relocate( s, i1, i2, f ) )
+        {
+            s.size.store( s.size.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+            return true;
+        }
+
+        return false;
+    }
+
+    // v must have been inserted; erasing a value that wasn't can remove
+    // the fingerprint of another. Returns false when v is certainly not
+    // in the filter
+
+    bool erase( T const& v )
+    {
+        std::uint64_t const h = detail::hash_value64<H, Flavor>( h_, v );
+
+        shard& s = shards_[ h & ( Shards - 1 ) ];
+
+        std::uint16_t const f = fingerprint( h );
+
+        std::size_t const i1 = first_bucket( h );
+        std::size_t const i2 = other_bucket( i1, f );
+
+        std::lock_guard<std::mutex> lock( s.mx );
+
+        for( std::size_t i: { i1, i2 } )
+        {
+            std::uint64_t const x = s.buckets[ i ].load( std::memory_order_relaxed );
+            std::uint64_t const m = detail::match_lanes16( x, f );
+
+            if( m != 0 )
+            {
+                s.buckets[ i ].store( with_lane( x, detail::lowest_lane16( m ), 0 ), std::memory_order_release );
+                s.size.store( s.size.load( std::memory_order_relaxed ) - 1, std::memory_order_relaxed );
+
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    // lock-free
+
+    bool may_contain( T const& v ) const
+    {
+        return contains( detail::hash_value64<H, Flavor>( h_, v ) );
+    }
+
+    // the batch query hashes a group of values and prefetches their
+    // buckets before accessing them, overlapping the cache misses
+
+    template<class It> void may_contain( It first, It last, bool* out ) const
+    {
+        constexpr std::size_t N = detail::cuckoo_batch_size;
+
+        std::uint64_t h[ N ];
+
+        while( first != last )
+        {
+            std::size_t n = 0;
+
+            for( ; n < N && first != last; ++n, ++first )
+            {
+                h[ n ] = detail::hash_value64<H, Flavor, T>( h_, *first );
+                prefetch( h[ n ] );
+            }
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                *out++ = contains( h[ i ] );
+            }
+        }
+    }
+
+    // not safe to call concurrently with insert or erase
+
+    void clear() noexcept
+    {
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            shard& s = shards_[ i ];
+
+            for( std::size_t j = 0; j < n_; ++j )
+            {
+                s.buckets[ j ].store( 0, std::memory_order_relaxed );
+            }
+
+            s.size.store( 0, std::memory_order_relaxed );
+        }
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T, class H, std::size_t Shards, class Flavor> constexpr std::size_t cuckoo_filter<T, H, Shards, Flavor>::npos;
+template<class T, class H, std::size_t Shards, class Flavor> constexpr std::size_t cuckoo_filter<T, H, Shards, Flavor>::shard_count;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_CUCKOO_FILTER_HPP_INCLUDED
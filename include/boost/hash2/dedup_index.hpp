@@ -0,0 +1,243 @@
+#ifndef BOOST_HASH2_DEDUP_INDEX_HPP_INCLUDED
+#define BOOST_HASH2_DEDUP_INDEX_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// dedup_index<Fast, Strong, T>, a deduplication index that identifies
+// chunks by a fast fingerprint, and computes and compares their strong
+// digests only when the fingerprint of a chunk has been seen before
+
+#include <boost/hash2/concurrent_digest_map.hpp>
+#include <boost/hash2/multi_hash.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <atomic>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the fingerprint computed by a hash algorithm, as a digest
+
+template<std::size_t N> digest<N> const& dedup_key( digest<N> const& d ) noexcept
+{
+    return d;
+}
+
+inline digest<8> dedup_key( std::uint64_t x ) noexcept
+{
+    digest<8> r;
+    detail::write64le( r.data(), x );
+
+    return r;
+}
+
+template<class D> struct dedup_size;
+
+template<std::size_t N> struct dedup_size< digest<N> >: std::integral_constant<std::size_t, N>
+{
+};
+
+} // namespace detail
+
+// dedup_index<Fast, Strong, T>
+//
+// maps the fingerprints Fast computes to values of type T, such as the
+// locations of stored chunks; since most chunks are unique, and their
+// fingerprints aren't found, the strong digest of a chunk is only needed
+// when its fingerprint is, to tell a duplicate apart from a collision
+//
+// the strong digests of the chunks in the index are obtained from the
+// caller, the first time they are needed, and kept; chunks whose
+// fingerprints collide with those of different chunks are indexed by
+// their strong digests
+//
+// all member functions can be called concurrently
+
+template<class Fast, class Strong, class T, std::size_t Shards = 64> class dedup_index
+{
+public:
+
+    using fingerprint_type = typename std::decay<decltype( detail::dedup_key( std::declval<typename Fast::result_type>() ) )>::type;
+    using strong_type = typename Strong::result_type;
+
+    using mapped_type = T;
+
+private:
+
+    // the index, by fingerprint
+    concurrent_digest_map<detail::dedup_size<fingerprint_type>::value, T, Shards> primary_;
+
+    // the strong digests of the chunks in primary_, once known
+    concurrent_digest_map<detail::dedup_size<fingerprint_type>::value, strong_type, Shards> strong_;
+
+    // the chunks whose fingerprints collide with those of different
+    // chunks in primary_, by strong digest
+    concurrent_digest_map<detail::dedup_size<strong_type>::value, T, Shards> overflow_;
+
+    std::atomic<std::uint64_t> hits_;
+    std::atomic<std::uint64_t> collisions_;
+
+private:
+
+    // the entry for the strong digest s of a chunk whose fingerprint fp
+    // is that of the chunk v in primary_
+
+    template<class F> std::pair<T const*, bool> confirm( fingerprint_type const& fp, T const* v, strong_type const& s, T const* nv, F& existing )
+    {
+        hits_.fetch_add( 1, std::memory_order_relaxed );
+
+        strong_type const* ps = strong_.find( fp );
+
+        strong_type s2;
+
+        if( ps == nullptr )
+        {
+            s2 = existing( *v );
+
+            // when strong_ is full, the digest is obtained again next time
+
+            ps = strong_.emplace( fp, s2 ).first;
+
+            if( ps == nullptr ) ps = &s2;
+        }
+
+        if( *ps == s )
+        {
+            return { v, false };
+        }
+
+        collisions_.fetch_add( 1, std::memory_order_relaxed );
+
+        if( nv )
+        {
+            return overflow_.emplace( s, *nv );
+        }
+        else
+        {
+            return { overflow_.find( s ), false };
+        }
+    }
+
+    static strong_type strong_digest( void const* p, std::size_t n )
+    {
+        Strong h;
+        h.update( p, n );
+
+        return h.result();
+    }
+
+public:
+
+    // capacity is the number of chunks in the index; the strong digests
+    // are kept for up to capacity / 4 of them, and up to capacity / 16
+    // can collide
+
+    explicit dedup_index( std::size_t capacity ):
+        primary_( capacity ), strong_( capacity / 4 ), overflow_( capacity / 16 ), hits_( 0 ), collisions_( 0 )
+    {
+    }
+
+    dedup_index( dedup_index const& ) = delete;
+    dedup_index& operator=( dedup_index const& ) = delete;
+
+    // the fingerprint of [p, p+n)
+
+    static fingerprint_type fingerprint( void const* p, std::size_t n )
+    {
+        Fast h;
+        h.update( p, n );
+
+        return detail::dedup_key( h.result() );
+    }
+
+    // the fingerprint and the strong digest of [p, p+n), in one pass
+
+    static std::pair<fingerprint_type, strong_type> digests( void const* p, std::size_t n )
+    {
+        multi_hash<Fast, Strong> h;
+        h.update( p, n );
+
+        auto r = h.result();
+        return { detail::dedup_key( std::get<0>( r ) ), std::get<1>( r ) };
+    }
+
+    std::size_t size() const noexcept
+    {
+        return primary_.size() + overflow_.size();
+    }
+
+    // the number of lookups that found the fingerprint, and needed the
+    // strong digest, and of those, the number that turned out to be
+    // collisions
+
+    std::uint64_t fingerprint_hits() const noexcept
+    {
+        return hits_.load( std::memory_order_relaxed );
+    }
+
+    std::uint64_t collisions() const noexcept
+    {
+        return collisions_.load( std::memory_order_relaxed );
+    }
+
+    // inserts the chunk [p, p+n), whose fingerprint is computed here, with
+    // the value v, unless an equal chunk is present; the strong digest of
+    // the chunk is only computed if its fingerprint is found, and that of
+    // the chunk with the value u in the index is existing( u )
+    //
+    // returns the value of the equal chunk and false, or that of the new
+    // chunk and true, or nullptr and false if the index is full
+
+    template<class F> std::pair<T const*, bool> insert( void const* p, std::size_t n, T const& v, F existing )
+    {
+        fingerprint_type const fp = fingerprint( p, n );
+
+        std::pair<T const*, bool> r = primary_.insert( fp, v );
+
+        if( r.second || r.first == nullptr ) return r;
+
+        return confirm( fp, r.first, strong_digest( p, n ), &v, existing );
+    }
+
+    // inserts the chunk with the fingerprint fp and strong digest s, as
+    // computed by digests(); only compares s on a fingerprint hit
+
+    template<class F> std::pair<T const*, bool> insert( fingerprint_type const& fp, strong_type const& s, T const& v, F existing )
+    {
+        std::pair<T const*, bool> r = primary_.insert( fp, v );
+
+        if( r.second || r.first == nullptr ) return r;
+
+        return confirm( fp, r.first, s, &v, existing );
+    }
+
+    // the value of the chunk equal to [p, p+n), or nullptr
+
+    template<class F> T const* find( void const* p, std::size_t n, F existing )
+    {
+        fingerprint_type const fp = fingerprint( p, n );
+
+        T const* v = primary_.find( fp );
+
+        if( v == nullptr ) return nullptr;
+
+        return confirm( fp, v, strong_digest( p, n ), nullptr, existing ).first;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DEDUP_INDEX_HPP_INCLUDED
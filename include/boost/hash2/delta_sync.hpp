@@ -0,0 +1,422 @@
+#ifndef BOOST_HASH2_DELTA_SYNC_HPP_INCLUDED
+#define BOOST_HASH2_DELTA_SYNC_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// rsync style delta synchronization: the signatures of the blocks of a
+// file, and the matching of a new version of it against them
+
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class H> struct block_signature
+{
+    std::uint64_t weak;
+    typename H::result_type strong;
+};
+
+// delta_signature<H, Rolling>, the signatures of the consecutive blocks of
+// block_size bytes of a source file; the last block may be shorter
+//
+// the weak checksum is the value of Rolling( block_size, seed ) after the
+// block bytes, and the strong one is the result of H( seed ) after them
+
+template<class H, class Rolling = buzhash_64> class delta_signature
+{
+private:
+
+    std::size_t block_size_;
+    std::uint64_t seed_;
+    std::uint64_t source_size_ = 0;
+
+    std::vector< block_signature<H> > blocks_;
+
+    void compute( unsigned char const* p, std::size_t i, std::size_t k, std::size_t n )
+    {
+        Rolling r( block_size_, seed_ );
+        H const h0( seed_ );
+
+        for( ; i < k; ++i )
+        {
+            std::size_t const offset = i * block_size_;
+            std::size_t const m = n - offset < block_size_? n - offset: block_size_;
+
+            r.reset();
+            r.update( p + offset, m );
+
+            H h( h0 );
+            h.update( p + offset, m );
+
+            blocks_[ i ].weak = r.value();
+            blocks_[ i ].strong = h.result();
+        }
+    }
+
+public:
+
+    using hash_type = H;
+    using rolling_type = Rolling;
+    using block_type = block_signature<H>;
+
+    explicit delta_signature( std::size_t block_size, std::uint64_t seed = 0 ): block_size_( block_size ), seed_( seed )
+    {
+        BOOST_ASSERT( block_size > 0 );
+    }
+
+    // signatures received from elsewhere
+
+    delta_signature( std::size_t block_size, std::uint64_t seed, std::uint64_t source_size, std::vector< block_signature<H> > blocks ): block_size_( block_size ), seed_( seed ), source_size_( source_size ), blocks_( std::move( blocks ) )
+    {
+        BOOST_ASSERT( block_size > 0 );
+        BOOST_ASSERT( blocks_.size() == ( source_size + block_size - 1 ) / block_size );
+    }
+
+    // computes the signatures of [p, p + n)
+
+    void generate( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::size_t const k = ( n + block_size_ - 1 ) / block_size_;
+
+        source_size_ = n;
+        blocks_.resize( k );
+
+        compute( p, 0, k, n );
+    }
+
+    // same, but computes the signatures on up to `threads` threads;
+    // threads == 0 means std::thread::hardware_concurrency()
+
+    void generate( void const* pv, std::size_t n, unsigned threads )
+    {
+        thread_executor ex( threads );
+        generate( pv, n, ex );
+    }
+
+    // same, but computes the signatures on ex
+
+    void generate( void const* pv, std::size_t n, task_executor& ex )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::size_t const k = ( n + block_size_ - 1 ) / block_size_;
+
+        source_size_ = n;
+        blocks_.resize( k );
+
+        // below 256 KiB per part, running a task costs more than it saves
+
+        std::size_t const min_blocks = ( 256 * 1024 + block_size_ - 1 ) / block_size_;
+
+        unsigned const parts = detail::parallel_parts( ex, k, min_blocks );
+
+        if( parts > 1 )
+        {
+            std::size_t const q = k / parts;
+
+            hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+                std::size_t const first = t * q;
+                std::size_t const last = t + 1 < parts? first + q: k;
+
+                compute( p, first, last, n );
+            });
+
+            return;
+        }
+
+        compute( p, 0, k, n );
+    }
+
+    std::size_t block_size() const noexcept
+    {
+        return block_size_;
+    }
+
+    std::uint64_t seed() const noexcept
+    {
+        return seed_;
+    }
+
+    std::uint64_t source_size() const noexcept
+    {
+        return source_size_;
+    }
+
+    std::vector< block_signature<H> > const& blocks() const noexcept
+    {
+        return blocks_;
+    }
+};
+
+// a part of the target, bytes [target_offset, target_offset + size); when
+// copy is true, they are the bytes of the source at source_offset, and
+// otherwise they need to be sent
+
+struct delta_op
+{
+    bool copy;
+
+    std::uint64_t source_offset;
+    std::uint64_t target_offset;
+    std::size_t size;
+};
+
+// delta_matcher<H, Rolling>, finds the blocks of a source, described by its
+// delta_signature, in a target
+//
+// the weak checksum is rolled over the target a byte at a time; it's first
+// looked up in a bitmap of 32 bits per block, which rejects most of the
+// positions without leaving the cache, then in an open addressing table
+// of the weak checksums; the strong checksum is only computed for the
+// blocks whose weak checksum matches
+
+template<class H, class Rolling = buzhash_64> class delta_matcher
+{
+private:
+
+    struct slot
+    {
+        std::uint64_t weak;
+        std::size_t block; // + 1, 0 for an empty slot
+    };
+
+    std::size_t block_size_;
+    std::uint64_t source_size_;
+
+    std::vector< block_signature<H> > blocks_;
+
+    std::size_t tail_; // the size of the last block when it's short, or 0
+
+    std::vector<std::uint64_t> bitmap_;
+    int bitmap_shift_;
+
+    std::vector<slot> table_;
+    int table_shift_;
+
+    Rolling r0_;
+    H h0_;
+
+    static std::uint64_t mix( std::uint64_t w ) noexcept
+    {
+        // the low bits of the rolling hashes aren't well distributed
+
+        return w * 0x9E3779B97F4A7C15ull;
+    }
+
+    // the shift that maps a mixed value to [0, 2^(64-s)), with 2^(64-s) >= n
+
+    static int shift_for( std::size_t n ) noexcept
+    {
+        int s = 63;
+
+        while( s > 1 && ( std::uint64_t( 1 ) << ( 64 - s ) ) < n )
+        {
+            --s;
+        }
+
+        return s;
+    }
+
+    bool bitmap_test( std::uint64_t m ) const noexcept
+    {
+        std::uint64_t const i = m >> bitmap_shift_;
+        return ( bitmap_[ i / 64 ] >> ( i % 64 ) & 1 ) != 0;
+    }
+
+    bool strong_match( std::size_t j, unsigned char const* p, std::size_t n ) const
+    {
+        H h( h0_ );
+        h.update( p, n );
+
+        return h.result() == blocks_[ j ].strong;
+    }
+
+    // the index of a full block equal to [p, p + block_size_) whose weak
+    // checksum is w, preferring `hint`, or npos
+
+    std::size_t find( std::uint64_t w, unsigned char const* p, std::size_t hint ) const
+    {
+        if( hint < blocks_.size() && blocks_[ hint ].weak == w && ( tail_ == 0 || hint + 1 < blocks_.size() ) && strong_match( hint, p, block_size_ ) )
+        {
+            return hint;
+        }
+
+        std::size_t const mask = table_.size() - 1;
+
+        for( std::size_t i = static_cast<std::size_t>( mix( w ) >> table_shift_ ); table_[ i ].block != 0; i = ( i + 1 ) & mask )
+        {
+            std::size_t const j = table_[ i ].block - 1;
+
+            if( table_[ i ].weak == w && j != hint && strong_match( j, p, block_size_ ) )
+            {
+                return j;
+            }
+        }
+
+        return npos;
+    }
+
+    template<class F> static void emit( delta_op& last, delta_op const& op, F& f )
+    {
+        if( op.size == 0 ) return;
+
+        if( last.size != 0 && last.copy == op.copy && last.target_offset + last.size == op.target_offset && ( !op.copy || last.source_offset + last.size == op.source_offset ) )
+        {
+            last.size += op.size;
+            return;
+        }
+
+        if( last.size != 0 )
+        {
+            f( last );
+        }
+
+        last = op;
+    }
+
+public:
+
+    using hash_type = H;
+    using rolling_type = Rolling;
+
+    static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+    explicit delta_matcher( delta_signature<H, Rolling> const& sig ):
+        block_size_( sig.block_size() ), source_size_( sig.source_size() ), blocks_( sig.blocks() ),
+        tail_( static_cast<std::size_t>( sig.source_size() % sig.block_size() ) ),
+        r0_( sig.block_size(), sig.seed() ), h0_( sig.seed() )
+    {
+        std::size_t const k = blocks_.size() - ( tail_ != 0? 1: 0 );
+
+        bitmap_shift_ = shift_for( 32 * k + 64 );
+        bitmap_.resize( ( std::size_t( 1 ) << ( 64 - bitmap_shift_ ) ) / 64 + 1 );
+
+        table_shift_ = shift_for( 2 * k + 1 );
+        table_.resize( std::size_t( 1 ) << ( 64 - table_shift_ ) );
+
+        std::size_t const mask = table_.size() - 1;
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            std::uint64_t const w = blocks_[ j ].weak;
+            std::uint64_t const m = mix( w );
+
+            std::uint64_t const b = m >> bitmap_shift_;
+            bitmap_[ b / 64 ] |= std::uint64_t( 1 ) << ( b % 64 );
+
+            std::size_t i = static_cast<std::size_t>( m >> table_shift_ );
+
+            while( table_[ i ].block != 0 )
+            {
+                i = ( i + 1 ) & mask;
+            }
+
+            table_[ i ].weak = w;
+            table_[ i ].block = j + 1;
+        }
+    }
+
+    std::size_t block_size() const noexcept
+    {
+        return block_size_;
+    }
+
+    // calls f( op ) with the delta_op values that describe [p, p + n), in
+    // order; adjacent copies of adjacent source blocks, and adjacent
+    // literals, are merged
+
+    template<class F> void match( void const* pv, std::size_t n, F f ) const
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::size_t const bs = block_size_;
+
+        delta_op last = { false, 0, 0, 0 };
+
+        std::size_t pos = 0; // the start of the window
+        std::size_t lit = 0; // the start of the pending literal bytes
+        std::size_t next = 0; // the block following the last match
+
+        Rolling r( r0_ );
+
+        if( n >= bs )
+        {
+            r.update( p, bs );
+
+            for( ;; )
+            {
+                std::uint64_t const w = r.value();
+
+                if( bitmap_test( mix( w ) ) )
+                {
+                    std::size_t const j = find( w, p + pos, next );
+
+                    if( j != npos )
+                    {
+                        emit( last, { false, 0, lit, pos - lit }, f );
+                        emit( last, { true, static_cast<std::uint64_t>( j ) * bs, pos, bs }, f );
+
+                        pos += bs;
+                        lit = pos;
+                        next = j + 1;
+
+                        if( n - pos < bs ) break;
+
+                        r.reset();
+                        r.update( p + pos, bs );
+
+                        continue;
+                    }
+                }
+
+                if( n - pos == bs ) break;
+
+                r.roll( p[ pos ], p[ pos + bs ] );
+                ++pos;
+            }
+        }
+
+        // the short last block can only match at the end of the target
+
+        if( tail_ != 0 && n - lit >= tail_ && strong_match( blocks_.size() - 1, p + n - tail_, tail_ ) )
+        {
+            emit( last, { false, 0, lit, n - tail_ - lit }, f );
+            emit( last, { true, source_size_ - tail_, n - tail_, tail_ }, f );
+        }
+        else
+        {
+            emit( last, { false, 0, lit, n - lit }, f );
+        }
+
+        if( last.size != 0 )
+        {
+            f( last );
+        }
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, class Rolling> constexpr std::size_t delta_matcher<H, Rolling>::npos;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DELTA_SYNC_HPP_INCLUDED
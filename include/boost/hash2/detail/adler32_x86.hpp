@@ -0,0 +1,97 @@
+#ifndef BOOST_HASH2_DETAIL_ADLER32_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_ADLER32_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Adler-32 using SSSE3
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+BOOST_HASH2_TARGET("ssse3")
+inline std::uint32_t adler32_hsum( __m128i x ) noexcept
+{
+    x = _mm_add_epi32( x, _mm_shuffle_epi32( x, 0x4E ) );
+    x = _mm_add_epi32( x, _mm_shuffle_epi32( x, 0xB1 ) );
+
+    return static_cast<std::uint32_t>( _mm_cvtsi128_si32( x ) );
+}
+
+// Over a block of 32 bytes, a grows by their sum, and b by 32 times the
+// a of the block start plus the sum of the bytes weighted by 32 down to 1.
+// Up to 5552 bytes are summed before the reduction modulo 65521, as in
+// zlib; n is a multiple of 32.
+
+BOOST_HASH2_TARGET("ssse3")
+inline void adler32_update_ssse3( std::uint32_t& a, std::uint32_t& b, unsigned char const* p, std::size_t n ) noexcept
+{
+    __m128i const w1 = _mm_setr_epi8( 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17 );
+    __m128i const w2 = _mm_setr_epi8( 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 );
+
+    __m128i const ones = _mm_set1_epi16( 1 );
+    __m128i const zero = _mm_setzero_si128();
+
+    while( n != 0 )
+    {
+        std::size_t blocks = n / 32;
+
+        if( blocks > 5552 / 32 )
+        {
+            blocks = 5552 / 32;
+        }
+
+        n -= blocks * 32;
+
+        // the a of the block starts, summed; the initial a is counted
+        // for each block here, and the growth of a in the loop
+
+        __m128i va = zero;
+        __m128i vp = _mm_cvtsi32_si128( static_cast<int>( a * static_cast<std::uint32_t>( blocks ) ) );
+        __m128i vb = _mm_cvtsi32_si128( static_cast<int>( b ) );
+
+        do
+        {
+            __m128i x1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) );
+            __m128i x2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 16 ) );
+
+            vp = _mm_add_epi32( vp, va );
+
+            va = _mm_add_epi32( va, _mm_sad_epu8( x1, zero ) );
+            vb = _mm_add_epi32( vb, _mm_madd_epi16( _mm_maddubs_epi16( x1, w1 ), ones ) );
+
+            va = _mm_add_epi32( va, _mm_sad_epu8( x2, zero ) );
+            vb = _mm_add_epi32( vb, _mm_madd_epi16( _mm_maddubs_epi16( x2, w2 ), ones ) );
+
+            p += 32;
+        }
+        while( --blocks );
+
+        vb = _mm_add_epi32( vb, _mm_slli_epi32( vp, 5 ) );
+
+        a = ( a + detail::adler32_hsum( va ) ) % 65521;
+        b = detail::adler32_hsum( vb ) % 65521;
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_ADLER32_X86_HPP_INCLUDED
@@ -0,0 +1,105 @@
+#ifndef BOOST_HASH2_DETAIL_AES_HASH_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_AES_HASH_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// aes_hash_128 using the ARMv8 cryptography extensions
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The ARM code paths are enabled at compile time, when the target
+// architecture includes the AES extension (e.g. -march=armv8-a+crypto)
+
+// AESE xors the key before SubBytes and ShiftRows, and AESMC is a separate
+// instruction, so the equivalent of x86 AESENC is AESE with a zero key,
+// AESMC, and an xor with the round key
+
+inline uint8x16_t aes_hash_enc_arm( uint8x16_t s, uint8x16_t k ) noexcept
+{
+    return veorq_u8( vaesmcq_u8( vaeseq_u8( s, vdupq_n_u8( 0 ) ) ), k );
+}
+
+inline void aes_hash_init_arm( unsigned char k[ 64 ], unsigned char a[ 64 ], unsigned char const pi[ 64 ] ) noexcept
+{
+    uint8x16_t const c4 = vld1q_u8( pi + 48 );
+
+    uint8x16_t k0 = vld1q_u8( k );
+    uint8x16_t k1 = aes_hash_enc_arm( k0, vld1q_u8( pi +  0 ) );
+    uint8x16_t k2 = aes_hash_enc_arm( k1, vld1q_u8( pi + 16 ) );
+    uint8x16_t k3 = aes_hash_enc_arm( k2, vld1q_u8( pi + 32 ) );
+
+    vst1q_u8( k + 16, k1 );
+    vst1q_u8( k + 32, k2 );
+    vst1q_u8( k + 48, k3 );
+
+    vst1q_u8( a +  0, veorq_u8( k0, c4 ) );
+    vst1q_u8( a + 16, veorq_u8( k1, c4 ) );
+    vst1q_u8( a + 32, veorq_u8( k2, c4 ) );
+    vst1q_u8( a + 48, veorq_u8( k3, c4 ) );
+}
+
+inline void aes_hash_blocks_arm( unsigned char const k[ 64 ], unsigned char a[ 64 ], unsigned char const* p, std::size_t n ) noexcept
+{
+    uint8x16_t const k0 = vld1q_u8( k );
+    uint8x16_t const k1 = vld1q_u8( k + 16 );
+
+    uint8x16_t a0 = vld1q_u8( a +  0 );
+    uint8x16_t a1 = vld1q_u8( a + 16 );
+    uint8x16_t a2 = vld1q_u8( a + 32 );
+    uint8x16_t a3 = vld1q_u8( a + 48 );
+
+    for( ; n > 0; --n, p += 64 )
+    {
+        a0 = aes_hash_enc_arm( aes_hash_enc_arm( veorq_u8( a0, vld1q_u8( p +  0 ) ), k0 ), k1 );
+        a1 = aes_hash_enc_arm( aes_hash_enc_arm( veorq_u8( a1, vld1q_u8( p + 16 ) ), k0 ), k1 );
+        a2 = aes_hash_enc_arm( aes_hash_enc_arm( veorq_u8( a2, vld1q_u8( p + 32 ) ), k0 ), k1 );
+        a3 = aes_hash_enc_arm( aes_hash_enc_arm( veorq_u8( a3, vld1q_u8( p + 48 ) ), k0 ), k1 );
+    }
+
+    vst1q_u8( a +  0, a0 );
+    vst1q_u8( a + 16, a1 );
+    vst1q_u8( a + 32, a2 );
+    vst1q_u8( a + 48, a3 );
+}
+
+inline void aes_hash_final_arm( unsigned char const k[ 64 ], unsigned char const a[ 64 ], unsigned char const w[ 16 ], unsigned char r[ 16 ] ) noexcept
+{
+    uint8x16_t const k0 = vld1q_u8( k +  0 );
+    uint8x16_t const k1 = vld1q_u8( k + 16 );
+    uint8x16_t const k2 = vld1q_u8( k + 32 );
+    uint8x16_t const k3 = vld1q_u8( k + 48 );
+
+    uint8x16_t h = veorq_u8( vld1q_u8( a ), vld1q_u8( w ) );
+
+    h = aes_hash_enc_arm( h, k2 );
+    h = aes_hash_enc_arm( veorq_u8( h, vld1q_u8( a + 16 ) ), k3 );
+    h = aes_hash_enc_arm( veorq_u8( h, vld1q_u8( a + 32 ) ), k2 );
+    h = aes_hash_enc_arm( veorq_u8( h, vld1q_u8( a + 48 ) ), k3 );
+    h = aes_hash_enc_arm( h, k0 );
+    h = aes_hash_enc_arm( h, k1 );
+
+    vst1q_u8( r, h );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_AES_HASH_ARM_HPP_INCLUDED
@@ -0,0 +1,110 @@
+#ifndef BOOST_HASH2_DETAIL_AES_HASH_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_AES_HASH_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// aes_hash_128 using AES-NI
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// k[ 0..15 ] is the first round key; computes the other three, in
+// k[ 16..63 ], and the initial lanes, from the constants pi[ 0..63 ]
+
+BOOST_HASH2_TARGET("aes,sse2")
+inline void aes_hash_init_x86( unsigned char k[ 64 ], unsigned char a[ 64 ], unsigned char const pi[ 64 ] ) noexcept
+{
+    __m128i const c4 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( pi + 48 ) );
+
+    __m128i k0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( k ) );
+    __m128i k1 = _mm_aesenc_si128( k0, _mm_loadu_si128( reinterpret_cast<__m128i const*>( pi +  0 ) ) );
+    __m128i k2 = _mm_aesenc_si128( k1, _mm_loadu_si128( reinterpret_cast<__m128i const*>( pi + 16 ) ) );
+    __m128i k3 = _mm_aesenc_si128( k2, _mm_loadu_si128( reinterpret_cast<__m128i const*>( pi + 32 ) ) );
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( k + 16 ), k1 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( k + 32 ), k2 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( k + 48 ), k3 );
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a +  0 ), _mm_xor_si128( k0, c4 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a + 16 ), _mm_xor_si128( k1, c4 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a + 32 ), _mm_xor_si128( k2, c4 ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a + 48 ), _mm_xor_si128( k3, c4 ) );
+}
+
+// absorbs n blocks of 64 bytes into the four lanes; the lanes are
+// independent, so the AESENC latency is hidden
+
+BOOST_HASH2_TARGET("aes,sse2")
+inline void aes_hash_blocks_x86( unsigned char const k[ 64 ], unsigned char a[ 64 ], unsigned char const* p, std::size_t n ) noexcept
+{
+    __m128i const k0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( k ) );
+    __m128i const k1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( k + 16 ) );
+
+    __m128i a0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( a +  0 ) );
+    __m128i a1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( a + 16 ) );
+    __m128i a2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( a + 32 ) );
+    __m128i a3 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( a + 48 ) );
+
+    for( ; n > 0; --n, p += 64 )
+    {
+        a0 = _mm_xor_si128( a0, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p +  0 ) ) );
+        a1 = _mm_xor_si128( a1, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 16 ) ) );
+        a2 = _mm_xor_si128( a2, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 32 ) ) );
+        a3 = _mm_xor_si128( a3, _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 48 ) ) );
+
+        a0 = _mm_aesenc_si128( _mm_aesenc_si128( a0, k0 ), k1 );
+        a1 = _mm_aesenc_si128( _mm_aesenc_si128( a1, k0 ), k1 );
+        a2 = _mm_aesenc_si128( _mm_aesenc_si128( a2, k0 ), k1 );
+        a3 = _mm_aesenc_si128( _mm_aesenc_si128( a3, k0 ), k1 );
+    }
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a +  0 ), a0 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a + 16 ), a1 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a + 32 ), a2 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( a + 48 ), a3 );
+}
+
+// folds the lanes and the 16 byte length block w into the result r
+
+BOOST_HASH2_TARGET("aes,sse2")
+inline void aes_hash_final_x86( unsigned char const k[ 64 ], unsigned char const a[ 64 ], unsigned char const w[ 16 ], unsigned char r[ 16 ] ) noexcept
+{
+    __m128i const k0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( k +  0 ) );
+    __m128i const k1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( k + 16 ) );
+    __m128i const k2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( k + 32 ) );
+    __m128i const k3 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( k + 48 ) );
+
+    __m128i h = _mm_xor_si128( _mm_loadu_si128( reinterpret_cast<__m128i const*>( a ) ), _mm_loadu_si128( reinterpret_cast<__m128i const*>( w ) ) );
+
+    h = _mm_aesenc_si128( h, k2 );
+    h = _mm_aesenc_si128( _mm_xor_si128( h, _mm_loadu_si128( reinterpret_cast<__m128i const*>( a + 16 ) ) ), k3 );
+    h = _mm_aesenc_si128( _mm_xor_si128( h, _mm_loadu_si128( reinterpret_cast<__m128i const*>( a + 32 ) ) ), k2 );
+    h = _mm_aesenc_si128( _mm_xor_si128( h, _mm_loadu_si128( reinterpret_cast<__m128i const*>( a + 48 ) ) ), k3 );
+    h = _mm_aesenc_si128( h, k0 );
+    h = _mm_aesenc_si128( h, k1 );
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( r ), h );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_AES_HASH_X86_HPP_INCLUDED
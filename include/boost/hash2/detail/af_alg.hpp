@@ -0,0 +1,261 @@
+#ifndef BOOST_HASH2_DETAIL_AF_ALG_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_AF_ALG_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Hashing a file with the Linux kernel crypto API (AF_ALG), which uses a
+// hardware engine when the platform has one; the pages of the file are
+// spliced to the socket from the page cache, without being copied to
+// user space
+//
+// Define BOOST_HASH2_DISABLE_AF_ALG to not use AF_ALG
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_HASH2_DISABLE_AF_ALG) && defined(__linux__) && ( defined(__GNUC__) || defined(__clang__) ) && defined(__has_include)
+# if __has_include(<linux/if_alg.h>)
+#  define BOOST_HASH2_HAS_AF_ALG
+# endif
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+class md5_128;
+class sha1_160;
+class sha2_256;
+class sha2_224;
+class sha2_512;
+class sha2_384;
+
+namespace detail
+{
+
+// the name of H in the kernel crypto API, or 0 when the kernel doesn't
+// implement it; the kernel digest is the result of a default-constructed H
+
+template<class H> struct af_alg_traits
+{
+    static char const* name() noexcept { return 0; }
+};
+
+template<> struct af_alg_traits<md5_128>
+{
+    static char const* name() noexcept { return "md5"; }
+};
+
+template<> struct af_alg_traits<sha1_160>
+{
+    static char const* name() noexcept { return "sha1"; }
+};
+
+template<> struct af_alg_traits<sha2_256>
+{
+    static char const* name() noexcept { return "sha256"; }
+};
+
+template<> struct af_alg_traits<sha2_224>
+{
+    static char const* name() noexcept { return "sha224"; }
+};
+
+template<> struct af_alg_traits<sha2_512>
+{
+    static char const* name() noexcept { return "sha512"; }
+};
+
+template<> struct af_alg_traits<sha2_384>
+{
+    static char const* name() noexcept { return "sha384"; }
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#if defined(BOOST_HASH2_HAS_AF_ALG)
+
+#include <linux/if_alg.h>
+#include <sys/socket.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <system_error>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if !defined(AF_ALG)
+# define AF_ALG 38
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+class af_alg_fd
+{
+private:
+
+    int fd_;
+
+public:
+
+    explicit af_alg_fd( int fd = -1 ) noexcept: fd_( fd )
+    {
+    }
+
+    af_alg_fd( af_alg_fd const& ) = delete;
+    af_alg_fd& operator=( af_alg_fd const& ) = delete;
+
+    ~af_alg_fd()
+    {
+        if( fd_ >= 0 ) ::close( fd_ );
+    }
+
+    int get() const noexcept
+    {
+        return fd_;
+    }
+};
+
+// the operation socket of the algorithm name, or -1 if the kernel doesn't
+// support AF_ALG or the algorithm
+
+inline int af_alg_open( char const* name ) noexcept
+{
+    af_alg_fd tfm( ::socket( AF_ALG, SOCK_SEQPACKET | SOCK_CLOEXEC, 0 ) );
+
+    if( tfm.get() < 0 ) return -1;
+
+    ::sockaddr_alg sa;
+    std::memset( &sa, 0, sizeof( sa ) );
+
+    sa.salg_family = AF_ALG;
+    std::strcpy( reinterpret_cast<char*>( sa.salg_type ), "hash" );
+    std::strncpy( reinterpret_cast<char*>( sa.salg_name ), name, sizeof( sa.salg_name ) - 1 );
+
+    if( ::bind( tfm.get(), reinterpret_cast<::sockaddr const*>( &sa ), sizeof( sa ) ) != 0 ) return -1;
+
+    int op;
+
+    do
+    {
+        op = ::accept4( tfm.get(), 0, 0, SOCK_CLOEXEC );
+    }
+    while( op < 0 && errno == EINTR );
+
+    return op;
+}
+
+// moves up to n bytes from in to out with splice(2); returns the number
+// moved, 0 at the end of the input, or -1 on error
+
+inline std::ptrdiff_t af_alg_splice( int in, ::loff_t* off, int out, std::size_t n, unsigned flags ) noexcept
+{
+    for( ;; )
+    {
+        ::ssize_t r = ::splice( in, off, out, 0, n, flags );
+
+        if( r < 0 && errno == EINTR ) continue;
+
+        return r;
+    }
+}
+
+// computes the digest of the first size bytes of the regular file fd,
+// with the kernel algorithm name, into the n bytes at out
+//
+// returns false, without setting ec, if AF_ALG, the algorithm, or splicing
+// from the file isn't supported; the caller then hashes the file itself
+
+inline bool hash_fd_af_alg( int fd, std::uint64_t size, char const* name, unsigned char* out, std::size_t n, std::error_code& ec )
+{
+    af_alg_fd op( detail::af_alg_open( name ) );
+
+    if( op.get() < 0 ) return false;
+
+    int p[ 2 ];
+
+    if( ::pipe2( p, O_CLOEXEC ) != 0 ) return false;
+
+    af_alg_fd p0( p[ 0 ] ), p1( p[ 1 ] );
+
+    // the pages move from the page cache through the pipe to the socket;
+    // SPLICE_F_MORE keeps the kernel from finalizing the digest until the
+    // read below
+
+    std::size_t const B = 64 * 1024;
+
+    ::loff_t off = 0;
+
+    for( bool first = true; static_cast<std::uint64_t>( off ) < size; first = false )
+    {
+        std::uint64_t const rest = size - static_cast<std::uint64_t>( off );
+
+        std::ptrdiff_t r = detail::af_alg_splice( fd, &off, p1.get(), rest < B? static_cast<std::size_t>( rest ): B, SPLICE_F_MOVE );
+
+        if( r < 0 )
+        {
+            if( first && ( errno == EINVAL || errno == ENOSYS ) ) return false;
+
+            ec.assign( errno, std::system_category() );
+            return true;
+        }
+
+        if( r == 0 )
+        {
+            // the file has been truncated
+            break;
+        }
+
+        for( std::size_t m = static_cast<std::size_t>( r ); m != 0; )
+        {
+            std::ptrdiff_t s = detail::af_alg_splice( p0.get(), 0, op.get(), m, SPLICE_F_MOVE | SPLICE_F_MORE );
+
+            if( s <= 0 )
+            {
+                if( first && s < 0 && ( errno == EINVAL || errno == ENOSYS ) ) return false;
+
+                ec.assign( s < 0? errno: EIO, std::system_category() );
+                return true;
+            }
+
+            m -= static_cast<std::size_t>( s );
+        }
+    }
+
+    std::size_t m = 0;
+
+    while( m < n )
+    {
+        ::ssize_t r = ::read( op.get(), out + m, n - m );
+
+        if( r < 0 && errno == EINTR ) continue;
+
+        if( r <= 0 )
+        {
+            ec.assign( r < 0? errno: EIO, std::system_category() );
+            return true;
+        }
+
+        m += static_cast<std::size_t>( r );
+    }
+
+    return true;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_AF_ALG)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_AF_ALG_HPP_INCLUDED
@@ -0,0 +1,141 @@
+#ifndef BOOST_HASH2_DETAIL_BASE64_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BASE64_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Base64 and base64url encoding and decoding (RFC 4648), used by
+// to_base64 and from_base64
+
+#include <boost/config.hpp>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// the number of characters in the encoding of n bytes
+
+constexpr std::size_t base64_size( std::size_t n, bool pad ) noexcept
+{
+    return pad? ( n + 2 ) / 3 * 4: ( n * 4 + 2 ) / 3;
+}
+
+// encodes [p, p+n) into the base64_size( n, pad ) characters at out,
+// using '-' and '_' instead of '+' and '/' when url is true
+
+inline BOOST_CXX14_CONSTEXPR void base64_encode( unsigned char const* p, std::size_t n, char* out, bool url, bool pad ) noexcept
+{
+    constexpr char digits[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    constexpr char digits_url[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+    char const* d = url? digits_url: digits;
+
+    std::size_t i = 0;
+
+    for( ; i + 3 <= n; i += 3 )
+    {
+        unsigned long w = static_cast<unsigned long>( p[ i ] ) << 16 | static_cast<unsigned long>( p[ i+1 ] ) << 8 | p[ i+2 ];
+
+        *out++ = d[ ( w >> 18 ) & 0x3F ];
+        *out++ = d[ ( w >> 12 ) & 0x3F ];
+        *out++ = d[ ( w >>  6 ) & 0x3F ];
+        *out++ = d[ w & 0x3F ];
+    }
+
+    if( n - i == 1 )
+    {
+        *out++ = d[ p[ i ] >> 2 ];
+        *out++ = d[ ( p[ i ] & 0x03 ) << 4 ];
+
+        if( pad )
+        {
+            *out++ = '=';
+            *out++ = '=';
+        }
+    }
+    else if( n - i == 2 )
+    {
+        *out++ = d[ p[ i ] >> 2 ];
+        *out++ = d[ ( p[ i ] & 0x03 ) << 4 | p[ i+1 ] >> 4 ];
+        *out++ = d[ ( p[ i+1 ] & 0x0F ) << 2 ];
+
+        if( pad )
+        {
+            *out++ = '=';
+        }
+    }
+}
+
+// the value of the base64 digit c, or -1
+
+inline BOOST_CXX14_CONSTEXPR int base64_value( char c, bool url ) noexcept
+{
+    return
+        c >= 'A' && c <= 'Z'? c - 'A':
+        c >= 'a' && c <= 'z'? c - 'a' + 26:
+        c >= '0' && c <= '9'? c - '0' + 52:
+        c == ( url? '-': '+' )? 62:
+        c == ( url? '_': '/' )? 63:
+        -1;
+}
+
+// decodes the base64_size( n, pad ) characters at p into [out, out+n);
+// returns false if one of them isn't a base64 digit or padding in its
+// place, or if the unused bits of the last digit aren't zero
+
+inline BOOST_CXX14_CONSTEXPR bool base64_decode( char const* p, std::size_t n, unsigned char* out, bool url, bool pad ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 3 <= n; i += 3 )
+    {
+        int a = detail::base64_value( p[ 0 ], url );
+        int b = detail::base64_value( p[ 1 ], url );
+        int c = detail::base64_value( p[ 2 ], url );
+        int d = detail::base64_value( p[ 3 ], url );
+
+        if( ( a | b | c | d ) < 0 ) return false;
+
+        out[ i+0 ] = static_cast<unsigned char>( a << 2 | b >> 4 );
+        out[ i+1 ] = static_cast<unsigned char>( ( b & 0x0F ) << 4 | c >> 2 );
+        out[ i+2 ] = static_cast<unsigned char>( ( c & 0x03 ) << 6 | d );
+
+        p += 4;
+    }
+
+    if( n - i == 1 )
+    {
+        int a = detail::base64_value( p[ 0 ], url );
+        int b = detail::base64_value( p[ 1 ], url );
+
+        if( ( a | b ) < 0 || ( b & 0x0F ) != 0 ) return false;
+        if( pad && ( p[ 2 ] != '=' || p[ 3 ] != '=' ) ) return false;
+
+        out[ i ] = static_cast<unsigned char>( a << 2 | b >> 4 );
+    }
+    else if( n - i == 2 )
+    {
+        int a = detail::base64_value( p[ 0 ], url );
+        int b = detail::base64_value( p[ 1 ], url );
+        int c = detail::base64_value( p[ 2 ], url );
+
+        if( ( a | b | c ) < 0 || ( c & 0x03 ) != 0 ) return false;
+        if( pad && p[ 3 ] != '=' ) return false;
+
+        out[ i+0 ] = static_cast<unsigned char>( a << 2 | b >> 4 );
+        out[ i+1 ] = static_cast<unsigned char>( ( b & 0x0F ) << 4 | c >> 2 );
+    }
+
+    return true;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BASE64_HPP_INCLUDED
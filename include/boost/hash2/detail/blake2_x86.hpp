@@ -0,0 +1,348 @@
+#ifndef BOOST_HASH2_DETAIL_BLAKE2_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BLAKE2_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// BLAKE2b and BLAKE2s compression using SSE4.1 and AVX2
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The state is kept as four rows, v[0..3], v[4..7], v[8..11], v[12..15];
+// the column step operates on the rows directly, and the diagonal step
+// after rotating rows 1, 2 and 3 by one, two and three words.
+//
+// The template arguments of the round functions are the message word
+// order for the round, so that the message vectors are assembled with
+// constant indices.
+
+// BLAKE2s, SSE4.1
+
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+BOOST_FORCEINLINE void blake2s_g_sse41( __m128i& a, __m128i& b, __m128i& c, __m128i& d, __m128i x, __m128i y ) noexcept
+{
+    __m128i const r16 = _mm_setr_epi8( 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 );
+    __m128i const r8 = _mm_setr_epi8( 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 );
+
+    a = _mm_add_epi32( _mm_add_epi32( a, b ), x );
+    d = _mm_shuffle_epi8( _mm_xor_si128( d, a ), r16 );
+    c = _mm_add_epi32( c, d );
+    b = _mm_xor_si128( b, c );
+    b = _mm_or_si128( _mm_srli_epi32( b, 12 ), _mm_slli_epi32( b, 20 ) );
+    a = _mm_add_epi32( _mm_add_epi32( a, b ), y );
+    d = _mm_shuffle_epi8( _mm_xor_si128( d, a ), r8 );
+    c = _mm_add_epi32( c, d );
+    b = _mm_xor_si128( b, c );
+    b = _mm_or_si128( _mm_srli_epi32( b, 7 ), _mm_slli_epi32( b, 25 ) );
+}
+
+template<int s0, int s1, int s2, int s3, int s4, int s5, int s6, int s7, int s8, int s9, int s10, int s11, int s12, int s13, int s14, int s15>
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+BOOST_FORCEINLINE void blake2s_round_sse41( __m128i& a, __m128i& b, __m128i& c, __m128i& d, std::uint32_t const m[ 16 ] ) noexcept
+{
+    blake2s_g_sse41( a, b, c, d,
+        _mm_setr_epi32( static_cast<int>( m[ s0 ] ), static_cast<int>( m[ s2 ] ), static_cast<int>( m[ s4 ] ), static_cast<int>( m[ s6 ] ) ),
+        _mm_setr_epi32( static_cast<int>( m[ s1 ] ), static_cast<int>( m[ s3 ] ), static_cast<int>( m[ s5 ] ), static_cast<int>( m[ s7 ] ) ) );
+
+    b = _mm_shuffle_epi32( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+    c = _mm_shuffle_epi32( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    d = _mm_shuffle_epi32( d, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+
+    blake2s_g_sse41( a, b, c, d,
+        _mm_setr_epi32( static_cast<int>( m[ s8 ] ), static_cast<int>( m[ s10 ] ), static_cast<int>( m[ s12 ] ), static_cast<int>( m[ s14 ] ) ),
+        _mm_setr_epi32( static_cast<int>( m[ s9 ] ), static_cast<int>( m[ s11 ] ), static_cast<int>( m[ s13 ] ), static_cast<int>( m[ s15 ] ) ) );
+
+    b = _mm_shuffle_epi32( b, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+    c = _mm_shuffle_epi32( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    d = _mm_shuffle_epi32( d, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+}
+
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+inline void blake2s_compress_sse41( std::uint32_t h[ 8 ], unsigned char const block[ 64 ], std::uint32_t t0, std::uint32_t t1, std::uint32_t f0 ) noexcept
+{
+    std::uint32_t m[ 16 ];
+    std::memcpy( m, block, 64 );
+
+    __m128i const h0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 0 ) );
+    __m128i const h1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 4 ) );
+
+    __m128i a = h0;
+    __m128i b = h1;
+    __m128i c = _mm_setr_epi32( 0x6A09E667, static_cast<int>( 0xBB67AE85 ), 0x3C6EF372, static_cast<int>( 0xA54FF53A ) );
+    __m128i d = _mm_xor_si128( _mm_setr_epi32( 0x510E527F, static_cast<int>( 0x9B05688C ), 0x1F83D9AB, 0x5BE0CD19 ), _mm_setr_epi32( static_cast<int>( t0 ), static_cast<int>( t1 ), static_cast<int>( f0 ), 0 ) );
+
+    blake2s_round_sse41<  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 >( a, b, c, d, m );
+    blake2s_round_sse41< 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 >( a, b, c, d, m );
+    blake2s_round_sse41< 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 >( a, b, c, d, m );
+    blake2s_round_sse41<  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 >( a, b, c, d, m );
+    blake2s_round_sse41<  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 >( a, b, c, d, m );
+    blake2s_round_sse41<  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 >( a, b, c, d, m );
+    blake2s_round_sse41< 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 >( a, b, c, d, m );
+    blake2s_round_sse41< 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 >( a, b, c, d, m );
+    blake2s_round_sse41<  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 >( a, b, c, d, m );
+    blake2s_round_sse41< 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 >( a, b, c, d, m );
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 0 ), _mm_xor_si128( h0, _mm_xor_si128( a, c ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 4 ), _mm_xor_si128( h1, _mm_xor_si128( b, d ) ) );
+}
+
+// BLAKE2b, SSE4.1
+//
+// Each row of four 64 bit words is held in two registers, l and h
+
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+BOOST_FORCEINLINE __m128i blake2b_rotr63_sse41( __m128i x ) noexcept
+{
+    return _mm_or_si128( _mm_srli_epi64( x, 63 ), _mm_add_epi64( x, x ) );
+}
+
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+BOOST_FORCEINLINE void blake2b_g_sse41( __m128i& a, __m128i& b, __m128i& c, __m128i& d, __m128i x, __m128i y ) noexcept
+{
+    __m128i const r24 = _mm_setr_epi8( 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10 );
+    __m128i const r16 = _mm_setr_epi8( 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9 );
+
+    a = _mm_add_epi64( _mm_add_epi64( a, b ), x );
+    d = _mm_shuffle_epi32( _mm_xor_si128( d, a ), _MM_SHUFFLE( 2, 3, 0, 1 ) );
+    c = _mm_add_epi64( c, d );
+    b = _mm_shuffle_epi8( _mm_xor_si128( b, c ), r24 );
+    a = _mm_add_epi64( _mm_add_epi64( a, b ), y );
+    d = _mm_shuffle_epi8( _mm_xor_si128( d, a ), r16 );
+    c = _mm_add_epi64( c, d );
+    b = blake2b_rotr63_sse41( _mm_xor_si128( b, c ) );
+}
+
+// returns the message words i and j from the eight registers holding
+// the block, in the low and the high lane, respectively
+
+template<int i, int j>
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+BOOST_FORCEINLINE __m128i blake2b_load_sse41( __m128i const m[ 8 ] ) noexcept
+{
+    if( i / 2 == j / 2 )
+    {
+        return i % 2 == 0? m[ i / 2 ]: _mm_shuffle_epi32( m[ i / 2 ], _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    }
+    else if( i % 2 == 0 && j % 2 == 0 )
+    {
+        return _mm_unpacklo_epi64( m[ i / 2 ], m[ j / 2 ] );
+    }
+    else if( i % 2 == 1 && j % 2 == 1 )
+    {
+        return _mm_unpackhi_epi64( m[ i / 2 ], m[ j / 2 ] );
+    }
+    else if( i % 2 == 0 )
+    {
+        return _mm_blend_epi16( m[ i / 2 ], m[ j / 2 ], 0xF0 );
+    }
+    else
+    {
+        return _mm_alignr_epi8( m[ j / 2 ], m[ i / 2 ], 8 );
+    }
+}
+
+struct blake2b_rows_sse41
+{
+    __m128i a0, a1, b0, b1, c0, c1, d0, d1;
+};
+
+template<int s0, int s1, int s2, int s3, int s4, int s5, int s6, int s7, int s8, int s9, int s10, int s11, int s12, int s13, int s14, int s15>
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+BOOST_FORCEINLINE void blake2b_round_sse41( blake2b_rows_sse41& v, __m128i const m[ 8 ] ) noexcept
+{
+    blake2b_g_sse41( v.a0, v.b0, v.c0, v.d0, blake2b_load_sse41<s0, s2>( m ), blake2b_load_sse41<s1, s3>( m ) );
+    blake2b_g_sse41( v.a1, v.b1, v.c1, v.d1, blake2b_load_sse41<s4, s6>( m ), blake2b_load_sse41<s5, s7>( m ) );
+
+    // diagonalize
+
+    {
+        __m128i t0 = _mm_alignr_epi8( v.b1, v.b0, 8 );
+        __m128i t1 = _mm_alignr_epi8( v.b0, v.b1, 8 );
+
+        v.b0 = t0;
+        v.b1 = t1;
+
+        t0 = v.c0;
+        v.c0 = v.c1;
+        v.c1 = t0;
+
+        t0 = _mm_alignr_epi8( v.d1, v.d0, 8 );
+        t1 = _mm_alignr_epi8( v.d0, v.d1, 8 );
+
+        v.d0 = t1;
+        v.d1 = t0;
+    }
+
+    blake2b_g_sse41( v.a0, v.b0, v.c0, v.d0, blake2b_load_sse41<s8, s10>( m ), blake2b_load_sse41<s9, s11>( m ) );
+    blake2b_g_sse41( v.a1, v.b1, v.c1, v.d1, blake2b_load_sse41<s12, s14>( m ), blake2b_load_sse41<s13, s15>( m ) );
+
+    // undiagonalize
+
+    {
+        __m128i t0 = _mm_alignr_epi8( v.b0, v.b1, 8 );
+        __m128i t1 = _mm_alignr_epi8( v.b1, v.b0, 8 );
+
+        v.b0 = t0;
+        v.b1 = t1;
+
+        t0 = v.c0;
+        v.c0 = v.c1;
+        v.c1 = t0;
+
+        t0 = _mm_alignr_epi8( v.d0, v.d1, 8 );
+        t1 = _mm_alignr_epi8( v.d1, v.d0, 8 );
+
+        v.d0 = t1;
+        v.d1 = t0;
+    }
+}
+
+BOOST_HASH2_TARGET("ssse3,sse4.1")
+inline void blake2b_compress_sse41( std::uint64_t h[ 8 ], unsigned char const block[ 128 ], std::uint64_t t0, std::uint64_t t1, std::uint64_t f0 ) noexcept
+{
+    __m128i m[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        m[ i ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 16 * i ) );
+    }
+
+    __m128i const h0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 0 ) );
+    __m128i const h1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 2 ) );
+    __m128i const h2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 4 ) );
+    __m128i const h3 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( h + 6 ) );
+
+    blake2b_rows_sse41 v =
+    {
+        h0, h1, h2, h3,
+        _mm_set_epi64x( static_cast<long long>( 0xbb67ae8584caa73bULL ), 0x6a09e667f3bcc908LL ),
+        _mm_set_epi64x( static_cast<long long>( 0xa54ff53a5f1d36f1ULL ), 0x3c6ef372fe94f82bLL ),
+        _mm_xor_si128( _mm_set_epi64x( static_cast<long long>( 0x9b05688c2b3e6c1fULL ), 0x510e527fade682d1LL ), _mm_set_epi64x( static_cast<long long>( t1 ), static_cast<long long>( t0 ) ) ),
+        _mm_xor_si128( _mm_set_epi64x( 0x5be0cd19137e2179LL, 0x1f83d9abfb41bd6bLL ), _mm_set_epi64x( 0, static_cast<long long>( f0 ) ) ),
+    };
+
+    blake2b_round_sse41<  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 >( v, m );
+    blake2b_round_sse41< 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 >( v, m );
+    blake2b_round_sse41< 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 >( v, m );
+    blake2b_round_sse41<  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 >( v, m );
+    blake2b_round_sse41<  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 >( v, m );
+    blake2b_round_sse41<  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 >( v, m );
+    blake2b_round_sse41< 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 >( v, m );
+    blake2b_round_sse41< 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 >( v, m );
+    blake2b_round_sse41<  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 >( v, m );
+    blake2b_round_sse41< 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 >( v, m );
+    blake2b_round_sse41<  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 >( v, m );
+    blake2b_round_sse41< 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 >( v, m );
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 0 ), _mm_xor_si128( h0, _mm_xor_si128( v.a0, v.c0 ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 2 ), _mm_xor_si128( h1, _mm_xor_si128( v.a1, v.c1 ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 4 ), _mm_xor_si128( h2, _mm_xor_si128( v.b0, v.d0 ) ) );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( h + 6 ), _mm_xor_si128( h3, _mm_xor_si128( v.b1, v.d1 ) ) );
+}
+
+// BLAKE2b, AVX2
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void blake2b_g_avx2( __m256i& a, __m256i& b, __m256i& c, __m256i& d, __m256i x, __m256i y ) noexcept
+{
+    __m256i const r24 = _mm256_setr_epi8( 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10, 3, 4, 5, 6, 7, 0, 1, 2, 11, 12, 13, 14, 15, 8, 9, 10 );
+    __m256i const r16 = _mm256_setr_epi8( 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9, 2, 3, 4, 5, 6, 7, 0, 1, 10, 11, 12, 13, 14, 15, 8, 9 );
+
+    a = _mm256_add_epi64( _mm256_add_epi64( a, b ), x );
+    d = _mm256_shuffle_epi32( _mm256_xor_si256( d, a ), _MM_SHUFFLE( 2, 3, 0, 1 ) );
+    c = _mm256_add_epi64( c, d );
+    b = _mm256_shuffle_epi8( _mm256_xor_si256( b, c ), r24 );
+    a = _mm256_add_epi64( _mm256_add_epi64( a, b ), y );
+    d = _mm256_shuffle_epi8( _mm256_xor_si256( d, a ), r16 );
+    c = _mm256_add_epi64( c, d );
+    b = _mm256_xor_si256( b, c );
+    b = _mm256_or_si256( _mm256_srli_epi64( b, 63 ), _mm256_add_epi64( b, b ) );
+}
+
+template<int i, int j, int k, int l>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i blake2b_load_avx2( __m128i const m[ 8 ] ) noexcept
+{
+    __m128i const lo = blake2b_load_sse41<i, j>( m );
+    __m128i const hi = blake2b_load_sse41<k, l>( m );
+
+    return _mm256_inserti128_si256( _mm256_castsi128_si256( lo ), hi, 1 );
+}
+
+template<int s0, int s1, int s2, int s3, int s4, int s5, int s6, int s7, int s8, int s9, int s10, int s11, int s12, int s13, int s14, int s15>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void blake2b_round_avx2( __m256i& a, __m256i& b, __m256i& c, __m256i& d, __m128i const m[ 8 ] ) noexcept
+{
+    blake2b_g_avx2( a, b, c, d, blake2b_load_avx2<s0, s2, s4, s6>( m ), blake2b_load_avx2<s1, s3, s5, s7>( m ) );
+
+    b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+    c = _mm256_permute4x64_epi64( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    d = _mm256_permute4x64_epi64( d, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+
+    blake2b_g_avx2( a, b, c, d, blake2b_load_avx2<s8, s10, s12, s14>( m ), blake2b_load_avx2<s9, s11, s13, s15>( m ) );
+
+    b = _mm256_permute4x64_epi64( b, _MM_SHUFFLE( 2, 1, 0, 3 ) );
+    c = _mm256_permute4x64_epi64( c, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+    d = _mm256_permute4x64_epi64( d, _MM_SHUFFLE( 0, 3, 2, 1 ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline void blake2b_compress_avx2( std::uint64_t h[ 8 ], unsigned char const block[ 128 ], std::uint64_t t0, std::uint64_t t1, std::uint64_t f0 ) noexcept
+{
+    __m128i m[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        m[ i ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + 16 * i ) );
+    }
+
+    __m256i const h0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( h + 0 ) );
+    __m256i const h1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( h + 4 ) );
+
+    __m256i a = h0;
+    __m256i b = h1;
+    __m256i c = _mm256_setr_epi64x( 0x6a09e667f3bcc908LL, static_cast<long long>( 0xbb67ae8584caa73bULL ), 0x3c6ef372fe94f82bLL, static_cast<long long>( 0xa54ff53a5f1d36f1ULL ) );
+    __m256i d = _mm256_xor_si256(
+        _mm256_setr_epi64x( 0x510e527fade682d1LL, static_cast<long long>( 0x9b05688c2b3e6c1fULL ), 0x1f83d9abfb41bd6bLL, 0x5be0cd19137e2179LL ),
+        _mm256_setr_epi64x( static_cast<long long>( t0 ), static_cast<long long>( t1 ), static_cast<long long>( f0 ), 0 ) );
+
+    blake2b_round_avx2<  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 >( a, b, c, d, m );
+    blake2b_round_avx2< 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 >( a, b, c, d, m );
+    blake2b_round_avx2< 11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4 >( a, b, c, d, m );
+    blake2b_round_avx2<  7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8 >( a, b, c, d, m );
+    blake2b_round_avx2<  9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13 >( a, b, c, d, m );
+    blake2b_round_avx2<  2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9 >( a, b, c, d, m );
+    blake2b_round_avx2< 12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11 >( a, b, c, d, m );
+    blake2b_round_avx2< 13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10 >( a, b, c, d, m );
+    blake2b_round_avx2<  6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5 >( a, b, c, d, m );
+    blake2b_round_avx2< 10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13,  0 >( a, b, c, d, m );
+    blake2b_round_avx2<  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15 >( a, b, c, d, m );
+    blake2b_round_avx2< 14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3 >( a, b, c, d, m );
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( h + 0 ), _mm256_xor_si256( h0, _mm256_xor_si256( a, c ) ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( h + 4 ), _mm256_xor_si256( h1, _mm256_xor_si256( b, d ) ) );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BLAKE2_X86_HPP_INCLUDED
@@ -0,0 +1,149 @@
+#ifndef BOOST_HASH2_DETAIL_BLAKE3_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BLAKE3_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// BLAKE3 multi-input compression using NEON
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// see blake3_x86.hpp for the description of the arguments
+
+template<int K>
+inline uint32x4_t blake3_rotr_neon( uint32x4_t x ) noexcept
+{
+    return vsriq_n_u32( vshlq_n_u32( x, 32 - K ), x, K );
+}
+
+inline uint32x4_t blake3_rotr16_neon( uint32x4_t x ) noexcept
+{
+    return vreinterpretq_u32_u16( vrev32q_u16( vreinterpretq_u16_u32( x ) ) );
+}
+
+inline void blake3_g_neon( uint32x4_t v[ 16 ], int a, int b, int c, int d, uint32x4_t x, uint32x4_t y ) noexcept
+{
+    v[ a ] = vaddq_u32( vaddq_u32( v[ a ], v[ b ] ), x );
+    v[ d ] = blake3_rotr16_neon( veorq_u32( v[ d ], v[ a ] ) );
+    v[ c ] = vaddq_u32( v[ c ], v[ d ] );
+    v[ b ] = blake3_rotr_neon<12>( veorq_u32( v[ b ], v[ c ] ) );
+    v[ a ] = vaddq_u32( vaddq_u32( v[ a ], v[ b ] ), y );
+    v[ d ] = blake3_rotr_neon<8>( veorq_u32( v[ d ], v[ a ] ) );
+    v[ c ] = vaddq_u32( v[ c ], v[ d ] );
+    v[ b ] = blake3_rotr_neon<7>( veorq_u32( v[ b ], v[ c ] ) );
+}
+
+inline void blake3_transpose_neon( uint32x4_t v[ 4 ] ) noexcept
+{
+    uint32x4x2_t ab = vtrnq_u32( v[ 0 ], v[ 1 ] );
+    uint32x4x2_t cd = vtrnq_u32( v[ 2 ], v[ 3 ] );
+
+    v[ 0 ] = vcombine_u32( vget_low_u32( ab.val[ 0 ] ), vget_low_u32( cd.val[ 0 ] ) );
+    v[ 1 ] = vcombine_u32( vget_low_u32( ab.val[ 1 ] ), vget_low_u32( cd.val[ 1 ] ) );
+    v[ 2 ] = vcombine_u32( vget_high_u32( ab.val[ 0 ] ), vget_high_u32( cd.val[ 0 ] ) );
+    v[ 3 ] = vcombine_u32( vget_high_u32( ab.val[ 1 ] ), vget_high_u32( cd.val[ 1 ] ) );
+}
+
+inline void blake3_hash_many_neon( unsigned char const* const inputs[ 4 ], std::size_t blocks, std::uint32_t const key[ 8 ], std::uint64_t counter, bool increment_counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char const S[ 7 ][ 16 ], unsigned char* out ) noexcept
+{
+    uint32x4_t h[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        h[ i ] = vdupq_n_u32( key[ i ] );
+    }
+
+    std::uint32_t cl[ 4 ], ch[ 4 ];
+
+    for( int j = 0; j < 4; ++j )
+    {
+        std::uint64_t c = counter + ( increment_counter? j: 0 );
+
+        cl[ j ] = static_cast<std::uint32_t>( c );
+        ch[ j ] = static_cast<std::uint32_t>( c >> 32 );
+    }
+
+    uint32x4_t const counter_lo = vld1q_u32( cl );
+    uint32x4_t const counter_hi = vld1q_u32( ch );
+
+    std::uint32_t block_flags = flags | flags_start;
+
+    for( std::size_t k = 0; k < blocks; ++k )
+    {
+        if( k + 1 == blocks )
+        {
+            block_flags |= flags_end;
+        }
+
+        uint32x4_t m[ 16 ];
+
+        for( int i = 0; i < 4; ++i )
+        {
+            for( int j = 0; j < 4; ++j )
+            {
+                m[ i * 4 + j ] = vreinterpretq_u32_u8( vld1q_u8( inputs[ j ] + k * 64 + i * 16 ) );
+            }
+
+            blake3_transpose_neon( m + i * 4 );
+        }
+
+        uint32x4_t v[ 16 ] =
+        {
+            h[ 0 ], h[ 1 ], h[ 2 ], h[ 3 ], h[ 4 ], h[ 5 ], h[ 6 ], h[ 7 ],
+            vdupq_n_u32( 0x6A09E667 ), vdupq_n_u32( 0xBB67AE85 ), vdupq_n_u32( 0x3C6EF372 ), vdupq_n_u32( 0xA54FF53A ),
+            counter_lo, counter_hi, vdupq_n_u32( 64 ), vdupq_n_u32( block_flags ),
+        };
+
+        for( int r = 0; r < 7; ++r )
+        {
+            unsigned char const* s = S[ r ];
+
+            blake3_g_neon( v, 0, 4,  8, 12, m[ s[  0 ] ], m[ s[  1 ] ] );
+            blake3_g_neon( v, 1, 5,  9, 13, m[ s[  2 ] ], m[ s[  3 ] ] );
+            blake3_g_neon( v, 2, 6, 10, 14, m[ s[  4 ] ], m[ s[  5 ] ] );
+            blake3_g_neon( v, 3, 7, 11, 15, m[ s[  6 ] ], m[ s[  7 ] ] );
+            blake3_g_neon( v, 0, 5, 10, 15, m[ s[  8 ] ], m[ s[  9 ] ] );
+            blake3_g_neon( v, 1, 6, 11, 12, m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            blake3_g_neon( v, 2, 7,  8, 13, m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            blake3_g_neon( v, 3, 4,  9, 14, m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] = veorq_u32( v[ i ], v[ i + 8 ] );
+        }
+
+        block_flags = flags;
+    }
+
+    blake3_transpose_neon( h + 0 );
+    blake3_transpose_neon( h + 4 );
+
+    for( int j = 0; j < 4; ++j )
+    {
+        vst1q_u8( out + j * 32 +  0, vreinterpretq_u8_u32( h[ j ] ) );
+        vst1q_u8( out + j * 32 + 16, vreinterpretq_u8_u32( h[ j + 4 ] ) );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BLAKE3_ARM_HPP_INCLUDED
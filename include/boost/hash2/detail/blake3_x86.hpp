@@ -0,0 +1,401 @@
+#ifndef BOOST_HASH2_DETAIL_BLAKE3_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BLAKE3_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// BLAKE3 multi-input compression using SSE4.1 and AVX2
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/config.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The hash_many functions compress W inputs of `blocks` 64 byte blocks each,
+// one input per SIMD lane, and store the W resulting chaining values to out.
+// The counter of input i is counter + i when increment_counter is set, counter
+// otherwise; flags_start is added to the first block, flags_end to the last.
+// S is the message schedule, S[ r ] giving the word order for round r.
+
+// SSE4.1, four lanes
+
+BOOST_HASH2_TARGET("sse4.1")
+inline __m128i blake3_rotr16_sse41( __m128i x ) noexcept
+{
+    return _mm_shuffle_epi8( x, _mm_setr_epi8( 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 ) );
+}
+
+BOOST_HASH2_TARGET("sse4.1")
+inline __m128i blake3_rotr8_sse41( __m128i x ) noexcept
+{
+    return _mm_shuffle_epi8( x, _mm_setr_epi8( 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 ) );
+}
+
+template<int K>
+BOOST_HASH2_TARGET("sse4.1")
+inline __m128i blake3_rotr_sse41( __m128i x ) noexcept
+{
+    return _mm_or_si128( _mm_srli_epi32( x, K ), _mm_slli_epi32( x, 32 - K ) );
+}
+
+BOOST_HASH2_TARGET("sse4.1")
+inline void blake3_g_sse41( __m128i v[ 16 ], int a, int b, int c, int d, __m128i x, __m128i y ) noexcept
+{
+    v[ a ] = _mm_add_epi32( _mm_add_epi32( v[ a ], v[ b ] ), x );
+    v[ d ] = blake3_rotr16_sse41( _mm_xor_si128( v[ d ], v[ a ] ) );
+    v[ c ] = _mm_add_epi32( v[ c ], v[ d ] );
+    v[ b ] = blake3_rotr_sse41<12>( _mm_xor_si128( v[ b ], v[ c ] ) );
+    v[ a ] = _mm_add_epi32( _mm_add_epi32( v[ a ], v[ b ] ), y );
+    v[ d ] = blake3_rotr8_sse41( _mm_xor_si128( v[ d ], v[ a ] ) );
+    v[ c ] = _mm_add_epi32( v[ c ], v[ d ] );
+    v[ b ] = blake3_rotr_sse41<7>( _mm_xor_si128( v[ b ], v[ c ] ) );
+}
+
+BOOST_HASH2_TARGET("sse4.1")
+inline void blake3_transpose_sse41( __m128i v[ 4 ] ) noexcept
+{
+    __m128i ab_01 = _mm_unpacklo_epi32( v[ 0 ], v[ 1 ] );
+    __m128i ab_23 = _mm_unpackhi_epi32( v[ 0 ], v[ 1 ] );
+    __m128i cd_01 = _mm_unpacklo_epi32( v[ 2 ], v[ 3 ] );
+    __m128i cd_23 = _mm_unpackhi_epi32( v[ 2 ], v[ 3 ] );
+
+    v[ 0 ] = _mm_unpacklo_epi64( ab_01, cd_01 );
+    v[ 1 ] = _mm_unpackhi_epi64( ab_01, cd_01 );
+    v[ 2 ] = _mm_unpacklo_epi64( ab_23, cd_23 );
+    v[ 3 ] = _mm_unpackhi_epi64( ab_23, cd_23 );
+}
+
+BOOST_HASH2_TARGET("sse4.1")
+inline void blake3_hash_many_sse41( unsigned char const* const inputs[ 4 ], std::size_t blocks, std::uint32_t const key[ 8 ], std::uint64_t counter, bool increment_counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char const S[ 7 ][ 16 ], unsigned char* out ) noexcept
+{
+    __m128i h[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        h[ i ] = _mm_set1_epi32( static_cast<int>( key[ i ] ) );
+    }
+
+    std::uint32_t cl[ 4 ], ch[ 4 ];
+
+    for( int j = 0; j < 4; ++j )
+    {
+        std::uint64_t c = counter + ( increment_counter? j: 0 );
+
+        cl[ j ] = static_cast<std::uint32_t>( c );
+        ch[ j ] = static_cast<std::uint32_t>( c >> 32 );
+    }
+
+    __m128i const counter_lo = _mm_loadu_si128( reinterpret_cast<__m128i const*>( cl ) );
+    __m128i const counter_hi = _mm_loadu_si128( reinterpret_cast<__m128i const*>( ch ) );
+
+    std::uint32_t block_flags = flags | flags_start;
+
+    for( std::size_t k = 0; k < blocks; ++k )
+    {
+        if( k + 1 == blocks )
+        {
+            block_flags |= flags_end;
+        }
+
+        __m128i m[ 16 ];
+
+        for( int i = 0; i < 4; ++i )
+        {
+            for( int j = 0; j < 4; ++j )
+            {
+                m[ i * 4 + j ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( inputs[ j ] + k * 64 + i * 16 ) );
+            }
+
+            blake3_transpose_sse41( m + i * 4 );
+        }
+
+        __m128i v[ 16 ] =
+        {
+            h[ 0 ], h[ 1 ], h[ 2 ], h[ 3 ], h[ 4 ], h[ 5 ], h[ 6 ], h[ 7 ],
+            _mm_set1_epi32( 0x6A09E667 ), _mm_set1_epi32( static_cast<int>( 0xBB67AE85 ) ), _mm_set1_epi32( 0x3C6EF372 ), _mm_set1_epi32( static_cast<int>( 0xA54FF53A ) ),
+            counter_lo, counter_hi, _mm_set1_epi32( 64 ), _mm_set1_epi32( static_cast<int>( block_flags ) ),
+        };
+
+        for( int r = 0; r < 7; ++r )
+        {
+            unsigned char const* s = S[ r ];
+
+            blake3_g_sse41( v, 0, 4,  8, 12, m[ s[  0 ] ], m[ s[  1 ] ] );
+            blake3_g_sse41( v, 1, 5,  9, 13, m[ s[  2 ] ], m[ s[  3 ] ] );
+            blake3_g_sse41( v, 2, 6, 10, 14, m[ s[  4 ] ], m[ s[  5 ] ] );
+            blake3_g_sse41( v, 3, 7, 11, 15, m[ s[  6 ] ], m[ s[  7 ] ] );
+            blake3_g_sse41( v, 0, 5, 10, 15, m[ s[  8 ] ], m[ s[  9 ] ] );
+            blake3_g_sse41( v, 1, 6, 11, 12, m[ s[ 10 ] ], m[ s[ 11 ] ] );
+            blake3_g_sse41( v, 2, 7,  8, 13, m[ s[ 12 ] ], m[ s[ 13 ] ] );
+            blake3_g_sse41( v, 3, 4,  9, 14, m[ s[ 14 ] ], m[ s[ 15 ] ] );
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] = _mm_xor_si128( v[ i ], v[ i + 8 ] );
+        }
+
+        block_flags = flags;
+    }
+
+    blake3_transpose_sse41( h + 0 );
+    blake3_transpose_sse41( h + 4 );
+
+    for( int j = 0; j < 4; ++j )
+    {
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + j * 32 +  0 ), h[ j ] );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + j * 32 + 16 ), h[ j + 4 ] );
+    }
+}
+
+// AVX2, eight lanes
+
+BOOST_HASH2_TARGET("avx2")
+inline __m256i blake3_rotr16_avx2( __m256i x ) noexcept
+{
+    return _mm256_shuffle_epi8( x, _mm256_setr_epi8(
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13,
+        2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13 ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline __m256i blake3_rotr8_avx2( __m256i x ) noexcept
+{
+    return _mm256_shuffle_epi8( x, _mm256_setr_epi8(
+        1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12,
+        1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12 ) );
+}
+
+template<int K>
+BOOST_HASH2_TARGET("avx2")
+inline __m256i blake3_rotr_avx2( __m256i x ) noexcept
+{
+    return _mm256_or_si256( _mm256_srli_epi32( x, K ), _mm256_slli_epi32( x, 32 - K ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void blake3_g_avx2( __m256i v[ 16 ], int a, int b, int c, int d, __m256i x, __m256i y ) noexcept
+{
+    v[ a ] = _mm256_add_epi32( _mm256_add_epi32( v[ a ], v[ b ] ), x );
+    v[ d ] = blake3_rotr16_avx2( _mm256_xor_si256( v[ d ], v[ a ] ) );
+    v[ c ] = _mm256_add_epi32( v[ c ], v[ d ] );
+    v[ b ] = blake3_rotr_avx2<12>( _mm256_xor_si256( v[ b ], v[ c ] ) );
+    v[ a ] = _mm256_add_epi32( _mm256_add_epi32( v[ a ], v[ b ] ), y );
+    v[ d ] = blake3_rotr8_avx2( _mm256_xor_si256( v[ d ], v[ a ] ) );
+    v[ c ] = _mm256_add_epi32( v[ c ], v[ d ] );
+    v[ b ] = blake3_rotr_avx2<7>( _mm256_xor_si256( v[ b ], v[ c ] ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void blake3_round_avx2( __m256i v[ 16 ], __m256i const m[ 16 ] ) noexcept
+{
+    blake3_g_avx2( v, 0, 4,  8, 12, m[  0 ], m[  1 ] );
+    blake3_g_avx2( v, 1, 5,  9, 13, m[  2 ], m[  3 ] );
+    blake3_g_avx2( v, 2, 6, 10, 14, m[  4 ], m[  5 ] );
+    blake3_g_avx2( v, 3, 7, 11, 15, m[  6 ], m[  7 ] );
+    blake3_g_avx2( v, 0, 5, 10, 15, m[  8 ], m[  9 ] );
+    blake3_g_avx2( v, 1, 6, 11, 12, m[ 10 ], m[ 11 ] );
+    blake3_g_avx2( v, 2, 7,  8, 13, m[ 12 ], m[ 13 ] );
+    blake3_g_avx2( v, 3, 4,  9, 14, m[ 14 ], m[ 15 ] );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void blake3_permute_avx2( __m256i m[ 16 ] ) noexcept
+{
+    __m256i t[ 16 ] = { m[ 2 ], m[ 6 ], m[ 3 ], m[ 10 ], m[ 7 ], m[ 0 ], m[ 4 ], m[ 13 ], m[ 1 ], m[ 11 ], m[ 12 ], m[ 5 ], m[ 9 ], m[ 14 ], m[ 15 ], m[ 8 ] };
+    for( int i = 0; i < 16; ++i ) m[ i ] = t[ i ];
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline void blake3_transpose_avx2( __m256i v[ 8 ] ) noexcept
+{
+    __m256i ab_0145 = _mm256_unpacklo_epi32( v[ 0 ], v[ 1 ] );
+    __m256i ab_2367 = _mm256_unpackhi_epi32( v[ 0 ], v[ 1 ] );
+    __m256i cd_0145 = _mm256_unpacklo_epi32( v[ 2 ], v[ 3 ] );
+    __m256i cd_2367 = _mm256_unpackhi_epi32( v[ 2 ], v[ 3 ] );
+    __m256i ef_0145 = _mm256_unpacklo_epi32( v[ 4 ], v[ 5 ] );
+    __m256i ef_2367 = _mm256_unpackhi_epi32( v[ 4 ], v[ 5 ] );
+    __m256i gh_0145 = _mm256_unpacklo_epi32( v[ 6 ], v[ 7 ] );
+    __m256i gh_2367 = _mm256_unpackhi_epi32( v[ 6 ], v[ 7 ] );
+
+    __m256i abcd_04 = _mm256_unpacklo_epi64( ab_0145, cd_0145 );
+    __m256i abcd_15 = _mm256_unpackhi_epi64( ab_0145, cd_0145 );
+    __m256i abcd_26 = _mm256_unpacklo_epi64( ab_2367, cd_2367 );
+    __m256i abcd_37 = _mm256_unpackhi_epi64( ab_2367, cd_2367 );
+    __m256i efgh_04 = _mm256_unpacklo_epi64( ef_0145, gh_0145 );
+    __m256i efgh_15 = _mm256_unpackhi_epi64( ef_0145, gh_0145 );
+    __m256i efgh_26 = _mm256_unpacklo_epi64( ef_2367, gh_2367 );
+    __m256i efgh_37 = _mm256_unpackhi_epi64( ef_2367, gh_2367 );
+
+    v[ 0 ] = _mm256_permute2x128_si256( abcd_04, efgh_04, 0x20 );
+    v[ 1 ] = _mm256_permute2x128_si256( abcd_15, efgh_15, 0x20 );
+    v[ 2 ] = _mm256_permute2x128_si256( abcd_26, efgh_26, 0x20 );
+    v[ 3 ] = _mm256_permute2x128_si256( abcd_37, efgh_37, 0x20 );
+    v[ 4 ] = _mm256_permute2x128_si256( abcd_04, efgh_04, 0x31 );
+    v[ 5 ] = _mm256_permute2x128_si256( abcd_15, efgh_15, 0x31 );
+    v[ 6 ] = _mm256_permute2x128_si256( abcd_26, efgh_26, 0x31 );
+    v[ 7 ] = _mm256_permute2x128_si256( abcd_37, efgh_37, 0x31 );
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline void blake3_hash_many_avx2( unsigned char const* const inputs[ 8 ], std::size_t blocks, std::uint32_t const key[ 8 ], std::uint64_t counter, bool increment_counter, std::uint32_t flags, std::uint32_t flags_start, std::uint32_t flags_end, unsigned char const S[ 7 ][ 16 ], unsigned char* out ) noexcept
+{
+    // the message schedule is applied by blake3_permute_avx2, so that
+    // the rounds can be fully unrolled with the words kept in registers
+
+    (void)S;
+
+    __m256i h[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        h[ i ] = _mm256_set1_epi32( static_cast<int>( key[ i ] ) );
+    }
+
+    std::uint32_t cl[ 8 ], ch[ 8 ];
+
+    for( int j = 0; j < 8; ++j )
+    {
+        std::uint64_t c = counter + ( increment_counter? j: 0 );
+
+        cl[ j ] = static_cast<std::uint32_t>( c );
+        ch[ j ] = static_cast<std::uint32_t>( c >> 32 );
+    }
+
+    __m256i const counter_lo = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( cl ) );
+    __m256i const counter_hi = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( ch ) );
+
+    std::uint32_t block_flags = flags | flags_start;
+
+    for( std::size_t k = 0; k < blocks; ++k )
+    {
+        if( k + 1 == blocks )
+        {
+            block_flags |= flags_end;
+        }
+
+        __m256i m[ 16 ];
+
+        for( int i = 0; i < 2; ++i )
+        {
+            for( int j = 0; j < 8; ++j )
+            {
+                m[ i * 8 + j ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( inputs[ j ] + k * 64 + i * 32 ) );
+            }
+
+            blake3_transpose_avx2( m + i * 8 );
+        }
+
+        __m256i v[ 16 ] =
+        {
+            h[ 0 ], h[ 1 ], h[ 2 ], h[ 3 ], h[ 4 ], h[ 5 ], h[ 6 ], h[ 7 ],
+            _mm256_set1_epi32( 0x6A09E667 ), _mm256_set1_epi32( static_cast<int>( 0xBB67AE85 ) ), _mm256_set1_epi32( 0x3C6EF372 ), _mm256_set1_epi32( static_cast<int>( 0xA54FF53A ) ),
+            counter_lo, counter_hi, _mm256_set1_epi32( 64 ), _mm256_set1_epi32( static_cast<int>( block_flags ) ),
+        };
+
+        blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+        blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+        blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+        blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+        blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+        blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+        blake3_round_avx2( v, m );
+
+        for( int i = 0; i < 8; ++i )
+        {
+            h[ i ] = _mm256_xor_si256( v[ i ], v[ i + 8 ] );
+        }
+
+        block_flags = flags;
+    }
+
+    blake3_transpose_avx2( h );
+
+    for( int j = 0; j < 8; ++j )
+    {
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + j * 32 ), h[ j ] );
+    }
+}
+
+// the eight consecutive 64 byte blocks of extended output of a root node,
+// with input chaining value cv and block of n bytes, the first of which
+// is output block number counter
+
+BOOST_HASH2_TARGET("avx2")
+inline void blake3_xof_many_avx2( std::uint32_t const cv[ 8 ], unsigned char const block[ 64 ], std::uint32_t n, std::uint64_t counter, std::uint32_t flags, unsigned char* out ) noexcept
+{
+    __m256i m[ 16 ];
+
+    for( int i = 0; i < 16; ++i )
+    {
+        std::uint32_t w = 0;
+        std::memcpy( &w, block + i * 4, 4 );
+
+        m[ i ] = _mm256_set1_epi32( static_cast<int>( w ) );
+    }
+
+    std::uint32_t cl[ 8 ], ch[ 8 ];
+
+    for( int j = 0; j < 8; ++j )
+    {
+        std::uint64_t c = counter + j;
+
+        cl[ j ] = static_cast<std::uint32_t>( c );
+        ch[ j ] = static_cast<std::uint32_t>( c >> 32 );
+    }
+
+    __m256i v[ 16 ] =
+    {
+        _mm256_set1_epi32( static_cast<int>( cv[ 0 ] ) ), _mm256_set1_epi32( static_cast<int>( cv[ 1 ] ) ), _mm256_set1_epi32( static_cast<int>( cv[ 2 ] ) ), _mm256_set1_epi32( static_cast<int>( cv[ 3 ] ) ),
+        _mm256_set1_epi32( static_cast<int>( cv[ 4 ] ) ), _mm256_set1_epi32( static_cast<int>( cv[ 5 ] ) ), _mm256_set1_epi32( static_cast<int>( cv[ 6 ] ) ), _mm256_set1_epi32( static_cast<int>( cv[ 7 ] ) ),
+        _mm256_set1_epi32( 0x6A09E667 ), _mm256_set1_epi32( static_cast<int>( 0xBB67AE85 ) ), _mm256_set1_epi32( 0x3C6EF372 ), _mm256_set1_epi32( static_cast<int>( 0xA54FF53A ) ),
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( cl ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( ch ) ), _mm256_set1_epi32( static_cast<int>( n ) ), _mm256_set1_epi32( static_cast<int>( flags ) ),
+    };
+
+    blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+    blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+    blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+    blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+    blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+    blake3_round_avx2( v, m ); blake3_permute_avx2( m );
+    blake3_round_avx2( v, m );
+
+    __m256i h[ 8 ], g[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        h[ i ] = _mm256_xor_si256( v[ i ], v[ i + 8 ] );
+        g[ i ] = _mm256_xor_si256( v[ i + 8 ], _mm256_set1_epi32( static_cast<int>( cv[ i ] ) ) );
+    }
+
+    blake3_transpose_avx2( h );
+    blake3_transpose_avx2( g );
+
+    for( int j = 0; j < 8; ++j )
+    {
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + j * 64 +  0 ), h[ j ] );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + j * 64 + 32 ), g[ j ] );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BLAKE3_X86_HPP_INCLUDED
@@ -0,0 +1,85 @@
+#ifndef BOOST_HASH2_DETAIL_BSWAP_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BSWAP_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Byte order reversal of a single word, used by read and write for
+// the byte order that isn't the native one
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+
+#if defined(BOOST_MSVC) && !defined(BOOST_HASH2_HAS_BUILTIN_BSWAP)
+# include <stdlib.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// never constexpr; compiles to a single bswap, rev or lrv instruction
+
+BOOST_FORCEINLINE std::uint16_t bswap16( std::uint16_t v ) noexcept
+{
+#if defined(BOOST_HASH2_HAS_BUILTIN_BSWAP)
+
+    return __builtin_bswap16( v );
+
+#elif defined(BOOST_MSVC)
+
+    return _byteswap_ushort( v );
+
+#else
+
+    return static_cast<std::uint16_t>( ( v << 8 ) | ( v >> 8 ) );
+
+#endif
+}
+
+BOOST_FORCEINLINE std::uint32_t bswap32( std::uint32_t v ) noexcept
+{
+#if defined(BOOST_HASH2_HAS_BUILTIN_BSWAP)
+
+    return __builtin_bswap32( v );
+
+#elif defined(BOOST_MSVC)
+
+    return _byteswap_ulong( v );
+
+#else
+
+    v = ( ( v & 0x00FF00FFu ) << 8 ) | ( ( v >> 8 ) & 0x00FF00FFu );
+    return ( v << 16 ) | ( v >> 16 );
+
+#endif
+}
+
+BOOST_FORCEINLINE std::uint64_t bswap64( std::uint64_t v ) noexcept
+{
+#if defined(BOOST_HASH2_HAS_BUILTIN_BSWAP)
+
+    return __builtin_bswap64( v );
+
+#elif defined(BOOST_MSVC)
+
+    return _byteswap_uint64( v );
+
+#else
+
+    v = ( ( v & 0x00FF00FF00FF00FFull ) << 8 ) | ( ( v >> 8 ) & 0x00FF00FF00FF00FFull );
+    v = ( ( v & 0x0000FFFF0000FFFFull ) << 16 ) | ( ( v >> 16 ) & 0x0000FFFF0000FFFFull );
+    return ( v << 32 ) | ( v >> 32 );
+
+#endif
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BSWAP_HPP_INCLUDED
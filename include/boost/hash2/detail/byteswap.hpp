@@ -0,0 +1,62 @@
+#ifndef BOOST_HASH2_DETAIL_BYTESWAP_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BYTESWAP_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Bulk byte order reversal, used by hash_append_range for integral
+// types when the flavor byte order isn't the native one
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/byteswap_x86.hpp>
+#include <boost/hash2/detail/byteswap_arm.hpp>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// reverses the bytes of each W byte word (W is 2, 4 or 8) of [p, p+n)
+// into out; n is a multiple of W, and out may be equal to p
+//
+// never constexpr
+
+inline void byteswap_copy( unsigned char const* p, std::size_t n, unsigned char* out, std::size_t W ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_ssse3() )
+    {
+        i = detail::byteswap_ssse3( p, n, out, W );
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    i = detail::byteswap_neon( p, n, out, W );
+
+#endif
+
+    for( ; i < n; i += W )
+    {
+        for( std::size_t j = 0; j < W / 2; ++j )
+        {
+            unsigned char t = p[ i + j ];
+
+            out[ i + j ] = p[ i + W - 1 - j ];
+            out[ i + W - 1 - j ] = t;
+        }
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BYTESWAP_HPP_INCLUDED
@@ -0,0 +1,71 @@
+#ifndef BOOST_HASH2_DETAIL_BYTESWAP_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BYTESWAP_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Bulk byte order reversal using NEON
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// reverses the bytes of each W byte word (W is 2, 4 or 8) of the
+// n / 16 * 16 leading bytes of [p, p+n) into out, returns the number
+// of bytes processed
+
+inline std::size_t byteswap_neon( unsigned char const* p, std::size_t n, unsigned char* out, std::size_t W ) noexcept
+{
+    std::size_t i = 0;
+
+    switch( W )
+    {
+    case 2:
+
+        for( ; i + 16 <= n; i += 16 )
+        {
+            vst1q_u8( out + i, vrev16q_u8( vld1q_u8( p + i ) ) );
+        }
+
+        break;
+
+    case 4:
+
+        for( ; i + 16 <= n; i += 16 )
+        {
+            vst1q_u8( out + i, vrev32q_u8( vld1q_u8( p + i ) ) );
+        }
+
+        break;
+
+    default:
+
+        for( ; i + 16 <= n; i += 16 )
+        {
+            vst1q_u8( out + i, vrev64q_u8( vld1q_u8( p + i ) ) );
+        }
+
+        break;
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BYTESWAP_ARM_HPP_INCLUDED
@@ -0,0 +1,66 @@
+#ifndef BOOST_HASH2_DETAIL_BYTESWAP_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_BYTESWAP_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Bulk byte order reversal using SSSE3
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// reverses the bytes of each W byte word (W is 2, 4 or 8) of the
+// n / 16 * 16 leading bytes of [p, p+n) into out, returns the number
+// of bytes processed
+
+BOOST_HASH2_TARGET("ssse3")
+inline std::size_t byteswap_ssse3( unsigned char const* p, std::size_t n, unsigned char* out, std::size_t W ) noexcept
+{
+    __m128i const mask =
+        W == 2? _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 ):
+        W == 4? _mm_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 ):
+                _mm_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+
+    std::size_t i = 0;
+
+    for( ; i + 64 <= n; i += 64 )
+    {
+        __m128i v0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i +  0 ) );
+        __m128i v1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i + 16 ) );
+        __m128i v2 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i + 32 ) );
+        __m128i v3 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i + 48 ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i +  0 ), _mm_shuffle_epi8( v0, mask ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i + 16 ), _mm_shuffle_epi8( v1, mask ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i + 32 ), _mm_shuffle_epi8( v2, mask ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i + 48 ), _mm_shuffle_epi8( v3, mask ) );
+    }
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m128i v = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i ), _mm_shuffle_epi8( v, mask ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_BYTESWAP_X86_HPP_INCLUDED
@@ -0,0 +1,112 @@
+#ifndef BOOST_HASH2_DETAIL_COMBINE_COLUMNS_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_COMBINE_COLUMNS_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// combine_columns using AVX2, four rows per vector
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// x * c mod 2^64 in each lane, from three 32x32->64 multiplies; c1 holds
+// the low and c2 the high half of c
+
+BOOST_HASH2_TARGET("avx2")
+inline __m256i combine_mul64_avx2( __m256i x, __m256i c1, __m256i c2 ) noexcept
+{
+    __m256i const lo = _mm256_mul_epu32( x, c1 );
+    __m256i const hi = _mm256_add_epi64( _mm256_mul_epu32( _mm256_srli_epi64( x, 32 ), c1 ), _mm256_mul_epu32( x, c2 ) );
+
+    return _mm256_add_epi64( lo, _mm256_slli_epi64( hi, 32 ) );
+}
+
+// mix_finalize( std::uint64_t ) in each lane
+
+BOOST_HASH2_TARGET("avx2")
+inline __m256i combine_finalize_avx2( __m256i h ) noexcept
+{
+    __m256i const c11 = _mm256_set1_epi64x( 0x1CE4E5B9 );
+    __m256i const c12 = _mm256_set1_epi64x( 0xBF58476D );
+    __m256i const c21 = _mm256_set1_epi64x( 0x133111EB );
+    __m256i const c22 = _mm256_set1_epi64x( 0x94D049BB );
+
+    h = _mm256_xor_si256( h, _mm256_srli_epi64( h, 30 ) );
+    h = combine_mul64_avx2( h, c11, c12 );
+    h = _mm256_xor_si256( h, _mm256_srli_epi64( h, 27 ) );
+    h = combine_mul64_avx2( h, c21, c22 );
+    h = _mm256_xor_si256( h, _mm256_srli_epi64( h, 31 ) );
+
+    return h;
+}
+
+// the n / 4 * 4 leading rows; h0 is the seeded state, and l the constant
+// xored into the result. Returns the number of rows processed
+
+BOOST_HASH2_TARGET("avx2")
+inline std::size_t combine_columns_avx2( std::uint64_t const* const columns[], std::size_t k, std::size_t n, std::uint64_t* out, std::uint64_t h0, std::uint64_t l ) noexcept
+{
+    // the rows are processed in blocks, one column at a time, so that the
+    // latencies of the multiplies of the vectors of a block overlap
+
+    constexpr std::size_t M = 16; // vectors per block
+
+    __m256i const vh = _mm256_set1_epi64x( static_cast<long long>( h0 ) );
+    __m256i const vl = _mm256_set1_epi64x( static_cast<long long>( l ) );
+
+    __m256i h[ M ];
+
+    std::size_t i = 0;
+
+    while( i + 4 <= n )
+    {
+        std::size_t m = ( n - i ) / 4;
+
+        if( m > M ) m = M;
+
+        for( std::size_t t = 0; t < m; ++t )
+        {
+            h[ t ] = vh;
+        }
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            std::uint64_t const* p = columns[ j ] + i;
+
+            for( std::size_t t = 0; t < m; ++t )
+            {
+                h[ t ] = combine_finalize_avx2( _mm256_xor_si256( h[ t ], _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + t * 4 ) ) ) );
+            }
+        }
+
+        for( std::size_t t = 0; t < m; ++t )
+        {
+            _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + i + t * 4 ), _mm256_xor_si256( h[ t ], vl ) );
+        }
+
+        i += m * 4;
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_COMBINE_COLUMNS_X86_HPP_INCLUDED
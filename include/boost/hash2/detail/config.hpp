@@ -31,4 +31,93 @@
 # endif
 #endif
 
+// __builtin_bswap32, __builtin_bswap64
+
+#if defined(__GNUC__) || defined(__clang__)
+# define BOOST_HASH2_HAS_BUILTIN_BSWAP
+#endif
+
+// consteval
+
+#if defined(__cpp_consteval) && __cpp_consteval >= 201811L
+# define BOOST_HASH2_CONSTEVAL consteval
+#else
+# define BOOST_HASH2_CONSTEVAL BOOST_CXX14_CONSTEXPR
+#endif
+
+// x86 and ARM intrinsics
+//
+// Define BOOST_HASH2_DISABLE_INTRINSICS to use the portable code paths only
+
+#if !defined(BOOST_HASH2_DISABLE_INTRINSICS)
+
+# if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  if defined(BOOST_MSVC) && BOOST_MSVC >= 1900
+#   define BOOST_HASH2_HAS_X86_INTRINSICS
+#  elif defined(__clang__) && ( __clang_major__ >= 4 )
+#   define BOOST_HASH2_HAS_X86_INTRINSICS
+#  elif defined(BOOST_GCC) && BOOST_GCC >= 50000
+#   define BOOST_HASH2_HAS_X86_INTRINSICS
+#  endif
+# endif
+
+# if defined(BOOST_HASH2_HAS_X86_INTRINSICS) && ( defined(__x86_64__) || defined(_M_X64) )
+#  define BOOST_HASH2_HAS_X86_64_INTRINSICS
+# endif
+
+// the intrinsics for the x86 SHA512 extensions need GCC 14 or Clang 18
+
+# if defined(BOOST_HASH2_HAS_X86_INTRINSICS) && ( ( defined(__clang__) && __clang_major__ >= 18 ) || ( defined(BOOST_GCC) && BOOST_GCC >= 140000 ) )
+#  define BOOST_HASH2_HAS_X86_SHA512_INTRINSICS
+# endif
+
+# if defined(__aarch64__) || defined(_M_ARM64)
+#  define BOOST_HASH2_HAS_ARM_NEON_INTRINSICS
+# endif
+
+# if ( defined(__aarch64__) || defined(_M_ARM64) ) && ( defined(__ARM_FEATURE_SHA2) || defined(__ARM_FEATURE_CRYPTO) )
+#  define BOOST_HASH2_HAS_ARM_SHA2_INTRINSICS
+# endif
+
+# if defined(BOOST_HASH2_HAS_ARM_SHA2_INTRINSICS) && defined(__ARM_FEATURE_SHA512)
+#  define BOOST_HASH2_HAS_ARM_SHA512_INTRINSICS
+# endif
+
+# if ( defined(__aarch64__) || defined(_M_ARM64) ) && ( defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO) )
+#  define BOOST_HASH2_HAS_ARM_AES_INTRINSICS
+# endif
+
+# if ( defined(__aarch64__) || defined(_M_ARM64) ) && defined(__ARM_FEATURE_CRC32)
+#  define BOOST_HASH2_HAS_ARM_CRC32_INTRINSICS
+# endif
+
+// RISC-V vector SHA-2 (Zvknha for SHA-256, Zvknhb for SHA-256 and SHA-512),
+// enabled at compile time, e.g. -march=rv64gcv_zvknhb
+
+# if defined(__riscv_vector) && defined(__riscv_v_intrinsic) && __riscv_v_intrinsic >= 12000
+#  if defined(__riscv_zvknha) || defined(__riscv_zvknhb)
+#   define BOOST_HASH2_HAS_RISCV_ZVKNHA_INTRINSICS
+#  endif
+#  if defined(__riscv_zvknhb)
+#   define BOOST_HASH2_HAS_RISCV_ZVKNHB_INTRINSICS
+#  endif
+# endif
+
+// WebAssembly has no runtime feature detection; the SIMD128 kernels are
+// used when the module is compiled with -msimd128
+
+# if defined(__wasm_simd128__)
+#  define BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS
+# endif
+
+#endif
+
+// __attribute__((target))
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS) && ( defined(__GNUC__) || defined(__clang__) )
+# define BOOST_HASH2_TARGET(x) __attribute__((target(x)))
+#else
+# define BOOST_HASH2_TARGET(x)
+#endif
+
 #endif // #ifndef BOOST_HASH2_DETAIL_CONFIG_HPP_INCLUDED
@@ -0,0 +1,359 @@
+#ifndef BOOST_HASH2_DETAIL_CPU_FEATURES_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CPU_FEATURES_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/config.hpp>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+# if defined(BOOST_MSVC)
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+# endif
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// Runtime detection of the instruction set extensions used by the
+// accelerated code paths
+//
+// An algorithm with an accelerated code path dispatches to it as follows:
+//
+//     #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+//
+//         if( !detail::is_constant_evaluated() && detail::has_x86_avx2() )
+//         {
+//             detail::algorithm_kernel_avx2( ... );
+//             return;
+//         }
+//
+//     #endif
+//
+//         // portable code, also used in constant evaluation
+//
+// The kernel is compiled with BOOST_HASH2_TARGET, so the extension need
+// not be enabled on the command line. The features are detected once,
+// on the first call to get_cpu_features(); afterwards, each has_x86_*
+// check is a load and a well predicted branch. This is cheaper than an
+// indirect call through a function pointer, and keeps the portable code
+// inlinable.
+//
+// The ARM code paths are instead selected at compile time, from the
+// __ARM_FEATURE_* macros of the target architecture.
+//
+// Defining BOOST_HASH2_X86_ISA_LEVEL limits the extensions reported
+// by get_cpu_features(), regardless of what the processor supports,
+// which makes benchmarks reproducible across machines:
+//
+//     0 - none; the portable code is used throughout
+//     1 - SSE2
+//     2 - SSSE3, SSE4.1, SSE4.2, PCLMULQDQ, AES-NI, and the SHA extensions
+//     3 - AVX2, BMI1 and BMI2
+//     4 - AVX-512F, AVX-512VL, GFNI, VPCLMULQDQ and the SHA512 extensions
+//
+// Each level includes the ones below it. The macro must have the same
+// value in all translation units.
+
+struct cpu_features
+{
+    bool sse2;
+    bool ssse3;
+    bool sse41;
+    bool sse42;
+    bool pclmul;
+    bool aes;
+    bool sha;
+    bool avx2;
+    bool bmi;
+    bool bmi2;
+    bool avx512f;
+    bool avx512vl;
+    bool gfni;
+    bool vpclmul;
+    bool sha512;
+};
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+inline void cpuid( unsigned leaf, unsigned subleaf, unsigned r[ 4 ] ) noexcept
+{
+#if defined(BOOST_MSVC)
+
+    int tmp[ 4 ] = {};
+    __cpuidex( tmp, static_cast<int>( leaf ), static_cast<int>( subleaf ) );
+
+    for( int i = 0; i < 4; ++i )
+    {
+        r[ i ] = static_cast<unsigned>( tmp[ i ] );
+    }
+
+#else
+
+    r[ 0 ] = r[ 1 ] = r[ 2 ] = r[ 3 ] = 0;
+    __cpuid_count( leaf, subleaf, r[ 0 ], r[ 1 ], r[ 2 ], r[ 3 ] );
+
+#endif
+}
+
+// XCR0
+
+inline unsigned long long xgetbv0() noexcept
+{
+#if defined(BOOST_MSVC)
+
+    return _xgetbv( 0 );
+
+#else
+
+    unsigned eax = 0, edx = 0;
+    __asm__ __volatile__( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+
+    return ( static_cast<unsigned long long>( edx ) << 32 ) | eax;
+
+#endif
+}
+
+inline cpu_features detect_cpu_features() noexcept
+{
+    cpu_features f = {};
+
+    unsigned r[ 4 ] = {};
+
+    bool os_avx = false;
+    bool os_avx512 = false;
+
+    cpuid( 0, 0, r );
+
+    unsigned max_leaf = r[ 0 ];
+
+    if( max_leaf >= 1 )
+    {
+        cpuid( 1, 0, r );
+
+        f.sse2 = ( r[ 3 ] & ( 1u << 26 ) ) != 0;
+        f.ssse3 = ( r[ 2 ] & ( 1u << 9 ) ) != 0;
+        f.sse41 = ( r[ 2 ] & ( 1u << 19 ) ) != 0;
+        f.sse42 = ( r[ 2 ] & ( 1u << 20 ) ) != 0;
+        f.pclmul = ( r[ 2 ] & ( 1u << 1 ) ) != 0;
+        f.aes = ( r[ 2 ] & ( 1u << 25 ) ) != 0;
+
+        // AVX, OSXSAVE, and the OS saves the YMM registers
+
+        if( ( r[ 2 ] & ( 1u << 27 ) ) && ( r[ 2 ] & ( 1u << 28 ) ) )
+        {
+            unsigned long long xcr0 = xgetbv0();
+
+            os_avx = ( xcr0 & 6 ) == 6;
+
+            // and also the opmask registers and all 32 ZMM registers
+
+            os_avx512 = ( xcr0 & 0xE6 ) == 0xE6;
+        }
+    }
+
+    if( max_leaf >= 7 )
+    {
+        cpuid( 7, 0, r );
+
+        unsigned max_subleaf = r[ 0 ];
+
+        f.sha = ( r[ 1 ] & ( 1u << 29 ) ) != 0;
+        f.avx2 = os_avx && ( r[ 1 ] & ( 1u << 5 ) ) != 0;
+        f.bmi = ( r[ 1 ] & ( 1u << 3 ) ) != 0;
+        f.bmi2 = ( r[ 1 ] & ( 1u << 8 ) ) != 0;
+        f.avx512f = os_avx512 && ( r[ 1 ] & ( 1u << 16 ) ) != 0;
+        f.avx512vl = os_avx512 && ( r[ 1 ] & ( 1u << 31 ) ) != 0;
+        f.gfni = ( r[ 2 ] & ( 1u << 8 ) ) != 0;
+        f.vpclmul = ( r[ 2 ] & ( 1u << 10 ) ) != 0;
+
+        if( max_subleaf >= 1 )
+        {
+            cpuid( 7, 1, r );
+
+            // VSHA512RNDS2, VSHA512MSG1 and VSHA512MSG2 are VEX encoded
+
+            f.sha512 = os_avx && ( r[ 0 ] & 1u ) != 0;
+        }
+    }
+
+    return f;
+}
+
+#else
+
+inline cpu_features detect_cpu_features() noexcept
+{
+    cpu_features f = {};
+    return f;
+}
+
+#endif
+
+inline cpu_features limit_cpu_features( cpu_features f, int level ) noexcept
+{
+    if( level < 1 )
+    {
+        f.sse2 = false;
+    }
+
+    if( level < 2 )
+    {
+        f.ssse3 = f.sse41 = f.sse42 = f.pclmul = f.aes = f.sha = false;
+    }
+
+    if( level < 3 )
+    {
+        f.avx2 = f.bmi = f.bmi2 = false;
+    }
+
+    if( level < 4 )
+    {
+        f.avx512f = f.avx512vl = f.gfni = f.vpclmul = f.sha512 = false;
+    }
+
+    return f;
+}
+
+inline cpu_features const& get_cpu_features() noexcept
+{
+#if defined(BOOST_HASH2_X86_ISA_LEVEL)
+
+    static cpu_features const f = limit_cpu_features( detect_cpu_features(), BOOST_HASH2_X86_ISA_LEVEL );
+
+#else
+
+    static cpu_features const f = detect_cpu_features();
+
+#endif
+
+    return f;
+}
+
+inline bool has_x86_sse2() noexcept
+{
+    return get_cpu_features().sse2;
+}
+
+inline bool has_x86_ssse3() noexcept
+{
+    return get_cpu_features().ssse3;
+}
+
+inline bool has_x86_sse41() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.ssse3 && f.sse41;
+}
+
+// SHA extensions, with the SSSE3 and SSE4.1 shuffles the kernels also use
+
+inline bool has_x86_sha() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.sha && f.ssse3 && f.sse41;
+}
+
+// SSE4.2 (CRC32)
+
+inline bool has_x86_sse42() noexcept
+{
+    return get_cpu_features().sse42;
+}
+
+inline bool has_x86_sse42_pclmul() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.sse42 && f.pclmul;
+}
+
+// AES-NI, with the SSE2 it operates on
+
+inline bool has_x86_aes() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.aes && f.sse2;
+}
+
+inline bool has_x86_avx2() noexcept
+{
+    return get_cpu_features().avx2;
+}
+
+// BMI1 (ANDN) and BMI2 (RORX)
+
+inline bool has_x86_bmi2() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.bmi && f.bmi2;
+}
+
+inline bool has_x86_avx2_bmi2() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.avx2 && f.bmi2;
+}
+
+// the SHA512 extensions, with the AVX2 shuffles the kernel also uses
+
+inline bool has_x86_sha512() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.sha512 && f.avx2;
+}
+
+inline bool has_x86_avx512f() noexcept
+{
+    return get_cpu_features().avx512f;
+}
+
+// the AVX-512 operations on the 128 and 256 bit registers
+
+inline bool has_x86_avx512vl() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.avx512f && f.avx512vl;
+}
+
+// VPCLMULQDQ on the 512 bit registers
+
+inline bool has_x86_avx512_vpclmul() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.avx512f && f.vpclmul && f.pclmul;
+}
+
+// PCLMULQDQ, with the SSE2 it operates on
+
+inline bool has_x86_pclmul() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.pclmul && f.sse2;
+}
+
+// PCLMULQDQ, with the SSSE3 or GFNI byte operations the kernels use
+
+inline bool has_x86_ssse3_pclmul() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.ssse3 && f.pclmul;
+}
+
+inline bool has_x86_gfni_pclmul() noexcept
+{
+    cpu_features const& f = get_cpu_features();
+    return f.gfni && f.pclmul && f.sse2;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CPU_FEATURES_HPP_INCLUDED
@@ -0,0 +1,122 @@
+#ifndef BOOST_HASH2_DETAIL_CRC32C_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CRC32C_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// CRC32C using the ARMv8 CRC32 instructions
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_CRC32_INTRINSICS)
+
+#include <arm_acle.h>
+
+#if defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)
+# include <arm_neon.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The ARM code path is enabled at compile time, when the target
+// architecture includes the CRC32 extension (e.g. -march=armv8-a+crc)
+
+inline std::uint32_t crc32c_update_arm( std::uint32_t c, unsigned char const* p, std::size_t n ) noexcept
+{
+    while( n >= 8 )
+    {
+        c = __crc32cd( c, detail::read64le( p ) );
+
+        p += 8;
+        n -= 8;
+    }
+
+    while( n > 0 )
+    {
+        c = __crc32cb( c, *p );
+
+        ++p;
+        --n;
+    }
+
+    return c;
+}
+
+#if defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO)
+
+// Three streams in parallel, merged with PMULL; see crc32c_3way_sse42
+
+template<std::size_t K>
+inline std::uint32_t crc32c_3way_arm( std::uint32_t c0, unsigned char const* p, std::uint32_t k0, std::uint32_t k1 ) noexcept
+{
+    std::uint32_t c1 = 0;
+    std::uint32_t c2 = 0;
+
+    unsigned char const* p1 = p + K * 8;
+    unsigned char const* p2 = p + K * 16;
+
+    for( std::size_t i = 0; i < K - 1; ++i )
+    {
+        c0 = __crc32cd( c0, detail::read64le( p + i * 8 ) );
+        c1 = __crc32cd( c1, detail::read64le( p1 + i * 8 ) );
+        c2 = __crc32cd( c2, detail::read64le( p2 + i * 8 ) );
+    }
+
+    c0 = __crc32cd( c0, detail::read64le( p + ( K - 1 ) * 8 ) );
+    c1 = __crc32cd( c1, detail::read64le( p1 + ( K - 1 ) * 8 ) );
+
+    uint64x2_t t0 = vreinterpretq_u64_p128( vmull_p64( c0, k0 ) );
+    uint64x2_t t1 = vreinterpretq_u64_p128( vmull_p64( c1, k1 ) );
+
+    std::uint64_t t = vgetq_lane_u64( veorq_u64( t0, t1 ), 0 );
+
+    return __crc32cd( c2, detail::read64le( p2 + ( K - 1 ) * 8 ) ^ t );
+}
+
+inline std::uint32_t crc32c_update_arm_pmull( std::uint32_t c, unsigned char const* p, std::size_t n ) noexcept
+{
+    while( n >= 3 * 128 * 8 )
+    {
+        c = crc32c_3way_arm<128>( c, p, 0xa51b6135, 0x170076fa );
+
+        p += 3 * 128 * 8;
+        n -= 3 * 128 * 8;
+    }
+
+    while( n >= 3 * 32 * 8 )
+    {
+        c = crc32c_3way_arm<32>( c, p, 0xdd7e3b0c, 0xb9e02b86 );
+
+        p += 3 * 32 * 8;
+        n -= 3 * 32 * 8;
+    }
+
+    while( n >= 3 * 8 * 8 )
+    {
+        c = crc32c_3way_arm<8>( c, p, 0x0d3b6092, 0x9e4addf8 );
+
+        p += 3 * 8 * 8;
+        n -= 3 * 8 * 8;
+    }
+
+    return crc32c_update_arm( c, p, n );
+}
+
+#endif
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_CRC32_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CRC32C_ARM_HPP_INCLUDED
@@ -0,0 +1,127 @@
+#ifndef BOOST_HASH2_DETAIL_CRC32C_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CRC32C_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// CRC32C using the SSE4.2 CRC32 instruction, and PCLMULQDQ
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// c is the CRC register, without the final inversion
+
+BOOST_HASH2_TARGET("sse4.2")
+inline std::uint32_t crc32c_update_sse42( std::uint32_t c, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::uint64_t c64 = c;
+
+    while( n >= 8 )
+    {
+        c64 = _mm_crc32_u64( c64, detail::read64le( p ) );
+
+        p += 8;
+        n -= 8;
+    }
+
+    c = static_cast<std::uint32_t>( c64 );
+
+    while( n > 0 )
+    {
+        c = _mm_crc32_u8( c, *p );
+
+        ++p;
+        --n;
+    }
+
+    return c;
+}
+
+// CRC32 has a latency of three cycles and a throughput of one, so
+// three independent streams of K qwords each are computed in parallel.
+// The first two are then shifted over the remaining input by carry-less
+// multiplication with k0 = x^(128K-33) mod P and k1 = x^(64K-33) mod P,
+// and merged into the last qword of the third.
+
+template<std::size_t K>
+BOOST_HASH2_TARGET("sse4.2,pclmul")
+inline std::uint64_t crc32c_3way_sse42( std::uint64_t c0, unsigned char const* p, std::uint32_t k0, std::uint32_t k1 ) noexcept
+{
+    std::uint64_t c1 = 0;
+    std::uint64_t c2 = 0;
+
+    unsigned char const* p1 = p + K * 8;
+    unsigned char const* p2 = p + K * 16;
+
+    for( std::size_t i = 0; i < K - 1; ++i )
+    {
+        c0 = _mm_crc32_u64( c0, detail::read64le( p + i * 8 ) );
+        c1 = _mm_crc32_u64( c1, detail::read64le( p1 + i * 8 ) );
+        c2 = _mm_crc32_u64( c2, detail::read64le( p2 + i * 8 ) );
+    }
+
+    c0 = _mm_crc32_u64( c0, detail::read64le( p + ( K - 1 ) * 8 ) );
+    c1 = _mm_crc32_u64( c1, detail::read64le( p1 + ( K - 1 ) * 8 ) );
+
+    __m128i t0 = _mm_clmulepi64_si128( _mm_cvtsi64_si128( static_cast<long long>( c0 ) ), _mm_cvtsi32_si128( static_cast<int>( k0 ) ), 0x00 );
+    __m128i t1 = _mm_clmulepi64_si128( _mm_cvtsi64_si128( static_cast<long long>( c1 ) ), _mm_cvtsi32_si128( static_cast<int>( k1 ) ), 0x00 );
+
+    std::uint64_t t = static_cast<std::uint64_t>( _mm_cvtsi128_si64( _mm_xor_si128( t0, t1 ) ) );
+
+    return _mm_crc32_u64( c2, detail::read64le( p2 + ( K - 1 ) * 8 ) ^ t );
+}
+
+BOOST_HASH2_TARGET("sse4.2,pclmul")
+inline std::uint32_t crc32c_update_pclmul( std::uint32_t c, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::uint64_t c64 = c;
+
+    while( n >= 3 * 128 * 8 )
+    {
+        c64 = crc32c_3way_sse42<128>( c64, p, 0xa51b6135, 0x170076fa );
+
+        p += 3 * 128 * 8;
+        n -= 3 * 128 * 8;
+    }
+
+    while( n >= 3 * 32 * 8 )
+    {
+        c64 = crc32c_3way_sse42<32>( c64, p, 0xdd7e3b0c, 0xb9e02b86 );
+
+        p += 3 * 32 * 8;
+        n -= 3 * 32 * 8;
+    }
+
+    while( n >= 3 * 8 * 8 )
+    {
+        c64 = crc32c_3way_sse42<8>( c64, p, 0x0d3b6092, 0x9e4addf8 );
+
+        p += 3 * 8 * 8;
+        n -= 3 * 8 * 8;
+    }
+
+    return crc32c_update_sse42( static_cast<std::uint32_t>( c64 ), p, n );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CRC32C_X86_HPP_INCLUDED
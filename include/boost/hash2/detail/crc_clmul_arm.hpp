@@ -0,0 +1,144 @@
+#ifndef BOOST_HASH2_DETAIL_CRC_CLMUL_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CRC_CLMUL_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Reflected CRCs of width 32 or 64 by folding with PMULL; see
+// crc_clmul_x86.hpp for the method and the constants
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The ARM code path is enabled at compile time, when the target
+// architecture includes PMULL, which is part of the AES extension
+// (e.g. -march=armv8-a+crypto)
+
+inline uint64x2_t crc_pmull( std::uint64_t a, std::uint64_t b ) noexcept
+{
+    return vreinterpretq_u64_p128( vmull_p64( a, b ) );
+}
+
+inline uint64x2_t crc_fold_pmull( uint64x2_t x, std::uint64_t k0, std::uint64_t k1 ) noexcept
+{
+    return veorq_u64( detail::crc_pmull( vgetq_lane_u64( x, 0 ), k0 ), detail::crc_pmull( vgetq_lane_u64( x, 1 ), k1 ) );
+}
+
+inline uint64x2_t crc_load_pmull( unsigned char const* p ) noexcept
+{
+    return vreinterpretq_u64_u8( vld1q_u8( p ) );
+}
+
+template<int W>
+inline std::uint64_t crc_reduce_pmull( uint64x2_t x, std::uint64_t const* k ) noexcept
+{
+    std::uint64_t const x0 = vgetq_lane_u64( x, 0 );
+    std::uint64_t const x1 = vgetq_lane_u64( x, 1 );
+
+    // T = x.lo * x^(W+64) + x.hi * x^W, reduced to 64 + W bits
+
+    uint64x2_t t = detail::crc_pmull( x0, k[ 10 ] );
+
+    std::uint64_t t0 = vgetq_lane_u64( t, 0 );
+    std::uint64_t t1 = vgetq_lane_u64( t, 1 );
+
+    if( W == 32 )
+    {
+        t0 ^= x1 << 32;
+        t1 ^= x1 >> 32;
+    }
+    else
+    {
+        t0 ^= x1;
+    }
+
+    // the quotient of T / P, from its high 64 bits
+
+    std::uint64_t const th = W == 32? ( t0 >> 32 ) | ( t1 << 32 ): t0;
+    std::uint64_t const q = ( vgetq_lane_u64( detail::crc_pmull( th, k[ 11 ] ), 0 ) << 1 ) ^ th;
+
+    // the remainder, the low W bits of T + Q * P
+
+    uint64x2_t r = detail::crc_pmull( q, k[ 12 ] );
+
+    std::uint64_t const r0 = vgetq_lane_u64( r, 0 );
+    std::uint64_t const r1 = vgetq_lane_u64( r, 1 );
+
+    if( W == 32 )
+    {
+        return ( ( r1 >> 31 ) ^ ( t1 >> 32 ) ) & 0xFFFFFFFFu;
+    }
+    else
+    {
+        return ( ( r1 << 1 ) | ( r0 >> 63 ) ) ^ t1;
+    }
+}
+
+// n is a nonzero multiple of 16
+
+template<int W>
+inline std::uint64_t crc_update_pmull( std::uint64_t c, unsigned char const* p, std::size_t n, std::uint64_t const* k ) noexcept
+{
+    uint64x2_t x0 = veorq_u64( detail::crc_load_pmull( p ), vsetq_lane_u64( c, vdupq_n_u64( 0 ), 0 ) );
+
+    if( n >= 64 )
+    {
+        uint64x2_t x1 = detail::crc_load_pmull( p + 16 );
+        uint64x2_t x2 = detail::crc_load_pmull( p + 32 );
+        uint64x2_t x3 = detail::crc_load_pmull( p + 48 );
+
+        p += 64;
+        n -= 64;
+
+        while( n >= 64 )
+        {
+            x0 = veorq_u64( detail::crc_fold_pmull( x0, k[ 2 ], k[ 3 ] ), detail::crc_load_pmull( p ) );
+            x1 = veorq_u64( detail::crc_fold_pmull( x1, k[ 2 ], k[ 3 ] ), detail::crc_load_pmull( p + 16 ) );
+            x2 = veorq_u64( detail::crc_fold_pmull( x2, k[ 2 ], k[ 3 ] ), detail::crc_load_pmull( p + 32 ) );
+            x3 = veorq_u64( detail::crc_fold_pmull( x3, k[ 2 ], k[ 3 ] ), detail::crc_load_pmull( p + 48 ) );
+
+            p += 64;
+            n -= 64;
+        }
+
+        x1 = veorq_u64( x1, detail::crc_fold_pmull( x0, k[ 8 ], k[ 9 ] ) );
+        x2 = veorq_u64( x2, detail::crc_fold_pmull( x1, k[ 8 ], k[ 9 ] ) );
+        x0 = veorq_u64( x3, detail::crc_fold_pmull( x2, k[ 8 ], k[ 9 ] ) );
+    }
+    else
+    {
+        p += 16;
+        n -= 16;
+    }
+
+    while( n >= 16 )
+    {
+        x0 = veorq_u64( detail::crc_fold_pmull( x0, k[ 8 ], k[ 9 ] ), detail::crc_load_pmull( p ) );
+
+        p += 16;
+        n -= 16;
+    }
+
+    return detail::crc_reduce_pmull<W>( x0, k );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CRC_CLMUL_ARM_HPP_INCLUDED
@@ -0,0 +1,238 @@
+#ifndef BOOST_HASH2_DETAIL_CRC_CLMUL_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CRC_CLMUL_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Reflected CRCs of width 32 or 64 by folding with PCLMULQDQ and
+// VPCLMULQDQ, https://www.intel.com/content/dam/www/public/us/en/documents/white-papers/fast-crc-computation-generic-polynomials-pclmulqdq-paper.pdf
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// A 16 byte block, loaded little endian, is the message polynomial with
+// its bits reversed, and so is the CRC register; rev(x) below is the bit
+// reversal of x as a 64 bit value. Multiplying two reversed values gives
+// the reversed product shifted right by one bit, which is absorbed into
+// the constants, so that the block A ahead of the next by D bits is
+// folded into it by multiplying its low qword with rev(x^(D+63) mod P)
+// and its high qword with rev(x^(D-1) mod P).
+//
+// The constants k of a CRC are
+//
+//     k[ 0 ], k[ 1 ]  - folding by 2048 bits
+//     k[ 2 ], k[ 3 ]  - by 512 bits
+//     k[ 4 ], k[ 5 ]  - by 384 bits
+//     k[ 6 ], k[ 7 ]  - by 256 bits
+//     k[ 8 ], k[ 9 ]  - by 128 bits
+//     k[ 10 ]         - rev(x^(W+63) mod P)
+//     k[ 11 ]         - rev(floor(x^(W+64) / P) - x^64)
+//     k[ 12 ]         - rev(P - x^W)
+//
+// The kernels take n a nonzero multiple of 16, and c the CRC register
+// without the final inversion.
+
+BOOST_HASH2_TARGET("pclmul")
+inline __m128i crc_fold_128( __m128i x, __m128i k ) noexcept
+{
+    return _mm_xor_si128( _mm_clmulepi64_si128( x, k, 0x00 ), _mm_clmulepi64_si128( x, k, 0x11 ) );
+}
+
+inline __m128i crc_load_128( unsigned char const* p ) noexcept
+{
+    return _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) );
+}
+
+// the CRC of the 16 byte block x, by Barrett reduction
+
+template<int W>
+BOOST_HASH2_TARGET("pclmul")
+inline std::uint64_t crc_reduce_128( __m128i x, std::uint64_t const* k ) noexcept
+{
+    // T = x.lo * x^(W+64) + x.hi * x^W, reduced to 64 + W bits
+
+    __m128i h = _mm_srli_si128( x, 8 );
+
+    if( W == 32 )
+    {
+        h = _mm_slli_si128( h, 4 );
+    }
+
+    __m128i t = _mm_xor_si128( _mm_clmulepi64_si128( x, _mm_cvtsi64_si128( static_cast<long long>( k[ 10 ] ) ), 0x00 ), h );
+
+    // the quotient of T / P, from its high 64 bits
+
+    __m128i th = W == 32? _mm_srli_si128( t, 4 ): t;
+
+    __m128i q = _mm_slli_epi64( _mm_clmulepi64_si128( th, _mm_cvtsi64_si128( static_cast<long long>( k[ 11 ] ) ), 0x00 ), 1 );
+    q = _mm_xor_si128( q, th );
+
+    // the remainder, the low W bits of T + Q * P
+
+    __m128i r = _mm_clmulepi64_si128( q, _mm_cvtsi64_si128( static_cast<long long>( k[ 12 ] ) ), 0x00 );
+
+    std::uint64_t const r0 = static_cast<std::uint64_t>( _mm_cvtsi128_si64( r ) );
+    std::uint64_t const r1 = static_cast<std::uint64_t>( _mm_cvtsi128_si64( _mm_srli_si128( r, 8 ) ) );
+    std::uint64_t const t1 = static_cast<std::uint64_t>( _mm_cvtsi128_si64( _mm_srli_si128( t, 8 ) ) );
+
+    if( W == 32 )
+    {
+        return ( ( r1 >> 31 ) ^ ( t1 >> 32 ) ) & 0xFFFFFFFFu;
+    }
+    else
+    {
+        return ( ( r1 << 1 ) | ( r0 >> 63 ) ) ^ t1;
+    }
+}
+
+template<int W>
+BOOST_HASH2_TARGET("pclmul")
+inline std::uint64_t crc_update_pclmul( std::uint64_t c, unsigned char const* p, std::size_t n, std::uint64_t const* k ) noexcept
+{
+    __m128i const k128 = _mm_set_epi64x( static_cast<long long>( k[ 9 ] ), static_cast<long long>( k[ 8 ] ) );
+
+    __m128i x0 = _mm_xor_si128( detail::crc_load_128( p ), _mm_cvtsi64_si128( static_cast<long long>( c ) ) );
+
+    if( n >= 64 )
+    {
+        // four blocks in flight, to cover the latency of the multiplication
+
+        __m128i const k512 = _mm_set_epi64x( static_cast<long long>( k[ 3 ] ), static_cast<long long>( k[ 2 ] ) );
+
+        __m128i x1 = detail::crc_load_128( p + 16 );
+        __m128i x2 = detail::crc_load_128( p + 32 );
+        __m128i x3 = detail::crc_load_128( p + 48 );
+
+        p += 64;
+        n -= 64;
+
+        while( n >= 64 )
+        {
+            x0 = _mm_xor_si128( detail::crc_fold_128( x0, k512 ), detail::crc_load_128( p ) );
+            x1 = _mm_xor_si128( detail::crc_fold_128( x1, k512 ), detail::crc_load_128( p + 16 ) );
+            x2 = _mm_xor_si128( detail::crc_fold_128( x2, k512 ), detail::crc_load_128( p + 32 ) );
+            x3 = _mm_xor_si128( detail::crc_fold_128( x3, k512 ), detail::crc_load_128( p + 48 ) );
+
+            p += 64;
+            n -= 64;
+        }
+
+        x1 = _mm_xor_si128( x1, detail::crc_fold_128( x0, k128 ) );
+        x2 = _mm_xor_si128( x2, detail::crc_fold_128( x1, k128 ) );
+        x0 = _mm_xor_si128( x3, detail::crc_fold_128( x2, k128 ) );
+    }
+    else
+    {
+        p += 16;
+        n -= 16;
+    }
+
+    while( n >= 16 )
+    {
+        x0 = _mm_xor_si128( detail::crc_fold_128( x0, k128 ), detail::crc_load_128( p ) );
+
+        p += 16;
+        n -= 16;
+    }
+
+    return detail::crc_reduce_128<W>( x0, k );
+}
+
+// four 512 bit registers, 256 bytes, in flight; n is at least 256
+
+#if defined(BOOST_GCC) && BOOST_GCC >= 120000 && BOOST_GCC < 130000
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wuninitialized" // _mm512_undefined_epi32 in the g++ 12 headers
+#endif
+
+template<int W>
+BOOST_HASH2_TARGET("avx512f,vpclmulqdq,pclmul")
+inline std::uint64_t crc_update_vpclmul( std::uint64_t c, unsigned char const* p, std::size_t n, std::uint64_t const* k ) noexcept
+{
+    __m512i const k2048 = _mm512_broadcast_i32x4( _mm_set_epi64x( static_cast<long long>( k[ 1 ] ), static_cast<long long>( k[ 0 ] ) ) );
+    __m512i const k512 = _mm512_broadcast_i32x4( _mm_set_epi64x( static_cast<long long>( k[ 3 ] ), static_cast<long long>( k[ 2 ] ) ) );
+
+    __m512i z0 = _mm512_xor_si512( _mm512_loadu_si512( p ), _mm512_inserti32x4( _mm512_setzero_si512(), _mm_cvtsi64_si128( static_cast<long long>( c ) ), 0 ) );
+    __m512i z1 = _mm512_loadu_si512( p + 64 );
+    __m512i z2 = _mm512_loadu_si512( p + 128 );
+    __m512i z3 = _mm512_loadu_si512( p + 192 );
+
+    p += 256;
+    n -= 256;
+
+    while( n >= 256 )
+    {
+        z0 = _mm512_xor_si512( _mm512_xor_si512( _mm512_clmulepi64_epi128( z0, k2048, 0x00 ), _mm512_clmulepi64_epi128( z0, k2048, 0x11 ) ), _mm512_loadu_si512( p ) );
+        z1 = _mm512_xor_si512( _mm512_xor_si512( _mm512_clmulepi64_epi128( z1, k2048, 0x00 ), _mm512_clmulepi64_epi128( z1, k2048, 0x11 ) ), _mm512_loadu_si512( p + 64 ) );
+        z2 = _mm512_xor_si512( _mm512_xor_si512( _mm512_clmulepi64_epi128( z2, k2048, 0x00 ), _mm512_clmulepi64_epi128( z2, k2048, 0x11 ) ), _mm512_loadu_si512( p + 128 ) );
+        z3 = _mm512_xor_si512( _mm512_xor_si512( _mm512_clmulepi64_epi128( z3, k2048, 0x00 ), _mm512_clmulepi64_epi128( z3, k2048, 0x11 ) ), _mm512_loadu_si512( p + 192 ) );
+
+        p += 256;
+        n -= 256;
+    }
+
+    z1 = _mm512_xor_si512( z1, _mm512_xor_si512( _mm512_clmulepi64_epi128( z0, k512, 0x00 ), _mm512_clmulepi64_epi128( z0, k512, 0x11 ) ) );
+    z2 = _mm512_xor_si512( z2, _mm512_xor_si512( _mm512_clmulepi64_epi128( z1, k512, 0x00 ), _mm512_clmulepi64_epi128( z1, k512, 0x11 ) ) );
+    z0 = _mm512_xor_si512( z3, _mm512_xor_si512( _mm512_clmulepi64_epi128( z2, k512, 0x00 ), _mm512_clmulepi64_epi128( z2, k512, 0x11 ) ) );
+
+    while( n >= 64 )
+    {
+        z0 = _mm512_xor_si512( _mm512_xor_si512( _mm512_clmulepi64_epi128( z0, k512, 0x00 ), _mm512_clmulepi64_epi128( z0, k512, 0x11 ) ), _mm512_loadu_si512( p ) );
+
+        p += 64;
+        n -= 64;
+    }
+
+    // the four blocks of z0, folded by 384, 256 and 128 bits into the last
+
+    __m512i const kz = _mm512_set_epi64( 0, 0,
+        static_cast<long long>( k[ 9 ] ), static_cast<long long>( k[ 8 ] ),
+        static_cast<long long>( k[ 7 ] ), static_cast<long long>( k[ 6 ] ),
+        static_cast<long long>( k[ 5 ] ), static_cast<long long>( k[ 4 ] ) );
+
+    __m512i t = _mm512_xor_si512( _mm512_clmulepi64_epi128( z0, kz, 0x00 ), _mm512_clmulepi64_epi128( z0, kz, 0x11 ) );
+
+    __m128i x0 = _mm512_extracti32x4_epi32( z0, 3 );
+
+    x0 = _mm_xor_si128( x0, _mm512_extracti32x4_epi32( t, 0 ) );
+    x0 = _mm_xor_si128( x0, _mm512_extracti32x4_epi32( t, 1 ) );
+    x0 = _mm_xor_si128( x0, _mm512_extracti32x4_epi32( t, 2 ) );
+
+    __m128i const k128 = _mm_set_epi64x( static_cast<long long>( k[ 9 ] ), static_cast<long long>( k[ 8 ] ) );
+
+    while( n >= 16 )
+    {
+        x0 = _mm_xor_si128( detail::crc_fold_128( x0, k128 ), detail::crc_load_128( p ) );
+
+        p += 16;
+        n -= 16;
+    }
+
+    return detail::crc_reduce_128<W>( x0, k );
+}
+
+#if defined(BOOST_GCC) && BOOST_GCC >= 120000 && BOOST_GCC < 130000
+# pragma GCC diagnostic pop
+#endif
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CRC_CLMUL_X86_HPP_INCLUDED
@@ -0,0 +1,234 @@
+#ifndef BOOST_HASH2_DETAIL_CRC_REFLECTED_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_CRC_REFLECTED_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The common implementation of the reflected CRCs with an initial value
+// and a final xor of all ones, such as CRC-32 and the CRC-64 variants
+
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/crc_clmul_x86.hpp>
+#include <boost/hash2/detail/crc_clmul_arm.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// a * b mod P, in the reflected representation, where the most
+// significant bit of T is x^0
+
+template<class T> BOOST_CXX14_CONSTEXPR T crc_multiply( T a, T b, T P )
+{
+    T r = 0;
+
+    for( T m = static_cast<T>( T( 1 ) << ( sizeof( T ) * 8 - 1 ) ); m != 0; m >>= 1 )
+    {
+        if( a & m )
+        {
+            r ^= b;
+        }
+
+        b = ( b & 1 )? static_cast<T>( ( b >> 1 ) ^ P ): static_cast<T>( b >> 1 );
+    }
+
+    return r;
+}
+
+// x^(8n) mod P
+
+template<class T> BOOST_CXX14_CONSTEXPR T crc_shift( std::uint64_t n, T P )
+{
+    T r = static_cast<T>( T( 1 ) << ( sizeof( T ) * 8 - 1 ) ); // x^0
+    T q = static_cast<T>( r >> 8 ); // x^8
+
+    while( n != 0 )
+    {
+        if( n & 1 )
+        {
+            r = detail::crc_multiply( q, r, P );
+        }
+
+        q = detail::crc_multiply( q, q, P );
+        n >>= 1;
+    }
+
+    return r;
+}
+
+// K supplies the reflected polynomial P, the byte table, and the
+// constants of the folding kernels, clmul[ 13 ]
+
+template<class T, class K> class crc_reflected_impl
+{
+private:
+
+    static constexpr int W = sizeof( T ) * 8;
+
+    T st_ = static_cast<T>( ~T( 0 ) );
+
+public:
+
+    typedef T result_type;
+
+    constexpr crc_reflected_impl() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit crc_reflected_impl( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR crc_reflected_impl( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( crc_reflected_impl, K::name(), n );
+
+        T c = st_;
+
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+        if( n >= 32 && !detail::is_constant_evaluated() && detail::has_x86_pclmul() )
+        {
+            std::size_t const m = n & ~static_cast<std::size_t>( 15 );
+
+            if( m >= 1024 && detail::has_x86_avx512_vpclmul() )
+            {
+                c = static_cast<T>( detail::crc_update_vpclmul<W>( c, p, m, K::clmul ) );
+            }
+            else
+            {
+                c = static_cast<T>( detail::crc_update_pclmul<W>( c, p, m, K::clmul ) );
+            }
+
+            p += m;
+            n -= m;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+        if( n >= 32 && !detail::is_constant_evaluated() )
+        {
+            std::size_t const m = n & ~static_cast<std::size_t>( 15 );
+
+            c = static_cast<T>( detail::crc_update_pmull<W>( c, p, m, K::clmul ) );
+
+            p += m;
+            n -= m;
+        }
+
+#endif
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            c = static_cast<T>( ( c >> 8 ) ^ K::table[ ( c ^ p[ i ] ) & 0xFF ] );
+        }
+
+        st_ = c;
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // same as update( p, n ) with n zero bytes, in O(log n); appending a
+    // zero byte multiplies the register by x^8
+
+    BOOST_CXX14_CONSTEXPR void update_zeros( std::uint64_t n )
+    {
+        st_ = detail::crc_multiply<T>( detail::crc_shift<T>( n, K::P ), st_, K::P );
+    }
+
+    BOOST_CXX14_CONSTEXPR T result()
+    {
+        BOOST_HASH2_STATS_RESULT( crc_reflected_impl, K::name() );
+
+        T r = static_cast<T>( ~st_ );
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        st_ = static_cast<T>( ( st_ >> 8 ) ^ K::table[ ( st_ ^ 0xFF ) & 0xFF ] );
+
+        return r;
+    }
+
+    // Given crc_a, the CRC of a message A, and crc_b, the CRC of a message B
+    // of length len_b, returns the CRC of the concatenation of A and B
+
+    static BOOST_CXX14_CONSTEXPR T combine( T crc_a, T crc_b, std::uint64_t len_b )
+    {
+        return static_cast<T>( detail::crc_multiply<T>( detail::crc_shift<T>( len_b, K::P ), crc_a, K::P ) ^ crc_b );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.word( self.st_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + sizeof( T );
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        crc_reflected_impl tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_CRC_REFLECTED_HPP_INCLUDED
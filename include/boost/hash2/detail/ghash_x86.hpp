@@ -0,0 +1,157 @@
+#ifndef BOOST_HASH2_DETAIL_GHASH_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_GHASH_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// GHASH using PCLMULQDQ, https://www.intel.com/content/dam/develop/external/us/en/documents/clmul-wp-rev-2-02-2014-04-20.pdf
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// A block, byte-reversed, is the field element with its bits reversed;
+// the carryless product of two such values is the reversed product
+// shifted right by one bit, which ghash_reduce corrects before reducing
+// modulo x^128 + x^7 + x^2 + x + 1. The state y and the key h are
+// passed as { high, low } pairs of the byte-reversed values.
+
+BOOST_HASH2_TARGET("ssse3,pclmul")
+inline __m128i ghash_load( unsigned char const* p ) noexcept
+{
+    __m128i const bswap = _mm_setr_epi8( 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 );
+    return _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) ), bswap );
+}
+
+// ( hi, lo ) ^= a * b, unreduced
+
+BOOST_HASH2_TARGET("ssse3,pclmul")
+inline void ghash_clmul( __m128i a, __m128i b, __m128i& lo, __m128i& mid, __m128i& hi ) noexcept
+{
+    lo = _mm_xor_si128( lo, _mm_clmulepi64_si128( a, b, 0x00 ) );
+    hi = _mm_xor_si128( hi, _mm_clmulepi64_si128( a, b, 0x11 ) );
+    mid = _mm_xor_si128( mid, _mm_xor_si128( _mm_clmulepi64_si128( a, b, 0x10 ), _mm_clmulepi64_si128( a, b, 0x01 ) ) );
+}
+
+BOOST_HASH2_TARGET("ssse3,pclmul")
+inline __m128i ghash_reduce( __m128i lo, __m128i mid, __m128i hi ) noexcept
+{
+    lo = _mm_xor_si128( lo, _mm_slli_si128( mid, 8 ) );
+    hi = _mm_xor_si128( hi, _mm_srli_si128( mid, 8 ) );
+
+    // the 256 bit product, shifted left by one bit
+
+    __m128i t1 = _mm_srli_epi32( lo, 31 );
+    __m128i t2 = _mm_srli_epi32( hi, 31 );
+
+    lo = _mm_slli_epi32( lo, 1 );
+    hi = _mm_slli_epi32( hi, 1 );
+
+    __m128i t3 = _mm_srli_si128( t1, 12 );
+
+    t2 = _mm_slli_si128( t2, 4 );
+    t1 = _mm_slli_si128( t1, 4 );
+
+    lo = _mm_or_si128( lo, t1 );
+    hi = _mm_or_si128( hi, _mm_or_si128( t2, t3 ) );
+
+    // the reduction of the low half, folded into the high half
+
+    t1 = _mm_xor_si128( _mm_xor_si128( _mm_slli_epi32( lo, 31 ), _mm_slli_epi32( lo, 30 ) ), _mm_slli_epi32( lo, 25 ) );
+
+    t2 = _mm_srli_si128( t1, 4 );
+    t1 = _mm_slli_si128( t1, 12 );
+
+    lo = _mm_xor_si128( lo, t1 );
+
+    t3 = _mm_xor_si128( _mm_xor_si128( _mm_srli_epi32( lo, 1 ), _mm_srli_epi32( lo, 2 ) ), _mm_srli_epi32( lo, 7 ) );
+    t3 = _mm_xor_si128( t3, t2 );
+
+    lo = _mm_xor_si128( lo, t3 );
+
+    return _mm_xor_si128( hi, lo );
+}
+
+BOOST_HASH2_TARGET("ssse3,pclmul")
+inline __m128i ghash_mul( __m128i a, __m128i b ) noexcept
+{
+    __m128i lo = _mm_setzero_si128(), mid = lo, hi = lo;
+    detail::ghash_clmul( a, b, lo, mid, hi );
+
+    return detail::ghash_reduce( lo, mid, hi );
+}
+
+// n is a nonzero multiple of 16. Eight blocks at a time are multiplied
+// by H^8, ..., H^1, and the products summed before a single reduction.
+
+BOOST_HASH2_TARGET("ssse3,pclmul")
+inline void ghash_update_pclmul( std::uint64_t* y, std::uint64_t const* h, unsigned char const* p, std::size_t n ) noexcept
+{
+    __m128i const h1 = _mm_set_epi64x( static_cast<long long>( h[ 0 ] ), static_cast<long long>( h[ 1 ] ) );
+
+    __m128i x = _mm_set_epi64x( static_cast<long long>( y[ 0 ] ), static_cast<long long>( y[ 1 ] ) );
+
+    if( n >= 128 )
+    {
+        // hp[ i ] == H^(i+1)
+
+        __m128i hp[ 8 ];
+
+        hp[ 0 ] = h1;
+
+        for( int i = 1; i < 8; ++i )
+        {
+            hp[ i ] = detail::ghash_mul( hp[ i - 1 ], h1 );
+        }
+
+        do
+        {
+            __m128i lo = _mm_setzero_si128(), mid = lo, hi = lo;
+
+            detail::ghash_clmul( _mm_xor_si128( x, detail::ghash_load( p ) ), hp[ 7 ], lo, mid, hi );
+
+            for( int i = 1; i < 8; ++i )
+            {
+                detail::ghash_clmul( detail::ghash_load( p + 16 * i ), hp[ 7 - i ], lo, mid, hi );
+            }
+
+            x = detail::ghash_reduce( lo, mid, hi );
+
+            p += 128;
+            n -= 128;
+        }
+        while( n >= 128 );
+    }
+
+    while( n != 0 )
+    {
+        x = detail::ghash_mul( _mm_xor_si128( x, detail::ghash_load( p ) ), h1 );
+
+        p += 16;
+        n -= 16;
+    }
+
+    y[ 0 ] = static_cast<std::uint64_t>( _mm_cvtsi128_si64( _mm_srli_si128( x, 8 ) ) );
+    y[ 1 ] = static_cast<std::uint64_t>( _mm_cvtsi128_si64( x ) );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_GHASH_X86_HPP_INCLUDED
@@ -0,0 +1,36 @@
+#ifndef BOOST_HASH2_DETAIL_HAS_HASH_BATCH_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HAS_HASH_BATCH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// Hash::hash_batch( p, n, k, out ) is an optional member, which sets out[ i ]
+// to the 64 bit result of a copy of the hash object after update( p[ i ], n[ i ] ),
+// for i in [0, k)
+
+template<class Hash, class En = void> struct has_hash_batch: std::false_type
+{
+};
+
+template<class Hash> struct has_hash_batch<Hash, decltype( std::declval<Hash const&>().hash_batch( std::declval<unsigned char const* const*>(), std::declval<std::size_t const*>(), std::size_t(), std::declval<std::uint64_t*>() ), void() )>: std::true_type
+{
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HAS_HASH_BATCH_HPP_INCLUDED
@@ -0,0 +1,63 @@
+#ifndef BOOST_HASH2_DETAIL_HAS_TRACE_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HAS_TRACE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// Hash::trace_begin( char const* name ) and Hash::trace_end() are optional
+// members; hash_append calls them around the update calls made by each of
+// its overloads, name being a string literal identifying the overload
+
+template<class Hash, class En = void> struct has_trace: std::false_type
+{
+};
+
+template<class Hash> struct has_trace<Hash, decltype( std::declval<Hash&>().trace_begin( "" ), std::declval<Hash&>().trace_end(), void() )>: std::true_type
+{
+};
+
+template<class Hash> BOOST_CXX14_CONSTEXPR void trace_begin_( Hash& /*h*/, char const* /*name*/, std::false_type )
+{
+}
+
+template<class Hash> BOOST_CXX14_CONSTEXPR void trace_begin_( Hash& h, char const* name, std::true_type )
+{
+    h.trace_begin( name );
+}
+
+template<class Hash> BOOST_CXX14_CONSTEXPR void trace_begin( Hash& h, char const* name )
+{
+    detail::trace_begin_( h, name, has_trace<Hash>() );
+}
+
+template<class Hash> BOOST_CXX14_CONSTEXPR void trace_end_( Hash& /*h*/, std::false_type )
+{
+}
+
+template<class Hash> BOOST_CXX14_CONSTEXPR void trace_end_( Hash& h, std::true_type )
+{
+    h.trace_end();
+}
+
+template<class Hash> BOOST_CXX14_CONSTEXPR void trace_end( Hash& h )
+{
+    detail::trace_end_( h, has_trace<Hash>() );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HAS_TRACE_HPP_INCLUDED
@@ -0,0 +1,34 @@
+#ifndef BOOST_HASH2_DETAIL_HAS_UPDATE_WORD_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HAS_UPDATE_WORD_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// Hash::update_word( std::uint64_t w ) is an optional member, equivalent
+// to update( p, 8 ), where p points to the little-endian representation of w
+
+template<class Hash, class En = void> struct has_update_word: std::false_type
+{
+};
+
+template<class Hash> struct has_update_word<Hash, decltype( std::declval<Hash&>().update_word( std::uint64_t() ), void() )>: std::true_type
+{
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HAS_UPDATE_WORD_HPP_INCLUDED
@@ -0,0 +1,118 @@
+#ifndef BOOST_HASH2_DETAIL_HEX_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HEX_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Hexadecimal encoding and decoding, used by to_chars and from_chars
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/hex_x86.hpp>
+#include <boost/hash2/detail/hex_arm.hpp>
+#include <boost/hash2/detail/hex_wasm.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// encodes [p, p+n) into the 2*n characters at out, lowercase
+
+inline BOOST_CXX14_CONSTEXPR void hex_encode( unsigned char const* p, std::size_t n, char* out ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() && detail::has_x86_ssse3() )
+    {
+        i = detail::hex_encode_ssse3( p, n, out );
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() )
+    {
+        i = detail::hex_encode_neon( p, n, out );
+    }
+
+#elif defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() )
+    {
+        i = detail::hex_encode_wasm( p, n, out );
+    }
+
+#endif
+
+    constexpr char digits[] = "0123456789abcdef";
+
+    for( ; i < n; ++i )
+    {
+        out[ i*2 + 0 ] = digits[ p[i] >> 4 ];
+        out[ i*2 + 1 ] = digits[ p[i] & 0x0F ];
+    }
+}
+
+// the value of the hex digit c, either case, or -1
+
+inline BOOST_CXX14_CONSTEXPR int hex_value( char c ) noexcept
+{
+    return c >= '0' && c <= '9'? c - '0': c >= 'a' && c <= 'f'? c - 'a' + 10: c >= 'A' && c <= 'F'? c - 'A' + 10: -1;
+}
+
+// decodes the 2*n characters at p into [out, out+n); returns false
+// if one of them isn't a hex digit
+
+inline BOOST_CXX14_CONSTEXPR bool hex_decode( char const* p, std::size_t n, unsigned char* out ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() && detail::has_x86_ssse3() )
+    {
+        i = detail::hex_decode_ssse3( p, n, out );
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() )
+    {
+        i = detail::hex_decode_neon( p, n, out );
+    }
+
+#elif defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() )
+    {
+        i = detail::hex_decode_wasm( p, n, out );
+    }
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        int hi = detail::hex_value( p[ i*2 + 0 ] );
+        int lo = detail::hex_value( p[ i*2 + 1 ] );
+
+        if( ( hi | lo ) < 0 ) return false;
+
+        out[ i ] = static_cast<unsigned char>( hi * 16 + lo );
+    }
+
+    return true;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HEX_HPP_INCLUDED
@@ -0,0 +1,101 @@
+#ifndef BOOST_HASH2_DETAIL_HEX_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HEX_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Hexadecimal encoding and decoding using NEON
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// encodes the n / 16 * 16 leading bytes of [p, p+n) into out, returns
+// the number of bytes encoded
+
+inline std::size_t hex_encode_neon( unsigned char const* p, std::size_t n, char* out ) noexcept
+{
+    static unsigned char const table[ 16 ] = { '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' };
+
+    uint8x16_t const digits = vld1q_u8( table );
+
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        uint8x16_t v = vld1q_u8( p + i );
+
+        uint8x16x2_t r;
+
+        r.val[ 0 ] = vqtbl1q_u8( digits, vshrq_n_u8( v, 4 ) );
+        r.val[ 1 ] = vqtbl1q_u8( digits, vandq_u8( v, vdupq_n_u8( 0x0F ) ) );
+
+        // vst2q interleaves the high and low nibble digits
+        vst2q_u8( reinterpret_cast<unsigned char*>( out + 2 * i ), r );
+    }
+
+    return i;
+}
+
+// the values of the hex digits in v, and in valid, 0xFF for the
+// characters that are hex digits and 0 for the others
+
+inline uint8x16_t hex_nibbles_neon( uint8x16_t v, uint8x16_t& valid ) noexcept
+{
+    uint8x16_t d = vsubq_u8( v, vdupq_n_u8( '0' ) );
+    uint8x16_t is_d = vcltq_u8( d, vdupq_n_u8( 10 ) );
+
+    // setting 0x20 maps 'A'-'F' to 'a'-'f', and no other character into that range
+
+    uint8x16_t a = vsubq_u8( vorrq_u8( v, vdupq_n_u8( 0x20 ) ), vdupq_n_u8( 'a' ) );
+    uint8x16_t is_a = vcltq_u8( a, vdupq_n_u8( 6 ) );
+
+    valid = vorrq_u8( is_d, is_a );
+
+    return vbslq_u8( is_d, d, vaddq_u8( a, vdupq_n_u8( 10 ) ) );
+}
+
+// decodes the 2 * ( n / 16 * 16 ) leading characters at p into out,
+// stopping at the first group of 32 that contains a character other than
+// a hex digit; returns the number of bytes decoded
+
+inline std::size_t hex_decode_neon( char const* p, std::size_t n, unsigned char* out ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        // vld2q separates the high and low nibble digits
+        uint8x16x2_t v = vld2q_u8( reinterpret_cast<unsigned char const*>( p + 2 * i ) );
+
+        uint8x16_t ok0, ok1;
+
+        uint8x16_t hi = detail::hex_nibbles_neon( v.val[ 0 ], ok0 );
+        uint8x16_t lo = detail::hex_nibbles_neon( v.val[ 1 ], ok1 );
+
+        if( vminvq_u8( vandq_u8( ok0, ok1 ) ) != 0xFF ) break;
+
+        vst1q_u8( out + i, vorrq_u8( vshlq_n_u8( hi, 4 ), lo ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HEX_ARM_HPP_INCLUDED
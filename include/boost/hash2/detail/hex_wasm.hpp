@@ -0,0 +1,105 @@
+#ifndef BOOST_HASH2_DETAIL_HEX_WASM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HEX_WASM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Hexadecimal encoding and decoding using WebAssembly SIMD128
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+#include <wasm_simd128.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// encodes the n / 16 * 16 leading bytes of [p, p+n) into out, returns
+// the number of bytes encoded
+
+inline std::size_t hex_encode_wasm( unsigned char const* p, std::size_t n, char* out ) noexcept
+{
+    v128_t const digits = wasm_i8x16_make( '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' );
+
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        v128_t v = wasm_v128_load( p + i );
+
+        v128_t hi = wasm_i8x16_swizzle( digits, wasm_u8x16_shr( v, 4 ) );
+        v128_t lo = wasm_i8x16_swizzle( digits, wasm_v128_and( v, wasm_i8x16_splat( 0x0F ) ) );
+
+        // interleave the high and low nibble digits
+        v128_t r0 = wasm_i8x16_shuffle( hi, lo, 0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23 );
+        v128_t r1 = wasm_i8x16_shuffle( hi, lo, 8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31 );
+
+        wasm_v128_store( out + 2 * i, r0 );
+        wasm_v128_store( out + 2 * i + 16, r1 );
+    }
+
+    return i;
+}
+
+// the values of the hex digits in v, and in valid, 0xFF for the
+// characters that are hex digits and 0 for the others
+
+inline v128_t hex_nibbles_wasm( v128_t v, v128_t& valid ) noexcept
+{
+    v128_t d = wasm_i8x16_sub( v, wasm_i8x16_splat( '0' ) );
+    v128_t is_d = wasm_u8x16_lt( d, wasm_i8x16_splat( 10 ) );
+
+    // setting 0x20 maps 'A'-'F' to 'a'-'f', and no other character into that range
+
+    v128_t a = wasm_i8x16_sub( wasm_v128_or( v, wasm_i8x16_splat( 0x20 ) ), wasm_i8x16_splat( 'a' ) );
+    v128_t is_a = wasm_u8x16_lt( a, wasm_i8x16_splat( 6 ) );
+
+    valid = wasm_v128_or( is_d, is_a );
+
+    return wasm_v128_bitselect( d, wasm_i8x16_add( a, wasm_i8x16_splat( 10 ) ), is_d );
+}
+
+// decodes the 2 * ( n / 16 * 16 ) leading characters at p into out,
+// stopping at the first group of 32 that contains a character other than
+// a hex digit; returns the number of bytes decoded
+
+inline std::size_t hex_decode_wasm( char const* p, std::size_t n, unsigned char* out ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        v128_t v0 = wasm_v128_load( p + 2 * i );
+        v128_t v1 = wasm_v128_load( p + 2 * i + 16 );
+
+        // separate the high and low nibble digits
+        v128_t h = wasm_i8x16_shuffle( v0, v1, 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30 );
+        v128_t l = wasm_i8x16_shuffle( v0, v1, 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31 );
+
+        v128_t ok0, ok1;
+
+        v128_t hi = detail::hex_nibbles_wasm( h, ok0 );
+        v128_t lo = detail::hex_nibbles_wasm( l, ok1 );
+
+        if( !wasm_i8x16_all_true( wasm_v128_and( ok0, ok1 ) ) ) break;
+
+        wasm_v128_store( out + i, wasm_v128_or( wasm_i8x16_shl( hi, 4 ), lo ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HEX_WASM_HPP_INCLUDED
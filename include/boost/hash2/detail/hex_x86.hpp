@@ -0,0 +1,111 @@
+#ifndef BOOST_HASH2_DETAIL_HEX_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HEX_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Hexadecimal encoding and decoding using SSSE3
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// encodes the n / 16 * 16 leading bytes of [p, p+n) into out, returns
+// the number of bytes encoded
+//
+// Each nibble indexes the digit table with pshufb, and the high and low
+// nibble digits are then interleaved
+
+BOOST_HASH2_TARGET("ssse3")
+inline std::size_t hex_encode_ssse3( unsigned char const* p, std::size_t n, char* out ) noexcept
+{
+    __m128i const digits = _mm_setr_epi8( '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f' );
+    __m128i const mask = _mm_set1_epi8( 0x0F );
+
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m128i v = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+
+        __m128i hi = _mm_shuffle_epi8( digits, _mm_and_si128( _mm_srli_epi16( v, 4 ), mask ) );
+        __m128i lo = _mm_shuffle_epi8( digits, _mm_and_si128( v, mask ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 2 * i + 0 ), _mm_unpacklo_epi8( hi, lo ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + 2 * i + 16 ), _mm_unpackhi_epi8( hi, lo ) );
+    }
+
+    return i;
+}
+
+// the values of the hex digits in v, and in valid, 0xFF for the
+// characters that are hex digits and 0 for the others
+
+BOOST_HASH2_TARGET("ssse3")
+inline __m128i hex_nibbles_ssse3( __m128i v, __m128i& valid ) noexcept
+{
+    // the characters above 0x7F compare as negative, and are rejected
+
+    __m128i d = _mm_and_si128( _mm_cmpgt_epi8( v, _mm_set1_epi8( '0' - 1 ) ), _mm_cmpgt_epi8( _mm_set1_epi8( '9' + 1 ), v ) );
+
+    // setting 0x20 maps 'A'-'F' to 'a'-'f', and no other character into that range
+
+    __m128i l = _mm_or_si128( v, _mm_set1_epi8( 0x20 ) );
+    __m128i a = _mm_and_si128( _mm_cmpgt_epi8( l, _mm_set1_epi8( 'a' - 1 ) ), _mm_cmpgt_epi8( _mm_set1_epi8( 'f' + 1 ), l ) );
+
+    valid = _mm_or_si128( d, a );
+
+    return _mm_or_si128( _mm_and_si128( d, _mm_sub_epi8( v, _mm_set1_epi8( '0' ) ) ), _mm_and_si128( a, _mm_sub_epi8( l, _mm_set1_epi8( 'a' - 10 ) ) ) );
+}
+
+// decodes the 2 * ( n / 16 * 16 ) leading characters at p into out,
+// stopping at the first group of 32 that contains a character other than
+// a hex digit; returns the number of bytes decoded
+//
+// pmaddubsw with the weights 16, 1 combines each pair of nibbles
+
+BOOST_HASH2_TARGET("ssse3")
+inline std::size_t hex_decode_ssse3( char const* p, std::size_t n, unsigned char* out ) noexcept
+{
+    __m128i const w = _mm_set1_epi16( 0x0110 );
+
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m128i v0 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 2 * i + 0 ) );
+        __m128i v1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + 2 * i + 16 ) );
+
+        __m128i ok0, ok1;
+
+        __m128i n0 = detail::hex_nibbles_ssse3( v0, ok0 );
+        __m128i n1 = detail::hex_nibbles_ssse3( v1, ok1 );
+
+        if( _mm_movemask_epi8( _mm_and_si128( ok0, ok1 ) ) != 0xFFFF ) break;
+
+        __m128i r = _mm_packus_epi16( _mm_maddubs_epi16( n0, w ), _mm_maddubs_epi16( n1, w ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( out + i ), r );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HEX_X86_HPP_INCLUDED
@@ -0,0 +1,114 @@
+#ifndef BOOST_HASH2_DETAIL_HIGHWAYHASH_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HIGHWAYHASH_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HighwayHash updates using NEON, with the four lanes of the state
+// in pairs of registers
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+struct highwayhash_neon
+{
+    uint64x2_t v0[ 2 ], v1[ 2 ], mul0[ 2 ], mul1[ 2 ];
+};
+
+inline void highwayhash_update_neon( highwayhash_neon& s, uint64x2_t const lanes[ 2 ] ) noexcept
+{
+    // the byte shuffle of ZipperMergeAndAdd
+
+    static unsigned char const zipper[ 16 ] = { 3, 12, 2, 5, 14, 1, 15, 0, 11, 4, 10, 13, 9, 6, 8, 7 };
+    uint8x16_t const z = vld1q_u8( zipper );
+
+    for( int i = 0; i < 2; ++i )
+    {
+        s.v1[ i ] = vaddq_u64( s.v1[ i ], vaddq_u64( s.mul0[ i ], lanes[ i ] ) );
+        s.mul0[ i ] = veorq_u64( s.mul0[ i ], vmull_u32( vmovn_u64( s.v1[ i ] ), vshrn_n_u64( s.v0[ i ], 32 ) ) );
+        s.v0[ i ] = vaddq_u64( s.v0[ i ], s.mul1[ i ] );
+        s.mul1[ i ] = veorq_u64( s.mul1[ i ], vmull_u32( vmovn_u64( s.v0[ i ] ), vshrn_n_u64( s.v1[ i ], 32 ) ) );
+
+        s.v0[ i ] = vaddq_u64( s.v0[ i ], vreinterpretq_u64_u8( vqtbl1q_u8( vreinterpretq_u8_u64( s.v1[ i ] ), z ) ) );
+        s.v1[ i ] = vaddq_u64( s.v1[ i ], vreinterpretq_u64_u8( vqtbl1q_u8( vreinterpretq_u8_u64( s.v0[ i ] ), z ) ) );
+    }
+}
+
+inline void highwayhash_load_neon( highwayhash_neon& s, std::uint64_t const v0[ 4 ], std::uint64_t const v1[ 4 ], std::uint64_t const mul0[ 4 ], std::uint64_t const mul1[ 4 ] ) noexcept
+{
+    for( int i = 0; i < 2; ++i )
+    {
+        s.v0[ i ] = vld1q_u64( v0 + i * 2 );
+        s.v1[ i ] = vld1q_u64( v1 + i * 2 );
+        s.mul0[ i ] = vld1q_u64( mul0 + i * 2 );
+        s.mul1[ i ] = vld1q_u64( mul1 + i * 2 );
+    }
+}
+
+inline void highwayhash_store_neon( highwayhash_neon const& s, std::uint64_t v0[ 4 ], std::uint64_t v1[ 4 ], std::uint64_t mul0[ 4 ], std::uint64_t mul1[ 4 ] ) noexcept
+{
+    for( int i = 0; i < 2; ++i )
+    {
+        vst1q_u64( v0 + i * 2, s.v0[ i ] );
+        vst1q_u64( v1 + i * 2, s.v1[ i ] );
+        vst1q_u64( mul0 + i * 2, s.mul0[ i ] );
+        vst1q_u64( mul1 + i * 2, s.mul1[ i ] );
+    }
+}
+
+inline void highwayhash_update_neon( std::uint64_t v0[ 4 ], std::uint64_t v1[ 4 ], std::uint64_t mul0[ 4 ], std::uint64_t mul1[ 4 ], unsigned char const* p, std::size_t n ) noexcept
+{
+    highwayhash_neon s;
+    highwayhash_load_neon( s, v0, v1, mul0, mul1 );
+
+    for( ; n > 0; --n, p += 32 )
+    {
+        uint64x2_t const lanes[ 2 ] = { vreinterpretq_u64_u8( vld1q_u8( p ) ), vreinterpretq_u64_u8( vld1q_u8( p + 16 ) ) };
+        highwayhash_update_neon( s, lanes );
+    }
+
+    highwayhash_store_neon( s, v0, v1, mul0, mul1 );
+}
+
+// k updates with v0, its 128 bit halves and the 32 bit halves of
+// each lane swapped
+
+inline void highwayhash_permute_neon( std::uint64_t v0[ 4 ], std::uint64_t v1[ 4 ], std::uint64_t mul0[ 4 ], std::uint64_t mul1[ 4 ], int k ) noexcept
+{
+    highwayhash_neon s;
+    highwayhash_load_neon( s, v0, v1, mul0, mul1 );
+
+    for( int i = 0; i < k; ++i )
+    {
+        uint64x2_t const lanes[ 2 ] =
+        {
+            vreinterpretq_u64_u32( vrev64q_u32( vreinterpretq_u32_u64( s.v0[ 1 ] ) ) ),
+            vreinterpretq_u64_u32( vrev64q_u32( vreinterpretq_u32_u64( s.v0[ 0 ] ) ) ),
+        };
+
+        highwayhash_update_neon( s, lanes );
+    }
+
+    highwayhash_store_neon( s, v0, v1, mul0, mul1 );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HIGHWAYHASH_ARM_HPP_INCLUDED
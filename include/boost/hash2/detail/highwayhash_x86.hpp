@@ -0,0 +1,107 @@
+#ifndef BOOST_HASH2_DETAIL_HIGHWAYHASH_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HIGHWAYHASH_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HighwayHash updates using AVX2, with the four lanes of the state
+// in a single register
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+struct highwayhash_avx2
+{
+    __m256i v0, v1, mul0, mul1;
+};
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void highwayhash_update_avx2( highwayhash_avx2& s, __m256i lanes ) noexcept
+{
+    // the byte shuffle of ZipperMergeAndAdd, within each 128 bit half
+
+    __m256i const zipper = _mm256_setr_epi8(
+
+        3, 12, 2, 5, 14, 1, 15, 0, 11, 4, 10, 13, 9, 6, 8, 7,
+        3, 12, 2, 5, 14, 1, 15, 0, 11, 4, 10, 13, 9, 6, 8, 7
+    );
+
+    s.v1 = _mm256_add_epi64( s.v1, _mm256_add_epi64( s.mul0, lanes ) );
+    s.mul0 = _mm256_xor_si256( s.mul0, _mm256_mul_epu32( s.v1, _mm256_srli_epi64( s.v0, 32 ) ) );
+    s.v0 = _mm256_add_epi64( s.v0, s.mul1 );
+    s.mul1 = _mm256_xor_si256( s.mul1, _mm256_mul_epu32( s.v0, _mm256_srli_epi64( s.v1, 32 ) ) );
+
+    s.v0 = _mm256_add_epi64( s.v0, _mm256_shuffle_epi8( s.v1, zipper ) );
+    s.v1 = _mm256_add_epi64( s.v1, _mm256_shuffle_epi8( s.v0, zipper ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline void highwayhash_update_avx2( std::uint64_t v0[ 4 ], std::uint64_t v1[ 4 ], std::uint64_t mul0[ 4 ], std::uint64_t mul1[ 4 ], unsigned char const* p, std::size_t n ) noexcept
+{
+    highwayhash_avx2 s =
+    {
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v0 ) ),
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v1 ) ),
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul0 ) ),
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul1 ) ),
+    };
+
+    for( ; n > 0; --n, p += 32 )
+    {
+        highwayhash_update_avx2( s, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) ) );
+    }
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( v0 ), s.v0 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( v1 ), s.v1 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul0 ), s.mul0 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul1 ), s.mul1 );
+}
+
+// k updates with v0, its 128 bit halves and the 32 bit halves of
+// each lane swapped
+
+BOOST_HASH2_TARGET("avx2")
+inline void highwayhash_permute_avx2( std::uint64_t v0[ 4 ], std::uint64_t v1[ 4 ], std::uint64_t mul0[ 4 ], std::uint64_t mul1[ 4 ], int k ) noexcept
+{
+    highwayhash_avx2 s =
+    {
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v0 ) ),
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( v1 ) ),
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul0 ) ),
+        _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mul1 ) ),
+    };
+
+    __m256i const indices = _mm256_setr_epi32( 5, 4, 7, 6, 1, 0, 3, 2 );
+
+    for( int i = 0; i < k; ++i )
+    {
+        highwayhash_update_avx2( s, _mm256_permutevar8x32_epi32( s.v0, indices ) );
+    }
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( v0 ), s.v0 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( v1 ), s.v1 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul0 ), s.mul0 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( mul1 ), s.mul1 );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HIGHWAYHASH_X86_HPP_INCLUDED
@@ -0,0 +1,46 @@
+#ifndef BOOST_HASH2_DETAIL_HLL_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HLL_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HyperLogLog register merging using NEON
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// p[i] = max( p[i], q[i] ) for the n / 16 * 16 leading bytes; returns
+// the number of bytes processed
+
+inline std::size_t hll_merge_neon( std::uint8_t* p, std::uint8_t const* q, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        vst1q_u8( p + i, vmaxq_u8( vld1q_u8( p + i ), vld1q_u8( q + i ) ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HLL_ARM_HPP_INCLUDED
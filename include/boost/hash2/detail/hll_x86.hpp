@@ -0,0 +1,50 @@
+#ifndef BOOST_HASH2_DETAIL_HLL_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_HLL_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HyperLogLog register merging using SSE2
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// p[i] = max( p[i], q[i] ) for the n / 16 * 16 leading bytes; returns
+// the number of bytes processed
+
+BOOST_HASH2_TARGET("sse2")
+inline std::size_t hll_merge_sse2( std::uint8_t* p, std::uint8_t const* q, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m128i a = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i ) );
+        __m128i b = _mm_loadu_si128( reinterpret_cast<__m128i const*>( q + i ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( p + i ), _mm_max_epu8( a, b ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_HLL_X86_HPP_INCLUDED
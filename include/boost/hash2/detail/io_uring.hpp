@@ -0,0 +1,239 @@
+#ifndef BOOST_HASH2_DETAIL_IO_URING_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_IO_URING_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// A minimal io_uring submission and completion queue, on top of the raw
+// system calls, so that liburing isn't required
+//
+// Define BOOST_HASH2_DISABLE_IO_URING to not use io_uring
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_HASH2_DISABLE_IO_URING) && defined(__linux__) && ( defined(__GNUC__) || defined(__clang__) ) && defined(__has_include)
+# if __has_include(<linux/io_uring.h>)
+#  define BOOST_HASH2_HAS_IO_URING
+# endif
+#endif
+
+#if defined(BOOST_HASH2_HAS_IO_URING)
+
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+class io_uring_queue
+{
+private:
+
+    int fd_ = -1;
+
+    void* sq_ptr_ = MAP_FAILED;
+    std::size_t sq_size_ = 0;
+
+    void* cq_ptr_ = MAP_FAILED;
+    std::size_t cq_size_ = 0;
+
+    io_uring_sqe* sqes_ = static_cast<io_uring_sqe*>( MAP_FAILED );
+    std::size_t sqes_size_ = 0;
+
+    unsigned* sq_tail_ = 0;
+    unsigned sq_mask_ = 0;
+    unsigned* sq_array_ = 0;
+
+    unsigned* cq_head_ = 0;
+    unsigned* cq_tail_ = 0;
+    unsigned cq_mask_ = 0;
+    io_uring_cqe* cqes_ = 0;
+
+    // the entries added since the last enter
+
+    unsigned pending_ = 0;
+
+private:
+
+    template<class T> static T* at( void* p, unsigned offset ) noexcept
+    {
+        return reinterpret_cast<T*>( static_cast<unsigned char*>( p ) + offset );
+    }
+
+    void init( unsigned entries ) noexcept
+    {
+        io_uring_params pr;
+        std::memset( &pr, 0, sizeof( pr ) );
+
+        fd_ = static_cast<int>( ::syscall( __NR_io_uring_setup, entries, &pr ) );
+
+        if( fd_ < 0 ) return;
+
+        sq_size_ = pr.sq_off.array + pr.sq_entries * sizeof( unsigned );
+        cq_size_ = pr.cq_off.cqes + pr.cq_entries * sizeof( io_uring_cqe );
+
+        bool const single = ( pr.features & IORING_FEAT_SINGLE_MMAP ) != 0;
+
+        if( single && cq_size_ > sq_size_ )
+        {
+            sq_size_ = cq_size_;
+        }
+
+        sq_ptr_ = ::mmap( 0, sq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQ_RING );
+
+        if( sq_ptr_ == MAP_FAILED ) return close();
+
+        if( single )
+        {
+            cq_ptr_ = sq_ptr_;
+        }
+        else
+        {
+            cq_ptr_ = ::mmap( 0, cq_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_CQ_RING );
+            if( cq_ptr_ == MAP_FAILED ) return close();
+        }
+
+        sqes_size_ = pr.sq_entries * sizeof( io_uring_sqe );
+        sqes_ = static_cast<io_uring_sqe*>( ::mmap( 0, sqes_size_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, IORING_OFF_SQES ) );
+
+        if( sqes_ == MAP_FAILED ) return close();
+
+        sq_tail_ = at<unsigned>( sq_ptr_, pr.sq_off.tail );
+        sq_mask_ = *at<unsigned>( sq_ptr_, pr.sq_off.ring_mask );
+        sq_array_ = at<unsigned>( sq_ptr_, pr.sq_off.array );
+
+        cq_head_ = at<unsigned>( cq_ptr_, pr.cq_off.head );
+        cq_tail_ = at<unsigned>( cq_ptr_, pr.cq_off.tail );
+        cq_mask_ = *at<unsigned>( cq_ptr_, pr.cq_off.ring_mask );
+        cqes_ = at<io_uring_cqe>( cq_ptr_, pr.cq_off.cqes );
+    }
+
+    void close() noexcept
+    {
+        if( sqes_ != MAP_FAILED ) ::munmap( sqes_, sqes_size_ );
+        if( cq_ptr_ != MAP_FAILED && cq_ptr_ != sq_ptr_ ) ::munmap( cq_ptr_, cq_size_ );
+        if( sq_ptr_ != MAP_FAILED ) ::munmap( sq_ptr_, sq_size_ );
+        if( fd_ >= 0 ) ::close( fd_ );
+
+        sqes_ = static_cast<io_uring_sqe*>( MAP_FAILED );
+        cq_ptr_ = sq_ptr_ = MAP_FAILED;
+        fd_ = -1;
+    }
+
+public:
+
+    explicit io_uring_queue( unsigned entries ) noexcept
+    {
+        init( entries );
+    }
+
+    io_uring_queue( io_uring_queue const& ) = delete;
+    io_uring_queue& operator=( io_uring_queue const& ) = delete;
+
+    ~io_uring_queue()
+    {
+        close();
+    }
+
+    // false if the kernel doesn't support io_uring, or doesn't allow it
+
+    bool valid() const noexcept
+    {
+        return fd_ >= 0;
+    }
+
+    bool register_buffers( iovec const* v, unsigned n ) noexcept
+    {
+        return ::syscall( __NR_io_uring_register, fd_, IORING_REGISTER_BUFFERS, v, n ) == 0;
+    }
+
+    // queues a read of [p, p + n) from fd at offset; with index >= 0, p must
+    // be in the registered buffer index. The submission queue must have room
+
+    void prepare_read( int fd, void* p, unsigned n, std::uint64_t offset, int index, std::uint64_t user_data ) noexcept
+    {
+        unsigned const tail = *sq_tail_;
+        unsigned const i = tail & sq_mask_;
+
+        io_uring_sqe* e = sqes_ + i;
+        std::memset( e, 0, sizeof( *e ) );
+
+        e->opcode = static_cast<unsigned char>( index >= 0? IORING_OP_READ_FIXED: IORING_OP_READ );
+        e->fd = fd;
+        e->addr = reinterpret_cast<std::uintptr_t>( p );
+        e->len = n;
+        e->off = offset;
+        e->buf_index = static_cast<unsigned short>( index >= 0? index: 0 );
+        e->user_data = user_data;
+
+        sq_array_[ i ] = i;
+
+        __atomic_store_n( sq_tail_, tail + 1, __ATOMIC_RELEASE );
+
+        ++pending_;
+    }
+
+    // submits the queued entries, all with a single system call, and waits
+    // for at least wait completions; returns 0 or -errno
+
+    int submit( unsigned wait ) noexcept
+    {
+        for( ;; )
+        {
+            unsigned const flags = wait > 0? IORING_ENTER_GETEVENTS: 0;
+            long r = ::syscall( __NR_io_uring_enter, fd_, pending_, wait, flags, 0, 0 );
+
+            if( r >= 0 )
+            {
+                pending_ -= static_cast<unsigned>( r );
+
+                // the kernel may consume fewer entries than submitted
+
+                if( pending_ == 0 ) return 0;
+                continue;
+            }
+
+            if( errno == EINTR ) continue;
+
+            return -errno;
+        }
+    }
+
+    // removes a completion; returns false if there are none
+
+    bool pop( std::uint64_t& user_data, int& res ) noexcept
+    {
+        unsigned const head = *cq_head_;
+
+        if( head == __atomic_load_n( cq_tail_, __ATOMIC_ACQUIRE ) ) return false;
+
+        io_uring_cqe const* e = cqes_ + ( head & cq_mask_ );
+
+        user_data = e->user_data;
+        res = e->res;
+
+        __atomic_store_n( cq_head_, head + 1, __ATOMIC_RELEASE );
+
+        return true;
+    }
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_IO_URING)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_IO_URING_HPP_INCLUDED
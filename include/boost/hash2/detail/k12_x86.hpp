@@ -0,0 +1,427 @@
+#ifndef BOOST_HASH2_DETAIL_K12_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_K12_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// KangarooTwelve leaves, four at a time with AVX2 and eight at a time
+// with AVX-512F, with lane i of each register holding the state word
+// of leaf i
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/keccak.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// AVX2
+
+template<int N>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i k12_rol_avx2( __m256i x ) noexcept
+{
+    return _mm256_or_si256( _mm256_slli_epi64( x, N ), _mm256_srli_epi64( x, 64 - N ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline void k12_permute_avx2( __m256i A[ 25 ] ) noexcept
+{
+    for( int i = 12; i < 24; ++i )
+    {
+        // theta
+
+        __m256i const C0 = _mm256_xor_si256( _mm256_xor_si256( _mm256_xor_si256( A[ 0 ], A[ 5 ] ), _mm256_xor_si256( A[ 10 ], A[ 15 ] ) ), A[ 20 ] );
+        __m256i const C1 = _mm256_xor_si256( _mm256_xor_si256( _mm256_xor_si256( A[ 1 ], A[ 6 ] ), _mm256_xor_si256( A[ 11 ], A[ 16 ] ) ), A[ 21 ] );
+        __m256i const C2 = _mm256_xor_si256( _mm256_xor_si256( _mm256_xor_si256( A[ 2 ], A[ 7 ] ), _mm256_xor_si256( A[ 12 ], A[ 17 ] ) ), A[ 22 ] );
+        __m256i const C3 = _mm256_xor_si256( _mm256_xor_si256( _mm256_xor_si256( A[ 3 ], A[ 8 ] ), _mm256_xor_si256( A[ 13 ], A[ 18 ] ) ), A[ 23 ] );
+        __m256i const C4 = _mm256_xor_si256( _mm256_xor_si256( _mm256_xor_si256( A[ 4 ], A[ 9 ] ), _mm256_xor_si256( A[ 14 ], A[ 19 ] ) ), A[ 24 ] );
+
+        __m256i const D0 = _mm256_xor_si256( C4, k12_rol_avx2<1>( C1 ) );
+        __m256i const D1 = _mm256_xor_si256( C0, k12_rol_avx2<1>( C2 ) );
+        __m256i const D2 = _mm256_xor_si256( C1, k12_rol_avx2<1>( C3 ) );
+        __m256i const D3 = _mm256_xor_si256( C2, k12_rol_avx2<1>( C4 ) );
+        __m256i const D4 = _mm256_xor_si256( C3, k12_rol_avx2<1>( C0 ) );
+
+        // the rest of theta, rho and pi
+
+        __m256i const B0 = _mm256_xor_si256( A[ 0 ], D0 );
+        __m256i const B1 = k12_rol_avx2<44>( _mm256_xor_si256( A[ 6 ], D1 ) );
+        __m256i const B2 = k12_rol_avx2<43>( _mm256_xor_si256( A[ 12 ], D2 ) );
+        __m256i const B3 = k12_rol_avx2<21>( _mm256_xor_si256( A[ 18 ], D3 ) );
+        __m256i const B4 = k12_rol_avx2<14>( _mm256_xor_si256( A[ 24 ], D4 ) );
+        __m256i const B5 = k12_rol_avx2<28>( _mm256_xor_si256( A[ 3 ], D3 ) );
+        __m256i const B6 = k12_rol_avx2<20>( _mm256_xor_si256( A[ 9 ], D4 ) );
+        __m256i const B7 = k12_rol_avx2<3>( _mm256_xor_si256( A[ 10 ], D0 ) );
+        __m256i const B8 = k12_rol_avx2<45>( _mm256_xor_si256( A[ 16 ], D1 ) );
+        __m256i const B9 = k12_rol_avx2<61>( _mm256_xor_si256( A[ 22 ], D2 ) );
+        __m256i const B10 = k12_rol_avx2<1>( _mm256_xor_si256( A[ 1 ], D1 ) );
+        __m256i const B11 = k12_rol_avx2<6>( _mm256_xor_si256( A[ 7 ], D2 ) );
+        __m256i const B12 = k12_rol_avx2<25>( _mm256_xor_si256( A[ 13 ], D3 ) );
+        __m256i const B13 = k12_rol_avx2<8>( _mm256_xor_si256( A[ 19 ], D4 ) );
+        __m256i const B14 = k12_rol_avx2<18>( _mm256_xor_si256( A[ 20 ], D0 ) );
+        __m256i const B15 = k12_rol_avx2<27>( _mm256_xor_si256( A[ 4 ], D4 ) );
+        __m256i const B16 = k12_rol_avx2<36>( _mm256_xor_si256( A[ 5 ], D0 ) );
+        __m256i const B17 = k12_rol_avx2<10>( _mm256_xor_si256( A[ 11 ], D1 ) );
+        __m256i const B18 = k12_rol_avx2<15>( _mm256_xor_si256( A[ 17 ], D2 ) );
+        __m256i const B19 = k12_rol_avx2<56>( _mm256_xor_si256( A[ 23 ], D3 ) );
+        __m256i const B20 = k12_rol_avx2<62>( _mm256_xor_si256( A[ 2 ], D2 ) );
+        __m256i const B21 = k12_rol_avx2<55>( _mm256_xor_si256( A[ 8 ], D3 ) );
+        __m256i const B22 = k12_rol_avx2<39>( _mm256_xor_si256( A[ 14 ], D4 ) );
+        __m256i const B23 = k12_rol_avx2<41>( _mm256_xor_si256( A[ 15 ], D0 ) );
+        __m256i const B24 = k12_rol_avx2<2>( _mm256_xor_si256( A[ 21 ], D1 ) );
+
+        // chi
+
+        A[ 0 ] = _mm256_xor_si256( B0, _mm256_andnot_si256( B1, B2 ) );
+        A[ 1 ] = _mm256_xor_si256( B1, _mm256_andnot_si256( B2, B3 ) );
+        A[ 2 ] = _mm256_xor_si256( B2, _mm256_andnot_si256( B3, B4 ) );
+        A[ 3 ] = _mm256_xor_si256( B3, _mm256_andnot_si256( B4, B0 ) );
+        A[ 4 ] = _mm256_xor_si256( B4, _mm256_andnot_si256( B0, B1 ) );
+
+        A[ 5 ] = _mm256_xor_si256( B5, _mm256_andnot_si256( B6, B7 ) );
+        A[ 6 ] = _mm256_xor_si256( B6, _mm256_andnot_si256( B7, B8 ) );
+        A[ 7 ] = _mm256_xor_si256( B7, _mm256_andnot_si256( B8, B9 ) );
+        A[ 8 ] = _mm256_xor_si256( B8, _mm256_andnot_si256( B9, B5 ) );
+        A[ 9 ] = _mm256_xor_si256( B9, _mm256_andnot_si256( B5, B6 ) );
+
+        A[ 10 ] = _mm256_xor_si256( B10, _mm256_andnot_si256( B11, B12 ) );
+        A[ 11 ] = _mm256_xor_si256( B11, _mm256_andnot_si256( B12, B13 ) );
+        A[ 12 ] = _mm256_xor_si256( B12, _mm256_andnot_si256( B13, B14 ) );
+        A[ 13 ] = _mm256_xor_si256( B13, _mm256_andnot_si256( B14, B10 ) );
+        A[ 14 ] = _mm256_xor_si256( B14, _mm256_andnot_si256( B10, B11 ) );
+
+        A[ 15 ] = _mm256_xor_si256( B15, _mm256_andnot_si256( B16, B17 ) );
+        A[ 16 ] = _mm256_xor_si256( B16, _mm256_andnot_si256( B17, B18 ) );
+        A[ 17 ] = _mm256_xor_si256( B17, _mm256_andnot_si256( B18, B19 ) );
+        A[ 18 ] = _mm256_xor_si256( B18, _mm256_andnot_si256( B19, B15 ) );
+        A[ 19 ] = _mm256_xor_si256( B19, _mm256_andnot_si256( B15, B16 ) );
+
+        A[ 20 ] = _mm256_xor_si256( B20, _mm256_andnot_si256( B21, B22 ) );
+        A[ 21 ] = _mm256_xor_si256( B21, _mm256_andnot_si256( B22, B23 ) );
+        A[ 22 ] = _mm256_xor_si256( B22, _mm256_andnot_si256( B23, B24 ) );
+        A[ 23 ] = _mm256_xor_si256( B23, _mm256_andnot_si256( B24, B20 ) );
+        A[ 24 ] = _mm256_xor_si256( B24, _mm256_andnot_si256( B20, B21 ) );
+
+        // iota
+
+        A[ 0 ] = _mm256_xor_si256( A[ 0 ], _mm256_set1_epi64x( static_cast<long long>( keccak_constants<>::RC[ i ] ) ) );
+    }
+}
+
+// the words w to w+3 of four leaves, transposed so that r[j]
+// holds word w+j of each leaf
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void k12_load4_avx2( unsigned char const* p, std::size_t stride, __m256i r[ 4 ] ) noexcept
+{
+    __m256i x0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 0 * stride ) );
+    __m256i x1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 1 * stride ) );
+    __m256i x2 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 2 * stride ) );
+    __m256i x3 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 3 * stride ) );
+
+    __m256i t0 = _mm256_unpacklo_epi64( x0, x1 );
+    __m256i t1 = _mm256_unpackhi_epi64( x0, x1 );
+    __m256i t2 = _mm256_unpacklo_epi64( x2, x3 );
+    __m256i t3 = _mm256_unpackhi_epi64( x2, x3 );
+
+    r[ 0 ] = _mm256_permute2x128_si256( t0, t2, 0x20 );
+    r[ 1 ] = _mm256_permute2x128_si256( t1, t3, 0x20 );
+    r[ 2 ] = _mm256_permute2x128_si256( t0, t2, 0x31 );
+    r[ 3 ] = _mm256_permute2x128_si256( t1, t3, 0x31 );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i k12_load1_avx2( unsigned char const* p, std::size_t stride ) noexcept
+{
+    return _mm256_set_epi64x(
+
+        static_cast<long long>( detail::read64le( p + 3 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 2 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 1 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 0 * stride ) )
+    );
+}
+
+// hashes the four 8192 byte chunks starting at p with TurboSHAKE128,
+// domain separation byte 0x0B, and writes their 32 byte chaining
+// values to cv
+
+BOOST_HASH2_TARGET("avx2")
+inline void k12_leaves_avx2( unsigned char const* p, unsigned char* cv ) noexcept
+{
+    std::size_t const stride = 8192;
+
+    __m256i A[ 25 ];
+
+    for( int i = 0; i < 25; ++i )
+    {
+        A[ i ] = _mm256_setzero_si256();
+    }
+
+    // 48 full blocks of 168 bytes, then the last 128 bytes
+
+    for( int j = 0; j < 49; ++j, p += 168 )
+    {
+        int const n = j < 48? 21: 16;
+
+        for( int i = 0; i + 4 <= n; i += 4 )
+        {
+            __m256i r[ 4 ];
+            k12_load4_avx2( p + i * 8, stride, r );
+
+            A[ i + 0 ] = _mm256_xor_si256( A[ i + 0 ], r[ 0 ] );
+            A[ i + 1 ] = _mm256_xor_si256( A[ i + 1 ], r[ 1 ] );
+            A[ i + 2 ] = _mm256_xor_si256( A[ i + 2 ], r[ 2 ] );
+            A[ i + 3 ] = _mm256_xor_si256( A[ i + 3 ], r[ 3 ] );
+        }
+
+        if( n == 21 )
+        {
+            A[ 20 ] = _mm256_xor_si256( A[ 20 ], k12_load1_avx2( p + 160, stride ) );
+        }
+        else
+        {
+            // the suffix 0x0B and the final bit of the padding
+
+            A[ 16 ] = _mm256_xor_si256( A[ 16 ], _mm256_set1_epi64x( 0x0B ) );
+            A[ 20 ] = _mm256_xor_si256( A[ 20 ], _mm256_set1_epi64x( static_cast<long long>( 0x8000000000000000ull ) ) );
+        }
+
+        k12_permute_avx2( A );
+    }
+
+    for( int i = 0; i < 4; ++i )
+    {
+        std::uint64_t w[ 4 ];
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( w ), A[ i ] );
+
+        for( int k = 0; k < 4; ++k )
+        {
+            detail::write64le( cv + k * 32 + i * 8, w[ k ] );
+        }
+    }
+}
+
+// AVX-512F
+
+#if defined(BOOST_GCC) && BOOST_GCC >= 120000 && BOOST_GCC < 130000
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wuninitialized" // _mm512_undefined_epi32 in the g++ 12 headers
+#endif
+
+template<int N>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE __m512i k12_rol_avx512( __m512i x ) noexcept
+{
+    return _mm512_rol_epi64( x, N );
+}
+
+BOOST_HASH2_TARGET("avx512f")
+inline void k12_permute_avx512( __m512i A[ 25 ] ) noexcept
+{
+    for( int i = 12; i < 24; ++i )
+    {
+        // theta; 0x96 is a ^ b ^ c
+
+        __m512i const C0 = _mm512_ternarylogic_epi64( _mm512_ternarylogic_epi64( A[ 0 ], A[ 5 ], A[ 10 ], 0x96 ), A[ 15 ], A[ 20 ], 0x96 );
+        __m512i const C1 = _mm512_ternarylogic_epi64( _mm512_ternarylogic_epi64( A[ 1 ], A[ 6 ], A[ 11 ], 0x96 ), A[ 16 ], A[ 21 ], 0x96 );
+        __m512i const C2 = _mm512_ternarylogic_epi64( _mm512_ternarylogic_epi64( A[ 2 ], A[ 7 ], A[ 12 ], 0x96 ), A[ 17 ], A[ 22 ], 0x96 );
+        __m512i const C3 = _mm512_ternarylogic_epi64( _mm512_ternarylogic_epi64( A[ 3 ], A[ 8 ], A[ 13 ], 0x96 ), A[ 18 ], A[ 23 ], 0x96 );
+        __m512i const C4 = _mm512_ternarylogic_epi64( _mm512_ternarylogic_epi64( A[ 4 ], A[ 9 ], A[ 14 ], 0x96 ), A[ 19 ], A[ 24 ], 0x96 );
+
+        __m512i const D0 = _mm512_xor_si512( C4, k12_rol_avx512<1>( C1 ) );
+        __m512i const D1 = _mm512_xor_si512( C0, k12_rol_avx512<1>( C2 ) );
+        __m512i const D2 = _mm512_xor_si512( C1, k12_rol_avx512<1>( C3 ) );
+        __m512i const D3 = _mm512_xor_si512( C2, k12_rol_avx512<1>( C4 ) );
+        __m512i const D4 = _mm512_xor_si512( C3, k12_rol_avx512<1>( C0 ) );
+
+        // the rest of theta, rho and pi
+
+        __m512i const B0 = _mm512_xor_si512( A[ 0 ], D0 );
+        __m512i const B1 = k12_rol_avx512<44>( _mm512_xor_si512( A[ 6 ], D1 ) );
+        __m512i const B2 = k12_rol_avx512<43>( _mm512_xor_si512( A[ 12 ], D2 ) );
+        __m512i const B3 = k12_rol_avx512<21>( _mm512_xor_si512( A[ 18 ], D3 ) );
+        __m512i const B4 = k12_rol_avx512<14>( _mm512_xor_si512( A[ 24 ], D4 ) );
+        __m512i const B5 = k12_rol_avx512<28>( _mm512_xor_si512( A[ 3 ], D3 ) );
+        __m512i const B6 = k12_rol_avx512<20>( _mm512_xor_si512( A[ 9 ], D4 ) );
+        __m512i const B7 = k12_rol_avx512<3>( _mm512_xor_si512( A[ 10 ], D0 ) );
+        __m512i const B8 = k12_rol_avx512<45>( _mm512_xor_si512( A[ 16 ], D1 ) );
+        __m512i const B9 = k12_rol_avx512<61>( _mm512_xor_si512( A[ 22 ], D2 ) );
+        __m512i const B10 = k12_rol_avx512<1>( _mm512_xor_si512( A[ 1 ], D1 ) );
+        __m512i const B11 = k12_rol_avx512<6>( _mm512_xor_si512( A[ 7 ], D2 ) );
+        __m512i const B12 = k12_rol_avx512<25>( _mm512_xor_si512( A[ 13 ], D3 ) );
+        __m512i const B13 = k12_rol_avx512<8>( _mm512_xor_si512( A[ 19 ], D4 ) );
+        __m512i const B14 = k12_rol_avx512<18>( _mm512_xor_si512( A[ 20 ], D0 ) );
+        __m512i const B15 = k12_rol_avx512<27>( _mm512_xor_si512( A[ 4 ], D4 ) );
+        __m512i const B16 = k12_rol_avx512<36>( _mm512_xor_si512( A[ 5 ], D0 ) );
+        __m512i const B17 = k12_rol_avx512<10>( _mm512_xor_si512( A[ 11 ], D1 ) );
+        __m512i const B18 = k12_rol_avx512<15>( _mm512_xor_si512( A[ 17 ], D2 ) );
+        __m512i const B19 = k12_rol_avx512<56>( _mm512_xor_si512( A[ 23 ], D3 ) );
+        __m512i const B20 = k12_rol_avx512<62>( _mm512_xor_si512( A[ 2 ], D2 ) );
+        __m512i const B21 = k12_rol_avx512<55>( _mm512_xor_si512( A[ 8 ], D3 ) );
+        __m512i const B22 = k12_rol_avx512<39>( _mm512_xor_si512( A[ 14 ], D4 ) );
+        __m512i const B23 = k12_rol_avx512<41>( _mm512_xor_si512( A[ 15 ], D0 ) );
+        __m512i const B24 = k12_rol_avx512<2>( _mm512_xor_si512( A[ 21 ], D1 ) );
+
+        // chi; 0xD2 is a ^ ( ~b & c )
+
+        A[ 0 ] = _mm512_ternarylogic_epi64( B0, B1, B2, 0xD2 );
+        A[ 1 ] = _mm512_ternarylogic_epi64( B1, B2, B3, 0xD2 );
+        A[ 2 ] = _mm512_ternarylogic_epi64( B2, B3, B4, 0xD2 );
+        A[ 3 ] = _mm512_ternarylogic_epi64( B3, B4, B0, 0xD2 );
+        A[ 4 ] = _mm512_ternarylogic_epi64( B4, B0, B1, 0xD2 );
+
+        A[ 5 ] = _mm512_ternarylogic_epi64( B5, B6, B7, 0xD2 );
+        A[ 6 ] = _mm512_ternarylogic_epi64( B6, B7, B8, 0xD2 );
+        A[ 7 ] = _mm512_ternarylogic_epi64( B7, B8, B9, 0xD2 );
+        A[ 8 ] = _mm512_ternarylogic_epi64( B8, B9, B5, 0xD2 );
+        A[ 9 ] = _mm512_ternarylogic_epi64( B9, B5, B6, 0xD2 );
+
+        A[ 10 ] = _mm512_ternarylogic_epi64( B10, B11, B12, 0xD2 );
+        A[ 11 ] = _mm512_ternarylogic_epi64( B11, B12, B13, 0xD2 );
+        A[ 12 ] = _mm512_ternarylogic_epi64( B12, B13, B14, 0xD2 );
+        A[ 13 ] = _mm512_ternarylogic_epi64( B13, B14, B10, 0xD2 );
+        A[ 14 ] = _mm512_ternarylogic_epi64( B14, B10, B11, 0xD2 );
+
+        A[ 15 ] = _mm512_ternarylogic_epi64( B15, B16, B17, 0xD2 );
+        A[ 16 ] = _mm512_ternarylogic_epi64( B16, B17, B18, 0xD2 );
+        A[ 17 ] = _mm512_ternarylogic_epi64( B17, B18, B19, 0xD2 );
+        A[ 18 ] = _mm512_ternarylogic_epi64( B18, B19, B15, 0xD2 );
+        A[ 19 ] = _mm512_ternarylogic_epi64( B19, B15, B16, 0xD2 );
+
+        A[ 20 ] = _mm512_ternarylogic_epi64( B20, B21, B22, 0xD2 );
+        A[ 21 ] = _mm512_ternarylogic_epi64( B21, B22, B23, 0xD2 );
+        A[ 22 ] = _mm512_ternarylogic_epi64( B22, B23, B24, 0xD2 );
+        A[ 23 ] = _mm512_ternarylogic_epi64( B23, B24, B20, 0xD2 );
+        A[ 24 ] = _mm512_ternarylogic_epi64( B24, B20, B21, 0xD2 );
+
+        // iota
+
+        A[ 0 ] = _mm512_xor_si512( A[ 0 ], _mm512_set1_epi64( static_cast<long long>( keccak_constants<>::RC[ i ] ) ) );
+    }
+}
+
+// the words w to w+3 of eight leaves, transposed as in k12_load4_avx2
+
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void k12_load4_avx512( unsigned char const* p, std::size_t stride, __m512i r[ 4 ] ) noexcept
+{
+    __m512i x0 = _mm512_inserti64x4( _mm512_castsi256_si512( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 0 * stride ) ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 4 * stride ) ), 1 );
+    __m512i x1 = _mm512_inserti64x4( _mm512_castsi256_si512( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 1 * stride ) ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 5 * stride ) ), 1 );
+    __m512i x2 = _mm512_inserti64x4( _mm512_castsi256_si512( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 2 * stride ) ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 6 * stride ) ), 1 );
+    __m512i x3 = _mm512_inserti64x4( _mm512_castsi256_si512( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 3 * stride ) ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 7 * stride ) ), 1 );
+
+    // x0 = leaf 0 words 0..3, leaf 4 words 0..3, and so on
+
+    __m512i t0 = _mm512_unpacklo_epi64( x0, x1 ); // 0.0 1.0 0.2 1.2 4.0 5.0 4.2 5.2
+    __m512i t1 = _mm512_unpackhi_epi64( x0, x1 ); // 0.1 1.1 0.3 1.3 4.1 5.1 4.3 5.3
+    __m512i t2 = _mm512_unpacklo_epi64( x2, x3 ); // 2.0 3.0 2.2 3.2 6.0 7.0 6.2 7.2
+    __m512i t3 = _mm512_unpackhi_epi64( x2, x3 ); // 2.1 3.1 2.3 3.3 6.1 7.1 6.3 7.3
+
+    // r[0] takes the pairs of word 0 from t0 and t2, r[2] the pairs of word 2
+
+    __m512i const lo = _mm512_setr_epi64( 0, 1, 8, 9, 4, 5, 12, 13 );
+    __m512i const hi = _mm512_setr_epi64( 2, 3, 10, 11, 6, 7, 14, 15 );
+
+    r[ 0 ] = _mm512_permutex2var_epi64( t0, lo, t2 );
+    r[ 1 ] = _mm512_permutex2var_epi64( t1, lo, t3 );
+    r[ 2 ] = _mm512_permutex2var_epi64( t0, hi, t2 );
+    r[ 3 ] = _mm512_permutex2var_epi64( t1, hi, t3 );
+}
+
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE __m512i k12_load1_avx512( unsigned char const* p, std::size_t stride ) noexcept
+{
+    return _mm512_set_epi64(
+
+        static_cast<long long>( detail::read64le( p + 7 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 6 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 5 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 4 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 3 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 2 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 1 * stride ) ),
+        static_cast<long long>( detail::read64le( p + 0 * stride ) )
+    );
+}
+
+// as k12_leaves_avx2, for eight chunks
+
+BOOST_HASH2_TARGET("avx512f")
+inline void k12_leaves_avx512( unsigned char const* p, unsigned char* cv ) noexcept
+{
+    std::size_t const stride = 8192;
+
+    __m512i A[ 25 ];
+
+    for( int i = 0; i < 25; ++i )
+    {
+        A[ i ] = _mm512_setzero_si512();
+    }
+
+    for( int j = 0; j < 49; ++j, p += 168 )
+    {
+        int const n = j < 48? 21: 16;
+
+        for( int i = 0; i + 4 <= n; i += 4 )
+        {
+            __m512i r[ 4 ];
+            k12_load4_avx512( p + i * 8, stride, r );
+
+            A[ i + 0 ] = _mm512_xor_si512( A[ i + 0 ], r[ 0 ] );
+            A[ i + 1 ] = _mm512_xor_si512( A[ i + 1 ], r[ 1 ] );
+            A[ i + 2 ] = _mm512_xor_si512( A[ i + 2 ], r[ 2 ] );
+            A[ i + 3 ] = _mm512_xor_si512( A[ i + 3 ], r[ 3 ] );
+        }
+
+        if( n == 21 )
+        {
+            A[ 20 ] = _mm512_xor_si512( A[ 20 ], k12_load1_avx512( p + 160, stride ) );
+        }
+        else
+        {
+            A[ 16 ] = _mm512_xor_si512( A[ 16 ], _mm512_set1_epi64( 0x0B ) );
+            A[ 20 ] = _mm512_xor_si512( A[ 20 ], _mm512_set1_epi64( static_cast<long long>( 0x8000000000000000ull ) ) );
+        }
+
+        k12_permute_avx512( A );
+    }
+
+    for( int i = 0; i < 4; ++i )
+    {
+        std::uint64_t w[ 8 ];
+        _mm512_storeu_si512( w, A[ i ] );
+
+        for( int k = 0; k < 8; ++k )
+        {
+            detail::write64le( cv + k * 32 + i * 8, w[ k ] );
+        }
+    }
+}
+
+#if defined(BOOST_GCC) && BOOST_GCC >= 120000 && BOOST_GCC < 130000
+# pragma GCC diagnostic pop
+#endif
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_K12_X86_HPP_INCLUDED
@@ -0,0 +1,278 @@
+#ifndef BOOST_HASH2_DETAIL_KECCAK_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_KECCAK_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Keccak-f[1600], https://keccak.team/keccak_specs_summary.html
+
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void>
+struct keccak_constants
+{
+    constexpr static std::uint64_t const RC[ 24 ] =
+    {
+        0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000,
+        0x000000000000808b, 0x0000000080000001, 0x8000000080008081, 0x8000000000008009,
+        0x000000000000008a, 0x0000000000000088, 0x0000000080008009, 0x000000008000000a,
+        0x000000008000808b, 0x800000000000008b, 0x8000000000008089, 0x8000000000008003,
+        0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+        0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr std::uint64_t keccak_constants<T>::RC[ 24 ];
+
+#endif
+
+// One round, from A to E
+//
+// With Complemented == true, the lanes 1, 2, 8, 12, 17 and 20 are kept
+// complemented, which allows chi to be computed with only one NOT per
+// plane ("lane complementing", from the Keccak implementation overview).
+// Without a native and-not instruction this saves most of the NOTs; when
+// ANDN is available (BMI1), the direct form is used instead.
+
+template<bool Complemented>
+BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void keccak_round( std::uint64_t const A[ 25 ], std::uint64_t E[ 25 ], std::uint64_t rc )
+{
+    // theta
+
+    std::uint64_t C[ 5 ] = {};
+
+    for( int x = 0; x < 5; ++x )
+    {
+        C[ x ] = A[ x ] ^ A[ x + 5 ] ^ A[ x + 10 ] ^ A[ x + 15 ] ^ A[ x + 20 ];
+    }
+
+    std::uint64_t const Da = C[ 4 ] ^ detail::rotl( C[ 1 ], 1 );
+    std::uint64_t const De = C[ 0 ] ^ detail::rotl( C[ 2 ], 1 );
+    std::uint64_t const Di = C[ 1 ] ^ detail::rotl( C[ 3 ], 1 );
+    std::uint64_t const Do = C[ 2 ] ^ detail::rotl( C[ 4 ], 1 );
+    std::uint64_t const Du = C[ 3 ] ^ detail::rotl( C[ 0 ], 1 );
+
+    // rho, pi, chi, iota, one output plane at a time
+
+    {
+        std::uint64_t const Ba = A[ 0 ] ^ Da;
+        std::uint64_t const Be = detail::rotl( A[ 6 ] ^ De, 44 );
+        std::uint64_t const Bi = detail::rotl( A[ 12 ] ^ Di, 43 );
+        std::uint64_t const Bo = detail::rotl( A[ 18 ] ^ Do, 21 );
+        std::uint64_t const Bu = detail::rotl( A[ 24 ] ^ Du, 14 );
+
+        if( Complemented )
+        {
+            E[ 0 ] = Ba ^ (  Be | Bi ) ^ rc;
+            E[ 1 ] = Be ^ ( ~Bi | Bo );
+            E[ 2 ] = Bi ^ (  Bo & Bu );
+            E[ 3 ] = Bo ^ (  Bu | Ba );
+            E[ 4 ] = Bu ^ (  Ba & Be );
+        }
+        else
+        {
+            E[ 0 ] = Ba ^ ( ~Be & Bi ) ^ rc;
+            E[ 1 ] = Be ^ ( ~Bi & Bo );
+            E[ 2 ] = Bi ^ ( ~Bo & Bu );
+            E[ 3 ] = Bo ^ ( ~Bu & Ba );
+            E[ 4 ] = Bu ^ ( ~Ba & Be );
+        }
+    }
+
+    {
+        std::uint64_t const Ba = detail::rotl( A[ 3 ] ^ Do, 28 );
+        std::uint64_t const Be = detail::rotl( A[ 9 ] ^ Du, 20 );
+        std::uint64_t const Bi = detail::rotl( A[ 10 ] ^ Da, 3 );
+        std::uint64_t const Bo = detail::rotl( A[ 16 ] ^ De, 45 );
+        std::uint64_t const Bu = detail::rotl( A[ 22 ] ^ Di, 61 );
+
+        if( Complemented )
+        {
+            E[ 5 ] = Ba ^ ( Be |  Bi );
+            E[ 6 ] = Be ^ ( Bi &  Bo );
+            E[ 7 ] = Bi ^ ( Bo | ~Bu );
+            E[ 8 ] = Bo ^ ( Bu |  Ba );
+            E[ 9 ] = Bu ^ ( Ba &  Be );
+        }
+        else
+        {
+            E[ 5 ] = Ba ^ ( ~Be & Bi );
+            E[ 6 ] = Be ^ ( ~Bi & Bo );
+            E[ 7 ] = Bi ^ ( ~Bo & Bu );
+            E[ 8 ] = Bo ^ ( ~Bu & Ba );
+            E[ 9 ] = Bu ^ ( ~Ba & Be );
+        }
+    }
+
+    {
+        std::uint64_t const Ba = detail::rotl( A[ 1 ] ^ De, 1 );
+        std::uint64_t const Be = detail::rotl( A[ 7 ] ^ Di, 6 );
+        std::uint64_t const Bi = detail::rotl( A[ 13 ] ^ Do, 25 );
+        std::uint64_t const Bo = detail::rotl( A[ 19 ] ^ Du, 8 );
+        std::uint64_t const Bu = detail::rotl( A[ 20 ] ^ Da, 18 );
+
+        if( Complemented )
+        {
+            E[ 10 ] =  Ba ^ (  Be | Bi );
+            E[ 11 ] =  Be ^ (  Bi & Bo );
+            E[ 12 ] =  Bi ^ ( ~Bo & Bu );
+            E[ 13 ] = ~Bo ^ (  Bu | Ba );
+            E[ 14 ] =  Bu ^ (  Ba & Be );
+        }
+        else
+        {
+            E[ 10 ] = Ba ^ ( ~Be & Bi );
+            E[ 11 ] = Be ^ ( ~Bi & Bo );
+            E[ 12 ] = Bi ^ ( ~Bo & Bu );
+            E[ 13 ] = Bo ^ ( ~Bu & Ba );
+            E[ 14 ] = Bu ^ ( ~Ba & Be );
+        }
+    }
+
+    {
+        std::uint64_t const Ba = detail::rotl( A[ 4 ] ^ Du, 27 );
+        std::uint64_t const Be = detail::rotl( A[ 5 ] ^ Da, 36 );
+        std::uint64_t const Bi = detail::rotl( A[ 11 ] ^ De, 10 );
+        std::uint64_t const Bo = detail::rotl( A[ 17 ] ^ Di, 15 );
+        std::uint64_t const Bu = detail::rotl( A[ 23 ] ^ Do, 56 );
+
+        if( Complemented )
+        {
+            E[ 15 ] =  Ba ^ (  Be & Bi );
+            E[ 16 ] =  Be ^ (  Bi | Bo );
+            E[ 17 ] =  Bi ^ ( ~Bo | Bu );
+            E[ 18 ] = ~Bo ^ (  Bu & Ba );
+            E[ 19 ] =  Bu ^ (  Ba | Be );
+        }
+        else
+        {
+            E[ 15 ] = Ba ^ ( ~Be & Bi );
+            E[ 16 ] = Be ^ ( ~Bi & Bo );
+            E[ 17 ] = Bi ^ ( ~Bo & Bu );
+            E[ 18 ] = Bo ^ ( ~Bu & Ba );
+            E[ 19 ] = Bu ^ ( ~Ba & Be );
+        }
+    }
+
+    {
+        std::uint64_t const Ba = detail::rotl( A[ 2 ] ^ Di, 62 );
+        std::uint64_t const Be = detail::rotl( A[ 8 ] ^ Do, 55 );
+        std::uint64_t const Bi = detail::rotl( A[ 14 ] ^ Du, 39 );
+        std::uint64_t const Bo = detail::rotl( A[ 15 ] ^ Da, 41 );
+        std::uint64_t const Bu = detail::rotl( A[ 21 ] ^ De, 2 );
+
+        if( Complemented )
+        {
+            E[ 20 ] =  Ba ^ ( ~Be & Bi );
+            E[ 21 ] = ~Be ^ (  Bi | Bo );
+            E[ 22 ] =  Bi ^ (  Bo & Bu );
+            E[ 23 ] =  Bo ^ (  Bu | Ba );
+            E[ 24 ] =  Bu ^ (  Ba & Be );
+        }
+        else
+        {
+            E[ 20 ] = Ba ^ ( ~Be & Bi );
+            E[ 21 ] = Be ^ ( ~Bi & Bo );
+            E[ 22 ] = Bi ^ ( ~Bo & Bu );
+            E[ 23 ] = Bo ^ ( ~Bu & Ba );
+            E[ 24 ] = Bu ^ ( ~Ba & Be );
+        }
+    }
+}
+
+// the rounds First to 23; First == 12 gives Keccak-p[1600, 12], the
+// permutation of TurboSHAKE and KangarooTwelve
+
+template<bool Complemented, int First = 0>
+BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void keccak_permute_impl( std::uint64_t A[ 25 ] )
+{
+    if( Complemented )
+    {
+        A[ 1 ] = ~A[ 1 ]; A[ 2 ] = ~A[ 2 ]; A[ 8 ] = ~A[ 8 ]; A[ 12 ] = ~A[ 12 ]; A[ 17 ] = ~A[ 17 ]; A[ 20 ] = ~A[ 20 ];
+    }
+
+    std::uint64_t E[ 25 ] = {};
+
+    for( int i = First; i < 24; i += 2 )
+    {
+        keccak_round<Complemented>( A, E, keccak_constants<>::RC[ i + 0 ] );
+        keccak_round<Complemented>( E, A, keccak_constants<>::RC[ i + 1 ] );
+    }
+
+    if( Complemented )
+    {
+        A[ 1 ] = ~A[ 1 ]; A[ 2 ] = ~A[ 2 ]; A[ 8 ] = ~A[ 8 ]; A[ 12 ] = ~A[ 12 ]; A[ 17 ] = ~A[ 17 ]; A[ 20 ] = ~A[ 20 ];
+    }
+}
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+// ANDN computes chi directly, and RORX doesn't overwrite its source
+
+BOOST_HASH2_TARGET("bmi,bmi2")
+inline void keccak_permute_bmi2( std::uint64_t A[ 25 ] ) noexcept
+{
+    keccak_permute_impl<false>( A );
+}
+
+BOOST_HASH2_TARGET("bmi,bmi2")
+inline void keccak_permute12_bmi2( std::uint64_t A[ 25 ] ) noexcept
+{
+    keccak_permute_impl<false, 12>( A );
+}
+
+#endif
+
+inline BOOST_CXX14_CONSTEXPR void keccak_permute( std::uint64_t A[ 25 ] )
+{
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() && detail::has_x86_bmi2() )
+    {
+        keccak_permute_bmi2( A );
+        return;
+    }
+
+#endif
+
+    keccak_permute_impl<true>( A );
+}
+
+// Keccak-p[1600, 12], the last 12 rounds of Keccak-f[1600]
+
+inline BOOST_CXX14_CONSTEXPR void keccak_permute12( std::uint64_t A[ 25 ] )
+{
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( !detail::is_constant_evaluated() && detail::has_x86_bmi2() )
+    {
+        keccak_permute12_bmi2( A );
+        return;
+    }
+
+#endif
+
+    keccak_permute_impl<true, 12>( A );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_KECCAK_HPP_INCLUDED
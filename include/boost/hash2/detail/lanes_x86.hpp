@@ -0,0 +1,97 @@
+#ifndef BOOST_HASH2_DETAIL_LANES_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_LANES_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Loading the message blocks of independent messages into SIMD lanes,
+// for the little endian multi-buffer kernels (MD5, RIPEMD-160)
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// loads the 64 byte blocks of eight messages and transposes them, so
+// that x[ i ] holds little endian word i of the eight blocks
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void lanes_load_avx2( unsigned char const* const block[ 8 ], __m256i x[ 16 ] ) noexcept
+{
+    for( int k = 0; k < 2; ++k )
+    {
+        __m256i r[ 8 ];
+
+        for( int j = 0; j < 8; ++j )
+        {
+            r[ j ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block[ j ] + k * 32 ) );
+        }
+
+        __m256i t0 = _mm256_unpacklo_epi32( r[ 0 ], r[ 1 ] );
+        __m256i t1 = _mm256_unpackhi_epi32( r[ 0 ], r[ 1 ] );
+        __m256i t2 = _mm256_unpacklo_epi32( r[ 2 ], r[ 3 ] );
+        __m256i t3 = _mm256_unpackhi_epi32( r[ 2 ], r[ 3 ] );
+        __m256i t4 = _mm256_unpacklo_epi32( r[ 4 ], r[ 5 ] );
+        __m256i t5 = _mm256_unpackhi_epi32( r[ 4 ], r[ 5 ] );
+        __m256i t6 = _mm256_unpacklo_epi32( r[ 6 ], r[ 7 ] );
+        __m256i t7 = _mm256_unpackhi_epi32( r[ 6 ], r[ 7 ] );
+
+        __m256i u0 = _mm256_unpacklo_epi64( t0, t2 );
+        __m256i u1 = _mm256_unpackhi_epi64( t0, t2 );
+        __m256i u2 = _mm256_unpacklo_epi64( t1, t3 );
+        __m256i u3 = _mm256_unpackhi_epi64( t1, t3 );
+        __m256i u4 = _mm256_unpacklo_epi64( t4, t6 );
+        __m256i u5 = _mm256_unpackhi_epi64( t4, t6 );
+        __m256i u6 = _mm256_unpacklo_epi64( t5, t7 );
+        __m256i u7 = _mm256_unpackhi_epi64( t5, t7 );
+
+        __m256i* w = x + k * 8;
+
+        w[ 0 ] = _mm256_permute2x128_si256( u0, u4, 0x20 );
+        w[ 1 ] = _mm256_permute2x128_si256( u1, u5, 0x20 );
+        w[ 2 ] = _mm256_permute2x128_si256( u2, u6, 0x20 );
+        w[ 3 ] = _mm256_permute2x128_si256( u3, u7, 0x20 );
+        w[ 4 ] = _mm256_permute2x128_si256( u0, u4, 0x31 );
+        w[ 5 ] = _mm256_permute2x128_si256( u1, u5, 0x31 );
+        w[ 6 ] = _mm256_permute2x128_si256( u2, u6, 0x31 );
+        w[ 7 ] = _mm256_permute2x128_si256( u3, u7, 0x31 );
+    }
+}
+
+// the same for sixteen messages; lanes 0-7 come from the first eight
+// blocks, 8-15 from the rest
+
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void lanes_load_avx512( unsigned char const* const block[ 16 ], __m512i x[ 16 ] ) noexcept
+{
+    __m256i lo[ 16 ], hi[ 16 ];
+
+    lanes_load_avx2( block + 0, lo );
+    lanes_load_avx2( block + 8, hi );
+
+    for( int i = 0; i < 16; ++i )
+    {
+        // the masked form doesn't read an undefined source, which GCC 12
+        // warns about under -Wuninitialized
+
+        x[ i ] = _mm512_mask_broadcast_i64x4( _mm512_castsi256_si512( lo[ i ] ), 0xF0, hi[ i ] );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_LANES_X86_HPP_INCLUDED
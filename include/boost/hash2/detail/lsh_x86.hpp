@@ -0,0 +1,132 @@
+#ifndef BOOST_HASH2_DETAIL_LSH_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_LSH_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// the dot products of locality-sensitive hashing, using AVX2 and AVX-512
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// GCC contracts a multiplication followed by an addition into a fused
+// multiply-add when the target has one (AVX-512 implies FMA), which
+// rounds differently from the portable code; an empty asm statement on
+// the product keeps the two operations separate
+
+#if defined(__GNUC__) || defined(__clang__)
+# define BOOST_HASH2_LSH_NO_CONTRACT(x) __asm__( "" : "+x"( x ) )
+#else
+# define BOOST_HASH2_LSH_NO_CONTRACT(x) ((void)0)
+#endif
+
+// the sum of the eight lanes, in the order of lsh_dot in lsh.hpp
+
+BOOST_HASH2_TARGET("avx2")
+inline float lsh_sum8_avx2( __m256 x ) noexcept
+{
+    __m128 s = _mm_add_ps( _mm256_castps256_ps128( x ), _mm256_extractf128_ps( x, 1 ) );
+
+    s = _mm_add_ps( s, _mm_movehl_ps( s, s ) );
+    s = _mm_add_ss( s, _mm_shuffle_ps( s, s, 1 ) );
+
+    return _mm_cvtss_f32( s );
+}
+
+// out[r] = the dot product of w + r * n and v, for r in [0, m); the products
+// of the elements 16k + j go into the partial sum j, as in lsh_dot
+
+BOOST_HASH2_TARGET("avx2")
+inline void lsh_project_avx2( float const* w, std::size_t m, float const* v, std::size_t n, float* out ) noexcept
+{
+    std::size_t const n16 = n / 16 * 16;
+
+    for( std::size_t r = 0; r < m; ++r, w += n )
+    {
+        __m256 a0 = _mm256_setzero_ps();
+        __m256 a1 = _mm256_setzero_ps();
+
+        for( std::size_t i = 0; i < n16; i += 16 )
+        {
+            __m256 p0 = _mm256_mul_ps( _mm256_loadu_ps( w + i ), _mm256_loadu_ps( v + i ) );
+            __m256 p1 = _mm256_mul_ps( _mm256_loadu_ps( w + i + 8 ), _mm256_loadu_ps( v + i + 8 ) );
+
+            BOOST_HASH2_LSH_NO_CONTRACT( p0 );
+            BOOST_HASH2_LSH_NO_CONTRACT( p1 );
+
+            a0 = _mm256_add_ps( a0, p0 );
+            a1 = _mm256_add_ps( a1, p1 );
+        }
+
+        float s = detail::lsh_sum8_avx2( _mm256_add_ps( a0, a1 ) );
+
+        for( std::size_t i = n16; i < n; ++i )
+        {
+            float p = w[ i ] * v[ i ];
+            BOOST_HASH2_LSH_NO_CONTRACT( p );
+
+            s += p;
+        }
+
+        out[ r ] = s;
+    }
+}
+
+BOOST_HASH2_TARGET("avx512f")
+inline void lsh_project_avx512( float const* w, std::size_t m, float const* v, std::size_t n, float* out ) noexcept
+{
+    std::size_t const n16 = n / 16 * 16;
+
+    for( std::size_t r = 0; r < m; ++r, w += n )
+    {
+        __m512 a = _mm512_setzero_ps();
+
+        for( std::size_t i = 0; i < n16; i += 16 )
+        {
+            __m512 p = _mm512_mul_ps( _mm512_loadu_ps( w + i ), _mm512_loadu_ps( v + i ) );
+            BOOST_HASH2_LSH_NO_CONTRACT( p );
+
+            a = _mm512_add_ps( a, p );
+        }
+
+        // through memory; the casts to __m256 trigger false -Wmaybe-uninitialized
+        // warnings in some versions of GCC
+
+        float t[ 16 ];
+        _mm512_storeu_ps( t, a );
+
+        float s = detail::lsh_sum8_avx2( _mm256_add_ps( _mm256_loadu_ps( t ), _mm256_loadu_ps( t + 8 ) ) );
+
+        for( std::size_t i = n16; i < n; ++i )
+        {
+            float p = w[ i ] * v[ i ];
+            BOOST_HASH2_LSH_NO_CONTRACT( p );
+
+            s += p;
+        }
+
+        out[ r ] = s;
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#undef BOOST_HASH2_LSH_NO_CONTRACT
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_LSH_X86_HPP_INCLUDED
@@ -0,0 +1,61 @@
+#ifndef BOOST_HASH2_DETAIL_LTHASH_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_LTHASH_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// LtHash lane addition and subtraction using NEON
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// s[i] += q[i] (or s[i] -= q[i]) modulo 2^16, where q[i] is the 16 bit
+// word at p + 2 * i, in native byte order, for the n / 8 * 8 leading
+// lanes; returns the number of lanes processed
+
+inline std::size_t lthash_add_neon( std::uint16_t* s, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 8 <= n; i += 8 )
+    {
+        uint16x8_t b = vreinterpretq_u16_u8( vld1q_u8( p + 2 * i ) );
+        vst1q_u16( s + i, vaddq_u16( vld1q_u16( s + i ), b ) );
+    }
+
+    return i;
+}
+
+inline std::size_t lthash_sub_neon( std::uint16_t* s, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 8 <= n; i += 8 )
+    {
+        uint16x8_t b = vreinterpretq_u16_u8( vld1q_u8( p + 2 * i ) );
+        vst1q_u16( s + i, vsubq_u16( vld1q_u16( s + i ), b ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_LTHASH_ARM_HPP_INCLUDED
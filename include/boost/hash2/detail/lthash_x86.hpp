@@ -0,0 +1,67 @@
+#ifndef BOOST_HASH2_DETAIL_LTHASH_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_LTHASH_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// LtHash lane addition and subtraction using AVX2
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// s[i] += q[i] (or s[i] -= q[i]) modulo 2^16, where q[i] is the little
+// endian 16 bit word at p + 2 * i, for the n / 16 * 16 leading lanes;
+// returns the number of lanes processed
+
+BOOST_HASH2_TARGET("avx2")
+inline std::size_t lthash_add_avx2( std::uint16_t* s, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m256i a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( s + i ) );
+        __m256i b = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 2 * i ) );
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( s + i ), _mm256_add_epi16( a, b ) );
+    }
+
+    return i;
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline std::size_t lthash_sub_avx2( std::uint16_t* s, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 16 <= n; i += 16 )
+    {
+        __m256i a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( s + i ) );
+        __m256i b = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 2 * i ) );
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( s + i ), _mm256_sub_epi16( a, b ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_LTHASH_X86_HPP_INCLUDED
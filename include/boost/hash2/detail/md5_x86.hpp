@@ -0,0 +1,440 @@
+#ifndef BOOST_HASH2_DETAIL_MD5_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_MD5_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// MD5, eight independent messages in the 32 bit lanes of an AVX2
+// register, or sixteen in those of an AVX-512 register, and a single
+// message using the AVX-512VL bitwise operations
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/lanes_x86.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i md5_avx2_rotl( __m256i x ) noexcept
+{
+    return _mm256_or_si256( _mm256_slli_epi32( x, S ), _mm256_srli_epi32( x, 32 - S ) );
+}
+
+// a = b + rotl( a + f( b, c, d ) + x + k, S )
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void md5_avx2_step( __m256i& a, __m256i b, __m256i f, __m256i x, std::uint32_t k ) noexcept
+{
+    a = _mm256_add_epi32( _mm256_add_epi32( a, f ), _mm256_add_epi32( x, _mm256_set1_epi32( static_cast<int>( k ) ) ) );
+    a = _mm256_add_epi32( b, md5_avx2_rotl<S>( a ) );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void md5_avx2_ff( __m256i& a, __m256i b, __m256i c, __m256i d, __m256i x, std::uint32_t k ) noexcept
+{
+    // ( b & c ) | ( ~b & d )
+    md5_avx2_step<S>( a, b, _mm256_xor_si256( d, _mm256_and_si256( b, _mm256_xor_si256( c, d ) ) ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void md5_avx2_gg( __m256i& a, __m256i b, __m256i c, __m256i d, __m256i x, std::uint32_t k ) noexcept
+{
+    // ( b & d ) | ( c & ~d )
+    md5_avx2_step<S>( a, b, _mm256_xor_si256( c, _mm256_and_si256( d, _mm256_xor_si256( b, c ) ) ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void md5_avx2_hh( __m256i& a, __m256i b, __m256i c, __m256i d, __m256i x, std::uint32_t k ) noexcept
+{
+    md5_avx2_step<S>( a, b, _mm256_xor_si256( _mm256_xor_si256( b, c ), d ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void md5_avx2_ii( __m256i& a, __m256i b, __m256i c, __m256i d, __m256i x, std::uint32_t k ) noexcept
+{
+    // c ^ ( b | ~d )
+    md5_avx2_step<S>( a, b, _mm256_xor_si256( c, _mm256_or_si256( b, _mm256_xor_si256( d, _mm256_set1_epi32( -1 ) ) ) ), x, k );
+}
+
+// st[ i * stride + j ] is word i of the state of message j
+
+BOOST_HASH2_TARGET("avx2")
+inline void md5_transform_avx2( unsigned char const* const block[ 8 ], std::uint32_t* st, std::size_t stride ) noexcept
+{
+    __m256i x[ 16 ];
+    lanes_load_avx2( block, x );
+
+    __m256i const a0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + 0 * stride ) );
+    __m256i const b0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + 1 * stride ) );
+    __m256i const c0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + 2 * stride ) );
+    __m256i const d0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + 3 * stride ) );
+
+    __m256i a = a0, b = b0, c = c0, d = d0;
+
+    md5_avx2_ff<7>( a, b, c, d, x[ 0 ], 0xd76aa478 );
+    md5_avx2_ff<12>( d, a, b, c, x[ 1 ], 0xe8c7b756 );
+    md5_avx2_ff<17>( c, d, a, b, x[ 2 ], 0x242070db );
+    md5_avx2_ff<22>( b, c, d, a, x[ 3 ], 0xc1bdceee );
+    md5_avx2_ff<7>( a, b, c, d, x[ 4 ], 0xf57c0faf );
+    md5_avx2_ff<12>( d, a, b, c, x[ 5 ], 0x4787c62a );
+    md5_avx2_ff<17>( c, d, a, b, x[ 6 ], 0xa8304613 );
+    md5_avx2_ff<22>( b, c, d, a, x[ 7 ], 0xfd469501 );
+    md5_avx2_ff<7>( a, b, c, d, x[ 8 ], 0x698098d8 );
+    md5_avx2_ff<12>( d, a, b, c, x[ 9 ], 0x8b44f7af );
+    md5_avx2_ff<17>( c, d, a, b, x[ 10 ], 0xffff5bb1 );
+    md5_avx2_ff<22>( b, c, d, a, x[ 11 ], 0x895cd7be );
+    md5_avx2_ff<7>( a, b, c, d, x[ 12 ], 0x6b901122 );
+    md5_avx2_ff<12>( d, a, b, c, x[ 13 ], 0xfd987193 );
+    md5_avx2_ff<17>( c, d, a, b, x[ 14 ], 0xa679438e );
+    md5_avx2_ff<22>( b, c, d, a, x[ 15 ], 0x49b40821 );
+
+    md5_avx2_gg<5>( a, b, c, d, x[ 1 ], 0xf61e2562 );
+    md5_avx2_gg<9>( d, a, b, c, x[ 6 ], 0xc040b340 );
+    md5_avx2_gg<14>( c, d, a, b, x[ 11 ], 0x265e5a51 );
+    md5_avx2_gg<20>( b, c, d, a, x[ 0 ], 0xe9b6c7aa );
+    md5_avx2_gg<5>( a, b, c, d, x[ 5 ], 0xd62f105d );
+    md5_avx2_gg<9>( d, a, b, c, x[ 10 ], 0x02441453 );
+    md5_avx2_gg<14>( c, d, a, b, x[ 15 ], 0xd8a1e681 );
+    md5_avx2_gg<20>( b, c, d, a, x[ 4 ], 0xe7d3fbc8 );
+    md5_avx2_gg<5>( a, b, c, d, x[ 9 ], 0x21e1cde6 );
+    md5_avx2_gg<9>( d, a, b, c, x[ 14 ], 0xc33707d6 );
+    md5_avx2_gg<14>( c, d, a, b, x[ 3 ], 0xf4d50d87 );
+    md5_avx2_gg<20>( b, c, d, a, x[ 8 ], 0x455a14ed );
+    md5_avx2_gg<5>( a, b, c, d, x[ 13 ], 0xa9e3e905 );
+    md5_avx2_gg<9>( d, a, b, c, x[ 2 ], 0xfcefa3f8 );
+    md5_avx2_gg<14>( c, d, a, b, x[ 7 ], 0x676f02d9 );
+    md5_avx2_gg<20>( b, c, d, a, x[ 12 ], 0x8d2a4c8a );
+
+    md5_avx2_hh<4>( a, b, c, d, x[ 5 ], 0xfffa3942 );
+    md5_avx2_hh<11>( d, a, b, c, x[ 8 ], 0x8771f681 );
+    md5_avx2_hh<16>( c, d, a, b, x[ 11 ], 0x6d9d6122 );
+    md5_avx2_hh<23>( b, c, d, a, x[ 14 ], 0xfde5380c );
+    md5_avx2_hh<4>( a, b, c, d, x[ 1 ], 0xa4beea44 );
+    md5_avx2_hh<11>( d, a, b, c, x[ 4 ], 0x4bdecfa9 );
+    md5_avx2_hh<16>( c, d, a, b, x[ 7 ], 0xf6bb4b60 );
+    md5_avx2_hh<23>( b, c, d, a, x[ 10 ], 0xbebfbc70 );
+    md5_avx2_hh<4>( a, b, c, d, x[ 13 ], 0x289b7ec6 );
+    md5_avx2_hh<11>( d, a, b, c, x[ 0 ], 0xeaa127fa );
+    md5_avx2_hh<16>( c, d, a, b, x[ 3 ], 0xd4ef3085 );
+    md5_avx2_hh<23>( b, c, d, a, x[ 6 ], 0x04881d05 );
+    md5_avx2_hh<4>( a, b, c, d, x[ 9 ], 0xd9d4d039 );
+    md5_avx2_hh<11>( d, a, b, c, x[ 12 ], 0xe6db99e5 );
+    md5_avx2_hh<16>( c, d, a, b, x[ 15 ], 0x1fa27cf8 );
+    md5_avx2_hh<23>( b, c, d, a, x[ 2 ], 0xc4ac5665 );
+
+    md5_avx2_ii<6>( a, b, c, d, x[ 0 ], 0xf4292244 );
+    md5_avx2_ii<10>( d, a, b, c, x[ 7 ], 0x432aff97 );
+    md5_avx2_ii<15>( c, d, a, b, x[ 14 ], 0xab9423a7 );
+    md5_avx2_ii<21>( b, c, d, a, x[ 5 ], 0xfc93a039 );
+    md5_avx2_ii<6>( a, b, c, d, x[ 12 ], 0x655b59c3 );
+    md5_avx2_ii<10>( d, a, b, c, x[ 3 ], 0x8f0ccc92 );
+    md5_avx2_ii<15>( c, d, a, b, x[ 10 ], 0xffeff47d );
+    md5_avx2_ii<21>( b, c, d, a, x[ 1 ], 0x85845dd1 );
+    md5_avx2_ii<6>( a, b, c, d, x[ 8 ], 0x6fa87e4f );
+    md5_avx2_ii<10>( d, a, b, c, x[ 15 ], 0xfe2ce6e0 );
+    md5_avx2_ii<15>( c, d, a, b, x[ 6 ], 0xa3014314 );
+    md5_avx2_ii<21>( b, c, d, a, x[ 13 ], 0x4e0811a1 );
+    md5_avx2_ii<6>( a, b, c, d, x[ 4 ], 0xf7537e82 );
+    md5_avx2_ii<10>( d, a, b, c, x[ 11 ], 0xbd3af235 );
+    md5_avx2_ii<15>( c, d, a, b, x[ 2 ], 0x2ad7d2bb );
+    md5_avx2_ii<21>( b, c, d, a, x[ 9 ], 0xeb86d391 );
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 0 * stride ), _mm256_add_epi32( a0, a ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 1 * stride ), _mm256_add_epi32( b0, b ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 2 * stride ), _mm256_add_epi32( c0, c ) );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 3 * stride ), _mm256_add_epi32( d0, d ) );
+}
+
+// AVX-512; the round functions are single vpternlogd instructions,
+// and the rotations single vprold instructions
+
+template<int S, int F>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void md5_avx512_step( __m512i& a, __m512i b, __m512i c, __m512i d, __m512i x, std::uint32_t k ) noexcept
+{
+    __m512i f = _mm512_ternarylogic_epi32( b, c, d, F );
+
+    a = _mm512_add_epi32( _mm512_add_epi32( a, f ), _mm512_add_epi32( x, _mm512_set1_epi32( static_cast<int>( k ) ) ) );
+    // the masked forms don't read an undefined source, which GCC 12
+    // warns about under -Wuninitialized
+
+    a = _mm512_add_epi32( b, _mm512_mask_rol_epi32( a, 0xFFFF, a, S ) );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void md5_avx512_ff( __m512i& a, __m512i b, __m512i c, __m512i d, __m512i x, std::uint32_t k ) noexcept
+{
+    md5_avx512_step<S, 0xCA>( a, b, c, d, x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void md5_avx512_gg( __m512i& a, __m512i b, __m512i c, __m512i d, __m512i x, std::uint32_t k ) noexcept
+{
+    md5_avx512_step<S, 0xE4>( a, b, c, d, x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void md5_avx512_hh( __m512i& a, __m512i b, __m512i c, __m512i d, __m512i x, std::uint32_t k ) noexcept
+{
+    md5_avx512_step<S, 0x96>( a, b, c, d, x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void md5_avx512_ii( __m512i& a, __m512i b, __m512i c, __m512i d, __m512i x, std::uint32_t k ) noexcept
+{
+    md5_avx512_step<S, 0x39>( a, b, c, d, x, k );
+}
+
+// sixteen messages
+
+BOOST_HASH2_TARGET("avx512f")
+inline void md5_transform_avx512( unsigned char const* const block[ 16 ], std::uint32_t* st, std::size_t stride ) noexcept
+{
+    __m512i x[ 16 ];
+    lanes_load_avx512( block, x );
+
+    __m512i const a0 = _mm512_loadu_si512( st + 0 * stride );
+    __m512i const b0 = _mm512_loadu_si512( st + 1 * stride );
+    __m512i const c0 = _mm512_loadu_si512( st + 2 * stride );
+    __m512i const d0 = _mm512_loadu_si512( st + 3 * stride );
+
+    __m512i a = a0, b = b0, c = c0, d = d0;
+
+    md5_avx512_ff<7>( a, b, c, d, x[ 0 ], 0xd76aa478 );
+    md5_avx512_ff<12>( d, a, b, c, x[ 1 ], 0xe8c7b756 );
+    md5_avx512_ff<17>( c, d, a, b, x[ 2 ], 0x242070db );
+    md5_avx512_ff<22>( b, c, d, a, x[ 3 ], 0xc1bdceee );
+    md5_avx512_ff<7>( a, b, c, d, x[ 4 ], 0xf57c0faf );
+    md5_avx512_ff<12>( d, a, b, c, x[ 5 ], 0x4787c62a );
+    md5_avx512_ff<17>( c, d, a, b, x[ 6 ], 0xa8304613 );
+    md5_avx512_ff<22>( b, c, d, a, x[ 7 ], 0xfd469501 );
+    md5_avx512_ff<7>( a, b, c, d, x[ 8 ], 0x698098d8 );
+    md5_avx512_ff<12>( d, a, b, c, x[ 9 ], 0x8b44f7af );
+    md5_avx512_ff<17>( c, d, a, b, x[ 10 ], 0xffff5bb1 );
+    md5_avx512_ff<22>( b, c, d, a, x[ 11 ], 0x895cd7be );
+    md5_avx512_ff<7>( a, b, c, d, x[ 12 ], 0x6b901122 );
+    md5_avx512_ff<12>( d, a, b, c, x[ 13 ], 0xfd987193 );
+    md5_avx512_ff<17>( c, d, a, b, x[ 14 ], 0xa679438e );
+    md5_avx512_ff<22>( b, c, d, a, x[ 15 ], 0x49b40821 );
+
+    md5_avx512_gg<5>( a, b, c, d, x[ 1 ], 0xf61e2562 );
+    md5_avx512_gg<9>( d, a, b, c, x[ 6 ], 0xc040b340 );
+    md5_avx512_gg<14>( c, d, a, b, x[ 11 ], 0x265e5a51 );
+    md5_avx512_gg<20>( b, c, d, a, x[ 0 ], 0xe9b6c7aa );
+    md5_avx512_gg<5>( a, b, c, d, x[ 5 ], 0xd62f105d );
+    md5_avx512_gg<9>( d, a, b, c, x[ 10 ], 0x02441453 );
+    md5_avx512_gg<14>( c, d, a, b, x[ 15 ], 0xd8a1e681 );
+    md5_avx512_gg<20>( b, c, d, a, x[ 4 ], 0xe7d3fbc8 );
+    md5_avx512_gg<5>( a, b, c, d, x[ 9 ], 0x21e1cde6 );
+    md5_avx512_gg<9>( d, a, b, c, x[ 14 ], 0xc33707d6 );
+    md5_avx512_gg<14>( c, d, a, b, x[ 3 ], 0xf4d50d87 );
+    md5_avx512_gg<20>( b, c, d, a, x[ 8 ], 0x455a14ed );
+    md5_avx512_gg<5>( a, b, c, d, x[ 13 ], 0xa9e3e905 );
+    md5_avx512_gg<9>( d, a, b, c, x[ 2 ], 0xfcefa3f8 );
+    md5_avx512_gg<14>( c, d, a, b, x[ 7 ], 0x676f02d9 );
+    md5_avx512_gg<20>( b, c, d, a, x[ 12 ], 0x8d2a4c8a );
+
+    md5_avx512_hh<4>( a, b, c, d, x[ 5 ], 0xfffa3942 );
+    md5_avx512_hh<11>( d, a, b, c, x[ 8 ], 0x8771f681 );
+    md5_avx512_hh<16>( c, d, a, b, x[ 11 ], 0x6d9d6122 );
+    md5_avx512_hh<23>( b, c, d, a, x[ 14 ], 0xfde5380c );
+    md5_avx512_hh<4>( a, b, c, d, x[ 1 ], 0xa4beea44 );
+    md5_avx512_hh<11>( d, a, b, c, x[ 4 ], 0x4bdecfa9 );
+    md5_avx512_hh<16>( c, d, a, b, x[ 7 ], 0xf6bb4b60 );
+    md5_avx512_hh<23>( b, c, d, a, x[ 10 ], 0xbebfbc70 );
+    md5_avx512_hh<4>( a, b, c, d, x[ 13 ], 0x289b7ec6 );
+    md5_avx512_hh<11>( d, a, b, c, x[ 0 ], 0xeaa127fa );
+    md5_avx512_hh<16>( c, d, a, b, x[ 3 ], 0xd4ef3085 );
+    md5_avx512_hh<23>( b, c, d, a, x[ 6 ], 0x04881d05 );
+    md5_avx512_hh<4>( a, b, c, d, x[ 9 ], 0xd9d4d039 );
+    md5_avx512_hh<11>( d, a, b, c, x[ 12 ], 0xe6db99e5 );
+    md5_avx512_hh<16>( c, d, a, b, x[ 15 ], 0x1fa27cf8 );
+    md5_avx512_hh<23>( b, c, d, a, x[ 2 ], 0xc4ac5665 );
+
+    md5_avx512_ii<6>( a, b, c, d, x[ 0 ], 0xf4292244 );
+    md5_avx512_ii<10>( d, a, b, c, x[ 7 ], 0x432aff97 );
+    md5_avx512_ii<15>( c, d, a, b, x[ 14 ], 0xab9423a7 );
+    md5_avx512_ii<21>( b, c, d, a, x[ 5 ], 0xfc93a039 );
+    md5_avx512_ii<6>( a, b, c, d, x[ 12 ], 0x655b59c3 );
+    md5_avx512_ii<10>( d, a, b, c, x[ 3 ], 0x8f0ccc92 );
+    md5_avx512_ii<15>( c, d, a, b, x[ 10 ], 0xffeff47d );
+    md5_avx512_ii<21>( b, c, d, a, x[ 1 ], 0x85845dd1 );
+    md5_avx512_ii<6>( a, b, c, d, x[ 8 ], 0x6fa87e4f );
+    md5_avx512_ii<10>( d, a, b, c, x[ 15 ], 0xfe2ce6e0 );
+    md5_avx512_ii<15>( c, d, a, b, x[ 6 ], 0xa3014314 );
+    md5_avx512_ii<21>( b, c, d, a, x[ 13 ], 0x4e0811a1 );
+    md5_avx512_ii<6>( a, b, c, d, x[ 4 ], 0xf7537e82 );
+    md5_avx512_ii<10>( d, a, b, c, x[ 11 ], 0xbd3af235 );
+    md5_avx512_ii<15>( c, d, a, b, x[ 2 ], 0x2ad7d2bb );
+    md5_avx512_ii<21>( b, c, d, a, x[ 9 ], 0xeb86d391 );
+
+    _mm512_storeu_si512( st + 0 * stride, _mm512_add_epi32( a0, a ) );
+    _mm512_storeu_si512( st + 1 * stride, _mm512_add_epi32( b0, b ) );
+    _mm512_storeu_si512( st + 2 * stride, _mm512_add_epi32( c0, c ) );
+    _mm512_storeu_si512( st + 3 * stride, _mm512_add_epi32( d0, d ) );
+}
+
+// a single message, with the state words in the low lanes of SSE
+// registers; with AVX-512VL, each of F, G, H and I is one vpternlogd
+// and the rotation one vprold, which shortens the dependency chain
+// through a round by one to three instructions compared to the
+// scalar code
+
+template<int S, int F>
+BOOST_HASH2_TARGET("avx512f,avx512vl")
+BOOST_FORCEINLINE void md5_avx512vl_step( __m128i& a, __m128i b, __m128i c, __m128i d, std::uint32_t x, std::uint32_t k ) noexcept
+{
+    // x + k and its addition to a don't depend on the previous round
+
+    a = _mm_add_epi32( a, _mm_cvtsi32_si128( static_cast<int>( x + k ) ) );
+    a = _mm_add_epi32( a, _mm_ternarylogic_epi32( b, c, d, F ) );
+    a = _mm_add_epi32( b, _mm_mask_rol_epi32( a, 0xF, a, S ) );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f,avx512vl")
+BOOST_FORCEINLINE void md5_avx512vl_ff( __m128i& a, __m128i b, __m128i c, __m128i d, std::uint32_t x, std::uint32_t k ) noexcept
+{
+    md5_avx512vl_step<S, 0xCA>( a, b, c, d, x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f,avx512vl")
+BOOST_FORCEINLINE void md5_avx512vl_gg( __m128i& a, __m128i b, __m128i c, __m128i d, std::uint32_t x, std::uint32_t k ) noexcept
+{
+    md5_avx512vl_step<S, 0xE4>( a, b, c, d, x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f,avx512vl")
+BOOST_FORCEINLINE void md5_avx512vl_hh( __m128i& a, __m128i b, __m128i c, __m128i d, std::uint32_t x, std::uint32_t k ) noexcept
+{
+    md5_avx512vl_step<S, 0x96>( a, b, c, d, x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f,avx512vl")
+BOOST_FORCEINLINE void md5_avx512vl_ii( __m128i& a, __m128i b, __m128i c, __m128i d, std::uint32_t x, std::uint32_t k ) noexcept
+{
+    md5_avx512vl_step<S, 0x39>( a, b, c, d, x, k );
+}
+
+BOOST_HASH2_TARGET("avx512f,avx512vl")
+inline void md5_transform_avx512vl( unsigned char const block[ 64 ], std::uint32_t state[ 4 ] ) noexcept
+{
+    std::uint32_t x[ 16 ];
+
+    for( int i = 0; i < 16; ++i )
+    {
+        x[ i ] = detail::read32le( block + i * 4 );
+    }
+
+    __m128i a = _mm_cvtsi32_si128( static_cast<int>( state[ 0 ] ) );
+    __m128i b = _mm_cvtsi32_si128( static_cast<int>( state[ 1 ] ) );
+    __m128i c = _mm_cvtsi32_si128( static_cast<int>( state[ 2 ] ) );
+    __m128i d = _mm_cvtsi32_si128( static_cast<int>( state[ 3 ] ) );
+
+    md5_avx512vl_ff<7>( a, b, c, d, x[ 0 ], 0xd76aa478 );
+    md5_avx512vl_ff<12>( d, a, b, c, x[ 1 ], 0xe8c7b756 );
+    md5_avx512vl_ff<17>( c, d, a, b, x[ 2 ], 0x242070db );
+    md5_avx512vl_ff<22>( b, c, d, a, x[ 3 ], 0xc1bdceee );
+    md5_avx512vl_ff<7>( a, b, c, d, x[ 4 ], 0xf57c0faf );
+    md5_avx512vl_ff<12>( d, a, b, c, x[ 5 ], 0x4787c62a );
+    md5_avx512vl_ff<17>( c, d, a, b, x[ 6 ], 0xa8304613 );
+    md5_avx512vl_ff<22>( b, c, d, a, x[ 7 ], 0xfd469501 );
+    md5_avx512vl_ff<7>( a, b, c, d, x[ 8 ], 0x698098d8 );
+    md5_avx512vl_ff<12>( d, a, b, c, x[ 9 ], 0x8b44f7af );
+    md5_avx512vl_ff<17>( c, d, a, b, x[ 10 ], 0xffff5bb1 );
+    md5_avx512vl_ff<22>( b, c, d, a, x[ 11 ], 0x895cd7be );
+    md5_avx512vl_ff<7>( a, b, c, d, x[ 12 ], 0x6b901122 );
+    md5_avx512vl_ff<12>( d, a, b, c, x[ 13 ], 0xfd987193 );
+    md5_avx512vl_ff<17>( c, d, a, b, x[ 14 ], 0xa679438e );
+    md5_avx512vl_ff<22>( b, c, d, a, x[ 15 ], 0x49b40821 );
+
+    md5_avx512vl_gg<5>( a, b, c, d, x[ 1 ], 0xf61e2562 );
+    md5_avx512vl_gg<9>( d, a, b, c, x[ 6 ], 0xc040b340 );
+    md5_avx512vl_gg<14>( c, d, a, b, x[ 11 ], 0x265e5a51 );
+    md5_avx512vl_gg<20>( b, c, d, a, x[ 0 ], 0xe9b6c7aa );
+    md5_avx512vl_gg<5>( a, b, c, d, x[ 5 ], 0xd62f105d );
+    md5_avx512vl_gg<9>( d, a, b, c, x[ 10 ], 0x02441453 );
+    md5_avx512vl_gg<14>( c, d, a, b, x[ 15 ], 0xd8a1e681 );
+    md5_avx512vl_gg<20>( b, c, d, a, x[ 4 ], 0xe7d3fbc8 );
+    md5_avx512vl_gg<5>( a, b, c, d, x[ 9 ], 0x21e1cde6 );
+    md5_avx512vl_gg<9>( d, a, b, c, x[ 14 ], 0xc33707d6 );
+    md5_avx512vl_gg<14>( c, d, a, b, x[ 3 ], 0xf4d50d87 );
+    md5_avx512vl_gg<20>( b, c, d, a, x[ 8 ], 0x455a14ed );
+    md5_avx512vl_gg<5>( a, b, c, d, x[ 13 ], 0xa9e3e905 );
+    md5_avx512vl_gg<9>( d, a, b, c, x[ 2 ], 0xfcefa3f8 );
+    md5_avx512vl_gg<14>( c, d, a, b, x[ 7 ], 0x676f02d9 );
+    md5_avx512vl_gg<20>( b, c, d, a, x[ 12 ], 0x8d2a4c8a );
+
+    md5_avx512vl_hh<4>( a, b, c, d, x[ 5 ], 0xfffa3942 );
+    md5_avx512vl_hh<11>( d, a, b, c, x[ 8 ], 0x8771f681 );
+    md5_avx512vl_hh<16>( c, d, a, b, x[ 11 ], 0x6d9d6122 );
+    md5_avx512vl_hh<23>( b, c, d, a, x[ 14 ], 0xfde5380c );
+    md5_avx512vl_hh<4>( a, b, c, d, x[ 1 ], 0xa4beea44 );
+    md5_avx512vl_hh<11>( d, a, b, c, x[ 4 ], 0x4bdecfa9 );
+    md5_avx512vl_hh<16>( c, d, a, b, x[ 7 ], 0xf6bb4b60 );
+    md5_avx512vl_hh<23>( b, c, d, a, x[ 10 ], 0xbebfbc70 );
+    md5_avx512vl_hh<4>( a, b, c, d, x[ 13 ], 0x289b7ec6 );
+    md5_avx512vl_hh<11>( d, a, b, c, x[ 0 ], 0xeaa127fa );
+    md5_avx512vl_hh<16>( c, d, a, b, x[ 3 ], 0xd4ef3085 );
+    md5_avx512vl_hh<23>( b, c, d, a, x[ 6 ], 0x04881d05 );
+    md5_avx512vl_hh<4>( a, b, c, d, x[ 9 ], 0xd9d4d039 );
+    md5_avx512vl_hh<11>( d, a, b, c, x[ 12 ], 0xe6db99e5 );
+    md5_avx512vl_hh<16>( c, d, a, b, x[ 15 ], 0x1fa27cf8 );
+    md5_avx512vl_hh<23>( b, c, d, a, x[ 2 ], 0xc4ac5665 );
+
+    md5_avx512vl_ii<6>( a, b, c, d, x[ 0 ], 0xf4292244 );
+    md5_avx512vl_ii<10>( d, a, b, c, x[ 7 ], 0x432aff97 );
+    md5_avx512vl_ii<15>( c, d, a, b, x[ 14 ], 0xab9423a7 );
+    md5_avx512vl_ii<21>( b, c, d, a, x[ 5 ], 0xfc93a039 );
+    md5_avx512vl_ii<6>( a, b, c, d, x[ 12 ], 0x655b59c3 );
+    md5_avx512vl_ii<10>( d, a, b, c, x[ 3 ], 0x8f0ccc92 );
+    md5_avx512vl_ii<15>( c, d, a, b, x[ 10 ], 0xffeff47d );
+    md5_avx512vl_ii<21>( b, c, d, a, x[ 1 ], 0x85845dd1 );
+    md5_avx512vl_ii<6>( a, b, c, d, x[ 8 ], 0x6fa87e4f );
+    md5_avx512vl_ii<10>( d, a, b, c, x[ 15 ], 0xfe2ce6e0 );
+    md5_avx512vl_ii<15>( c, d, a, b, x[ 6 ], 0xa3014314 );
+    md5_avx512vl_ii<21>( b, c, d, a, x[ 13 ], 0x4e0811a1 );
+    md5_avx512vl_ii<6>( a, b, c, d, x[ 4 ], 0xf7537e82 );
+    md5_avx512vl_ii<10>( d, a, b, c, x[ 11 ], 0xbd3af235 );
+    md5_avx512vl_ii<15>( c, d, a, b, x[ 2 ], 0x2ad7d2bb );
+    md5_avx512vl_ii<21>( b, c, d, a, x[ 9 ], 0xeb86d391 );
+
+    state[ 0 ] += static_cast<std::uint32_t>( _mm_cvtsi128_si32( a ) );
+    state[ 1 ] += static_cast<std::uint32_t>( _mm_cvtsi128_si32( b ) );
+    state[ 2 ] += static_cast<std::uint32_t>( _mm_cvtsi128_si32( c ) );
+    state[ 3 ] += static_cast<std::uint32_t>( _mm_cvtsi128_si32( d ) );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_MD5_X86_HPP_INCLUDED
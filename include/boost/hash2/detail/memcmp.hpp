@@ -44,6 +44,25 @@ constexpr int memcmp( unsigned char const* p, unsigned char const* q, std::size_
 
 #endif
 
+BOOST_CXX14_CONSTEXPR inline bool equal_chars( char const* p, char const* q, std::size_t n ) noexcept
+{
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    if( detail::is_constant_evaluated() )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            if( p[ i ] != q[ i ] ) return false;
+        }
+
+        return true;
+    }
+
+#endif
+
+    return n == 0 || std::memcmp( p, q, n ) == 0;
+}
+
 } // namespace detail
 } // namespace hash2
 } // namespace boost
@@ -0,0 +1,57 @@
+#ifndef BOOST_HASH2_DETAIL_MINHASH_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_MINHASH_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// MinHash signature updates using NEON
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// s[i] = min( s[i], minhash_permute( lo, hi, a[i], b[i] ) ) for the n / 4 * 4
+// leading elements; returns the number of elements processed
+
+inline std::size_t minhash_update_neon( std::uint32_t* s, std::uint32_t const* a, std::uint32_t const* b, std::size_t n, std::uint32_t lo, std::uint32_t hi ) noexcept
+{
+    uint32x4_t const vlo = vdupq_n_u32( lo );
+    uint32x4_t const vhi = vdupq_n_u32( hi );
+    uint32x4_t const m = vdupq_n_u32( 0x7FEB352D );
+
+    std::size_t i = 0;
+
+    for( ; i + 4 <= n; i += 4 )
+    {
+        uint32x4_t x = vmlaq_u32( vld1q_u32( b + i ), vlo, vld1q_u32( a + i ) );
+        x = veorq_u32( x, vhi );
+
+        x = veorq_u32( x, vshrq_n_u32( x, 16 ) );
+        x = vmulq_u32( x, m );
+        x = veorq_u32( x, vshrq_n_u32( x, 15 ) );
+
+        vst1q_u32( s + i, vminq_u32( x, vld1q_u32( s + i ) ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_MINHASH_ARM_HPP_INCLUDED
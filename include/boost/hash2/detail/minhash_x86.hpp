@@ -0,0 +1,88 @@
+#ifndef BOOST_HASH2_DETAIL_MINHASH_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_MINHASH_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// MinHash signature updates using AVX2 and SSE4.1
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// s[i] = min( s[i], minhash_permute( lo, hi, a[i], b[i] ) ) for the n / 8 * 8
+// leading elements; returns the number of elements processed
+
+BOOST_HASH2_TARGET("avx2")
+inline std::size_t minhash_update_avx2( std::uint32_t* s, std::uint32_t const* a, std::uint32_t const* b, std::size_t n, std::uint32_t lo, std::uint32_t hi ) noexcept
+{
+    __m256i const vlo = _mm256_set1_epi32( static_cast<int>( lo ) );
+    __m256i const vhi = _mm256_set1_epi32( static_cast<int>( hi ) );
+    __m256i const m = _mm256_set1_epi32( 0x7FEB352D );
+
+    std::size_t i = 0;
+
+    for( ; i + 8 <= n; i += 8 )
+    {
+        __m256i x = _mm256_mullo_epi32( vlo, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( a + i ) ) );
+        x = _mm256_add_epi32( x, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( b + i ) ) );
+        x = _mm256_xor_si256( x, vhi );
+
+        x = _mm256_xor_si256( x, _mm256_srli_epi32( x, 16 ) );
+        x = _mm256_mullo_epi32( x, m );
+        x = _mm256_xor_si256( x, _mm256_srli_epi32( x, 15 ) );
+
+        __m256i y = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( s + i ) );
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( s + i ), _mm256_min_epu32( x, y ) );
+    }
+
+    return i;
+}
+
+// the same, for the n / 4 * 4 leading elements
+
+BOOST_HASH2_TARGET("sse4.1")
+inline std::size_t minhash_update_sse41( std::uint32_t* s, std::uint32_t const* a, std::uint32_t const* b, std::size_t n, std::uint32_t lo, std::uint32_t hi ) noexcept
+{
+    __m128i const vlo = _mm_set1_epi32( static_cast<int>( lo ) );
+    __m128i const vhi = _mm_set1_epi32( static_cast<int>( hi ) );
+    __m128i const m = _mm_set1_epi32( 0x7FEB352D );
+
+    std::size_t i = 0;
+
+    for( ; i + 4 <= n; i += 4 )
+    {
+        __m128i x = _mm_mullo_epi32( vlo, _mm_loadu_si128( reinterpret_cast<__m128i const*>( a + i ) ) );
+        x = _mm_add_epi32( x, _mm_loadu_si128( reinterpret_cast<__m128i const*>( b + i ) ) );
+        x = _mm_xor_si128( x, vhi );
+
+        x = _mm_xor_si128( x, _mm_srli_epi32( x, 16 ) );
+        x = _mm_mullo_epi32( x, m );
+        x = _mm_xor_si128( x, _mm_srli_epi32( x, 15 ) );
+
+        __m128i y = _mm_loadu_si128( reinterpret_cast<__m128i const*>( s + i ) );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( s + i ), _mm_min_epu32( x, y ) );
+    }
+
+    return i;
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_MINHASH_X86_HPP_INCLUDED
@@ -0,0 +1,71 @@
+#ifndef BOOST_HASH2_DETAIL_MUL128_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_MUL128_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+# include <intrin.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// full 64x64 -> 128 bit product; returns the low half, stores the high half in hi
+
+BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t mul128( std::uint64_t x, std::uint64_t y, std::uint64_t& hi ) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+
+    __extension__ typedef unsigned __int128 uint128_t;
+
+    uint128_t r = static_cast<uint128_t>( x ) * y;
+
+    hi = static_cast<std::uint64_t>( r >> 64 );
+    return static_cast<std::uint64_t>( r );
+
+#else
+
+#if defined(_MSC_VER) && defined(_M_X64) && !defined(__clang__)
+
+    if( !detail::is_constant_evaluated() )
+    {
+        return _umul128( x, y, &hi );
+    }
+
+#endif
+
+    std::uint64_t x1 = x >> 32;
+    std::uint64_t x0 = x & 0xFFFFFFFFu;
+
+    std::uint64_t y1 = y >> 32;
+    std::uint64_t y0 = y & 0xFFFFFFFFu;
+
+    std::uint64_t r00 = x0 * y0;
+    std::uint64_t r01 = x0 * y1;
+    std::uint64_t r10 = x1 * y0;
+    std::uint64_t r11 = x1 * y1;
+
+    std::uint64_t mid = ( r00 >> 32 ) + ( r10 & 0xFFFFFFFFu ) + r01;
+
+    hi = r11 + ( r10 >> 32 ) + ( mid >> 32 );
+    return ( mid << 32 ) | ( r00 & 0xFFFFFFFFu );
+
+#endif
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_MUL128_HPP_INCLUDED
@@ -0,0 +1,348 @@
+#ifndef BOOST_HASH2_DETAIL_MULTI_BUFFER_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_MULTI_BUFFER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/endian.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <array>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// multi_lane<H>, defines template<std::size_t N> using type and sets value
+// to true when a multi-buffer implementation of H is available, producing
+// the same results as H for messages of equal length
+
+template<class H> struct multi_lane
+{
+    static constexpr bool value = false;
+};
+
+// multi_buffer<Algo, N>
+//
+// N independent Merkle-Damgard computations over messages of equal length.
+// The chaining values are stored word-major, state_[ i * N + j ] being word i
+// of message j, so that the compression function can process several messages
+// in parallel SIMD lanes.
+//
+// Algo supplies
+//
+//   word_type, state_words, block_size, digest_size, length_size, byte_order
+//
+//   static void init( word_type state[ state_words ] );
+//   static void transform( unsigned char const* block, word_type state[ state_words ] );
+//
+//   // processes a prefix of the n lanes, returns its length (possibly 0)
+//   static std::size_t transform_lanes( unsigned char const* const block[], word_type* state, std::size_t n, std::size_t stride );
+
+template<class Algo, std::size_t N> class multi_buffer
+{
+private:
+
+    static_assert( N > 0, "N must not be zero" );
+
+    using word_type = typename Algo::word_type;
+
+    static constexpr std::size_t W = Algo::state_words;
+    static constexpr std::size_t M = Algo::block_size;
+
+    word_type state_[ W * N ] = {};
+
+    unsigned char buffer_[ N ][ M ] = {};
+    std::size_t m_ = 0; // == n_ % M
+
+    std::uint64_t n_ = 0;
+
+private:
+
+    void init()
+    {
+        word_type iv[ W ] = {};
+        Algo::init( iv );
+
+        init( iv );
+    }
+
+    void init( word_type const iv[ W ] )
+    {
+        for( std::size_t i = 0; i < W; ++i )
+        {
+            for( std::size_t j = 0; j < N; ++j )
+            {
+                state_[ i * N + j ] = iv[ i ];
+            }
+        }
+    }
+
+    void transform( unsigned char const* const block[ N ] )
+    {
+        std::size_t j = Algo::transform_lanes( block, state_, N, N );
+
+        for( ; j < N; ++j )
+        {
+            word_type st[ W ];
+
+            for( std::size_t i = 0; i < W; ++i )
+            {
+                st[ i ] = state_[ i * N + j ];
+            }
+
+            Algo::transform( block[ j ], st );
+
+            for( std::size_t i = 0; i < W; ++i )
+            {
+                state_[ i * N + j ] = st[ i ];
+            }
+        }
+    }
+
+    // nb consecutive blocks of each message, starting at p[j] + k; the
+    // lanes the kernels don't cover are processed one message at a time,
+    // so that their chaining values stay in registers across the blocks
+
+    void transform_blocks( unsigned char const* const p[ N ], std::size_t k, std::size_t nb )
+    {
+        std::size_t j0 = N;
+
+        for( std::size_t b = 0; b < nb; ++b )
+        {
+            unsigned char const* block[ N ];
+
+            for( std::size_t j = 0; j < N; ++j )
+            {
+                block[ j ] = p[ j ] + k + b * M;
+            }
+
+            j0 = Algo::transform_lanes( block, state_, N, N );
+        }
+
+        for( std::size_t j = j0; j < N; ++j )
+        {
+            word_type st[ W ];
+
+            for( std::size_t i = 0; i < W; ++i )
+            {
+                st[ i ] = state_[ i * N + j ];
+            }
+
+            for( std::size_t b = 0; b < nb; ++b )
+            {
+                Algo::transform( p[ j ] + k + b * M, st );
+            }
+
+            for( std::size_t i = 0; i < W; ++i )
+            {
+                state_[ i * N + j ] = st[ i ];
+            }
+        }
+    }
+
+    void transform_buffer()
+    {
+        unsigned char const* block[ N ];
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            block[ j ] = buffer_[ j ];
+        }
+
+        transform( block );
+    }
+
+    // updates every lane with the same byte sequence
+
+    void update_all( unsigned char const* p, std::size_t n )
+    {
+        unsigned char const* q[ N ];
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            q[ j ] = p;
+        }
+
+        update( q, n );
+    }
+
+public:
+
+    using result_type = std::array<digest<Algo::digest_size>, N>;
+
+    static constexpr int block_size = Algo::block_size;
+    static constexpr std::size_t lanes = N;
+
+    multi_buffer()
+    {
+        init();
+    }
+
+    explicit multi_buffer( std::uint64_t seed )
+    {
+        init();
+
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            update_all( tmp, 8 );
+            result();
+        }
+    }
+
+    multi_buffer( unsigned char const * p, std::size_t n )
+    {
+        init();
+
+        if( n != 0 )
+        {
+            update_all( p, n );
+            result();
+        }
+    }
+
+    // resumes N computations from the chaining value iv, obtained after
+    // processing n bytes; n must be a multiple of block_size
+
+    multi_buffer( word_type const iv[ W ], std::uint64_t n ): n_( n )
+    {
+        BOOST_ASSERT( n % M == 0 );
+
+        init( iv );
+    }
+
+    // appends [p[j], p[j]+n) to message j, for each j in [0, N)
+
+    void update( unsigned char const* const p[ N ], std::size_t n )
+    {
+        BOOST_ASSERT( m_ == n_ % M );
+
+        if( n == 0 ) return;
+
+        n_ += n;
+
+        std::size_t k = 0; // offset into p[j]
+
+        if( m_ > 0 )
+        {
+            k = M - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            for( std::size_t j = 0; j < N; ++j )
+            {
+                std::memcpy( buffer_[ j ] + m_, p[ j ], k );
+            }
+
+            n -= k;
+            m_ += k;
+
+            if( m_ < M ) return;
+
+            BOOST_ASSERT( m_ == M );
+
+            transform_buffer();
+            m_ = 0;
+
+            std::memset( buffer_, 0, sizeof( buffer_ ) );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        {
+            std::size_t const nb = n / M;
+
+            transform_blocks( p, k, nb );
+
+            k += nb * M;
+            n -= nb * M;
+        }
+
+        BOOST_ASSERT( n < M );
+
+        if( n > 0 )
+        {
+            for( std::size_t j = 0; j < N; ++j )
+            {
+                std::memcpy( buffer_[ j ], p[ j ] + k, n );
+            }
+
+            m_ = n;
+        }
+
+        BOOST_ASSERT( m_ == n_ % M );
+    }
+
+    void update( void const* const p[ N ], std::size_t n )
+    {
+        unsigned char const* q[ N ];
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            q[ j ] = static_cast<unsigned char const*>( p[ j ] );
+        }
+
+        update( q, n );
+    }
+
+    result_type result()
+    {
+        std::size_t const L = Algo::length_size;
+
+        // the bit length occupies the low 8 bytes of the length field
+
+        unsigned char bits[ L ] = {};
+
+        if( Algo::byte_order == endian::big )
+        {
+            detail::write64be( bits + L - 8, n_ * 8 );
+        }
+        else
+        {
+            detail::write64le( bits, n_ * 8 );
+        }
+
+        std::size_t k = m_ < M - L ? M - L - m_ : M + M - L - m_;
+        unsigned char padding[ M ] = { 0x80 };
+
+        update_all( padding, k );
+        update_all( bits, L );
+        BOOST_ASSERT( m_ == 0 );
+
+        result_type r;
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            unsigned char tmp[ W ][ sizeof( word_type ) ];
+
+            for( std::size_t i = 0; i < W; ++i )
+            {
+                detail::write( state_[ i * N + j ], Algo::byte_order, tmp[ i ] );
+            }
+
+            std::memcpy( r[ j ].data(), tmp, Algo::digest_size );
+        }
+
+        return r;
+    }
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_MULTI_BUFFER_HPP_INCLUDED
@@ -0,0 +1,185 @@
+#ifndef BOOST_HASH2_DETAIL_NUMA_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_NUMA_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <cstddef>
+
+#if defined(__linux__) && !defined(BOOST_HASH2_DISABLE_NUMA)
+# include <sys/syscall.h>
+# include <unistd.h>
+# include <cstdio>
+# if defined(SYS_get_mempolicy) && defined(SYS_sched_getaffinity) && defined(SYS_sched_setaffinity)
+#  define BOOST_HASH2_HAS_NUMA
+# endif
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// NUMA placement of the worker threads of the parallel hashing modes
+//
+// On a machine with several memory nodes, a worker that hashes a part of
+// a buffer is bound, for its lifetime, to the CPUs of the node on which
+// that part resides, so that it doesn't read it across the interconnect;
+// with first touch allocation, this is the node of the thread that has
+// filled it. Only the threads that the library starts for the call, which
+// set numa_worker(), are bound; the calling thread, and the threads of a
+// pool, never are. On machines with a single node, and on other operating
+// systems, this does nothing.
+//
+// Defining BOOST_HASH2_DISABLE_NUMA disables it.
+
+// true in the threads that may be bound
+
+inline bool& numa_worker() noexcept
+{
+    static thread_local bool r = false;
+    return r;
+}
+
+#if defined(BOOST_HASH2_HAS_NUMA)
+
+// calls f( a, b ) for each range a-b of a list such as "0-3,8-11"
+
+template<class F> void numa_read_list( char const* path, F f )
+{
+    std::FILE* file = std::fopen( path, "r" );
+
+    if( file == nullptr ) return;
+
+    int a = 0, b = 0;
+
+    while( std::fscanf( file, "%d", &a ) == 1 )
+    {
+        b = a;
+
+        int c = std::fgetc( file );
+
+        if( c == '-' )
+        {
+            if( std::fscanf( file, "%d", &b ) != 1 ) break;
+            c = std::fgetc( file );
+        }
+
+        f( a, b );
+
+        if( c != ',' ) break;
+    }
+
+    std::fclose( file );
+}
+
+// the number of online nodes; 1 when unknown
+
+inline int numa_node_count_() noexcept
+{
+    int n = 0;
+
+    detail::numa_read_list( "/sys/devices/system/node/online", [&]( int a, int b ){ n += b - a + 1; } );
+
+    return n > 0? n: 1;
+}
+
+inline int numa_node_count() noexcept
+{
+    static int const n = numa_node_count_();
+    return n;
+}
+
+// the node of the page containing p, or -1
+
+inline int numa_node_of( void const* p ) noexcept
+{
+    int node = -1;
+
+    // MPOL_F_NODE | MPOL_F_ADDR
+
+    long r = ::syscall( SYS_get_mempolicy, &node, static_cast<unsigned long*>( nullptr ), 0ul, const_cast<void*>( p ), 3ul );
+
+    return r == 0? node: -1;
+}
+
+// restricts the calling thread to the CPUs of node that it may already
+// run on; returns false, leaving it unchanged, when there are none
+
+inline bool numa_bind( int node ) noexcept
+{
+    constexpr std::size_t W = 1024 / ( 8 * sizeof( unsigned long ) );
+    constexpr std::size_t B = 8 * sizeof( unsigned long );
+
+    unsigned long allowed[ W ] = {};
+
+    if( ::syscall( SYS_sched_getaffinity, 0, sizeof( allowed ), allowed ) < 0 ) return false;
+
+    char path[ 64 ];
+    std::snprintf( path, sizeof( path ), "/sys/devices/system/node/node%d/cpulist", node );
+
+    unsigned long mask[ W ] = {};
+    bool any = false;
+
+    detail::numa_read_list( path, [&]( int a, int b ){
+
+        for( int i = a; i <= b && i >= 0 && static_cast<std::size_t>( i ) < W * B; ++i )
+        {
+            std::size_t const j = static_cast<std::size_t>( i );
+
+            if( allowed[ j / B ] & ( 1ul << ( j % B ) ) )
+            {
+                mask[ j / B ] |= 1ul << ( j % B );
+                any = true;
+            }
+        }
+    });
+
+    return any && ::syscall( SYS_sched_setaffinity, 0, sizeof( mask ), mask ) == 0;
+}
+
+// binds the calling worker to the node of p, when there are several
+
+inline void numa_bind_worker( void const* p ) noexcept
+{
+    if( !detail::numa_worker() || detail::numa_node_count() < 2 ) return;
+
+    int node = detail::numa_node_of( p );
+
+    if( node >= 0 )
+    {
+        detail::numa_bind( node );
+    }
+}
+
+#else
+
+inline int numa_node_count() noexcept
+{
+    return 1;
+}
+
+inline int numa_node_of( void const* /*p*/ ) noexcept
+{
+    return -1;
+}
+
+inline bool numa_bind( int /*node*/ ) noexcept
+{
+    return false;
+}
+
+inline void numa_bind_worker( void const* /*p*/ ) noexcept
+{
+}
+
+#endif
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_NUMA_HPP_INCLUDED
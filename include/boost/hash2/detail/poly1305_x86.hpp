@@ -0,0 +1,178 @@
+#ifndef BOOST_HASH2_DETAIL_POLY1305_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_POLY1305_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Poly1305 using AVX2, four blocks at a time in radix 2^26,
+// https://eprint.iacr.org/2013/538
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// h = h * r mod 2^130-5 in each lane, for limbs of at most 2^27 and
+// s[ i ] == 5 * r[ i ]; the limbs of the result are carried to 26 bits,
+// except the second and the fifth, which can exceed it slightly
+
+BOOST_HASH2_TARGET("avx2")
+inline void poly1305_mul_avx2( __m256i (&h)[ 5 ], __m256i const (&r)[ 5 ], __m256i const (&s)[ 5 ] ) noexcept
+{
+    __m256i const mask = _mm256_set1_epi64x( 0x3FFFFFF );
+
+    __m256i d0 = _mm256_mul_epu32( h[ 0 ], r[ 0 ] );
+    __m256i d1 = _mm256_mul_epu32( h[ 0 ], r[ 1 ] );
+    __m256i d2 = _mm256_mul_epu32( h[ 0 ], r[ 2 ] );
+    __m256i d3 = _mm256_mul_epu32( h[ 0 ], r[ 3 ] );
+    __m256i d4 = _mm256_mul_epu32( h[ 0 ], r[ 4 ] );
+
+    d0 = _mm256_add_epi64( d0, _mm256_mul_epu32( h[ 1 ], s[ 4 ] ) );
+    d1 = _mm256_add_epi64( d1, _mm256_mul_epu32( h[ 1 ], r[ 0 ] ) );
+    d2 = _mm256_add_epi64( d2, _mm256_mul_epu32( h[ 1 ], r[ 1 ] ) );
+    d3 = _mm256_add_epi64( d3, _mm256_mul_epu32( h[ 1 ], r[ 2 ] ) );
+    d4 = _mm256_add_epi64( d4, _mm256_mul_epu32( h[ 1 ], r[ 3 ] ) );
+
+    d0 = _mm256_add_epi64( d0, _mm256_mul_epu32( h[ 2 ], s[ 3 ] ) );
+    d1 = _mm256_add_epi64( d1, _mm256_mul_epu32( h[ 2 ], s[ 4 ] ) );
+    d2 = _mm256_add_epi64( d2, _mm256_mul_epu32( h[ 2 ], r[ 0 ] ) );
+    d3 = _mm256_add_epi64( d3, _mm256_mul_epu32( h[ 2 ], r[ 1 ] ) );
+    d4 = _mm256_add_epi64( d4, _mm256_mul_epu32( h[ 2 ], r[ 2 ] ) );
+
+    d0 = _mm256_add_epi64( d0, _mm256_mul_epu32( h[ 3 ], s[ 2 ] ) );
+    d1 = _mm256_add_epi64( d1, _mm256_mul_epu32( h[ 3 ], s[ 3 ] ) );
+    d2 = _mm256_add_epi64( d2, _mm256_mul_epu32( h[ 3 ], s[ 4 ] ) );
+    d3 = _mm256_add_epi64( d3, _mm256_mul_epu32( h[ 3 ], r[ 0 ] ) );
+    d4 = _mm256_add_epi64( d4, _mm256_mul_epu32( h[ 3 ], r[ 1 ] ) );
+
+    d0 = _mm256_add_epi64( d0, _mm256_mul_epu32( h[ 4 ], s[ 1 ] ) );
+    d1 = _mm256_add_epi64( d1, _mm256_mul_epu32( h[ 4 ], s[ 2 ] ) );
+    d2 = _mm256_add_epi64( d2, _mm256_mul_epu32( h[ 4 ], s[ 3 ] ) );
+    d3 = _mm256_add_epi64( d3, _mm256_mul_epu32( h[ 4 ], s[ 4 ] ) );
+    d4 = _mm256_add_epi64( d4, _mm256_mul_epu32( h[ 4 ], r[ 0 ] ) );
+
+    // two interleaved carry chains, d0 -> d1 and d3 -> d4 -> d0,
+    // then d1 -> d2 -> d3 and d0 -> d1
+
+    __m256i c;
+
+    c = _mm256_srli_epi64( d0, 26 ); d0 = _mm256_and_si256( d0, mask ); d1 = _mm256_add_epi64( d1, c );
+    c = _mm256_srli_epi64( d3, 26 ); d3 = _mm256_and_si256( d3, mask ); d4 = _mm256_add_epi64( d4, c );
+
+    c = _mm256_srli_epi64( d1, 26 ); d1 = _mm256_and_si256( d1, mask ); d2 = _mm256_add_epi64( d2, c );
+    c = _mm256_srli_epi64( d4, 26 ); d4 = _mm256_and_si256( d4, mask ); d0 = _mm256_add_epi64( d0, _mm256_add_epi64( c, _mm256_slli_epi64( c, 2 ) ) );
+
+    c = _mm256_srli_epi64( d2, 26 ); d2 = _mm256_and_si256( d2, mask ); d3 = _mm256_add_epi64( d3, c );
+    c = _mm256_srli_epi64( d0, 26 ); d0 = _mm256_and_si256( d0, mask ); d1 = _mm256_add_epi64( d1, c );
+
+    c = _mm256_srli_epi64( d3, 26 ); d3 = _mm256_and_si256( d3, mask ); d4 = _mm256_add_epi64( d4, c );
+
+    h[ 0 ] = d0;
+    h[ 1 ] = d1;
+    h[ 2 ] = d2;
+    h[ 3 ] = d3;
+    h[ 4 ] = d4;
+}
+
+// rp[ i ] holds the limbs of r^(i+1); n is a nonzero multiple of 64.
+// Lane j accumulates the blocks 4i+j, multiplied by r^4 between
+// groups; the lanes are multiplied by r^4, ..., r^1 at the end.
+// The unpacks below leave the blocks in the lane order 0, 2, 1, 3.
+
+BOOST_HASH2_TARGET("avx2")
+inline void poly1305_blocks_avx2( std::uint32_t* h, std::uint32_t const (*rp)[ 5 ], unsigned char const* p, std::size_t n ) noexcept
+{
+    __m256i const mask = _mm256_set1_epi64x( 0x3FFFFFF );
+    __m256i const hibit = _mm256_set1_epi64x( 1 << 24 );
+
+    __m256i r[ 5 ], s[ 5 ];
+
+    for( int i = 0; i < 5; ++i )
+    {
+        r[ i ] = _mm256_set1_epi64x( rp[ 3 ][ i ] );
+        s[ i ] = _mm256_set1_epi64x( 5 * rp[ 3 ][ i ] );
+    }
+
+    __m256i x[ 5 ];
+
+    for( int i = 0; i < 5; ++i )
+    {
+        x[ i ] = _mm256_setr_epi64x( h[ i ], 0, 0, 0 );
+    }
+
+    for( ;; )
+    {
+        __m256i const a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p ) );
+        __m256i const b = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 32 ) );
+
+        __m256i const t0 = _mm256_unpacklo_epi64( a, b );
+        __m256i const t1 = _mm256_unpackhi_epi64( a, b );
+
+        x[ 0 ] = _mm256_add_epi64( x[ 0 ], _mm256_and_si256( t0, mask ) );
+        x[ 1 ] = _mm256_add_epi64( x[ 1 ], _mm256_and_si256( _mm256_srli_epi64( t0, 26 ), mask ) );
+        x[ 2 ] = _mm256_add_epi64( x[ 2 ], _mm256_and_si256( _mm256_or_si256( _mm256_srli_epi64( t0, 52 ), _mm256_slli_epi64( t1, 12 ) ), mask ) );
+        x[ 3 ] = _mm256_add_epi64( x[ 3 ], _mm256_and_si256( _mm256_srli_epi64( t1, 14 ), mask ) );
+        x[ 4 ] = _mm256_add_epi64( x[ 4 ], _mm256_or_si256( _mm256_srli_epi64( t1, 40 ), hibit ) );
+
+        p += 64;
+        n -= 64;
+
+        if( n == 0 ) break;
+
+        detail::poly1305_mul_avx2( x, r, s );
+    }
+
+    for( int i = 0; i < 5; ++i )
+    {
+        r[ i ] = _mm256_setr_epi64x( rp[ 3 ][ i ], rp[ 1 ][ i ], rp[ 2 ][ i ], rp[ 0 ][ i ] );
+        s[ i ] = _mm256_add_epi64( r[ i ], _mm256_slli_epi64( r[ i ], 2 ) );
+    }
+
+    detail::poly1305_mul_avx2( x, r, s );
+
+    // the sum of the lanes, carried
+
+    std::uint64_t d[ 5 ];
+
+    for( int i = 0; i < 5; ++i )
+    {
+        __m128i t = _mm_add_epi64( _mm256_castsi256_si128( x[ i ] ), _mm256_extracti128_si256( x[ i ], 1 ) );
+        t = _mm_add_epi64( t, _mm_unpackhi_epi64( t, t ) );
+
+        d[ i ] = static_cast<std::uint64_t>( _mm_cvtsi128_si64( t ) );
+    }
+
+    std::uint64_t c;
+
+    c = d[ 0 ] >> 26; d[ 0 ] &= 0x3FFFFFF; d[ 1 ] += c;
+    c = d[ 1 ] >> 26; d[ 1 ] &= 0x3FFFFFF; d[ 2 ] += c;
+    c = d[ 2 ] >> 26; d[ 2 ] &= 0x3FFFFFF; d[ 3 ] += c;
+    c = d[ 3 ] >> 26; d[ 3 ] &= 0x3FFFFFF; d[ 4 ] += c;
+    c = d[ 4 ] >> 26; d[ 4 ] &= 0x3FFFFFF; d[ 0 ] += c * 5;
+    c = d[ 0 ] >> 26; d[ 0 ] &= 0x3FFFFFF; d[ 1 ] += c;
+
+    for( int i = 0; i < 5; ++i )
+    {
+        h[ i ] = static_cast<std::uint32_t>( d[ i ] );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_POLY1305_X86_HPP_INCLUDED
@@ -0,0 +1,55 @@
+#ifndef BOOST_HASH2_DETAIL_PREFETCH_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_PREFETCH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS) && defined(_MSC_VER) && !defined(__clang__)
+# include <xmmintrin.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// a hint to bring the cache line at p into the cache, for reading
+
+BOOST_FORCEINLINE void prefetch( void const* p ) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    __builtin_prefetch( p );
+
+#elif defined(BOOST_HASH2_HAS_X86_INTRINSICS) && defined(_MSC_VER)
+
+    _mm_prefetch( static_cast<char const*>( p ), _MM_HINT_T0 );
+
+#else
+
+    (void)p;
+
+#endif
+}
+
+// prefetches the first element of a contiguous range, such as a string
+
+template<class R> void prefetch_range( R const& r )
+{
+    if( r.size() != 0 )
+    {
+        detail::prefetch( r.data() );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_PREFETCH_HPP_INCLUDED
@@ -7,6 +7,7 @@
 
 #include <boost/hash2/endian.hpp>
 #include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/bswap.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
 #include <cstring>
@@ -26,6 +27,12 @@ BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint32_t read32le( unsigned char co
         std::memcpy( &v, p, sizeof(v) );
         return v;
     }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        std::uint32_t v = 0;
+        std::memcpy( &v, p, sizeof(v) );
+        return detail::bswap32( v );
+    }
     else
     {
         return
@@ -44,6 +51,12 @@ BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t read64le( unsigned char co
         std::memcpy( &v, p, sizeof(v) );
         return v;
     }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        std::uint64_t v = 0;
+        std::memcpy( &v, p, sizeof(v) );
+        return detail::bswap64( v );
+    }
     else
     {
         return
@@ -60,24 +73,54 @@ BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t read64le( unsigned char co
 
 BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint32_t read32be( unsigned char const * p ) noexcept
 {
-    return
-        static_cast<std::uint32_t>( p[3] ) |
-        ( static_cast<std::uint32_t>( p[2] ) <<  8 ) |
-        ( static_cast<std::uint32_t>( p[1] ) << 16 ) |
-        ( static_cast<std::uint32_t>( p[0] ) << 24 );
+    if( !detail::is_constant_evaluated() && endian::native == endian::little )
+    {
+        std::uint32_t v = 0;
+        std::memcpy( &v, p, sizeof(v) );
+        return detail::bswap32( v );
+    }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        std::uint32_t v = 0;
+        std::memcpy( &v, p, sizeof(v) );
+        return v;
+    }
+    else
+    {
+        return
+            static_cast<std::uint32_t>( p[3] ) |
+            ( static_cast<std::uint32_t>( p[2] ) <<  8 ) |
+            ( static_cast<std::uint32_t>( p[1] ) << 16 ) |
+            ( static_cast<std::uint32_t>( p[0] ) << 24 );
+    }
 }
 
 BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t read64be( unsigned char const * p ) noexcept
 {
-    return
-        static_cast<std::uint64_t>( p[7] ) |
-        ( static_cast<std::uint64_t>( p[6] ) <<  8 ) |
-        ( static_cast<std::uint64_t>( p[5] ) << 16 ) |
-        ( static_cast<std::uint64_t>( p[4] ) << 24 ) |
-        ( static_cast<std::uint64_t>( p[3] ) << 32 ) |
-        ( static_cast<std::uint64_t>( p[2] ) << 40 ) |
-        ( static_cast<std::uint64_t>( p[1] ) << 48 ) |
-        ( static_cast<std::uint64_t>( p[0] ) << 56 );
+    if( !detail::is_constant_evaluated() && endian::native == endian::little )
+    {
+        std::uint64_t v = 0;
+        std::memcpy( &v, p, sizeof(v) );
+        return detail::bswap64( v );
+    }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        std::uint64_t v = 0;
+        std::memcpy( &v, p, sizeof(v) );
+        return v;
+    }
+    else
+    {
+        return
+            static_cast<std::uint64_t>( p[7] ) |
+            ( static_cast<std::uint64_t>( p[6] ) <<  8 ) |
+            ( static_cast<std::uint64_t>( p[5] ) << 16 ) |
+            ( static_cast<std::uint64_t>( p[4] ) << 24 ) |
+            ( static_cast<std::uint64_t>( p[3] ) << 32 ) |
+            ( static_cast<std::uint64_t>( p[2] ) << 40 ) |
+            ( static_cast<std::uint64_t>( p[1] ) << 48 ) |
+            ( static_cast<std::uint64_t>( p[0] ) << 56 );
+    }
 }
 
 } // namespace detail
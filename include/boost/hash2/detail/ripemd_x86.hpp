@@ -0,0 +1,558 @@
+#ifndef BOOST_HASH2_DETAIL_RIPEMD_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_RIPEMD_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// RIPEMD-160, eight independent messages in the 32 bit lanes of an AVX2
+// register, or sixteen in those of an AVX-512 register
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/lanes_x86.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i ripemd_avx2_rotl( __m256i x ) noexcept
+{
+    return _mm256_or_si256( _mm256_slli_epi32( x, S ), _mm256_srli_epi32( x, 32 - S ) );
+}
+
+// a = rotl( a + f + x + k, S ) + e, c = rotl( c, 10 ), as in ripemd_160
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void ripemd_avx2_step( __m256i& a, __m256i /*b*/, __m256i& c, __m256i e, __m256i f, __m256i x, std::uint32_t k ) noexcept
+{
+    a = _mm256_add_epi32( _mm256_add_epi32( a, f ), _mm256_add_epi32( x, _mm256_set1_epi32( static_cast<int>( k ) ) ) );
+    a = _mm256_add_epi32( ripemd_avx2_rotl<S>( a ), e );
+    c = ripemd_avx2_rotl<10>( c );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void ripemd_avx2_f1( __m256i& a, __m256i b, __m256i& c, __m256i d, __m256i e, __m256i x, std::uint32_t k ) noexcept
+{
+    // b ^ c ^ d
+    ripemd_avx2_step<S>( a, b, c, e, _mm256_xor_si256( _mm256_xor_si256( b, c ), d ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void ripemd_avx2_f2( __m256i& a, __m256i b, __m256i& c, __m256i d, __m256i e, __m256i x, std::uint32_t k ) noexcept
+{
+    // ( b & c ) | ( ~b & d )
+    ripemd_avx2_step<S>( a, b, c, e, _mm256_xor_si256( d, _mm256_and_si256( b, _mm256_xor_si256( c, d ) ) ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void ripemd_avx2_f3( __m256i& a, __m256i b, __m256i& c, __m256i d, __m256i e, __m256i x, std::uint32_t k ) noexcept
+{
+    // ( b | ~c ) ^ d
+    __m256i const ones = _mm256_set1_epi32( -1 );
+    ripemd_avx2_step<S>( a, b, c, e, _mm256_xor_si256( _mm256_or_si256( b, _mm256_xor_si256( c, ones ) ), d ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void ripemd_avx2_f4( __m256i& a, __m256i b, __m256i& c, __m256i d, __m256i e, __m256i x, std::uint32_t k ) noexcept
+{
+    // ( b & d ) | ( c & ~d )
+    ripemd_avx2_step<S>( a, b, c, e, _mm256_xor_si256( c, _mm256_and_si256( d, _mm256_xor_si256( b, c ) ) ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void ripemd_avx2_f5( __m256i& a, __m256i b, __m256i& c, __m256i d, __m256i e, __m256i x, std::uint32_t k ) noexcept
+{
+    // b ^ ( c | ~d )
+    __m256i const ones = _mm256_set1_epi32( -1 );
+    ripemd_avx2_step<S>( a, b, c, e, _mm256_xor_si256( b, _mm256_or_si256( c, _mm256_xor_si256( d, ones ) ) ), x, k );
+}
+
+// st[ i * stride + j ] is word i of the state of message j
+
+BOOST_HASH2_TARGET("avx2")
+inline void ripemd_160_transform_avx2( unsigned char const* const block[ 8 ], std::uint32_t* st, std::size_t stride ) noexcept
+{
+    __m256i x[ 16 ];
+    lanes_load_avx2( block, x );
+
+    __m256i v[ 5 ];
+
+    for( int i = 0; i < 5; ++i )
+    {
+        v[ i ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + i * stride ) );
+    }
+
+    __m256i aa = v[ 0 ], bb = v[ 1 ], cc = v[ 2 ], dd = v[ 3 ], ee = v[ 4 ];
+    __m256i aaa = v[ 0 ], bbb = v[ 1 ], ccc = v[ 2 ], ddd = v[ 3 ], eee = v[ 4 ];
+
+    ripemd_avx2_f1<11>( aa, bb, cc, dd, ee, x[ 0 ], 0x00000000 );
+    ripemd_avx2_f1<14>( ee, aa, bb, cc, dd, x[ 1 ], 0x00000000 );
+    ripemd_avx2_f1<15>( dd, ee, aa, bb, cc, x[ 2 ], 0x00000000 );
+    ripemd_avx2_f1<12>( cc, dd, ee, aa, bb, x[ 3 ], 0x00000000 );
+    ripemd_avx2_f1<5>( bb, cc, dd, ee, aa, x[ 4 ], 0x00000000 );
+    ripemd_avx2_f1<8>( aa, bb, cc, dd, ee, x[ 5 ], 0x00000000 );
+    ripemd_avx2_f1<7>( ee, aa, bb, cc, dd, x[ 6 ], 0x00000000 );
+    ripemd_avx2_f1<9>( dd, ee, aa, bb, cc, x[ 7 ], 0x00000000 );
+    ripemd_avx2_f1<11>( cc, dd, ee, aa, bb, x[ 8 ], 0x00000000 );
+    ripemd_avx2_f1<13>( bb, cc, dd, ee, aa, x[ 9 ], 0x00000000 );
+    ripemd_avx2_f1<14>( aa, bb, cc, dd, ee, x[ 10 ], 0x00000000 );
+    ripemd_avx2_f1<15>( ee, aa, bb, cc, dd, x[ 11 ], 0x00000000 );
+    ripemd_avx2_f1<6>( dd, ee, aa, bb, cc, x[ 12 ], 0x00000000 );
+    ripemd_avx2_f1<7>( cc, dd, ee, aa, bb, x[ 13 ], 0x00000000 );
+    ripemd_avx2_f1<9>( bb, cc, dd, ee, aa, x[ 14 ], 0x00000000 );
+    ripemd_avx2_f1<8>( aa, bb, cc, dd, ee, x[ 15 ], 0x00000000 );
+
+    ripemd_avx2_f5<8>( aaa, bbb, ccc, ddd, eee, x[ 5 ], 0x50a28be6 );
+    ripemd_avx2_f5<9>( eee, aaa, bbb, ccc, ddd, x[ 14 ], 0x50a28be6 );
+    ripemd_avx2_f5<9>( ddd, eee, aaa, bbb, ccc, x[ 7 ], 0x50a28be6 );
+    ripemd_avx2_f5<11>( ccc, ddd, eee, aaa, bbb, x[ 0 ], 0x50a28be6 );
+    ripemd_avx2_f5<13>( bbb, ccc, ddd, eee, aaa, x[ 9 ], 0x50a28be6 );
+    ripemd_avx2_f5<15>( aaa, bbb, ccc, ddd, eee, x[ 2 ], 0x50a28be6 );
+    ripemd_avx2_f5<15>( eee, aaa, bbb, ccc, ddd, x[ 11 ], 0x50a28be6 );
+    ripemd_avx2_f5<5>( ddd, eee, aaa, bbb, ccc, x[ 4 ], 0x50a28be6 );
+    ripemd_avx2_f5<7>( ccc, ddd, eee, aaa, bbb, x[ 13 ], 0x50a28be6 );
+    ripemd_avx2_f5<7>( bbb, ccc, ddd, eee, aaa, x[ 6 ], 0x50a28be6 );
+    ripemd_avx2_f5<8>( aaa, bbb, ccc, ddd, eee, x[ 15 ], 0x50a28be6 );
+    ripemd_avx2_f5<11>( eee, aaa, bbb, ccc, ddd, x[ 8 ], 0x50a28be6 );
+    ripemd_avx2_f5<14>( ddd, eee, aaa, bbb, ccc, x[ 1 ], 0x50a28be6 );
+    ripemd_avx2_f5<14>( ccc, ddd, eee, aaa, bbb, x[ 10 ], 0x50a28be6 );
+    ripemd_avx2_f5<12>( bbb, ccc, ddd, eee, aaa, x[ 3 ], 0x50a28be6 );
+    ripemd_avx2_f5<6>( aaa, bbb, ccc, ddd, eee, x[ 12 ], 0x50a28be6 );
+
+    ripemd_avx2_f2<7>( ee, aa, bb, cc, dd, x[ 7 ], 0x5a827999 );
+    ripemd_avx2_f2<6>( dd, ee, aa, bb, cc, x[ 4 ], 0x5a827999 );
+    ripemd_avx2_f2<8>( cc, dd, ee, aa, bb, x[ 13 ], 0x5a827999 );
+    ripemd_avx2_f2<13>( bb, cc, dd, ee, aa, x[ 1 ], 0x5a827999 );
+    ripemd_avx2_f2<11>( aa, bb, cc, dd, ee, x[ 10 ], 0x5a827999 );
+    ripemd_avx2_f2<9>( ee, aa, bb, cc, dd, x[ 6 ], 0x5a827999 );
+    ripemd_avx2_f2<7>( dd, ee, aa, bb, cc, x[ 15 ], 0x5a827999 );
+    ripemd_avx2_f2<15>( cc, dd, ee, aa, bb, x[ 3 ], 0x5a827999 );
+    ripemd_avx2_f2<7>( bb, cc, dd, ee, aa, x[ 12 ], 0x5a827999 );
+    ripemd_avx2_f2<12>( aa, bb, cc, dd, ee, x[ 0 ], 0x5a827999 );
+    ripemd_avx2_f2<15>( ee, aa, bb, cc, dd, x[ 9 ], 0x5a827999 );
+    ripemd_avx2_f2<9>( dd, ee, aa, bb, cc, x[ 5 ], 0x5a827999 );
+    ripemd_avx2_f2<11>( cc, dd, ee, aa, bb, x[ 2 ], 0x5a827999 );
+    ripemd_avx2_f2<7>( bb, cc, dd, ee, aa, x[ 14 ], 0x5a827999 );
+    ripemd_avx2_f2<13>( aa, bb, cc, dd, ee, x[ 11 ], 0x5a827999 );
+    ripemd_avx2_f2<12>( ee, aa, bb, cc, dd, x[ 8 ], 0x5a827999 );
+
+    ripemd_avx2_f4<9>( eee, aaa, bbb, ccc, ddd, x[ 6 ], 0x5c4dd124 );
+    ripemd_avx2_f4<13>( ddd, eee, aaa, bbb, ccc, x[ 11 ], 0x5c4dd124 );
+    ripemd_avx2_f4<15>( ccc, ddd, eee, aaa, bbb, x[ 3 ], 0x5c4dd124 );
+    ripemd_avx2_f4<7>( bbb, ccc, ddd, eee, aaa, x[ 7 ], 0x5c4dd124 );
+    ripemd_avx2_f4<12>( aaa, bbb, ccc, ddd, eee, x[ 0 ], 0x5c4dd124 );
+    ripemd_avx2_f4<8>( eee, aaa, bbb, ccc, ddd, x[ 13 ], 0x5c4dd124 );
+    ripemd_avx2_f4<9>( ddd, eee, aaa, bbb, ccc, x[ 5 ], 0x5c4dd124 );
+    ripemd_avx2_f4<11>( ccc, ddd, eee, aaa, bbb, x[ 10 ], 0x5c4dd124 );
+    ripemd_avx2_f4<7>( bbb, ccc, ddd, eee, aaa, x[ 14 ], 0x5c4dd124 );
+    ripemd_avx2_f4<7>( aaa, bbb, ccc, ddd, eee, x[ 15 ], 0x5c4dd124 );
+    ripemd_avx2_f4<12>( eee, aaa, bbb, ccc, ddd, x[ 8 ], 0x5c4dd124 );
+    ripemd_avx2_f4<7>( ddd, eee, aaa, bbb, ccc, x[ 12 ], 0x5c4dd124 );
+    ripemd_avx2_f4<6>( ccc, ddd, eee, aaa, bbb, x[ 4 ], 0x5c4dd124 );
+    ripemd_avx2_f4<15>( bbb, ccc, ddd, eee, aaa, x[ 9 ], 0x5c4dd124 );
+    ripemd_avx2_f4<13>( aaa, bbb, ccc, ddd, eee, x[ 1 ], 0x5c4dd124 );
+    ripemd_avx2_f4<11>( eee, aaa, bbb, ccc, ddd, x[ 2 ], 0x5c4dd124 );
+
+    ripemd_avx2_f3<11>( dd, ee, aa, bb, cc, x[ 3 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<13>( cc, dd, ee, aa, bb, x[ 10 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<6>( bb, cc, dd, ee, aa, x[ 14 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<7>( aa, bb, cc, dd, ee, x[ 4 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<14>( ee, aa, bb, cc, dd, x[ 9 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<9>( dd, ee, aa, bb, cc, x[ 15 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<13>( cc, dd, ee, aa, bb, x[ 8 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<15>( bb, cc, dd, ee, aa, x[ 1 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<14>( aa, bb, cc, dd, ee, x[ 2 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<8>( ee, aa, bb, cc, dd, x[ 7 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<13>( dd, ee, aa, bb, cc, x[ 0 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<6>( cc, dd, ee, aa, bb, x[ 6 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<5>( bb, cc, dd, ee, aa, x[ 13 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<12>( aa, bb, cc, dd, ee, x[ 11 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<7>( ee, aa, bb, cc, dd, x[ 5 ], 0x6ed9eba1 );
+    ripemd_avx2_f3<5>( dd, ee, aa, bb, cc, x[ 12 ], 0x6ed9eba1 );
+
+    ripemd_avx2_f3<9>( ddd, eee, aaa, bbb, ccc, x[ 15 ], 0x6d703ef3 );
+    ripemd_avx2_f3<7>( ccc, ddd, eee, aaa, bbb, x[ 5 ], 0x6d703ef3 );
+    ripemd_avx2_f3<15>( bbb, ccc, ddd, eee, aaa, x[ 1 ], 0x6d703ef3 );
+    ripemd_avx2_f3<11>( aaa, bbb, ccc, ddd, eee, x[ 3 ], 0x6d703ef3 );
+    ripemd_avx2_f3<8>( eee, aaa, bbb, ccc, ddd, x[ 7 ], 0x6d703ef3 );
+    ripemd_avx2_f3<6>( ddd, eee, aaa, bbb, ccc, x[ 14 ], 0x6d703ef3 );
+    ripemd_avx2_f3<6>( ccc, ddd, eee, aaa, bbb, x[ 6 ], 0x6d703ef3 );
+    ripemd_avx2_f3<14>( bbb, ccc, ddd, eee, aaa, x[ 9 ], 0x6d703ef3 );
+    ripemd_avx2_f3<12>( aaa, bbb, ccc, ddd, eee, x[ 11 ], 0x6d703ef3 );
+    ripemd_avx2_f3<13>( eee, aaa, bbb, ccc, ddd, x[ 8 ], 0x6d703ef3 );
+    ripemd_avx2_f3<5>( ddd, eee, aaa, bbb, ccc, x[ 12 ], 0x6d703ef3 );
+    ripemd_avx2_f3<14>( ccc, ddd, eee, aaa, bbb, x[ 2 ], 0x6d703ef3 );
+    ripemd_avx2_f3<13>( bbb, ccc, ddd, eee, aaa, x[ 10 ], 0x6d703ef3 );
+    ripemd_avx2_f3<13>( aaa, bbb, ccc, ddd, eee, x[ 0 ], 0x6d703ef3 );
+    ripemd_avx2_f3<7>( eee, aaa, bbb, ccc, ddd, x[ 4 ], 0x6d703ef3 );
+    ripemd_avx2_f3<5>( ddd, eee, aaa, bbb, ccc, x[ 13 ], 0x6d703ef3 );
+
+    ripemd_avx2_f4<11>( cc, dd, ee, aa, bb, x[ 1 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<12>( bb, cc, dd, ee, aa, x[ 9 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<14>( aa, bb, cc, dd, ee, x[ 11 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<15>( ee, aa, bb, cc, dd, x[ 10 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<14>( dd, ee, aa, bb, cc, x[ 0 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<15>( cc, dd, ee, aa, bb, x[ 8 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<9>( bb, cc, dd, ee, aa, x[ 12 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<8>( aa, bb, cc, dd, ee, x[ 4 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<9>( ee, aa, bb, cc, dd, x[ 13 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<14>( dd, ee, aa, bb, cc, x[ 3 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<5>( cc, dd, ee, aa, bb, x[ 7 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<6>( bb, cc, dd, ee, aa, x[ 15 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<8>( aa, bb, cc, dd, ee, x[ 14 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<6>( ee, aa, bb, cc, dd, x[ 5 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<5>( dd, ee, aa, bb, cc, x[ 6 ], 0x8f1bbcdc );
+    ripemd_avx2_f4<12>( cc, dd, ee, aa, bb, x[ 2 ], 0x8f1bbcdc );
+
+    ripemd_avx2_f2<15>( ccc, ddd, eee, aaa, bbb, x[ 8 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<5>( bbb, ccc, ddd, eee, aaa, x[ 6 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<8>( aaa, bbb, ccc, ddd, eee, x[ 4 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<11>( eee, aaa, bbb, ccc, ddd, x[ 1 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<14>( ddd, eee, aaa, bbb, ccc, x[ 3 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<14>( ccc, ddd, eee, aaa, bbb, x[ 11 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<6>( bbb, ccc, ddd, eee, aaa, x[ 15 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<14>( aaa, bbb, ccc, ddd, eee, x[ 0 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<6>( eee, aaa, bbb, ccc, ddd, x[ 5 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<9>( ddd, eee, aaa, bbb, ccc, x[ 12 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<12>( ccc, ddd, eee, aaa, bbb, x[ 2 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<9>( bbb, ccc, ddd, eee, aaa, x[ 13 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<12>( aaa, bbb, ccc, ddd, eee, x[ 9 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<5>( eee, aaa, bbb, ccc, ddd, x[ 7 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<15>( ddd, eee, aaa, bbb, ccc, x[ 10 ], 0x7a6d76e9 );
+    ripemd_avx2_f2<8>( ccc, ddd, eee, aaa, bbb, x[ 14 ], 0x7a6d76e9 );
+
+    ripemd_avx2_f5<9>( bb, cc, dd, ee, aa, x[ 4 ], 0xa953fd4e );
+    ripemd_avx2_f5<15>( aa, bb, cc, dd, ee, x[ 0 ], 0xa953fd4e );
+    ripemd_avx2_f5<5>( ee, aa, bb, cc, dd, x[ 5 ], 0xa953fd4e );
+    ripemd_avx2_f5<11>( dd, ee, aa, bb, cc, x[ 9 ], 0xa953fd4e );
+    ripemd_avx2_f5<6>( cc, dd, ee, aa, bb, x[ 7 ], 0xa953fd4e );
+    ripemd_avx2_f5<8>( bb, cc, dd, ee, aa, x[ 12 ], 0xa953fd4e );
+    ripemd_avx2_f5<13>( aa, bb, cc, dd, ee, x[ 2 ], 0xa953fd4e );
+    ripemd_avx2_f5<12>( ee, aa, bb, cc, dd, x[ 10 ], 0xa953fd4e );
+    ripemd_avx2_f5<5>( dd, ee, aa, bb, cc, x[ 14 ], 0xa953fd4e );
+    ripemd_avx2_f5<12>( cc, dd, ee, aa, bb, x[ 1 ], 0xa953fd4e );
+    ripemd_avx2_f5<13>( bb, cc, dd, ee, aa, x[ 3 ], 0xa953fd4e );
+    ripemd_avx2_f5<14>( aa, bb, cc, dd, ee, x[ 8 ], 0xa953fd4e );
+    ripemd_avx2_f5<11>( ee, aa, bb, cc, dd, x[ 11 ], 0xa953fd4e );
+    ripemd_avx2_f5<8>( dd, ee, aa, bb, cc, x[ 6 ], 0xa953fd4e );
+    ripemd_avx2_f5<5>( cc, dd, ee, aa, bb, x[ 15 ], 0xa953fd4e );
+    ripemd_avx2_f5<6>( bb, cc, dd, ee, aa, x[ 13 ], 0xa953fd4e );
+
+    ripemd_avx2_f1<8>( bbb, ccc, ddd, eee, aaa, x[ 12 ], 0x00000000 );
+    ripemd_avx2_f1<5>( aaa, bbb, ccc, ddd, eee, x[ 15 ], 0x00000000 );
+    ripemd_avx2_f1<12>( eee, aaa, bbb, ccc, ddd, x[ 10 ], 0x00000000 );
+    ripemd_avx2_f1<9>( ddd, eee, aaa, bbb, ccc, x[ 4 ], 0x00000000 );
+    ripemd_avx2_f1<12>( ccc, ddd, eee, aaa, bbb, x[ 1 ], 0x00000000 );
+    ripemd_avx2_f1<5>( bbb, ccc, ddd, eee, aaa, x[ 5 ], 0x00000000 );
+    ripemd_avx2_f1<14>( aaa, bbb, ccc, ddd, eee, x[ 8 ], 0x00000000 );
+    ripemd_avx2_f1<6>( eee, aaa, bbb, ccc, ddd, x[ 7 ], 0x00000000 );
+    ripemd_avx2_f1<8>( ddd, eee, aaa, bbb, ccc, x[ 6 ], 0x00000000 );
+    ripemd_avx2_f1<13>( ccc, ddd, eee, aaa, bbb, x[ 2 ], 0x00000000 );
+    ripemd_avx2_f1<6>( bbb, ccc, ddd, eee, aaa, x[ 13 ], 0x00000000 );
+    ripemd_avx2_f1<5>( aaa, bbb, ccc, ddd, eee, x[ 14 ], 0x00000000 );
+    ripemd_avx2_f1<15>( eee, aaa, bbb, ccc, ddd, x[ 0 ], 0x00000000 );
+    ripemd_avx2_f1<13>( ddd, eee, aaa, bbb, ccc, x[ 3 ], 0x00000000 );
+    ripemd_avx2_f1<11>( ccc, ddd, eee, aaa, bbb, x[ 9 ], 0x00000000 );
+    ripemd_avx2_f1<11>( bbb, ccc, ddd, eee, aaa, x[ 11 ], 0x00000000 );
+
+    ddd = _mm256_add_epi32( ddd, _mm256_add_epi32( cc, v[ 1 ] ) );
+
+    __m256i const r1 = _mm256_add_epi32( v[ 2 ], _mm256_add_epi32( dd, eee ) );
+    __m256i const r2 = _mm256_add_epi32( v[ 3 ], _mm256_add_epi32( ee, aaa ) );
+    __m256i const r3 = _mm256_add_epi32( v[ 4 ], _mm256_add_epi32( aa, bbb ) );
+    __m256i const r4 = _mm256_add_epi32( v[ 0 ], _mm256_add_epi32( bb, ccc ) );
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 0 * stride ), ddd );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 1 * stride ), r1 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 2 * stride ), r2 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 3 * stride ), r3 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + 4 * stride ), r4 );
+}
+
+// AVX-512; the round functions are single vpternlogd instructions,
+// and the rotations single vprold instructions
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE __m512i ripemd_avx512_rotl( __m512i x ) noexcept
+{
+    // the masked form doesn't read an undefined source, which GCC 12
+    // warns about under -Wuninitialized
+
+    return _mm512_mask_rol_epi32( x, 0xFFFF, x, S );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void ripemd_avx512_step( __m512i& a, __m512i /*b*/, __m512i& c, __m512i e, __m512i f, __m512i x, std::uint32_t k ) noexcept
+{
+    a = _mm512_add_epi32( _mm512_add_epi32( a, f ), _mm512_add_epi32( x, _mm512_set1_epi32( static_cast<int>( k ) ) ) );
+    a = _mm512_add_epi32( ripemd_avx512_rotl<S>( a ), e );
+    c = ripemd_avx512_rotl<10>( c );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void ripemd_avx512_f1( __m512i& a, __m512i b, __m512i& c, __m512i d, __m512i e, __m512i x, std::uint32_t k ) noexcept
+{
+    // b ^ c ^ d
+    ripemd_avx512_step<S>( a, b, c, e, _mm512_ternarylogic_epi32( b, c, d, 0x96 ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void ripemd_avx512_f2( __m512i& a, __m512i b, __m512i& c, __m512i d, __m512i e, __m512i x, std::uint32_t k ) noexcept
+{
+    // ( b & c ) | ( ~b & d )
+    ripemd_avx512_step<S>( a, b, c, e, _mm512_ternarylogic_epi32( b, c, d, 0xCA ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void ripemd_avx512_f3( __m512i& a, __m512i b, __m512i& c, __m512i d, __m512i e, __m512i x, std::uint32_t k ) noexcept
+{
+    // ( b | ~c ) ^ d
+    ripemd_avx512_step<S>( a, b, c, e, _mm512_ternarylogic_epi32( b, c, d, 0x59 ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void ripemd_avx512_f4( __m512i& a, __m512i b, __m512i& c, __m512i d, __m512i e, __m512i x, std::uint32_t k ) noexcept
+{
+    // ( b & d ) | ( c & ~d )
+    ripemd_avx512_step<S>( a, b, c, e, _mm512_ternarylogic_epi32( b, c, d, 0xE4 ), x, k );
+}
+
+template<int S>
+BOOST_HASH2_TARGET("avx512f")
+BOOST_FORCEINLINE void ripemd_avx512_f5( __m512i& a, __m512i b, __m512i& c, __m512i d, __m512i e, __m512i x, std::uint32_t k ) noexcept
+{
+    // b ^ ( c | ~d )
+    ripemd_avx512_step<S>( a, b, c, e, _mm512_ternarylogic_epi32( b, c, d, 0x2D ), x, k );
+}
+
+BOOST_HASH2_TARGET("avx512f")
+inline void ripemd_160_transform_avx512( unsigned char const* const block[ 16 ], std::uint32_t* st, std::size_t stride ) noexcept
+{
+    __m512i x[ 16 ];
+    lanes_load_avx512( block, x );
+
+    __m512i v[ 5 ];
+
+    for( int i = 0; i < 5; ++i )
+    {
+        v[ i ] = _mm512_loadu_si512( st + i * stride );
+    }
+
+    __m512i aa = v[ 0 ], bb = v[ 1 ], cc = v[ 2 ], dd = v[ 3 ], ee = v[ 4 ];
+    __m512i aaa = v[ 0 ], bbb = v[ 1 ], ccc = v[ 2 ], ddd = v[ 3 ], eee = v[ 4 ];
+
+    ripemd_avx512_f1<11>( aa, bb, cc, dd, ee, x[ 0 ], 0x00000000 );
+    ripemd_avx512_f1<14>( ee, aa, bb, cc, dd, x[ 1 ], 0x00000000 );
+    ripemd_avx512_f1<15>( dd, ee, aa, bb, cc, x[ 2 ], 0x00000000 );
+    ripemd_avx512_f1<12>( cc, dd, ee, aa, bb, x[ 3 ], 0x00000000 );
+    ripemd_avx512_f1<5>( bb, cc, dd, ee, aa, x[ 4 ], 0x00000000 );
+    ripemd_avx512_f1<8>( aa, bb, cc, dd, ee, x[ 5 ], 0x00000000 );
+    ripemd_avx512_f1<7>( ee, aa, bb, cc, dd, x[ 6 ], 0x00000000 );
+    ripemd_avx512_f1<9>( dd, ee, aa, bb, cc, x[ 7 ], 0x00000000 );
+    ripemd_avx512_f1<11>( cc, dd, ee, aa, bb, x[ 8 ], 0x00000000 );
+    ripemd_avx512_f1<13>( bb, cc, dd, ee, aa, x[ 9 ], 0x00000000 );
+    ripemd_avx512_f1<14>( aa, bb, cc, dd, ee, x[ 10 ], 0x00000000 );
+    ripemd_avx512_f1<15>( ee, aa, bb, cc, dd, x[ 11 ], 0x00000000 );
+    ripemd_avx512_f1<6>( dd, ee, aa, bb, cc, x[ 12 ], 0x00000000 );
+    ripemd_avx512_f1<7>( cc, dd, ee, aa, bb, x[ 13 ], 0x00000000 );
+    ripemd_avx512_f1<9>( bb, cc, dd, ee, aa, x[ 14 ], 0x00000000 );
+    ripemd_avx512_f1<8>( aa, bb, cc, dd, ee, x[ 15 ], 0x00000000 );
+
+    ripemd_avx512_f5<8>( aaa, bbb, ccc, ddd, eee, x[ 5 ], 0x50a28be6 );
+    ripemd_avx512_f5<9>( eee, aaa, bbb, ccc, ddd, x[ 14 ], 0x50a28be6 );
+    ripemd_avx512_f5<9>( ddd, eee, aaa, bbb, ccc, x[ 7 ], 0x50a28be6 );
+    ripemd_avx512_f5<11>( ccc, ddd, eee, aaa, bbb, x[ 0 ], 0x50a28be6 );
+    ripemd_avx512_f5<13>( bbb, ccc, ddd, eee, aaa, x[ 9 ], 0x50a28be6 );
+    ripemd_avx512_f5<15>( aaa, bbb, ccc, ddd, eee, x[ 2 ], 0x50a28be6 );
+    ripemd_avx512_f5<15>( eee, aaa, bbb, ccc, ddd, x[ 11 ], 0x50a28be6 );
+    ripemd_avx512_f5<5>( ddd, eee, aaa, bbb, ccc, x[ 4 ], 0x50a28be6 );
+    ripemd_avx512_f5<7>( ccc, ddd, eee, aaa, bbb, x[ 13 ], 0x50a28be6 );
+    ripemd_avx512_f5<7>( bbb, ccc, ddd, eee, aaa, x[ 6 ], 0x50a28be6 );
+    ripemd_avx512_f5<8>( aaa, bbb, ccc, ddd, eee, x[ 15 ], 0x50a28be6 );
+    ripemd_avx512_f5<11>( eee, aaa, bbb, ccc, ddd, x[ 8 ], 0x50a28be6 );
+    ripemd_avx512_f5<14>( ddd, eee, aaa, bbb, ccc, x[ 1 ], 0x50a28be6 );
+    ripemd_avx512_f5<14>( ccc, ddd, eee, aaa, bbb, x[ 10 ], 0x50a28be6 );
+    ripemd_avx512_f5<12>( bbb, ccc, ddd, eee, aaa, x[ 3 ], 0x50a28be6 );
+    ripemd_avx512_f5<6>( aaa, bbb, ccc, ddd, eee, x[ 12 ], 0x50a28be6 );
+
+    ripemd_avx512_f2<7>( ee, aa, bb, cc, dd, x[ 7 ], 0x5a827999 );
+    ripemd_avx512_f2<6>( dd, ee, aa, bb, cc, x[ 4 ], 0x5a827999 );
+    ripemd_avx512_f2<8>( cc, dd, ee, aa, bb, x[ 13 ], 0x5a827999 );
+    ripemd_avx512_f2<13>( bb, cc, dd, ee, aa, x[ 1 ], 0x5a827999 );
+    ripemd_avx512_f2<11>( aa, bb, cc, dd, ee, x[ 10 ], 0x5a827999 );
+    ripemd_avx512_f2<9>( ee, aa, bb, cc, dd, x[ 6 ], 0x5a827999 );
+    ripemd_avx512_f2<7>( dd, ee, aa, bb, cc, x[ 15 ], 0x5a827999 );
+    ripemd_avx512_f2<15>( cc, dd, ee, aa, bb, x[ 3 ], 0x5a827999 );
+    ripemd_avx512_f2<7>( bb, cc, dd, ee, aa, x[ 12 ], 0x5a827999 );
+    ripemd_avx512_f2<12>( aa, bb, cc, dd, ee, x[ 0 ], 0x5a827999 );
+    ripemd_avx512_f2<15>( ee, aa, bb, cc, dd, x[ 9 ], 0x5a827999 );
+    ripemd_avx512_f2<9>( dd, ee, aa, bb, cc, x[ 5 ], 0x5a827999 );
+    ripemd_avx512_f2<11>( cc, dd, ee, aa, bb, x[ 2 ], 0x5a827999 );
+    ripemd_avx512_f2<7>( bb, cc, dd, ee, aa, x[ 14 ], 0x5a827999 );
+    ripemd_avx512_f2<13>( aa, bb, cc, dd, ee, x[ 11 ], 0x5a827999 );
+    ripemd_avx512_f2<12>( ee, aa, bb, cc, dd, x[ 8 ], 0x5a827999 );
+
+    ripemd_avx512_f4<9>( eee, aaa, bbb, ccc, ddd, x[ 6 ], 0x5c4dd124 );
+    ripemd_avx512_f4<13>( ddd, eee, aaa, bbb, ccc, x[ 11 ], 0x5c4dd124 );
+    ripemd_avx512_f4<15>( ccc, ddd, eee, aaa, bbb, x[ 3 ], 0x5c4dd124 );
+    ripemd_avx512_f4<7>( bbb, ccc, ddd, eee, aaa, x[ 7 ], 0x5c4dd124 );
+    ripemd_avx512_f4<12>( aaa, bbb, ccc, ddd, eee, x[ 0 ], 0x5c4dd124 );
+    ripemd_avx512_f4<8>( eee, aaa, bbb, ccc, ddd, x[ 13 ], 0x5c4dd124 );
+    ripemd_avx512_f4<9>( ddd, eee, aaa, bbb, ccc, x[ 5 ], 0x5c4dd124 );
+    ripemd_avx512_f4<11>( ccc, ddd, eee, aaa, bbb, x[ 10 ], 0x5c4dd124 );
+    ripemd_avx512_f4<7>( bbb, ccc, ddd, eee, aaa, x[ 14 ], 0x5c4dd124 );
+    ripemd_avx512_f4<7>( aaa, bbb, ccc, ddd, eee, x[ 15 ], 0x5c4dd124 );
+    ripemd_avx512_f4<12>( eee, aaa, bbb, ccc, ddd, x[ 8 ], 0x5c4dd124 );
+    ripemd_avx512_f4<7>( ddd, eee, aaa, bbb, ccc, x[ 12 ], 0x5c4dd124 );
+    ripemd_avx512_f4<6>( ccc, ddd, eee, aaa, bbb, x[ 4 ], 0x5c4dd124 );
+    ripemd_avx512_f4<15>( bbb, ccc, ddd, eee, aaa, x[ 9 ], 0x5c4dd124 );
+    ripemd_avx512_f4<13>( aaa, bbb, ccc, ddd, eee, x[ 1 ], 0x5c4dd124 );
+    ripemd_avx512_f4<11>( eee, aaa, bbb, ccc, ddd, x[ 2 ], 0x5c4dd124 );
+
+    ripemd_avx512_f3<11>( dd, ee, aa, bb, cc, x[ 3 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<13>( cc, dd, ee, aa, bb, x[ 10 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<6>( bb, cc, dd, ee, aa, x[ 14 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<7>( aa, bb, cc, dd, ee, x[ 4 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<14>( ee, aa, bb, cc, dd, x[ 9 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<9>( dd, ee, aa, bb, cc, x[ 15 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<13>( cc, dd, ee, aa, bb, x[ 8 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<15>( bb, cc, dd, ee, aa, x[ 1 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<14>( aa, bb, cc, dd, ee, x[ 2 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<8>( ee, aa, bb, cc, dd, x[ 7 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<13>( dd, ee, aa, bb, cc, x[ 0 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<6>( cc, dd, ee, aa, bb, x[ 6 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<5>( bb, cc, dd, ee, aa, x[ 13 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<12>( aa, bb, cc, dd, ee, x[ 11 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<7>( ee, aa, bb, cc, dd, x[ 5 ], 0x6ed9eba1 );
+    ripemd_avx512_f3<5>( dd, ee, aa, bb, cc, x[ 12 ], 0x6ed9eba1 );
+
+    ripemd_avx512_f3<9>( ddd, eee, aaa, bbb, ccc, x[ 15 ], 0x6d703ef3 );
+    ripemd_avx512_f3<7>( ccc, ddd, eee, aaa, bbb, x[ 5 ], 0x6d703ef3 );
+    ripemd_avx512_f3<15>( bbb, ccc, ddd, eee, aaa, x[ 1 ], 0x6d703ef3 );
+    ripemd_avx512_f3<11>( aaa, bbb, ccc, ddd, eee, x[ 3 ], 0x6d703ef3 );
+    ripemd_avx512_f3<8>( eee, aaa, bbb, ccc, ddd, x[ 7 ], 0x6d703ef3 );
+    ripemd_avx512_f3<6>( ddd, eee, aaa, bbb, ccc, x[ 14 ], 0x6d703ef3 );
+    ripemd_avx512_f3<6>( ccc, ddd, eee, aaa, bbb, x[ 6 ], 0x6d703ef3 );
+    ripemd_avx512_f3<14>( bbb, ccc, ddd, eee, aaa, x[ 9 ], 0x6d703ef3 );
+    ripemd_avx512_f3<12>( aaa, bbb, ccc, ddd, eee, x[ 11 ], 0x6d703ef3 );
+    ripemd_avx512_f3<13>( eee, aaa, bbb, ccc, ddd, x[ 8 ], 0x6d703ef3 );
+    ripemd_avx512_f3<5>( ddd, eee, aaa, bbb, ccc, x[ 12 ], 0x6d703ef3 );
+    ripemd_avx512_f3<14>( ccc, ddd, eee, aaa, bbb, x[ 2 ], 0x6d703ef3 );
+    ripemd_avx512_f3<13>( bbb, ccc, ddd, eee, aaa, x[ 10 ], 0x6d703ef3 );
+    ripemd_avx512_f3<13>( aaa, bbb, ccc, ddd, eee, x[ 0 ], 0x6d703ef3 );
+    ripemd_avx512_f3<7>( eee, aaa, bbb, ccc, ddd, x[ 4 ], 0x6d703ef3 );
+    ripemd_avx512_f3<5>( ddd, eee, aaa, bbb, ccc, x[ 13 ], 0x6d703ef3 );
+
+    ripemd_avx512_f4<11>( cc, dd, ee, aa, bb, x[ 1 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<12>( bb, cc, dd, ee, aa, x[ 9 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<14>( aa, bb, cc, dd, ee, x[ 11 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<15>( ee, aa, bb, cc, dd, x[ 10 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<14>( dd, ee, aa, bb, cc, x[ 0 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<15>( cc, dd, ee, aa, bb, x[ 8 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<9>( bb, cc, dd, ee, aa, x[ 12 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<8>( aa, bb, cc, dd, ee, x[ 4 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<9>( ee, aa, bb, cc, dd, x[ 13 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<14>( dd, ee, aa, bb, cc, x[ 3 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<5>( cc, dd, ee, aa, bb, x[ 7 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<6>( bb, cc, dd, ee, aa, x[ 15 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<8>( aa, bb, cc, dd, ee, x[ 14 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<6>( ee, aa, bb, cc, dd, x[ 5 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<5>( dd, ee, aa, bb, cc, x[ 6 ], 0x8f1bbcdc );
+    ripemd_avx512_f4<12>( cc, dd, ee, aa, bb, x[ 2 ], 0x8f1bbcdc );
+
+    ripemd_avx512_f2<15>( ccc, ddd, eee, aaa, bbb, x[ 8 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<5>( bbb, ccc, ddd, eee, aaa, x[ 6 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<8>( aaa, bbb, ccc, ddd, eee, x[ 4 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<11>( eee, aaa, bbb, ccc, ddd, x[ 1 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<14>( ddd, eee, aaa, bbb, ccc, x[ 3 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<14>( ccc, ddd, eee, aaa, bbb, x[ 11 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<6>( bbb, ccc, ddd, eee, aaa, x[ 15 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<14>( aaa, bbb, ccc, ddd, eee, x[ 0 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<6>( eee, aaa, bbb, ccc, ddd, x[ 5 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<9>( ddd, eee, aaa, bbb, ccc, x[ 12 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<12>( ccc, ddd, eee, aaa, bbb, x[ 2 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<9>( bbb, ccc, ddd, eee, aaa, x[ 13 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<12>( aaa, bbb, ccc, ddd, eee, x[ 9 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<5>( eee, aaa, bbb, ccc, ddd, x[ 7 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<15>( ddd, eee, aaa, bbb, ccc, x[ 10 ], 0x7a6d76e9 );
+    ripemd_avx512_f2<8>( ccc, ddd, eee, aaa, bbb, x[ 14 ], 0x7a6d76e9 );
+
+    ripemd_avx512_f5<9>( bb, cc, dd, ee, aa, x[ 4 ], 0xa953fd4e );
+    ripemd_avx512_f5<15>( aa, bb, cc, dd, ee, x[ 0 ], 0xa953fd4e );
+    ripemd_avx512_f5<5>( ee, aa, bb, cc, dd, x[ 5 ], 0xa953fd4e );
+    ripemd_avx512_f5<11>( dd, ee, aa, bb, cc, x[ 9 ], 0xa953fd4e );
+    ripemd_avx512_f5<6>( cc, dd, ee, aa, bb, x[ 7 ], 0xa953fd4e );
+    ripemd_avx512_f5<8>( bb, cc, dd, ee, aa, x[ 12 ], 0xa953fd4e );
+    ripemd_avx512_f5<13>( aa, bb, cc, dd, ee, x[ 2 ], 0xa953fd4e );
+    ripemd_avx512_f5<12>( ee, aa, bb, cc, dd, x[ 10 ], 0xa953fd4e );
+    ripemd_avx512_f5<5>( dd, ee, aa, bb, cc, x[ 14 ], 0xa953fd4e );
+    ripemd_avx512_f5<12>( cc, dd, ee, aa, bb, x[ 1 ], 0xa953fd4e );
+    ripemd_avx512_f5<13>( bb, cc, dd, ee, aa, x[ 3 ], 0xa953fd4e );
+    ripemd_avx512_f5<14>( aa, bb, cc, dd, ee, x[ 8 ], 0xa953fd4e );
+    ripemd_avx512_f5<11>( ee, aa, bb, cc, dd, x[ 11 ], 0xa953fd4e );
+    ripemd_avx512_f5<8>( dd, ee, aa, bb, cc, x[ 6 ], 0xa953fd4e );
+    ripemd_avx512_f5<5>( cc, dd, ee, aa, bb, x[ 15 ], 0xa953fd4e );
+    ripemd_avx512_f5<6>( bb, cc, dd, ee, aa, x[ 13 ], 0xa953fd4e );
+
+    ripemd_avx512_f1<8>( bbb, ccc, ddd, eee, aaa, x[ 12 ], 0x00000000 );
+    ripemd_avx512_f1<5>( aaa, bbb, ccc, ddd, eee, x[ 15 ], 0x00000000 );
+    ripemd_avx512_f1<12>( eee, aaa, bbb, ccc, ddd, x[ 10 ], 0x00000000 );
+    ripemd_avx512_f1<9>( ddd, eee, aaa, bbb, ccc, x[ 4 ], 0x00000000 );
+    ripemd_avx512_f1<12>( ccc, ddd, eee, aaa, bbb, x[ 1 ], 0x00000000 );
+    ripemd_avx512_f1<5>( bbb, ccc, ddd, eee, aaa, x[ 5 ], 0x00000000 );
+    ripemd_avx512_f1<14>( aaa, bbb, ccc, ddd, eee, x[ 8 ], 0x00000000 );
+    ripemd_avx512_f1<6>( eee, aaa, bbb, ccc, ddd, x[ 7 ], 0x00000000 );
+    ripemd_avx512_f1<8>( ddd, eee, aaa, bbb, ccc, x[ 6 ], 0x00000000 );
+    ripemd_avx512_f1<13>( ccc, ddd, eee, aaa, bbb, x[ 2 ], 0x00000000 );
+    ripemd_avx512_f1<6>( bbb, ccc, ddd, eee, aaa, x[ 13 ], 0x00000000 );
+    ripemd_avx512_f1<5>( aaa, bbb, ccc, ddd, eee, x[ 14 ], 0x00000000 );
+    ripemd_avx512_f1<15>( eee, aaa, bbb, ccc, ddd, x[ 0 ], 0x00000000 );
+    ripemd_avx512_f1<13>( ddd, eee, aaa, bbb, ccc, x[ 3 ], 0x00000000 );
+    ripemd_avx512_f1<11>( ccc, ddd, eee, aaa, bbb, x[ 9 ], 0x00000000 );
+    ripemd_avx512_f1<11>( bbb, ccc, ddd, eee, aaa, x[ 11 ], 0x00000000 );
+
+    ddd = _mm512_add_epi32( ddd, _mm512_add_epi32( cc, v[ 1 ] ) );
+
+    __m512i const r1 = _mm512_add_epi32( v[ 2 ], _mm512_add_epi32( dd, eee ) );
+    __m512i const r2 = _mm512_add_epi32( v[ 3 ], _mm512_add_epi32( ee, aaa ) );
+    __m512i const r3 = _mm512_add_epi32( v[ 4 ], _mm512_add_epi32( aa, bbb ) );
+    __m512i const r4 = _mm512_add_epi32( v[ 0 ], _mm512_add_epi32( bb, ccc ) );
+
+    _mm512_storeu_si512( st + 0 * stride, ddd );
+    _mm512_storeu_si512( st + 1 * stride, r1 );
+    _mm512_storeu_si512( st + 2 * stride, r2 );
+    _mm512_storeu_si512( st + 3 * stride, r3 );
+    _mm512_storeu_si512( st + 4 * stride, r4 );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_RIPEMD_X86_HPP_INCLUDED
@@ -15,6 +15,11 @@ namespace hash2
 namespace detail
 {
 
+// These expressions are recognized as rotates, and compiled to a single
+// instruction where the target has one: on x86 and ARM, and on RISC-V when
+// the Zbb or Zbkb extension is enabled (e.g. -march=rv64gc_zbb). Without
+// one, RISC-V has no rotate, and the shifts are all there is.
+
 // k must not be 0
 BOOST_FORCEINLINE constexpr std::uint32_t rotl( std::uint32_t v, int k ) noexcept
 {
@@ -0,0 +1,189 @@
+#ifndef BOOST_HASH2_DETAIL_SHA_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_SHA_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SHA-1, SHA-256 and SHA-512 compression using the ARMv8 cryptography extensions
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+
+#if defined(BOOST_HASH2_HAS_ARM_SHA2_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The ARM code paths are enabled at compile time, when the target
+// architecture includes the SHA2 extension (e.g. -march=armv8-a+crypto)
+
+// SHA-1
+
+inline void sha1_transform_arm( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] ) noexcept
+{
+    uint32x4_t abcd = vld1q_u32( state );
+    std::uint32_t e = state[ 4 ];
+
+    uint32x4_t const abcd_0 = abcd;
+    std::uint32_t const e_0 = e;
+
+    uint32x4_t w[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        w[ i ] = vreinterpretq_u32_u8( vrev32q_u8( vld1q_u8( block + i * 16 ) ) );
+    }
+
+    // 20 groups of 4 rounds; w[ i & 3 ] holds W[ 4*i .. 4*i+3 ]
+    // and is replaced by W[ 4*i+16 .. 4*i+19 ] when no longer needed
+
+    for( int i = 0; i < 20; ++i )
+    {
+        std::uint32_t const K[] = { 0x5A827999, 0x6ED9EBA1, 0x8F1BBCDC, 0xCA62C1D6 };
+
+        uint32x4_t k = vaddq_u32( w[ i & 3 ], vdupq_n_u32( K[ i / 5 ] ) );
+
+        std::uint32_t e2 = vsha1h_u32( vgetq_lane_u32( abcd, 0 ) );
+
+        if( i < 5 )
+        {
+            abcd = vsha1cq_u32( abcd, e, k );
+        }
+        else if( i >= 10 && i < 15 )
+        {
+            abcd = vsha1mq_u32( abcd, e, k );
+        }
+        else
+        {
+            abcd = vsha1pq_u32( abcd, e, k );
+        }
+
+        e = e2;
+
+        if( i < 16 )
+        {
+            w[ i & 3 ] = vsha1su1q_u32( vsha1su0q_u32( w[ i & 3 ], w[ ( i + 1 ) & 3 ], w[ ( i + 2 ) & 3 ] ), w[ ( i + 3 ) & 3 ] );
+        }
+    }
+
+    vst1q_u32( state, vaddq_u32( abcd, abcd_0 ) );
+    state[ 4 ] = e + e_0;
+}
+
+// SHA-256
+
+// K points to the 64 SHA-256 round constants
+
+inline void sha2_256_transform_arm( unsigned char const block[ 64 ], std::uint32_t state[ 8 ], std::uint32_t const* K ) noexcept
+{
+    uint32x4_t s0 = vld1q_u32( state + 0 );
+    uint32x4_t s1 = vld1q_u32( state + 4 );
+
+    uint32x4_t const abcd = s0;
+    uint32x4_t const efgh = s1;
+
+    uint32x4_t w[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        w[ i ] = vreinterpretq_u32_u8( vrev32q_u8( vld1q_u8( block + i * 16 ) ) );
+    }
+
+    // 16 groups of 4 rounds; w[ i & 3 ] holds W[ 4*i .. 4*i+3 ]
+    // and is replaced by W[ 4*i+16 .. 4*i+19 ] when no longer needed
+
+    for( int i = 0; i < 16; ++i )
+    {
+        uint32x4_t k = vaddq_u32( w[ i & 3 ], vld1q_u32( K + i * 4 ) );
+
+        if( i < 12 )
+        {
+            w[ i & 3 ] = vsha256su0q_u32( w[ i & 3 ], w[ ( i + 1 ) & 3 ] );
+        }
+
+        uint32x4_t t = s0;
+
+        s0 = vsha256hq_u32( s0, s1, k );
+        s1 = vsha256h2q_u32( s1, t, k );
+
+        if( i < 12 )
+        {
+            w[ i & 3 ] = vsha256su1q_u32( w[ i & 3 ], w[ ( i + 2 ) & 3 ], w[ ( i + 3 ) & 3 ] );
+        }
+    }
+
+    vst1q_u32( state + 0, vaddq_u32( s0, abcd ) );
+    vst1q_u32( state + 4, vaddq_u32( s1, efgh ) );
+}
+
+#if defined(BOOST_HASH2_HAS_ARM_SHA512_INTRINSICS)
+
+// SHA-512, using the ARMv8.2 SHA512 extension (e.g. -march=armv8.2-a+sha3)
+
+// K points to the 80 SHA-512 round constants
+
+inline void sha2_512_transform_arm( unsigned char const block[ 128 ], std::uint64_t state[ 8 ], std::uint64_t const* K ) noexcept
+{
+    uint64x2_t ab = vld1q_u64( state + 0 );
+    uint64x2_t cd = vld1q_u64( state + 2 );
+    uint64x2_t ef = vld1q_u64( state + 4 );
+    uint64x2_t gh = vld1q_u64( state + 6 );
+
+    uint64x2_t const ab0 = ab;
+    uint64x2_t const cd0 = cd;
+    uint64x2_t const ef0 = ef;
+    uint64x2_t const gh0 = gh;
+
+    uint64x2_t w[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        w[ i ] = vreinterpretq_u64_u8( vrev64q_u8( vld1q_u8( block + i * 16 ) ) );
+    }
+
+    // 40 groups of 2 rounds; w[ i & 7 ] holds W[ 2*i .. 2*i+1 ]
+    // and is replaced by W[ 2*i+16 .. 2*i+17 ] when no longer needed
+
+    for( int i = 0; i < 40; ++i )
+    {
+        uint64x2_t k = vaddq_u64( w[ i & 7 ], vld1q_u64( K + i * 2 ) );
+
+        if( i < 32 )
+        {
+            w[ i & 7 ] = vsha512su1q_u64( vsha512su0q_u64( w[ i & 7 ], w[ ( i + 1 ) & 7 ] ), w[ ( i + 7 ) & 7 ], vextq_u64( w[ ( i + 4 ) & 7 ], w[ ( i + 5 ) & 7 ], 1 ) );
+        }
+
+        uint64x2_t t = vsha512hq_u64( vaddq_u64( vextq_u64( k, k, 1 ), gh ), vextq_u64( ef, gh, 1 ), vextq_u64( cd, ef, 1 ) );
+
+        uint64x2_t u = vsha512h2q_u64( t, cd, ab );
+
+        // the two rounds shift the state by two words
+
+        gh = ef;
+        ef = vaddq_u64( cd, t );
+        cd = ab;
+        ab = u;
+    }
+
+    vst1q_u64( state + 0, vaddq_u64( ab, ab0 ) );
+    vst1q_u64( state + 2, vaddq_u64( cd, cd0 ) );
+    vst1q_u64( state + 4, vaddq_u64( ef, ef0 ) );
+    vst1q_u64( state + 6, vaddq_u64( gh, gh0 ) );
+}
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_SHA512_INTRINSICS)
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_SHA2_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_SHA_ARM_HPP_INCLUDED
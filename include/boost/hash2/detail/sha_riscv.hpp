@@ -0,0 +1,161 @@
+#ifndef BOOST_HASH2_DETAIL_SHA_RISCV_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_SHA_RISCV_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SHA-256 and SHA-512 compression using the RISC-V vector cryptography
+// extensions Zvknha and Zvknhb
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_RISCV_ZVKNHA_INTRINSICS)
+
+#include <riscv_vector.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The RISC-V code paths are enabled at compile time, when the target
+// architecture includes the extensions (e.g. -march=rv64gcv_zvknhb)
+//
+// vsha2cl and vsha2ch perform two rounds each, on the state held as
+// {f, e, b, a} and {h, g, d, c}, in element order, with the message
+// words plus round constants in elements 0, 1 and 2, 3 of their last
+// operand; vsha2ms computes the next four message words from the
+// previous sixteen
+
+// SHA-256
+
+inline void sha2_256_transform_riscv( unsigned char const block[ 64 ], std::uint32_t state[ 8 ], std::uint32_t const* K ) noexcept
+{
+    std::size_t const vl = 4;
+
+    std::uint32_t tmp[ 16 ] = { state[ 5 ], state[ 4 ], state[ 1 ], state[ 0 ], state[ 7 ], state[ 6 ], state[ 3 ], state[ 2 ] };
+
+    vuint32m1_t const abef_0 = __riscv_vle32_v_u32m1( tmp + 0, vl );
+    vuint32m1_t const cdgh_0 = __riscv_vle32_v_u32m1( tmp + 4, vl );
+
+    vuint32m1_t abef = abef_0;
+    vuint32m1_t cdgh = cdgh_0;
+
+    for( int i = 0; i < 16; ++i )
+    {
+        tmp[ i ] = detail::read32be( block + i * 4 );
+    }
+
+    vuint32m1_t w[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        w[ i ] = __riscv_vle32_v_u32m1( tmp + i * 4, vl );
+    }
+
+    // selects element 0
+    vbool32_t const m0 = __riscv_vmseq_vx_u32m1_b32( __riscv_vid_v_u32m1( vl ), 0, vl );
+
+    for( int i = 0; i < 16; ++i )
+    {
+        vuint32m1_t kw = __riscv_vadd_vv_u32m1( w[ i & 3 ], __riscv_vle32_v_u32m1( K + i * 4, vl ), vl );
+
+        // the two halves of the state swap places after two rounds
+        cdgh = __riscv_vsha2cl_vv_u32m1( cdgh, abef, kw, vl );
+        abef = __riscv_vsha2ch_vv_u32m1( abef, cdgh, kw, vl );
+
+        if( i < 12 )
+        {
+            // { W[ 4 ], W[ 9 ], W[ 10 ], W[ 11 ] }, relative to w[ i & 3 ]
+            vuint32m1_t t = __riscv_vmerge_vvm_u32m1( w[ ( i + 2 ) & 3 ], w[ ( i + 1 ) & 3 ], m0, vl );
+
+            w[ i & 3 ] = __riscv_vsha2ms_vv_u32m1( w[ i & 3 ], t, w[ ( i + 3 ) & 3 ], vl );
+        }
+    }
+
+    __riscv_vse32_v_u32m1( tmp + 0, __riscv_vadd_vv_u32m1( abef, abef_0, vl ), vl );
+    __riscv_vse32_v_u32m1( tmp + 4, __riscv_vadd_vv_u32m1( cdgh, cdgh_0, vl ), vl );
+
+    state[ 0 ] = tmp[ 3 ];
+    state[ 1 ] = tmp[ 2 ];
+    state[ 2 ] = tmp[ 7 ];
+    state[ 3 ] = tmp[ 6 ];
+    state[ 4 ] = tmp[ 1 ];
+    state[ 5 ] = tmp[ 0 ];
+    state[ 6 ] = tmp[ 5 ];
+    state[ 7 ] = tmp[ 4 ];
+}
+
+#if defined(BOOST_HASH2_HAS_RISCV_ZVKNHB_INTRINSICS)
+
+// SHA-512; four 64 bit elements take two registers at VLEN=128
+
+inline void sha2_512_transform_riscv( unsigned char const block[ 128 ], std::uint64_t state[ 8 ], std::uint64_t const* K ) noexcept
+{
+    std::size_t const vl = 4;
+
+    std::uint64_t tmp[ 16 ] = { state[ 5 ], state[ 4 ], state[ 1 ], state[ 0 ], state[ 7 ], state[ 6 ], state[ 3 ], state[ 2 ] };
+
+    vuint64m2_t const abef_0 = __riscv_vle64_v_u64m2( tmp + 0, vl );
+    vuint64m2_t const cdgh_0 = __riscv_vle64_v_u64m2( tmp + 4, vl );
+
+    vuint64m2_t abef = abef_0;
+    vuint64m2_t cdgh = cdgh_0;
+
+    for( int i = 0; i < 16; ++i )
+    {
+        tmp[ i ] = detail::read64be( block + i * 8 );
+    }
+
+    vuint64m2_t w[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        w[ i ] = __riscv_vle64_v_u64m2( tmp + i * 4, vl );
+    }
+
+    vbool32_t const m0 = __riscv_vmseq_vx_u64m2_b32( __riscv_vid_v_u64m2( vl ), 0, vl );
+
+    for( int i = 0; i < 20; ++i )
+    {
+        vuint64m2_t kw = __riscv_vadd_vv_u64m2( w[ i & 3 ], __riscv_vle64_v_u64m2( K + i * 4, vl ), vl );
+
+        cdgh = __riscv_vsha2cl_vv_u64m2( cdgh, abef, kw, vl );
+        abef = __riscv_vsha2ch_vv_u64m2( abef, cdgh, kw, vl );
+
+        if( i < 16 )
+        {
+            vuint64m2_t t = __riscv_vmerge_vvm_u64m2( w[ ( i + 2 ) & 3 ], w[ ( i + 1 ) & 3 ], m0, vl );
+
+            w[ i & 3 ] = __riscv_vsha2ms_vv_u64m2( w[ i & 3 ], t, w[ ( i + 3 ) & 3 ], vl );
+        }
+    }
+
+    __riscv_vse64_v_u64m2( tmp + 0, __riscv_vadd_vv_u64m2( abef, abef_0, vl ), vl );
+    __riscv_vse64_v_u64m2( tmp + 4, __riscv_vadd_vv_u64m2( cdgh, cdgh_0, vl ), vl );
+
+    state[ 0 ] = tmp[ 3 ];
+    state[ 1 ] = tmp[ 2 ];
+    state[ 2 ] = tmp[ 7 ];
+    state[ 3 ] = tmp[ 6 ];
+    state[ 4 ] = tmp[ 1 ];
+    state[ 5 ] = tmp[ 0 ];
+    state[ 6 ] = tmp[ 5 ];
+    state[ 7 ] = tmp[ 4 ];
+}
+
+#endif // #if defined(BOOST_HASH2_HAS_RISCV_ZVKNHB_INTRINSICS)
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_RISCV_ZVKNHA_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_SHA_RISCV_HPP_INCLUDED
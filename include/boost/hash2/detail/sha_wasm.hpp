@@ -0,0 +1,156 @@
+#ifndef BOOST_HASH2_DETAIL_SHA_WASM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_SHA_WASM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SHA-256, four independent messages in the 32 bit lanes of a
+// WebAssembly SIMD128 register
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+#include <wasm_simd128.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<int k>
+BOOST_FORCEINLINE v128_t sha2_256_wasm_rotr( v128_t x ) noexcept
+{
+    return wasm_v128_or( wasm_u32x4_shr( x, k ), wasm_i32x4_shl( x, 32 - k ) );
+}
+
+BOOST_FORCEINLINE void sha2_256_wasm_round( v128_t a, v128_t b, v128_t c, v128_t& d, v128_t e, v128_t f, v128_t g, v128_t& h, v128_t kw ) noexcept
+{
+    v128_t S1 = wasm_v128_xor( wasm_v128_xor( sha2_256_wasm_rotr<6>( e ), sha2_256_wasm_rotr<11>( e ) ), sha2_256_wasm_rotr<25>( e ) );
+    v128_t ch = wasm_v128_bitselect( f, g, e );
+
+    v128_t T1 = wasm_i32x4_add( wasm_i32x4_add( h, S1 ), wasm_i32x4_add( ch, kw ) );
+
+    v128_t S0 = wasm_v128_xor( wasm_v128_xor( sha2_256_wasm_rotr<2>( a ), sha2_256_wasm_rotr<13>( a ) ), sha2_256_wasm_rotr<22>( a ) );
+    v128_t maj = wasm_v128_bitselect( a, b, wasm_v128_xor( b, c ) );
+
+    d = wasm_i32x4_add( d, T1 );
+    h = wasm_i32x4_add( T1, wasm_i32x4_add( S0, maj ) );
+}
+
+// loads 16 bytes at offset k from each of the four blocks and transposes
+// them, so that W[ i ] holds big endian word k/4+i of the four blocks
+
+BOOST_FORCEINLINE void sha2_256_wasm_load( unsigned char const* const block[ 4 ], int k, v128_t W[ 4 ] ) noexcept
+{
+    v128_t r0 = wasm_v128_load( block[ 0 ] + k );
+    v128_t r1 = wasm_v128_load( block[ 1 ] + k );
+    v128_t r2 = wasm_v128_load( block[ 2 ] + k );
+    v128_t r3 = wasm_v128_load( block[ 3 ] + k );
+
+    v128_t t0 = wasm_i32x4_shuffle( r0, r1, 0, 4, 1, 5 );
+    v128_t t1 = wasm_i32x4_shuffle( r0, r1, 2, 6, 3, 7 );
+    v128_t t2 = wasm_i32x4_shuffle( r2, r3, 0, 4, 1, 5 );
+    v128_t t3 = wasm_i32x4_shuffle( r2, r3, 2, 6, 3, 7 );
+
+    v128_t u[ 4 ] =
+    {
+        wasm_i64x2_shuffle( t0, t2, 0, 2 ),
+        wasm_i64x2_shuffle( t0, t2, 1, 3 ),
+        wasm_i64x2_shuffle( t1, t3, 0, 2 ),
+        wasm_i64x2_shuffle( t1, t3, 1, 3 ),
+    };
+
+    for( int i = 0; i < 4; ++i )
+    {
+        W[ i ] = wasm_i8x16_shuffle( u[ i ], u[ i ], 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+    }
+}
+
+// st[ i * stride + j ] is word i of the state of message j
+
+inline void sha2_256_transform_wasm( unsigned char const* const block[ 4 ], std::uint32_t* st, std::size_t stride, std::uint32_t const* K ) noexcept
+{
+    v128_t W[ 16 ];
+
+    sha2_256_wasm_load( block, 0, W + 0 );
+    sha2_256_wasm_load( block, 16, W + 4 );
+    sha2_256_wasm_load( block, 32, W + 8 );
+    sha2_256_wasm_load( block, 48, W + 12 );
+
+    v128_t v[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        v[ i ] = wasm_v128_load( st + i * stride );
+    }
+
+    v128_t a = v[ 0 ];
+    v128_t b = v[ 1 ];
+    v128_t c = v[ 2 ];
+    v128_t d = v[ 3 ];
+    v128_t e = v[ 4 ];
+    v128_t f = v[ 5 ];
+    v128_t g = v[ 6 ];
+    v128_t h = v[ 7 ];
+
+    for( int t = 0; t < 64; t += 8 )
+    {
+        v128_t kw[ 8 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            int u = t + i;
+
+            if( u >= 16 )
+            {
+                v128_t w15 = W[ ( u - 15 ) & 15 ];
+                v128_t w2 = W[ ( u - 2 ) & 15 ];
+
+                v128_t s0 = wasm_v128_xor( wasm_v128_xor( sha2_256_wasm_rotr<7>( w15 ), sha2_256_wasm_rotr<18>( w15 ) ), wasm_u32x4_shr( w15, 3 ) );
+                v128_t s1 = wasm_v128_xor( wasm_v128_xor( sha2_256_wasm_rotr<17>( w2 ), sha2_256_wasm_rotr<19>( w2 ) ), wasm_u32x4_shr( w2, 10 ) );
+
+                W[ u & 15 ] = wasm_i32x4_add( wasm_i32x4_add( W[ u & 15 ], s0 ), wasm_i32x4_add( W[ ( u - 7 ) & 15 ], s1 ) );
+            }
+
+            kw[ i ] = wasm_i32x4_add( W[ u & 15 ], wasm_i32x4_splat( static_cast<int>( K[ u ] ) ) );
+        }
+
+        sha2_256_wasm_round( a, b, c, d, e, f, g, h, kw[ 0 ] );
+        sha2_256_wasm_round( h, a, b, c, d, e, f, g, kw[ 1 ] );
+        sha2_256_wasm_round( g, h, a, b, c, d, e, f, kw[ 2 ] );
+        sha2_256_wasm_round( f, g, h, a, b, c, d, e, kw[ 3 ] );
+        sha2_256_wasm_round( e, f, g, h, a, b, c, d, kw[ 4 ] );
+        sha2_256_wasm_round( d, e, f, g, h, a, b, c, kw[ 5 ] );
+        sha2_256_wasm_round( c, d, e, f, g, h, a, b, kw[ 6 ] );
+        sha2_256_wasm_round( b, c, d, e, f, g, h, a, kw[ 7 ] );
+    }
+
+    v[ 0 ] = wasm_i32x4_add( v[ 0 ], a );
+    v[ 1 ] = wasm_i32x4_add( v[ 1 ], b );
+    v[ 2 ] = wasm_i32x4_add( v[ 2 ], c );
+    v[ 3 ] = wasm_i32x4_add( v[ 3 ], d );
+    v[ 4 ] = wasm_i32x4_add( v[ 4 ], e );
+    v[ 5 ] = wasm_i32x4_add( v[ 5 ], f );
+    v[ 6 ] = wasm_i32x4_add( v[ 6 ], g );
+    v[ 7 ] = wasm_i32x4_add( v[ 7 ], h );
+
+    for( int i = 0; i < 8; ++i )
+    {
+        wasm_v128_store( st + i * stride, v[ i ] );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_SHA_WASM_HPP_INCLUDED
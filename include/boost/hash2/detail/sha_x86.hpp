@@ -0,0 +1,651 @@
+#ifndef BOOST_HASH2_DETAIL_SHA_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_SHA_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SHA-1, SHA-256 and SHA-512 compression using the x86 SHA extensions and AVX2,
+// https://www.intel.com/content/www/us/en/developer/articles/technical/intel-sha-extensions.html
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// SHA-1
+
+template<int i>
+BOOST_HASH2_TARGET("sha,ssse3,sse4.1")
+BOOST_FORCEINLINE void sha1_x86_rounds( __m128i& abcd, __m128i e[ 2 ], __m128i w[ 4 ] ) noexcept
+{
+    // rounds 4*i .. 4*i+3; w[ i & 3 ] holds W[ 4*i .. 4*i+3 ]
+
+    if( i == 0 )
+    {
+        e[ 0 ] = _mm_add_epi32( e[ 0 ], w[ 0 ] );
+    }
+    else
+    {
+        e[ i & 1 ] = _mm_sha1nexte_epu32( e[ i & 1 ], w[ i & 3 ] );
+    }
+
+    e[ ( i + 1 ) & 1 ] = abcd;
+
+    if( i >= 3 && i <= 18 )
+    {
+        w[ ( i + 1 ) & 3 ] = _mm_sha1msg2_epu32( w[ ( i + 1 ) & 3 ], w[ i & 3 ] );
+    }
+
+    abcd = _mm_sha1rnds4_epu32( abcd, e[ i & 1 ], i / 5 );
+
+    if( i >= 1 && i <= 16 )
+    {
+        w[ ( i + 3 ) & 3 ] = _mm_sha1msg1_epu32( w[ ( i + 3 ) & 3 ], w[ i & 3 ] );
+    }
+
+    if( i >= 2 && i <= 17 )
+    {
+        w[ ( i + 2 ) & 3 ] = _mm_xor_si128( w[ ( i + 2 ) & 3 ], w[ i & 3 ] );
+    }
+}
+
+// The SHA-NI transforms use legacy SSE encodings and are kept out of line,
+// so that the compiler clears the upper register state (vzeroupper) before
+// calling them from AVX code; inlining them there causes a severe slowdown
+
+BOOST_HASH2_TARGET("sha,ssse3,sse4.1")
+BOOST_NOINLINE inline void sha1_transform_x86( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] ) noexcept
+{
+    __m128i const mask = _mm_set_epi64x( 0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL );
+
+    __m128i abcd = _mm_shuffle_epi32( _mm_loadu_si128( reinterpret_cast<__m128i const*>( state ) ), 0x1B );
+
+    __m128i e[ 2 ];
+
+    e[ 0 ] = _mm_set_epi32( static_cast<int>( state[ 4 ] ), 0, 0, 0 );
+    e[ 1 ] = _mm_setzero_si128();
+
+    __m128i const abcd_0 = abcd;
+    __m128i const e_0 = e[ 0 ];
+
+    __m128i w[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        w[ i ] = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + i * 16 ) ), mask );
+    }
+
+    sha1_x86_rounds< 0>( abcd, e, w );
+    sha1_x86_rounds< 1>( abcd, e, w );
+    sha1_x86_rounds< 2>( abcd, e, w );
+    sha1_x86_rounds< 3>( abcd, e, w );
+    sha1_x86_rounds< 4>( abcd, e, w );
+    sha1_x86_rounds< 5>( abcd, e, w );
+    sha1_x86_rounds< 6>( abcd, e, w );
+    sha1_x86_rounds< 7>( abcd, e, w );
+    sha1_x86_rounds< 8>( abcd, e, w );
+    sha1_x86_rounds< 9>( abcd, e, w );
+    sha1_x86_rounds<10>( abcd, e, w );
+    sha1_x86_rounds<11>( abcd, e, w );
+    sha1_x86_rounds<12>( abcd, e, w );
+    sha1_x86_rounds<13>( abcd, e, w );
+    sha1_x86_rounds<14>( abcd, e, w );
+    sha1_x86_rounds<15>( abcd, e, w );
+    sha1_x86_rounds<16>( abcd, e, w );
+    sha1_x86_rounds<17>( abcd, e, w );
+    sha1_x86_rounds<18>( abcd, e, w );
+    sha1_x86_rounds<19>( abcd, e, w );
+
+    e[ 0 ] = _mm_sha1nexte_epu32( e[ 0 ], e_0 );
+    abcd = _mm_add_epi32( abcd, abcd_0 );
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( state ), _mm_shuffle_epi32( abcd, 0x1B ) );
+    state[ 4 ] = static_cast<std::uint32_t>( _mm_extract_epi32( e[ 0 ], 3 ) );
+}
+
+// SHA-256
+
+// K points to the 64 SHA-256 round constants
+
+template<int i>
+BOOST_HASH2_TARGET("sha,ssse3,sse4.1")
+BOOST_FORCEINLINE void sha2_256_x86_rounds( __m128i& s0, __m128i& s1, __m128i w[ 4 ], std::uint32_t const* K ) noexcept
+{
+    // rounds 4*i .. 4*i+3; w[ i & 3 ] holds W[ 4*i .. 4*i+3 ]
+
+    if( i >= 4 )
+    {
+        __m128i x = _mm_sha256msg1_epu32( w[ i & 3 ], w[ ( i + 1 ) & 3 ] );
+        x = _mm_add_epi32( x, _mm_alignr_epi8( w[ ( i + 3 ) & 3 ], w[ ( i + 2 ) & 3 ], 4 ) );
+        w[ i & 3 ] = _mm_sha256msg2_epu32( x, w[ ( i + 3 ) & 3 ] );
+    }
+
+    __m128i k = _mm_add_epi32( w[ i & 3 ], _mm_loadu_si128( reinterpret_cast<__m128i const*>( K + i * 4 ) ) );
+
+    s1 = _mm_sha256rnds2_epu32( s1, s0, k );
+    k = _mm_shuffle_epi32( k, 0x0E );
+    s0 = _mm_sha256rnds2_epu32( s0, s1, k );
+}
+
+BOOST_HASH2_TARGET("sha,ssse3,sse4.1")
+BOOST_NOINLINE inline void sha2_256_transform_x86( unsigned char const block[ 64 ], std::uint32_t state[ 8 ], std::uint32_t const* K ) noexcept
+{
+    __m128i const mask = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+
+    // ABEF, CDGH
+
+    __m128i t = _mm_loadu_si128( reinterpret_cast<__m128i const*>( state + 0 ) );
+    __m128i s1 = _mm_loadu_si128( reinterpret_cast<__m128i const*>( state + 4 ) );
+
+    t = _mm_shuffle_epi32( t, 0xB1 );
+    s1 = _mm_shuffle_epi32( s1, 0x1B );
+
+    __m128i s0 = _mm_alignr_epi8( t, s1, 8 );
+    s1 = _mm_blend_epi16( s1, t, 0xF0 );
+
+    __m128i const abef = s0;
+    __m128i const cdgh = s1;
+
+    __m128i w[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        w[ i ] = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + i * 16 ) ), mask );
+    }
+
+    sha2_256_x86_rounds< 0>( s0, s1, w, K );
+    sha2_256_x86_rounds< 1>( s0, s1, w, K );
+    sha2_256_x86_rounds< 2>( s0, s1, w, K );
+    sha2_256_x86_rounds< 3>( s0, s1, w, K );
+    sha2_256_x86_rounds< 4>( s0, s1, w, K );
+    sha2_256_x86_rounds< 5>( s0, s1, w, K );
+    sha2_256_x86_rounds< 6>( s0, s1, w, K );
+    sha2_256_x86_rounds< 7>( s0, s1, w, K );
+    sha2_256_x86_rounds< 8>( s0, s1, w, K );
+    sha2_256_x86_rounds< 9>( s0, s1, w, K );
+    sha2_256_x86_rounds<10>( s0, s1, w, K );
+    sha2_256_x86_rounds<11>( s0, s1, w, K );
+    sha2_256_x86_rounds<12>( s0, s1, w, K );
+    sha2_256_x86_rounds<13>( s0, s1, w, K );
+    sha2_256_x86_rounds<14>( s0, s1, w, K );
+    sha2_256_x86_rounds<15>( s0, s1, w, K );
+
+    s0 = _mm_add_epi32( s0, abef );
+    s1 = _mm_add_epi32( s1, cdgh );
+
+    // back to ABCD, EFGH
+
+    t = _mm_shuffle_epi32( s0, 0x1B );
+    s1 = _mm_shuffle_epi32( s1, 0xB1 );
+
+    s0 = _mm_blend_epi16( t, s1, 0xF0 );
+    s1 = _mm_alignr_epi8( s1, t, 8 );
+
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( state + 0 ), s0 );
+    _mm_storeu_si128( reinterpret_cast<__m128i*>( state + 4 ), s1 );
+}
+
+// SHA-256, eight independent messages in the 32 bit lanes of an AVX2 register
+
+template<int k>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i sha2_256_avx2_rotr( __m256i x ) noexcept
+{
+    return _mm256_or_si256( _mm256_srli_epi32( x, k ), _mm256_slli_epi32( x, 32 - k ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void sha2_256_avx2_round( __m256i a, __m256i b, __m256i c, __m256i& d, __m256i e, __m256i f, __m256i g, __m256i& h, __m256i kw ) noexcept
+{
+    __m256i S1 = _mm256_xor_si256( _mm256_xor_si256( sha2_256_avx2_rotr<6>( e ), sha2_256_avx2_rotr<11>( e ) ), sha2_256_avx2_rotr<25>( e ) );
+    __m256i ch = _mm256_xor_si256( _mm256_and_si256( e, f ), _mm256_andnot_si256( e, g ) );
+
+    __m256i T1 = _mm256_add_epi32( _mm256_add_epi32( h, S1 ), _mm256_add_epi32( ch, kw ) );
+
+    __m256i S0 = _mm256_xor_si256( _mm256_xor_si256( sha2_256_avx2_rotr<2>( a ), sha2_256_avx2_rotr<13>( a ) ), sha2_256_avx2_rotr<22>( a ) );
+    __m256i maj = _mm256_xor_si256( _mm256_and_si256( _mm256_xor_si256( a, b ), c ), _mm256_and_si256( a, b ) );
+
+    d = _mm256_add_epi32( d, T1 );
+    h = _mm256_add_epi32( T1, _mm256_add_epi32( S0, maj ) );
+}
+
+// loads 32 bytes at offset k from each of the eight blocks and transposes
+// them, so that W[ i ] holds big endian word k/4+i of the eight blocks
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void sha2_256_avx2_load( unsigned char const* const block[ 8 ], int k, __m256i W[ 8 ] ) noexcept
+{
+    __m256i const mask = _mm256_setr_epi8(
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+        3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+
+    __m256i r[ 8 ];
+
+    for( int j = 0; j < 8; ++j )
+    {
+        r[ j ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block[ j ] + k ) );
+    }
+
+    __m256i t0 = _mm256_unpacklo_epi32( r[ 0 ], r[ 1 ] );
+    __m256i t1 = _mm256_unpackhi_epi32( r[ 0 ], r[ 1 ] );
+    __m256i t2 = _mm256_unpacklo_epi32( r[ 2 ], r[ 3 ] );
+    __m256i t3 = _mm256_unpackhi_epi32( r[ 2 ], r[ 3 ] );
+    __m256i t4 = _mm256_unpacklo_epi32( r[ 4 ], r[ 5 ] );
+    __m256i t5 = _mm256_unpackhi_epi32( r[ 4 ], r[ 5 ] );
+    __m256i t6 = _mm256_unpacklo_epi32( r[ 6 ], r[ 7 ] );
+    __m256i t7 = _mm256_unpackhi_epi32( r[ 6 ], r[ 7 ] );
+
+    __m256i u0 = _mm256_unpacklo_epi64( t0, t2 );
+    __m256i u1 = _mm256_unpackhi_epi64( t0, t2 );
+    __m256i u2 = _mm256_unpacklo_epi64( t1, t3 );
+    __m256i u3 = _mm256_unpackhi_epi64( t1, t3 );
+    __m256i u4 = _mm256_unpacklo_epi64( t4, t6 );
+    __m256i u5 = _mm256_unpackhi_epi64( t4, t6 );
+    __m256i u6 = _mm256_unpacklo_epi64( t5, t7 );
+    __m256i u7 = _mm256_unpackhi_epi64( t5, t7 );
+
+    W[ 0 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u0, u4, 0x20 ), mask );
+    W[ 1 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u1, u5, 0x20 ), mask );
+    W[ 2 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u2, u6, 0x20 ), mask );
+    W[ 3 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u3, u7, 0x20 ), mask );
+    W[ 4 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u0, u4, 0x31 ), mask );
+    W[ 5 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u1, u5, 0x31 ), mask );
+    W[ 6 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u2, u6, 0x31 ), mask );
+    W[ 7 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( u3, u7, 0x31 ), mask );
+}
+
+// st[ i * stride + j ] is word i of the state of message j
+
+BOOST_HASH2_TARGET("avx2")
+inline void sha2_256_transform_avx2( unsigned char const* const block[ 8 ], std::uint32_t* st, std::size_t stride, std::uint32_t const* K ) noexcept
+{
+    __m256i W[ 16 ];
+
+    sha2_256_avx2_load( block, 0, W + 0 );
+    sha2_256_avx2_load( block, 32, W + 8 );
+
+    __m256i v[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        v[ i ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + i * stride ) );
+    }
+
+    __m256i a = v[ 0 ];
+    __m256i b = v[ 1 ];
+    __m256i c = v[ 2 ];
+    __m256i d = v[ 3 ];
+    __m256i e = v[ 4 ];
+    __m256i f = v[ 5 ];
+    __m256i g = v[ 6 ];
+    __m256i h = v[ 7 ];
+
+    for( int t = 0; t < 64; t += 8 )
+    {
+        __m256i kw[ 8 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            int u = t + i;
+
+            if( u >= 16 )
+            {
+                __m256i w15 = W[ ( u - 15 ) & 15 ];
+                __m256i w2 = W[ ( u - 2 ) & 15 ];
+
+                __m256i s0 = _mm256_xor_si256( _mm256_xor_si256( sha2_256_avx2_rotr<7>( w15 ), sha2_256_avx2_rotr<18>( w15 ) ), _mm256_srli_epi32( w15, 3 ) );
+                __m256i s1 = _mm256_xor_si256( _mm256_xor_si256( sha2_256_avx2_rotr<17>( w2 ), sha2_256_avx2_rotr<19>( w2 ) ), _mm256_srli_epi32( w2, 10 ) );
+
+                W[ u & 15 ] = _mm256_add_epi32( _mm256_add_epi32( W[ u & 15 ], s0 ), _mm256_add_epi32( W[ ( u - 7 ) & 15 ], s1 ) );
+            }
+
+            kw[ i ] = _mm256_add_epi32( W[ u & 15 ], _mm256_set1_epi32( static_cast<int>( K[ u ] ) ) );
+        }
+
+        sha2_256_avx2_round( a, b, c, d, e, f, g, h, kw[ 0 ] );
+        sha2_256_avx2_round( h, a, b, c, d, e, f, g, kw[ 1 ] );
+        sha2_256_avx2_round( g, h, a, b, c, d, e, f, kw[ 2 ] );
+        sha2_256_avx2_round( f, g, h, a, b, c, d, e, kw[ 3 ] );
+        sha2_256_avx2_round( e, f, g, h, a, b, c, d, kw[ 4 ] );
+        sha2_256_avx2_round( d, e, f, g, h, a, b, c, kw[ 5 ] );
+        sha2_256_avx2_round( c, d, e, f, g, h, a, b, kw[ 6 ] );
+        sha2_256_avx2_round( b, c, d, e, f, g, h, a, kw[ 7 ] );
+    }
+
+    v[ 0 ] = _mm256_add_epi32( v[ 0 ], a );
+    v[ 1 ] = _mm256_add_epi32( v[ 1 ], b );
+    v[ 2 ] = _mm256_add_epi32( v[ 2 ], c );
+    v[ 3 ] = _mm256_add_epi32( v[ 3 ], d );
+    v[ 4 ] = _mm256_add_epi32( v[ 4 ], e );
+    v[ 5 ] = _mm256_add_epi32( v[ 5 ], f );
+    v[ 6 ] = _mm256_add_epi32( v[ 6 ], g );
+    v[ 7 ] = _mm256_add_epi32( v[ 7 ], h );
+
+    for( int i = 0; i < 8; ++i )
+    {
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + i * stride ), v[ i ] );
+    }
+}
+
+// SHA-512
+
+BOOST_FORCEINLINE std::uint64_t sha2_512_rotr( std::uint64_t x, int n ) noexcept
+{
+    return ( x >> n ) | ( x << ( 64 - n ) );
+}
+
+// bc holds b ^ c on entry and a ^ b, the next round's b ^ c, on exit
+
+BOOST_HASH2_TARGET("avx2,bmi2")
+BOOST_FORCEINLINE void sha2_512_avx2_round( std::uint64_t a, std::uint64_t b, std::uint64_t& d, std::uint64_t e, std::uint64_t f, std::uint64_t g, std::uint64_t& h, std::uint64_t kw, std::uint64_t& bc ) noexcept
+{
+    std::uint64_t ab = a ^ b;
+
+    std::uint64_t T1 = h + ( sha2_512_rotr( e, 14 ) ^ sha2_512_rotr( e, 18 ) ^ sha2_512_rotr( e, 41 ) ) + ( g ^ ( e & ( f ^ g ) ) ) + kw;
+    std::uint64_t T2 = ( sha2_512_rotr( a, 28 ) ^ sha2_512_rotr( a, 34 ) ^ sha2_512_rotr( a, 39 ) ) + ( b ^ ( ab & bc ) );
+
+    bc = ab;
+
+    d += T1;
+    h = T1 + T2;
+}
+
+template<int k>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m128i sha2_512_sse_rotr( __m128i x ) noexcept
+{
+    return _mm_or_si128( _mm_srli_epi64( x, k ), _mm_slli_epi64( x, 64 - k ) );
+}
+
+// single message; the message schedule is computed two words at a time
+// in vector registers, the rounds use the scalar BMI2 rotates
+
+BOOST_HASH2_TARGET("avx2,bmi2")
+BOOST_NOINLINE inline void sha2_512_transform_avx2( unsigned char const block[ 128 ], std::uint64_t state[ 8 ], std::uint64_t const* K ) noexcept
+{
+    __m128i const mask = _mm_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+
+    // W[ 2*i .. 2*i+1 ] + K[ 2*i .. 2*i+1 ]
+    std::uint64_t WK[ 80 ];
+
+    // w[ i & 7 ] holds W[ 2*i .. 2*i+1 ]
+    __m128i w[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        w[ i ] = _mm_shuffle_epi8( _mm_loadu_si128( reinterpret_cast<__m128i const*>( block + i * 16 ) ), mask );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( WK + i * 2 ), _mm_add_epi64( w[ i ], _mm_loadu_si128( reinterpret_cast<__m128i const*>( K + i * 2 ) ) ) );
+    }
+
+    std::uint64_t a = state[ 0 ];
+    std::uint64_t b = state[ 1 ];
+    std::uint64_t c = state[ 2 ];
+    std::uint64_t d = state[ 3 ];
+    std::uint64_t e = state[ 4 ];
+    std::uint64_t f = state[ 5 ];
+    std::uint64_t g = state[ 6 ];
+    std::uint64_t h = state[ 7 ];
+
+    std::uint64_t bc = b ^ c;
+
+    for( int t = 0; t < 80; t += 8 )
+    {
+        // schedule W[ t+16 .. t+23 ] while the rounds t .. t+7 execute
+
+        for( int i = t / 2 + 8; i < t / 2 + 12 && i < 40; ++i )
+        {
+            __m128i w16 = w[ i & 7 ];
+            __m128i w15 = _mm_alignr_epi8( w[ ( i + 1 ) & 7 ], w[ i & 7 ], 8 );
+            __m128i w7 = _mm_alignr_epi8( w[ ( i + 5 ) & 7 ], w[ ( i + 4 ) & 7 ], 8 );
+            __m128i w2 = w[ ( i + 7 ) & 7 ];
+
+            __m128i s0 = _mm_xor_si128( _mm_xor_si128( sha2_512_sse_rotr<1>( w15 ), sha2_512_sse_rotr<8>( w15 ) ), _mm_srli_epi64( w15, 7 ) );
+            __m128i s1 = _mm_xor_si128( _mm_xor_si128( sha2_512_sse_rotr<19>( w2 ), sha2_512_sse_rotr<61>( w2 ) ), _mm_srli_epi64( w2, 6 ) );
+
+            __m128i x = _mm_add_epi64( _mm_add_epi64( w16, s0 ), _mm_add_epi64( w7, s1 ) );
+
+            w[ i & 7 ] = x;
+            _mm_storeu_si128( reinterpret_cast<__m128i*>( WK + i * 2 ), _mm_add_epi64( x, _mm_loadu_si128( reinterpret_cast<__m128i const*>( K + i * 2 ) ) ) );
+        }
+
+        sha2_512_avx2_round( a, b, d, e, f, g, h, WK[ t + 0 ], bc );
+        sha2_512_avx2_round( h, a, c, d, e, f, g, WK[ t + 1 ], bc );
+        sha2_512_avx2_round( g, h, b, c, d, e, f, WK[ t + 2 ], bc );
+        sha2_512_avx2_round( f, g, a, b, c, d, e, WK[ t + 3 ], bc );
+        sha2_512_avx2_round( e, f, h, a, b, c, d, WK[ t + 4 ], bc );
+        sha2_512_avx2_round( d, e, g, h, a, b, c, WK[ t + 5 ], bc );
+        sha2_512_avx2_round( c, d, f, g, h, a, b, WK[ t + 6 ], bc );
+        sha2_512_avx2_round( b, c, e, f, g, h, a, WK[ t + 7 ], bc );
+    }
+
+    state[ 0 ] += a;
+    state[ 1 ] += b;
+    state[ 2 ] += c;
+    state[ 3 ] += d;
+    state[ 4 ] += e;
+    state[ 5 ] += f;
+    state[ 6 ] += g;
+    state[ 7 ] += h;
+}
+
+#if defined(BOOST_HASH2_HAS_X86_SHA512_INTRINSICS)
+
+// single message, using the SHA512 extensions; the state is kept as
+// { f, e, b, a } and { h, g, d, c }, from the low lane up, the layout
+// VSHA512RNDS2 expects
+
+BOOST_HASH2_TARGET("avx2,sha512")
+BOOST_NOINLINE inline void sha2_512_transform_sha512( unsigned char const block[ 128 ], std::uint64_t state[ 8 ], std::uint64_t const* K ) noexcept
+{
+    __m256i const mask = _mm256_setr_epi8( 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+
+    __m256i abef = _mm256_set_epi64x( static_cast<long long>( state[ 0 ] ), static_cast<long long>( state[ 1 ] ), static_cast<long long>( state[ 4 ] ), static_cast<long long>( state[ 5 ] ) );
+    __m256i cdgh = _mm256_set_epi64x( static_cast<long long>( state[ 2 ] ), static_cast<long long>( state[ 3 ] ), static_cast<long long>( state[ 6 ] ), static_cast<long long>( state[ 7 ] ) );
+
+    __m256i const abef0 = abef;
+    __m256i const cdgh0 = cdgh;
+
+    __m256i w[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        w[ i ] = _mm256_shuffle_epi8( _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block + i * 32 ) ), mask );
+    }
+
+    // 20 groups of 4 rounds; w[ i & 3 ] holds W[ 4*i .. 4*i+3 ]
+    // and is replaced by W[ 4*i+16 .. 4*i+19 ] when no longer needed
+
+    for( int i = 0; i < 20; ++i )
+    {
+        __m256i k = _mm256_add_epi64( w[ i & 3 ], _mm256_loadu_si256( reinterpret_cast<__m256i const*>( K + i * 4 ) ) );
+
+        if( i < 16 )
+        {
+            __m256i w8 = w[ ( i + 2 ) & 3 ];
+            __m256i w12 = w[ ( i + 3 ) & 3 ];
+
+            // W[ 4*i+9 .. 4*i+12 ]
+            __m256i w9 = _mm256_alignr_epi8( _mm256_permute2x128_si256( w8, w12, 0x21 ), w8, 8 );
+
+            __m256i x = _mm256_sha512msg1_epi64( w[ i & 3 ], _mm256_castsi256_si128( w[ ( i + 1 ) & 3 ] ) );
+            w[ i & 3 ] = _mm256_sha512msg2_epi64( _mm256_add_epi64( x, w9 ), w12 );
+        }
+
+        // each VSHA512RNDS2 performs two rounds, after which the
+        // previous { a, b, e, f } become { c, d, g, h }
+
+        cdgh = _mm256_sha512rnds2_epi64( cdgh, abef, _mm256_castsi256_si128( k ) );
+        abef = _mm256_sha512rnds2_epi64( abef, cdgh, _mm256_extracti128_si256( k, 1 ) );
+    }
+
+    abef = _mm256_add_epi64( abef, abef0 );
+    cdgh = _mm256_add_epi64( cdgh, cdgh0 );
+
+    std::uint64_t r[ 8 ];
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( r + 0 ), abef );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( r + 4 ), cdgh );
+
+    state[ 0 ] = r[ 3 ];
+    state[ 1 ] = r[ 2 ];
+    state[ 2 ] = r[ 7 ];
+    state[ 3 ] = r[ 6 ];
+    state[ 4 ] = r[ 1 ];
+    state[ 5 ] = r[ 0 ];
+    state[ 6 ] = r[ 5 ];
+    state[ 7 ] = r[ 4 ];
+}
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_SHA512_INTRINSICS)
+
+// four messages in the 64 bit lanes of the AVX2 registers
+
+template<int k>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i sha2_512_avx2_rotr( __m256i x ) noexcept
+{
+    return _mm256_or_si256( _mm256_srli_epi64( x, k ), _mm256_slli_epi64( x, 64 - k ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void sha2_512_avx2_round_x4( __m256i a, __m256i b, __m256i& d, __m256i e, __m256i f, __m256i g, __m256i& h, __m256i kw, __m256i& bc ) noexcept
+{
+    __m256i S1 = _mm256_xor_si256( _mm256_xor_si256( sha2_512_avx2_rotr<14>( e ), sha2_512_avx2_rotr<18>( e ) ), sha2_512_avx2_rotr<41>( e ) );
+    __m256i ch = _mm256_xor_si256( g, _mm256_and_si256( e, _mm256_xor_si256( f, g ) ) );
+
+    __m256i T1 = _mm256_add_epi64( _mm256_add_epi64( h, S1 ), _mm256_add_epi64( ch, kw ) );
+
+    __m256i ab = _mm256_xor_si256( a, b );
+
+    __m256i S0 = _mm256_xor_si256( _mm256_xor_si256( sha2_512_avx2_rotr<28>( a ), sha2_512_avx2_rotr<34>( a ) ), sha2_512_avx2_rotr<39>( a ) );
+    __m256i maj = _mm256_xor_si256( b, _mm256_and_si256( ab, bc ) );
+
+    bc = ab;
+
+    d = _mm256_add_epi64( d, T1 );
+    h = _mm256_add_epi64( T1, _mm256_add_epi64( S0, maj ) );
+}
+
+// loads 32 bytes at offset k from each of the four blocks and transposes
+// them, so that W[ i ] holds big endian word k/8+i of the four blocks
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void sha2_512_avx2_load_x4( unsigned char const* const block[ 4 ], int k, __m256i W[ 4 ] ) noexcept
+{
+    __m256i const mask = _mm256_setr_epi8(
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+        7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8 );
+
+    __m256i r0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block[ 0 ] + k ) );
+    __m256i r1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block[ 1 ] + k ) );
+    __m256i r2 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block[ 2 ] + k ) );
+    __m256i r3 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( block[ 3 ] + k ) );
+
+    __m256i t0 = _mm256_unpacklo_epi64( r0, r1 );
+    __m256i t1 = _mm256_unpackhi_epi64( r0, r1 );
+    __m256i t2 = _mm256_unpacklo_epi64( r2, r3 );
+    __m256i t3 = _mm256_unpackhi_epi64( r2, r3 );
+
+    W[ 0 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( t0, t2, 0x20 ), mask );
+    W[ 1 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( t1, t3, 0x20 ), mask );
+    W[ 2 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( t0, t2, 0x31 ), mask );
+    W[ 3 ] = _mm256_shuffle_epi8( _mm256_permute2x128_si256( t1, t3, 0x31 ), mask );
+}
+
+// st[ i * stride + j ] is word i of the state of message j
+
+BOOST_HASH2_TARGET("avx2")
+inline void sha2_512_transform_avx2_x4( unsigned char const* const block[ 4 ], std::uint64_t* st, std::size_t stride, std::uint64_t const* K ) noexcept
+{
+    __m256i W[ 16 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        sha2_512_avx2_load_x4( block, i * 32, W + i * 4 );
+    }
+
+    __m256i v[ 8 ];
+
+    for( int i = 0; i < 8; ++i )
+    {
+        v[ i ] = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( st + i * stride ) );
+    }
+
+    __m256i a = v[ 0 ];
+    __m256i b = v[ 1 ];
+    __m256i c = v[ 2 ];
+    __m256i d = v[ 3 ];
+    __m256i e = v[ 4 ];
+    __m256i f = v[ 5 ];
+    __m256i g = v[ 6 ];
+    __m256i h = v[ 7 ];
+
+    __m256i bc = _mm256_xor_si256( b, c );
+
+    for( int t = 0; t < 80; t += 8 )
+    {
+        __m256i kw[ 8 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            int u = t + i;
+
+            if( u >= 16 )
+            {
+                __m256i w15 = W[ ( u - 15 ) & 15 ];
+                __m256i w2 = W[ ( u - 2 ) & 15 ];
+
+                __m256i s0 = _mm256_xor_si256( _mm256_xor_si256( sha2_512_avx2_rotr<1>( w15 ), sha2_512_avx2_rotr<8>( w15 ) ), _mm256_srli_epi64( w15, 7 ) );
+                __m256i s1 = _mm256_xor_si256( _mm256_xor_si256( sha2_512_avx2_rotr<19>( w2 ), sha2_512_avx2_rotr<61>( w2 ) ), _mm256_srli_epi64( w2, 6 ) );
+
+                W[ u & 15 ] = _mm256_add_epi64( _mm256_add_epi64( W[ u & 15 ], s0 ), _mm256_add_epi64( W[ ( u - 7 ) & 15 ], s1 ) );
+            }
+
+            kw[ i ] = _mm256_add_epi64( W[ u & 15 ], _mm256_set1_epi64x( static_cast<long long>( K[ u ] ) ) );
+        }
+
+        sha2_512_avx2_round_x4( a, b, d, e, f, g, h, kw[ 0 ], bc );
+        sha2_512_avx2_round_x4( h, a, c, d, e, f, g, kw[ 1 ], bc );
+        sha2_512_avx2_round_x4( g, h, b, c, d, e, f, kw[ 2 ], bc );
+        sha2_512_avx2_round_x4( f, g, a, b, c, d, e, kw[ 3 ], bc );
+        sha2_512_avx2_round_x4( e, f, h, a, b, c, d, kw[ 4 ], bc );
+        sha2_512_avx2_round_x4( d, e, g, h, a, b, c, kw[ 5 ], bc );
+        sha2_512_avx2_round_x4( c, d, f, g, h, a, b, kw[ 6 ], bc );
+        sha2_512_avx2_round_x4( b, c, e, f, g, h, a, kw[ 7 ], bc );
+    }
+
+    v[ 0 ] = _mm256_add_epi64( v[ 0 ], a );
+    v[ 1 ] = _mm256_add_epi64( v[ 1 ], b );
+    v[ 2 ] = _mm256_add_epi64( v[ 2 ], c );
+    v[ 3 ] = _mm256_add_epi64( v[ 3 ], d );
+    v[ 4 ] = _mm256_add_epi64( v[ 4 ], e );
+    v[ 5 ] = _mm256_add_epi64( v[ 5 ], f );
+    v[ 6 ] = _mm256_add_epi64( v[ 6 ], g );
+    v[ 7 ] = _mm256_add_epi64( v[ 7 ], h );
+
+    for( int i = 0; i < 8; ++i )
+    {
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( st + i * stride ), v[ i ] );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_SHA_X86_HPP_INCLUDED
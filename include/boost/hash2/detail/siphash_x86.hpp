@@ -0,0 +1,259 @@
+#ifndef BOOST_HASH2_DETAIL_SIPHASH_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_SIPHASH_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SipHash over several independent messages, in AVX2 lanes
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The states of four messages, one per 64 bit lane
+
+struct siphash_lanes_avx2
+{
+    __m256i v0, v1, v2, v3;
+};
+
+template<int R>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i siphash_rotl_avx2( __m256i x ) noexcept
+{
+    return _mm256_or_si256( _mm256_slli_epi64( x, R ), _mm256_srli_epi64( x, 64 - R ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void siphash_sipround_avx2( siphash_lanes_avx2& s ) noexcept
+{
+    __m256i const r16 = _mm256_setr_epi8( 6, 7, 0, 1, 2, 3, 4, 5, 14, 15, 8, 9, 10, 11, 12, 13, 6, 7, 0, 1, 2, 3, 4, 5, 14, 15, 8, 9, 10, 11, 12, 13 );
+
+    s.v0 = _mm256_add_epi64( s.v0, s.v1 );
+    s.v1 = siphash_rotl_avx2<13>( s.v1 );
+    s.v1 = _mm256_xor_si256( s.v1, s.v0 );
+    s.v0 = _mm256_shuffle_epi32( s.v0, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+    s.v2 = _mm256_add_epi64( s.v2, s.v3 );
+    s.v3 = _mm256_shuffle_epi8( s.v3, r16 );
+    s.v3 = _mm256_xor_si256( s.v3, s.v2 );
+    s.v0 = _mm256_add_epi64( s.v0, s.v3 );
+    s.v3 = siphash_rotl_avx2<21>( s.v3 );
+    s.v3 = _mm256_xor_si256( s.v3, s.v0 );
+    s.v2 = _mm256_add_epi64( s.v2, s.v1 );
+    s.v1 = siphash_rotl_avx2<17>( s.v1 );
+    s.v1 = _mm256_xor_si256( s.v1, s.v2 );
+    s.v2 = _mm256_shuffle_epi32( s.v2, _MM_SHUFFLE( 2, 3, 0, 1 ) );
+}
+
+template<int C>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void siphash_compress_avx2( siphash_lanes_avx2& s, __m256i m ) noexcept
+{
+    s.v3 = _mm256_xor_si256( s.v3, m );
+
+    for( int i = 0; i < C; ++i )
+    {
+        siphash_sipround_avx2( s );
+    }
+
+    s.v0 = _mm256_xor_si256( s.v0, m );
+}
+
+// lanes whose mask is zero keep their previous state
+
+template<int C>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE void siphash_compress_masked_avx2( siphash_lanes_avx2& s, __m256i m, __m256i mask ) noexcept
+{
+    siphash_lanes_avx2 t = s;
+
+    siphash_compress_avx2<C>( t, m );
+
+    s.v0 = _mm256_blendv_epi8( s.v0, t.v0, mask );
+    s.v1 = _mm256_blendv_epi8( s.v1, t.v1, mask );
+    s.v2 = _mm256_blendv_epi8( s.v2, t.v2, mask );
+    s.v3 = _mm256_blendv_epi8( s.v3, t.v3, mask );
+}
+
+template<int D>
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i siphash_finalize_avx2( siphash_lanes_avx2& s ) noexcept
+{
+    s.v2 = _mm256_xor_si256( s.v2, _mm256_set1_epi64x( 0xFF ) );
+
+    for( int i = 0; i < D; ++i )
+    {
+        siphash_sipround_avx2( s );
+    }
+
+    return _mm256_xor_si256( _mm256_xor_si256( s.v0, s.v1 ), _mm256_xor_si256( s.v2, s.v3 ) );
+}
+
+BOOST_HASH2_TARGET("avx2")
+BOOST_FORCEINLINE __m256i siphash_load_avx2( unsigned char const* const p[ 4 ], std::size_t offset ) noexcept
+{
+    return _mm256_setr_epi64x(
+        static_cast<long long>( detail::read64le( p[ 0 ] + offset ) ),
+        static_cast<long long>( detail::read64le( p[ 1 ] + offset ) ),
+        static_cast<long long>( detail::read64le( p[ 2 ] + offset ) ),
+        static_cast<long long>( detail::read64le( p[ 3 ] + offset ) ) );
+}
+
+// Eight messages, as two independent groups of four, so that the
+// dependency chains of the two groups overlap
+//
+// v is the initial state, n0 the number of bytes already processed,
+// with n0 % 8 == 0
+
+template<int C, int D>
+BOOST_HASH2_TARGET("avx2")
+inline void siphash_64_batch8_avx2( std::uint64_t const v[ 4 ], std::uint64_t n0, unsigned char const* const p[ 8 ], std::size_t const n[ 8 ], std::uint64_t out[ 8 ] ) noexcept
+{
+    std::size_t w[ 8 ]; // number of full words
+    std::uint64_t tail[ 8 ]; // last word, with the length in the top byte
+
+    std::size_t wmin = n[ 0 ] / 8;
+    std::size_t wmax = wmin;
+
+    for( int i = 0; i < 8; ++i )
+    {
+        w[ i ] = n[ i ] / 8;
+
+        if( w[ i ] < wmin ) wmin = w[ i ];
+        if( w[ i ] > wmax ) wmax = w[ i ];
+
+        std::size_t r = n[ i ] % 8;
+        std::uint64_t x = 0;
+
+        if( r != 0 && n[ i ] >= 8 )
+        {
+            // the last eight bytes, shifted to drop the ones already in the last full word
+            x = detail::read64le( p[ i ] + n[ i ] - 8 ) >> ( 64 - r * 8 );
+        }
+        else
+        {
+            for( std::size_t j = 0; j < r; ++j )
+            {
+                x |= static_cast<std::uint64_t>( p[ i ][ j ] ) << ( j * 8 );
+            }
+        }
+
+        tail[ i ] = x | ( ( n0 + n[ i ] ) & 0xFF ) << 56;
+    }
+
+    siphash_lanes_avx2 a, b;
+
+    a.v0 = b.v0 = _mm256_set1_epi64x( static_cast<long long>( v[ 0 ] ) );
+    a.v1 = b.v1 = _mm256_set1_epi64x( static_cast<long long>( v[ 1 ] ) );
+    a.v2 = b.v2 = _mm256_set1_epi64x( static_cast<long long>( v[ 2 ] ) );
+    a.v3 = b.v3 = _mm256_set1_epi64x( static_cast<long long>( v[ 3 ] ) );
+
+    // the words all eight messages have
+
+    for( std::size_t t = 0; t < wmin; ++t )
+    {
+        siphash_compress_avx2<C>( a, siphash_load_avx2( p + 0, t * 8 ) );
+        siphash_compress_avx2<C>( b, siphash_load_avx2( p + 4, t * 8 ) );
+    }
+
+    // the rest, including the last words; a message whose last word
+    // has already been processed is masked out
+
+    for( std::size_t t = wmin; t <= wmax; ++t )
+    {
+        long long m[ 8 ];
+        long long mask[ 8 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            if( t < w[ i ] )
+            {
+                m[ i ] = static_cast<long long>( detail::read64le( p[ i ] + t * 8 ) );
+                mask[ i ] = -1;
+            }
+            else if( t == w[ i ] )
+            {
+                m[ i ] = static_cast<long long>( tail[ i ] );
+                mask[ i ] = -1;
+            }
+            else
+            {
+                m[ i ] = 0;
+                mask[ i ] = 0;
+            }
+        }
+
+        siphash_compress_masked_avx2<C>( a, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( m + 0 ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mask + 0 ) ) );
+        siphash_compress_masked_avx2<C>( b, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( m + 4 ) ), _mm256_loadu_si256( reinterpret_cast<__m256i const*>( mask + 4 ) ) );
+    }
+
+    __m256i ra = siphash_finalize_avx2<D>( a );
+    __m256i rb = siphash_finalize_avx2<D>( b );
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + 0 ), ra );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( out + 4 ), rb );
+}
+
+// k messages; a final partial group of eight is padded with empty ones
+
+template<int C, int D>
+BOOST_HASH2_TARGET("avx2")
+inline void siphash_64_batch_avx2( std::uint64_t const v[ 4 ], std::uint64_t n0, unsigned char const* const p[], std::size_t const n[], std::size_t k, std::uint64_t out[] ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 8 <= k; i += 8 )
+    {
+        detail::siphash_64_batch8_avx2<C, D>( v, n0, p + i, n + i, out + i );
+    }
+
+    if( i < k )
+    {
+        unsigned char const* q[ 8 ];
+        std::size_t m[ 8 ];
+        std::uint64_t r[ 8 ];
+
+        for( std::size_t j = 0; j < 8; ++j )
+        {
+            if( i + j < k )
+            {
+                q[ j ] = p[ i + j ];
+                m[ j ] = n[ i + j ];
+            }
+            else
+            {
+                q[ j ] = p[ i ];
+                m[ j ] = 0;
+            }
+        }
+
+        detail::siphash_64_batch8_avx2<C, D>( v, n0, q, m, r );
+
+        for( std::size_t j = 0; i + j < k; ++j )
+        {
+            out[ i + j ] = r[ j ];
+        }
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_SIPHASH_X86_HPP_INCLUDED
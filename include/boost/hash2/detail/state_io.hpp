@@ -0,0 +1,194 @@
+#ifndef BOOST_HASH2_DETAIL_STATE_IO_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_STATE_IO_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Serialization of hash algorithm states, used by save_state and load_state
+//
+// The serialized form starts with the format version, followed by the
+// state fields in declaration order; integers are stored in little endian
+// byte order, and std::size_t fields always take 8 bytes
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+BOOST_INLINE_CONSTEXPR unsigned char state_format_version = 1;
+
+class state_writer
+{
+private:
+
+    unsigned char* first_;
+    unsigned char* p_;
+
+public:
+
+    BOOST_CXX14_CONSTEXPR explicit state_writer( unsigned char* p ): first_( p ), p_( p )
+    {
+        *p_++ = state_format_version;
+    }
+
+    BOOST_CXX14_CONSTEXPR std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>( p_ - first_ );
+    }
+
+    template<class T> BOOST_CXX14_CONSTEXPR void u8( T const& v )
+    {
+        *p_++ = static_cast<unsigned char>( v );
+    }
+
+    template<class T> BOOST_CXX14_CONSTEXPR void u32( T const& v )
+    {
+        detail::write32le( p_, static_cast<std::uint32_t>( v ) );
+        p_ += 4;
+    }
+
+    template<class T> BOOST_CXX14_CONSTEXPR void u64( T const& v )
+    {
+        detail::write64le( p_, static_cast<std::uint64_t>( v ) );
+        p_ += 8;
+    }
+
+    // a std::uint32_t or std::uint64_t, or an array of them
+
+    template<class T> BOOST_CXX14_CONSTEXPR void word( T const & v )
+    {
+        static_assert( sizeof( T ) == 4 || sizeof( T ) == 8, "T must be std::uint32_t or std::uint64_t" );
+
+        if( sizeof( T ) == 4 )
+        {
+            u32( v );
+        }
+        else
+        {
+            u64( v );
+        }
+    }
+
+    template<class T, std::size_t N> BOOST_CXX14_CONSTEXPR void words( T const (&v)[ N ] )
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            word( v[ i ] );
+        }
+    }
+
+    template<std::size_t N> BOOST_CXX14_CONSTEXPR void bytes( unsigned char const (&v)[ N ] )
+    {
+        detail::memcpy( p_, v, N );
+        p_ += N;
+    }
+
+    // a nested hash algorithm, stored as its own serialized state
+
+    template<class H> BOOST_CXX14_CONSTEXPR void nested( H const& h )
+    {
+        h.save_state( p_ );
+        p_ += H::state_size;
+    }
+};
+
+class state_reader
+{
+private:
+
+    unsigned char const* first_;
+    unsigned char const* p_;
+    bool ok_;
+
+public:
+
+    BOOST_CXX14_CONSTEXPR explicit state_reader( unsigned char const* p ): first_( p ), p_( p + 1 ), ok_( *p == state_format_version )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR std::size_t size() const noexcept
+    {
+        return static_cast<std::size_t>( p_ - first_ );
+    }
+
+    // false if the version didn't match, or a nested state failed to load
+
+    BOOST_CXX14_CONSTEXPR bool ok() const noexcept
+    {
+        return ok_;
+    }
+
+    template<class T> BOOST_CXX14_CONSTEXPR void u8( T& v )
+    {
+        v = static_cast<T>( *p_++ );
+    }
+
+    template<class T> BOOST_CXX14_CONSTEXPR void u32( T& v )
+    {
+        v = static_cast<T>( detail::read32le( p_ ) );
+        p_ += 4;
+    }
+
+    template<class T> BOOST_CXX14_CONSTEXPR void u64( T& v )
+    {
+        std::uint64_t w = detail::read64le( p_ );
+        p_ += 8;
+
+        v = static_cast<T>( w );
+
+        // a std::size_t value that doesn't fit on this platform
+        if( static_cast<std::uint64_t>( v ) != w ) ok_ = false;
+    }
+
+    // a std::uint32_t or std::uint64_t, or an array of them
+
+    template<class T> BOOST_CXX14_CONSTEXPR void word( T & v )
+    {
+        static_assert( sizeof( T ) == 4 || sizeof( T ) == 8, "T must be std::uint32_t or std::uint64_t" );
+
+        if( sizeof( T ) == 4 )
+        {
+            u32( v );
+        }
+        else
+        {
+            u64( v );
+        }
+    }
+
+    template<class T, std::size_t N> BOOST_CXX14_CONSTEXPR void words( T (&v)[ N ] )
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            word( v[ i ] );
+        }
+    }
+
+    template<std::size_t N> BOOST_CXX14_CONSTEXPR void bytes( unsigned char (&v)[ N ] )
+    {
+        detail::memcpy( v, p_, N );
+        p_ += N;
+    }
+
+    template<class H> BOOST_CXX14_CONSTEXPR void nested( H& h )
+    {
+        if( !h.load_state( p_, H::state_size ) ) ok_ = false;
+        p_ += H::state_size;
+    }
+};
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_STATE_IO_HPP_INCLUDED
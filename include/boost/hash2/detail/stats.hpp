@@ -0,0 +1,308 @@
+#ifndef BOOST_HASH2_DETAIL_STATS_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_STATS_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Usage statistics of the hash algorithms
+//
+// When BOOST_HASH2_ENABLE_STATS is defined, the update, update_word and
+// result member functions of the hash algorithms count their calls, and
+// the bytes passed to them, in per-thread counters that stats_snapshot()
+// in <boost/hash2/stats.hpp> sums. The calls an algorithm makes to itself,
+// when seeding and when padding the message, are not counted. Otherwise,
+// the hooks expand to nothing.
+//
+// The macro needs to be defined consistently in all translation units.
+// Calls made during constant evaluation are not counted; neither are any
+// calls with compilers without __builtin_is_constant_evaluated, when the
+// member functions are constexpr.
+
+#if defined(BOOST_HASH2_ENABLE_STATS)
+
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// the number of distinct algorithms that can be counted; the ones used
+// after the limit is reached are ignored
+
+constexpr std::size_t stats_max_algorithms = 128;
+
+struct stats_counters
+{
+    // only written by the owning thread, with a relaxed load and store,
+    // and read by stats_snapshot
+
+    std::atomic<std::uint64_t> update_calls;
+    std::atomic<std::uint64_t> bytes;
+    std::atomic<std::uint64_t> result_calls;
+};
+
+// the counters of one thread; the padding keeps them off the cache lines
+// of the blocks of the other threads, and of whatever the allocator puts
+// next to them
+
+struct stats_block
+{
+    unsigned char pad1_[ 64 ];
+    stats_counters c[ stats_max_algorithms ];
+    unsigned char pad2_[ 64 ];
+};
+
+struct stats_registry
+{
+    std::mutex mx;
+
+    char const* names[ stats_max_algorithms ] = {};
+    std::size_t size = 0;
+
+    // the blocks of the threads that have used an algorithm and haven't
+    // exited yet
+
+    std::vector<stats_block*> blocks;
+
+    // the sums of the counters of the threads that have exited
+
+    std::uint64_t retired[ stats_max_algorithms ][ 3 ] = {};
+
+    // the block of the threads that use an algorithm after they've been
+    // retired, from destructors of thread_local variables
+
+    stats_block sink = {};
+};
+
+// never destroyed, so that the threads exiting during the destruction of
+// the static variables can still retire their counters
+
+inline stats_registry& stats_instance()
+{
+    static stats_registry* p = new stats_registry;
+    return *p;
+}
+
+// the index of the algorithm called `name`, or -1 when there's no room
+
+inline int stats_register( char const* name )
+{
+    stats_registry& r = stats_instance();
+    std::lock_guard<std::mutex> lock( r.mx );
+
+    for( std::size_t i = 0; i < r.size; ++i )
+    {
+        if( std::strcmp( r.names[ i ], name ) == 0 ) return static_cast<int>( i );
+    }
+
+    if( r.size == stats_max_algorithms ) return -1;
+
+    r.names[ r.size ] = name;
+    return static_cast<int>( r.size++ );
+}
+
+template<class Tag> int stats_index( char const* name )
+{
+    static int const i = detail::stats_register( name );
+    return i;
+}
+
+inline stats_block*& stats_current() noexcept
+{
+    static thread_local stats_block* p = nullptr;
+    return p;
+}
+
+// adds the counters of b to the retired sums, and releases it
+
+inline void stats_retire( stats_block* b )
+{
+    stats_registry& r = stats_instance();
+
+    {
+        std::lock_guard<std::mutex> lock( r.mx );
+
+        for( std::size_t i = 0; i < stats_max_algorithms; ++i )
+        {
+            r.retired[ i ][ 0 ] += b->c[ i ].update_calls.load( std::memory_order_relaxed );
+            r.retired[ i ][ 1 ] += b->c[ i ].bytes.load( std::memory_order_relaxed );
+            r.retired[ i ][ 2 ] += b->c[ i ].result_calls.load( std::memory_order_relaxed );
+        }
+
+        for( std::size_t i = 0; i < r.blocks.size(); ++i )
+        {
+            if( r.blocks[ i ] == b )
+            {
+                r.blocks[ i ] = r.blocks.back();
+                r.blocks.pop_back();
+                break;
+            }
+        }
+    }
+
+    delete b;
+}
+
+struct stats_thread
+{
+    stats_block* p = nullptr;
+
+    ~stats_thread()
+    {
+        detail::stats_retire( p );
+
+        // the calls made from here on are counted in the shared sink
+        detail::stats_current() = &stats_instance().sink;
+    }
+};
+
+BOOST_NOINLINE inline stats_block* stats_attach()
+{
+    stats_block* b = new stats_block();
+
+    {
+        stats_registry& r = stats_instance();
+        std::lock_guard<std::mutex> lock( r.mx );
+
+        r.blocks.push_back( b );
+    }
+
+    static thread_local stats_thread t;
+    t.p = b;
+
+    return detail::stats_current() = b;
+}
+
+inline stats_block* stats_this_thread()
+{
+    stats_block* p = detail::stats_current();
+
+    if( p == nullptr )
+    {
+        p = detail::stats_attach();
+    }
+
+    return p;
+}
+
+// nonzero while an algorithm calls its own member functions
+
+inline int& stats_suspended() noexcept
+{
+    static thread_local int n = 0;
+    return n;
+}
+
+inline void stats_add( std::atomic<std::uint64_t>& c, std::uint64_t n ) noexcept
+{
+    c.store( c.load( std::memory_order_relaxed ) + n, std::memory_order_relaxed );
+}
+
+template<class Tag> void stats_update( char const* name, std::size_t n )
+{
+    if( detail::stats_suspended() != 0 ) return;
+
+    int const i = detail::stats_index<Tag>( name );
+
+    if( i < 0 ) return;
+
+    stats_counters& c = detail::stats_this_thread()->c[ i ];
+
+    detail::stats_add( c.update_calls, 1 );
+    detail::stats_add( c.bytes, n );
+}
+
+template<class Tag> void stats_result( char const* name )
+{
+    if( detail::stats_suspended() != 0 ) return;
+
+    int const i = detail::stats_index<Tag>( name );
+
+    if( i < 0 ) return;
+
+    stats_counters& c = detail::stats_this_thread()->c[ i ];
+
+    detail::stats_add( c.result_calls, 1 );
+}
+
+// k messages, of `bytes` bytes in total, hashed by a one-shot or a batch
+// member function; counted as k calls to update and to result
+
+template<class Tag> void stats_messages( char const* name, std::size_t k, std::uint64_t bytes )
+{
+    if( detail::stats_suspended() != 0 ) return;
+
+    int const i = detail::stats_index<Tag>( name );
+
+    if( i < 0 ) return;
+
+    stats_counters& c = detail::stats_this_thread()->c[ i ];
+
+    detail::stats_add( c.update_calls, k );
+    detail::stats_add( c.bytes, bytes );
+    detail::stats_add( c.result_calls, k );
+}
+
+// k messages, of n[ 0 ], ..., n[ k - 1 ] bytes
+
+template<class Tag> void stats_batch( char const* name, std::size_t const* n, std::size_t k )
+{
+    std::uint64_t m = 0;
+
+    for( std::size_t j = 0; j < k; ++j )
+    {
+        m += n[ j ];
+    }
+
+    detail::stats_messages<Tag>( name, k, m );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+// Tag is a type unique to the algorithm, usually the class itself; name
+// is a string literal, the name under which it's reported
+
+#define BOOST_HASH2_STATS_UPDATE(Tag, name, n) \
+    ( ::boost::hash2::detail::is_constant_evaluated()? (void)0: ::boost::hash2::detail::stats_update<Tag>( name, n ) )
+
+#define BOOST_HASH2_STATS_RESULT(Tag, name) \
+    ( ::boost::hash2::detail::is_constant_evaluated()? (void)0: ::boost::hash2::detail::stats_result<Tag>( name ) )
+
+#define BOOST_HASH2_STATS_MESSAGES(Tag, name, k, bytes) \
+    ( ::boost::hash2::detail::is_constant_evaluated()? (void)0: ::boost::hash2::detail::stats_messages<Tag>( name, k, bytes ) )
+
+#define BOOST_HASH2_STATS_BATCH(Tag, name, n, k) \
+    ( ::boost::hash2::detail::is_constant_evaluated()? (void)0: ::boost::hash2::detail::stats_batch<Tag>( name, n, k ) )
+
+// around the calls an algorithm makes to itself
+
+#define BOOST_HASH2_STATS_SUSPEND() \
+    ( ::boost::hash2::detail::is_constant_evaluated()? (void)0: (void)++::boost::hash2::detail::stats_suspended() )
+
+#define BOOST_HASH2_STATS_RESUME() \
+    ( ::boost::hash2::detail::is_constant_evaluated()? (void)0: (void)--::boost::hash2::detail::stats_suspended() )
+
+#else
+
+#define BOOST_HASH2_STATS_UPDATE(Tag, name, n) ((void)0)
+#define BOOST_HASH2_STATS_RESULT(Tag, name) ((void)0)
+#define BOOST_HASH2_STATS_MESSAGES(Tag, name, k, bytes) ((void)0)
+#define BOOST_HASH2_STATS_BATCH(Tag, name, n, k) ((void)0)
+#define BOOST_HASH2_STATS_SUSPEND() ((void)0)
+#define BOOST_HASH2_STATS_RESUME() ((void)0)
+
+#endif // #if defined(BOOST_HASH2_ENABLE_STATS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_STATS_HPP_INCLUDED
@@ -0,0 +1,174 @@
+#ifndef BOOST_HASH2_DETAIL_TOEPLITZ_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_TOEPLITZ_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The Toeplitz hash using PCLMULQDQ, with the bit reversal done by SSSE3
+// or GFNI
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// Bit j of the hash, counting from the most significant, is the xor of
+// x_i k_(i+j) over the input bits x_i, in transmission order, and the key
+// bits k_m. For a qword of input at key position q, the 96 key bits from
+// byte q on form K = sum k_m t^(95-m); when the bits of each input byte
+// are reversed, the little endian qword is A = sum x_i t^i, and bit j of
+// the hash is the coefficient of t^(95-j) of A K. So the contribution of
+// the qword is bits 64 to 95 of the carry-less product of A and K, that
+// is, of A with the low 64 bits of K, plus A with the high 32 bits of K
+// shifted left by 64.
+//
+// w[ q ] holds the key bytes q to q + 7, big endian, wrapping around at k;
+// the high 32 bits of K are those of w[ q ], and its low 64 bits are
+// w[ q + 4 ]. n is a multiple of 8.
+
+inline void toeplitz_advance( std::uint32_t& q, std::uint32_t d, std::uint32_t k ) noexcept
+{
+    q += d;
+
+    while( q >= k )
+    {
+        q -= k;
+    }
+}
+
+BOOST_HASH2_TARGET("ssse3")
+inline __m128i toeplitz_reverse_bits_ssse3( __m128i x ) noexcept
+{
+    // the bits of a nibble, reversed, in the high and in the low nibble
+
+    __m128i const r_hi = _mm_set_epi64x( static_cast<long long>( 0xF070B030D0509010ull ), static_cast<long long>( 0xE060A020C0408000ull ) );
+    __m128i const r_lo = _mm_set_epi64x( static_cast<long long>( 0x0F070B030D050901ull ), static_cast<long long>( 0x0E060A020C040800ull ) );
+
+    __m128i const m = _mm_set1_epi8( 0x0F );
+
+    __m128i a = _mm_shuffle_epi8( r_hi, _mm_and_si128( x, m ) );
+    __m128i b = _mm_shuffle_epi8( r_lo, _mm_and_si128( _mm_srli_epi16( x, 4 ), m ) );
+
+    return _mm_or_si128( a, b );
+}
+
+BOOST_HASH2_TARGET("gfni")
+inline __m128i toeplitz_reverse_bits_gfni( __m128i x ) noexcept
+{
+    // the affine transform by the antidiagonal matrix
+
+    return _mm_gf2p8affine_epi64_epi8( x, _mm_set1_epi64x( 0x8040201008040201ll ), 0 );
+}
+
+// K for the qword at position q; q4 is q + 4, modulo k
+
+BOOST_HASH2_TARGET("sse2")
+inline __m128i toeplitz_key( std::uint64_t const* w, std::uint32_t q, std::uint32_t q4 ) noexcept
+{
+    return _mm_set_epi64x( static_cast<long long>( w[ q ] >> 32 ), static_cast<long long>( w[ q4 ] ) );
+}
+
+BOOST_HASH2_TARGET("pclmul")
+inline __m128i toeplitz_multiply( __m128i a, __m128i k0, __m128i k1 ) noexcept
+{
+    // the low qword of a with k0, the high qword with k1
+
+    __m128i r = _mm_xor_si128( _mm_clmulepi64_si128( a, k0, 0x00 ), _mm_clmulepi64_si128( a, k1, 0x01 ) );
+    __m128i s = _mm_xor_si128( _mm_clmulepi64_si128( a, k0, 0x10 ), _mm_clmulepi64_si128( a, k1, 0x11 ) );
+
+    return _mm_xor_si128( r, _mm_slli_si128( s, 8 ) );
+}
+
+BOOST_HASH2_TARGET("ssse3,pclmul")
+inline std::uint32_t toeplitz_update_ssse3( std::uint64_t const* w, std::uint32_t k, std::uint32_t q, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::uint32_t q4 = q;
+    detail::toeplitz_advance( q4, 4, k );
+
+    __m128i acc = _mm_setzero_si128();
+
+    for( ; n >= 16; p += 16, n -= 16 )
+    {
+        __m128i a = detail::toeplitz_reverse_bits_ssse3( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) ) );
+
+        __m128i k0 = detail::toeplitz_key( w, q, q4 );
+
+        detail::toeplitz_advance( q, 8, k );
+        detail::toeplitz_advance( q4, 8, k );
+
+        __m128i k1 = detail::toeplitz_key( w, q, q4 );
+
+        detail::toeplitz_advance( q, 8, k );
+        detail::toeplitz_advance( q4, 8, k );
+
+        acc = _mm_xor_si128( acc, detail::toeplitz_multiply( a, k0, k1 ) );
+    }
+
+    if( n != 0 )
+    {
+        __m128i a = detail::toeplitz_reverse_bits_ssse3( _mm_loadl_epi64( reinterpret_cast<__m128i const*>( p ) ) );
+
+        __m128i k0 = detail::toeplitz_key( w, q, q4 );
+
+        acc = _mm_xor_si128( acc, detail::toeplitz_multiply( a, k0, _mm_setzero_si128() ) );
+    }
+
+    return static_cast<std::uint32_t>( _mm_cvtsi128_si32( _mm_srli_si128( acc, 8 ) ) );
+}
+
+BOOST_HASH2_TARGET("gfni,pclmul")
+inline std::uint32_t toeplitz_update_gfni( std::uint64_t const* w, std::uint32_t k, std::uint32_t q, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::uint32_t q4 = q;
+    detail::toeplitz_advance( q4, 4, k );
+
+    __m128i acc = _mm_setzero_si128();
+
+    for( ; n >= 16; p += 16, n -= 16 )
+    {
+        __m128i a = detail::toeplitz_reverse_bits_gfni( _mm_loadu_si128( reinterpret_cast<__m128i const*>( p ) ) );
+
+        __m128i k0 = detail::toeplitz_key( w, q, q4 );
+
+        detail::toeplitz_advance( q, 8, k );
+        detail::toeplitz_advance( q4, 8, k );
+
+        __m128i k1 = detail::toeplitz_key( w, q, q4 );
+
+        detail::toeplitz_advance( q, 8, k );
+        detail::toeplitz_advance( q4, 8, k );
+
+        acc = _mm_xor_si128( acc, detail::toeplitz_multiply( a, k0, k1 ) );
+    }
+
+    if( n != 0 )
+    {
+        __m128i a = detail::toeplitz_reverse_bits_gfni( _mm_loadl_epi64( reinterpret_cast<__m128i const*>( p ) ) );
+
+        __m128i k0 = detail::toeplitz_key( w, q, q4 );
+
+        acc = _mm_xor_si128( acc, detail::toeplitz_multiply( a, k0, _mm_setzero_si128() ) );
+    }
+
+    return static_cast<std::uint32_t>( _mm_cvtsi128_si32( _mm_srli_si128( acc, 8 ) ) );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_TOEPLITZ_X86_HPP_INCLUDED
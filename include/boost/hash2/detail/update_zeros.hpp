@@ -0,0 +1,77 @@
+#ifndef BOOST_HASH2_DETAIL_UPDATE_ZEROS_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_UPDATE_ZEROS_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// Hash::update_zeros( std::uint64_t n ) is an optional member, equivalent
+// to update( p, n ), where p points to n zero bytes, and typically much
+// faster; the checksums whose state is linear in the input have it
+
+template<class Hash, class En = void> struct has_update_zeros: std::false_type
+{
+};
+
+template<class Hash> struct has_update_zeros<Hash, decltype( std::declval<Hash&>().update_zeros( std::uint64_t() ), void() )>: std::true_type
+{
+};
+
+// a page of zeros, shared by all hash algorithms without update_zeros
+
+template<class = void> struct zero_page
+{
+    static constexpr std::size_t size = 64 * 1024;
+    static constexpr unsigned char data[ size ] = {};
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T> constexpr std::size_t zero_page<T>::size;
+template<class T> constexpr unsigned char zero_page<T>::data[ zero_page<T>::size ];
+
+#endif
+
+template<class Hash> void update_zeros( Hash& h, std::uint64_t n, std::true_type )
+{
+    h.update_zeros( n );
+}
+
+template<class Hash> void update_zeros( Hash& h, std::uint64_t n, std::false_type )
+{
+    std::size_t const N = zero_page<>::size;
+
+    while( n > 0 )
+    {
+        std::size_t const m = n < N? static_cast<std::size_t>( n ): N;
+
+        h.update( zero_page<>::data, m );
+        n -= m;
+    }
+}
+
+// passes n zero bytes to h
+
+template<class Hash> void update_zeros( Hash& h, std::uint64_t n )
+{
+    detail::update_zeros( h, n, has_update_zeros<Hash>() );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DETAIL_UPDATE_ZEROS_HPP_INCLUDED
@@ -7,6 +7,7 @@
 
 #include <boost/hash2/endian.hpp>
 #include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/bswap.hpp>
 #include <boost/config.hpp>
 #include <type_traits>
 #include <cstdint>
@@ -27,6 +28,11 @@ BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void write16le( unsigned char* p, std::u
     {
         std::memcpy( p, &v, sizeof(v) );
     }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        v = detail::bswap16( v );
+        std::memcpy( p, &v, sizeof(v) );
+    }
     else
     {
         p[0] = static_cast<unsigned char>( v & 0xFF );
@@ -40,6 +46,11 @@ BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void write32le( unsigned char* p, std::u
     {
         std::memcpy( p, &v, sizeof(v) );
     }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        v = detail::bswap32( v );
+        std::memcpy( p, &v, sizeof(v) );
+    }
     else
     {
         p[0] = static_cast<unsigned char>( v & 0xFF );
@@ -55,6 +66,11 @@ BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void write64le( unsigned char* p, std::u
     {
         std::memcpy( p, &v, sizeof(v) );
     }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        v = detail::bswap64( v );
+        std::memcpy( p, &v, sizeof(v) );
+    }
     else
     {
         p[0] = static_cast<unsigned char>( v & 0xFF );
@@ -72,28 +88,64 @@ BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void write64le( unsigned char* p, std::u
 
 BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void write16be( unsigned char* p, std::uint16_t v ) noexcept
 {
-    p[0] = static_cast<unsigned char>( ( v >> 8 ) & 0xFF );
-    p[1] = static_cast<unsigned char>( v & 0xFF );
+    if( !detail::is_constant_evaluated() && endian::native == endian::little )
+    {
+        v = detail::bswap16( v );
+        std::memcpy( p, &v, sizeof(v) );
+    }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        std::memcpy( p, &v, sizeof(v) );
+    }
+    else
+    {
+        p[0] = static_cast<unsigned char>( ( v >> 8 ) & 0xFF );
+        p[1] = static_cast<unsigned char>( v & 0xFF );
+    }
 }
 
 BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void write32be( unsigned char* p, std::uint32_t v ) noexcept
 {
-    p[0] = static_cast<unsigned char>( ( v >> 24 ) & 0xFF );
-    p[1] = static_cast<unsigned char>( ( v >> 16 ) & 0xFF );
-    p[2] = static_cast<unsigned char>( ( v >>  8 ) & 0xFF );
-    p[3] = static_cast<unsigned char>( v & 0xFF );
+    if( !detail::is_constant_evaluated() && endian::native == endian::little )
+    {
+        v = detail::bswap32( v );
+        std::memcpy( p, &v, sizeof(v) );
+    }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        std::memcpy( p, &v, sizeof(v) );
+    }
+    else
+    {
+        p[0] = static_cast<unsigned char>( ( v >> 24 ) & 0xFF );
+        p[1] = static_cast<unsigned char>( ( v >> 16 ) & 0xFF );
+        p[2] = static_cast<unsigned char>( ( v >>  8 ) & 0xFF );
+        p[3] = static_cast<unsigned char>( v & 0xFF );
+    }
 }
 
 BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR void write64be( unsigned char* p, std::uint64_t v ) noexcept
 {
-    p[0] = static_cast<unsigned char>( ( v >> 56 ) & 0xFF );
-    p[1] = static_cast<unsigned char>( ( v >> 48 ) & 0xFF );
-    p[2] = static_cast<unsigned char>( ( v >> 40 ) & 0xFF );
-    p[3] = static_cast<unsigned char>( ( v >> 32 ) & 0xFF );
-    p[4] = static_cast<unsigned char>( ( v >> 24 ) & 0xFF );
-    p[5] = static_cast<unsigned char>( ( v >> 16 ) & 0xFF );
-    p[6] = static_cast<unsigned char>( ( v >>  8 ) & 0xFF );
-    p[7] = static_cast<unsigned char>( v & 0xFF );
+    if( !detail::is_constant_evaluated() && endian::native == endian::little )
+    {
+        v = detail::bswap64( v );
+        std::memcpy( p, &v, sizeof(v) );
+    }
+    else if( !detail::is_constant_evaluated() && endian::native == endian::big )
+    {
+        std::memcpy( p, &v, sizeof(v) );
+    }
+    else
+    {
+        p[0] = static_cast<unsigned char>( ( v >> 56 ) & 0xFF );
+        p[1] = static_cast<unsigned char>( ( v >> 48 ) & 0xFF );
+        p[2] = static_cast<unsigned char>( ( v >> 40 ) & 0xFF );
+        p[3] = static_cast<unsigned char>( ( v >> 32 ) & 0xFF );
+        p[4] = static_cast<unsigned char>( ( v >> 24 ) & 0xFF );
+        p[5] = static_cast<unsigned char>( ( v >> 16 ) & 0xFF );
+        p[6] = static_cast<unsigned char>( ( v >>  8 ) & 0xFF );
+        p[7] = static_cast<unsigned char>( v & 0xFF );
+    }
 }
 
 // any endian
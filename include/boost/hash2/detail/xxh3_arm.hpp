@@ -0,0 +1,82 @@
+#ifndef BOOST_HASH2_DETAIL_XXH3_ARM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_XXH3_ARM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// XXH3 stripe accumulation using NEON
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#include <arm_neon.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+inline void xxh3_accumulate_neon( std::uint64_t acc[ 8 ], unsigned char const* p, unsigned char const* secret, std::size_t n ) noexcept
+{
+    uint64x2_t a[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        a[ i ] = vld1q_u64( acc + i * 2 );
+    }
+
+    for( std::size_t k = 0; k < n; ++k, p += 64, secret += 8 )
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            uint64x2_t data = vreinterpretq_u64_u8( vld1q_u8( p + i * 16 ) );
+            uint64x2_t key = vreinterpretq_u64_u8( vld1q_u8( secret + i * 16 ) );
+
+            uint64x2_t dk = veorq_u64( data, key );
+
+            // the input is added to the adjacent lane
+            a[ i ] = vaddq_u64( a[ i ], vextq_u64( data, data, 1 ) );
+
+            // low 32 bits times high 32 bits of each 64 bit lane
+            a[ i ] = vmlal_u32( a[ i ], vmovn_u64( dk ), vshrn_n_u64( dk, 32 ) );
+        }
+    }
+
+    for( int i = 0; i < 4; ++i )
+    {
+        vst1q_u64( acc + i * 2, a[ i ] );
+    }
+}
+
+inline void xxh3_scramble_neon( std::uint64_t acc[ 8 ], unsigned char const* secret ) noexcept
+{
+    uint32x2_t const prime = vdup_n_u32( 0x9E3779B1u );
+
+    for( int i = 0; i < 4; ++i )
+    {
+        uint64x2_t a = vld1q_u64( acc + i * 2 );
+        uint64x2_t key = vreinterpretq_u64_u8( vld1q_u8( secret + i * 16 ) );
+
+        a = veorq_u64( veorq_u64( a, vshrq_n_u64( a, 47 ) ), key );
+
+        // a * prime, 64 x 32 bits
+        uint64x2_t hi = vshlq_n_u64( vmull_u32( vshrn_n_u64( a, 32 ), prime ), 32 );
+        a = vmlal_u32( hi, vmovn_u64( a ), prime );
+
+        vst1q_u64( acc + i * 2, a );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_XXH3_ARM_HPP_INCLUDED
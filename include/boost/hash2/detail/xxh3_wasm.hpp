@@ -0,0 +1,82 @@
+#ifndef BOOST_HASH2_DETAIL_XXH3_WASM_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_XXH3_WASM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// XXH3 stripe accumulation using WebAssembly SIMD128
+
+#include <boost/hash2/detail/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+#include <wasm_simd128.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+inline void xxh3_accumulate_wasm( std::uint64_t acc[ 8 ], unsigned char const* p, unsigned char const* secret, std::size_t n ) noexcept
+{
+    v128_t a[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        a[ i ] = wasm_v128_load( acc + i * 2 );
+    }
+
+    for( std::size_t k = 0; k < n; ++k, p += 64, secret += 8 )
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            v128_t data = wasm_v128_load( p + i * 16 );
+            v128_t key = wasm_v128_load( secret + i * 16 );
+
+            v128_t dk = wasm_v128_xor( data, key );
+
+            // the input is added to the adjacent lane
+            a[ i ] = wasm_i64x2_add( a[ i ], wasm_i64x2_shuffle( data, data, 1, 0 ) );
+
+            // low 32 bits times high 32 bits of each 64 bit lane
+            v128_t lo = wasm_i32x4_shuffle( dk, dk, 0, 2, 0, 2 );
+            v128_t hi = wasm_i32x4_shuffle( dk, dk, 1, 3, 1, 3 );
+
+            a[ i ] = wasm_i64x2_add( a[ i ], wasm_u64x2_extmul_low_u32x4( lo, hi ) );
+        }
+    }
+
+    for( int i = 0; i < 4; ++i )
+    {
+        wasm_v128_store( acc + i * 2, a[ i ] );
+    }
+}
+
+inline void xxh3_scramble_wasm( std::uint64_t acc[ 8 ], unsigned char const* secret ) noexcept
+{
+    v128_t const prime = wasm_i64x2_splat( 0x9E3779B1 );
+
+    for( int i = 0; i < 4; ++i )
+    {
+        v128_t a = wasm_v128_load( acc + i * 2 );
+        v128_t key = wasm_v128_load( secret + i * 16 );
+
+        a = wasm_v128_xor( wasm_v128_xor( a, wasm_u64x2_shr( a, 47 ) ), key );
+        a = wasm_i64x2_mul( a, prime );
+
+        wasm_v128_store( acc + i * 2, a );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_XXH3_WASM_HPP_INCLUDED
@@ -0,0 +1,142 @@
+#ifndef BOOST_HASH2_DETAIL_XXH3_X86_HPP_INCLUDED
+#define BOOST_HASH2_DETAIL_XXH3_X86_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// XXH3 stripe accumulation using SSE2 and AVX2
+
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#include <immintrin.h>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// The accumulate functions process n stripes of 64 bytes from p, the secret
+// advancing by 8 bytes per stripe; scramble is applied at the end of a block
+
+// SSE2
+
+BOOST_HASH2_TARGET("sse2")
+inline void xxh3_accumulate_sse2( std::uint64_t acc[ 8 ], unsigned char const* p, unsigned char const* secret, std::size_t n ) noexcept
+{
+    __m128i a[ 4 ];
+
+    for( int i = 0; i < 4; ++i )
+    {
+        a[ i ] = _mm_loadu_si128( reinterpret_cast<__m128i const*>( acc + i * 2 ) );
+    }
+
+    for( std::size_t k = 0; k < n; ++k, p += 64, secret += 8 )
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            __m128i data = _mm_loadu_si128( reinterpret_cast<__m128i const*>( p + i * 16 ) );
+            __m128i key = _mm_loadu_si128( reinterpret_cast<__m128i const*>( secret + i * 16 ) );
+
+            __m128i dk = _mm_xor_si128( data, key );
+
+            // low 32 bits times high 32 bits of each 64 bit lane
+            __m128i product = _mm_mul_epu32( dk, _mm_shuffle_epi32( dk, _MM_SHUFFLE( 0, 3, 0, 1 ) ) );
+
+            // the input is added to the adjacent lane
+            __m128i swapped = _mm_shuffle_epi32( data, _MM_SHUFFLE( 1, 0, 3, 2 ) );
+
+            a[ i ] = _mm_add_epi64( a[ i ], _mm_add_epi64( product, swapped ) );
+        }
+    }
+
+    for( int i = 0; i < 4; ++i )
+    {
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( acc + i * 2 ), a[ i ] );
+    }
+}
+
+BOOST_HASH2_TARGET("sse2")
+inline void xxh3_scramble_sse2( std::uint64_t acc[ 8 ], unsigned char const* secret ) noexcept
+{
+    __m128i const prime = _mm_set1_epi32( static_cast<int>( 0x9E3779B1u ) );
+
+    for( int i = 0; i < 4; ++i )
+    {
+        __m128i a = _mm_loadu_si128( reinterpret_cast<__m128i const*>( acc + i * 2 ) );
+        __m128i key = _mm_loadu_si128( reinterpret_cast<__m128i const*>( secret + i * 16 ) );
+
+        a = _mm_xor_si128( _mm_xor_si128( a, _mm_srli_epi64( a, 47 ) ), key );
+
+        // a * prime, 64 x 32 bits
+        __m128i lo = _mm_mul_epu32( a, prime );
+        __m128i hi = _mm_mul_epu32( _mm_shuffle_epi32( a, _MM_SHUFFLE( 0, 3, 0, 1 ) ), prime );
+
+        a = _mm_add_epi64( lo, _mm_slli_epi64( hi, 32 ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( acc + i * 2 ), a );
+    }
+}
+
+// AVX2
+
+BOOST_HASH2_TARGET("avx2")
+inline void xxh3_accumulate_avx2( std::uint64_t acc[ 8 ], unsigned char const* p, unsigned char const* secret, std::size_t n ) noexcept
+{
+    __m256i a0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( acc + 0 ) );
+    __m256i a1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( acc + 4 ) );
+
+    for( std::size_t k = 0; k < n; ++k, p += 64, secret += 8 )
+    {
+        __m256i d0 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 0 ) );
+        __m256i d1 = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( p + 32 ) );
+
+        __m256i k0 = _mm256_xor_si256( d0, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( secret + 0 ) ) );
+        __m256i k1 = _mm256_xor_si256( d1, _mm256_loadu_si256( reinterpret_cast<__m256i const*>( secret + 32 ) ) );
+
+        __m256i p0 = _mm256_mul_epu32( k0, _mm256_shuffle_epi32( k0, _MM_SHUFFLE( 0, 3, 0, 1 ) ) );
+        __m256i p1 = _mm256_mul_epu32( k1, _mm256_shuffle_epi32( k1, _MM_SHUFFLE( 0, 3, 0, 1 ) ) );
+
+        a0 = _mm256_add_epi64( a0, _mm256_add_epi64( p0, _mm256_shuffle_epi32( d0, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) );
+        a1 = _mm256_add_epi64( a1, _mm256_add_epi64( p1, _mm256_shuffle_epi32( d1, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ) );
+    }
+
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( acc + 0 ), a0 );
+    _mm256_storeu_si256( reinterpret_cast<__m256i*>( acc + 4 ), a1 );
+}
+
+BOOST_HASH2_TARGET("avx2")
+inline void xxh3_scramble_avx2( std::uint64_t acc[ 8 ], unsigned char const* secret ) noexcept
+{
+    __m256i const prime = _mm256_set1_epi32( static_cast<int>( 0x9E3779B1u ) );
+
+    for( int i = 0; i < 2; ++i )
+    {
+        __m256i a = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( acc + i * 4 ) );
+        __m256i key = _mm256_loadu_si256( reinterpret_cast<__m256i const*>( secret + i * 32 ) );
+
+        a = _mm256_xor_si256( _mm256_xor_si256( a, _mm256_srli_epi64( a, 47 ) ), key );
+
+        __m256i lo = _mm256_mul_epu32( a, prime );
+        __m256i hi = _mm256_mul_epu32( _mm256_shuffle_epi32( a, _MM_SHUFFLE( 0, 3, 0, 1 ) ), prime );
+
+        a = _mm256_add_epi64( lo, _mm256_slli_epi64( hi, 32 ) );
+
+        _mm256_storeu_si256( reinterpret_cast<__m256i*>( acc + i * 4 ), a );
+    }
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
+
+#endif // #if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+#endif // #ifndef BOOST_HASH2_DETAIL_XXH3_X86_HPP_INCLUDED
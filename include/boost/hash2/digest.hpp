@@ -6,11 +6,15 @@
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/hash2/detail/memcpy.hpp>
-#include <boost/hash2/detail/memcmp.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/hex.hpp>
+#include <boost/hash2/detail/base64.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <string>
 #include <iosfwd>
+#include <cstdint>
 #include <cstddef>
 
 namespace boost
@@ -73,9 +77,20 @@ public:
 
 // comparisons
 
+// operator== takes the same time regardless of where the digests differ,
+// so that comparing a computed MAC against a received one doesn't leak
+// the length of the matching prefix
+
 template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator==( digest<N> const& a, digest<N> const& b ) noexcept
 {
-    return detail::memcmp( a.data(), b.data(), N ) == 0;
+    unsigned char r = 0;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        r = static_cast<unsigned char>( r | ( a[ i ] ^ b[ i ] ) );
+    }
+
+    return r == 0;
 }
 
 template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator!=( digest<N> const& a, digest<N> const& b ) noexcept
@@ -83,6 +98,46 @@ template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator!=( digest<N> const&
     return !( a == b );
 }
 
+// operator< orders the digests lexicographically, as unsigned bytes, which
+// is also the order of their hexadecimal representations; unlike operator==,
+// it returns as soon as the digests differ. The bytes are compared eight
+// at a time, as big endian words
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator<( digest<N> const& a, digest<N> const& b ) noexcept
+{
+    std::size_t i = 0;
+
+    for( ; i + 8 <= N; i += 8 )
+    {
+        std::uint64_t const x = detail::read64be( a.data() + i );
+        std::uint64_t const y = detail::read64be( b.data() + i );
+
+        if( x != y ) return x < y;
+    }
+
+    for( ; i < N; ++i )
+    {
+        if( a[ i ] != b[ i ] ) return a[ i ] < b[ i ];
+    }
+
+    return false;
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator>( digest<N> const& a, digest<N> const& b ) noexcept
+{
+    return b < a;
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator<=( digest<N> const& a, digest<N> const& b ) noexcept
+{
+    return !( b < a );
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator>=( digest<N> const& a, digest<N> const& b ) noexcept
+{
+    return !( a < b );
+}
+
 // to_chars
 
 template<std::size_t N> BOOST_CXX14_CONSTEXPR char* to_chars( digest<N> const& v, char* first, char* last ) noexcept
@@ -92,13 +147,7 @@ template<std::size_t N> BOOST_CXX14_CONSTEXPR char* to_chars( digest<N> const& v
         return nullptr;
     }
 
-    constexpr char digits[] = "0123456789abcdef";
-
-    for( std::size_t i = 0; i < N; ++i )
-    {
-        first[ i*2 + 0 ] = digits[ v[i] >> 4 ];
-        first[ i*2 + 1 ] = digits[ v[i] & 0x0F ];
-    }
+    detail::hex_encode( v.data(), N, first );
 
     return first + N * 2;
 }
@@ -109,6 +158,174 @@ template<std::size_t N, std::size_t M> BOOST_CXX14_CONSTEXPR void to_chars( dige
     *to_chars( v, w, w + M ) = 0;
 }
 
+// to_chars for a sequence of digests, concatenates their representations
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR char* to_chars( digest<N> const* p, std::size_t n, char* first, char* last ) noexcept
+{
+    if( static_cast<std::size_t>( last - first ) / ( 2 * N ) < n )
+    {
+        return nullptr;
+    }
+
+    if( !detail::is_constant_evaluated() )
+    {
+        // the digests are contiguous, and are encoded as a single byte sequence
+        static_assert( sizeof( digest<N> ) == N, "digest<N> must not have padding" );
+
+        if( n > 0 )
+        {
+            detail::hex_encode( p->data(), n * N, first );
+        }
+
+        return first + n * N * 2;
+    }
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        first = to_chars( p[ i ], first, last );
+    }
+
+    return first;
+}
+
+// from_chars
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR char const* from_chars( char const* first, char const* last, digest<N>& v ) noexcept
+{
+    if( last - first < static_cast<std::ptrdiff_t>( 2 * N ) )
+    {
+        return nullptr;
+    }
+
+    digest<N> tmp;
+
+    if( !detail::hex_decode( first, N, tmp.data() ) )
+    {
+        return nullptr;
+    }
+
+    v = tmp;
+    return first + N * 2;
+}
+
+// from_chars for a sequence of digests, the inverse of the to_chars above
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR char const* from_chars( char const* first, char const* last, digest<N>* p, std::size_t n ) noexcept
+{
+    if( static_cast<std::size_t>( last - first ) / ( 2 * N ) < n )
+    {
+        return nullptr;
+    }
+
+    if( !detail::is_constant_evaluated() )
+    {
+        static_assert( sizeof( digest<N> ) == N, "digest<N> must not have padding" );
+
+        if( n > 0 && !detail::hex_decode( first, n * N, p->data() ) )
+        {
+            return nullptr;
+        }
+
+        return first + n * N * 2;
+    }
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( !detail::hex_decode( first, N, p[ i ].data() ) )
+        {
+            return nullptr;
+        }
+
+        first += N * 2;
+    }
+
+    return first;
+}
+
+// to_base64, to_base64url
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR char* to_base64( digest<N> const& v, char* first, char* last ) noexcept
+{
+    constexpr std::size_t K = detail::base64_size( N, true );
+
+    if( last - first < static_cast<std::ptrdiff_t>( K ) )
+    {
+        return nullptr;
+    }
+
+    detail::base64_encode( v.data(), N, first, false, true );
+
+    return first + K;
+}
+
+template<std::size_t N, std::size_t M> BOOST_CXX14_CONSTEXPR void to_base64( digest<N> const& v, char (&w)[ M ] ) noexcept
+{
+    static_assert( M >= detail::base64_size( N, true ) + 1, "Output buffer not large enough" );
+    *to_base64( v, w, w + M ) = 0;
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR char* to_base64url( digest<N> const& v, char* first, char* last ) noexcept
+{
+    constexpr std::size_t K = detail::base64_size( N, false );
+
+    if( last - first < static_cast<std::ptrdiff_t>( K ) )
+    {
+        return nullptr;
+    }
+
+    detail::base64_encode( v.data(), N, first, true, false );
+
+    return first + K;
+}
+
+template<std::size_t N, std::size_t M> BOOST_CXX14_CONSTEXPR void to_base64url( digest<N> const& v, char (&w)[ M ] ) noexcept
+{
+    static_assert( M >= detail::base64_size( N, false ) + 1, "Output buffer not large enough" );
+    *to_base64url( v, w, w + M ) = 0;
+}
+
+// from_base64, from_base64url
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR char const* from_base64( char const* first, char const* last, digest<N>& v ) noexcept
+{
+    constexpr std::size_t K = detail::base64_size( N, true );
+
+    if( last - first < static_cast<std::ptrdiff_t>( K ) )
+    {
+        return nullptr;
+    }
+
+    digest<N> tmp;
+
+    if( !detail::base64_decode( first, N, tmp.data(), false, true ) )
+    {
+        return nullptr;
+    }
+
+    v = tmp;
+    return first + K;
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR char const* from_base64url( char const* first, char const* last, digest<N>& v ) noexcept
+{
+    constexpr std::size_t K = detail::base64_size( N, false );
+
+    if( last - first < static_cast<std::ptrdiff_t>( K ) )
+    {
+        return nullptr;
+    }
+
+    digest<N> tmp;
+
+    if( !detail::base64_decode( first, N, tmp.data(), true, false ) )
+    {
+        return nullptr;
+    }
+
+    v = tmp;
+    return first + K;
+}
+
 // operator<<
 
 template<std::size_t N> std::ostream& operator<<( std::ostream& os, digest<N> const& v )
@@ -0,0 +1,583 @@
+#ifndef BOOST_HASH2_DIGEST_CACHE_HPP_INCLUDED
+#define BOOST_HASH2_DIGEST_CACHE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// digest_cache, a persistent cache of the digests of files, keyed by
+// their identity (device and inode) and validated by their size, mtime
+// and ctime, so that unchanged files aren't hashed again
+
+#include <boost/hash2/hash_file.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/config.hpp>
+#include <mutex>
+#include <system_error>
+#include <vector>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+# include <sys/file.h>
+# include <time.h>
+#endif
+
+// files changed less than this many nanoseconds before they are hashed
+// can change again without their mtime and ctime changing, on file systems
+// with a coarse timestamp granularity; their digests aren't stored
+
+#if !defined(BOOST_HASH2_DIGEST_CACHE_RACY_NS)
+# define BOOST_HASH2_DIGEST_CACHE_RACY_NS 2000000000
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+// what identifies a version of a file: the device and inode, and the
+// metadata that changes when the contents do
+
+struct file_identity
+{
+    std::uint64_t dev;
+    std::uint64_t ino;
+    std::uint64_t size;
+    std::uint64_t mtime_ns;
+    std::uint64_t ctime_ns;
+};
+
+inline bool operator==( file_identity const& a, file_identity const& b ) noexcept
+{
+    return a.dev == b.dev && a.ino == b.ino && a.size == b.size && a.mtime_ns == b.mtime_ns && a.ctime_ns == b.ctime_ns;
+}
+
+inline bool operator!=( file_identity const& a, file_identity const& b ) noexcept
+{
+    return !( a == b );
+}
+
+namespace detail
+{
+
+// the cache file is a header followed by records, all of this size:
+//
+//   dev, ino, size, mtime_ns, ctime_ns, algorithm, digest size: 8 bytes each, little endian
+//   digest: 64 bytes, zero padded
+//   checksum: 8 bytes, the FNV-1a hash of the above
+//
+// records are only appended; a later record for the same file and
+// algorithm supersedes an earlier one
+
+std::size_t const digest_cache_record_size = 128;
+std::size_t const digest_cache_digest_size = 64;
+
+char const digest_cache_magic[ 16 ] = { 'b', 'o', 'o', 's', 't', '.', 'h', 'a', 's', 'h', '2', '.', 'd', 'c', '0', '1' };
+
+// identifies the algorithm H by the digest it computes for a fixed
+// message, so that a cache file stays valid across builds
+
+template<class H> std::uint64_t digest_cache_algorithm()
+{
+    static std::uint64_t const r = []{
+
+        H h;
+        h.update( "boost.hash2.digest_cache", 24 );
+
+        typename H::result_type d = h.result();
+        return detail::read64le( d.data() );
+
+    }();
+
+    return r;
+}
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+inline std::uint64_t timespec_ns( ::timespec const& ts ) noexcept
+{
+    return static_cast<std::uint64_t>( ts.tv_sec ) * 1000000000u + static_cast<std::uint64_t>( ts.tv_nsec );
+}
+
+inline file_identity file_identity_of( struct ::stat const& st ) noexcept
+{
+#if defined(__APPLE__)
+
+    ::timespec const& mt = st.st_mtimespec;
+    ::timespec const& ct = st.st_ctimespec;
+
+#else
+
+    ::timespec const& mt = st.st_mtim;
+    ::timespec const& ct = st.st_ctim;
+
+#endif
+
+    file_identity r = { static_cast<std::uint64_t>( st.st_dev ), static_cast<std::uint64_t>( st.st_ino ), static_cast<std::uint64_t>( st.st_size ), timespec_ns( mt ), timespec_ns( ct ) };
+    return r;
+}
+
+// the identity of the file path, following symbolic links; returns false,
+// and sets ec, on error, or without setting it, if it isn't a regular file
+
+inline bool file_identity_of( char const* path, file_identity& id, std::error_code& ec )
+{
+    struct ::stat st;
+
+    if( ::stat( path, &st ) != 0 )
+    {
+        ec.assign( errno, std::system_category() );
+        return false;
+    }
+
+    if( !S_ISREG( st.st_mode ) ) return false;
+
+    id = detail::file_identity_of( st );
+    return true;
+}
+
+inline std::uint64_t realtime_ns() noexcept
+{
+    ::timespec ts;
+    ::clock_gettime( CLOCK_REALTIME, &ts );
+
+    return timespec_ns( ts );
+}
+
+#endif
+
+} // namespace detail
+
+class digest_cache
+{
+private:
+
+    int fd_;
+
+    unsigned char const* map_;
+    std::size_t map_size_;
+
+    // the records in the mapping, then those appended since opening
+    std::size_t mapped_;
+    std::vector<unsigned char> appended_;
+
+    // open addressing, linear probing; 0 is empty, otherwise the record
+    // number plus one
+    std::vector<std::uint32_t> index_;
+    std::size_t count_;
+
+    std::uint64_t hits_;
+    std::uint64_t misses_;
+
+    mutable std::mutex mx_;
+
+private:
+
+    unsigned char const* record( std::size_t i ) const noexcept
+    {
+        if( i < mapped_ )
+        {
+            return map_ + ( i + 1 ) * detail::digest_cache_record_size;
+        }
+        else
+        {
+            return appended_.data() + ( i - mapped_ ) * detail::digest_cache_record_size;
+        }
+    }
+
+    static std::size_t index_hash( std::uint64_t dev, std::uint64_t ino, std::uint64_t alg ) noexcept
+    {
+        std::uint64_t h = ( dev * 0x9E3779B97F4A7C15ull ) ^ ( ino * 0xC2B2AE3D27D4EB4Full ) ^ alg;
+
+        h ^= h >> 32;
+        h *= 0xD6E8FEB86659FD93ull;
+        h ^= h >> 32;
+
+        return static_cast<std::size_t>( h );
+    }
+
+    static bool record_matches( unsigned char const* p, std::uint64_t dev, std::uint64_t ino, std::uint64_t alg ) noexcept
+    {
+        return detail::read64le( p ) == dev && detail::read64le( p + 8 ) == ino && detail::read64le( p + 40 ) == alg;
+    }
+
+    // the slot of the key in index_, empty if absent
+
+    std::size_t find_slot( std::uint64_t dev, std::uint64_t ino, std::uint64_t alg ) const noexcept
+    {
+        std::size_t const mask = index_.size() - 1;
+
+        for( std::size_t i = index_hash( dev, ino, alg ) & mask;; i = ( i + 1 ) & mask )
+        {
+            std::uint32_t v = index_[ i ];
+
+            if( v == 0 || record_matches( record( v - 1 ), dev, ino, alg ) ) return i;
+        }
+    }
+
+    void index_record( std::size_t i )
+    {
+        if( ( count_ + 1 ) * 2 > index_.size() )
+        {
+            std::vector<std::uint32_t> old( index_.size() * 2 );
+            old.swap( index_ );
+
+            for( std::uint32_t v: old )
+            {
+                if( v == 0 ) continue;
+
+                unsigned char const* p = record( v - 1 );
+                index_[ find_slot( detail::read64le( p ), detail::read64le( p + 8 ), detail::read64le( p + 40 ) ) ] = v;
+            }
+        }
+
+        unsigned char const* p = record( i );
+        std::size_t j = find_slot( detail::read64le( p ), detail::read64le( p + 8 ), detail::read64le( p + 40 ) );
+
+        if( index_[ j ] == 0 ) ++count_;
+        index_[ j ] = static_cast<std::uint32_t>( i + 1 );
+    }
+
+    static std::uint64_t checksum( unsigned char const* p ) noexcept
+    {
+        fnv1a_64 h;
+        h.update( p, detail::digest_cache_record_size - 8 );
+
+        return h.result();
+    }
+
+    void reset() noexcept
+    {
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        if( map_ ) ::munmap( const_cast<unsigned char*>( map_ ), map_size_ );
+        if( fd_ >= 0 ) ::close( fd_ );
+
+#endif
+
+        fd_ = -1;
+        map_ = 0;
+        map_size_ = 0;
+        mapped_ = 0;
+
+        appended_.clear();
+
+        index_.assign( 16, 0 );
+        count_ = 0;
+    }
+
+public:
+
+    digest_cache() noexcept: fd_( -1 ), map_( 0 ), map_size_( 0 ), mapped_( 0 ), index_( 16 ), count_( 0 ), hits_( 0 ), misses_( 0 )
+    {
+    }
+
+    digest_cache( digest_cache const& ) = delete;
+    digest_cache& operator=( digest_cache const& ) = delete;
+
+    ~digest_cache()
+    {
+        reset();
+    }
+
+    // opens or creates the cache file path; on error, sets ec, and the
+    // cache stays closed, in which case files are hashed without it
+
+    void open( char const* path, std::error_code& ec )
+    {
+        ec.clear();
+
+        std::lock_guard<std::mutex> lock( mx_ );
+
+        reset();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        std::size_t const R = detail::digest_cache_record_size;
+
+        int fd = ::open( path, O_RDWR | O_CREAT | O_APPEND | O_CLOEXEC, 0644 );
+
+        if( fd < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        detail::file_descriptor guard( fd );
+
+        // other processes may be appending to the file
+
+        if( ::flock( fd, LOCK_EX ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        struct ::stat st;
+
+        if( ::fstat( fd, &st ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            ::flock( fd, LOCK_UN );
+            return;
+        }
+
+        std::uint64_t size = static_cast<std::uint64_t>( st.st_size );
+
+        if( size == 0 )
+        {
+            unsigned char header[ R ] = {};
+            std::memcpy( header, detail::digest_cache_magic, sizeof( detail::digest_cache_magic ) );
+
+            if( ::write( fd, header, R ) != static_cast<::ssize_t>( R ) )
+            {
+                ec.assign( errno, std::system_category() );
+                ::flock( fd, LOCK_UN );
+                return;
+            }
+
+            size = R;
+        }
+        else if( size % R != 0 )
+        {
+            // a record cut short by a crash; later appends must stay aligned
+
+            size -= size % R;
+
+            if( ::ftruncate( fd, static_cast<::off_t>( size ) ) != 0 )
+            {
+                ec.assign( errno, std::system_category() );
+                ::flock( fd, LOCK_UN );
+                return;
+            }
+        }
+
+        void* p = ::mmap( 0, static_cast<std::size_t>( size ), PROT_READ, MAP_SHARED, fd, 0 );
+
+        ::flock( fd, LOCK_UN );
+
+        if( p == MAP_FAILED )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        map_ = static_cast<unsigned char const*>( p );
+        map_size_ = static_cast<std::size_t>( size );
+
+        if( std::memcmp( map_, detail::digest_cache_magic, sizeof( detail::digest_cache_magic ) ) != 0 )
+        {
+            ::munmap( p, map_size_ );
+
+            map_ = 0;
+            map_size_ = 0;
+
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        fd_ = guard.release();
+
+        std::size_t const n = map_size_ / R - 1;
+
+        ::madvise( p, map_size_, MADV_SEQUENTIAL );
+
+        mapped_ = n;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            unsigned char const* q = record( i );
+
+            // torn or corrupted records are ignored
+
+            if( detail::read64le( q + R - 8 ) == checksum( q ) )
+            {
+                index_record( i );
+            }
+        }
+
+        ::madvise( p, map_size_, MADV_RANDOM );
+
+#else
+
+        (void)path;
+        ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+    }
+
+    bool is_open() const noexcept
+    {
+        std::lock_guard<std::mutex> lock( mx_ );
+        return fd_ >= 0;
+    }
+
+    // the number of files in the cache, counting each algorithm separately
+
+    std::size_t size() const noexcept
+    {
+        std::lock_guard<std::mutex> lock( mx_ );
+        return count_;
+    }
+
+    // the number of lookups that found, and didn't find, a digest
+
+    std::uint64_t hits() const noexcept
+    {
+        std::lock_guard<std::mutex> lock( mx_ );
+        return hits_;
+    }
+
+    std::uint64_t misses() const noexcept
+    {
+        std::lock_guard<std::mutex> lock( mx_ );
+        return misses_;
+    }
+
+    // looks up the digest H computed for the file id; returns false if
+    // there is none, or the file has changed since
+
+    template<class H> bool find( file_identity const& id, typename H::result_type& r )
+    {
+        static_assert( sizeof( r ) <= detail::digest_cache_digest_size, "The digest of H is too large to be cached" );
+
+        std::uint64_t const alg = detail::digest_cache_algorithm<H>();
+
+        std::lock_guard<std::mutex> lock( mx_ );
+
+        std::uint32_t v = index_[ find_slot( id.dev, id.ino, alg ) ];
+
+        if( v != 0 )
+        {
+            unsigned char const* p = record( v - 1 );
+
+            if( detail::read64le( p + 16 ) == id.size && detail::read64le( p + 24 ) == id.mtime_ns && detail::read64le( p + 32 ) == id.ctime_ns && detail::read64le( p + 48 ) == r.size() )
+            {
+                std::memcpy( r.data(), p + 56, r.size() );
+
+                ++hits_;
+                return true;
+            }
+        }
+
+        ++misses_;
+        return false;
+    }
+
+    // stores the digest H computed for the file id, unless the file has
+    // changed too recently for its metadata to tell a later change apart
+
+    template<class H> void insert( file_identity const& id, typename H::result_type const& r )
+    {
+        static_assert( sizeof( r ) <= detail::digest_cache_digest_size, "The digest of H is too large to be cached" );
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        std::uint64_t const now = detail::realtime_ns();
+
+        std::uint64_t const racy = BOOST_HASH2_DIGEST_CACHE_RACY_NS;
+
+        if( id.mtime_ns + racy > now || id.ctime_ns + racy > now ) return;
+
+        std::size_t const R = detail::digest_cache_record_size;
+
+        unsigned char q[ R ] = {};
+
+        detail::write64le( q, id.dev );
+        detail::write64le( q + 8, id.ino );
+        detail::write64le( q + 16, id.size );
+        detail::write64le( q + 24, id.mtime_ns );
+        detail::write64le( q + 32, id.ctime_ns );
+        detail::write64le( q + 40, detail::digest_cache_algorithm<H>() );
+        detail::write64le( q + 48, r.size() );
+
+        std::memcpy( q + 56, r.data(), r.size() );
+
+        detail::write64le( q + R - 8, checksum( q ) );
+
+        std::lock_guard<std::mutex> lock( mx_ );
+
+        if( fd_ < 0 ) return;
+
+        if( mapped_ + appended_.size() / R + 1 >= 0xFFFFFFFFu ) return;
+
+        // the cache is an optimization; a failed append only loses the
+        // record for the next process
+
+        if( ::flock( fd_, LOCK_EX ) == 0 )
+        {
+            ::ssize_t w = ::write( fd_, q, R );
+            (void)w;
+
+            ::flock( fd_, LOCK_UN );
+        }
+
+        appended_.insert( appended_.end(), q, q + R );
+        index_record( mapped_ + appended_.size() / R - 1 );
+
+#else
+
+        (void)id;
+        (void)r;
+
+#endif
+    }
+
+    // returns the digest of the file path, from the cache when the file
+    // hasn't changed since it was stored, otherwise as hash_file<H> does,
+    // storing it; a value-initialized result on error
+
+    template<class H> typename H::result_type hash_file( char const* path, std::error_code& ec, file_backend b = file_backend::automatic )
+    {
+        ec.clear();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        file_identity id;
+
+        if( !detail::file_identity_of( path, id, ec ) )
+        {
+            if( ec ) return typename H::result_type();
+
+            // not a regular file
+            return hash2::hash_file<H>( path, ec, b );
+        }
+
+        typename H::result_type r = typename H::result_type();
+
+        if( find<H>( id, r ) ) return r;
+
+        r = hash2::hash_file<H>( path, ec, b );
+
+        if( ec ) return r;
+
+        // a file that changed while it was being hashed isn't stored
+
+        file_identity id2;
+        std::error_code ec2;
+
+        if( detail::file_identity_of( path, id2, ec2 ) && id2 == id )
+        {
+            insert<H>( id, r );
+        }
+
+        return r;
+
+#else
+
+        return hash2::hash_file<H>( path, ec, b );
+
+#endif
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DIGEST_CACHE_HPP_INCLUDED
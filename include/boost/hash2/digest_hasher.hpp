@@ -0,0 +1,65 @@
+#ifndef BOOST_HASH2_DIGEST_HASHER_HPP_INCLUDED
+#define BOOST_HASH2_DIGEST_HASHER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// digest_hasher
+
+// the bytes of a cryptographic digest are already uniformly distributed,
+// so the hash value is taken from its first eight bytes, as
+// get_integral_result does for array-like results, without rehashing
+
+struct digest_hasher
+{
+    using is_avalanching = std::true_type;
+
+    template<std::size_t N> BOOST_CXX14_CONSTEXPR std::size_t operator()( digest<N> const& v ) const noexcept
+    {
+        static_assert( N >= 8, "digest_hasher requires a digest of at least 8 bytes" );
+        return static_cast<std::size_t>( detail::read64le( v.data() ) );
+    }
+};
+
+// digest_equal
+
+// compares eight bytes at a time and returns at the first difference;
+// unlike operator==, its running time depends on the contents, so it's
+// not suitable for comparing secret values such as MACs
+
+struct digest_equal
+{
+    template<std::size_t N> BOOST_CXX14_CONSTEXPR bool operator()( digest<N> const& a, digest<N> const& b ) const noexcept
+    {
+        std::size_t i = 0;
+
+        for( ; i + 8 <= N; i += 8 )
+        {
+            if( detail::read64le( a.data() + i ) != detail::read64le( b.data() + i ) ) return false;
+        }
+
+        for( ; i < N; ++i )
+        {
+            if( a[ i ] != b[ i ] ) return false;
+        }
+
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_DIGEST_HASHER_HPP_INCLUDED
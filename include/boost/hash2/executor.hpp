@@ -0,0 +1,462 @@
+#ifndef BOOST_HASH2_EXECUTOR_HPP_INCLUDED
+#define BOOST_HASH2_EXECUTOR_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// task_executor, the interface through which the parallel modes of the
+// library run their work, and two implementations of it: thread_executor,
+// which starts threads for each call, and work_stealing_executor, a pool
+
+#include <boost/hash2/detail/numa.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+# include <boost/core/no_exceptions_support.hpp>
+# include <atomic>
+# include <condition_variable>
+# include <deque>
+# include <memory>
+# include <mutex>
+# include <thread>
+# include <vector>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+// task_executor
+//
+// bulk_execute( n, f, ctx ) calls f( ctx, i ) once for each i in [0, n),
+// possibly concurrently, and returns when all the calls have returned.
+// The calls don't wait for one another, so running them one after the
+// other on the calling thread, in any order, is a valid implementation;
+// they may call bulk_execute themselves. concurrency() is the number of
+// calls that can usefully run at once, and is at least 1.
+//
+// Deriving from it routes the parallel modes to another thread pool.
+
+class task_executor
+{
+public:
+
+    virtual ~task_executor() {}
+
+    virtual unsigned concurrency() const noexcept = 0;
+
+    virtual void bulk_execute( std::size_t n, void (*f)( void* ctx, std::size_t i ), void* ctx ) = 0;
+};
+
+// calls f( i ) for each i in [0, n) on ex
+
+template<class F> void bulk_execute( task_executor& ex, std::size_t n, F const& f )
+{
+    ex.bulk_execute( n, []( void* ctx, std::size_t i ){ ( *static_cast<F const*>( ctx ) )( i ); }, const_cast<F*>( &f ) );
+}
+
+namespace detail
+{
+
+// the number of parts, at most the concurrency of ex and at most n / min,
+// into which to split n units of work
+
+inline unsigned parallel_parts( task_executor const& ex, std::size_t n, std::size_t min ) noexcept
+{
+    unsigned r = ex.concurrency();
+
+    if( r > n / min )
+    {
+        r = static_cast<unsigned>( n / min );
+    }
+
+    return r > 0? r: 1;
+}
+
+} // namespace detail
+
+// thread_executor, starts up to concurrency() - 1 threads for each call
+// to bulk_execute, which claim the calls along with the calling thread.
+// Constructing one is free; threads == 0 means hardware_concurrency().
+// This is what the overloads of the parallel modes that take a number of
+// threads use.
+
+class thread_executor: public task_executor
+{
+private:
+
+    unsigned threads_;
+
+public:
+
+    explicit thread_executor( unsigned threads = 0 ) noexcept: threads_( threads )
+    {
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+        if( threads_ == 0 )
+        {
+            threads_ = std::thread::hardware_concurrency();
+        }
+
+#else
+
+        threads_ = 1;
+
+#endif
+
+        if( threads_ == 0 )
+        {
+            threads_ = 1;
+        }
+    }
+
+    unsigned concurrency() const noexcept override
+    {
+        return threads_;
+    }
+
+    void bulk_execute( std::size_t n, void (*f)( void* ctx, std::size_t i ), void* ctx ) override
+    {
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+        std::size_t m = threads_ < n? threads_: n;
+
+        if( m > 1 )
+        {
+            std::atomic<std::size_t> next( 0 );
+
+            auto work = [&]{
+
+                for( ;; )
+                {
+                    std::size_t i = next.fetch_add( 1, std::memory_order_relaxed );
+                    if( i >= n ) break;
+
+                    f( ctx, i );
+                }
+            };
+
+            std::vector<std::thread> th;
+            th.reserve( m - 1 );
+
+            BOOST_TRY
+            {
+                for( std::size_t t = 1; t < m; ++t )
+                {
+                    // the threads are ours, so the tasks may bind them to
+                    // the node of their data
+
+                    th.emplace_back( [&]{ detail::numa_worker() = true; work(); } );
+                }
+            }
+            BOOST_CATCH(...)
+            {
+                // couldn't start a thread, continue with the ones we have
+            }
+            BOOST_CATCH_END
+
+            work();
+
+            for( std::thread& t: th )
+            {
+                t.join();
+            }
+
+            return;
+        }
+
+#endif
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            f( ctx, i );
+        }
+    }
+};
+
+#if !defined(BOOST_NO_CXX11_HDR_THREAD)
+
+// work_stealing_executor, a pool of threads - 1 workers that run the calls
+// of bulk_execute along with the calling thread
+//
+// Each worker has a queue. A call from a worker pushes its tasks on the
+// back of its own queue, and a call from another thread spreads them over
+// all queues; workers take tasks from the back of their own queue, and
+// steal from the front of the others. While its tasks are unfinished, the
+// calling thread runs queued tasks, so nested calls don't deadlock.
+// threads == 0 means hardware_concurrency(). The pool must outlive the
+// calls to bulk_execute.
+
+class work_stealing_executor: public task_executor
+{
+private:
+
+    struct batch
+    {
+        void (*f)( void*, std::size_t );
+        void* ctx;
+
+        std::mutex mx;
+        std::condition_variable cv;
+        std::size_t remaining;
+    };
+
+    struct task
+    {
+        batch* b;
+        std::size_t i;
+    };
+
+    struct queue
+    {
+        std::mutex mx;
+        std::deque<task> q;
+    };
+
+    std::vector<std::thread> workers_;
+    std::unique_ptr<queue[]> queues_;
+    std::size_t nq_ = 0;
+
+    std::mutex mx_;
+    std::condition_variable cv_;
+    std::atomic<std::size_t> pending_;
+    bool stop_ = false;
+
+private:
+
+    // the index of the calling thread in this pool, or -1
+
+    static work_stealing_executor*& current_pool() noexcept
+    {
+        static thread_local work_stealing_executor* p = nullptr;
+        return p;
+    }
+
+    static std::size_t& current_index() noexcept
+    {
+        static thread_local std::size_t i = 0;
+        return i;
+    }
+
+    std::ptrdiff_t self() const noexcept
+    {
+        return current_pool() == this? static_cast<std::ptrdiff_t>( current_index() ): -1;
+    }
+
+    bool try_pop( std::ptrdiff_t s, task& t )
+    {
+        if( s >= 0 )
+        {
+            queue& q = queues_[ s ];
+            std::lock_guard<std::mutex> lock( q.mx );
+
+            if( !q.q.empty() )
+            {
+                t = q.q.back();
+                q.q.pop_back();
+                return true;
+            }
+        }
+
+        std::size_t const first = s >= 0? static_cast<std::size_t>( s ) + 1: 0;
+
+        for( std::size_t j = 0; j < nq_; ++j )
+        {
+            queue& q = queues_[ ( first + j ) % nq_ ];
+            std::lock_guard<std::mutex> lock( q.mx );
+
+            if( !q.q.empty() )
+            {
+                t = q.q.front();
+                q.q.pop_front();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    bool run_one( std::ptrdiff_t s )
+    {
+        task t;
+
+        if( !try_pop( s, t ) ) return false;
+
+        pending_.fetch_sub( 1, std::memory_order_relaxed );
+
+        t.b->f( t.b->ctx, t.i );
+
+        std::lock_guard<std::mutex> lock( t.b->mx );
+
+        if( --t.b->remaining == 0 )
+        {
+            t.b->cv.notify_all();
+        }
+
+        return true;
+    }
+
+    void worker( std::size_t i )
+    {
+        current_pool() = this;
+        current_index() = i;
+
+        for( ;; )
+        {
+            if( run_one( static_cast<std::ptrdiff_t>( i ) ) ) continue;
+
+            std::unique_lock<std::mutex> lock( mx_ );
+
+            cv_.wait( lock, [&]{ return stop_ || pending_.load( std::memory_order_relaxed ) > 0; } );
+
+            if( stop_ ) return;
+        }
+    }
+
+public:
+
+    explicit work_stealing_executor( unsigned threads = 0 ): pending_( 0 )
+    {
+        if( threads == 0 )
+        {
+            threads = std::thread::hardware_concurrency();
+        }
+
+        if( threads < 2 ) return;
+
+        queues_.reset( new queue[ threads - 1 ] );
+        nq_ = threads - 1;
+
+        workers_.reserve( nq_ );
+
+        BOOST_TRY
+        {
+            for( std::size_t i = 0; i < nq_; ++i )
+            {
+                workers_.emplace_back( [this, i]{ worker( i ); } );
+            }
+        }
+        BOOST_CATCH(...)
+        {
+            // couldn't start a thread, continue with the ones we have;
+            // the tasks in the queues without a worker are stolen
+        }
+        BOOST_CATCH_END
+    }
+
+    work_stealing_executor( work_stealing_executor const& ) = delete;
+    work_stealing_executor& operator=( work_stealing_executor const& ) = delete;
+
+    ~work_stealing_executor()
+    {
+        {
+            std::lock_guard<std::mutex> lock( mx_ );
+            stop_ = true;
+        }
+
+        cv_.notify_all();
+
+        for( std::thread& t: workers_ )
+        {
+            t.join();
+        }
+    }
+
+    unsigned concurrency() const noexcept override
+    {
+        return static_cast<unsigned>( workers_.size() + 1 );
+    }
+
+    void bulk_execute( std::size_t n, void (*f)( void* ctx, std::size_t i ), void* ctx ) override
+    {
+        if( n == 0 ) return;
+
+        if( n == 1 || nq_ == 0 )
+        {
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                f( ctx, i );
+            }
+
+            return;
+        }
+
+        batch b;
+
+        b.f = f;
+        b.ctx = ctx;
+        b.remaining = n - 1;
+
+        std::ptrdiff_t const s = self();
+
+        {
+            std::lock_guard<std::mutex> lock( mx_ );
+            pending_.fetch_add( n - 1, std::memory_order_relaxed );
+        }
+
+        // the tasks 1 to n - 1 are queued, and 0 is run here
+
+        for( std::size_t i = 1; i < n; ++i )
+        {
+            queue& q = queues_[ s >= 0? static_cast<std::size_t>( s ): i % nq_ ];
+
+            std::lock_guard<std::mutex> lock( q.mx );
+            q.q.push_back( task{ &b, i } );
+        }
+
+        cv_.notify_all();
+
+        f( ctx, 0 );
+
+        for( ;; )
+        {
+            {
+                std::lock_guard<std::mutex> lock( b.mx );
+                if( b.remaining == 0 ) return;
+            }
+
+            if( run_one( s ) ) continue;
+
+            // nothing is queued, so the remaining tasks of b are running
+
+            std::unique_lock<std::mutex> lock( b.mx );
+            b.cv.wait( lock, [&]{ return b.remaining == 0; } );
+
+            return;
+        }
+    }
+};
+
+#else
+
+class work_stealing_executor: public task_executor
+{
+public:
+
+    explicit work_stealing_executor( unsigned /*threads*/ = 0 ) noexcept
+    {
+    }
+
+    unsigned concurrency() const noexcept override
+    {
+        return 1;
+    }
+
+    void bulk_execute( std::size_t n, void (*f)( void* ctx, std::size_t i ), void* ctx ) override
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            f( ctx, i );
+        }
+    }
+};
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_EXECUTOR_HPP_INCLUDED
@@ -0,0 +1,192 @@
+#ifndef BOOST_HASH2_FAST_HASH_HPP_INCLUDED
+#define BOOST_HASH2_FAST_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// fast_hash, the fastest of the non-cryptographic hash algorithms
+// of the library on the processor it runs on
+
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+enum class fast_hash_algorithm
+{
+    aes_hash_128,
+    xxh3_64,
+    rapidhash_64
+};
+
+namespace detail
+{
+
+// aes_hash_128 where the processor has AES instructions; otherwise
+// xxh3_64 where it has the vector instructions of its accumulate loop;
+// otherwise rapidhash_64, which only needs a 64x64->128 multiply
+
+inline fast_hash_algorithm select_fast_hash_algorithm() noexcept
+{
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_aes() )
+    {
+        return fast_hash_algorithm::aes_hash_128;
+    }
+
+    if( detail::has_x86_sse2() )
+    {
+        return fast_hash_algorithm::xxh3_64;
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_AES_INTRINSICS)
+
+    return fast_hash_algorithm::aes_hash_128;
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    return fast_hash_algorithm::xxh3_64;
+
+#endif
+
+    return fast_hash_algorithm::rapidhash_64;
+}
+
+inline fast_hash_algorithm get_fast_hash_algorithm() noexcept
+{
+    static fast_hash_algorithm const a = select_fast_hash_algorithm();
+    return a;
+}
+
+} // namespace detail
+
+// The algorithm is selected once per process, on first use, and the
+// member functions dispatch to it with a switch on a copy of the choice,
+// which, as with the accelerated code paths, is a well predicted branch.
+//
+// The hash values therefore depend on the processor, on the compiler
+// options, and on BOOST_HASH2_X86_ISA_LEVEL, and must not be stored or
+// sent to another process.
+
+class fast_hash
+{
+private:
+
+    fast_hash_algorithm a_;
+
+    union
+    {
+        aes_hash_128 aes_;
+        xxh3_64_noscrub xxh3_;
+        rapidhash_64 rapid_;
+    };
+
+    template<class... A> void init( A... a )
+    {
+        switch( a_ )
+        {
+        case fast_hash_algorithm::aes_hash_128:
+
+            ::new( &aes_ ) aes_hash_128( a... );
+            break;
+
+        case fast_hash_algorithm::xxh3_64:
+
+            ::new( &xxh3_ ) xxh3_64_noscrub( a... );
+            break;
+
+        default:
+
+            ::new( &rapid_ ) rapidhash_64( a... );
+            break;
+        }
+    }
+
+public:
+
+    using result_type = std::uint64_t;
+
+    fast_hash(): a_( detail::get_fast_hash_algorithm() )
+    {
+        init();
+    }
+
+    explicit fast_hash( std::uint64_t seed ): a_( detail::get_fast_hash_algorithm() )
+    {
+        init( seed );
+    }
+
+    fast_hash( unsigned char const* p, std::size_t n ): a_( detail::get_fast_hash_algorithm() )
+    {
+        init( p, n );
+    }
+
+    // the algorithm used by all fast_hash objects in this process
+
+    static fast_hash_algorithm algorithm() noexcept
+    {
+        return detail::get_fast_hash_algorithm();
+    }
+
+    void update( unsigned char const* p, std::size_t n )
+    {
+        switch( a_ )
+        {
+        case fast_hash_algorithm::aes_hash_128:
+
+            aes_.update( p, n );
+            break;
+
+        case fast_hash_algorithm::xxh3_64:
+
+            xxh3_.update( p, n );
+            break;
+
+        default:
+
+            rapid_.update( p, n );
+            break;
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    result_type result()
+    {
+        switch( a_ )
+        {
+        case fast_hash_algorithm::aes_hash_128:
+
+            return detail::read64le( aes_.result().data() );
+
+        case fast_hash_algorithm::xxh3_64:
+
+            return xxh3_.result();
+
+        default:
+
+            return rapid_.result();
+        }
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_FAST_HASH_HPP_INCLUDED
@@ -0,0 +1,178 @@
+#ifndef BOOST_HASH2_FASTCDC_HPP_INCLUDED
+#define BOOST_HASH2_FASTCDC_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the smallest length i in [s, e], i - s even, such that the Gear hash of
+// p[i-64] .. p[i-1], ANDed with m, is zero; e if there's none
+//
+// the hash is advanced two bytes per step, as in FastCDC 2020, which halves
+// the length of the dependency chain; this is why only every other length
+// is considered. s must be at least 64, and at most e
+
+inline std::size_t gear_find( std::uint64_t const* t, unsigned char const* p, std::size_t s, std::size_t e, std::uint64_t m ) noexcept
+{
+    std::uint64_t h = 0;
+
+    std::size_t i = s - 64;
+
+    for( ; i < s; i += 2 )
+    {
+        h = ( h << 2 ) + ( t[ p[ i ] ] << 1 ) + t[ p[ i + 1 ] ];
+    }
+
+    // h is now the hash of the 64 bytes preceding p + i
+
+    for( ;; )
+    {
+        if( ( h & m ) == 0 ) return i;
+        if( e - i < 2 ) break;
+
+        h = ( h << 2 ) + ( t[ p[ i ] ] << 1 ) + t[ p[ i + 1 ] ];
+        i += 2;
+    }
+
+    return e;
+}
+
+} // namespace detail
+
+// fastcdc, content-defined chunking with the Gear hash and normalized
+// chunking (Xia et al., "FastCDC: A Fast and Efficient Content-Defined
+// Chunking Approach for Data Deduplication")
+//
+// a chunk ends where the high bits of the Gear hash of its last 64 bytes
+// are zero; before the average size, more bits must be zero than after it,
+// which concentrates the chunk sizes around the average
+
+class fastcdc
+{
+private:
+
+    gear_hash_64 g_;
+
+    std::size_t min_;
+    std::size_t avg_;
+    std::size_t max_;
+
+    std::uint64_t mask_s_;
+    std::uint64_t mask_l_;
+
+private:
+
+    static unsigned log2_floor( std::size_t n ) noexcept
+    {
+        unsigned r = 0;
+
+        while( n >>= 1 ) ++r;
+
+        return r;
+    }
+
+    void init() noexcept
+    {
+        BOOST_ASSERT( min_ >= 64 );
+        BOOST_ASSERT( min_ <= avg_ && avg_ <= max_ );
+        BOOST_ASSERT( avg_ >= 256 );
+
+        unsigned b = log2_floor( avg_ );
+
+        // normalization level 2
+
+        mask_s_ = ~std::uint64_t( 0 ) << ( 64 - ( b + 2 ) );
+        mask_l_ = ~std::uint64_t( 0 ) << ( 64 - ( b - 2 ) );
+    }
+
+public:
+
+    fastcdc( std::size_t min_size, std::size_t avg_size, std::size_t max_size ):
+        g_(), min_( min_size ), avg_( avg_size ), max_( max_size )
+    {
+        init();
+    }
+
+    fastcdc( std::size_t min_size, std::size_t avg_size, std::size_t max_size, std::uint64_t seed ):
+        g_( seed ), min_( min_size ), avg_( avg_size ), max_( max_size )
+    {
+        init();
+    }
+
+    std::size_t min_size() const noexcept
+    {
+        return min_;
+    }
+
+    std::size_t avg_size() const noexcept
+    {
+        return avg_;
+    }
+
+    std::size_t max_size() const noexcept
+    {
+        return max_;
+    }
+
+    // the length of the chunk that starts at p; when no boundary is found
+    // in the first n bytes and n is less than max_size(), returns n, and
+    // the chunk may continue past the end of the input
+
+    std::size_t next( unsigned char const* p, std::size_t n ) const noexcept
+    {
+        if( n <= min_ ) return n;
+
+        std::size_t e = n < max_? n: max_;
+        std::size_t a = avg_ < e? avg_: e;
+
+        std::size_t r = detail::gear_find( g_.table(), p, min_, a, mask_s_ );
+
+        if( r == a && a < e )
+        {
+            // no boundary before the average size, or one exactly at it,
+            // which the second search finds again; it keeps considering
+            // lengths of the same parity as min_
+
+            std::size_t s = a + ( a - min_ ) % 2;
+            r = detail::gear_find( g_.table(), p, s, e, mask_l_ );
+        }
+
+        return r;
+    }
+
+    // appends the chunk lengths of [p, p + n) to out; the last chunk ends
+    // at p + n
+
+    void split( unsigned char const* p, std::size_t n, std::vector<std::size_t>& out ) const
+    {
+        while( n > 0 )
+        {
+            std::size_t m = next( p, n );
+
+            out.push_back( m );
+
+            p += m;
+            n -= m;
+        }
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_FASTCDC_HPP_INCLUDED
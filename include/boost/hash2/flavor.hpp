@@ -31,6 +31,35 @@ struct big_endian_flavor
     static constexpr auto byte_order = endian::big;
 };
 
+// 32 bit sizes
+
+struct default_flavor_32
+{
+    using size_type = std::uint32_t;
+    static constexpr auto byte_order = endian::native;
+};
+
+struct little_endian_flavor_32
+{
+    using size_type = std::uint32_t;
+    static constexpr auto byte_order = endian::little;
+};
+
+struct big_endian_flavor_32
+{
+    using size_type = std::uint32_t;
+    static constexpr auto byte_order = endian::big;
+};
+
+// no sizes; only unambiguous when at most one variable-length
+// range is hashed, as the last component of the message
+
+struct unsized_flavor
+{
+    using size_type = void;
+    static constexpr auto byte_order = endian::native;
+};
+
 } // namespace hash2
 } // namespace boost
 
@@ -9,7 +9,11 @@
 //
 // https://en.wikipedia.org/wiki/Fowler%E2%80%93Noll%E2%80%93Vo_hash_function
 
+#include <boost/hash2/detail/read.hpp>
 #include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
@@ -55,7 +59,10 @@ public:
         {
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -63,12 +70,16 @@ public:
     {
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
     {
+        BOOST_HASH2_STATS_UPDATE( fnv1a, sizeof( T ) == 4? "fnv1a_32": "fnv1a_64", n );
+
         T h = st_;
 
         for( std::size_t i = 0; i < n; ++i )
@@ -86,8 +97,28 @@ public:
         update( p, n );
     }
 
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( fnv1a, sizeof( T ) == 4? "fnv1a_32": "fnv1a_64", 8 );
+
+        T h = st_;
+
+        for( int i = 0; i < 8; ++i, w >>= 8 )
+        {
+            h ^= static_cast<T>( w & 0xFF );
+            h *= fnv1a_const<T>::prime;
+        }
+
+        st_ = h;
+    }
+
     BOOST_CXX14_CONSTEXPR T result()
     {
+        BOOST_HASH2_STATS_RESULT( fnv1a, sizeof( T ) == 4? "fnv1a_32": "fnv1a_64" );
+
         T r = st_;
 
         // advance as if by update( "\xFF", 1 ), to allow
@@ -98,6 +129,60 @@ public:
 
         return r;
     }
+
+    // One-shot hashing, equivalent to constructing from seed and
+    // calling update( p, n ) and result()
+
+    BOOST_CXX14_CONSTEXPR static T hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        BOOST_HASH2_STATS_RESULT( fnv1a, sizeof( T ) == 4? "fnv1a_32": "fnv1a_64" );
+
+        fnv1a h( seed );
+        h.update( p, n );
+
+        return h.st_;
+    }
+
+    static T hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.word( self.st_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + sizeof( T );
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        fnv1a tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
 };
 
 } // namespace detail
@@ -132,6 +217,232 @@ public:
     }
 };
 
+// A faster, non-standard variant of fnv1a_64 that consumes the input
+// eight bytes at a time, with an xorshift before each multiplication
+// by the FNV prime, and a final avalanche step. Its results are not
+// FNV-1a values.
+
+class fnv1a_64_wide
+{
+private:
+
+    std::uint64_t h_ = detail::fnv1a_const<std::uint64_t>::basis;
+
+    unsigned char buffer_[ 8 ] = {};
+    std::size_t m_ = 0; // == n_ % 8
+
+    std::uint64_t n_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t round( std::uint64_t h, std::uint64_t w )
+    {
+        // without the xorshift, a change in bit 63 of w would always
+        // change only bit 63 of the product, and could be cancelled
+        // by a matching change in the next word
+
+        h ^= w;
+        h ^= h >> 32;
+
+        return h * detail::fnv1a_const<std::uint64_t>::prime;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t avalanche( std::uint64_t h )
+    {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+
+        return h;
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+
+    constexpr fnv1a_64_wide() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit fnv1a_64_wide( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update_word( seed );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR fnv1a_64_wide( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( fnv1a_64_wide, "fnv1a_64_wide", n );
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 8 - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < 8 ) return;
+
+            h_ = round( h_, detail::read64le( buffer_ ) );
+            m_ = 0;
+        }
+
+        std::uint64_t h = h_;
+
+        while( n >= 8 )
+        {
+            h = round( h, detail::read64le( p ) );
+
+            p += 8;
+            n -= 8;
+        }
+
+        h_ = h;
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( fnv1a_64_wide, "fnv1a_64_wide", 8 );
+
+        if( m_ == 0 )
+        {
+            h_ = round( h_, w );
+            n_ += 8;
+        }
+        else
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, w );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( fnv1a_64_wide, "fnv1a_64_wide" );
+
+        // the partial last word, padded with zeroes, then the length,
+        // so that the padding doesn't cause collisions
+
+        std::uint64_t w = 0;
+
+        for( std::size_t i = 0; i < m_; ++i )
+        {
+            w |= static_cast<std::uint64_t>( buffer_[ i ] ) << ( i * 8 );
+            buffer_[ i ] = 0;
+        }
+
+        h_ = round( h_, w );
+        h_ = round( h_, n_ );
+
+        // the next result() call starts from an empty message
+        // and the advanced state, producing a different value
+
+        m_ = 0;
+        n_ = 0;
+
+        return avalanche( h_ );
+    }
+
+    // One-shot hashing, equivalent to constructing from seed and
+    // calling update( p, n ) and result()
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        fnv1a_64_wide h( seed );
+        h.update( p, n );
+
+        return h.result();
+    }
+
+    static std::uint64_t hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u64( self.h_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 8 + 8 + 8 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        fnv1a_64_wide tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ < 8 && tmp.m_ == tmp.n_ % 8 ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
 } // namespace hash2
 } // namespace boost
 
@@ -0,0 +1,140 @@
+#ifndef BOOST_HASH2_FRAME_CHECKSUM_HPP_INCLUDED
+#define BOOST_HASH2_FRAME_CHECKSUM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// the checksums of the LZ4 and Zstandard frame formats, and
+// hashing_compress, which computes them over the input of a streaming
+// compressor in the same pass
+
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/hashing_copy.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// lz4_content_checksum, the Content Checksum of an LZ4 frame; xxhash_32
+// of the uncompressed content, with a seed of 0
+
+class lz4_content_checksum
+{
+private:
+
+    xxhash_32 h_;
+
+public:
+
+    using result_type = std::uint32_t;
+
+    // the size of the field in the frame
+    static constexpr std::size_t size = 4;
+
+    void update( void const* p, std::size_t n )
+    {
+        h_.update( p, n );
+    }
+
+    std::uint32_t result()
+    {
+        return h_.result();
+    }
+};
+
+// zstd_content_checksum, the Content_Checksum of a Zstandard frame; the
+// low 32 bits of xxhash_64 of the uncompressed content, with a seed of 0
+
+class zstd_content_checksum
+{
+private:
+
+    xxhash_64 h_;
+
+public:
+
+    using result_type = std::uint32_t;
+
+    static constexpr std::size_t size = 4;
+
+    void update( void const* p, std::size_t n )
+    {
+        h_.update( p, n );
+    }
+
+    std::uint32_t result()
+    {
+        return static_cast<std::uint32_t>( h_.result() );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+constexpr std::size_t lz4_content_checksum::size;
+constexpr std::size_t zstd_content_checksum::size;
+
+#endif
+
+// stores the checksum, little endian, as the frame formats do; returns
+// the position after it
+
+template<class C> unsigned char* write_frame_checksum( C& c, unsigned char* p )
+{
+    detail::write32le( p, c.result() );
+    return p + 4;
+}
+
+// the Block Checksum of an LZ4 frame, over the block data as stored,
+// i.e. compressed or not
+
+inline std::uint32_t lz4_block_checksum( void const* p, std::size_t n )
+{
+    xxhash_32 h;
+    h.update( p, n );
+
+    return h.result();
+}
+
+// the HC byte of an LZ4 frame descriptor, over the descriptor from FLG
+// up to, but not including, HC
+
+inline unsigned char lz4_header_checksum( void const* p, std::size_t n )
+{
+    xxhash_32 h;
+    h.update( p, n );
+
+    return static_cast<unsigned char>( h.result() >> 8 );
+}
+
+// passes [src, src + n) to compress( p, m ) and to h, in blocks of
+// detail::hashing_copy_block_size bytes; each block is hashed right
+// after it has been compressed, while it's still in the L1 cache
+//
+// compress is typically a call to a streaming compressor, whose output
+// doesn't depend on how its input is split
+
+template<class H, class F> void hashing_compress( H& h, void const* src, std::size_t n, F compress )
+{
+    unsigned char const* p = static_cast<unsigned char const*>( src );
+
+    while( n > 0 )
+    {
+        std::size_t const m = n < detail::hashing_copy_block_size? n: detail::hashing_copy_block_size;
+
+        compress( static_cast<void const*>( p ), m );
+        h.update( p, m );
+
+        p += m;
+        n -= m;
+    }
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_FRAME_CHECKSUM_HPP_INCLUDED
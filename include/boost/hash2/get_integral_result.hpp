@@ -6,8 +6,12 @@
 // https://www.boost.org/LICENSE_1_0.txt
 
 #include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
 #include <type_traits>
+#include <utility>
 #include <limits>
+#include <array>
+#include <cstdint>
 #include <cstddef>
 
 namespace boost
@@ -132,7 +136,8 @@ template<class U, class R>
 // contraction
 
 template<class T, class R>
-    typename std::enable_if<std::is_integral<R>::value && (sizeof(R) > sizeof(T)), T>::type
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if<std::is_integral<R>::value && (sizeof(R) > sizeof(T)) && sizeof(T) <= 8, T>::type
     get_integral_result( R const & r )
 {
     static_assert( std::is_integral<T>::value, "T must be integral" );
@@ -150,7 +155,8 @@ template<class T, class R>
 // identity or expansion
 
 template<class T, class R>
-    typename std::enable_if<std::is_integral<R>::value && (sizeof(R) <= sizeof(T)), T>::type
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if<std::is_integral<R>::value && (sizeof(R) <= sizeof(T)) && sizeof(T) <= 8, T>::type
     get_integral_result( R const & r )
 {
     static_assert( std::is_integral<T>::value, "T must be integral" );
@@ -168,7 +174,8 @@ template<class T, class R>
 // array-like R
 
 template<class T, class R>
-    typename std::enable_if< !std::is_integral<R>::value, T >::type
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< !std::is_integral<R>::value && sizeof(T) <= 8, T >::type
     get_integral_result( R const & r )
 {
     static_assert( std::is_integral<T>::value, "T must be integral" );
@@ -179,6 +186,123 @@ template<class T, class R>
     return static_cast<T>( detail::read64le( r.data() ) );
 }
 
+#if defined(BOOST_HAS_INT128)
+
+// 128 bit T
+
+namespace detail
+{
+
+template<class T> struct is_int128: std::integral_constant<bool,
+    std::is_same<typename std::remove_cv<T>::type, boost::int128_type>::value ||
+    std::is_same<typename std::remove_cv<T>::type, boost::uint128_type>::value>
+{
+};
+
+// 8 -> 16, as 4 -> 8
+
+BOOST_CXX14_CONSTEXPR inline boost::uint128_type get_result_128( std::uint64_t x ) noexcept
+{
+    return static_cast<boost::uint128_type>( x ) * ( static_cast<boost::uint128_type>( 0x7FFFFFFFFFFFFFFFull ) << 64 | 0x7FFFFFFFFFFFFFFFull );
+}
+
+template<class R> BOOST_CXX14_CONSTEXPR boost::uint128_type get_result_128( R const& r, std::true_type ) noexcept
+{
+    return static_cast<boost::uint128_type>( detail::read64le( r.data() + 8 ) ) << 64 | detail::read64le( r.data() );
+}
+
+template<class R> BOOST_CXX14_CONSTEXPR boost::uint128_type get_result_128( R const& r, std::false_type ) noexcept
+{
+    return detail::get_result_128( detail::read64le( r.data() ) );
+}
+
+} // namespace detail
+
+template<class T, class R>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< std::is_integral<R>::value && detail::is_int128<T>::value, T >::type
+    get_integral_result( R const & r )
+{
+    return static_cast<T>( detail::get_result_128( hash2::get_integral_result<std::uint64_t>( r ) ) );
+}
+
+template<class T, class R>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< !std::is_integral<R>::value && detail::is_int128<T>::value, T >::type
+    get_integral_result( R const & r )
+{
+    static_assert( R().size() >= 8, "Array-like result type is too short" );
+
+    return static_cast<T>( detail::get_result_128( r, std::integral_constant<bool, R().size() >= 16>() ) );
+}
+
+#endif
+
+// get_result_words
+
+namespace detail
+{
+
+template<class H, class En = void> struct has_result: std::false_type
+{
+};
+
+template<class H> struct has_result<H, decltype( std::declval<H&>().result(), void() )>: std::true_type
+{
+};
+
+template<std::size_t K, class R> void get_result_words( R const& r, std::array<std::uint64_t, K>& w, std::size_t& i, std::false_type )
+{
+    static_assert( R().size() >= 8, "Array-like result type is too short" );
+
+    for( std::size_t j = 0; j + 8 <= r.size() && i < K; j += 8 )
+    {
+        w[ i++ ] = detail::read64le( r.data() + j );
+    }
+}
+
+template<std::size_t K, class R> void get_result_words( R const& r, std::array<std::uint64_t, K>& w, std::size_t& i, std::true_type )
+{
+    w[ i++ ] = hash2::get_integral_result<std::uint64_t>( r );
+}
+
+} // namespace detail
+
+// K 64 bit words from an array-like result
+
+template<std::size_t K, class R>
+    typename std::enable_if< !std::is_integral<R>::value && !detail::has_result<R>::value, std::array<std::uint64_t, K> >::type
+    get_result_words( R const& r )
+{
+    static_assert( R().size() >= K * 8, "Array-like result type is too short" );
+
+    std::array<std::uint64_t, K> w = {};
+    std::size_t i = 0;
+
+    detail::get_result_words( r, w, i, std::false_type() );
+
+    return w;
+}
+
+// K 64 bit words from a hash algorithm; result() is called as many times as needed
+
+template<std::size_t K, class H>
+    typename std::enable_if< detail::has_result<H>::value, std::array<std::uint64_t, K> >::type
+    get_result_words( H& h )
+{
+    typedef decltype( h.result() ) R;
+
+    std::array<std::uint64_t, K> w = {};
+    std::size_t i = 0;
+
+    while( i < K )
+    {
+        detail::get_result_words( h.result(), w, i, std::is_integral<R>() );
+    }
+
+    return w;
+}
+
 } // namespace hash2
 } // namespace boost
 
@@ -0,0 +1,324 @@
+#ifndef BOOST_HASH2_GHASH_HPP_INCLUDED
+#define BOOST_HASH2_GHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// GHASH, the universal hash of GCM, NIST SP 800-38D
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/ghash_x86.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The portable multiplication is the constant time one of BearSSL,
+// https://bearssl.org/constanttime.html#ghash-for-gcm, which builds
+// carryless products from integer ones with the operand bits spaced
+// four apart, so that the carries never reach a bit that is kept
+
+class ghash
+{
+private:
+
+    // H for the all-zero AES-128 key, as in the first GCM test cases;
+    // h_[ 0 ] and h_[ 1 ] are the first and second halves, big endian
+
+    std::uint64_t h_[ 2 ] = { 0x66E94BD4EF8A2C3Bull, 0x884CFA59CA342B2Eull };
+
+    std::uint64_t y_[ 2 ] = {};
+
+    unsigned char buffer_[ 16 ] = {};
+    std::size_t m_ = 0;
+
+private:
+
+    // the low 64 bits of the carryless product of x and y
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t bmul64( std::uint64_t x, std::uint64_t y )
+    {
+        std::uint64_t const x0 = x & 0x1111111111111111ull;
+        std::uint64_t const x1 = x & 0x2222222222222222ull;
+        std::uint64_t const x2 = x & 0x4444444444444444ull;
+        std::uint64_t const x3 = x & 0x8888888888888888ull;
+
+        std::uint64_t const y0 = y & 0x1111111111111111ull;
+        std::uint64_t const y1 = y & 0x2222222222222222ull;
+        std::uint64_t const y2 = y & 0x4444444444444444ull;
+        std::uint64_t const y3 = y & 0x8888888888888888ull;
+
+        std::uint64_t const z0 = ( x0 * y0 ) ^ ( x1 * y3 ) ^ ( x2 * y2 ) ^ ( x3 * y1 );
+        std::uint64_t const z1 = ( x0 * y1 ) ^ ( x1 * y0 ) ^ ( x2 * y3 ) ^ ( x3 * y2 );
+        std::uint64_t const z2 = ( x0 * y2 ) ^ ( x1 * y1 ) ^ ( x2 * y0 ) ^ ( x3 * y3 );
+        std::uint64_t const z3 = ( x0 * y3 ) ^ ( x1 * y2 ) ^ ( x2 * y1 ) ^ ( x3 * y0 );
+
+        return
+            ( z0 & 0x1111111111111111ull ) |
+            ( z1 & 0x2222222222222222ull ) |
+            ( z2 & 0x4444444444444444ull ) |
+            ( z3 & 0x8888888888888888ull );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t rev64( std::uint64_t x )
+    {
+        x = ( ( x & 0x5555555555555555ull ) << 1 ) | ( ( x >> 1 ) & 0x5555555555555555ull );
+        x = ( ( x & 0x3333333333333333ull ) << 2 ) | ( ( x >> 2 ) & 0x3333333333333333ull );
+        x = ( ( x & 0x0F0F0F0F0F0F0F0Full ) << 4 ) | ( ( x >> 4 ) & 0x0F0F0F0F0F0F0F0Full );
+        x = ( ( x & 0x00FF00FF00FF00FFull ) << 8 ) | ( ( x >> 8 ) & 0x00FF00FF00FF00FFull );
+        x = ( ( x & 0x0000FFFF0000FFFFull ) << 16 ) | ( ( x >> 16 ) & 0x0000FFFF0000FFFFull );
+
+        return ( x << 32 ) | ( x >> 32 );
+    }
+
+    // y = ( y ^ x ) * h, where x is the 16 byte block at p
+
+    BOOST_CXX14_CONSTEXPR static void block( std::uint64_t (&y)[ 2 ], std::uint64_t const (&h)[ 2 ], unsigned char const* p )
+    {
+        std::uint64_t const y1 = y[ 0 ] ^ detail::read64be( p + 0 );
+        std::uint64_t const y0 = y[ 1 ] ^ detail::read64be( p + 8 );
+        std::uint64_t const y2 = y0 ^ y1;
+
+        std::uint64_t const h1 = h[ 0 ];
+        std::uint64_t const h0 = h[ 1 ];
+        std::uint64_t const h2 = h0 ^ h1;
+
+        std::uint64_t const y0r = rev64( y0 ), y1r = rev64( y1 ), y2r = y0r ^ y1r;
+        std::uint64_t const h0r = rev64( h0 ), h1r = rev64( h1 ), h2r = h0r ^ h1r;
+
+        // Karatsuba, with the high halves of the products
+        // obtained from the products of the reversed operands
+
+        std::uint64_t z0 = bmul64( y0, h0 );
+        std::uint64_t z1 = bmul64( y1, h1 );
+        std::uint64_t z2 = bmul64( y2, h2 );
+
+        std::uint64_t z0h = bmul64( y0r, h0r );
+        std::uint64_t z1h = bmul64( y1r, h1r );
+        std::uint64_t z2h = bmul64( y2r, h2r );
+
+        z2 ^= z0 ^ z1;
+        z2h ^= z0h ^ z1h;
+
+        z0h = rev64( z0h ) >> 1;
+        z1h = rev64( z1h ) >> 1;
+        z2h = rev64( z2h ) >> 1;
+
+        std::uint64_t v0 = z0;
+        std::uint64_t v1 = z0h ^ z2;
+        std::uint64_t v2 = z1 ^ z2h;
+        std::uint64_t v3 = z1h;
+
+        // the bit reversed convention of GCM shifts the product by one
+
+        v3 = ( v3 << 1 ) | ( v2 >> 63 );
+        v2 = ( v2 << 1 ) | ( v1 >> 63 );
+        v1 = ( v1 << 1 ) | ( v0 >> 63 );
+        v0 = ( v0 << 1 );
+
+        // reduction modulo x^128 + x^7 + x^2 + x + 1
+
+        v2 ^= v0 ^ ( v0 >> 1 ) ^ ( v0 >> 2 ) ^ ( v0 >> 7 );
+        v1 ^= ( v0 << 63 ) ^ ( v0 << 62 ) ^ ( v0 << 57 );
+        v3 ^= v1 ^ ( v1 >> 1 ) ^ ( v1 >> 2 ) ^ ( v1 >> 7 );
+        v2 ^= ( v1 << 63 ) ^ ( v1 << 62 ) ^ ( v1 << 57 );
+
+        y[ 0 ] = v3;
+        y[ 1 ] = v2;
+    }
+
+    BOOST_CXX14_CONSTEXPR void blocks( unsigned char const* p, std::size_t n )
+    {
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_ssse3_pclmul() )
+        {
+            detail::ghash_update_pclmul( y_, h_, p, n );
+            return;
+        }
+
+#endif
+
+        while( n >= 16 )
+        {
+            block( y_, h_, p );
+
+            p += 16;
+            n -= 16;
+        }
+    }
+
+public:
+
+    using result_type = digest<16>;
+
+    ghash() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit ghash( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    // A 16 byte seed is the key H; other seeds
+    // are used as a prefix of the message
+
+    BOOST_CXX14_CONSTEXPR ghash( unsigned char const * p, std::size_t n )
+    {
+        if( n == 16 )
+        {
+            h_[ 0 ] = detail::read64be( p + 0 );
+            h_[ 1 ] = detail::read64be( p + 8 );
+        }
+        else if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( ghash, "ghash", n );
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 16 - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < 16 ) return;
+
+            block( y_, h_, buffer_ );
+            m_ = 0;
+        }
+
+        std::size_t const m = n & ~static_cast<std::size_t>( 15 );
+
+        if( m > 0 )
+        {
+            blocks( p, m );
+
+            p += m;
+            n -= m;
+        }
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( ghash, "ghash" );
+
+        std::uint64_t y[ 2 ] = { y_[ 0 ], y_[ 1 ] };
+
+        if( m_ > 0 )
+        {
+            // the partial last block, padded with zeroes
+
+            unsigned char tmp[ 16 ] = {};
+            detail::memcpy( tmp, buffer_, m_ );
+
+            block( y, h_, tmp );
+        }
+
+        result_type r;
+
+        detail::write64be( r.data() + 0, y[ 0 ] );
+        detail::write64be( r.data() + 8, y[ 1 ] );
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp[ 1 ] = { 0xFF };
+        BOOST_HASH2_STATS_SUSPEND();
+        update( tmp, 1 );
+        BOOST_HASH2_STATS_RESUME();
+
+        return r;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.h_ );
+        ar.words( self.y_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 16 + 16 + 16 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        ghash tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || tmp.m_ >= 16 ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_GHASH_HPP_INCLUDED
@@ -0,0 +1,227 @@
+#ifndef BOOST_HASH2_HASH_HPP_INCLUDED
+#define BOOST_HASH2_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <string>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class Hash, class Flavor, class T> void hash_append_key( Hash& h, Flavor const& f, T const& v, std::false_type )
+{
+    hash2::hash_append( h, f, v );
+}
+
+// a contiguous range is the only thing hashed, so its size needn't be
+
+template<class Hash, class Flavor, class T> void hash_append_key( Hash& h, Flavor const& f, T const& v, std::true_type )
+{
+    hash2::hash_append_range( h, f, v.data(), v.data() + v.size() );
+}
+
+// a 64 bit hash value of v, as hash<T, H, Flavor> would compute it
+// before reducing it to std::size_t
+
+template<class H, class Flavor, class T> std::uint64_t hash_value64( H const& h0, T const& v )
+{
+    H h( h0 );
+    detail::hash_append_key( h, Flavor(), v, container_hash::is_contiguous_range<T>() );
+
+    return hash2::get_integral_result<std::uint64_t>( h.result() );
+}
+
+// heterogeneous lookup; a contiguous range is hashed as its elements, so
+// two such ranges with the same element type hash the same way, as does
+// a null-terminated string of the same characters
+//
+// the element type is also taken from the types that only have data() and
+// size(), such as the handles of strings in arenas or in shared memory,
+// which aren't ranges themselves
+
+template<class T, class E = void> struct range_element_type
+{
+};
+
+template<class T> struct range_element_type<T, typename std::enable_if<
+    std::is_pointer< decltype( std::declval<T const&>().data() ) >::value &&
+    std::is_integral< decltype( std::declval<T const&>().size() ) >::value
+    >::type>
+{
+    using type = typename std::remove_cv< typename std::remove_pointer< decltype( std::declval<T const&>().data() ) >::type >::type;
+};
+
+template<class T, class U, class E = void> struct is_same_range_element: std::false_type
+{
+};
+
+template<class T, class U> struct is_same_range_element<T, U, typename std::enable_if< std::is_same<typename range_element_type<T>::type, typename range_element_type<U>::type>::value >::type>: std::true_type
+{
+};
+
+template<class Ch> struct is_char_type: std::integral_constant<bool,
+    std::is_same<Ch, char>::value ||
+    std::is_same<Ch, wchar_t>::value ||
+#if defined(__cpp_char8_t) && __cpp_char8_t >= 201811L
+    std::is_same<Ch, char8_t>::value ||
+#endif
+    std::is_same<Ch, char16_t>::value ||
+    std::is_same<Ch, char32_t>::value>
+{
+};
+
+template<class T, class Ch, class E = void> struct is_range_of_char: std::false_type
+{
+};
+
+template<class T, class Ch> struct is_range_of_char<T, Ch, typename std::enable_if< std::is_same<typename range_element_type<T>::type, Ch>::value && is_char_type<Ch>::value >::type>: std::true_type
+{
+};
+
+// the keys that hash<T> and key_equal<T> accept besides T
+
+template<class T, class U, class E = void> struct is_key_of: std::integral_constant<bool,
+    container_hash::is_contiguous_range<T>::value && is_same_range_element<T, U>::value>
+{
+};
+
+template<class T, class U> struct is_key_of<T, U, typename std::enable_if< std::is_pointer< typename std::decay<U>::type >::value >::type>: std::integral_constant<bool,
+    container_hash::is_contiguous_range<T>::value && is_range_of_char<T, typename std::remove_cv< typename std::remove_pointer< typename std::decay<U>::type >::type >::type>::value>
+{
+};
+
+template<class E> struct key_view
+{
+    E const* p;
+    std::size_t n;
+};
+
+template<class Ch> key_view<Ch> make_key_view( Ch const* p )
+{
+    return { p, std::char_traits<Ch>::length( p ) };
+}
+
+template<class U> auto make_key_view( U const& v ) -> key_view< typename range_element_type<U>::type >
+{
+    return { v.data(), static_cast<std::size_t>( v.size() ) };
+}
+
+template<bool Transparent> struct hash_transparent_base
+{
+};
+
+template<> struct hash_transparent_base<true>
+{
+    using is_transparent = void;
+};
+
+} // namespace detail
+
+// hash<T, H, Flavor>, a hash function object for unordered containers
+
+// the hash algorithm is constructed, with the seed if one is given, once;
+// each call copies it, so the cost of seeding isn't paid per call
+//
+// when T is a contiguous range, hash is transparent and also accepts the
+// contiguous ranges with the same element type, whatever their allocator,
+// the types with data() and size() returning such elements, and, for
+// strings, null terminated character arrays, producing the same value for
+// the same elements
+
+template<class T, class H, class Flavor = default_flavor> class hash: public detail::hash_transparent_base< container_hash::is_contiguous_range<T>::value >
+{
+private:
+
+    H h_;
+
+public:
+
+    using is_avalanching = std::true_type;
+
+    hash(): h_()
+    {
+    }
+
+    explicit hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    hash( unsigned char const* seed, std::size_t n ): h_( seed, n )
+    {
+    }
+
+    std::size_t operator()( T const& v ) const
+    {
+        H h( h_ );
+        detail::hash_append_key( h, Flavor(), v, container_hash::is_contiguous_range<T>() );
+
+        return hash2::get_integral_result<std::size_t>( h.result() );
+    }
+
+    template<class U>
+        typename std::enable_if< !std::is_same<U, T>::value && container_hash::is_contiguous_range<T>::value && detail::is_same_range_element<T, U>::value, std::size_t >::type
+        operator()( U const& v ) const
+    {
+        H h( h_ );
+        hash2::hash_append_range( h, Flavor(), v.data(), v.data() + v.size() );
+
+        return hash2::get_integral_result<std::size_t>( h.result() );
+    }
+
+    template<class Ch>
+        typename std::enable_if< container_hash::is_contiguous_range<T>::value && detail::is_range_of_char<T, Ch>::value, std::size_t >::type
+        operator()( Ch const* p ) const
+    {
+        H h( h_ );
+        hash2::hash_append_range( h, Flavor(), p, p + std::char_traits<Ch>::length( p ) );
+
+        return hash2::get_integral_result<std::size_t>( h.result() );
+    }
+};
+
+// key_equal<T>, the equality comparison to use along with hash<T, H, Flavor>
+//
+// when T is a contiguous range, it's transparent and compares the elements
+// of the keys that hash<T, H, Flavor> accepts, so that, unlike with
+// std::equal_to<>, a std::string can be compared with a string using
+// another allocator, or a handle to a string in an arena, without
+// constructing either
+
+template<class T> struct key_equal: public detail::hash_transparent_base< container_hash::is_contiguous_range<T>::value >
+{
+    bool operator()( T const& v1, T const& v2 ) const
+    {
+        return v1 == v2;
+    }
+
+    template<class U, class V>
+        typename std::enable_if< detail::is_key_of<T, U>::value && detail::is_key_of<T, V>::value, bool >::type
+        operator()( U const& v1, V const& v2 ) const
+    {
+        auto const k1 = detail::make_key_view( v1 );
+        auto const k2 = detail::make_key_view( v2 );
+
+        return k1.n == k2.n && std::equal( k1.p, k1.p + k1.n, k2.p );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_HPP_INCLUDED
@@ -0,0 +1,115 @@
+#ifndef BOOST_HASH2_HASH160_HPP_INCLUDED
+#define BOOST_HASH2_HASH160_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash160, RIPEMD-160 of the SHA-256 of a message, as used by Bitcoin
+// for the derivation of addresses from public keys
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/digest.hpp>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+inline digest<20> hash160( void const* p, std::size_t n )
+{
+    sha2_256 h1;
+    h1.update( p, n );
+
+    digest<32> d = h1.result();
+
+    ripemd_160 h2;
+    h2.update( d.data(), d.size() );
+
+    return h2.result();
+}
+
+namespace detail
+{
+
+// keys are processed in groups of this size
+
+constexpr std::size_t hash160_batch_size = 16;
+
+} // namespace detail
+
+// hash160_batch, stores in successive positions of out hash160 of each
+// of the byte sequences in [first, last)
+//
+// groups of consecutive keys of the same size are hashed by the
+// multi-buffer kernels, SHA-256 over the keys, then RIPEMD-160 over the
+// resulting digests; other keys are hashed one at a time
+
+template<class It, class OutIt> OutIt hash160_batch( It first, It last, OutIt out )
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    static_assert( sizeof( *std::declval<T const&>().data() ) == 1, "The keys must be contiguous ranges of bytes" );
+
+    constexpr std::size_t N = detail::hash160_batch_size;
+
+    void const* p[ N ];
+
+    while( first != last )
+    {
+        It it = first;
+
+        std::size_t const m = first->size();
+        std::size_t n = 0;
+
+        for( ; n < N && it != last && it->size() == m; ++n, ++it )
+        {
+            p[ n ] = it->data();
+        }
+
+        if( n < N )
+        {
+            // no group of N starts in [first, it)
+
+            for( ; first != it; ++first )
+            {
+                *out++ = hash2::hash160( first->data(), first->size() );
+            }
+
+            continue;
+        }
+
+        sha2_256_multi<N> h1;
+        h1.update( p, m );
+
+        typename sha2_256_multi<N>::result_type r1 = h1.result();
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            p[ j ] = r1[ j ].data();
+        }
+
+        ripemd_160_multi<N> h2;
+        h2.update( p, 32 );
+
+        typename ripemd_160_multi<N>::result_type r2 = h2.result();
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            *out++ = r2[ j ];
+        }
+
+        first = it;
+    }
+
+    return out;
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH160_HPP_INCLUDED
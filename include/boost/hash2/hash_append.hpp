@@ -14,12 +14,17 @@
 #include <boost/hash2/hash_append_fwd.hpp>
 #include <boost/hash2/is_contiguously_hashable.hpp>
 #include <boost/hash2/has_constant_size.hpp>
+#include <boost/hash2/segmented_iterator.hpp>
 #include <boost/hash2/get_integral_result.hpp>
 #include <boost/hash2/flavor.hpp>
 #include <boost/hash2/detail/is_constant_evaluated.hpp>
 #include <boost/hash2/detail/bit_cast.hpp>
 #include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/read.hpp>
 #include <boost/hash2/detail/has_tag_invoke.hpp>
+#include <boost/hash2/detail/has_update_word.hpp>
+#include <boost/hash2/detail/has_trace.hpp>
+#include <boost/hash2/detail/byteswap.hpp>
 #include <boost/container_hash/is_range.hpp>
 #include <boost/container_hash/is_contiguous_range.hpp>
 #include <boost/container_hash/is_unordered_range.hpp>
@@ -29,9 +34,20 @@
 #include <boost/describe/members.hpp>
 #include <boost/mp11/algorithm.hpp>
 #include <boost/mp11/integer_sequence.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <bitset>
+#include <memory>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
 #include <iterator>
+#if !defined(BOOST_NO_CXX17_HDR_OPTIONAL)
+# include <optional>
+#endif
+#if !defined(BOOST_NO_CXX17_HDR_VARIANT)
+# include <variant>
+#endif
 
 namespace boost
 {
@@ -46,7 +62,7 @@ namespace hash2
 namespace detail
 {
 
-template<class Hash, class Flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_range_( Hash& h, Flavor const& f, It first, It last )
+template<class Hash, class Flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_range_( Hash& h, Flavor const& f, It first, It last, std::false_type )
 {
     for( ; first != last; ++first )
     {
@@ -55,6 +71,36 @@ template<class Hash, class Flavor, class It> BOOST_CXX14_CONSTEXPR void hash_app
     }
 }
 
+// segmented iterator, contiguously hashable elements; each block is
+// passed to the pointer overload below, so the result doesn't change
+
+template<class Hash, class Flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_range_( Hash& h, Flavor const& f, It first, It last, std::true_type )
+{
+    typedef typename std::iterator_traits<It>::value_type T;
+
+    while( first != last )
+    {
+        T const* p = &*first;
+
+        auto n = segmented_iterator_traits<It>::segment_end( first ) - p;
+        auto m = last - first;
+
+        if( m < n ) n = m;
+
+        hash2::hash_append_range( h, f, p, p + n );
+
+        first += n;
+    }
+}
+
+template<class Hash, class Flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_range_( Hash& h, Flavor const& f, It first, It last )
+{
+    typedef typename std::iterator_traits<It>::value_type T;
+
+    detail::hash_append_range_( h, f, first, last, std::integral_constant<bool,
+        is_segmented_iterator<It>::value && is_contiguously_hashable<T, Flavor::byte_order>::value>() );
+}
+
 template<class Hash, class Flavor> BOOST_CXX14_CONSTEXPR void hash_append_range_( Hash& h, Flavor const& /*f*/, unsigned char* first, unsigned char* last )
 {
     h.update( first, last - first );
@@ -98,6 +144,126 @@ template<class Hash, class Flavor, class T>
 
 #endif
 
+// integral and enum types of size 2, 4 or 8, byte order not native;
+// the elements are byte swapped into a buffer, which is passed to update.
+// Enums with a tag_invoke are hashed through it, one by one
+
+template<class T, endian E> struct is_byteswap_hashable: std::integral_constant<bool,
+    ( std::is_integral<T>::value || ( std::is_enum<T>::value && !has_tag_invoke<T>::value ) ) &&
+    ( sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 ) &&
+    E != endian::native && ( endian::native == endian::little || endian::native == endian::big )>
+{
+};
+
+// never constexpr
+
+template<class Hash, class T> void hash_append_byteswapped( Hash& h, T const* p, std::size_t n )
+{
+    constexpr std::size_t N = 512 / sizeof(T);
+    unsigned char tmp[ 512 ];
+
+    while( n > 0 )
+    {
+        std::size_t m = n < N? n: N;
+
+        detail::byteswap_copy( reinterpret_cast<unsigned char const*>( p ), m * sizeof(T), tmp, sizeof(T) );
+        h.update( tmp, m * sizeof(T) );
+
+        p += m;
+        n -= m;
+    }
+}
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if<
+        is_byteswap_hashable<T, Flavor::byte_order>::value, void >::type
+    hash_append_range_( Hash& h, Flavor const& f, T* first, T* last )
+{
+    if( !detail::is_constant_evaluated() )
+    {
+        detail::hash_append_byteswapped( h, first, static_cast<std::size_t>( last - first ) );
+    }
+    else
+    {
+        for( ; first != last; ++first )
+        {
+            hash2::hash_append( h, f, *first );
+        }
+    }
+}
+
+// float and double; the elements are normalized with + 0, as in
+// do_hash_append, into a buffer, which is passed to update
+
+template<class T, endian E> struct is_floating_point_range_hashable: std::integral_constant<bool,
+    std::is_floating_point<T>::value && ( sizeof(T) == 4 || sizeof(T) == 8 ) &&
+    ( E == endian::native || endian::native == endian::little || endian::native == endian::big )>
+{
+};
+
+// never constexpr
+
+template<class Hash, class T> void hash_append_floating_point_range( Hash& h, T const* p, std::size_t n, endian e )
+{
+    typedef typename std::remove_cv<T>::type U;
+
+    constexpr std::size_t N = 512 / sizeof(U);
+    U tmp[ N ];
+
+    while( n > 0 )
+    {
+        std::size_t m = n < N? n: N;
+
+        std::size_t i = 0;
+
+        // a constant trip count lets the compiler vectorize at -O2
+
+        for( ; i + 16 <= m; i += 16 )
+        {
+            for( std::size_t j = 0; j < 16; ++j )
+            {
+                tmp[ i + j ] = p[ i + j ] + 0;
+            }
+        }
+
+        for( ; i < m; ++i )
+        {
+            tmp[ i ] = p[ i ] + 0;
+        }
+
+        if( e != endian::native )
+        {
+            unsigned char* q = reinterpret_cast<unsigned char*>( tmp );
+            detail::byteswap_copy( q, m * sizeof(U), q, sizeof(U) );
+        }
+
+        h.update( tmp, m * sizeof(U) );
+
+        p += m;
+        n -= m;
+    }
+}
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if<
+        is_floating_point_range_hashable<T, Flavor::byte_order>::value, void >::type
+    hash_append_range_( Hash& h, Flavor const& f, T* first, T* last )
+{
+    if( !detail::is_constant_evaluated() )
+    {
+        detail::hash_append_floating_point_range( h, first, static_cast<std::size_t>( last - first ), Flavor::byte_order );
+    }
+    else
+    {
+        for( ; first != last; ++first )
+        {
+            hash2::hash_append( h, f, *first );
+        }
+    }
+}
+
 } // namespace detail
 
 template<class Hash, class Flavor = default_flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_range( Hash& h, Flavor const& f, It first, It last )
@@ -107,9 +273,29 @@ template<class Hash, class Flavor = default_flavor, class It> BOOST_CXX14_CONSTE
 
 // hash_append_size
 
-template<class Hash, class Flavor = default_flavor, class T> BOOST_CXX14_CONSTEXPR void hash_append_size( Hash& h, Flavor const& f, T const& v )
+namespace detail
+{
+
+template<class Hash, class Flavor, class T> BOOST_CXX14_CONSTEXPR void hash_append_size_( Hash& h, Flavor const& f, T const& v, std::false_type )
 {
+    detail::trace_begin( h, "size" );
+
     hash2::hash_append( h, f, static_cast<typename Flavor::size_type>( v ) );
+
+    detail::trace_end( h );
+}
+
+// Flavor::size_type is void, sizes aren't hashed
+
+template<class Hash, class Flavor, class T> BOOST_CXX14_CONSTEXPR void hash_append_size_( Hash& /*h*/, Flavor const& /*f*/, T const& /*v*/, std::true_type )
+{
+}
+
+} // namespace detail
+
+template<class Hash, class Flavor = default_flavor, class T> BOOST_CXX14_CONSTEXPR void hash_append_size( Hash& h, Flavor const& f, T const& v )
+{
+    detail::hash_append_size_( h, f, v, std::is_void<typename Flavor::size_type>() );
 }
 
 // hash_append_sized_range
@@ -144,18 +330,65 @@ template<class Hash, class Flavor = default_flavor, class It> BOOST_CXX14_CONSTE
 
 // hash_append_unordered_range
 
+namespace detail
+{
+
+template<class Flavor, class En = void> struct has_unordered_element_hash: std::false_type
+{
+};
+
+template<class Flavor> struct has_unordered_element_hash<Flavor, decltype( (void)sizeof( typename Flavor::unordered_element_hash ), void() )>: std::true_type
+{
+};
+
+// The elements are hashed with copies of the object returned by
+// unordered_element_hash; by default, this is h itself.
+
+template<class Hash, class Flavor> BOOST_CXX14_CONSTEXPR Hash const& unordered_element_hash( Hash const& h, Flavor const& /*f*/, std::false_type )
+{
+    return h;
+}
+
+// When the flavor specifies Flavor::unordered_element_hash, the elements
+// are hashed with it instead of with copies of h, keyed by 16 bytes derived
+// from the current state of h; this avoids copying and finalizing the
+// (possibly expensive) Hash once per element
+
+template<class Hash, class Flavor> BOOST_CXX14_CONSTEXPR typename Flavor::unordered_element_hash unordered_element_hash( Hash const& h, Flavor const& /*f*/, std::true_type )
+{
+    using H2 = typename Flavor::unordered_element_hash;
+
+    unsigned char key[ 16 ] = {};
+
+    Hash h0( h );
+
+    detail::write64le( key + 0, hash2::get_integral_result<std::uint64_t>( h0.result() ) );
+    detail::write64le( key + 8, hash2::get_integral_result<std::uint64_t>( h0.result() ) );
+
+    return H2( key, 16 );
+}
+
+template<class H2, class Flavor, class T> BOOST_CXX14_CONSTEXPR std::uint64_t unordered_element_value( H2 const& h1, Flavor const& f, T const& v )
+{
+    H2 h2( h1 );
+    hash2::hash_append( h2, f, v );
+
+    return hash2::get_integral_result<std::uint64_t>( h2.result() );
+}
+
+} // namespace detail
+
 template<class Hash, class Flavor = default_flavor, class It> BOOST_CXX14_CONSTEXPR void hash_append_unordered_range( Hash& h, Flavor const& f, It first, It last )
 {
+    auto const& h1 = detail::unordered_element_hash( h, f, detail::has_unordered_element_hash<Flavor>() );
+
     typename std::iterator_traits<It>::difference_type m = 0;
 
     std::uint64_t w = 0;
 
     for( ; first != last; ++first, ++m )
     {
-        Hash h2( h );
-        hash2::hash_append( h2, f, *first );
-
-        w += hash2::get_integral_result<std::uint64_t>( h2.result() );
+        w += detail::unordered_element_value( h1, f, *first );
     }
 
     hash2::hash_append( h, f, w );
@@ -175,25 +408,51 @@ namespace detail
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< std::is_integral<T>::value, void >::type
+    typename std::enable_if< std::is_integral<T>::value && !( sizeof(T) == 8 && has_update_word<Hash>::value ), void >::type
     do_hash_append( Hash& h, Flavor const& /*f*/, T const& v )
 {
+    detail::trace_begin( h, "integral" );
+
     constexpr auto N = sizeof(T);
 
     unsigned char tmp[ N ] = {};
     detail::write( v, Flavor::byte_order, tmp );
 
     h.update( tmp, N );
+
+    detail::trace_end( h );
+}
+
+// 64 bit integers are passed to update_word, when available, which
+// avoids the generic buffering logic in update
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< std::is_integral<T>::value && sizeof(T) == 8 && has_update_word<Hash>::value, void >::type
+    do_hash_append( Hash& h, Flavor const& /*f*/, T const& v )
+{
+    detail::trace_begin( h, "integral" );
+
+    unsigned char tmp[ 8 ] = {};
+    detail::write( v, Flavor::byte_order, tmp );
+
+    h.update_word( detail::read64le( tmp ) );
+
+    detail::trace_end( h );
 }
 
 // enum types
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< std::is_enum<T>::value, void >::type
+    typename std::enable_if< std::is_enum<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "enum" );
+
     hash2::hash_append( h, f, static_cast<typename std::underlying_type<T>::type>( v ) );
+
+    detail::trace_end( h );
 }
 
 // pointer types
@@ -203,7 +462,11 @@ template<class Hash, class Flavor, class T>
     typename std::enable_if< std::is_pointer<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "pointer" );
+
     hash2::hash_append( h, f, reinterpret_cast<std::uintptr_t>( v ) );
+
+    detail::trace_end( h );
 }
 
 // floating point
@@ -213,7 +476,11 @@ template<class Hash, class Flavor, class T>
     typename std::enable_if< std::is_floating_point<T>::value && sizeof(T) == 4, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "floating_point" );
+
     hash2::hash_append( h, f, detail::bit_cast<std::uint32_t>( v + 0 ) );
+
+    detail::trace_end( h );
 }
 
 template<class Hash, class Flavor, class T>
@@ -221,7 +488,11 @@ template<class Hash, class Flavor, class T>
     typename std::enable_if< std::is_floating_point<T>::value && sizeof(T) == 8, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "floating_point" );
+
     hash2::hash_append( h, f, detail::bit_cast<std::uint64_t>( v + 0 ) );
+
+    detail::trace_end( h );
 }
 
 // std::nullptr_t
@@ -231,35 +502,51 @@ template<class Hash, class Flavor, class T>
     typename std::enable_if< std::is_same<T, std::nullptr_t>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "nullptr" );
+
     hash2::hash_append( h, f, static_cast<void*>( v ) );
+
+    detail::trace_end( h );
 }
 
 // C arrays
 
 template<class Hash, class Flavor, class T, std::size_t N> BOOST_CXX14_CONSTEXPR void do_hash_append( Hash& h, Flavor const& f, T const (&v)[ N ] )
 {
+    detail::trace_begin( h, "array" );
+
     hash2::hash_append_range( h, f, v + 0, v + N );
+
+    detail::trace_end( h );
 }
 
 // contiguous containers and ranges, w/ size
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< container_hash::is_contiguous_range<T>::value && !has_constant_size<T>::value, void >::type
+    typename std::enable_if< container_hash::is_contiguous_range<T>::value && !has_constant_size<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "contiguous_range" );
+
     hash2::hash_append_range( h, f, v.data(), v.data() + v.size() );
     hash2::hash_append_size( h, f, v.size() );
+
+    detail::trace_end( h );
 }
 
 // containers and ranges, w/ size
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< container_hash::is_range<T>::value && !has_constant_size<T>::value && !container_hash::is_contiguous_range<T>::value && !container_hash::is_unordered_range<T>::value, void >::type
+    typename std::enable_if< container_hash::is_range<T>::value && !has_constant_size<T>::value && !container_hash::is_contiguous_range<T>::value && !container_hash::is_unordered_range<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "range" );
+
     hash2::hash_append_sized_range( h, f, v.begin(), v.end() );
+
+    detail::trace_end( h );
 }
 
 #if defined(BOOST_MSVC)
@@ -271,9 +558,11 @@ template<class Hash, class Flavor, class T>
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< container_hash::is_contiguous_range<T>::value && has_constant_size<T>::value, void >::type
+    typename std::enable_if< container_hash::is_contiguous_range<T>::value && has_constant_size<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "constant_size_contiguous_range" );
+
     if( v.size() == 0 )
     {
         // A hash_append call must always result in a call to Hash::update
@@ -284,15 +573,19 @@ template<class Hash, class Flavor, class T>
         // std::array<>::data() is only constexpr in C++17; boost::array<>::operator[] isn't constexpr
         hash2::hash_append_range( h, f, &v.front(), &v.front() + v.size() );
     }
+
+    detail::trace_end( h );
 }
 
 // constant size non-contiguous containers and ranges
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< container_hash::is_range<T>::value && has_constant_size<T>::value && !container_hash::is_contiguous_range<T>::value, void >::type
+    typename std::enable_if< container_hash::is_range<T>::value && has_constant_size<T>::value && !container_hash::is_contiguous_range<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "constant_size_range" );
+
     if( v.begin() == v.end() )
     {
         // A hash_append call must always result in a call to Hash::update
@@ -302,6 +595,8 @@ template<class Hash, class Flavor, class T>
     {
         hash2::hash_append_range( h, f, v.begin(), v.end() );
     }
+
+    detail::trace_end( h );
 }
 
 #if defined(BOOST_MSVC)
@@ -312,10 +607,331 @@ template<class Hash, class Flavor, class T>
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< container_hash::is_unordered_range<T>::value, void >::type
+    typename std::enable_if< container_hash::is_unordered_range<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "unordered_range" );
+
     hash2::hash_append_unordered_range( h, f, v.begin(), v.end() );
+
+    detail::trace_end( h );
+}
+
+// bit sequences (std::vector<bool>, std::bitset)
+// never constexpr
+//
+// The bits are packed eight to a byte, the first bit in the least
+// significant position, and the unused bits of the last byte are zero;
+// so the bytes passed to update are the same on all platforms
+//
+// The standard doesn't give access to the words that hold the bits, so
+// they are read one at a time, but packed into 64 bit words, which are
+// written to the buffer in little-endian order, a word at a time
+
+template<class Hash, class V> void hash_append_bits( Hash& h, V const& v, std::size_t n )
+{
+    unsigned char buffer[ 256 ];
+    std::size_t m = 0;
+
+    std::size_t i = 0;
+
+    for( ; n - i >= 64; i += 64 )
+    {
+        std::uint64_t w = 0;
+
+        for( std::size_t j = 0; j < 64; ++j )
+        {
+            w |= static_cast<std::uint64_t>( v[ i + j ] ) << j;
+        }
+
+        detail::write64le( buffer + m, w );
+        m += 8;
+
+        if( m == sizeof( buffer ) )
+        {
+            h.update( buffer, m );
+            m = 0;
+        }
+    }
+
+    if( i < n )
+    {
+        // m is at most sizeof( buffer ) - 8 here
+
+        std::uint64_t w = 0;
+
+        for( std::size_t j = 0; i + j < n; ++j )
+        {
+            w |= static_cast<std::uint64_t>( v[ i + j ] ) << j;
+        }
+
+        detail::write64le( buffer + m, w );
+        m += ( n - i + 7 ) / 8;
+    }
+
+    if( m != 0 )
+    {
+        h.update( buffer, m );
+    }
+}
+
+template<class Hash, class Flavor, class A>
+    typename std::enable_if< !has_tag_invoke< std::vector<bool, A> >::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, std::vector<bool, A> const& v )
+{
+    detail::trace_begin( h, "bit_range" );
+
+    std::size_t const n = v.size();
+
+    detail::hash_append_bits( h, v, n );
+    hash2::hash_append_size( h, f, n );
+
+    detail::trace_end( h );
+}
+
+template<class Hash, class Flavor, std::size_t N>
+    typename std::enable_if< !has_tag_invoke< std::bitset<N> >::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, std::bitset<N> const& v )
+{
+    detail::trace_begin( h, "bitset" );
+
+    if( N == 0 )
+    {
+        // A hash_append call must always result in a call to Hash::update
+        hash2::hash_append( h, f, '\x00' );
+    }
+    else if( N <= 64 )
+    {
+        unsigned char tmp[ 8 ] = {};
+        detail::write64le( tmp, v.to_ullong() );
+
+        h.update( tmp, ( N + 7 ) / 8 );
+    }
+    else
+    {
+        detail::hash_append_bits( h, v, N );
+    }
+
+    detail::trace_end( h );
+}
+
+// discriminated values (std::optional, std::variant)
+//
+// A discriminator d is followed by the value; when the value is passed to
+// update as a single block of at most 64 bytes (integral, enum, floating
+// point and contiguously hashable types), d and the value are passed in
+// one update call. Since update is split-invariant, the result is the
+// same as that of hash_append( h, f, d ) followed by hash_append( h, f, v )
+
+template<class T, endian E> struct is_mergeable_value: std::integral_constant<bool,
+    sizeof(T) <= 64 && (
+        is_contiguously_hashable<T, E>::value ||
+        std::is_integral<T>::value ||
+        ( std::is_enum<T>::value && !has_tag_invoke<T>::value ) ||
+        ( std::is_floating_point<T>::value && ( sizeof(T) == 4 || sizeof(T) == 8 ) ) )>
+{
+};
+
+// writes the bytes hash_append passes to update for v to p
+// never constexpr
+
+template<class Flavor, class T>
+    typename std::enable_if< is_contiguously_hashable<T, Flavor::byte_order>::value, void >::type
+    write_value( unsigned char* p, T const& v )
+{
+    std::memcpy( p, &v, sizeof(T) );
+}
+
+template<class Flavor, class T>
+    typename std::enable_if< !is_contiguously_hashable<T, Flavor::byte_order>::value && std::is_integral<T>::value, void >::type
+    write_value( unsigned char* p, T const& v )
+{
+    unsigned char tmp[ sizeof(T) ] = {};
+    detail::write( v, Flavor::byte_order, tmp );
+
+    std::memcpy( p, tmp, sizeof(T) );
+}
+
+template<class Flavor, class T>
+    typename std::enable_if< !is_contiguously_hashable<T, Flavor::byte_order>::value && std::is_enum<T>::value, void >::type
+    write_value( unsigned char* p, T const& v )
+{
+    detail::write_value<Flavor>( p, static_cast<typename std::underlying_type<T>::type>( v ) );
+}
+
+template<class Flavor, class T>
+    typename std::enable_if< std::is_floating_point<T>::value && sizeof(T) == 4, void >::type
+    write_value( unsigned char* p, T const& v )
+{
+    detail::write_value<Flavor>( p, detail::bit_cast<std::uint32_t>( v + 0 ) );
+}
+
+template<class Flavor, class T>
+    typename std::enable_if< std::is_floating_point<T>::value && sizeof(T) == 8, void >::type
+    write_value( unsigned char* p, T const& v )
+{
+    detail::write_value<Flavor>( p, detail::bit_cast<std::uint64_t>( v + 0 ) );
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_VARIANT)
+
+// std::monostate is the byte 0, and can be merged with the discriminator
+
+template<endian E> struct is_mergeable_value<std::monostate, E>: std::integral_constant<bool, !has_tag_invoke<std::monostate>::value>
+{
+};
+
+template<class Flavor> void write_value( unsigned char* p, std::monostate const& /*v*/ )
+{
+    static_assert( sizeof( std::monostate ) == 1, "sizeof(std::monostate) must be 1" );
+    *p = 0;
+}
+
+#endif
+
+template<class Hash, class Flavor, class D, class T>
+    BOOST_CXX14_CONSTEXPR void hash_append_discriminated( Hash& h, Flavor const& f, D const& d, T const& v, std::false_type )
+{
+    hash2::hash_append( h, f, d );
+    hash2::hash_append( h, f, v );
+}
+
+template<class Hash, class Flavor, class D, class T>
+    BOOST_CXX14_CONSTEXPR void hash_append_discriminated( Hash& h, Flavor const& f, D const& d, T const& v, std::true_type )
+{
+    if( detail::is_constant_evaluated() )
+    {
+        detail::hash_append_discriminated( h, f, d, v, std::false_type() );
+        return;
+    }
+
+    unsigned char tmp[ sizeof(D) + sizeof(T) ] = {};
+
+    detail::write_value<Flavor>( tmp, d );
+    detail::write_value<Flavor>( tmp + sizeof(D), v );
+
+    h.update( tmp, sizeof(tmp) );
+}
+
+template<class Hash, class Flavor, class D, class T>
+    BOOST_CXX14_CONSTEXPR void hash_append_discriminated( Hash& h, Flavor const& f, D const& d, T const& v )
+{
+    detail::hash_append_discriminated( h, f, d, v, is_mergeable_value<T, Flavor::byte_order>() );
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_OPTIONAL)
+
+// std::optional; an empty optional is the byte 0, an engaged one the
+// byte 1 followed by the value
+//
+// these overloads, and those for std::variant and the smart pointers
+// below, yield to a user-provided tag_invoke, as the generic cases do
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< !has_tag_invoke< std::optional<T> >::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, std::optional<T> const& v )
+{
+    detail::trace_begin( h, "optional" );
+
+    if( v.has_value() )
+    {
+        detail::hash_append_discriminated( h, f, static_cast<unsigned char>( 1 ), *v );
+    }
+    else
+    {
+        hash2::hash_append( h, f, static_cast<unsigned char>( 0 ) );
+    }
+
+    detail::trace_end( h );
+}
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< std::is_same<T, std::nullopt_t>::value && !has_tag_invoke<T>::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, T const& /*v*/ )
+{
+    detail::trace_begin( h, "optional" );
+
+    hash2::hash_append( h, f, static_cast<unsigned char>( 0 ) );
+
+    detail::trace_end( h );
+}
+
+#endif
+
+#if !defined(BOOST_NO_CXX17_HDR_VARIANT)
+
+// std::variant; the discriminator is index() + 1, one byte when there
+// are fewer than 255 alternatives, followed by the alternative; a
+// variant that is valueless by exception is the discriminator 0
+
+template<std::size_t N> using variant_discriminator = typename std::conditional< ( N < 255 ), unsigned char, std::uint32_t >::type;
+
+template<class Hash, class Flavor, class... T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< !has_tag_invoke< std::variant<T...> >::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, std::variant<T...> const& v )
+{
+    detail::trace_begin( h, "variant" );
+
+    using D = variant_discriminator<sizeof...(T)>;
+
+    if( v.valueless_by_exception() )
+    {
+        hash2::hash_append( h, f, static_cast<D>( 0 ) );
+    }
+    else
+    {
+        mp11::mp_with_index<sizeof...(T)>( v.index(), [&]( auto I ){
+
+            detail::hash_append_discriminated( h, f, static_cast<D>( I + 1 ), std::get<I>( v ) );
+
+        });
+    }
+
+    detail::trace_end( h );
+}
+
+template<class Hash, class Flavor, class T>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< std::is_same<T, std::monostate>::value && !has_tag_invoke<T>::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, T const& /*v*/ )
+{
+    detail::trace_begin( h, "monostate" );
+
+    // A hash_append call must always result in a call to Hash::update
+    hash2::hash_append( h, f, '\x00' );
+
+    detail::trace_end( h );
+}
+
+#endif
+
+// std::unique_ptr, std::shared_ptr; hashed as the stored pointer, as they
+// compare equal when it does
+// never constexpr
+
+template<class Hash, class Flavor, class T, class D>
+    typename std::enable_if< !has_tag_invoke< std::unique_ptr<T, D> >::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, std::unique_ptr<T, D> const& v )
+{
+    detail::trace_begin( h, "smart_pointer" );
+
+    hash2::hash_append( h, f, v.get() );
+
+    detail::trace_end( h );
+}
+
+template<class Hash, class Flavor, class T>
+    typename std::enable_if< !has_tag_invoke< std::shared_ptr<T> >::value, void >::type
+    do_hash_append( Hash& h, Flavor const& f, std::shared_ptr<T> const& v )
+{
+    detail::trace_begin( h, "smart_pointer" );
+
+    hash2::hash_append( h, f, v.get() );
+
+    detail::trace_end( h );
 }
 
 // tuple-likes
@@ -335,11 +951,15 @@ template<class Hash, class Flavor, class T> BOOST_CXX14_CONSTEXPR void hash_appe
 
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< !container_hash::is_range<T>::value && container_hash::is_tuple_like<T>::value, void >::type
+    typename std::enable_if< !container_hash::is_range<T>::value && container_hash::is_tuple_like<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "tuple_like" );
+
     using Seq = mp11::make_index_sequence<std::tuple_size<T>::value>;
     detail::hash_append_tuple( h, f, v, Seq() );
+
+    detail::trace_end( h );
 }
 
 // described classes
@@ -351,11 +971,61 @@ template<class Hash, class Flavor, class T>
 # pragma warning(disable: 4100) // unreferenced formal parameter
 #endif
 
+// Adjacent contiguously hashable members, without padding between them,
+// are collected into a single byte range [p, p+n), which is passed to
+// one update call; since update is split-invariant, the result is the
+// same as hashing the members one by one
+//
+// The fusion is always done, there's no trait or flavor to enable it, as
+// it doesn't change the result; it's only skipped when Hash has
+// trace_begin and trace_end, such as recording_hash, so that each member
+// still gets its own span, whatever the layout of the class
+
+template<class Hash, class Flavor, class M>
+    BOOST_CXX14_CONSTEXPR void hash_append_member( Hash& h, Flavor const& f, M const& m, unsigned char const*& p, std::size_t& n, std::false_type )
+{
+    if( n != 0 )
+    {
+        h.update( p, n );
+        n = 0;
+    }
+
+    hash2::hash_append( h, f, m );
+}
+
+template<class Hash, class Flavor, class M>
+    BOOST_CXX14_CONSTEXPR void hash_append_member( Hash& h, Flavor const& f, M const& m, unsigned char const*& p, std::size_t& n, std::true_type )
+{
+    if( detail::is_constant_evaluated() )
+    {
+        hash2::hash_append( h, f, m );
+        return;
+    }
+
+    unsigned char const* q = reinterpret_cast<unsigned char const*>( &m );
+
+    if( n != 0 && q == p + n )
+    {
+        n += sizeof(M);
+        return;
+    }
+
+    if( n != 0 )
+    {
+        h.update( p, n );
+    }
+
+    p = q;
+    n = sizeof(M);
+}
+
 template<class Hash, class Flavor, class T>
     BOOST_CXX14_CONSTEXPR
-    typename std::enable_if< container_hash::is_described_class<T>::value, void >::type
+    typename std::enable_if< container_hash::is_described_class<T>::value && !has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "described_class" );
+
     static_assert( !std::is_union<T>::value, "Described unions are not supported" );
 
     std::size_t r = 0;
@@ -372,19 +1042,33 @@ template<class Hash, class Flavor, class T>
 
     using Md = describe::describe_members<T, describe::mod_any_access>;
 
+    unsigned char const* p = nullptr;
+    std::size_t n = 0;
+
     mp11::mp_for_each<Md>([&](auto D){
 
-        hash2::hash_append( h, f, v.*D.pointer );
+        using M = typename std::remove_cv<typename std::remove_reference<decltype( v.*D.pointer )>::type>::type;
+
+        using fuse = std::integral_constant<bool, is_contiguously_hashable<M, Flavor::byte_order>::value && !has_trace<Hash>::value>;
+
+        detail::hash_append_member( h, f, v.*D.pointer, p, n, fuse() );
         ++r;
 
     });
 
+    if( n != 0 )
+    {
+        h.update( p, n );
+    }
+
     // A hash_append call must always result in a call to Hash::update
 
     if( r == 0 )
     {
         hash2::hash_append( h, f, '\x00' );
     }
+
+    detail::trace_end( h );
 }
 
 #if defined(_MSC_VER) && _MSC_VER == 1900
@@ -400,9 +1084,24 @@ template<class Hash, class Flavor, class T>
     typename std::enable_if< detail::has_tag_invoke<T>::value, void >::type
     do_hash_append( Hash& h, Flavor const& f, T const& v )
 {
+    detail::trace_begin( h, "tag_invoke" );
+
     tag_invoke( hash_append_tag(), h, f, v );
+
+    detail::trace_end( h );
 }
 
+// 64 bit integral, enum and pointer values are passed to update_word,
+// when Hash has it, even when they are contiguously hashable
+
+template<class Hash, class T> struct is_update_word_value: std::integral_constant<bool,
+    has_update_word<Hash>::value && sizeof(T) == 8 && (
+        std::is_integral<T>::value ||
+        ( std::is_enum<T>::value && !has_tag_invoke<T>::value ) ||
+        std::is_pointer<T>::value )>
+{
+};
+
 } // namespace detail
 
 // hash_append
@@ -410,9 +1109,13 @@ template<class Hash, class Flavor, class T>
 template<class Hash, class Flavor = default_flavor, class T>
 BOOST_CXX14_CONSTEXPR void hash_append( Hash& h, Flavor const& f, T const& v )
 {
-    if( !detail::is_constant_evaluated() && is_contiguously_hashable<T, Flavor::byte_order>::value )
+    if( !detail::is_constant_evaluated() && is_contiguously_hashable<T, Flavor::byte_order>::value && !detail::is_update_word_value<Hash, T>::value )
     {
+        detail::trace_begin( h, "contiguously_hashable" );
+
         h.update( &v, sizeof(T) );
+
+        detail::trace_end( h );
     }
     else
     {
@@ -0,0 +1,256 @@
+#ifndef BOOST_HASH2_HASH_APPEND_PARALLEL_HPP_INCLUDED
+#define BOOST_HASH2_HASH_APPEND_PARALLEL_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash_append_unordered_range and hash_append_range overloads taking
+// a task_executor, or a C++17 execution policy, and hash_append_range_tree
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/parallel_hash.hpp>
+#include <boost/hash2/is_contiguously_hashable.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The random access range is split into up to ex.concurrency() parts,
+// the element values of each are summed on ex, and the sums are added;
+// the result is that of the sequential hash_append_unordered_range
+
+template<class Hash, class Flavor, class It> void hash_append_unordered_range( task_executor& ex, Hash& h, Flavor const& f, It first, It last )
+{
+    static_assert( std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value, "hash_append_unordered_range with an executor requires random access iterators" );
+
+    auto const& h1 = detail::unordered_element_hash( h, f, detail::has_unordered_element_hash<Flavor>() );
+
+    typename std::iterator_traits<It>::difference_type m = last - first;
+
+    std::size_t const n = static_cast<std::size_t>( m );
+
+    // below 1024 elements per part, running a task costs more than it saves
+
+    std::size_t const parts = detail::parallel_parts( ex, n, 1024 );
+
+    std::vector<std::uint64_t> w( parts );
+
+    hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+        It i = first + static_cast<std::ptrdiff_t>( n * t / parts );
+        It j = first + static_cast<std::ptrdiff_t>( n * ( t + 1 ) / parts );
+
+        std::uint64_t r = 0;
+
+        for( ; i != j; ++i )
+        {
+            r += detail::unordered_element_value( h1, f, *i );
+        }
+
+        w[ t ] = r;
+    });
+
+    std::uint64_t r = 0;
+
+    for( std::size_t t = 0; t < parts; ++t )
+    {
+        r += w[ t ];
+    }
+
+    hash2::hash_append( h, f, r );
+    hash2::hash_append_size( h, f, m );
+}
+
+// A contiguously hashable range is passed to a single update_parallel,
+// which hashes it on ex
+
+template<class Hash, class Flavor, class T> void hash_append_range( task_executor& ex, Hash& h, Flavor const& /*f*/, T* first, T* last )
+{
+    static_assert( has_update_parallel<Hash>::value, "hash_append_range with an executor requires a hash algorithm with update_parallel, such as crc32c, blake3 or k12" );
+    static_assert( is_contiguously_hashable<T, Flavor::byte_order>::value, "hash_append_range with an executor requires a contiguously hashable element type" );
+
+    detail::parallel_update( h, first, ( last - first ) * sizeof( T ), ex, has_update_parallel<Hash>() );
+}
+
+// hash_append_range_tree, a parallel fingerprint of a sequence; the
+// elements are hashed in groups of `group`, and the group hashes are
+// combined in a binary tree, with the prefixes of merkle_tree:
+//
+//   leaf = Hash( h )( 0x00 || elements )
+//   node = Hash( h )( 0x01 || left || right )
+//
+// where Hash( h ) is a copy of h, and a node without a sibling is promoted.
+// The root and the size are then appended to h. The result depends on the
+// group size, but not on ex; it differs from that of hash_append_range.
+
+namespace detail
+{
+
+template<class Hash, class Flavor> typename Hash::result_type range_tree_node( Hash const& h0, Flavor const& f, typename Hash::result_type const& l, typename Hash::result_type const& r )
+{
+    unsigned char const prefix = 0x01;
+
+    Hash h( h0 );
+
+    h.update( &prefix, 1 );
+
+    hash2::hash_append( h, f, l );
+    hash2::hash_append( h, f, r );
+
+    return h.result();
+}
+
+} // namespace detail
+
+template<class Hash, class Flavor, class It> void hash_append_range_tree( task_executor& ex, Hash& h, Flavor const& f, It first, It last, std::size_t group = 1024 )
+{
+    static_assert( std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value, "hash_append_range_tree requires random access iterators" );
+
+    BOOST_ASSERT( group > 0 );
+
+    using R = typename Hash::result_type;
+
+    typename std::iterator_traits<It>::difference_type m = last - first;
+
+    std::size_t const n = static_cast<std::size_t>( m );
+    std::size_t const leaves = ( n + group - 1 ) / group;
+
+    if( leaves > 0 )
+    {
+        Hash const h0( h );
+
+        std::vector<R> w( leaves );
+
+        std::size_t const parts = detail::parallel_parts( ex, leaves, 1 );
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+            std::size_t const k1 = leaves * t / parts;
+            std::size_t const k2 = leaves * ( t + 1 ) / parts;
+
+            for( std::size_t k = k1; k < k2; ++k )
+            {
+                std::size_t const i = k * group;
+                std::size_t const j = i + group < n? i + group: n;
+
+                unsigned char const prefix = 0x00;
+
+                Hash h1( h0 );
+
+                h1.update( &prefix, 1 );
+
+                for( It it = first + static_cast<std::ptrdiff_t>( i ), end = first + static_cast<std::ptrdiff_t>( j ); it != end; ++it )
+                {
+                    hash2::hash_append( h1, f, *it );
+                }
+
+                w[ k ] = h1.result();
+            }
+        });
+
+        // the interior levels, in place
+
+        for( std::size_t k = leaves; k > 1; k = ( k + 1 ) / 2 )
+        {
+            for( std::size_t j = 0; j < k / 2; ++j )
+            {
+                w[ j ] = detail::range_tree_node( h0, f, w[ 2 * j ], w[ 2 * j + 1 ] );
+            }
+
+            if( k % 2 != 0 )
+            {
+                w[ k / 2 ] = w[ k - 1 ];
+            }
+        }
+
+        hash2::hash_append( h, f, w[ 0 ] );
+    }
+
+    hash2::hash_append_size( h, f, m );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+#include <execution>
+#include <numeric>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <cstdint>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The element values are combined with a wrapping addition, which is
+// associative and commutative, so the result doesn't depend on how the
+// policy partitions the range, and is the same as that of the sequential
+// hash_append_unordered_range
+
+template<class ExecutionPolicy, class Hash, class Flavor, class It>
+    typename std::enable_if< std::is_execution_policy< typename std::decay<ExecutionPolicy>::type >::value, void >::type
+    hash_append_unordered_range( ExecutionPolicy&& policy, Hash& h, Flavor const& f, It first, It last )
+{
+    auto const& h1 = detail::unordered_element_hash( h, f, detail::has_unordered_element_hash<Flavor>() );
+
+    std::uint64_t w = std::transform_reduce( std::forward<ExecutionPolicy>( policy ), first, last, std::uint64_t( 0 ), std::plus<std::uint64_t>(), [&]( auto const& v ){
+
+        return detail::unordered_element_value( h1, f, v );
+    });
+
+    typename std::iterator_traits<It>::difference_type m = std::distance( first, last );
+
+    hash2::hash_append( h, f, w );
+    hash2::hash_append_size( h, f, m );
+}
+
+// A contiguously hashable range is passed to a single update, which
+// algorithms with update_parallel (crc32c, blake3, k12) split across
+// threads and merge; the others can't, and are rejected
+
+template<class ExecutionPolicy, class Hash, class Flavor, class T>
+    typename std::enable_if< std::is_execution_policy< typename std::decay<ExecutionPolicy>::type >::value, void >::type
+    hash_append_range( ExecutionPolicy&& /*policy*/, Hash& h, Flavor const& /*f*/, T* first, T* last )
+{
+    static_assert( has_update_parallel<Hash>::value, "hash_append_range with an execution policy requires a hash algorithm with update_parallel, such as crc32c, blake3 or k12" );
+    static_assert( is_contiguously_hashable<T, Flavor::byte_order>::value, "hash_append_range with an execution policy requires a contiguously hashable element type" );
+
+    unsigned const threads = std::is_same< typename std::decay<ExecutionPolicy>::type, std::execution::sequenced_policy >::value? 1: 0;
+
+    detail::parallel_update( h, first, ( last - first ) * sizeof( T ), threads, has_update_parallel<Hash>() );
+}
+
+// hash_append_range_tree under a policy; std::execution::seq hashes on
+// the calling thread, and the other policies on all hardware threads.
+// The result doesn't depend on the policy.
+
+template<class ExecutionPolicy, class Hash, class Flavor, class It>
+    typename std::enable_if< std::is_execution_policy< typename std::decay<ExecutionPolicy>::type >::value, void >::type
+    hash_append_range_tree( ExecutionPolicy&& /*policy*/, Hash& h, Flavor const& f, It first, It last, std::size_t group = 1024 )
+{
+    unsigned const threads = std::is_same< typename std::decay<ExecutionPolicy>::type, std::execution::sequenced_policy >::value? 1: 0;
+
+    thread_executor ex( threads );
+    hash2::hash_append_range_tree( ex, h, f, first, last, group );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #if !defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+#endif // #ifndef BOOST_HASH2_HASH_APPEND_PARALLEL_HPP_INCLUDED
@@ -0,0 +1,350 @@
+#ifndef BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
+#define BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash_batch, hashing a range of keys into a range of results
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/has_constant_size.hpp>
+#include <boost/hash2/is_contiguously_hashable.hpp>
+#include <boost/hash2/detail/has_hash_batch.hpp>
+#include <boost/hash2/detail/has_tag_invoke.hpp>
+#include <boost/hash2/detail/multi_buffer.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <type_traits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// keys are processed in groups of this size
+
+constexpr std::size_t hash_batch_size = 8;
+
+// the integral type whose representation hash_append passes to update
+// for a key of type T, for the keys whose messages are a single update
+// of a fixed size; void otherwise
+
+template<class T, class E = void> struct batch_word
+{
+    using type = void;
+};
+
+template<class T> struct batch_word<T, typename std::enable_if< std::is_integral<T>::value >::type>
+{
+    using type = T;
+};
+
+template<class T> struct batch_word<T, typename std::enable_if< std::is_enum<T>::value >::type>
+{
+    using type = typename std::underlying_type<T>::type;
+};
+
+// contiguous ranges of bytes without a constant size, such as strings,
+// whose message is their contents followed by their size
+
+template<class T, class Flavor, class E = void> struct is_batch_bytes: std::false_type
+{
+};
+
+template<class T, class Flavor> struct is_batch_bytes<T, Flavor, typename std::enable_if< container_hash::is_contiguous_range<T>::value && !has_constant_size<T>::value && !has_tag_invoke<T>::value >::type>
+{
+    using E = typename std::remove_cv< typename std::remove_pointer< decltype( std::declval<T const&>().data() ) >::type >::type;
+
+    static constexpr bool value = sizeof( E ) == 1 && is_contiguously_hashable<E, Flavor::byte_order>::value;
+};
+
+// collects the bytes hash_append_size passes to update
+
+struct batch_size_sink
+{
+    unsigned char buffer[ 16 ];
+    std::size_t n = 0;
+
+    void update( void const* p, std::size_t k )
+    {
+        std::memcpy( buffer + n, p, k );
+        n += k;
+    }
+};
+
+// the generic path; the keys are hashed one at a time
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_generic( std::uint64_t seed, It first, It last, OutIt out, std::false_type )
+{
+    for( ; first != last; ++first )
+    {
+        H h( seed );
+        hash2::hash_append( h, Flavor(), *first );
+
+        *out++ = h.result();
+    }
+
+    return out;
+}
+
+// for contiguous ranges, such as strings, the elements of the key
+// hash_batch_size positions ahead are prefetched, so that the cache
+// misses of several keys overlap
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_generic( std::uint64_t seed, It first, It last, OutIt out, std::true_type )
+{
+    It ahead = first;
+
+    for( std::size_t i = 0; i < hash_batch_size && ahead != last; ++i, ++ahead )
+    {
+        detail::prefetch_range( *ahead );
+    }
+
+    for( ; first != last; ++first )
+    {
+        if( ahead != last )
+        {
+            detail::prefetch_range( *ahead );
+            ++ahead;
+        }
+
+        H h( seed );
+        hash2::hash_append( h, Flavor(), *first );
+
+        *out++ = h.result();
+    }
+
+    return out;
+}
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_generic( std::uint64_t seed, It first, It last, OutIt out )
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    return detail::hash_batch_generic<H, Flavor>( seed, first, last, out, container_hash::is_contiguous_range<T>() );
+}
+
+// H::hash_batch, for fixed size keys
+
+template<class H, class Flavor, class U, class It, class OutIt> OutIt hash_batch_member( H const& h0, It& first, It last, OutIt out )
+{
+    constexpr std::size_t N = hash_batch_size;
+
+    unsigned char buffer[ N ][ sizeof( U ) ];
+    unsigned char const* p[ N ];
+    std::size_t m[ N ];
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        p[ j ] = buffer[ j ];
+        m[ j ] = sizeof( U );
+    }
+
+    std::uint64_t r[ N ];
+
+    while( first != last )
+    {
+        std::size_t n = 0;
+
+        for( ; n < N && first != last; ++n, ++first )
+        {
+            detail::write( static_cast<U>( *first ), Flavor::byte_order, buffer[ n ] );
+        }
+
+        h0.hash_batch( p, m, n, r );
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            *out++ = r[ j ];
+        }
+    }
+
+    return out;
+}
+
+// multi_lane<H>::type, for fixed size keys; complete groups only
+
+template<class H, class Flavor, class U, class It, class OutIt> OutIt hash_batch_lanes( std::uint64_t seed, It& first, It last, OutIt out )
+{
+    constexpr std::size_t N = hash_batch_size;
+
+    using multi_type = typename detail::multi_lane<H>::template type<N>;
+
+    unsigned char buffer[ N ][ sizeof( U ) ];
+    unsigned char const* p[ N ];
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        p[ j ] = buffer[ j ];
+    }
+
+    multi_type const h0( seed );
+
+    for( ;; )
+    {
+        It it = first;
+        std::size_t n = 0;
+
+        for( ; n < N && it != last; ++n, ++it )
+        {
+            detail::write( static_cast<U>( *it ), Flavor::byte_order, buffer[ n ] );
+        }
+
+        if( n < N ) break;
+
+        multi_type h( h0 );
+        h.update( p, sizeof( U ) );
+
+        typename multi_type::result_type r = h.result();
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            *out++ = r[ j ];
+        }
+
+        first = it;
+    }
+
+    return out;
+}
+
+// multi_lane<H>::type, for contiguous ranges of bytes; groups of
+// consecutive keys of the same size, such as the fixed size chunks of
+// a file, are hashed together, and the other keys one at a time
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_bytes( std::uint64_t seed, It first, It last, OutIt out )
+{
+    constexpr std::size_t N = hash_batch_size;
+
+    using multi_type = typename detail::multi_lane<H>::template type<N>;
+
+    void const* p[ N ];
+
+    multi_type const h0( seed );
+
+    while( first != last )
+    {
+        It it = first;
+
+        std::size_t const m = ( *first ).size();
+        std::size_t n = 0;
+
+        for( ; n < N && it != last && ( *it ).size() == m; ++n, ++it )
+        {
+            p[ n ] = ( *it ).data();
+        }
+
+        if( n < N )
+        {
+            // no group of N starts in [first, it)
+
+            for( ; first != it; ++first )
+            {
+                H h( seed );
+                hash2::hash_append( h, Flavor(), *first );
+
+                *out++ = h.result();
+            }
+
+            continue;
+        }
+
+        multi_type h( h0 );
+        h.update( p, m );
+
+        batch_size_sink s;
+        hash2::hash_append_size( s, Flavor(), m );
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            p[ j ] = s.buffer;
+        }
+
+        h.update( p, s.n );
+
+        typename multi_type::result_type r = h.result();
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            *out++ = r[ j ];
+        }
+
+        first = it;
+    }
+
+    return out;
+}
+
+// the paths of hash_batch_
+
+using batch_generic = std::integral_constant<int, 0>;
+using batch_member = std::integral_constant<int, 1>;
+using batch_lanes = std::integral_constant<int, 2>;
+using batch_bytes = std::integral_constant<int, 3>;
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_( std::uint64_t seed, It first, It last, OutIt out, batch_generic )
+{
+    return detail::hash_batch_generic<H, Flavor>( seed, first, last, out );
+}
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_( std::uint64_t seed, It first, It last, OutIt out, batch_member )
+{
+    using U = typename batch_word<typename std::iterator_traits<It>::value_type>::type;
+    return detail::hash_batch_member<H, Flavor, U>( H( seed ), first, last, out );
+}
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_( std::uint64_t seed, It first, It last, OutIt out, batch_lanes )
+{
+    using U = typename batch_word<typename std::iterator_traits<It>::value_type>::type;
+
+    out = detail::hash_batch_lanes<H, Flavor, U>( seed, first, last, out );
+    return detail::hash_batch_generic<H, Flavor>( seed, first, last, out );
+}
+
+template<class H, class Flavor, class It, class OutIt> OutIt hash_batch_( std::uint64_t seed, It first, It last, OutIt out, batch_bytes )
+{
+    return detail::hash_batch_bytes<H, Flavor>( seed, first, last, out );
+}
+
+} // namespace detail
+
+// hash_batch, stores in successive positions of out the values that
+// H( seed ), after hash_append( h, Flavor(), *it ), would return from
+// result(), for each it in [first, last)
+//
+// fixed size keys, and runs of byte sequences of the same size, are
+// hashed by the multi-lane kernels of H, when it has them; other keys
+// are hashed one at a time, with the contents of contiguous keys
+// prefetched ahead
+
+template<class H, class Flavor = default_flavor, class It, class OutIt> OutIt hash_batch( It first, It last, OutIt out, std::uint64_t seed = 0 )
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    using U = typename detail::batch_word<T>::type;
+
+    constexpr bool fixed = !std::is_void<U>::value;
+    constexpr bool forward = std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value;
+
+    constexpr bool use_member = fixed && detail::has_hash_batch<H>::value && std::is_same<typename H::result_type, std::uint64_t>::value;
+    constexpr bool use_lanes = fixed && !use_member && detail::multi_lane<H>::value;
+    constexpr bool use_bytes = !fixed && forward && detail::multi_lane<H>::value && detail::is_batch_bytes<T, Flavor>::value;
+
+    using path = std::integral_constant<int, use_member? 1: use_lanes? 2: use_bytes? 3: 0>;
+
+    return detail::hash_batch_<H, Flavor>( seed, first, last, out, path() );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_BATCH_HPP_INCLUDED
@@ -0,0 +1,278 @@
+#ifndef BOOST_HASH2_HASH_COLUMN_HPP_INCLUDED
+#define BOOST_HASH2_HASH_COLUMN_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash_column, hashing the values of a column in the Arrow layout, a
+// buffer of values or of offsets into a buffer of characters, with a
+// validity bitmap, into 64 bit hash values
+
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/is_contiguously_hashable.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/has_hash_batch.hpp>
+#include <boost/assert.hpp>
+#include <type_traits>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// writes the results of H, as hash_batch produces them, as std::uint64_t
+
+class column_result_writer
+{
+private:
+
+    std::uint64_t* p_;
+
+public:
+
+    explicit column_result_writer( std::uint64_t* p ) noexcept: p_( p )
+    {
+    }
+
+    column_result_writer& operator*() noexcept
+    {
+        return *this;
+    }
+
+    column_result_writer& operator++() noexcept
+    {
+        return *this;
+    }
+
+    column_result_writer& operator++( int ) noexcept
+    {
+        return *this;
+    }
+
+    template<class R> column_result_writer& operator=( R const& r )
+    {
+        *p_++ = hash2::get_integral_result<std::uint64_t>( r );
+        return *this;
+    }
+};
+
+// a null hashes as the empty message; under a flavor with a size_type,
+// hash_append passes at least one byte for every value, so no valid
+// value, not even the 0 of a column of bytes, has the message of a null
+//
+// under a flavor without one, such as unsized_flavor, an empty string or
+// range is also the empty message, so only values of a fixed size, which
+// always pass at least one byte, may be hashed
+
+template<class Flavor, class T> struct column_distinguishes_nulls: std::integral_constant<bool,
+    !std::is_void<typename Flavor::size_type>::value ||
+    std::is_arithmetic<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value ||
+    is_contiguously_hashable<T, Flavor::byte_order>::value>
+{
+};
+
+template<class H, class Flavor> std::uint64_t column_null_value( std::uint64_t seed )
+{
+    H h( seed );
+    return hash2::get_integral_result<std::uint64_t>( h.result() );
+}
+
+inline bool column_is_valid( unsigned char const* validity, std::size_t i ) noexcept
+{
+    return validity == nullptr || ( validity[ i / 8 ] >> ( i % 8 ) & 1 ) != 0;
+}
+
+// stores the null value in the positions of out whose bits in validity
+// are clear; the bytes of the bitmap with all bits set are skipped
+
+inline void column_store_nulls( unsigned char const* validity, std::size_t n, std::uint64_t null_value, std::uint64_t* out ) noexcept
+{
+    if( validity == nullptr ) return;
+
+    for( std::size_t i = 0; i < n; i += 8 )
+    {
+        unsigned b = validity[ i / 8 ];
+
+        if( b == 0xFF ) continue;
+
+        std::size_t const m = n - i < 8? n - i: 8;
+
+        for( std::size_t j = 0; j < m; ++j )
+        {
+            if( ( b >> j & 1 ) == 0 )
+            {
+                out[ i + j ] = null_value;
+            }
+        }
+    }
+}
+
+// the message of a string is its characters followed by its size, as
+// hash_append of std::string
+
+template<class H, class Flavor> std::uint64_t column_hash_string( std::uint64_t seed, char const* p, std::size_t n )
+{
+    H h( seed );
+
+    h.update( p, n );
+    hash2::hash_append_size( h, Flavor(), n );
+
+    return hash2::get_integral_result<std::uint64_t>( h.result() );
+}
+
+// one string at a time
+
+template<class H, class Flavor, class O> void hash_string_column( O const* offsets, char const* data, unsigned char const* validity, std::size_t n, std::uint64_t* out, std::uint64_t seed, std::false_type )
+{
+    std::uint64_t const null_value = detail::column_null_value<H, Flavor>( seed );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( detail::column_is_valid( validity, i ) )
+        {
+            std::size_t const first = static_cast<std::size_t>( offsets[ i ] );
+            std::size_t const last = static_cast<std::size_t>( offsets[ i + 1 ] );
+
+            BOOST_ASSERT( first <= last );
+
+            out[ i ] = detail::column_hash_string<H, Flavor>( seed, data + first, last - first );
+        }
+        else
+        {
+            out[ i ] = null_value;
+        }
+    }
+}
+
+// H::hash_batch, hash_batch_size strings at a time; the messages of the
+// valid strings of each group are assembled in a buffer, and passed
+// together
+
+template<class H, class Flavor, class O> void hash_string_column( O const* offsets, char const* data, unsigned char const* validity, std::size_t n, std::uint64_t* out, std::uint64_t seed, std::true_type )
+{
+    constexpr std::size_t N = hash_batch_size;
+
+    H const h0( seed );
+
+    std::uint64_t const null_value = detail::column_null_value<H, Flavor>( seed );
+
+    std::vector<unsigned char> buffer;
+
+    unsigned char const* p[ N ];
+    std::size_t m[ N ];
+    std::size_t index[ N ];
+    std::uint64_t r[ N ];
+
+    for( std::size_t i = 0; i < n; i += N )
+    {
+        std::size_t const k = n - i < N? n - i: N;
+
+        std::size_t const first = static_cast<std::size_t>( offsets[ i ] );
+        std::size_t const last = static_cast<std::size_t>( offsets[ i + k ] );
+
+        BOOST_ASSERT( first <= last );
+
+        buffer.resize( last - first + k * 16 );
+
+        std::size_t t = 0; // the valid strings of the group
+        std::size_t q = 0; // the bytes of their messages
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            if( !detail::column_is_valid( validity, i + j ) )
+            {
+                out[ i + j ] = null_value;
+                continue;
+            }
+
+            std::size_t const s1 = static_cast<std::size_t>( offsets[ i + j ] );
+            std::size_t const s2 = static_cast<std::size_t>( offsets[ i + j + 1 ] );
+
+            BOOST_ASSERT( s1 <= s2 );
+
+            std::size_t const s = s2 - s1;
+
+            if( s != 0 )
+            {
+                std::memcpy( buffer.data() + q, data + s1, s );
+            }
+
+            batch_size_sink sink;
+            hash2::hash_append_size( sink, Flavor(), s );
+
+            std::memcpy( buffer.data() + q + s, sink.buffer, sink.n );
+
+            m[ t ] = s + sink.n;
+            index[ t ] = i + j;
+
+            q += m[ t ];
+            ++t;
+        }
+
+        // the buffer doesn't move while it's being filled
+
+        for( std::size_t j = 0, q2 = 0; j < t; ++j )
+        {
+            p[ j ] = buffer.data() + q2;
+            q2 += m[ j ];
+        }
+
+        h0.hash_batch( p, m, t, r );
+
+        for( std::size_t j = 0; j < t; ++j )
+        {
+            out[ index[ j ] ] = r[ j ];
+        }
+    }
+}
+
+} // namespace detail
+
+// hash_column, stores in out[ i ], for i in [0, n), the value that H( seed ),
+// after hash_append( h, Flavor(), values[ i ] ), would return from result(),
+// converted with get_integral_result<std::uint64_t>; or, when bit i of
+// validity is clear, the value of H( seed ) with no input
+//
+// bit i of the validity bitmap is bit i % 8 of byte i / 8; a null bitmap
+// means that all values are valid
+
+template<class H, class Flavor = default_flavor, class T> void hash_column( T const* values, unsigned char const* validity, std::size_t n, std::uint64_t* out, std::uint64_t seed = 0 )
+{
+    static_assert( detail::column_distinguishes_nulls<Flavor, T>::value, "Under a Flavor without a size_type, an empty value can't be distinguished from a null" );
+
+    hash2::hash_batch<H, Flavor>( values, values + n, detail::column_result_writer( out ), seed );
+
+    if( validity != nullptr )
+    {
+        detail::column_store_nulls( validity, n, detail::column_null_value<H, Flavor>( seed ), out );
+    }
+}
+
+// the same, for a column of strings; value i is the characters from
+// data + offsets[ i ] to data + offsets[ i + 1 ], hashed as std::string;
+// Flavor must have a size_type
+
+template<class H, class Flavor = default_flavor, class O>
+    typename std::enable_if< std::is_integral<O>::value, void >::type
+    hash_column( O const* offsets, char const* data, unsigned char const* validity, std::size_t n, std::uint64_t* out, std::uint64_t seed = 0 )
+{
+    static_assert( !std::is_void<typename Flavor::size_type>::value, "Under a Flavor without a size_type, an empty string can't be distinguished from a null" );
+
+    constexpr bool use_member = detail::has_hash_batch<H>::value && std::is_same<typename H::result_type, std::uint64_t>::value;
+    detail::hash_string_column<H, Flavor>( offsets, data, validity, n, out, seed, std::integral_constant<bool, use_member>() );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_COLUMN_HPP_INCLUDED
@@ -0,0 +1,414 @@
+#ifndef BOOST_HASH2_HASH_DIRECTORY_HPP_INCLUDED
+#define BOOST_HASH2_HASH_DIRECTORY_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_file.hpp>
+#include <boost/hash2/digest_cache.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <cerrno>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+# include <dirent.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+struct directory_entry
+{
+    // relative to the root, with '/' as the separator
+    std::string path;
+
+    std::uint32_t mode;
+    std::uint64_t size;
+
+    // for looking up the digest of a regular file in a digest_cache
+    file_identity id;
+
+    // the target, for symbolic links
+    std::string link;
+};
+
+class directory_handle
+{
+private:
+
+    DIR* d_;
+
+public:
+
+    explicit directory_handle( DIR* d ) noexcept: d_( d )
+    {
+    }
+
+    directory_handle( directory_handle const& ) = delete;
+    directory_handle& operator=( directory_handle const& ) = delete;
+
+    ~directory_handle()
+    {
+        if( d_ ) ::closedir( d_ );
+    }
+
+    DIR* get() const noexcept
+    {
+        return d_;
+    }
+};
+
+// appends the entries under root, at any depth, to v; symbolic links
+// aren't followed
+
+inline void walk_directory( std::string const& root, std::vector<directory_entry>& v, std::error_code& ec )
+{
+    // the relative paths of the directories still to be read
+
+    std::vector<std::string> stack( 1 );
+
+    while( !stack.empty() )
+    {
+        std::string dir = std::move( stack.back() );
+        stack.pop_back();
+
+        std::string const full = dir.empty()? root: root + '/' + dir;
+
+        directory_handle d( ::opendir( full.c_str() ) );
+
+        if( d.get() == 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        int const fd = ::dirfd( d.get() );
+
+        for( ;; )
+        {
+            errno = 0;
+            ::dirent* e = ::readdir( d.get() );
+
+            if( e == 0 )
+            {
+                if( errno != 0 )
+                {
+                    ec.assign( errno, std::system_category() );
+                    return;
+                }
+
+                break;
+            }
+
+            char const* name = e->d_name;
+
+            if( name[ 0 ] == '.' && ( name[ 1 ] == 0 || ( name[ 1 ] == '.' && name[ 2 ] == 0 ) ) ) continue;
+
+            // relative to the open directory, which saves the path lookup
+
+            struct ::stat st;
+
+            if( ::fstatat( fd, name, &st, AT_SYMLINK_NOFOLLOW ) != 0 )
+            {
+                ec.assign( errno, std::system_category() );
+                return;
+            }
+
+            directory_entry x;
+
+            x.path = dir.empty()? std::string( name ): dir + '/' + name;
+            x.mode = static_cast<std::uint32_t>( st.st_mode );
+            x.size = S_ISREG( st.st_mode )? static_cast<std::uint64_t>( st.st_size ): 0;
+            x.id = detail::file_identity_of( st );
+
+            if( S_ISLNK( st.st_mode ) )
+            {
+                char buffer[ 4096 ];
+                ::ssize_t r = ::readlinkat( fd, name, buffer, sizeof( buffer ) );
+
+                if( r < 0 )
+                {
+                    ec.assign( errno, std::system_category() );
+                    return;
+                }
+
+                x.link.assign( buffer, static_cast<std::size_t>( r ) );
+            }
+            else if( S_ISDIR( st.st_mode ) )
+            {
+                stack.push_back( x.path );
+            }
+
+            v.push_back( std::move( x ) );
+        }
+    }
+}
+
+// small files are read with a single read(2) into a buffer that is
+// reused across them, skipping the fstat and fadvise of hash_file
+
+std::uint64_t const small_file_size = 64 * 1024;
+
+template<class H> void hash_small_file( H& h, char const* path, std::uint64_t size, std::vector<unsigned char>& buffer, std::error_code& ec )
+{
+    file_descriptor fd( file_open( path, 0 ) );
+
+    if( fd.get() < 0 )
+    {
+        ec.assign( errno, std::system_category() );
+        return;
+    }
+
+    // one more byte, so that a file that hasn't grown is read in one call
+
+    std::size_t const n = static_cast<std::size_t>( size ) + 1;
+
+    if( buffer.size() < n )
+    {
+        buffer.resize( n );
+    }
+
+    for( ;; )
+    {
+        std::ptrdiff_t r = file_read( fd.get(), buffer.data(), n );
+
+        if( r < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        h.update( buffer.data(), static_cast<std::size_t>( r ) );
+
+        if( static_cast<std::size_t>( r ) < n ) break;
+    }
+}
+
+#endif
+
+template<class H> void hash_directory_( H& h, char const* path, std::error_code& ec, task_executor& ex, digest_cache* cache )
+{
+    ec.clear();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+    std::string const root( path );
+
+    std::vector<detail::directory_entry> v;
+
+    detail::walk_directory( root, v, ec );
+
+    if( ec ) return;
+
+    std::sort( v.begin(), v.end(), []( detail::directory_entry const& a, detail::directory_entry const& b ){ return a.path < b.path; } );
+
+    std::size_t const n = v.size();
+
+    // consecutive small files are claimed in batches of up to this many
+    // bytes, so that the workers don't contend on every file
+
+    std::uint64_t const batch_bytes = 1024 * 1024;
+    std::size_t const batch_files = 64;
+
+    std::vector<std::size_t> batches;
+
+    {
+        std::uint64_t m = batch_bytes;
+        std::size_t k = batch_files;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            if( !S_ISREG( v[ i ].mode ) ) continue;
+
+            if( m + v[ i ].size > batch_bytes || k == batch_files )
+            {
+                batches.push_back( i );
+
+                m = 0;
+                k = 0;
+            }
+
+            m += v[ i ].size;
+            ++k;
+        }
+
+        batches.push_back( n );
+    }
+
+    std::size_t const nb = batches.size() - 1;
+
+    std::vector<typename H::result_type> digests( n );
+    std::vector<std::error_code> errors( n );
+
+    auto hash_batch = [&]( std::size_t j, std::vector<unsigned char>& buffer ){
+
+        for( std::size_t i = batches[ j ]; i < batches[ j + 1 ]; ++i )
+        {
+            if( !S_ISREG( v[ i ].mode ) ) continue;
+
+            if( cache && cache->find<H>( v[ i ].id, digests[ i ] ) ) continue;
+
+            std::string const full = root + '/' + v[ i ].path;
+
+            H h2;
+
+            if( v[ i ].size < detail::small_file_size )
+            {
+                detail::hash_small_file( h2, full.c_str(), v[ i ].size, buffer, errors[ i ] );
+            }
+            else
+            {
+                hash_file( h2, full.c_str(), errors[ i ] );
+            }
+
+            digests[ i ] = h2.result();
+
+            if( cache && !errors[ i ] )
+            {
+                // a file that changed while it was being hashed isn't stored
+
+                file_identity id;
+                std::error_code ec2;
+
+                if( detail::file_identity_of( full.c_str(), id, ec2 ) && id == v[ i ].id )
+                {
+                    cache->insert<H>( id, digests[ i ] );
+                }
+            }
+        }
+    };
+
+    // the batches are claimed through next, so that tasks that start
+    // late, or not at all, don't hold up the others
+
+    std::atomic<std::size_t> next( 0 );
+
+    std::size_t const parts = detail::parallel_parts( ex, nb, 1 );
+
+    hash2::bulk_execute( ex, parts, [&]( std::size_t ){
+
+        std::vector<unsigned char> buffer;
+
+        for( ;; )
+        {
+            std::size_t j = next.fetch_add( 1, std::memory_order_relaxed );
+            if( j >= nb ) break;
+
+            hash_batch( j, buffer );
+        }
+    });
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( errors[ i ] )
+        {
+            ec = errors[ i ];
+            return;
+        }
+
+        hash_append( h, default_flavor(), v[ i ].path );
+        hash_append( h, default_flavor(), v[ i ].mode );
+
+        if( S_ISREG( v[ i ].mode ) )
+        {
+            hash_append( h, default_flavor(), digests[ i ] );
+        }
+        else if( S_ISLNK( v[ i ].mode ) )
+        {
+            hash_append( h, default_flavor(), v[ i ].link );
+        }
+    }
+
+#else
+
+    (void)h;
+    (void)path;
+    (void)ex;
+    (void)cache;
+
+    ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+}
+
+} // namespace detail
+
+// hashes the tree under the directory path into h: the entries under it,
+// at any depth, are visited in the order of their relative paths, and for
+// each one, the relative path, with '/' as the separator, and st_mode are
+// passed to hash_append, followed by the digest H() computes for the
+// contents of a regular file, or the target of a symbolic link
+//
+// the regular files are hashed on ex. Symbolic links aren't followed. On
+// error, sets ec, and the state of h is unspecified
+
+template<class H> void hash_directory( H& h, char const* path, std::error_code& ec, task_executor& ex )
+{
+    detail::hash_directory_( h, path, ec, ex, 0 );
+}
+
+// same, but the digests of the files that haven't changed since they were
+// stored in cache are taken from it, and those of the others are stored
+
+template<class H> void hash_directory( H& h, char const* path, std::error_code& ec, task_executor& ex, digest_cache& cache )
+{
+    detail::hash_directory_( h, path, ec, ex, &cache );
+}
+
+// same, but the regular files are hashed on up to threads threads;
+// threads == 0 means std::thread::hardware_concurrency()
+
+template<class H> void hash_directory( H& h, char const* path, std::error_code& ec, unsigned threads = 0 )
+{
+    thread_executor ex( threads );
+    hash_directory( h, path, ec, ex );
+}
+
+// returns the digest of the tree under path, or a value-initialized result
+// on error
+
+template<class H> typename H::result_type hash_directory( char const* path, std::error_code& ec, task_executor& ex )
+{
+    H h;
+    hash_directory( h, path, ec, ex );
+
+    if( ec ) return typename H::result_type();
+    return h.result();
+}
+
+template<class H> typename H::result_type hash_directory( char const* path, std::error_code& ec, unsigned threads = 0 )
+{
+    thread_executor ex( threads );
+    return hash_directory<H>( path, ec, ex );
+}
+
+template<class H> typename H::result_type hash_directory( char const* path, std::error_code& ec, task_executor& ex, digest_cache& cache )
+{
+    H h;
+    hash_directory( h, path, ec, ex, cache );
+
+    if( ec ) return typename H::result_type();
+    return h.result();
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_DIRECTORY_HPP_INCLUDED
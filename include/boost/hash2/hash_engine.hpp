@@ -0,0 +1,205 @@
+#ifndef BOOST_HASH2_HASH_ENGINE_HPP_INCLUDED
+#define BOOST_HASH2_HASH_ENGINE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash_engine<H>, a UniformRandomBitGenerator producing the
+// sequence of values returned by repeated calls to H::result()
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// integral results are returned as is, array-like ones as 64 bit words
+
+template<class R, bool I = std::is_integral<R>::value> struct hash_engine_result
+{
+    static_assert( std::is_unsigned<R>::value && sizeof( R ) <= 8, "Integral result type must be unsigned and at most 64 bits" );
+
+    using type = R;
+
+    static constexpr std::size_t words = 1;
+
+    BOOST_CXX14_CONSTEXPR static type get( R const& r, std::size_t /*i*/ )
+    {
+        return r;
+    }
+};
+
+template<class R> struct hash_engine_result<R, false>
+{
+    static_assert( R().size() >= 8, "Array-like result type is too short" );
+
+    using type = std::uint64_t;
+
+    static constexpr std::size_t words = R().size() / 8;
+
+    BOOST_CXX14_CONSTEXPR static type get( R const& r, std::size_t i )
+    {
+        return detail::read64le( r.data() + i * 8 );
+    }
+};
+
+} // namespace detail
+
+template<class H> class hash_engine
+{
+private:
+
+    using traits = detail::hash_engine_result<typename H::result_type>;
+
+public:
+
+    using result_type = typename traits::type;
+
+    // the number of values generated at a time from array-like results;
+    // integral results are returned directly, as buffering them is slower
+
+    static constexpr std::size_t buffer_size = traits::words == 1? 1: 8;
+
+private:
+
+    H h_;
+
+    result_type buffer_[ buffer_size ] = {};
+    std::size_t i_ = buffer_size;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void fill()
+    {
+        // a result that doesn't fit in the buffer is discarded
+        // in part, so that the sequence doesn't depend on when
+        // the values are consumed
+
+        std::size_t i = 0;
+
+        while( i < buffer_size )
+        {
+            typename H::result_type const r = h_.result();
+
+            for( std::size_t j = 0; j < traits::words && i < buffer_size; ++j )
+            {
+                buffer_[ i++ ] = traits::get( r, j );
+            }
+        }
+
+        i_ = 0;
+    }
+
+public:
+
+    hash_engine() = default;
+
+    explicit BOOST_CXX14_CONSTEXPR hash_engine( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR hash_engine( unsigned char const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    // continues from the state of h, which may already have absorbed input
+
+    explicit BOOST_CXX14_CONSTEXPR hash_engine( H const& h ): h_( h )
+    {
+    }
+
+    // UniformRandomBitGenerator
+
+    static constexpr result_type min() noexcept
+    {
+        return 0;
+    }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type operator()()
+    {
+        if( traits::words == 1 )
+        {
+            return traits::get( h_.result(), 0 );
+        }
+
+        if( i_ == buffer_size )
+        {
+            fill();
+        }
+
+        return buffer_[ i_++ ];
+    }
+
+    // advances the sequence by z values
+
+    BOOST_CXX14_CONSTEXPR void discard( unsigned long long z )
+    {
+        while( z > 0 )
+        {
+            if( i_ == buffer_size )
+            {
+                fill();
+            }
+
+            std::size_t k = buffer_size - i_;
+
+            if( z < k )
+            {
+                k = static_cast<std::size_t>( z );
+            }
+
+            i_ += k;
+            z -= k;
+        }
+    }
+
+    // writes the next n values to p
+
+    BOOST_CXX14_CONSTEXPR void generate( result_type* p, std::size_t n )
+    {
+        while( n > 0 )
+        {
+            if( i_ == buffer_size )
+            {
+                fill();
+            }
+
+            std::size_t k = buffer_size - i_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            for( std::size_t i = 0; i < k; ++i )
+            {
+                p[ i ] = buffer_[ i_ + i ];
+            }
+
+            i_ += k;
+
+            p += k;
+            n -= k;
+        }
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_ENGINE_HPP_INCLUDED
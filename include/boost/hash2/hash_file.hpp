@@ -0,0 +1,789 @@
+#ifndef BOOST_HASH2_HASH_FILE_HPP_INCLUDED
+#define BOOST_HASH2_HASH_FILE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/io_uring.hpp>
+#include <boost/hash2/detail/af_alg.hpp>
+#include <boost/hash2/detail/update_zeros.hpp>
+#include <boost/config.hpp>
+#include <memory>
+#include <system_error>
+#include <cerrno>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__unix__) || defined(__APPLE__)
+# define BOOST_HASH2_HAS_POSIX_FILES
+# include <sys/types.h>
+# include <sys/stat.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <unistd.h>
+#else
+# include <cstdio>
+#endif
+
+// files smaller than this are read with read(2); for them, setting up
+// the mapping costs more than the copy
+
+#if !defined(BOOST_HASH2_HASH_FILE_MMAP_THRESHOLD)
+# define BOOST_HASH2_HASH_FILE_MMAP_THRESHOLD (64 * 1024)
+#endif
+
+// files of at least this size are read with O_DIRECT, so that hashing
+// them doesn't evict the page cache
+
+#if !defined(BOOST_HASH2_HASH_FILE_DIRECT_THRESHOLD)
+# define BOOST_HASH2_HASH_FILE_DIRECT_THRESHOLD (std::uint64_t( 1 ) << 30)
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+enum class file_backend
+{
+    automatic,
+    read,
+    mmap,
+    direct,
+    uring,
+    af_alg
+};
+
+namespace detail
+{
+
+// a buffer aligned to align bytes, as O_DIRECT requires
+
+class file_buffer
+{
+private:
+
+    std::unique_ptr<unsigned char[]> p_;
+    unsigned char* q_;
+
+public:
+
+    file_buffer( std::size_t n, std::size_t align ): p_( new unsigned char[ n + align ] )
+    {
+        std::size_t const k = reinterpret_cast<std::uintptr_t>( p_.get() ) % align;
+        q_ = p_.get() + ( k == 0? 0: align - k );
+    }
+
+    unsigned char* data() const noexcept
+    {
+        return q_;
+    }
+
+    // gives up the memory, for when the kernel may still write to it
+
+    void leak() noexcept
+    {
+        p_.release();
+    }
+};
+
+std::size_t const file_block_size = 1024 * 1024;
+std::size_t const file_direct_block_size = 4 * 1024 * 1024;
+std::size_t const file_direct_align = 4096;
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+class file_descriptor
+{
+private:
+
+    int fd_;
+
+public:
+
+    explicit file_descriptor( int fd ) noexcept: fd_( fd )
+    {
+    }
+
+    file_descriptor( file_descriptor const& ) = delete;
+    file_descriptor& operator=( file_descriptor const& ) = delete;
+
+    ~file_descriptor()
+    {
+        if( fd_ >= 0 ) ::close( fd_ );
+    }
+
+    int get() const noexcept
+    {
+        return fd_;
+    }
+
+    int release() noexcept
+    {
+        int fd = fd_;
+        fd_ = -1;
+
+        return fd;
+    }
+};
+
+inline int file_open( char const* path, int flags ) noexcept
+{
+    int fd;
+
+    do
+    {
+        fd = ::open( path, flags | O_RDONLY | O_CLOEXEC );
+    }
+    while( fd < 0 && errno == EINTR );
+
+    return fd;
+}
+
+// reads up to n bytes; returns the number read, which is less than n only
+// at the end of the file, or -1 on error
+
+inline std::ptrdiff_t file_read( int fd, unsigned char* p, std::size_t n ) noexcept
+{
+    std::size_t m = 0;
+
+    while( m < n )
+    {
+        ::ssize_t r = ::read( fd, p + m, n - m );
+
+        if( r < 0 )
+        {
+            if( errno == EINTR ) continue;
+            return -1;
+        }
+
+        if( r == 0 ) break;
+
+        m += static_cast<std::size_t>( r );
+    }
+
+    return static_cast<std::ptrdiff_t>( m );
+}
+
+// reads up to n bytes at offset; returns the number read, which is less
+// than n only at the end of the file, or -1 on error
+
+inline std::ptrdiff_t file_pread( int fd, unsigned char* p, std::size_t n, std::uint64_t offset ) noexcept
+{
+    std::size_t m = 0;
+
+    while( m < n )
+    {
+        ::ssize_t r = ::pread( fd, p + m, n - m, static_cast< ::off_t >( offset + m ) );
+
+        if( r < 0 )
+        {
+            if( errno == EINTR ) continue;
+            return -1;
+        }
+
+        if( r == 0 ) break;
+
+        m += static_cast<std::size_t>( r );
+    }
+
+    return static_cast<std::ptrdiff_t>( m );
+}
+
+template<class H> void hash_fd_read( H& h, int fd, std::uint64_t size, std::error_code& ec )
+{
+#if defined(POSIX_FADV_SEQUENTIAL)
+
+    ::posix_fadvise( fd, 0, 0, POSIX_FADV_SEQUENTIAL );
+
+#endif
+
+    // a file that fits is read with a single call
+
+    std::size_t const n = size != 0 && size < file_block_size? static_cast<std::size_t>( size ) + 1: file_block_size;
+
+    std::unique_ptr<unsigned char[]> buffer( new unsigned char[ n ] );
+
+    for( ;; )
+    {
+        std::ptrdiff_t r = file_read( fd, buffer.get(), n );
+
+        if( r < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        h.update( buffer.get(), static_cast<std::size_t>( r ) );
+
+        if( static_cast<std::size_t>( r ) < n ) break;
+    }
+}
+
+#if defined(SEEK_HOLE) && defined(SEEK_DATA)
+
+// a regular file with fewer blocks allocated than its size has holes
+
+inline bool file_is_sparse( struct ::stat const& st ) noexcept
+{
+    return S_ISREG( st.st_mode ) && static_cast<std::uint64_t>( st.st_blocks ) * 512 < static_cast<std::uint64_t>( st.st_size );
+}
+
+// reads the data regions of the first size bytes of the file, found with
+// SEEK_DATA and SEEK_HOLE, and passes the holes between them to h as runs
+// of zeros, with update_zeros when H has it
+//
+// returns false, without hashing anything, if the file system doesn't
+// support SEEK_DATA
+
+template<class H> bool hash_fd_sparse( H& h, int fd, std::uint64_t size, std::error_code& ec )
+{
+    std::unique_ptr<unsigned char[]> buffer;
+
+    std::uint64_t pos = 0;
+
+    while( pos < size )
+    {
+        ::off_t d = ::lseek( fd, static_cast< ::off_t >( pos ), SEEK_DATA );
+
+        std::uint64_t first = size;
+
+        if( d >= 0 )
+        {
+            if( static_cast<std::uint64_t>( d ) < size ) first = static_cast<std::uint64_t>( d );
+        }
+        else if( errno == EINVAL && pos == 0 )
+        {
+            return false;
+        }
+        else if( errno != ENXIO )
+        {
+            // ENXIO means that there is no data after pos
+
+            ec.assign( errno, std::system_category() );
+            return true;
+        }
+
+        detail::update_zeros( h, first - pos );
+
+        if( first == size ) break;
+
+        ::off_t e = ::lseek( fd, static_cast< ::off_t >( first ), SEEK_HOLE );
+
+        if( e < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return true;
+        }
+
+        std::uint64_t const last = static_cast<std::uint64_t>( e ) < size? static_cast<std::uint64_t>( e ): size;
+
+        if( !buffer ) buffer.reset( new unsigned char[ file_block_size ] );
+
+        for( pos = first; pos < last; )
+        {
+            std::size_t const m = last - pos < file_block_size? static_cast<std::size_t>( last - pos ): file_block_size;
+
+            std::ptrdiff_t r = file_pread( fd, buffer.get(), m, pos );
+
+            if( r < 0 )
+            {
+                ec.assign( errno, std::system_category() );
+                return true;
+            }
+
+            h.update( buffer.get(), static_cast<std::size_t>( r ) );
+            pos += static_cast<std::size_t>( r );
+
+            // the file has been truncated
+
+            if( static_cast<std::size_t>( r ) < m ) return true;
+        }
+    }
+
+    return true;
+}
+
+#endif
+
+// returns false, without hashing anything, if the file can't be mapped
+
+template<class H> bool hash_fd_mmap( H& h, int fd, std::uint64_t size )
+{
+    if( size == 0 || size > static_cast<std::size_t>( -1 ) / 4 )
+    {
+        return false;
+    }
+
+    std::size_t const n = static_cast<std::size_t>( size );
+
+    void* p = ::mmap( 0, n, PROT_READ, MAP_PRIVATE, fd, 0 );
+
+    if( p == MAP_FAILED )
+    {
+        return false;
+    }
+
+    ::madvise( p, n, MADV_SEQUENTIAL );
+
+    h.update( p, n );
+
+    ::munmap( p, n );
+
+    return true;
+}
+
+// returns false, without hashing anything, if the file system doesn't
+// support O_DIRECT
+
+template<class H> bool hash_file_direct( H& h, char const* path, std::error_code& ec )
+{
+#if defined(O_DIRECT)
+
+    file_descriptor fd( file_open( path, O_DIRECT ) );
+
+    if( fd.get() < 0 )
+    {
+        if( errno == EINVAL ) return false;
+
+        ec.assign( errno, std::system_category() );
+        return true;
+    }
+
+    file_buffer buffer( file_direct_block_size, file_direct_align );
+
+    for( bool first = true; ; first = false )
+    {
+        std::ptrdiff_t r = file_read( fd.get(), buffer.data(), file_direct_block_size );
+
+        if( r < 0 )
+        {
+            if( first && errno == EINVAL ) return false;
+
+            ec.assign( errno, std::system_category() );
+            return true;
+        }
+
+        h.update( buffer.data(), static_cast<std::size_t>( r ) );
+
+        if( static_cast<std::size_t>( r ) < file_direct_block_size ) break;
+    }
+
+    return true;
+
+#else
+
+    (void)h;
+    (void)path;
+    (void)ec;
+
+    return false;
+
+#endif
+}
+
+#if defined(BOOST_HASH2_HAS_IO_URING)
+
+std::size_t const file_uring_depth = 4;
+
+// reads the first size bytes of the file in blocks of file_block_size,
+// keeping file_uring_depth reads in flight, with a single system call per
+// batch of submissions; block k is read into buffer k % file_uring_depth,
+// and is hashed once it and the blocks before it have completed, while
+// the later ones are being read
+//
+// returns false, without hashing anything, if io_uring isn't available
+
+template<class H> bool hash_fd_uring( H& h, int fd, std::uint64_t size, std::error_code& ec )
+{
+    std::size_t const Q = file_uring_depth;
+    std::size_t const B = file_block_size;
+
+    io_uring_queue q( Q );
+
+    if( !q.valid() ) return false;
+
+    file_buffer buffer( Q * B, file_direct_align );
+
+    iovec v[ Q ];
+
+    for( std::size_t i = 0; i < Q; ++i )
+    {
+        v[ i ].iov_base = buffer.data() + i * B;
+        v[ i ].iov_len = B;
+    }
+
+    // registered buffers are mapped once, instead of on every read
+
+    bool const fixed = q.register_buffers( v, Q );
+
+    std::uint64_t blocks = ( size + B - 1 ) / B;
+
+    std::size_t length[ Q ] = {};
+    std::size_t filled[ Q ] = {};
+
+    std::size_t inflight = 0;
+
+    auto read = [&]( std::uint64_t k ){
+
+        std::size_t const i = static_cast<std::size_t>( k % Q );
+        std::size_t const m = filled[ i ];
+
+        q.prepare_read( fd, buffer.data() + i * B + m, static_cast<unsigned>( length[ i ] - m ), k * B + m, fixed? static_cast<int>( i ): -1, k );
+        ++inflight;
+    };
+
+    auto start = [&]( std::uint64_t k ){
+
+        std::size_t const i = static_cast<std::size_t>( k % Q );
+
+        length[ i ] = size - k * B < B? static_cast<std::size_t>( size - k * B ): B;
+        filled[ i ] = 0;
+
+        read( k );
+    };
+
+    std::uint64_t next = 0; // the next block to read
+    std::uint64_t cur = 0; // the next block to hash
+
+    for( ; next < blocks && next < Q; ++next )
+    {
+        start( next );
+    }
+
+    int err = 0;
+
+    while( inflight > 0 )
+    {
+        if( err != 0 || cur >= blocks || filled[ cur % Q ] < length[ cur % Q ] )
+        {
+            int r = q.submit( 1 );
+
+            if( r < 0 )
+            {
+                // the reads in flight may still complete into the buffer
+                buffer.leak();
+
+                ec.assign( -r, std::system_category() );
+                return true;
+            }
+        }
+
+        std::uint64_t k;
+        int res;
+
+        while( q.pop( k, res ) )
+        {
+            --inflight;
+
+            if( err != 0 ) continue;
+
+            std::size_t const i = static_cast<std::size_t>( k % Q );
+
+            if( res == -EINTR || res == -EAGAIN )
+            {
+                read( k );
+            }
+            else if( res < 0 )
+            {
+                err = -res;
+            }
+            else if( res == 0 )
+            {
+                // the file has been truncated
+
+                length[ i ] = filled[ i ];
+
+                if( blocks > k + 1 ) blocks = k + 1;
+            }
+            else
+            {
+                filled[ i ] += static_cast<std::size_t>( res );
+
+                if( filled[ i ] < length[ i ] ) read( k );
+            }
+        }
+
+        // hash the completed blocks in order, and reuse their buffers
+
+        while( err == 0 && cur < blocks && filled[ cur % Q ] == length[ cur % Q ] )
+        {
+            std::size_t const i = static_cast<std::size_t>( cur % Q );
+
+            h.update( buffer.data() + i * B, length[ i ] );
+            ++cur;
+
+            if( next < blocks )
+            {
+                start( next++ );
+            }
+        }
+    }
+
+    if( err != 0 )
+    {
+        ec.assign( err, std::system_category() );
+    }
+
+    return true;
+}
+
+#endif
+
+#else
+
+template<class H> void hash_file_stdio( H& h, char const* path, std::error_code& ec )
+{
+#if defined(_MSC_VER)
+# pragma warning(push)
+# pragma warning(disable: 4996) // fopen is deprecated
+#endif
+
+    std::FILE* f = std::fopen( path, "rb" );
+
+#if defined(_MSC_VER)
+# pragma warning(pop)
+#endif
+
+    if( f == 0 )
+    {
+        ec.assign( errno, std::generic_category() );
+        return;
+    }
+
+    std::unique_ptr<unsigned char[]> buffer( new unsigned char[ file_block_size ] );
+
+    for( ;; )
+    {
+        std::size_t r = std::fread( buffer.get(), 1, file_block_size, f );
+
+        if( std::ferror( f ) )
+        {
+            ec.assign( errno != 0? errno: EIO, std::generic_category() );
+            break;
+        }
+
+        h.update( buffer.get(), r );
+
+        if( r < file_block_size ) break;
+    }
+
+    std::fclose( f );
+}
+
+#endif
+
+// the digest of the file path, computed by the kernel; returns false,
+// without setting ec, if the kernel can't compute it, or the result type
+// isn't a digest
+
+template<class R> bool hash_file_af_alg( char const* /*path*/, char const* /*name*/, R& /*r*/, std::error_code& /*ec*/ )
+{
+    return false;
+}
+
+template<std::size_t N> bool hash_file_af_alg( char const* path, char const* name, digest<N>& r, std::error_code& ec )
+{
+#if defined(BOOST_HASH2_HAS_AF_ALG)
+
+    if( name == 0 ) return false;
+
+    file_descriptor fd( file_open( path, 0 ) );
+
+    if( fd.get() < 0 )
+    {
+        ec.assign( errno, std::system_category() );
+        return true;
+    }
+
+    struct ::stat st;
+
+    if( ::fstat( fd.get(), &st ) != 0 )
+    {
+        ec.assign( errno, std::system_category() );
+        return true;
+    }
+
+    if( !S_ISREG( st.st_mode ) ) return false;
+
+    return detail::hash_fd_af_alg( fd.get(), static_cast<std::uint64_t>( st.st_size ), name, r.data(), N, ec );
+
+#else
+
+    (void)path;
+    (void)name;
+    (void)r;
+    (void)ec;
+
+    return false;
+
+#endif
+}
+
+} // namespace detail
+
+// hashes the contents of the file path into h; on error, sets ec, and the
+// state of h is unspecified
+//
+// automatic selects read(2) for small files and files that aren't regular,
+// mmap for the rest, and O_DIRECT for very large files; a backend that isn't
+// supported by the platform or the file system falls back to read(2).
+// For sparse files, automatic reads only the data regions, and passes the
+// holes to h as runs of zeros, in O(log n) for the checksums that have
+// update_zeros, and from a shared page of zeros for the other algorithms
+//
+// uring reads a regular file through io_uring, several blocks at a time,
+// and is never selected automatically, since for a single file it does
+// about what mmap with MADV_SEQUENTIAL does; it pays off when many files
+// are hashed concurrently
+//
+// af_alg only applies to the overload below; the state of h can't be
+// passed to the kernel, so here it's the same as automatic
+
+template<class H> void hash_file( H& h, char const* path, std::error_code& ec, file_backend b = file_backend::automatic )
+{
+    ec.clear();
+
+    if( b == file_backend::af_alg )
+    {
+        b = file_backend::automatic;
+    }
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+    std::uint64_t size = 0;
+
+    {
+        detail::file_descriptor fd( detail::file_open( path, 0 ) );
+
+        if( fd.get() < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        struct ::stat st;
+
+        if( ::fstat( fd.get(), &st ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        bool const regular = S_ISREG( st.st_mode );
+
+        if( regular )
+        {
+            size = static_cast<std::uint64_t>( st.st_size );
+        }
+
+#if defined(SEEK_HOLE) && defined(SEEK_DATA)
+
+        // the holes of sparse files, such as disk images, aren't read
+
+        if( b == file_backend::automatic && detail::file_is_sparse( st ) && detail::hash_fd_sparse( h, fd.get(), size, ec ) )
+        {
+            return;
+        }
+
+#endif
+
+        if( b == file_backend::automatic )
+        {
+            if( !regular || size < BOOST_HASH2_HASH_FILE_MMAP_THRESHOLD )
+            {
+                b = file_backend::read;
+            }
+            else if( size < BOOST_HASH2_HASH_FILE_DIRECT_THRESHOLD )
+            {
+                b = file_backend::mmap;
+            }
+            else
+            {
+                b = file_backend::direct;
+            }
+        }
+
+        if( b == file_backend::mmap && regular && detail::hash_fd_mmap( h, fd.get(), size ) )
+        {
+            return;
+        }
+
+#if defined(BOOST_HASH2_HAS_IO_URING)
+
+        // for small files, setting up the queue costs more than the reads
+
+        if( b == file_backend::uring && regular && size >= BOOST_HASH2_HASH_FILE_MMAP_THRESHOLD && detail::hash_fd_uring( h, fd.get(), size, ec ) )
+        {
+            return;
+        }
+
+#endif
+
+        if( b != file_backend::direct )
+        {
+            detail::hash_fd_read( h, fd.get(), size, ec );
+            return;
+        }
+    }
+
+    // O_DIRECT needs its own descriptor
+
+    if( !detail::hash_file_direct( h, path, ec ) )
+    {
+        detail::file_descriptor fd( detail::file_open( path, 0 ) );
+
+        if( fd.get() < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        detail::hash_fd_read( h, fd.get(), size, ec );
+    }
+
+#else
+
+    (void)b;
+    detail::hash_file_stdio( h, path, ec );
+
+#endif
+}
+
+// returns the digest of the file path, or a value-initialized result on error
+//
+// af_alg computes the digests of md5_128, sha1_160, and sha2_224, 256, 384
+// and 512 with the Linux kernel crypto API, splicing the file to it without
+// copying; for other algorithms, platforms, kernels without the algorithm,
+// and files that aren't regular, it's the same as automatic
+
+template<class H> typename H::result_type hash_file( char const* path, std::error_code& ec, file_backend b = file_backend::automatic )
+{
+    if( b == file_backend::af_alg )
+    {
+        ec.clear();
+
+        typename H::result_type r = typename H::result_type();
+
+        if( detail::hash_file_af_alg( path, detail::af_alg_traits<H>::name(), r, ec ) )
+        {
+            if( ec ) return typename H::result_type();
+            return r;
+        }
+
+        b = file_backend::automatic;
+    }
+
+    H h;
+    hash_file( h, path, ec, b );
+
+    if( ec ) return typename H::result_type();
+    return h.result();
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_FILE_HPP_INCLUDED
@@ -0,0 +1,77 @@
+#ifndef BOOST_HASH2_HASH_FIXED_HPP_INCLUDED
+#define BOOST_HASH2_HASH_FIXED_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash_fixed, hashing of messages whose length is known at compile time
+
+#include <boost/config.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// Hash::hash_fixed<N>( p ) is an optional member, equivalent to a copy of
+// the hash object after update( p, N ) and result()
+
+template<class Hash, class En = void> struct has_hash_fixed: std::false_type
+{
+};
+
+template<class Hash> struct has_hash_fixed<Hash, decltype( std::declval<Hash const&>().template hash_fixed<1>( std::declval<unsigned char const*>() ), void() )>: std::true_type
+{
+};
+
+template<std::size_t N, class H> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR typename H::result_type hash_fixed_( H const& h, unsigned char const* p, std::true_type )
+{
+    return h.template hash_fixed<N>( p );
+}
+
+template<std::size_t N, class H> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR typename H::result_type hash_fixed_( H const& h, unsigned char const* p, std::false_type )
+{
+    H h2( h );
+
+    h2.update( p, N );
+    return h2.result();
+}
+
+} // namespace detail
+
+// the result of a copy of h after update( p, N )
+
+template<std::size_t N, class H> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR typename H::result_type hash_fixed( H const& h, unsigned char const* p )
+{
+    return detail::hash_fixed_<N>( h, p, detail::has_hash_fixed<H>() );
+}
+
+template<std::size_t N, class H> BOOST_FORCEINLINE typename H::result_type hash_fixed( H const& h, void const* p )
+{
+    return detail::hash_fixed_<N>( h, static_cast<unsigned char const*>( p ), detail::has_hash_fixed<H>() );
+}
+
+// the result of H( seed ) after update( p, N )
+
+template<class H, std::size_t N> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR typename H::result_type hash_fixed( unsigned char const* p, std::uint64_t seed = 0 )
+{
+    return detail::hash_fixed_<N>( H( seed ), p, detail::has_hash_fixed<H>() );
+}
+
+template<class H, std::size_t N> BOOST_FORCEINLINE typename H::result_type hash_fixed( void const* p, std::uint64_t seed = 0 )
+{
+    return detail::hash_fixed_<N>( H( seed ), static_cast<unsigned char const*>( p ), detail::has_hash_fixed<H>() );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_FIXED_HPP_INCLUDED
@@ -0,0 +1,97 @@
+#ifndef BOOST_HASH2_HASH_INDICES_HPP_INCLUDED
+#define BOOST_HASH2_HASH_INDICES_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <boost/assert.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the two words used for double hashing; as in get_integral_result,
+// an array-like result is read directly, and a 64 bit integral result
+// is split into its halves
+
+template<class R>
+    typename std::enable_if< std::is_integral<R>::value, void >::type
+    get_result_words( R const& r, std::uint64_t& h1, std::uint64_t& h2 )
+{
+    static_assert( std::is_unsigned<R>::value, "R must be unsigned" );
+    static_assert( sizeof(R) >= 8, "Integral result type is too short" );
+
+    std::uint64_t w = static_cast<std::uint64_t>( r );
+
+    h1 = w & 0xFFFFFFFFu;
+    h2 = w >> 32;
+}
+
+template<class R>
+    typename std::enable_if< !std::is_integral<R>::value, void >::type
+    get_result_words( R const& r, std::uint64_t& h1, std::uint64_t& h2 )
+{
+    static_assert( R().size() >= 16, "Array-like result type is too short" );
+
+    h1 = detail::read64le( r.data() + 0 );
+    h2 = detail::read64le( r.data() + 8 );
+}
+
+// ( a + b ) % m, for a, b < m, without overflow
+
+inline std::uint64_t add_mod( std::uint64_t a, std::uint64_t b, std::uint64_t m ) noexcept
+{
+    return a >= m - b? a - ( m - b ): a + b;
+}
+
+} // namespace detail
+
+// hash_indices, k indices in [0, m) from a single hash of v, using
+// enhanced double hashing (Kirsch-Mitzenmacher, Dillinger-Manolios):
+//
+//   index(i) = h1 + i * h2 + ( i^3 - i ) / 6  (mod m)
+
+template<class H, class Flavor = default_flavor, class T>
+void hash_indices( H h, T const& v, std::size_t k, std::size_t m, std::size_t* out )
+{
+    BOOST_ASSERT( m > 0 );
+
+    detail::hash_append_key( h, Flavor(), v, container_hash::is_contiguous_range<T>() );
+
+    std::uint64_t h1, h2;
+    detail::get_result_words( h.result(), h1, h2 );
+
+    std::uint64_t a = h1 % m;
+    std::uint64_t b = h2 % m;
+
+    for( std::size_t i = 0; i < k; ++i )
+    {
+        out[ i ] = static_cast<std::size_t>( a );
+
+        a = detail::add_mod( a, b, m );
+        b = detail::add_mod( b, ( i + 1 ) % m, m );
+    }
+}
+
+template<class H, class Flavor = default_flavor, class T>
+void hash_indices( T const& v, std::size_t k, std::size_t m, std::size_t* out )
+{
+    hash2::hash_indices<H, Flavor>( H(), v, k, m, out );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_INDICES_HPP_INCLUDED
@@ -0,0 +1,212 @@
+#ifndef BOOST_HASH2_HASH_PARTITION_HPP_INCLUDED
+#define BOOST_HASH2_HASH_PARTITION_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash_partition, radix partitioning of a range of keys by hash value,
+// as done before building the per-partition tables of a hash join
+
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the minimum number of keys per task
+
+constexpr std::size_t hash_partition_min = 16384;
+
+// the number of keys hashed at a time by hash_batch
+
+constexpr std::size_t hash_partition_block = 256;
+
+// the indices of each partition are collected in a buffer of a cache line
+// and written out a line at a time (software write-combining), so that the
+// scatter touches one line per partition instead of one per key. Below
+// hash_partition_min_buffered partitions, the destinations stay in the
+// cache anyway, and above hash_partition_max_buffered, the buffers no
+// longer fit in it; in both cases, the indices are written directly.
+
+constexpr std::size_t hash_partition_line = 64 / sizeof( std::size_t );
+constexpr std::size_t hash_partition_min_buffered = 128;
+constexpr std::size_t hash_partition_max_buffered = 4096;
+
+// the first pass; stores the partition of each key in [first, first+n)
+// into part, and counts the keys of each partition into hist
+
+template<class H, class Flavor, class It> void hash_partition_count( It first, std::size_t n, std::size_t nparts, std::uint64_t seed, std::uint32_t* part, std::size_t* hist )
+{
+    constexpr std::size_t N = hash_partition_block;
+
+    typename H::result_type r[ N ];
+
+    while( n > 0 )
+    {
+        std::size_t const m = n < N? n: N;
+
+        It last = std::next( first, m );
+        hash2::hash_batch<H, Flavor>( first, last, r, seed );
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            std::uint32_t const p = static_cast<std::uint32_t>( hash2::reduce( r[ i ], nparts ) );
+
+            part[ i ] = p;
+            ++hist[ p ];
+        }
+
+        first = last;
+
+        part += m;
+        n -= m;
+    }
+}
+
+// the second pass; writes the indices in [i, j) to the positions pos of
+// their partitions, in increasing order
+
+inline void hash_partition_scatter( std::uint32_t const* part, std::size_t i, std::size_t j, std::size_t nparts, std::size_t* pos, std::size_t* perm )
+{
+    if( nparts < hash_partition_min_buffered || nparts > hash_partition_max_buffered )
+    {
+        for( ; i < j; ++i )
+        {
+            perm[ pos[ part[ i ] ]++ ] = i;
+        }
+
+        return;
+    }
+
+    constexpr std::size_t L = hash_partition_line;
+
+    std::vector<std::size_t> buffer( nparts * L );
+    std::vector<unsigned char> count( nparts );
+
+    for( ; i < j; ++i )
+    {
+        std::uint32_t const p = part[ i ];
+        std::size_t c = count[ p ];
+
+        buffer[ p * L + c ] = i;
+
+        if( ++c == L )
+        {
+            std::memcpy( perm + pos[ p ], &buffer[ p * L ], L * sizeof( std::size_t ) );
+
+            pos[ p ] += L;
+            c = 0;
+        }
+
+        count[ p ] = static_cast<unsigned char>( c );
+    }
+
+    for( std::size_t p = 0; p < nparts; ++p )
+    {
+        std::size_t const c = count[ p ];
+
+        if( c != 0 )
+        {
+            std::memcpy( perm + pos[ p ], &buffer[ p * L ], c * sizeof( std::size_t ) );
+            pos[ p ] += c;
+        }
+    }
+}
+
+} // namespace detail
+
+// hash_partition, partitions the n keys in [first, last) into nparts
+// partitions by hash value, the key *it going into the partition
+//
+//   reduce( h.result(), nparts )
+//
+// where h is H( seed ) after hash_append( h, Flavor(), *it ). Stores into
+// [perm + offsets[p], perm + offsets[p+1]) the indices of the keys of the
+// partition p, in increasing order; offsets must have room for nparts + 1
+// elements, and perm for n.
+//
+// Keys are hashed with hash_batch, and partitioned in two passes: the
+// first computes the partition of each key and a histogram per task, and
+// the second, after a prefix sum over the histograms, writes the indices.
+// With random access iterators, both passes run on ex, on consecutive
+// subranges; the result is the same for any executor.
+
+template<class H, class Flavor = default_flavor, class It> void hash_partition( It first, It last, std::size_t nparts, std::size_t* offsets, std::size_t* perm, task_executor& ex, std::uint64_t seed = 0 )
+{
+    BOOST_ASSERT( nparts > 0 && nparts - 1 <= 0xFFFFFFFFu );
+
+    std::size_t const n = static_cast<std::size_t>( std::distance( first, last ) );
+
+    constexpr bool random_access = std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>::value;
+
+    std::size_t const tasks = random_access? detail::parallel_parts( ex, n, detail::hash_partition_min ): 1;
+
+    std::vector<std::uint32_t> part( n );
+    std::vector<std::size_t> hist( tasks * nparts );
+
+    hash2::bulk_execute( ex, tasks, [&]( std::size_t t ){
+
+        std::size_t const i = n * t / tasks;
+        std::size_t const j = n * ( t + 1 ) / tasks;
+
+        detail::hash_partition_count<H, Flavor>( std::next( first, i ), j - i, nparts, seed, part.data() + i, hist.data() + t * nparts );
+    });
+
+    // the keys of partition p from task t start after those of the
+    // partitions before p, and those of p from the tasks before t
+
+    std::size_t s = 0;
+
+    for( std::size_t p = 0; p < nparts; ++p )
+    {
+        offsets[ p ] = s;
+
+        for( std::size_t t = 0; t < tasks; ++t )
+        {
+            std::size_t const c = hist[ t * nparts + p ];
+
+            hist[ t * nparts + p ] = s;
+            s += c;
+        }
+    }
+
+    offsets[ nparts ] = s;
+
+    hash2::bulk_execute( ex, tasks, [&]( std::size_t t ){
+
+        std::size_t const i = n * t / tasks;
+        std::size_t const j = n * ( t + 1 ) / tasks;
+
+        detail::hash_partition_scatter( part.data(), i, j, nparts, hist.data() + t * nparts, perm );
+    });
+}
+
+// same, on up to `threads` threads; threads == 0 means
+// std::thread::hardware_concurrency()
+
+template<class H, class Flavor = default_flavor, class It> void hash_partition( It first, It last, std::size_t nparts, std::size_t* offsets, std::size_t* perm, unsigned threads = 0, std::uint64_t seed = 0 )
+{
+    thread_executor ex( threads );
+    hash2::hash_partition<H, Flavor>( first, last, nparts, offsets, perm, ex, seed );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASH_PARTITION_HPP_INCLUDED
@@ -0,0 +1,106 @@
+#ifndef BOOST_HASH2_HASHED_HPP_INCLUDED
+#define BOOST_HASH2_HASHED_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// hashed<T, H, Flavor>, a value together with its hash value, computed
+// once on construction by hash<T, H, Flavor>
+
+template<class T, class H, class Flavor = default_flavor> class hashed
+{
+private:
+
+    T value_;
+    std::size_t hash_;
+
+public:
+
+    using value_type = T;
+    using hasher = hash<T, H, Flavor>;
+
+    explicit hashed( T const& v, hasher const& hf = hasher() ): value_( v ), hash_( hf( value_ ) )
+    {
+    }
+
+    explicit hashed( T&& v, hasher const& hf = hasher() ): value_( std::move( v ) ), hash_( hf( value_ ) )
+    {
+    }
+
+    T const& value() const noexcept
+    {
+        return value_;
+    }
+
+    std::size_t hash_value() const noexcept
+    {
+        return hash_;
+    }
+
+    // values with different hash values are unequal, so
+    // these are compared first
+
+    friend bool operator==( hashed const& a, hashed const& b )
+    {
+        return a.hash_ == b.hash_ && a.value_ == b.value_;
+    }
+
+    friend bool operator!=( hashed const& a, hashed const& b )
+    {
+        return !( a == b );
+    }
+
+    // hash_append appends the stored hash value instead of the value
+
+    template<class Hash, class Flavor2>
+    friend void tag_invoke( hash_append_tag const&, Hash& h, Flavor2 const& f, hashed const& v )
+    {
+        hash2::hash_append( h, f, v.hash_ );
+    }
+};
+
+// the hash function object returns the stored hash value; H2 and the
+// seed are ignored, as the value was already computed with H
+
+template<class T, class H, class Flavor, class H2, class Flavor2> class hash<hashed<T, H, Flavor>, H2, Flavor2>
+{
+public:
+
+    using is_avalanching = std::true_type;
+
+    hash()
+    {
+    }
+
+    explicit hash( std::uint64_t /*seed*/ )
+    {
+    }
+
+    hash( unsigned char const* /*seed*/, std::size_t /*n*/ )
+    {
+    }
+
+    std::size_t operator()( hashed<T, H, Flavor> const& v ) const noexcept
+    {
+        return v.hash_value();
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASHED_HPP_INCLUDED
@@ -0,0 +1,59 @@
+#ifndef BOOST_HASH2_HASHING_COPY_HPP_INCLUDED
+#define BOOST_HASH2_HASHING_COPY_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// a block of this size is still in the L1 cache when it's hashed, right
+// after having been copied
+
+std::size_t const hashing_copy_block_size = 16 * 1024;
+
+} // namespace detail
+
+// copies [src, src + n) to [dst, dst + n), and passes the copied bytes to h
+
+template<class H> void hashing_copy( H& h, void const* src, void* dst, std::size_t n )
+{
+    unsigned char const* p = static_cast<unsigned char const*>( src );
+    unsigned char* q = static_cast<unsigned char*>( dst );
+
+    while( n > 0 )
+    {
+        std::size_t const m = n < detail::hashing_copy_block_size? n: detail::hashing_copy_block_size;
+
+        std::memcpy( q, p, m );
+        h.update( q, m );
+
+        p += m;
+        q += m;
+        n -= m;
+    }
+}
+
+// returns the digest of the copied bytes
+
+template<class H> typename H::result_type hashing_copy( void const* src, void* dst, std::size_t n )
+{
+    H h;
+    hashing_copy( h, src, dst, n );
+
+    return h.result();
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASHING_COPY_HPP_INCLUDED
@@ -0,0 +1,421 @@
+#ifndef BOOST_HASH2_HASHING_STREAM_HPP_INCLUDED
+#define BOOST_HASH2_HASHING_STREAM_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hashing_copy.hpp>
+#include <boost/core/no_exceptions_support.hpp>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <memory>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// hashing_streambuf<H>, an output stream buffer that passes the characters
+// written to it to H, and forwards them to another stream buffer, if one
+// is given
+//
+// the characters are collected in a buffer of detail::hashing_copy_block_size
+// bytes, which is hashed and forwarded while still in the cache
+
+template<class H> class hashing_streambuf: public std::streambuf
+{
+private:
+
+    H h_;
+    std::streambuf* sb_;
+
+    char buffer_[ detail::hashing_copy_block_size ];
+
+private:
+
+    // passes [p, p + n) to h_ and to sb_
+
+    bool write( char const* p, std::size_t n )
+    {
+        h_.update( p, n );
+
+        if( sb_ == 0 ) return true;
+
+        return sb_->sputn( p, static_cast<std::streamsize>( n ) ) == static_cast<std::streamsize>( n );
+    }
+
+    bool flush_buffer()
+    {
+        std::size_t const n = static_cast<std::size_t>( pptr() - pbase() );
+
+        setp( buffer_, buffer_ + sizeof( buffer_ ) );
+
+        return n == 0 || write( buffer_, n );
+    }
+
+protected:
+
+    int_type overflow( int_type c ) override
+    {
+        if( !flush_buffer() ) return traits_type::eof();
+
+        if( !traits_type::eq_int_type( c, traits_type::eof() ) )
+        {
+            *pptr() = traits_type::to_char_type( c );
+            pbump( 1 );
+        }
+
+        return traits_type::not_eof( c );
+    }
+
+    std::streamsize xsputn( char const* p, std::streamsize n ) override
+    {
+        std::size_t m = static_cast<std::size_t>( n );
+
+        if( m <= static_cast<std::size_t>( epptr() - pptr() ) )
+        {
+            std::memcpy( pptr(), p, m );
+            pbump( static_cast<int>( m ) );
+
+            return n;
+        }
+
+        if( !flush_buffer() ) return 0;
+
+        // large writes bypass the buffer, a block at a time
+
+        std::streamsize r = 0;
+
+        while( m >= sizeof( buffer_ ) )
+        {
+            if( !write( p, sizeof( buffer_ ) ) ) return r;
+
+            p += sizeof( buffer_ );
+            m -= sizeof( buffer_ );
+            r += static_cast<std::streamsize>( sizeof( buffer_ ) );
+        }
+
+        std::memcpy( pptr(), p, m );
+        pbump( static_cast<int>( m ) );
+
+        return n;
+    }
+
+    int sync() override
+    {
+        if( !flush_buffer() ) return -1;
+
+        if( sb_ != 0 ) return sb_->pubsync();
+
+        return 0;
+    }
+
+public:
+
+    using hash_type = H;
+    using result_type = typename H::result_type;
+
+    explicit hashing_streambuf( std::streambuf* sb = 0 ): h_(), sb_( sb )
+    {
+        setp( buffer_, buffer_ + sizeof( buffer_ ) );
+    }
+
+    hashing_streambuf( std::streambuf* sb, H const& h ): h_( h ), sb_( sb )
+    {
+        setp( buffer_, buffer_ + sizeof( buffer_ ) );
+    }
+
+    hashing_streambuf( hashing_streambuf const& ) = delete;
+    hashing_streambuf& operator=( hashing_streambuf const& ) = delete;
+
+    ~hashing_streambuf()
+    {
+        flush_buffer();
+    }
+
+    std::streambuf* target() const noexcept
+    {
+        return sb_;
+    }
+
+    // flushes the buffer, and returns the hash of the characters written
+    // so far; as with H::result, further calls extend the output
+
+    result_type result()
+    {
+        flush_buffer();
+        return h_.result();
+    }
+};
+
+// hashing_ostream<H>, an output stream over a hashing_streambuf<H>
+
+template<class H> class hashing_ostream: public std::ostream
+{
+private:
+
+    hashing_streambuf<H> sb_;
+
+public:
+
+    using hash_type = H;
+    using result_type = typename H::result_type;
+
+    // without a target, the output is only hashed
+
+    hashing_ostream(): std::ostream( 0 ), sb_()
+    {
+        std::ostream::rdbuf( &sb_ );
+    }
+
+    explicit hashing_ostream( std::ostream& os ): std::ostream( 0 ), sb_( os.rdbuf() )
+    {
+        std::ostream::rdbuf( &sb_ );
+    }
+
+    explicit hashing_ostream( std::streambuf* sb ): std::ostream( 0 ), sb_( sb )
+    {
+        std::ostream::rdbuf( &sb_ );
+    }
+
+    hashing_ostream( std::streambuf* sb, H const& h ): std::ostream( 0 ), sb_( sb, h )
+    {
+        std::ostream::rdbuf( &sb_ );
+    }
+
+    // flushes the stream, and returns the hash of the characters written
+    // so far
+
+    result_type result()
+    {
+        flush();
+        return sb_.result();
+    }
+
+    hashing_streambuf<H>* rdbuf() const noexcept
+    {
+        return const_cast<hashing_streambuf<H>*>( &sb_ );
+    }
+};
+
+namespace detail
+{
+
+// the get area of a stream buffer, through pointers to the protected
+// members, which is the only portable way of reading it in place
+
+struct streambuf_access: std::streambuf
+{
+    static char* get_next( std::streambuf& sb )
+    {
+        return ( sb.*&streambuf_access::gptr )();
+    }
+
+    static char* get_end( std::streambuf& sb )
+    {
+        return ( sb.*&streambuf_access::egptr )();
+    }
+
+    static void get_bump( std::streambuf& sb, int n )
+    {
+        ( sb.*&streambuf_access::gbump )( n );
+    }
+};
+
+// the size of the reads that bypass the get area
+
+std::size_t const hash_stream_block_size = 256 * 1024;
+
+} // namespace detail
+
+// passes the characters that remain in sb to h; the characters in the get
+// area are hashed in place, and the rest is read in large blocks, which
+// std::filebuf reads directly from the file, without going through its
+// own, small, buffer
+
+template<class H> void hash_stream( H& h, std::streambuf& sb )
+{
+    std::unique_ptr<char[]> buffer;
+
+    for( ;; )
+    {
+        // the get area
+
+        char* p = detail::streambuf_access::get_next( sb );
+        char* q = detail::streambuf_access::get_end( sb );
+
+        while( p != q )
+        {
+            std::size_t n = static_cast<std::size_t>( q - p );
+
+            if( n > detail::hash_stream_block_size )
+            {
+                n = detail::hash_stream_block_size;
+            }
+
+            h.update( p, n );
+            detail::streambuf_access::get_bump( sb, static_cast<int>( n ) );
+
+            p += n;
+        }
+
+        // the rest
+
+        if( !buffer )
+        {
+            buffer.reset( new char[ detail::hash_stream_block_size ] );
+        }
+
+        std::streamsize r = sb.sgetn( buffer.get(), static_cast<std::streamsize>( detail::hash_stream_block_size ) );
+
+        if( r <= 0 ) break;
+
+        h.update( buffer.get(), static_cast<std::size_t>( r ) );
+    }
+}
+
+// passes the characters that remain in is to h, and sets eofbit; sets
+// badbit if is has no stream buffer, or if reading from it throws
+
+template<class H> void hash_stream( H& h, std::istream& is )
+{
+    std::istream::sentry s( is, true );
+
+    if( !s ) return;
+
+    std::streambuf* sb = is.rdbuf();
+
+    if( sb == 0 )
+    {
+        is.setstate( std::ios_base::badbit );
+        return;
+    }
+
+    BOOST_TRY
+    {
+        hash_stream( h, *sb );
+    }
+    BOOST_CATCH(...)
+    {
+        is.setstate( std::ios_base::badbit );
+        return;
+    }
+    BOOST_CATCH_END
+
+    is.setstate( std::ios_base::eofbit );
+}
+
+template<class H> typename H::result_type hash_stream( std::istream& is )
+{
+    H h;
+    hash_stream( h, is );
+
+    return h.result();
+}
+
+// hashing_istreambuf<H>, an input stream buffer that reads from another
+// stream buffer in large blocks, and passes the characters to H as they
+// are read
+
+template<class H> class hashing_istreambuf: public std::streambuf
+{
+private:
+
+    H h_;
+    std::streambuf* sb_;
+
+    std::unique_ptr<char[]> buffer_;
+
+protected:
+
+    int_type underflow() override
+    {
+        if( gptr() != egptr() ) return traits_type::to_int_type( *gptr() );
+
+        std::streamsize r = sb_->sgetn( buffer_.get(), static_cast<std::streamsize>( detail::hash_stream_block_size ) );
+
+        if( r <= 0 ) return traits_type::eof();
+
+        h_.update( buffer_.get(), static_cast<std::size_t>( r ) );
+
+        setg( buffer_.get(), buffer_.get(), buffer_.get() + r );
+        return traits_type::to_int_type( *gptr() );
+    }
+
+public:
+
+    using hash_type = H;
+    using result_type = typename H::result_type;
+
+    explicit hashing_istreambuf( std::streambuf* sb ): h_(), sb_( sb ), buffer_( new char[ detail::hash_stream_block_size ] )
+    {
+    }
+
+    hashing_istreambuf( std::streambuf* sb, H const& h ): h_( h ), sb_( sb ), buffer_( new char[ detail::hash_stream_block_size ] )
+    {
+    }
+
+    hashing_istreambuf( hashing_istreambuf const& ) = delete;
+    hashing_istreambuf& operator=( hashing_istreambuf const& ) = delete;
+
+    std::streambuf* source() const noexcept
+    {
+        return sb_;
+    }
+
+    // the hash of the characters read from the source so far, which may
+    // include some that haven't yet been consumed from this buffer
+
+    result_type result()
+    {
+        return h_.result();
+    }
+};
+
+// hashing_istream<H>, an input stream over a hashing_istreambuf<H>
+
+template<class H> class hashing_istream: public std::istream
+{
+private:
+
+    hashing_istreambuf<H> sb_;
+
+public:
+
+    using hash_type = H;
+    using result_type = typename H::result_type;
+
+    explicit hashing_istream( std::istream& is ): std::istream( 0 ), sb_( is.rdbuf() )
+    {
+        std::istream::rdbuf( &sb_ );
+    }
+
+    explicit hashing_istream( std::streambuf* sb ): std::istream( 0 ), sb_( sb )
+    {
+        std::istream::rdbuf( &sb_ );
+    }
+
+    hashing_istream( std::streambuf* sb, H const& h ): std::istream( 0 ), sb_( sb, h )
+    {
+        std::istream::rdbuf( &sb_ );
+    }
+
+    result_type result()
+    {
+        return sb_.result();
+    }
+
+    hashing_istreambuf<H>* rdbuf() const noexcept
+    {
+        return const_cast<hashing_istreambuf<H>*>( &sb_ );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HASHING_STREAM_HPP_INCLUDED
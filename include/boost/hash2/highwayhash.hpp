@@ -0,0 +1,482 @@
+#ifndef BOOST_HASH2_HIGHWAYHASH_HPP_INCLUDED
+#define BOOST_HASH2_HIGHWAYHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HighwayHash, https://github.com/google/highwayhash
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/highwayhash_x86.hpp>
+#include <boost/hash2/detail/highwayhash_arm.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// K is the number of permutation rounds in the finalization
+
+template<int K> class highwayhash_base
+{
+private:
+
+    static constexpr std::uint64_t M0_0 = 0xdbe6d5d5fe4cce2full;
+    static constexpr std::uint64_t M0_1 = 0xa4093822299f31d0ull;
+    static constexpr std::uint64_t M0_2 = 0x13198a2e03707344ull;
+    static constexpr std::uint64_t M0_3 = 0x243f6a8885a308d3ull;
+
+    static constexpr std::uint64_t M1_0 = 0x3bd39e10cb0ef593ull;
+    static constexpr std::uint64_t M1_1 = 0xc0acf169b5f18a8cull;
+    static constexpr std::uint64_t M1_2 = 0xbe5466cf34e90c6cull;
+    static constexpr std::uint64_t M1_3 = 0x452821e638d01377ull;
+
+    static constexpr std::size_t N = 32;
+
+protected:
+
+    // the state, initialized with the all-zero key
+
+    std::uint64_t v0_[ 4 ] = { M0_0, M0_1, M0_2, M0_3 };
+    std::uint64_t v1_[ 4 ] = { M1_0, M1_1, M1_2, M1_3 };
+    std::uint64_t mul0_[ 4 ] = { M0_0, M0_1, M0_2, M0_3 };
+    std::uint64_t mul1_[ 4 ] = { M1_0, M1_1, M1_2, M1_3 };
+
+private:
+
+    unsigned char buffer_[ N ] = {};
+
+    std::uint64_t n_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t swap32( std::uint64_t x )
+    {
+        return ( x >> 32 ) | ( x << 32 );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t rotate32( std::uint64_t x, unsigned k )
+    {
+        std::uint32_t lo = static_cast<std::uint32_t>( x );
+        std::uint32_t hi = static_cast<std::uint32_t>( x >> 32 );
+
+        lo = ( lo << k ) | ( lo >> ( 32 - k ) );
+        hi = ( hi << k ) | ( hi >> ( 32 - k ) );
+
+        return static_cast<std::uint64_t>( hi ) << 32 | lo;
+    }
+
+    // adds the bytes of the 128 bit value ( v1:v0 ), shuffled so that the
+    // ones with the most entropy from the multiplications are spread out,
+    // to ( *add1:*add0 )
+
+    BOOST_CXX14_CONSTEXPR static void zipper_merge_and_add( std::uint64_t v1, std::uint64_t v0, std::uint64_t& add1, std::uint64_t& add0 )
+    {
+        add0 += ( ( ( v0 & 0xff000000ull ) | ( v1 & 0xff00000000ull ) ) >> 24 ) |
+            ( ( ( v0 & 0xff0000000000ull ) | ( v1 & 0xff000000000000ull ) ) >> 16 ) |
+            ( v0 & 0xff0000ull ) | ( ( v0 & 0xff00ull ) << 32 ) |
+            ( ( v1 & 0xff00000000000000ull ) >> 8 ) | ( v0 << 56 );
+
+        add1 += ( ( ( v1 & 0xff000000ull ) | ( v0 & 0xff00000000ull ) ) >> 24 ) |
+            ( v1 & 0xff0000ull ) | ( ( v1 & 0xff0000000000ull ) >> 16 ) |
+            ( ( v1 & 0xff00ull ) << 24 ) | ( ( v0 & 0xff000000000000ull ) >> 8 ) |
+            ( ( v1 & 0xffull ) << 48 ) | ( v0 & 0xff00000000000000ull );
+    }
+
+    BOOST_CXX14_CONSTEXPR void update_lanes( std::uint64_t const lanes[ 4 ] )
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            v1_[ i ] += mul0_[ i ] + lanes[ i ];
+            mul0_[ i ] ^= ( v1_[ i ] & 0xffffffffu ) * ( v0_[ i ] >> 32 );
+            v0_[ i ] += mul1_[ i ];
+            mul1_[ i ] ^= ( v0_[ i ] & 0xffffffffu ) * ( v1_[ i ] >> 32 );
+        }
+
+        zipper_merge_and_add( v1_[ 1 ], v1_[ 0 ], v0_[ 1 ], v0_[ 0 ] );
+        zipper_merge_and_add( v1_[ 3 ], v1_[ 2 ], v0_[ 3 ], v0_[ 2 ] );
+        zipper_merge_and_add( v0_[ 1 ], v0_[ 0 ], v1_[ 1 ], v1_[ 0 ] );
+        zipper_merge_and_add( v0_[ 3 ], v0_[ 2 ], v1_[ 3 ], v1_[ 2 ] );
+    }
+
+    // processes n packets of 32 bytes
+
+    BOOST_CXX14_CONSTEXPR void packets( unsigned char const* p, std::size_t n )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_avx2() )
+        {
+            detail::highwayhash_update_avx2( v0_, v1_, mul0_, mul1_, p, n );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::highwayhash_update_neon( v0_, v1_, mul0_, mul1_, p, n );
+            return;
+        }
+
+#endif
+
+        for( ; n > 0; --n, p += N )
+        {
+            std::uint64_t lanes[ 4 ] = {};
+
+            for( int i = 0; i < 4; ++i )
+            {
+                lanes[ i ] = detail::read64le( p + i * 8 );
+            }
+
+            update_lanes( lanes );
+        }
+    }
+
+    // k rounds of updating with the permuted v0
+
+    BOOST_CXX14_CONSTEXPR void permute_and_update( int k )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_avx2() )
+        {
+            detail::highwayhash_permute_avx2( v0_, v1_, mul0_, mul1_, k );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::highwayhash_permute_neon( v0_, v1_, mul0_, mul1_, k );
+            return;
+        }
+
+#endif
+
+        for( int j = 0; j < k; ++j )
+        {
+            std::uint64_t const lanes[ 4 ] = { swap32( v0_[ 2 ] ), swap32( v0_[ 3 ] ), swap32( v0_[ 0 ] ), swap32( v0_[ 1 ] ) };
+            update_lanes( lanes );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void init( std::uint64_t const key[ 4 ] )
+    {
+        std::uint64_t const m0[ 4 ] = { M0_0, M0_1, M0_2, M0_3 };
+        std::uint64_t const m1[ 4 ] = { M1_0, M1_1, M1_2, M1_3 };
+
+        for( int i = 0; i < 4; ++i )
+        {
+            v0_[ i ] = m0[ i ] ^ key[ i ];
+            v1_[ i ] = m1[ i ] ^ swap32( key[ i ] );
+            mul0_[ i ] = m0[ i ];
+            mul1_[ i ] = m1[ i ];
+        }
+    }
+
+protected:
+
+    // applies the final partial packet, if any, and the permutation
+    // rounds; the result is then read from the state
+
+    BOOST_CXX14_CONSTEXPR void finalize()
+    {
+        std::size_t const m = static_cast<std::size_t>( n_ % N );
+
+        if( m > 0 )
+        {
+            for( int i = 0; i < 4; ++i )
+            {
+                v0_[ i ] += ( static_cast<std::uint64_t>( m ) << 32 ) + m;
+                v1_[ i ] = rotate32( v1_[ i ], static_cast<unsigned>( m ) );
+            }
+
+            // the whole 4 byte words of the tail are at the start of the
+            // packet; the remaining 0 to 3 bytes go to packet[ 28..31 ] when
+            // m >= 16, with the last word, and to packet[ 16..18 ] otherwise
+
+            unsigned char packet[ N ] = {};
+
+            std::size_t const m4 = m & 3;
+            std::size_t const k4 = m & ~static_cast<std::size_t>( 3 );
+
+            detail::memcpy( packet, buffer_, k4 );
+
+            if( m & 16 )
+            {
+                detail::memcpy( packet + 28, buffer_ + m - 4, 4 );
+            }
+            else if( m4 != 0 )
+            {
+                unsigned char const* q = buffer_ + k4;
+
+                packet[ 16 ] = q[ 0 ];
+                packet[ 17 ] = q[ m4 >> 1 ];
+                packet[ 18 ] = q[ m4 - 1 ];
+            }
+
+            packets( packet, 1 );
+        }
+
+        permute_and_update( K );
+
+        // clear buffered plaintext
+        detail::memset( buffer_, 0, N );
+
+        n_ = 0;
+    }
+
+    // the modular reduction of the 256 bit result words
+
+    BOOST_CXX14_CONSTEXPR static void modular_reduction( std::uint64_t a3, std::uint64_t a2, std::uint64_t a1, std::uint64_t a0, std::uint64_t& m1, std::uint64_t& m0 )
+    {
+        a3 &= 0x3FFFFFFFFFFFFFFFull;
+
+        m1 = a1 ^ ( ( a3 << 1 ) | ( a2 >> 63 ) ) ^ ( ( a3 << 2 ) | ( a2 >> 62 ) );
+        m0 = a0 ^ ( a2 << 1 ) ^ ( a2 << 2 );
+    }
+
+public:
+
+    highwayhash_base() = default;
+
+    // the 64 bit seed is the first key word; the others are zero
+
+    BOOST_CXX14_CONSTEXPR explicit highwayhash_base( std::uint64_t seed )
+    {
+        std::uint64_t const key[ 4 ] = { seed, 0, 0, 0 };
+        init( key );
+    }
+
+    // a 32 byte seed is used as the key directly; other seeds are hashed
+
+    BOOST_CXX14_CONSTEXPR highwayhash_base( unsigned char const * p, std::size_t n )
+    {
+        if( n == 32 )
+        {
+            std::uint64_t const key[ 4 ] = { detail::read64le( p + 0 ), detail::read64le( p + 8 ), detail::read64le( p + 16 ), detail::read64le( p + 24 ) };
+            init( key );
+        }
+        else if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            finalize();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( highwayhash_base, K == 4? "highwayhash_64": K == 6? "highwayhash_128": "highwayhash_256", n );
+
+        if( n == 0 ) return;
+
+        std::size_t m = static_cast<std::size_t>( n_ % N );
+
+        n_ += n;
+
+        if( m > 0 )
+        {
+            std::size_t k = N - m;
+
+            if( n < k )
+            {
+                detail::memcpy( buffer_ + m, p, n );
+                return;
+            }
+
+            detail::memcpy( buffer_ + m, p, k );
+
+            p += k;
+            n -= k;
+
+            packets( buffer_, 1 );
+        }
+
+        if( n >= N )
+        {
+            packets( p, n / N );
+
+            p += n / N * N;
+            n %= N;
+        }
+
+        detail::memcpy( buffer_, p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        for( int i = 0; i < 4; ++i )
+        {
+            ar.u64( self.v0_[ i ] );
+            ar.u64( self.v1_[ i ] );
+            ar.u64( self.mul0_[ i ] );
+            ar.u64( self.mul1_[ i ] );
+        }
+
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 169;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        highwayhash_base tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace detail
+
+// HighwayHash with 64, 128, and 256 bit results; the results of repeated
+// calls to result() continue from the finalized state
+
+class highwayhash_64: public detail::highwayhash_base<4>
+{
+public:
+
+    using result_type = std::uint64_t;
+
+    highwayhash_64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit highwayhash_64( std::uint64_t seed ): detail::highwayhash_base<4>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR highwayhash_64( unsigned char const * p, std::size_t n ): detail::highwayhash_base<4>( p, n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( highwayhash_64, "highwayhash_64" );
+
+        finalize();
+
+        return v0_[ 0 ] + v1_[ 0 ] + mul0_[ 0 ] + mul1_[ 0 ];
+    }
+};
+
+class highwayhash_128: public detail::highwayhash_base<6>
+{
+public:
+
+    using result_type = digest<16>;
+
+    highwayhash_128() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit highwayhash_128( std::uint64_t seed ): detail::highwayhash_base<6>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR highwayhash_128( unsigned char const * p, std::size_t n ): detail::highwayhash_base<6>( p, n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( highwayhash_128, "highwayhash_128" );
+
+        finalize();
+
+
+        result_type r;
+
+        detail::write64le( r.data() + 0, v0_[ 0 ] + mul0_[ 0 ] + v1_[ 2 ] + mul1_[ 2 ] );
+        detail::write64le( r.data() + 8, v0_[ 1 ] + mul0_[ 1 ] + v1_[ 3 ] + mul1_[ 3 ] );
+
+        return r;
+    }
+};
+
+class highwayhash_256: public detail::highwayhash_base<10>
+{
+public:
+
+    using result_type = digest<32>;
+
+    highwayhash_256() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit highwayhash_256( std::uint64_t seed ): detail::highwayhash_base<10>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR highwayhash_256( unsigned char const * p, std::size_t n ): detail::highwayhash_base<10>( p, n )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( highwayhash_256, "highwayhash_256" );
+
+        finalize();
+
+
+        std::uint64_t h[ 4 ] = {};
+
+        modular_reduction( v1_[ 1 ] + mul1_[ 1 ], v1_[ 0 ] + mul1_[ 0 ], v0_[ 1 ] + mul0_[ 1 ], v0_[ 0 ] + mul0_[ 0 ], h[ 1 ], h[ 0 ] );
+        modular_reduction( v1_[ 3 ] + mul1_[ 3 ], v1_[ 2 ] + mul1_[ 2 ], v0_[ 3 ] + mul0_[ 3 ], v0_[ 2 ] + mul0_[ 2 ], h[ 3 ], h[ 2 ] );
+
+        result_type r;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write64le( r.data() + i * 8, h[ i ] );
+        }
+
+        return r;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HIGHWAYHASH_HPP_INCLUDED
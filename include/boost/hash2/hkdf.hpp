@@ -0,0 +1,98 @@
+#ifndef BOOST_HASH2_HKDF_HPP_INCLUDED
+#define BOOST_HASH2_HKDF_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HKDF key derivation function, https://tools.ietf.org/html/rfc5869
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/assert.hpp>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// hkdf_extract<H>, the pseudorandom key derived from the input keying
+// material [p, p+n) and the salt [s, s+sn)
+
+template<class H> typename H::result_type hkdf_extract( unsigned char const* s, std::size_t sn, unsigned char const* p, std::size_t n )
+{
+    // an empty salt and a salt of zeroes are equivalent, because
+    // both are zero-padded to the block size by hmac
+
+    hmac<H> h( s, sn );
+    h.update( p, n );
+
+    return h.result();
+}
+
+template<class H> typename H::result_type hkdf_extract( void const* s, std::size_t sn, void const* p, std::size_t n )
+{
+    return hash2::hkdf_extract<H>( static_cast<unsigned char const*>( s ), sn, static_cast<unsigned char const*>( p ), n );
+}
+
+// hkdf_expand<H>, derives n bytes into out from the pseudorandom
+// key [k, k+kn) and the context information [p, p+pn)
+
+template<class H> void hkdf_expand( unsigned char const* k, std::size_t kn, unsigned char const* p, std::size_t pn, unsigned char* out, std::size_t n )
+{
+    std::size_t const M = sizeof( typename H::result_type );
+
+    BOOST_ASSERT( n <= 255 * M );
+
+    hmac_key<H> const key( k, kn );
+
+    typename H::result_type t;
+
+    for( unsigned i = 1; n > 0; ++i )
+    {
+        hmac<H> h( key );
+
+        if( i > 1 )
+        {
+            h.update( t.data(), t.size() );
+        }
+
+        h.update( p, pn );
+
+        unsigned char c = static_cast<unsigned char>( i );
+        h.update( &c, 1 );
+
+        t = h.result();
+
+        std::size_t m = n < M? n: M;
+
+        std::memcpy( out, t.data(), m );
+
+        out += m;
+        n -= m;
+    }
+}
+
+template<class H> void hkdf_expand( void const* k, std::size_t kn, void const* p, std::size_t pn, void* out, std::size_t n )
+{
+    hash2::hkdf_expand<H>( static_cast<unsigned char const*>( k ), kn, static_cast<unsigned char const*>( p ), pn, static_cast<unsigned char*>( out ), n );
+}
+
+// hkdf<H>, extract followed by expand
+
+template<class H> void hkdf( unsigned char const* s, std::size_t sn, unsigned char const* p, std::size_t n, unsigned char const* q, std::size_t qn, unsigned char* out, std::size_t m )
+{
+    typename H::result_type prk = hash2::hkdf_extract<H>( s, sn, p, n );
+    hash2::hkdf_expand<H>( prk.data(), prk.size(), q, qn, out, m );
+}
+
+template<class H> void hkdf( void const* s, std::size_t sn, void const* p, std::size_t n, void const* q, std::size_t qn, void* out, std::size_t m )
+{
+    hash2::hkdf<H>( static_cast<unsigned char const*>( s ), sn, static_cast<unsigned char const*>( p ), n, static_cast<unsigned char const*>( q ), qn, static_cast<unsigned char*>( out ), m );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HKDF_HPP_INCLUDED
@@ -9,6 +9,7 @@
 
 #include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/state_io.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <boost/config/workaround.hpp>
@@ -35,57 +36,142 @@ namespace boost
 namespace hash2
 {
 
-template<class H> class hmac
+namespace detail
 {
-public:
 
-    using result_type = typename H::result_type;
-    static constexpr int block_size = H::block_size;
+// absorbs the inner and outer padded keys into inner and outer
+
+template<class H> BOOST_HASH2_HMAC_CONSTEXPR void hmac_init( H& inner, H& outer, unsigned char const* p, std::size_t n )
+{
+    constexpr std::size_t m = H::block_size;
+
+    unsigned char key[ m ] = {};
+
+    if( n == 0 )
+    {
+        // memcpy from (NULL, 0) is undefined
+    }
+    else if( n <= m )
+    {
+        detail::memcpy( key, p, n );
+    }
+    else
+    {
+        H h;
+        h.update( p, n );
+
+        typename H::result_type r = h.result();
+
+        detail::memcpy( key, &r[0], m < r.size()? m: r.size() );
+    }
+
+    for( std::size_t i = 0; i < m; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( key[ i ] ^ 0x36 );
+    }
+
+    inner.update( key, m );
+
+    for( std::size_t i = 0; i < m; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( key[ i ] ^ 0x36 ^ 0x5C );
+    }
+
+    outer.update( key, m );
+}
+
+struct hmac_key_access;
+
+} // namespace detail
+
+template<class H> class hmac;
+
+// hmac_key<H>, the state of hmac<H> after the padded keys have been
+// absorbed; constructing hmac<H> from it only copies the two states
 
+template<class H> class hmac_key
+{
 private:
 
+    template<class> friend class hmac;
+    friend struct detail::hmac_key_access;
+
     H outer_;
     H inner_;
 
-private:
+public:
 
-    BOOST_HASH2_HMAC_CONSTEXPR void init( unsigned char const* p, std::size_t n )
+    BOOST_HASH2_HMAC_CONSTEXPR hmac_key()
     {
-        constexpr std::size_t m = block_size;
-
-        unsigned char key[ m ] = {};
+        detail::hmac_init( inner_, outer_, 0, 0 );
+    }
 
-        if( n == 0 )
-        {
-            // memcpy from (NULL, 0) is undefined
-        }
-        else if( n <= m )
+    explicit BOOST_HASH2_HMAC_CONSTEXPR hmac_key( std::uint64_t seed )
+    {
+        if( seed == 0 )
         {
-            detail::memcpy( key, p, n );
+            detail::hmac_init( inner_, outer_, 0, 0 );
         }
         else
         {
-            H h;
-            h.update( p, n );
-
-            result_type r = h.result();
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
 
-            detail::memcpy( key, &r[0], m < r.size()? m: r.size() );
+            detail::hmac_init( inner_, outer_, tmp, 8 );
         }
+    }
 
-        for( std::size_t i = 0; i < m; ++i )
-        {
-            key[ i ] = static_cast<unsigned char>( key[ i ] ^ 0x36 );
-        }
+    BOOST_HASH2_HMAC_CONSTEXPR hmac_key( unsigned char const* p, std::size_t n )
+    {
+        detail::hmac_init( inner_, outer_, p, n );
+    }
+};
 
-        inner_.update( key, m );
+namespace detail
+{
 
-        for( std::size_t i = 0; i < m; ++i )
-        {
-            key[ i ] = static_cast<unsigned char>( key[ i ] ^ 0x36 ^ 0x5C );
-        }
+// gives the multi-buffer HMAC implementations access to the two states
 
-        outer_.update( key, m );
+struct hmac_key_access
+{
+    template<class H> static H const& inner( hmac_key<H> const& key ) noexcept
+    {
+        return key.inner_;
+    }
+
+    template<class H> static H const& outer( hmac_key<H> const& key ) noexcept
+    {
+        return key.outer_;
+    }
+};
+
+// hmac_multi<H>, defines template<std::size_t N> using type and sets value
+// to true when a multi-buffer implementation of hmac<H> is available
+
+template<class H> struct hmac_multi
+{
+    static constexpr bool value = false;
+};
+
+} // namespace detail
+
+template<class H> class hmac
+{
+public:
+
+    using result_type = typename H::result_type;
+    static constexpr int block_size = H::block_size;
+
+private:
+
+    H outer_;
+    H inner_;
+
+private:
+
+    BOOST_HASH2_HMAC_CONSTEXPR void init( unsigned char const* p, std::size_t n )
+    {
+        detail::hmac_init( inner_, outer_, p, n );
     }
 
 public:
@@ -115,6 +201,10 @@ public:
         init( p, n );
     }
 
+    explicit BOOST_CXX14_CONSTEXPR hmac( hmac_key<H> const& key ): outer_( key.outer_ ), inner_( key.inner_ )
+    {
+    }
+
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
         inner_.update( p, n );
@@ -133,8 +223,61 @@ public:
 
         return outer_.result();
     }
+
+private:
+
+    template<class Self, class Ar> BOOST_HASH2_HMAC_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.nested( self.outer_ );
+        ar.nested( self.inner_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 2 * H::state_size;
+
+    BOOST_HASH2_HMAC_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_HASH2_HMAC_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        hmac tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
 };
 
+// verify, checks the HMAC of [p, p+n) against tag; the comparison
+// doesn't stop at the first difference when result_type is digest<N>
+
+template<class H> BOOST_CXX14_CONSTEXPR bool verify( hmac_key<H> const& key, unsigned char const* p, std::size_t n, typename H::result_type const& tag )
+{
+    hmac<H> h( key );
+    h.update( p, n );
+
+    return h.result() == tag;
+}
+
+template<class H> bool verify( hmac_key<H> const& key, void const* p, std::size_t n, typename H::result_type const& tag )
+{
+    return hash2::verify( key, static_cast<unsigned char const*>( p ), n, tag );
+}
+
 } // namespace hash2
 } // namespace boost
 
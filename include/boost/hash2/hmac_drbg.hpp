@@ -0,0 +1,227 @@
+#ifndef BOOST_HASH2_HMAC_DRBG_HPP_INCLUDED
+#define BOOST_HASH2_HMAC_DRBG_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// HMAC_DRBG deterministic random bit generator, NIST SP 800-90A Rev. 1, section 10.1.2
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/random_seed.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/config.hpp>
+#include <random>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class H> class hmac_drbg
+{
+private:
+
+    using digest_type = typename H::result_type;
+
+    static constexpr std::size_t M = sizeof( digest_type );
+
+    // the maximum number of bytes per request, 2^19 bits
+
+    static constexpr std::size_t max_request = 65536;
+
+    digest_type k_;
+    digest_type v_;
+
+    // the output returned by operator(), one generate request at a time
+
+    static constexpr std::size_t N = 32;
+
+    std::uint64_t buffer_[ N ];
+    std::size_t i_ = N;
+
+private:
+
+    // the HMAC_DRBG_Update function, with the provided data given in three parts
+
+    void update( unsigned char const* p1, std::size_t n1, unsigned char const* p2, std::size_t n2, unsigned char const* p3, std::size_t n3 )
+    {
+        for( unsigned char c = 0; c < 2; ++c )
+        {
+            {
+                hmac<H> h( k_.data(), M );
+
+                h.update( v_.data(), M );
+                h.update( &c, 1 );
+
+                h.update( p1, n1 );
+                h.update( p2, n2 );
+                h.update( p3, n3 );
+
+                k_ = h.result();
+            }
+
+            {
+                hmac<H> h( k_.data(), M );
+
+                h.update( v_.data(), M );
+                v_ = h.result();
+            }
+
+            if( n1 + n2 + n3 == 0 ) break;
+        }
+    }
+
+    void instantiate( unsigned char const* e, std::size_t en, unsigned char const* p1, std::size_t n1, unsigned char const* p2, std::size_t n2 )
+    {
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            k_[ i ] = 0x00;
+            v_[ i ] = 0x01;
+        }
+
+        update( e, en, p1, n1, p2, n2 );
+    }
+
+    void generate_( unsigned char* out, std::size_t n, unsigned char const* p, std::size_t pn )
+    {
+        if( pn != 0 )
+        {
+            update( p, pn, 0, 0, 0, 0 );
+        }
+
+        // the key doesn't change during the request, so its
+        // padded forms are only absorbed once
+
+        hmac_key<H> const key( k_.data(), M );
+
+        while( n > 0 )
+        {
+            hmac<H> h( key );
+
+            h.update( v_.data(), M );
+            v_ = h.result();
+
+            std::size_t m = n < M? n: M;
+
+            std::memcpy( out, v_.data(), m );
+
+            out += m;
+            n -= m;
+        }
+
+        update( p, pn, 0, 0, 0, 0 );
+    }
+
+public:
+
+    using result_type = std::uint64_t;
+
+    // instantiates from the entropy source of the operating system,
+    // with 1.5 times the output size of H as the entropy input and nonce
+
+    hmac_drbg()
+    {
+        unsigned char e[ M + M / 2 ];
+
+        if( !detail::random_bytes_os( e, sizeof( e ) ) )
+        {
+            std::random_device rd;
+
+            for( std::size_t i = 0; i < sizeof( e ); ++i )
+            {
+                e[ i ] = static_cast<unsigned char>( rd() );
+            }
+        }
+
+        instantiate( e, sizeof( e ), 0, 0, 0, 0 );
+    }
+
+    // instantiates from the entropy input [e, e+en), the nonce [p, p+n),
+    // and the personalization string [q, q+qn)
+
+    hmac_drbg( unsigned char const* e, std::size_t en, unsigned char const* p, std::size_t n, unsigned char const* q = 0, std::size_t qn = 0 )
+    {
+        instantiate( e, en, p, n, q, qn );
+    }
+
+    hmac_drbg( void const* e, std::size_t en, void const* p, std::size_t n, void const* q = 0, std::size_t qn = 0 )
+    {
+        instantiate( static_cast<unsigned char const*>( e ), en, static_cast<unsigned char const*>( p ), n, static_cast<unsigned char const*>( q ), qn );
+    }
+
+    // reseeds from the entropy input [e, e+en) and the additional input [p, p+n);
+    // discards the output buffered by operator()
+
+    void reseed( unsigned char const* e, std::size_t en, unsigned char const* p = 0, std::size_t n = 0 )
+    {
+        update( e, en, p, n, 0, 0 );
+        i_ = N;
+    }
+
+    void reseed( void const* e, std::size_t en, void const* p = 0, std::size_t n = 0 )
+    {
+        reseed( static_cast<unsigned char const*>( e ), en, static_cast<unsigned char const*>( p ), n );
+    }
+
+    // writes n pseudorandom bytes to out, with the additional input [p, p+pn);
+    // requests of more than 2^16 bytes are split into several
+
+    void generate( unsigned char* out, std::size_t n, unsigned char const* p = 0, std::size_t pn = 0 )
+    {
+        do
+        {
+            std::size_t m = n < max_request? n: max_request;
+
+            generate_( out, m, p, pn );
+
+            out += m;
+            n -= m;
+        }
+        while( n > 0 );
+    }
+
+    void generate( void* out, std::size_t n, void const* p = 0, std::size_t pn = 0 )
+    {
+        generate( static_cast<unsigned char*>( out ), n, static_cast<unsigned char const*>( p ), pn );
+    }
+
+    // UniformRandomBitGenerator
+
+    static constexpr result_type min() noexcept
+    {
+        return 0;
+    }
+
+    static constexpr result_type max() noexcept
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    result_type operator()()
+    {
+        if( i_ == N )
+        {
+            unsigned char tmp[ N * 8 ];
+            generate_( tmp, sizeof( tmp ), 0, 0 );
+
+            for( std::size_t i = 0; i < N; ++i )
+            {
+                buffer_[ i ] = detail::read64le( tmp + i * 8 );
+            }
+
+            i_ = 0;
+        }
+
+        return buffer_[ i_++ ];
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HMAC_DRBG_HPP_INCLUDED
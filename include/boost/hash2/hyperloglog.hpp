@@ -0,0 +1,462 @@
+#ifndef BOOST_HASH2_HYPERLOGLOG_HPP_INCLUDED
+#define BOOST_HASH2_HYPERLOGLOG_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/hll_x86.hpp>
+#include <boost/hash2/detail/hll_arm.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// x must not be 0
+
+BOOST_FORCEINLINE unsigned countl_zero64( std::uint64_t x ) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return static_cast<unsigned>( __builtin_clzll( x ) );
+
+#else
+
+    unsigned r = 0;
+
+    for( int k = 32; k > 0; k /= 2 )
+    {
+        if( ( x >> ( 64 - k ) ) == 0 )
+        {
+            r += k;
+            x <<= k;
+        }
+    }
+
+    return r;
+
+#endif
+}
+
+// the register index of the hash value h, and its value: one more than the
+// number of leading zeros in the remaining 64 - P bits
+
+template<unsigned P> BOOST_FORCEINLINE std::size_t hll_index( std::uint64_t h ) noexcept
+{
+    return static_cast<std::size_t>( h >> ( 64 - P ) );
+}
+
+template<unsigned P> BOOST_FORCEINLINE std::uint8_t hll_rank( std::uint64_t h ) noexcept
+{
+    // the sentinel bit limits the rank to 64 - P + 1
+    return static_cast<std::uint8_t>( detail::countl_zero64( ( h << P ) | ( std::uint64_t( 1 ) << ( P - 1 ) ) ) + 1 );
+}
+
+// p[i] = max( p[i], q[i] )
+
+inline void hll_merge( std::uint8_t* p, std::uint8_t const* q, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_sse2() )
+    {
+        i = detail::hll_merge_sse2( p, q, n );
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    i = detail::hll_merge_neon( p, q, n );
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        p[ i ] = std::max( p[ i ], q[ i ] );
+    }
+}
+
+// the HyperLogLog estimate from the histogram c of the register values;
+// c[0] is the number of zero registers
+
+inline double hll_estimate( std::size_t const* c, unsigned q, std::size_t m ) noexcept
+{
+    double s = 0;
+
+    for( unsigned k = q + 1; k > 0; --k )
+    {
+        s = ( s + static_cast<double>( c[ k ] ) ) * 0.5;
+    }
+
+    s += static_cast<double>( c[ 0 ] );
+
+    double md = static_cast<double>( m );
+
+    double alpha = m == 16? 0.673: m == 32? 0.697: m == 64? 0.709: 0.7213 / ( 1.0 + 1.079 / md );
+
+    double e = alpha * md * md / s;
+
+    // small range correction, linear counting
+
+    if( e <= 2.5 * md && c[ 0 ] != 0 )
+    {
+        e = md * std::log( md / static_cast<double>( c[ 0 ] ) );
+    }
+
+    return e;
+}
+
+} // namespace detail
+
+// hyperloglog<H, P, Flavor>, a HyperLogLog cardinality sketch with 2^P
+// registers, which hashes values with hash_append
+//
+// while few registers are set, it keeps the nonzero ones in a sparse
+// list, and switches to an array of 2^P registers when the list would
+// no longer be smaller
+
+template<class H, unsigned P = 14, class Flavor = default_flavor> class hyperloglog
+{
+private:
+
+    static_assert( P >= 4 && P <= 18, "P must be between 4 and 18" );
+
+    static constexpr std::size_t M = std::size_t( 1 ) << P;
+
+    // the sparse list has entries index << 8 | rank, and holds at most M / 4
+    // of them, as many bytes as the registers
+
+    static constexpr std::size_t sparse_limit = M / 4;
+
+    H h_;
+
+    std::vector<std::uint32_t> sparse_;
+    std::vector<std::uint8_t> dense_;
+
+private:
+
+    // sorts the sparse list and leaves only the highest rank for each index
+
+    static void compact( std::vector<std::uint32_t>& v )
+    {
+        std::sort( v.begin(), v.end() );
+
+        std::size_t j = 0;
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            if( i + 1 < v.size() && ( v[ i ] >> 8 ) == ( v[ i + 1 ] >> 8 ) ) continue;
+            v[ j++ ] = v[ i ];
+        }
+
+        v.resize( j );
+    }
+
+    void to_dense()
+    {
+        dense_.assign( M, 0 );
+
+        for( std::uint32_t e: sparse_ )
+        {
+            std::uint8_t& r = dense_[ e >> 8 ];
+            r = std::max( r, static_cast<std::uint8_t>( e & 0xFF ) );
+        }
+
+        sparse_.clear();
+        sparse_.shrink_to_fit();
+    }
+
+    void insert_hash( std::uint64_t h )
+    {
+        std::size_t i = detail::hll_index<P>( h );
+        std::uint8_t r = detail::hll_rank<P>( h );
+
+        if( !dense_.empty() )
+        {
+            dense_[ i ] = std::max( dense_[ i ], r );
+            return;
+        }
+
+        sparse_.push_back( static_cast<std::uint32_t>( i << 8 | r ) );
+
+        if( sparse_.size() > sparse_limit )
+        {
+            compact( sparse_ );
+
+            if( sparse_.size() > sparse_limit / 2 )
+            {
+                to_dense();
+            }
+        }
+    }
+
+public:
+
+    using hash_type = H;
+
+    static constexpr unsigned precision = P;
+    static constexpr std::size_t register_count = M;
+
+    hyperloglog(): h_()
+    {
+    }
+
+    explicit hyperloglog( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    hyperloglog( unsigned char const* seed, std::size_t n ): h_( seed, n )
+    {
+    }
+
+    template<class T> void insert( T const& v )
+    {
+        insert_hash( detail::hash_value64<H, Flavor>( h_, v ) );
+    }
+
+    template<class It> void insert( It first, It last )
+    {
+        for( ; first != last; ++first )
+        {
+            insert( *first );
+        }
+    }
+
+    void clear() noexcept
+    {
+        sparse_.clear();
+        dense_.clear();
+    }
+
+    bool is_sparse() const noexcept
+    {
+        return dense_.empty();
+    }
+
+    // the sketches must have been built with the same seed
+
+    void merge( hyperloglog const& r )
+    {
+        if( r.dense_.empty() )
+        {
+            if( dense_.empty() )
+            {
+                sparse_.insert( sparse_.end(), r.sparse_.begin(), r.sparse_.end() );
+                compact( sparse_ );
+
+                if( sparse_.size() > sparse_limit / 2 )
+                {
+                    to_dense();
+                }
+            }
+            else
+            {
+                for( std::uint32_t e: r.sparse_ )
+                {
+                    std::uint8_t& x = dense_[ e >> 8 ];
+                    x = std::max( x, static_cast<std::uint8_t>( e & 0xFF ) );
+                }
+            }
+        }
+        else
+        {
+            if( dense_.empty() )
+            {
+                to_dense();
+            }
+
+            detail::hll_merge( dense_.data(), r.dense_.data(), M );
+        }
+    }
+
+    double estimate() const
+    {
+        std::size_t c[ 64 - P + 2 ] = {};
+
+        if( dense_.empty() )
+        {
+            std::vector<std::uint32_t> v( sparse_ );
+            compact( v );
+
+            for( std::uint32_t e: v )
+            {
+                ++c[ e & 0xFF ];
+            }
+
+            c[ 0 ] = M - v.size();
+        }
+        else
+        {
+            for( std::uint8_t r: dense_ )
+            {
+                ++c[ r ];
+            }
+        }
+
+        return detail::hll_estimate( c, 64 - P, M );
+    }
+
+    // serialization, for merging sketches from other processes
+
+    static constexpr std::size_t state_size = M;
+
+    void save_state( unsigned char* p ) const
+    {
+        if( dense_.empty() )
+        {
+            std::fill( p, p + M, static_cast<unsigned char>( 0 ) );
+
+            for( std::uint32_t e: sparse_ )
+            {
+                p[ e >> 8 ] = std::max( p[ e >> 8 ], static_cast<unsigned char>( e & 0xFF ) );
+            }
+        }
+        else
+        {
+            std::copy( dense_.begin(), dense_.end(), p );
+        }
+    }
+
+    bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            if( p[ i ] > 64 - P + 1 ) return false;
+        }
+
+        sparse_.clear();
+        dense_.assign( p, p + M );
+
+        return true;
+    }
+
+    template<class, unsigned, class> friend class concurrent_hyperloglog;
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, unsigned P, class Flavor> constexpr unsigned hyperloglog<H, P, Flavor>::precision;
+template<class H, unsigned P, class Flavor> constexpr std::size_t hyperloglog<H, P, Flavor>::register_count;
+template<class H, unsigned P, class Flavor> constexpr std::size_t hyperloglog<H, P, Flavor>::state_size;
+
+#endif
+
+// concurrent_hyperloglog<H, P, Flavor>, a HyperLogLog sketch whose
+// insert can be called from several threads at once; it's lock-free,
+// and always dense
+
+template<class H, unsigned P = 14, class Flavor = default_flavor> class concurrent_hyperloglog
+{
+private:
+
+    static_assert( P >= 4 && P <= 18, "P must be between 4 and 18" );
+
+    static constexpr std::size_t M = std::size_t( 1 ) << P;
+
+    H h_;
+    std::unique_ptr<std::atomic<std::uint8_t>[]> r_;
+
+private:
+
+    void init()
+    {
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            r_[ i ].store( 0, std::memory_order_relaxed );
+        }
+    }
+
+public:
+
+    using hash_type = H;
+
+    static constexpr unsigned precision = P;
+    static constexpr std::size_t register_count = M;
+
+    concurrent_hyperloglog(): h_(), r_( new std::atomic<std::uint8_t>[ M ] )
+    {
+        init();
+    }
+
+    explicit concurrent_hyperloglog( std::uint64_t seed ): h_( seed ), r_( new std::atomic<std::uint8_t>[ M ] )
+    {
+        init();
+    }
+
+    concurrent_hyperloglog( unsigned char const* seed, std::size_t n ): h_( seed, n ), r_( new std::atomic<std::uint8_t>[ M ] )
+    {
+        init();
+    }
+
+    concurrent_hyperloglog( concurrent_hyperloglog const& ) = delete;
+    concurrent_hyperloglog& operator=( concurrent_hyperloglog const& ) = delete;
+
+    template<class T> void insert( T const& v )
+    {
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+
+        std::atomic<std::uint8_t>& x = r_[ detail::hll_index<P>( h ) ];
+        std::uint8_t r = detail::hll_rank<P>( h );
+
+        // most inserts don't change the register, and only read it
+
+        std::uint8_t y = x.load( std::memory_order_relaxed );
+
+        while( r > y && !x.compare_exchange_weak( y, r, std::memory_order_relaxed ) )
+        {
+        }
+    }
+
+    // a hyperloglog with the current registers, built with the same seed
+
+    hyperloglog<H, P, Flavor> snapshot() const
+    {
+        hyperloglog<H, P, Flavor> s;
+
+        s.h_ = h_;
+        s.dense_.resize( M );
+
+        for( std::size_t i = 0; i < M; ++i )
+        {
+            s.dense_[ i ] = r_[ i ].load( std::memory_order_relaxed );
+        }
+
+        return s;
+    }
+
+    double estimate() const
+    {
+        return snapshot().estimate();
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, unsigned P, class Flavor> constexpr unsigned concurrent_hyperloglog<H, P, Flavor>::precision;
+template<class H, unsigned P, class Flavor> constexpr std::size_t concurrent_hyperloglog<H, P, Flavor>::register_count;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_HYPERLOGLOG_HPP_INCLUDED
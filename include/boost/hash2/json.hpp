@@ -0,0 +1,163 @@
+#ifndef BOOST_HASH2_JSON_HPP_INCLUDED
+#define BOOST_HASH2_JSON_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// hash_append support for Boost.JSON; the values are hashed by walking
+// them, instead of serializing them first
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/json/value.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the kinds are distinguished by a leading byte, so that e.g. null, false,
+// 0, "" and [] all hash differently
+
+constexpr unsigned char json_null = 0;
+constexpr unsigned char json_false = 1;
+constexpr unsigned char json_true = 2;
+constexpr unsigned char json_negative = 3;
+constexpr unsigned char json_nonnegative = 4;
+constexpr unsigned char json_double = 5;
+constexpr unsigned char json_string = 6;
+constexpr unsigned char json_array = 7;
+constexpr unsigned char json_object = 8;
+
+// the characters, as std::string
+
+template<class Hash, class Flavor> void hash_append_json_chars( Hash& h, Flavor const& f, char const* p, std::size_t n )
+{
+    hash2::hash_append_range( h, f, p, p + n );
+    hash2::hash_append_size( h, f, n );
+}
+
+template<class Hash, class Flavor> void hash_append_json( Hash& h, Flavor const& f, json::string const& v )
+{
+    hash2::hash_append( h, f, json_string );
+    detail::hash_append_json_chars( h, f, v.data(), v.size() );
+}
+
+template<class Hash, class Flavor> void hash_append_json( Hash& h, Flavor const& f, json::array const& v )
+{
+    hash2::hash_append( h, f, json_array );
+    hash2::hash_append_sized_range( h, f, v.begin(), v.end() );
+}
+
+// the members of an object are unordered
+
+template<class Hash, class Flavor> void hash_append_json( Hash& h, Flavor const& f, json::object const& v )
+{
+    hash2::hash_append( h, f, json_object );
+    hash2::hash_append_unordered_range( h, f, v.begin(), v.end() );
+}
+
+// the integers are hashed by value, regardless of whether they are stored
+// as int64 or uint64; a double is distinct from an integer of the same value
+
+template<class Hash, class Flavor> void hash_append_json( Hash& h, Flavor const& f, json::value const& v )
+{
+    switch( v.kind() )
+    {
+    case json::kind::null:
+
+        hash2::hash_append( h, f, json_null );
+        break;
+
+    case json::kind::bool_:
+
+        hash2::hash_append( h, f, v.get_bool()? json_true: json_false );
+        break;
+
+    case json::kind::int64:
+    {
+        std::int64_t const x = v.get_int64();
+
+        if( x < 0 )
+        {
+            hash2::hash_append( h, f, json_negative );
+            hash2::hash_append( h, f, x );
+        }
+        else
+        {
+            hash2::hash_append( h, f, json_nonnegative );
+            hash2::hash_append( h, f, static_cast<std::uint64_t>( x ) );
+        }
+
+        break;
+    }
+
+    case json::kind::uint64:
+
+        hash2::hash_append( h, f, json_nonnegative );
+        hash2::hash_append( h, f, v.get_uint64() );
+        break;
+
+    case json::kind::double_:
+
+        hash2::hash_append( h, f, json_double );
+        hash2::hash_append( h, f, v.get_double() );
+        break;
+
+    case json::kind::string:
+
+        detail::hash_append_json( h, f, v.get_string() );
+        break;
+
+    case json::kind::array:
+
+        detail::hash_append_json( h, f, v.get_array() );
+        break;
+
+    case json::kind::object:
+
+        detail::hash_append_json( h, f, v.get_object() );
+        break;
+    }
+}
+
+template<class Hash, class Flavor> void hash_append_json( Hash& h, Flavor const& f, json::key_value_pair const& v )
+{
+    json::string_view const k = v.key();
+
+    detail::hash_append_json_chars( h, f, k.data(), k.size() );
+    detail::hash_append_json( h, f, v.value() );
+}
+
+template<class T> struct is_json_type: std::integral_constant<bool,
+    std::is_same<T, json::value>::value ||
+    std::is_same<T, json::string>::value ||
+    std::is_same<T, json::array>::value ||
+    std::is_same<T, json::object>::value ||
+    std::is_same<T, json::key_value_pair>::value>
+{
+};
+
+} // namespace detail
+
+// found by argument dependent lookup through hash_append_tag; T is deduced,
+// so that the types convertible to json::value aren't matched. A string,
+// array or object hashes as the json::value holding it
+
+template<class Hash, class Flavor, class T>
+    typename std::enable_if< detail::is_json_type<T>::value, void >::type
+    tag_invoke( hash_append_tag const&, Hash& h, Flavor const& f, T const& v )
+{
+    detail::hash_append_json( h, f, v );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_JSON_HPP_INCLUDED
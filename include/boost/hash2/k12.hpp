@@ -0,0 +1,460 @@
+#ifndef BOOST_HASH2_K12_HPP_INCLUDED
+#define BOOST_HASH2_K12_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// KangarooTwelve, https://www.rfc-editor.org/rfc/rfc9861
+
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/keccak.hpp>
+#include <boost/hash2/detail/k12_x86.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/numa.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// KangarooTwelve is an extendable-output function; each call to
+// result() returns the next bytes of the output
+//
+// The input is split into 8192 byte chunks. The first chunk goes into
+// the final node; each of the others is a leaf, hashed independently
+// with TurboSHAKE128 into a 32 byte chaining value that is then also
+// absorbed into the final node. The leaves are hashed eight or four
+// at a time when AVX-512 or AVX2 is available.
+
+class k12
+{
+private:
+
+    static constexpr std::size_t chunk_size = 8192;
+
+    detail::sha3_base<168, 12> final_; // the final node
+    detail::sha3_base<168, 12> leaf_; // the current leaf
+
+    std::uint64_t n_ = 0; // bytes of input absorbed
+
+    bool squeezing_ = false;
+    std::size_t k_ = 0; // bytes of the current output block already returned
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void finish_leaf()
+    {
+        leaf_.finalize( 0x0B );
+
+        unsigned char cv[ 32 ] = {};
+        leaf_.extract( cv, 32 );
+
+        final_.update( cv, 32 );
+
+        leaf_ = detail::sha3_base<168, 12>();
+    }
+
+    // computes the chaining values of the k whole leaves at p into cv
+
+    BOOST_CXX14_CONSTEXPR static void hash_leaves( unsigned char const* p, std::size_t k, unsigned char* cv )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            if( detail::has_x86_avx512f() )
+            {
+                for( ; k >= 8; k -= 8 )
+                {
+                    detail::k12_leaves_avx512( p, cv );
+
+                    p += 8 * chunk_size;
+                    cv += 8 * 32;
+                }
+            }
+
+            if( detail::has_x86_avx2() )
+            {
+                for( ; k >= 4; k -= 4 )
+                {
+                    detail::k12_leaves_avx2( p, cv );
+
+                    p += 4 * chunk_size;
+                    cv += 4 * 32;
+                }
+            }
+        }
+
+#endif
+
+        for( ; k > 0; --k )
+        {
+            detail::sha3_base<168, 12> leaf;
+
+            leaf.update( p, chunk_size );
+            leaf.finalize( 0x0B );
+            leaf.extract( cv, 32 );
+
+            p += chunk_size;
+            cv += 32;
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void start_leaves()
+    {
+        // the input doesn't fit in a single chunk; the first chunk
+        // is followed by 0x03 and seven zero bytes
+
+        unsigned char const tmp[ 8 ] = { 0x03 };
+        final_.update( tmp, 8 );
+    }
+
+    // input after result() starts a new message, prefixed with the
+    // next 32 bytes of the output, so that it's still hashed in tree mode
+
+    BOOST_CXX14_CONSTEXPR void restart()
+    {
+        BOOST_HASH2_STATS_SUSPEND();
+        result_type r = result();
+        BOOST_HASH2_STATS_RESUME();
+
+        *this = k12();
+
+        absorb( r.data(), r.size() );
+    }
+
+    BOOST_CXX14_CONSTEXPR void absorb( unsigned char const* p, std::size_t n )
+    {
+        if( n_ < chunk_size )
+        {
+            // the first chunk
+
+            std::size_t k = chunk_size - static_cast<std::size_t>( n_ );
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            final_.update( p, k );
+
+            p += k;
+            n -= k;
+            n_ += k;
+        }
+
+        if( n == 0 ) return;
+
+        if( n_ == chunk_size )
+        {
+            start_leaves();
+        }
+
+        std::size_t m = static_cast<std::size_t>( ( n_ - chunk_size ) % chunk_size );
+
+        if( m > 0 )
+        {
+            // complete the current leaf
+
+            std::size_t k = chunk_size - m;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            leaf_.update( p, k );
+
+            p += k;
+            n -= k;
+            n_ += k;
+
+            if( m + k < chunk_size ) return;
+
+            finish_leaf();
+        }
+
+        while( n >= chunk_size )
+        {
+            // whole leaves, up to eight at a time
+
+            unsigned char cv[ 8 * 32 ] = {};
+
+            std::size_t k = n / chunk_size;
+
+            if( k > 8 )
+            {
+                k = 8;
+            }
+
+            hash_leaves( p, k, cv );
+            final_.update( cv, k * 32 );
+
+            p += k * chunk_size;
+            n -= k * chunk_size;
+            n_ += k * chunk_size;
+        }
+
+        if( n > 0 )
+        {
+            leaf_.update( p, n );
+            n_ += n;
+        }
+    }
+
+public:
+
+    using result_type = digest<32>;
+
+    static constexpr int block_size = 168;
+
+    k12() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit k12( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR k12( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( k12, "k12", n );
+
+        if( squeezing_ )
+        {
+            restart();
+        }
+
+        absorb( p, n );
+    }
+
+    // same as update, but hashes the leaves of large inputs on up to
+    // `threads` threads; threads == 0 means std::thread::hardware_concurrency()
+
+    void update_parallel( void const* pv, std::size_t n, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        update_parallel( pv, n, ex );
+    }
+
+    // same, but hashes the leaves on ex
+
+    void update_parallel( void const* pv, std::size_t n, task_executor& ex )
+    {
+        BOOST_HASH2_STATS_UPDATE( k12, "k12", n );
+
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        if( squeezing_ )
+        {
+            restart();
+        }
+
+        // advance to the start of a leaf
+
+        std::size_t b = n_ <= chunk_size? static_cast<std::size_t>( chunk_size - n_ ): static_cast<std::size_t>( ( chunk_size - ( n_ - chunk_size ) % chunk_size ) % chunk_size );
+
+        if( b > n )
+        {
+            b = n;
+        }
+
+        absorb( p, b );
+
+        p += b;
+        n -= b;
+
+        std::size_t const k = n / chunk_size; // whole leaves
+
+        // at least 32 leaves, or 256 KiB, per task
+
+        unsigned const parts = detail::parallel_parts( ex, k, 32 );
+
+        if( parts > 1 )
+        {
+            if( n_ == chunk_size )
+            {
+                start_leaves();
+            }
+
+            std::vector<unsigned char> cv( k * 32 );
+
+            std::size_t const q = k / parts;
+
+            hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+                std::size_t const m = t + 1 < parts? q: k - t * q;
+
+                detail::numa_bind_worker( p + t * q * chunk_size );
+                hash_leaves( p + t * q * chunk_size, m, cv.data() + t * q * 32 );
+            });
+
+            final_.update( cv.data(), k * 32 );
+
+            p += k * chunk_size;
+            n -= k * chunk_size;
+            n_ += k * chunk_size;
+        }
+
+        absorb( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( k12, "k12" );
+
+        if( !squeezing_ )
+        {
+            // the customization string is empty; its length_encode is
+            // a single zero byte
+
+            unsigned char const z[ 1 ] = { 0 };
+            absorb( z, 1 );
+
+            if( n_ <= chunk_size )
+            {
+                final_.finalize( 0x07 );
+            }
+            else
+            {
+                if( ( n_ - chunk_size ) % chunk_size != 0 )
+                {
+                    finish_leaf();
+                }
+
+                // length_encode of the number of leaves, then 0xFF 0xFF
+
+                std::uint64_t m = ( n_ - 1 ) / chunk_size;
+
+                unsigned char tmp[ 11 ] = {};
+                int k = 0;
+
+                for( std::uint64_t x = m; x != 0; x >>= 8 )
+                {
+                    ++k;
+                }
+
+                for( int i = 0; i < k; ++i )
+                {
+                    tmp[ i ] = static_cast<unsigned char>( m >> ( ( k - 1 - i ) * 8 ) );
+                }
+
+                tmp[ k ] = static_cast<unsigned char>( k );
+                tmp[ k + 1 ] = 0xFF;
+                tmp[ k + 2 ] = 0xFF;
+
+                final_.update( tmp, k + 3 );
+                final_.finalize( 0x06 );
+            }
+
+            squeezing_ = true;
+            k_ = 0;
+        }
+
+        result_type digest;
+
+        for( std::size_t i = 0; i < digest.size(); ++i )
+        {
+            if( k_ == block_size )
+            {
+                detail::keccak_permute12( final_.state_ );
+                k_ = 0;
+            }
+
+            digest[ i ] = static_cast<unsigned char>( final_.state_[ k_ / 8 ] >> ( k_ % 8 * 8 ) );
+            ++k_;
+        }
+
+        return digest;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.final_.state_ );
+        ar.bytes( self.final_.buffer_ );
+        ar.u64( self.final_.m_ );
+
+        ar.words( self.leaf_.state_ );
+        ar.bytes( self.leaf_.buffer_ );
+        ar.u64( self.leaf_.m_ );
+
+        ar.u64( self.n_ );
+
+        ar.u8( self.squeezing_ );
+        ar.u64( self.k_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 2 * ( 200 + 168 + 8 ) + 8 + 1 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        k12 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.final_.m_ < 168 && tmp.leaf_.m_ < 168 && tmp.k_ <= 168 ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_K12_HPP_INCLUDED
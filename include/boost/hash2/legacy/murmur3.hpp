@@ -230,6 +230,10 @@ private:
 
 private:
 
+    // Each block feeds h1 into h2 and h2 into the next h1, so the loop
+    // runs at the latency of that chain; computing k1 and k2 for several
+    // blocks at once with SIMD doesn't make it any faster
+
     void update_( unsigned char const * p, std::size_t k )
     {
         std::uint64_t h1 = h1_, h2 = h2_;
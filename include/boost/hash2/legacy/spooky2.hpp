@@ -151,6 +151,10 @@ private:
         s11 += detail::read64le( p + 88 ); s1  ^= s9;  s10 ^= s11; s11 = detail::rotl( s11, 46 ); s10 += s0;
     }
 
+    // The twelve lanes aren't independent; each step of mix reads three
+    // other lanes, updated by the steps before it, so the 96 byte block
+    // can't be spread across SIMD registers without changing the result
+
     void update_( unsigned char const * p, std::size_t k )
     {
         std::uint64_t h0  = v_[ 0];
@@ -227,6 +231,29 @@ private:
         end_partial( h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
     }
 
+    // hashes the last 0 to 191 bytes [p, p+m) in place, as result() does
+    // with the buffer, except that the buffer is zero-padded instead
+
+    static void long_tail( unsigned char const * p, std::size_t m,
+        std::uint64_t & h0, std::uint64_t & h1, std::uint64_t &  h2, std::uint64_t &  h3,
+        std::uint64_t & h4, std::uint64_t & h5, std::uint64_t &  h6, std::uint64_t &  h7,
+        std::uint64_t & h8, std::uint64_t & h9, std::uint64_t & h10, std::uint64_t & h11 )
+    {
+        if( m >= 96 )
+        {
+            mix( p, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
+
+            p += 96;
+            m -= 96;
+        }
+
+        unsigned char tmp[ 96 ] = {};
+        std::memcpy( tmp, p, m );
+        tmp[ 95 ] = static_cast<unsigned char>( m & 0xFF );
+
+        end( tmp, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
+    }
+
     void init( std::uint64_t seed1, std::uint64_t seed2 )
     {
         v_[ 0 ] = v_[ 3 ] = v_[ 6 ] = v_[  9 ] = seed1;
@@ -275,6 +302,50 @@ public:
         }
     }
 
+    // One-shot hashing, equivalent to constructing from seed1 and seed2 and
+    // calling update( p, n ) and result(), but reading the input in place;
+    // inputs shorter than 192 bytes take the ShortHash path directly
+
+    static result_type hash( void const * pv, std::size_t n, std::uint64_t seed1 = 0, std::uint64_t seed2 = 0 )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::uint64_t h0 = seed1;
+        std::uint64_t h1 = seed2;
+
+        if( n < N )
+        {
+            short_hash( p, n, h0, h1 );
+        }
+        else
+        {
+            std::uint64_t h2 = sc_const;
+            std::uint64_t h3 = seed1;
+            std::uint64_t h4 = seed2;
+            std::uint64_t h5 = sc_const;
+            std::uint64_t h6 = seed1;
+            std::uint64_t h7 = seed2;
+            std::uint64_t h8 = sc_const;
+            std::uint64_t h9 = seed1;
+            std::uint64_t h10 = seed2;
+            std::uint64_t h11 = sc_const;
+
+            for( std::size_t i = n / N * 2; i > 0; --i, p += 96 )
+            {
+                mix( p, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
+            }
+
+            long_tail( p, n % N, h0, h1, h2, h3, h4, h5, h6, h7, h8, h9, h10, h11 );
+        }
+
+        result_type r;
+
+        detail::write64le( &r[ 0 ], h0 );
+        detail::write64le( &r[ 8 ], h1 );
+
+        return r;
+    }
+
     void update( void const * pv, std::size_t n )
     {
         unsigned char const* p = static_cast<unsigned char const*>( pv );
@@ -337,9 +408,18 @@ public:
         std::uint64_t h0 = v_[ 0 ];
         std::uint64_t h1 = v_[ 1 ];
 
+        // the number of buffer bytes that may hold plaintext
+
+        std::size_t k = N;
+
         if( n_ < N )
         {
             short_hash( buffer_, n_, h0, h1 );
+
+            // only the first n_ bytes of the buffer have been written
+            // since construction, so there's no need to clear the rest
+
+            k = n_;
         }
         else
         {
@@ -394,7 +474,7 @@ public:
         }
 
         // clear buffered plaintext
-        std::memset( buffer_, 0, N );
+        std::memset( buffer_, 0, k );
 
         result_type r;
 
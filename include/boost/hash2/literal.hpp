@@ -0,0 +1,84 @@
+#ifndef BOOST_HASH2_LITERAL_HPP_INCLUDED
+#define BOOST_HASH2_LITERAL_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// literal<H>, a hash of a string usable as a case label, and the
+// matching runtime hash and comparison for switching on strings
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/memcmp.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// the characters [p, p+n), hashed with a default-constructed H
+
+template<class H = fnv1a_64> BOOST_CXX14_CONSTEXPR std::uint64_t literal( char const* p, std::size_t n )
+{
+    H h;
+    hash2::hash_append_range( h, {}, p, p + n );
+
+    return hash2::get_integral_result<std::uint64_t>( h.result() );
+}
+
+// a string literal, without its terminating null
+
+template<class H = fnv1a_64, std::size_t N> BOOST_CXX14_CONSTEXPR std::uint64_t literal( char const (&s)[ N ] )
+{
+    return hash2::literal<H>( s, N - 1 );
+}
+
+// a contiguous range of characters, such as std::string or std::string_view
+
+template<class H = fnv1a_64, class S>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< container_hash::is_contiguous_range<S>::value, std::uint64_t >::type
+    literal( S const& s )
+{
+    return hash2::literal<H>( s.data(), s.size() );
+}
+
+// the guard of a case label; whether [p, p+n) is the string literal s
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR bool literal_equal( char const* p, std::size_t n, char const (&s)[ N ] ) noexcept
+{
+    return n == N - 1 && detail::equal_chars( p, s, n );
+}
+
+template<class S, std::size_t N>
+    BOOST_CXX14_CONSTEXPR
+    typename std::enable_if< container_hash::is_contiguous_range<S>::value, bool >::type
+    literal_equal( S const& s, char const (&t)[ N ] ) noexcept
+{
+    return hash2::literal_equal( s.data(), s.size(), t );
+}
+
+namespace literals
+{
+
+// "GET"_h2 == literal( "GET" ), always evaluated at compile time under C++20
+
+BOOST_HASH2_CONSTEVAL inline std::uint64_t operator""_h2( char const* p, std::size_t n )
+{
+    return hash2::literal( p, n );
+}
+
+} // namespace literals
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_LITERAL_HPP_INCLUDED
@@ -0,0 +1,417 @@
+#ifndef BOOST_HASH2_LSH_HPP_INCLUDED
+#define BOOST_HASH2_LSH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// locality-sensitive hashing of dense vectors: random hyperplanes
+// (Charikar 2002) for the angular distance, and p-stable projections
+// (Datar et al. 2004) for the Euclidean distance
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/simhash.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/lsh_x86.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <array>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the i-th pseudorandom 64 bit value derived from h0
+
+template<class H> std::uint64_t lsh_random( H const& h0, std::uint64_t i )
+{
+    unsigned char w[ 8 ];
+    detail::write64le( w, i );
+
+    H h( h0 );
+    h.update( w, 8 );
+
+    return hash2::get_integral_result<std::uint64_t>( h.result() );
+}
+
+// an approximately normal variable with mean 0 and standard deviation
+// 37837.23 (2^16 / sqrt(3)), the centered sum of the four 16 bit parts
+// of x; computed exactly, so that the projections are the same on all
+// platforms
+
+inline float lsh_normal( std::uint64_t x ) noexcept
+{
+    long s = static_cast<long>( x & 0xFFFF ) + static_cast<long>( x >> 16 & 0xFFFF ) + static_cast<long>( x >> 32 & 0xFFFF ) + static_cast<long>( x >> 48 ) - 131070;
+    return static_cast<float>( s );
+}
+
+constexpr float lsh_normal_scale = 1.0f / 37837.23f;
+
+// keeps the compiler from contracting the multiplication that produced x
+// and a following addition into a fused multiply-add, which rounds
+// differently
+
+BOOST_FORCEINLINE void lsh_no_contract( float& x ) noexcept
+{
+#if ( defined(__GNUC__) || defined(__clang__) ) && defined(__SSE_MATH__)
+
+    __asm__( "" : "+x"( x ) );
+
+#elif ( defined(__GNUC__) || defined(__clang__) ) && defined(__aarch64__)
+
+    __asm__( "" : "+w"( x ) );
+
+#else
+
+    (void)x;
+
+#endif
+}
+
+// the dot product of w and v; the products of the elements 16k + j are
+// summed into the partial sum j, the partial sums j and j + 8 are added,
+// then j and j + 4, j and j + 2, j and j + 1, and the remaining elements
+// are added in order, on all code paths
+
+inline float lsh_dot( float const* w, float const* v, std::size_t n ) noexcept
+{
+    std::size_t const n16 = n / 16 * 16;
+
+    float a[ 16 ] = {};
+
+    for( std::size_t i = 0; i < n16; i += 16 )
+    {
+        for( std::size_t j = 0; j < 16; ++j )
+        {
+            float p = w[ i + j ] * v[ i + j ];
+            detail::lsh_no_contract( p );
+
+            a[ j ] += p;
+        }
+    }
+
+    for( std::size_t k = 8; k > 0; k /= 2 )
+    {
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            a[ j ] += a[ j + k ];
+        }
+    }
+
+    float s = a[ 0 ];
+
+    for( std::size_t i = n16; i < n; ++i )
+    {
+        float p = w[ i ] * v[ i ];
+        detail::lsh_no_contract( p );
+
+        s += p;
+    }
+
+    return s;
+}
+
+// out[r] = lsh_dot( w + r * n, v, n ), for r in [0, m)
+
+inline void lsh_project( float const* w, std::size_t m, float const* v, std::size_t n, float* out ) noexcept
+{
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_avx512f() )
+    {
+        detail::lsh_project_avx512( w, m, v, n, out );
+        return;
+    }
+
+    if( detail::has_x86_avx2() )
+    {
+        detail::lsh_project_avx2( w, m, v, n, out );
+        return;
+    }
+
+#endif
+
+    for( std::size_t r = 0; r < m; ++r, w += n )
+    {
+        out[ r ] = detail::lsh_dot( w, v, n );
+    }
+}
+
+} // namespace detail
+
+// hyperplane_lsh<H, Bits, Flavor>, Bits bit signatures of vectors of
+// floats; bit i is set when the vector is on the positive side of the
+// i-th hyperplane through the origin, so that the fraction of differing
+// bits estimates the angle between two vectors, divided by pi
+//
+// the normals of the hyperplanes are derived from H and its seed, and
+// only need the seed to be reproduced
+
+template<class H, std::size_t Bits = 64, class Flavor = default_flavor> class hyperplane_lsh
+{
+private:
+
+    static_assert( Bits > 0 && Bits % 64 == 0, "Bits must be a positive multiple of 64" );
+
+    H h_;
+
+    std::size_t n_;
+    std::vector<float> w_; // Bits rows of n_
+
+private:
+
+    void init()
+    {
+        w_.resize( Bits * n_ );
+
+        for( std::size_t i = 0; i < w_.size(); ++i )
+        {
+            w_[ i ] = detail::lsh_normal( detail::lsh_random( h_, i ) );
+        }
+    }
+
+public:
+
+    using hash_type = H;
+    using signature_type = std::array<std::uint64_t, Bits / 64>;
+
+    static constexpr std::size_t size = Bits;
+
+    explicit hyperplane_lsh( std::size_t dim ): h_(), n_( dim )
+    {
+        init();
+    }
+
+    hyperplane_lsh( std::size_t dim, std::uint64_t seed ): h_( seed ), n_( dim )
+    {
+        init();
+    }
+
+    hyperplane_lsh( std::size_t dim, unsigned char const* seed, std::size_t n ): h_( seed, n ), n_( dim )
+    {
+        init();
+    }
+
+    std::size_t dimension() const noexcept
+    {
+        return n_;
+    }
+
+    // v points to dimension() floats
+
+    signature_type signature( float const* v ) const
+    {
+        float p[ Bits ];
+        detail::lsh_project( w_.data(), Bits, v, n_, p );
+
+        signature_type s = {};
+
+        for( std::size_t i = 0; i < Bits; ++i )
+        {
+            s[ i / 64 ] |= static_cast<std::uint64_t>( p[ i ] > 0 ) << ( i % 64 );
+        }
+
+        return s;
+    }
+
+    // the number of differing bits
+
+    static int distance( signature_type const& s1, signature_type const& s2 ) noexcept
+    {
+        int r = 0;
+
+        for( std::size_t i = 0; i < Bits / 64; ++i )
+        {
+            r += detail::popcount64( s1[ i ] ^ s2[ i ] );
+        }
+
+        return r;
+    }
+
+    // an estimate of the cosine similarity of the two vectors
+
+    static double similarity( signature_type const& s1, signature_type const& s2 ) noexcept
+    {
+        return std::cos( 3.14159265358979323846 * distance( s1, s2 ) / Bits );
+    }
+
+    // the keys of the Bands bands of Bits / Bands bits each, for as many
+    // hash tables; key b is the result of H, with the seed of *this,
+    // after hash_append of b and of the bits of band b as an integer
+
+    template<std::size_t Bands> std::array<std::uint64_t, Bands> band_keys( signature_type const& s ) const
+    {
+        static_assert( Bands > 0 && Bits % Bands == 0 && Bits / Bands <= 64, "Bands must divide Bits into bands of at most 64 bits" );
+
+        constexpr std::size_t R = Bits / Bands;
+
+        std::array<std::uint64_t, Bands> r;
+
+        for( std::size_t b = 0; b < Bands; ++b )
+        {
+            std::size_t const i = b * R;
+
+            std::uint64_t x = s[ i / 64 ] >> ( i % 64 );
+
+            if( R < 64 )
+            {
+                x &= ( std::uint64_t( 1 ) << ( R % 64 ) ) - 1;
+            }
+
+            H h( h_ );
+
+            hash2::hash_append( h, Flavor(), static_cast<std::uint64_t>( b ) );
+            hash2::hash_append( h, Flavor(), x );
+
+            r[ b ] = hash2::get_integral_result<std::uint64_t>( h.result() );
+        }
+
+        return r;
+    }
+};
+
+// pstable_lsh<H, K, Flavor>, K bucket indices of vectors of floats; index
+// i is floor( ( a_i . v + b_i ) / width ), where a_i has normally
+// distributed elements and b_i is uniform in [0, width), so that vectors
+// at a small Euclidean distance tend to have equal indices
+//
+// a_i and b_i are derived from H and its seed
+
+template<class H, std::size_t K = 16, class Flavor = default_flavor> class pstable_lsh
+{
+private:
+
+    static_assert( K > 0, "K must be positive" );
+
+    H h_;
+
+    std::size_t n_;
+    float width_;
+
+    std::vector<float> a_; // K rows of n_
+    float b_[ K ];
+
+private:
+
+    void init()
+    {
+        BOOST_ASSERT( width_ > 0 );
+
+        a_.resize( K * n_ );
+
+        for( std::size_t i = 0; i < a_.size(); ++i )
+        {
+            a_[ i ] = detail::lsh_normal( detail::lsh_random( h_, i ) ) * detail::lsh_normal_scale;
+        }
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            // a uniform double in [0, 1), from the high 53 bits
+
+            double u = static_cast<double>( detail::lsh_random( h_, a_.size() + i ) >> 11 ) * ( 1.0 / 9007199254740992.0 );
+            b_[ i ] = static_cast<float>( u * width_ );
+        }
+    }
+
+public:
+
+    using hash_type = H;
+    using signature_type = std::array<std::int32_t, K>;
+
+    static constexpr std::size_t size = K;
+
+    pstable_lsh( std::size_t dim, float width ): h_(), n_( dim ), width_( width )
+    {
+        init();
+    }
+
+    pstable_lsh( std::size_t dim, float width, std::uint64_t seed ): h_( seed ), n_( dim ), width_( width )
+    {
+        init();
+    }
+
+    pstable_lsh( std::size_t dim, float width, unsigned char const* seed, std::size_t n ): h_( seed, n ), n_( dim ), width_( width )
+    {
+        init();
+    }
+
+    std::size_t dimension() const noexcept
+    {
+        return n_;
+    }
+
+    float width() const noexcept
+    {
+        return width_;
+    }
+
+    // v points to dimension() floats
+
+    signature_type signature( float const* v ) const
+    {
+        float p[ K ];
+        detail::lsh_project( a_.data(), K, v, n_, p );
+
+        signature_type s;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            s[ i ] = static_cast<std::int32_t>( std::floor( ( p[ i ] + b_[ i ] ) / width_ ) );
+        }
+
+        return s;
+    }
+
+    // the keys of the Bands bands of K / Bands indices each; key b is the
+    // result of H, with the seed of *this, after hash_append of b and of
+    // the indices of band b
+
+    template<std::size_t Bands> std::array<std::uint64_t, Bands> band_keys( signature_type const& s ) const
+    {
+        static_assert( Bands > 0 && K % Bands == 0, "Bands must divide K" );
+
+        constexpr std::size_t R = K / Bands;
+
+        std::array<std::uint64_t, Bands> r;
+
+        for( std::size_t b = 0; b < Bands; ++b )
+        {
+            H h( h_ );
+
+            hash2::hash_append( h, Flavor(), static_cast<std::uint64_t>( b ) );
+
+            for( std::size_t i = 0; i < R; ++i )
+            {
+                hash2::hash_append( h, Flavor(), s[ b * R + i ] );
+            }
+
+            r[ b ] = hash2::get_integral_result<std::uint64_t>( h.result() );
+        }
+
+        return r;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, std::size_t Bits, class Flavor> constexpr std::size_t hyperplane_lsh<H, Bits, Flavor>::size;
+template<class H, std::size_t K, class Flavor> constexpr std::size_t pstable_lsh<H, K, Flavor>::size;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_LSH_HPP_INCLUDED
@@ -0,0 +1,244 @@
+#ifndef BOOST_HASH2_LTHASH_HPP_INCLUDED
+#define BOOST_HASH2_LTHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// lthash, a homomorphic hash of a set of elements (LtHash, Bellare and
+// Micciancio 1997; Lewi et al. 2019)
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/endian.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/lthash_x86.hpp>
+#include <boost/hash2/detail/lthash_arm.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// H::squeeze( out, n ) is an optional member, producing n bytes of
+// extended output at once
+
+template<class H, class En = void> struct has_squeeze: std::false_type
+{
+};
+
+template<class H> struct has_squeeze<H, decltype( std::declval<H const&>().squeeze( std::declval<unsigned char*>(), std::size_t() ), void() )>: std::true_type
+{
+};
+
+// s[i] += q[i] modulo 2^16, where q[i] is the little endian 16 bit word
+// at p + 2 * i
+
+inline void lthash_add( std::uint16_t* s, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_avx2() )
+    {
+        i = detail::lthash_add_avx2( s, p, n );
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    if( endian::native == endian::little )
+    {
+        i = detail::lthash_add_neon( s, p, n );
+    }
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        s[ i ] = static_cast<std::uint16_t>( s[ i ] + ( p[ 2 * i ] | p[ 2 * i + 1 ] << 8 ) );
+    }
+}
+
+// s[i] -= q[i] modulo 2^16
+
+inline void lthash_sub( std::uint16_t* s, unsigned char const* p, std::size_t n ) noexcept
+{
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_avx2() )
+    {
+        i = detail::lthash_sub_avx2( s, p, n );
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    if( endian::native == endian::little )
+    {
+        i = detail::lthash_sub_neon( s, p, n );
+    }
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        s[ i ] = static_cast<std::uint16_t>( s[ i ] - ( p[ 2 * i ] | p[ 2 * i + 1 ] << 8 ) );
+    }
+}
+
+} // namespace detail
+
+// lthash<H, Lanes, Flavor>
+//
+// Each element is hashed with H, an extendable-output function (by default
+// BLAKE3, which produces the 2048 bytes of output eight blocks at a time
+// with AVX2), into Lanes 16 bit words, which are added to the state modulo 2^16; the
+// state of a multiset is the sum of the vectors of its elements, so that
+// adding, removing, or merging costs the same regardless of its size,
+// and, unlike a sum of 64 bit hash values, finding two multisets with the
+// same state is as hard as a lattice problem
+
+template<class H = blake3, std::size_t Lanes = 1024, class Flavor = default_flavor> class lthash
+{
+private:
+
+    static_assert( Lanes > 0 && Lanes % 16 == 0, "Lanes must be a positive multiple of 16" );
+
+    static constexpr std::size_t N = 2 * Lanes;
+
+    H h_;
+    std::uint16_t s_[ Lanes ] = {};
+
+    static void squeeze( H& h, unsigned char* out, std::true_type )
+    {
+        h.squeeze( out, N );
+    }
+
+    // successive calls to result() of an extendable-output function, such
+    // as shake128, return successive parts of its output
+
+    static void squeeze( H& h, unsigned char* out, std::false_type )
+    {
+        for( std::size_t i = 0; i < N; )
+        {
+            typename H::result_type r = h.result();
+
+            std::size_t n = (std::min)( static_cast<std::size_t>( r.size() ), N - i );
+            std::memcpy( out + i, r.data(), n );
+
+            i += n;
+        }
+    }
+
+    // the N bytes of output of H for v
+
+    template<class T> void expand( T const& v, unsigned char* out ) const
+    {
+        H h( h_ );
+        hash2::hash_append( h, Flavor(), v );
+
+        squeeze( h, out, detail::has_squeeze<H>() );
+    }
+
+public:
+
+    using hash_type = H;
+    using result_type = digest<N>;
+
+    static constexpr std::size_t lanes = Lanes;
+
+    lthash(): h_()
+    {
+    }
+
+    explicit lthash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    lthash( unsigned char const* seed, std::size_t n ): h_( seed, n )
+    {
+    }
+
+    template<class T> void add( T const& v )
+    {
+        unsigned char w[ N ];
+        expand( v, w );
+
+        detail::lthash_add( s_, w, Lanes );
+    }
+
+    template<class T> void remove( T const& v )
+    {
+        unsigned char w[ N ];
+        expand( v, w );
+
+        detail::lthash_sub( s_, w, Lanes );
+    }
+
+    // adds the elements of another lthash with the same seed
+
+    void merge( lthash const& other ) noexcept
+    {
+        for( std::size_t i = 0; i < Lanes; ++i )
+        {
+            s_[ i ] = static_cast<std::uint16_t>( s_[ i ] + other.s_[ i ] );
+        }
+    }
+
+    void clear() noexcept
+    {
+        std::memset( s_, 0, sizeof( s_ ) );
+    }
+
+    // the state, as little endian 16 bit words
+
+    result_type result() const noexcept
+    {
+        result_type r;
+
+        for( std::size_t i = 0; i < Lanes; ++i )
+        {
+            detail::write16le( r.data() + 2 * i, s_[ i ] );
+        }
+
+        return r;
+    }
+
+    friend bool operator==( lthash const& x, lthash const& y ) noexcept
+    {
+        return std::memcmp( x.s_, y.s_, sizeof( x.s_ ) ) == 0;
+    }
+
+    friend bool operator!=( lthash const& x, lthash const& y ) noexcept
+    {
+        return !( x == y );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, std::size_t Lanes, class Flavor> constexpr std::size_t lthash<H, Lanes, Flavor>::N;
+template<class H, std::size_t Lanes, class Flavor> constexpr std::size_t lthash<H, Lanes, Flavor>::lanes;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_LTHASH_HPP_INCLUDED
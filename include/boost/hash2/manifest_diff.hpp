@@ -0,0 +1,614 @@
+#ifndef BOOST_HASH2_MANIFEST_DIFF_HPP_INCLUDED
+#define BOOST_HASH2_MANIFEST_DIFF_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// manifest<N>, the (path, digest<N>) entries of a manifest in the format
+// that sha256sum prints, sorted by radix partitioning; and manifest_diff,
+// which merges two sorted manifests into the paths added, removed and
+// changed between them
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the minimum number of bytes of text, and of entries, per task
+
+constexpr std::size_t manifest_min_text = 1024 * 1024;
+constexpr std::size_t manifest_min_entries = 65536;
+
+// the average number of entries per radix partition; the partitions are
+// then sorted in the cache
+
+constexpr std::size_t manifest_partition_size = 512;
+
+template<std::size_t N> struct manifest_entry
+{
+    // xxh3_64 of the path
+    std::uint64_t key;
+
+    std::size_t offset;
+    std::size_t size;
+
+    digest<N> value;
+};
+
+inline std::uint64_t manifest_key( char const* p, std::size_t n ) noexcept
+{
+    xxh3_64 h;
+    h.update( p, n );
+
+    return h.result();
+}
+
+// parses the lines in [first, last), which ends at the end of a line or
+// of the text, appending the entries to v and their paths to paths;
+// returns the number of malformed lines
+
+template<std::size_t N> std::size_t manifest_parse( char const* first, char const* last, std::vector< manifest_entry<N> >& v, std::string& paths )
+{
+    std::size_t malformed = 0;
+
+    char const* p = first;
+
+    while( p != last )
+    {
+        char const* q = p;
+        char const* e = static_cast<char const*>( std::memchr( p, '\n', last - p ) );
+
+        if( e == 0 )
+        {
+            p = e = last;
+        }
+        else
+        {
+            p = e + 1;
+        }
+
+        if( e != q && e[ -1 ] == '\r' ) --e;
+        if( q == e ) continue;
+
+        // `digest *path`, or `digest  path`
+
+        manifest_entry<N> x;
+
+        char const* r = from_chars( q, e, x.value );
+
+        if( r == 0 || e - r < 3 || r[ 0 ] != ' ' || ( r[ 1 ] != '*' && r[ 1 ] != ' ' ) )
+        {
+            ++malformed;
+            continue;
+        }
+
+        r += 2;
+
+        x.size = static_cast<std::size_t>( e - r );
+        x.offset = paths.size();
+        x.key = manifest_key( r, x.size );
+
+        paths.append( r, x.size );
+        v.push_back( x );
+    }
+
+    return malformed;
+}
+
+} // namespace detail
+
+// manifest<N>
+
+template<std::size_t N> class manifest
+{
+private:
+
+    using entry = detail::manifest_entry<N>;
+
+    std::vector<entry> entries_;
+    std::string paths_;
+
+    std::size_t malformed_;
+    bool sorted_;
+
+private:
+
+    bool entry_less( entry const& x, entry const& y ) const noexcept
+    {
+        if( x.key != y.key ) return x.key < y.key;
+
+        // the same hash; rare, unless a path occurs twice
+
+        int r = std::memcmp( paths_.data() + x.offset, paths_.data() + y.offset, x.size < y.size? x.size: y.size );
+        return r < 0 || ( r == 0 && x.size < y.size );
+    }
+
+public:
+
+    using digest_type = digest<N>;
+
+    manifest() noexcept: malformed_( 0 ), sorted_( true )
+    {
+    }
+
+    std::size_t size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return entries_.empty();
+    }
+
+    // the number of lines that have been skipped by parse and load,
+    // because they aren't of the form `digest *path` or `digest  path`
+
+    std::size_t malformed() const noexcept
+    {
+        return malformed_;
+    }
+
+    bool sorted() const noexcept
+    {
+        return sorted_;
+    }
+
+    std::string path( std::size_t i ) const
+    {
+        BOOST_ASSERT( i < size() );
+        return paths_.substr( entries_[ i ].offset, entries_[ i ].size );
+    }
+
+    char const* path_data( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < size() );
+        return paths_.data() + entries_[ i ].offset;
+    }
+
+    std::size_t path_size( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < size() );
+        return entries_[ i ].size;
+    }
+
+    digest_type const& value( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < size() );
+        return entries_[ i ].value;
+    }
+
+    // the hash of the path of entry i, by which the entries are sorted
+
+    std::uint64_t key( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < size() );
+        return entries_[ i ].key;
+    }
+
+    void push_back( char const* p, std::size_t n, digest_type const& d )
+    {
+        entry x;
+
+        x.key = detail::manifest_key( p, n );
+        x.offset = paths_.size();
+        x.size = n;
+        x.value = d;
+
+        paths_.append( p, n );
+        entries_.push_back( x );
+
+        sorted_ = false;
+    }
+
+    void clear() noexcept
+    {
+        entries_.clear();
+        paths_.clear();
+
+        malformed_ = 0;
+        sorted_ = true;
+    }
+
+    // appends the entries of the manifest text [p, p + n), parsing it on
+    // ex; the digests are decoded with from_chars
+
+    void parse( char const* p, std::size_t n, task_executor& ex )
+    {
+        if( n == 0 ) return;
+
+        unsigned const parts = detail::parallel_parts( ex, n, detail::manifest_min_text );
+
+        // the parts end at the ends of lines
+
+        std::vector<char const*> bounds( parts + 1 );
+
+        bounds[ 0 ] = p;
+        bounds[ parts ] = p + n;
+
+        for( unsigned t = 1; t < parts; ++t )
+        {
+            char const* q = p + n / parts * t;
+
+            if( q < bounds[ t - 1 ] ) q = bounds[ t - 1 ];
+
+            char const* e = static_cast<char const*>( std::memchr( q, '\n', p + n - q ) );
+            bounds[ t ] = e? e + 1: p + n;
+        }
+
+        std::vector< std::vector<entry> > ve( parts );
+        std::vector<std::string> vp( parts );
+        std::vector<std::size_t> vm( parts );
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+            vm[ t ] = detail::manifest_parse<N>( bounds[ t ], bounds[ t + 1 ], ve[ t ], vp[ t ] );
+        });
+
+        // concatenate the parts
+
+        std::vector<std::size_t> eo( parts + 1 ), po( parts + 1 );
+
+        eo[ 0 ] = entries_.size();
+        po[ 0 ] = paths_.size();
+
+        for( unsigned t = 0; t < parts; ++t )
+        {
+            eo[ t + 1 ] = eo[ t ] + ve[ t ].size();
+            po[ t + 1 ] = po[ t ] + vp[ t ].size();
+
+            malformed_ += vm[ t ];
+        }
+
+        if( eo[ parts ] == eo[ 0 ] ) return;
+
+        entries_.resize( eo[ parts ] );
+        paths_.resize( po[ parts ] );
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+            entry* q = entries_.data() + eo[ t ];
+
+            for( entry const& x: ve[ t ] )
+            {
+                *q = x;
+                q->offset += po[ t ];
+
+                ++q;
+            }
+
+            if( !vp[ t ].empty() )
+            {
+                std::memcpy( &paths_[ po[ t ] ], vp[ t ].data(), vp[ t ].size() );
+            }
+
+            std::vector<entry>().swap( ve[ t ] );
+            std::string().swap( vp[ t ] );
+        });
+
+        sorted_ = false;
+    }
+
+    // same, on up to threads threads; threads == 0 means
+    // std::thread::hardware_concurrency()
+
+    void parse( char const* p, std::size_t n, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        parse( p, n, ex );
+    }
+
+    // reads the manifest file path, and parses it as above
+
+    void load( char const* path, std::error_code& ec, task_executor& ex )
+    {
+        ec.clear();
+
+        std::FILE* f = std::fopen( path, "rb" );
+
+        if( f == 0 )
+        {
+            ec.assign( errno, std::generic_category() );
+            return;
+        }
+
+        std::vector<char> s;
+
+        std::size_t const M = 1024 * 1024;
+        std::size_t n = 0;
+
+        for( ;; )
+        {
+            s.resize( n + M );
+
+            std::size_t r = std::fread( s.data() + n, 1, M, f );
+            n += r;
+
+            if( r < M ) break;
+        }
+
+        bool const failed = std::ferror( f ) != 0;
+        int const e = errno;
+
+        std::fclose( f );
+
+        if( failed )
+        {
+            ec.assign( e, std::generic_category() );
+            return;
+        }
+
+        parse( s.data(), n, ex );
+    }
+
+    void load( char const* path, std::error_code& ec, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        load( path, ec, ex );
+    }
+
+    // sorts the entries by the hash of their path, then by their path, on
+    // ex. The entries are radix partitioned by the high bits of the hash
+    // in one pass, as hash_partition does, and the partitions, small
+    // enough to stay in the cache, are then sorted in parallel
+
+    void sort( task_executor& ex )
+    {
+        if( sorted_ ) return;
+
+        std::size_t const n = entries_.size();
+
+        unsigned bits = 0;
+
+        while( bits < 16 && ( n >> bits ) > detail::manifest_partition_size )
+        {
+            ++bits;
+        }
+
+        std::size_t const nparts = std::size_t( 1 ) << bits;
+        unsigned const shift = 64 - bits;
+
+        auto part = [&]( entry const& x ) -> std::size_t {
+
+            return bits == 0? 0: static_cast<std::size_t>( x.key >> shift );
+        };
+
+        std::size_t const tasks = detail::parallel_parts( ex, n, detail::manifest_min_entries );
+
+        std::vector<std::size_t> hist( tasks * nparts );
+
+        hash2::bulk_execute( ex, tasks, [&]( std::size_t t ){
+
+            std::size_t const i = n * t / tasks;
+            std::size_t const j = n * ( t + 1 ) / tasks;
+
+            std::size_t* h = hist.data() + t * nparts;
+
+            for( std::size_t k = i; k < j; ++k )
+            {
+                ++h[ part( entries_[ k ] ) ];
+            }
+        });
+
+        std::vector<std::size_t> offsets( nparts + 1 );
+
+        std::size_t s = 0;
+
+        for( std::size_t p = 0; p < nparts; ++p )
+        {
+            offsets[ p ] = s;
+
+            for( std::size_t t = 0; t < tasks; ++t )
+            {
+                std::size_t const c = hist[ t * nparts + p ];
+
+                hist[ t * nparts + p ] = s;
+                s += c;
+            }
+        }
+
+        offsets[ nparts ] = s;
+
+        std::vector<entry> v( n );
+
+        hash2::bulk_execute( ex, tasks, [&]( std::size_t t ){
+
+            std::size_t const i = n * t / tasks;
+            std::size_t const j = n * ( t + 1 ) / tasks;
+
+            std::size_t* pos = hist.data() + t * nparts;
+
+            for( std::size_t k = i; k < j; ++k )
+            {
+                v[ pos[ part( entries_[ k ] ) ]++ ] = entries_[ k ];
+            }
+        });
+
+        std::size_t const sort_tasks = detail::parallel_parts( ex, nparts, 1 );
+
+        hash2::bulk_execute( ex, sort_tasks, [&]( std::size_t t ){
+
+            std::size_t const p1 = nparts * t / sort_tasks;
+            std::size_t const p2 = nparts * ( t + 1 ) / sort_tasks;
+
+            for( std::size_t p = p1; p < p2; ++p )
+            {
+                std::sort( v.begin() + offsets[ p ], v.begin() + offsets[ p + 1 ], [this]( entry const& x, entry const& y ){ return entry_less( x, y ); } );
+            }
+        });
+
+        entries_.swap( v );
+        sorted_ = true;
+    }
+
+    void sort( unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        sort( ex );
+    }
+
+    // the position of the first entry whose key isn't less than k;
+    // requires sorted()
+
+    std::size_t lower_bound( std::uint64_t k ) const noexcept
+    {
+        BOOST_ASSERT( sorted_ );
+
+        return static_cast<std::size_t>( std::lower_bound( entries_.begin(), entries_.end(), k, []( entry const& x, std::uint64_t k ){ return x.key < k; } ) - entries_.begin() );
+    }
+
+    // compares entry i with entry j of m, by key and path
+
+    int compare( std::size_t i, manifest const& m, std::size_t j ) const noexcept
+    {
+        entry const& x = entries_[ i ];
+        entry const& y = m.entries_[ j ];
+
+        if( x.key != y.key ) return x.key < y.key? -1: +1;
+
+        int r = std::memcmp( paths_.data() + x.offset, m.paths_.data() + y.offset, x.size < y.size? x.size: y.size );
+
+        if( r != 0 ) return r;
+        if( x.size != y.size ) return x.size < y.size? -1: +1;
+
+        return 0;
+    }
+};
+
+// manifest_difference, the result of manifest_diff( a, b ), as positions
+// of the entries in a and b, in their sorted order
+
+struct manifest_difference
+{
+    // the entries of b whose path isn't in a
+    std::vector<std::size_t> added;
+
+    // the entries of a whose path isn't in b
+    std::vector<std::size_t> removed;
+
+    // the entries of a and b with the same path and different digests
+    std::vector< std::pair<std::size_t, std::size_t> > changed;
+};
+
+namespace detail
+{
+
+template<std::size_t N> void manifest_merge( manifest<N> const& a, std::size_t i, std::size_t i2, manifest<N> const& b, std::size_t j, std::size_t j2, manifest_difference& r )
+{
+    while( i < i2 && j < j2 )
+    {
+        // in manifests of the same tree, most entries are equal; these
+        // are skipped comparing the keys and digests only
+
+        if( a.key( i ) == b.key( j ) && a.path_size( i ) == b.path_size( j ) && std::memcmp( a.value( i ).data(), b.value( j ).data(), N ) == 0 && std::memcmp( a.path_data( i ), b.path_data( j ), a.path_size( i ) ) == 0 )
+        {
+            ++i;
+            ++j;
+
+            continue;
+        }
+
+        int const c = a.compare( i, b, j );
+
+        if( c < 0 )
+        {
+            r.removed.push_back( i++ );
+        }
+        else if( c > 0 )
+        {
+            r.added.push_back( j++ );
+        }
+        else
+        {
+            r.changed.push_back( std::make_pair( i++, j++ ) );
+        }
+    }
+
+    for( ; i < i2; ++i ) r.removed.push_back( i );
+    for( ; j < j2; ++j ) r.added.push_back( j );
+}
+
+} // namespace detail
+
+// manifest_diff, merges the sorted manifests a and b on ex, splitting the
+// range of keys into as many parts as there are tasks. A path that occurs
+// k times in a and m times in b is reported as min(k, m) entries present
+// in both
+
+template<std::size_t N> manifest_difference manifest_diff( manifest<N> const& a, manifest<N> const& b, task_executor& ex )
+{
+    BOOST_ASSERT( a.sorted() && b.sorted() );
+
+    std::size_t const n = a.size() + b.size();
+
+    unsigned const parts = detail::parallel_parts( ex, n, detail::manifest_min_entries );
+
+    std::vector<std::size_t> ia( parts + 1 ), ib( parts + 1 );
+
+    ia[ 0 ] = ib[ 0 ] = 0;
+
+    ia[ parts ] = a.size();
+    ib[ parts ] = b.size();
+
+    for( unsigned t = 1; t < parts; ++t )
+    {
+        std::uint64_t const k = ~std::uint64_t( 0 ) / parts * t;
+
+        ia[ t ] = a.lower_bound( k );
+        ib[ t ] = b.lower_bound( k );
+    }
+
+    std::vector<manifest_difference> rs( parts );
+
+    hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+        detail::manifest_merge( a, ia[ t ], ia[ t + 1 ], b, ib[ t ], ib[ t + 1 ], rs[ t ] );
+    });
+
+    if( parts == 1 ) return std::move( rs[ 0 ] );
+
+    manifest_difference r;
+
+    for( manifest_difference const& x: rs )
+    {
+        r.added.insert( r.added.end(), x.added.begin(), x.added.end() );
+        r.removed.insert( r.removed.end(), x.removed.begin(), x.removed.end() );
+        r.changed.insert( r.changed.end(), x.changed.begin(), x.changed.end() );
+    }
+
+    return r;
+}
+
+// same, on up to threads threads; threads == 0 means
+// std::thread::hardware_concurrency()
+
+template<std::size_t N> manifest_difference manifest_diff( manifest<N> const& a, manifest<N> const& b, unsigned threads = 0 )
+{
+    thread_executor ex( threads );
+    return manifest_diff( a, b, ex );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MANIFEST_DIFF_HPP_INCLUDED
@@ -0,0 +1,540 @@
+#ifndef BOOST_HASH2_MAPPED_DIGEST_INDEX_HPP_INCLUDED
+#define BOOST_HASH2_MAPPED_DIGEST_INDEX_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// mapped_digest_index, an open addressing table keyed by digest<N>, kept
+// in a memory mapped file, so that several processes can share it; one
+// writer, and any number of readers that don't take locks
+
+#include <boost/hash2/concurrent_digest_map.hpp>
+#include <boost/hash2/hash_file.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/prefetch.hpp>
+#include <boost/config.hpp>
+#include <atomic>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+# include <sys/file.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the file is a header of this size, followed by the groups:
+//
+//   magic: 16 bytes
+//   byte order mark, key size, value size, group count: 8 bytes each,
+//     little endian, except for the mark, which is native
+//   size: 8 bytes at offset 64, an atomic counter, native
+//
+// a group is 16 one byte fingerprints, 0 for an empty slot, in two
+// atomic words, native, followed by 16 slots of key and value
+
+std::size_t const mapped_index_header_size = 4096;
+
+char const mapped_index_magic[ 16 ] = { 'b', 'o', 'o', 's', 't', '.', 'h', 'a', 's', 'h', '2', '.', 'm', 'i', '0', '1' };
+
+std::uint64_t const mapped_index_bom = 0x0102030405060708ull;
+
+} // namespace detail
+
+// mapped_digest_index<N, T>
+//
+// the entries are laid out as in concurrent_digest_map, in a single
+// shard: the digest bits are the hash, the low byte is the fingerprint,
+// and the rest select the first group of the probe sequence
+//
+// the writer copies the key and the value into an empty slot before it
+// publishes the fingerprint with a release store, and entries are never
+// removed or modified, so that the readers, in this process or others,
+// need no locks; a file lock keeps out a second writer
+
+template<std::size_t N, class T> class mapped_digest_index
+{
+private:
+
+    static_assert( N >= 8, "mapped_digest_index requires a digest of at least 8 bytes" );
+    static_assert( std::is_trivially_copyable<T>::value, "The values of a mapped_digest_index must be trivially copyable" );
+
+    static constexpr std::size_t G = 16;
+
+    struct entry
+    {
+        digest<N> key;
+        T value;
+    };
+
+    struct group
+    {
+        std::atomic<std::uint64_t> fp[ 2 ];
+        alignas( entry ) unsigned char slots[ G ][ sizeof( entry ) ];
+
+        entry* slot( std::size_t i ) noexcept
+        {
+            return static_cast<entry*>( static_cast<void*>( slots[ i ] ) );
+        }
+    };
+
+    static_assert( sizeof( std::atomic<std::uint64_t> ) == 8 && ATOMIC_LLONG_LOCK_FREE == 2, "mapped_digest_index requires lock-free 64 bit atomics" );
+
+    int fd_;
+    bool writable_;
+
+    unsigned char* map_;
+    std::size_t map_size_;
+
+    group* groups_;
+    std::size_t mask_;
+    std::size_t limit_;
+
+    std::atomic<std::uint64_t>* size_;
+
+private:
+
+    static std::uint64_t hash( digest<N> const& k ) noexcept
+    {
+        return detail::read64le( k.data() );
+    }
+
+    static unsigned char fingerprint( std::uint64_t h ) noexcept
+    {
+        unsigned char r = static_cast<unsigned char>( h );
+        return r + ( r == 0 );
+    }
+
+    static std::size_t group_count( std::size_t capacity ) noexcept
+    {
+        // keep the load below 7/8
+
+        std::size_t n = ( ( capacity + G ) / 7 * 8 + G - 1 ) / G;
+
+        std::size_t r = 1;
+        while( r < n ) r *= 2;
+
+        return r;
+    }
+
+    static std::size_t file_size( std::size_t groups ) noexcept
+    {
+        return detail::mapped_index_header_size + groups * sizeof( group );
+    }
+
+    // as concurrent_digest_map::probe
+
+    entry* probe( digest<N> const& k, std::uint64_t h, group*& eg, unsigned& ei ) const noexcept
+    {
+        unsigned char const fp = fingerprint( h );
+
+        std::size_t g = static_cast<std::size_t>( h >> 8 ) & mask_;
+
+        for( std::size_t i = 0; i <= mask_; ++i )
+        {
+            group& gr = groups_[ g ];
+
+            for( unsigned w = 0; w < 2; ++w )
+            {
+                std::uint64_t x = gr.fp[ w ].load( std::memory_order_acquire );
+
+                for( std::uint64_t m = detail::match_bytes( x, fp ); m != 0; m &= m - 1 )
+                {
+                    entry* p = gr.slot( w * 8 + detail::lowest_byte( m ) );
+
+                    if( digest_equal()( p->key, k ) ) return p;
+                }
+
+                std::uint64_t e = detail::match_bytes( x, 0 );
+
+                if( e != 0 )
+                {
+                    eg = &gr;
+                    ei = w * 8 + detail::lowest_byte( e );
+
+                    return nullptr;
+                }
+            }
+
+            g = ( g + i + 1 ) & mask_;
+        }
+
+        eg = nullptr;
+        return nullptr;
+    }
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+    // maps the file fd, which has been created or validated, and takes
+    // ownership of it
+
+    void map( detail::file_descriptor& fd, std::size_t size, bool writable, std::error_code& ec )
+    {
+        void* p = ::mmap( 0, size, writable? PROT_READ | PROT_WRITE: PROT_READ, MAP_SHARED, fd.get(), 0 );
+
+        if( p == MAP_FAILED )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        // lookups are scattered over the table
+
+        ::madvise( p, size, MADV_RANDOM );
+
+        map_ = static_cast<unsigned char*>( p );
+        map_size_ = size;
+
+        std::size_t const n = static_cast<std::size_t>( detail::read64le( map_ + 40 ) );
+
+        groups_ = static_cast<group*>( static_cast<void*>( map_ + detail::mapped_index_header_size ) );
+        mask_ = n - 1;
+        limit_ = n * G / 8 * 7;
+
+        size_ = static_cast<std::atomic<std::uint64_t>*>( static_cast<void*>( map_ + 64 ) );
+
+        fd_ = fd.release();
+        writable_ = writable;
+    }
+
+    // opens the file path, checks its header, and locks it for writing,
+    // if writable
+
+    void open_( char const* path, bool writable, std::error_code& ec )
+    {
+        int fd = ::open( path, ( writable? O_RDWR: O_RDONLY ) | O_CLOEXEC );
+
+        if( fd < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        detail::file_descriptor guard( fd );
+
+        if( writable && ::flock( fd, LOCK_EX | LOCK_NB ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        unsigned char header[ 48 ];
+
+        if( ::pread( fd, header, sizeof( header ), 0 ) != static_cast<::ssize_t>( sizeof( header ) ) )
+        {
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        std::uint64_t bom;
+        std::memcpy( &bom, header + 16, 8 );
+
+        std::uint64_t const n = detail::read64le( header + 40 );
+
+        if( std::memcmp( header, detail::mapped_index_magic, sizeof( detail::mapped_index_magic ) ) != 0 || bom != detail::mapped_index_bom ||
+            detail::read64le( header + 24 ) != N || detail::read64le( header + 32 ) != sizeof( T ) ||
+            n == 0 || ( n & ( n - 1 ) ) != 0 || n > ( SIZE_MAX - detail::mapped_index_header_size ) / sizeof( group ) )
+        {
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        struct ::stat st;
+
+        if( ::fstat( fd, &st ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        std::size_t const size = file_size( static_cast<std::size_t>( n ) );
+
+        if( static_cast<std::uint64_t>( st.st_size ) != size )
+        {
+            ec = std::make_error_code( std::errc::invalid_argument );
+            return;
+        }
+
+        map( guard, size, writable, ec );
+    }
+
+#endif
+
+public:
+
+    using key_type = digest<N>;
+    using mapped_type = T;
+
+    mapped_digest_index() noexcept: fd_( -1 ), writable_( false ), map_( 0 ), map_size_( 0 ), groups_( 0 ), mask_( 0 ), limit_( 0 ), size_( 0 )
+    {
+    }
+
+    mapped_digest_index( mapped_digest_index const& ) = delete;
+    mapped_digest_index& operator=( mapped_digest_index const& ) = delete;
+
+    ~mapped_digest_index()
+    {
+        close();
+    }
+
+    // creates the file path, which must not exist, holding an empty index
+    // for capacity entries, and opens it for writing
+
+    void create( char const* path, std::size_t capacity, std::error_code& ec )
+    {
+        ec.clear();
+        close();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        std::size_t const n = group_count( capacity );
+
+        if( n > ( SIZE_MAX - detail::mapped_index_header_size ) / sizeof( group ) )
+        {
+            ec = std::make_error_code( std::errc::value_too_large );
+            return;
+        }
+
+        int fd = ::open( path, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644 );
+
+        if( fd < 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            return;
+        }
+
+        detail::file_descriptor guard( fd );
+
+        if( ::flock( fd, LOCK_EX | LOCK_NB ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            ::unlink( path );
+            return;
+        }
+
+        // the groups are zero filled, that is, empty
+
+        std::size_t const size = file_size( n );
+
+        if( ::ftruncate( fd, static_cast<::off_t>( size ) ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+            ::unlink( path );
+            return;
+        }
+
+        unsigned char header[ 48 ] = {};
+
+        std::memcpy( header, detail::mapped_index_magic, sizeof( detail::mapped_index_magic ) );
+        std::memcpy( header + 16, &detail::mapped_index_bom, 8 );
+
+        detail::write64le( header + 24, N );
+        detail::write64le( header + 32, sizeof( T ) );
+        detail::write64le( header + 40, n );
+
+        if( ::pwrite( fd, header, sizeof( header ), 0 ) != static_cast<::ssize_t>( sizeof( header ) ) )
+        {
+            ec.assign( errno, std::system_category() );
+            ::unlink( path );
+            return;
+        }
+
+        map( guard, size, true, ec );
+
+        if( ec ) ::unlink( path );
+
+#else
+
+        (void)path;
+        (void)capacity;
+
+        ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+    }
+
+    // opens the index in the file path for reading
+
+    void open( char const* path, std::error_code& ec )
+    {
+        ec.clear();
+        close();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        open_( path, false, ec );
+
+#else
+
+        (void)path;
+        ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+    }
+
+    // opens the index in the file path for writing; fails if another
+    // writer has it open
+
+    void open_writable( char const* path, std::error_code& ec )
+    {
+        ec.clear();
+        close();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        open_( path, true, ec );
+
+#else
+
+        (void)path;
+        ec = std::make_error_code( std::errc::function_not_supported );
+
+#endif
+    }
+
+    void close() noexcept
+    {
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        if( map_ ) ::munmap( map_, map_size_ );
+        if( fd_ >= 0 ) ::close( fd_ );
+
+#endif
+
+        fd_ = -1;
+        writable_ = false;
+
+        map_ = 0;
+        map_size_ = 0;
+
+        groups_ = 0;
+        mask_ = 0;
+        limit_ = 0;
+
+        size_ = 0;
+    }
+
+    bool is_open() const noexcept
+    {
+        return map_ != 0;
+    }
+
+    bool is_writable() const noexcept
+    {
+        return writable_;
+    }
+
+    // writes the index to the file, for durability; the readers see the
+    // entries as soon as they are inserted
+
+    void flush( std::error_code& ec )
+    {
+        ec.clear();
+
+#if defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+        if( map_ && ::msync( map_, map_size_, MS_SYNC ) != 0 )
+        {
+            ec.assign( errno, std::system_category() );
+        }
+
+#endif
+    }
+
+    // the number of entries that can be inserted
+
+    std::size_t capacity() const noexcept
+    {
+        return limit_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return size_? static_cast<std::size_t>( size_->load( std::memory_order_acquire ) ): 0;
+    }
+
+    // lock-free; the returned pointer remains valid until the index is
+    // closed
+
+    T const* find( digest<N> const& k ) const noexcept
+    {
+        if( map_ == 0 ) return nullptr;
+
+        group* eg;
+        unsigned ei;
+
+        entry const* p = probe( k, hash( k ), eg, ei );
+        return p? &p->value: nullptr;
+    }
+
+    bool contains( digest<N> const& k ) const noexcept
+    {
+        return find( k ) != nullptr;
+    }
+
+    void prefetch( digest<N> const& k ) const noexcept
+    {
+        if( map_ == 0 ) return;
+
+        detail::prefetch( &groups_[ static_cast<std::size_t>( hash( k ) >> 8 ) & mask_ ] );
+    }
+
+    // inserts v for k, unless k is present; the second member is true if
+    // it has been inserted, and the first is nullptr if k is not present
+    // and the index is full, or isn't open for writing
+    //
+    // unlike find, insert must not be called concurrently
+
+    std::pair<T const*, bool> insert( digest<N> const& k, T const& v ) noexcept
+    {
+        if( !writable_ ) return { nullptr, false };
+
+        std::uint64_t h = hash( k );
+
+        group* eg;
+        unsigned ei;
+
+        if( entry* p = probe( k, h, eg, ei ) )
+        {
+            return { &p->value, false };
+        }
+
+        std::uint64_t const n = size_->load( std::memory_order_relaxed );
+
+        if( eg == nullptr || n >= limit_ )
+        {
+            return { nullptr, false };
+        }
+
+        entry* p = eg->slot( ei );
+
+        std::memcpy( static_cast<void*>( &p->key ), &k, sizeof( k ) );
+        std::memcpy( static_cast<void*>( &p->value ), &v, sizeof( v ) );
+
+        std::atomic<std::uint64_t>& x = eg->fp[ ei / 8 ];
+        x.store( x.load( std::memory_order_relaxed ) | std::uint64_t( fingerprint( h ) ) << ( ei % 8 * 8 ), std::memory_order_release );
+
+        size_->store( n + 1, std::memory_order_release );
+
+        return { &p->value, true };
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MAPPED_DIGEST_INDEX_HPP_INCLUDED
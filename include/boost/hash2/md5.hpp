@@ -9,12 +9,19 @@
 
 #include <boost/hash2/digest.hpp>
 #include <boost/hash2/hmac.hpp>
+#include <boost/hash2/endian.hpp>
 #include <boost/hash2/detail/read.hpp>
 #include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/hash2/detail/memcpy.hpp>
 #include <boost/hash2/detail/memset.hpp>
 #include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/multi_buffer.hpp>
+#include <boost/hash2/detail/md5_x86.hpp>
+#include <boost/hash2/detail/stats.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
@@ -27,10 +34,19 @@ namespace boost
 namespace hash2
 {
 
+namespace detail
+{
+
+struct md5_128_lanes;
+
+} // namespace detail
+
 class md5_128
 {
 private:
 
+    friend struct detail::md5_128_lanes;
+
     std::uint32_t state_[ 4 ] = { 0x67452301u, 0xefcdab89u, 0x98badcfeu, 0x10325476u };
 
     static constexpr int N = 64;
@@ -107,12 +123,22 @@ private:
     static constexpr int S43 = 15;
     static constexpr int S44 = 21;
 
-    BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ] )
+    static BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ], std::uint32_t state[ 4 ] )
     {
-        std::uint32_t a = state_[ 0 ];
-        std::uint32_t b = state_[ 1 ];
-        std::uint32_t c = state_[ 2 ];
-        std::uint32_t d = state_[ 3 ];
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_avx512vl() )
+        {
+            detail::md5_transform_avx512vl( block, state );
+            return;
+        }
+
+#endif
+
+        std::uint32_t a = state[ 0 ];
+        std::uint32_t b = state[ 1 ];
+        std::uint32_t c = state[ 2 ];
+        std::uint32_t d = state[ 3 ];
 
         std::uint32_t x[ 16 ] = {};
 
@@ -189,10 +215,15 @@ private:
         II( c, d, a, b, x[ 2], S43, 0x2ad7d2bb );
         II( b, c, d, a, x[ 9], S44, 0xeb86d391 );
 
-        state_[ 0 ] += a;
-        state_[ 1 ] += b;
-        state_[ 2 ] += c;
-        state_[ 3 ] += d;
+        state[ 0 ] += a;
+        state[ 1 ] += b;
+        state[ 2 ] += c;
+        state[ 3 ] += d;
+    }
+
+    BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ] )
+    {
+        transform( block, state_ );
     }
 
 public:
@@ -210,8 +241,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -219,13 +252,17 @@ public:
     {
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
+        BOOST_HASH2_STATS_UPDATE( md5_128, "md5_128", n );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         if( n == 0 ) return;
@@ -286,6 +323,8 @@ public:
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( md5_128, "md5_128" );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         unsigned char bits[ 8 ] = {};
@@ -296,10 +335,14 @@ public:
 
         unsigned char padding[ 64 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
+
         update( padding, k );
 
         update( bits, 8 );
 
+        BOOST_HASH2_STATS_RESUME();
+
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest = {{}};
@@ -311,10 +354,167 @@ public:
 
         return digest;
     }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint32_t st[ 4 ] = { state_[ 0 ], state_[ 1 ], state_[ 2 ], state_[ 3 ] };
+
+        unsigned char block[ N ] = {};
+
+        detail::memcpy( block, buffer_, m_ );
+        block[ m_ ] = 0x80;
+
+        if( m_ >= 56 )
+        {
+            transform( block, st );
+            detail::memset( block, 0, N );
+        }
+
+        detail::write64le( block + 56, n_ * 8 );
+        transform( block, st );
+
+        result_type digest = {{}};
+
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write32le( digest.data() + i * 4, st[ i ] );
+        }
+
+        return digest;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 16 + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        md5_128 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        tmp.m_ = static_cast<std::size_t>( tmp.n_ % N );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
 };
 
 using hmac_md5_128 = hmac<md5_128>;
 
+// multi-buffer variant
+
+namespace detail
+{
+
+struct md5_128_lanes
+{
+    using word_type = std::uint32_t;
+
+    static constexpr int state_words = 4;
+    static constexpr int block_size = 64;
+    static constexpr int digest_size = 16;
+    static constexpr int length_size = 8;
+    static constexpr endian byte_order = endian::little;
+
+    static void init( std::uint32_t state[ 4 ] )
+    {
+        std::uint32_t const iv[ 4 ] = { 0x67452301u, 0xefcdab89u, 0x98badcfeu, 0x10325476u };
+        std::memcpy( state, iv, sizeof( iv ) );
+    }
+
+    static void transform( unsigned char const block[ 64 ], std::uint32_t state[ 4 ] )
+    {
+        md5_128::transform( block, state );
+    }
+
+    static std::size_t transform_lanes( unsigned char const* const block[], std::uint32_t* state, std::size_t n, std::size_t stride )
+    {
+        std::size_t j = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( detail::has_x86_avx512f() )
+        {
+            for( ; j + 16 <= n; j += 16 )
+            {
+                detail::md5_transform_avx512( block + j, state + j, stride );
+            }
+        }
+
+        if( detail::has_x86_avx2() )
+        {
+            for( ; j + 8 <= n; j += 8 )
+            {
+                detail::md5_transform_avx2( block + j, state + j, stride );
+            }
+        }
+
+#else
+
+        (void)block;
+        (void)state;
+        (void)n;
+        (void)stride;
+
+#endif
+
+        return j;
+    }
+};
+
+} // namespace detail
+
+// md5_128_multi<N>
+//
+// N independent computations over messages of equal length,
+// interleaved so that they can be processed in SIMD lanes
+
+template<std::size_t N> class md5_128_multi: public detail::multi_buffer<detail::md5_128_lanes, N>
+{
+public:
+
+    using detail::multi_buffer<detail::md5_128_lanes, N>::multi_buffer;
+};
+
+namespace detail
+{
+
+template<> struct multi_lane<md5_128>
+{
+    static constexpr bool value = true;
+    template<std::size_t N> using type = md5_128_multi<N>;
+};
+
+} // namespace detail
+
 } // namespace hash2
 } // namespace boost
 
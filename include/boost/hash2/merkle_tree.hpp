@@ -0,0 +1,307 @@
+#ifndef BOOST_HASH2_MERKLE_TREE_HPP_INCLUDED
+#define BOOST_HASH2_MERKLE_TREE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/numa.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// merkle_tree<H>, a binary hash tree over the fixed size blocks of a data
+// set, with the leaf and interior node hashes of RFC 6962:
+//
+//   leaf = H( 0x00 || block )
+//   node = H( 0x01 || left || right )
+//
+// a node without a sibling is promoted to the next level unchanged, which
+// gives the same root as the RFC 6962 definition
+//
+// the levels are stored in one array, the leaves first and the root last
+
+template<class H> class merkle_tree
+{
+public:
+
+    using hash_type = H;
+    using digest_type = typename H::result_type;
+
+private:
+
+    std::size_t block_size_;
+
+    std::vector<digest_type> nodes_;
+
+    // offset_[ k ] is the index of the first node of level k in nodes_;
+    // level k has offset_[ k + 1 ] - offset_[ k ] nodes
+
+    std::vector<std::size_t> offset_;
+
+private:
+
+    static digest_type hash_node( digest_type const& l, digest_type const& r )
+    {
+        unsigned char const prefix = 0x01;
+
+        H h;
+
+        h.update( &prefix, 1 );
+        h.update( l.data(), l.size() );
+        h.update( r.data(), r.size() );
+
+        return h.result();
+    }
+
+    std::size_t level_size( std::size_t k ) const noexcept
+    {
+        return offset_[ k + 1 ] - offset_[ k ];
+    }
+
+    // the node j of level k + 1, from its children
+
+    void compute_node( std::size_t k, std::size_t j )
+    {
+        std::size_t const n = level_size( k );
+        digest_type const* p = nodes_.data() + offset_[ k ];
+
+        if( 2 * j + 1 < n )
+        {
+            nodes_[ offset_[ k + 1 ] + j ] = hash_node( p[ 2 * j ], p[ 2 * j + 1 ] );
+        }
+        else
+        {
+            nodes_[ offset_[ k + 1 ] + j ] = p[ 2 * j ];
+        }
+    }
+
+    // lays out the levels for n leaves
+
+    void init_levels( std::size_t n )
+    {
+        offset_.clear();
+
+        std::size_t m = 0;
+
+        offset_.push_back( m );
+
+        for( ;; )
+        {
+            m += n;
+            offset_.push_back( m );
+
+            if( n <= 1 ) break;
+
+            n = ( n + 1 ) / 2;
+        }
+
+        nodes_.resize( m );
+    }
+
+    void build_interior()
+    {
+        for( std::size_t k = 0; k + 2 < offset_.size(); ++k )
+        {
+            std::size_t const m = level_size( k + 1 );
+
+            for( std::size_t j = 0; j < m; ++j )
+            {
+                compute_node( k, j );
+            }
+        }
+    }
+
+    void hash_leaves( unsigned char const* p, std::size_t n, std::size_t first, std::size_t last )
+    {
+        for( std::size_t i = first; i < last; ++i )
+        {
+            std::size_t const k = i * block_size_;
+            std::size_t const m = n - k < block_size_? n - k: block_size_;
+
+            nodes_[ i ] = hash_leaf( p + k, m );
+        }
+    }
+
+public:
+
+    explicit merkle_tree( std::size_t block_size = 1024 * 1024 ): block_size_( block_size )
+    {
+        BOOST_ASSERT( block_size > 0 );
+        init_levels( 0 );
+    }
+
+    std::size_t block_size() const noexcept
+    {
+        return block_size_;
+    }
+
+    std::size_t leaf_count() const noexcept
+    {
+        return level_size( 0 );
+    }
+
+    std::size_t level_count() const noexcept
+    {
+        return offset_.size() - 1;
+    }
+
+    // H( 0x00 || [p, p + n) )
+
+    static digest_type hash_leaf( void const* p, std::size_t n )
+    {
+        unsigned char const prefix = 0x00;
+
+        H h;
+
+        h.update( &prefix, 1 );
+        h.update( p, n );
+
+        return h.result();
+    }
+
+    // builds the tree over [p, p + n), hashing the blocks on up to
+    // threads threads; threads == 0 means std::thread::hardware_concurrency()
+
+    void build( void const* pv, std::size_t n, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        build( pv, n, ex );
+    }
+
+    // same, but hashes the blocks on ex
+
+    void build( void const* pv, std::size_t n, task_executor& ex )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        std::size_t const m = ( n + block_size_ - 1 ) / block_size_;
+
+        init_levels( m );
+
+        unsigned const parts = detail::parallel_parts( ex, m, 1 );
+
+        std::size_t const k = m / parts;
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+            std::size_t const first = t * k;
+            std::size_t const last = t + 1 < parts? first + k: m;
+
+            detail::numa_bind_worker( p + first * block_size_ );
+            hash_leaves( p, n, first, last );
+        });
+
+        build_interior();
+    }
+
+    // builds the tree from precomputed leaf hashes, hash_leaf( block )
+
+    template<class It> void assign( It first, It last )
+    {
+        std::vector<digest_type> v( first, last );
+
+        init_levels( v.size() );
+        std::copy( v.begin(), v.end(), nodes_.begin() );
+
+        build_interior();
+    }
+
+    digest_type const& leaf( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < leaf_count() );
+        return nodes_[ i ];
+    }
+
+    // the root; for an empty tree, the hash of the empty input, as in RFC 6962
+
+    digest_type root() const
+    {
+        if( nodes_.empty() ) return H().result();
+        return nodes_.back();
+    }
+
+    // replaces the hash of leaf i and recomputes the nodes on its path to
+    // the root, O(log n)
+
+    void update_leaf( std::size_t i, digest_type const& d )
+    {
+        BOOST_ASSERT( i < leaf_count() );
+
+        nodes_[ i ] = d;
+
+        for( std::size_t k = 0; k + 2 < offset_.size(); ++k )
+        {
+            i /= 2;
+            compute_node( k, i );
+        }
+    }
+
+    void update_block( std::size_t i, void const* p, std::size_t n )
+    {
+        BOOST_ASSERT( n <= block_size_ );
+        update_leaf( i, hash_leaf( p, n ) );
+    }
+
+    // the audit path of leaf i, the siblings on its path to the root,
+    // bottom up; promoted nodes have no sibling and contribute nothing
+
+    std::vector<digest_type> proof( std::size_t i ) const
+    {
+        BOOST_ASSERT( i < leaf_count() );
+
+        std::vector<digest_type> r;
+
+        for( std::size_t k = 0; k + 2 < offset_.size(); ++k, i /= 2 )
+        {
+            std::size_t const j = i ^ 1;
+
+            if( j < level_size( k ) )
+            {
+                r.push_back( nodes_[ offset_[ k ] + j ] );
+            }
+        }
+
+        return r;
+    }
+
+    // checks that the leaf hash d, of leaf i of a tree with n leaves,
+    // together with the audit path proof, gives root
+
+    static bool verify( digest_type d, std::size_t i, std::size_t n, std::vector<digest_type> const& proof, digest_type const& root )
+    {
+        if( i >= n ) return false;
+
+        std::size_t k = 0;
+
+        for( ; n > 1; i /= 2, n = ( n + 1 ) / 2 )
+        {
+            if( ( i & 1 ) != 0 )
+            {
+                if( k == proof.size() ) return false;
+                d = hash_node( proof[ k++ ], d );
+            }
+            else if( i + 1 < n )
+            {
+                if( k == proof.size() ) return false;
+                d = hash_node( d, proof[ k++ ] );
+            }
+        }
+
+        return k == proof.size() && d == root;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MERKLE_TREE_HPP_INCLUDED
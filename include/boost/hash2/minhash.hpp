@@ -0,0 +1,213 @@
+#ifndef BOOST_HASH2_MINHASH_HPP_INCLUDED
+#define BOOST_HASH2_MINHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/minhash_x86.hpp>
+#include <boost/hash2/detail/minhash_arm.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the i-th derived hash value of the base hash value hi << 32 | lo
+//
+// lo * a + b, with a odd, is a permutation of lo; xoring in hi makes the
+// result depend on all the bits of the base hash value, and the final
+// mixing step (from Chris Wellons' hash prospector) breaks the linearity
+
+BOOST_FORCEINLINE std::uint32_t minhash_permute( std::uint32_t lo, std::uint32_t hi, std::uint32_t a, std::uint32_t b ) noexcept
+{
+    std::uint32_t x = ( lo * a + b ) ^ hi;
+
+    x ^= x >> 16;
+    x *= 0x7FEB352D;
+    x ^= x >> 15;
+
+    return x;
+}
+
+inline void minhash_update( std::uint32_t* s, std::uint32_t const* a, std::uint32_t const* b, std::size_t n, std::uint64_t h ) noexcept
+{
+    std::uint32_t lo = static_cast<std::uint32_t>( h );
+    std::uint32_t hi = static_cast<std::uint32_t>( h >> 32 );
+
+    std::size_t i = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    if( detail::has_x86_avx2() )
+    {
+        i = detail::minhash_update_avx2( s, a, b, n, lo, hi );
+    }
+    else if( detail::has_x86_sse41() )
+    {
+        i = detail::minhash_update_sse41( s, a, b, n, lo, hi );
+    }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+    i = detail::minhash_update_neon( s, a, b, n, lo, hi );
+
+#endif
+
+    for( ; i < n; ++i )
+    {
+        s[ i ] = std::min( s[ i ], detail::minhash_permute( lo, hi, a[ i ], b[ i ] ) );
+    }
+}
+
+} // namespace detail
+
+// minhash<H, K, Flavor>, MinHash signatures of K 32 bit values
+//
+// each element is hashed once; the K values are derived from its 64 bit
+// hash value by K fixed permutations, and the signature keeps the minimum
+// of each
+
+template<class H, std::size_t K = 128, class Flavor = default_flavor> class minhash
+{
+private:
+
+    static_assert( K > 0, "K must be positive" );
+
+    H h_;
+
+    std::uint32_t a_[ K ];
+    std::uint32_t b_[ K ];
+
+private:
+
+    void init() noexcept
+    {
+        // splitmix64
+
+        std::uint64_t x = 0;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            x += 0x9E3779B97F4A7C15ull;
+
+            std::uint64_t z = x;
+
+            z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+            z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+            z = z ^ ( z >> 31 );
+
+            a_[ i ] = static_cast<std::uint32_t>( z ) | 1;
+            b_[ i ] = static_cast<std::uint32_t>( z >> 32 );
+        }
+    }
+
+public:
+
+    using hash_type = H;
+    using signature_type = std::array<std::uint32_t, K>;
+
+    static constexpr std::size_t size = K;
+
+    minhash(): h_()
+    {
+        init();
+    }
+
+    explicit minhash( std::uint64_t seed ): h_( seed )
+    {
+        init();
+    }
+
+    minhash( unsigned char const* seed, std::size_t n ): h_( seed, n )
+    {
+        init();
+    }
+
+    // the signature of the empty set
+
+    static signature_type empty_signature() noexcept
+    {
+        signature_type s;
+        s.fill( 0xFFFFFFFFu );
+
+        return s;
+    }
+
+    template<class T> void update( signature_type& s, T const& v ) const
+    {
+        detail::minhash_update( s.data(), a_, b_, K, detail::hash_value64<H, Flavor>( h_, v ) );
+    }
+
+    template<class It> signature_type signature( It first, It last ) const
+    {
+        signature_type s = empty_signature();
+
+        for( ; first != last; ++first )
+        {
+            update( s, *first );
+        }
+
+        return s;
+    }
+
+    template<class R> signature_type signature( R const& r ) const
+    {
+        using std::begin;
+        using std::end;
+
+        return signature( begin( r ), end( r ) );
+    }
+
+    // an estimate of the Jaccard similarity of the two sets
+
+    static double similarity( signature_type const& s1, signature_type const& s2 ) noexcept
+    {
+        std::size_t m = 0;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            m += s1[ i ] == s2[ i ];
+        }
+
+        return static_cast<double>( m ) / K;
+    }
+
+    // the signature of the union of the two sets
+
+    static signature_type merge( signature_type const& s1, signature_type const& s2 ) noexcept
+    {
+        signature_type s;
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            s[ i ] = std::min( s1[ i ], s2[ i ] );
+        }
+
+        return s;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, std::size_t K, class Flavor> constexpr std::size_t minhash<H, K, Flavor>::size;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MINHASH_HPP_INCLUDED
@@ -0,0 +1,335 @@
+#ifndef BOOST_HASH2_MIX_HPP_INCLUDED
+#define BOOST_HASH2_MIX_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// mix32 and mix64, word-oriented hash algorithms based on the MurmurHash3
+// 32 bit finalizer and the SplitMix64 one, for hashing integral keys
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// https://github.com/aappleby/smhasher/blob/master/src/MurmurHash3.cpp
+
+BOOST_CXX14_CONSTEXPR inline std::uint32_t mix_finalize( std::uint32_t h )
+{
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+
+    return h;
+}
+
+// https://prng.di.unimi.it/splitmix64.c
+
+BOOST_CXX14_CONSTEXPR inline std::uint64_t mix_finalize( std::uint64_t h )
+{
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBull;
+    h ^= h >> 31;
+
+    return h;
+}
+
+BOOST_CXX14_CONSTEXPR inline std::uint32_t mix_read( unsigned char const* p, std::uint32_t )
+{
+    return detail::read32le( p );
+}
+
+BOOST_CXX14_CONSTEXPR inline std::uint64_t mix_read( unsigned char const* p, std::uint64_t )
+{
+    return detail::read64le( p );
+}
+
+template<class T> struct mix_const;
+
+template<> struct mix_const<std::uint32_t>
+{
+    static constexpr std::uint32_t length = 0x9E3779B9u;
+};
+
+template<> struct mix_const<std::uint64_t>
+{
+    static constexpr std::uint64_t length = 0x9E3779B97F4A7C15ull;
+};
+
+// The input is consumed one word of type T at a time, each word xored
+// into the state, which is then passed through the finalizer. The number
+// of bytes, multiplied by an odd constant, is xored into the result, so
+// that the zero padding of a partial last word doesn't cause collisions.
+// For a single word key, the result is the finalizer of the key xored
+// with the seeded state.
+
+template<class T> class mix_impl
+{
+private:
+
+    static constexpr std::size_t N = sizeof( T );
+
+    T h_ = 0;
+    unsigned char buffer_[ N ] = {};
+    std::uint64_t n_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR static T round( T h, T w )
+    {
+        return detail::mix_finalize( static_cast<T>( h ^ w ) );
+    }
+
+public:
+
+    typedef T result_type;
+
+    constexpr mix_impl() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit mix_impl( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update_word( seed );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR mix_impl( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( mix_impl, sizeof( T ) == 4? "mix32": "mix64", n );
+
+        std::size_t m = static_cast<std::size_t>( n_ % N );
+
+        n_ += n;
+
+        if( m > 0 )
+        {
+            std::size_t k = N - m;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buffer_ + m, p, k );
+
+            p += k;
+            n -= k;
+            m += k;
+
+            if( m < N ) return;
+
+            h_ = round( h_, detail::mix_read( buffer_, T() ) );
+        }
+
+        T h = h_;
+
+        while( n >= N )
+        {
+            h = round( h, detail::mix_read( p, T() ) );
+
+            p += N;
+            n -= N;
+        }
+
+        h_ = h;
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( mix_impl, sizeof( T ) == 4? "mix32": "mix64", 8 );
+
+        if( n_ % N == 0 )
+        {
+            h_ = round( h_, static_cast<T>( w ) );
+
+            if( N == 4 )
+            {
+                h_ = round( h_, static_cast<T>( w >> 32 ) );
+            }
+
+            n_ += 8;
+        }
+        else
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, w );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR T result()
+    {
+        BOOST_HASH2_STATS_RESULT( mix_impl, sizeof( T ) == 4? "mix32": "mix64" );
+
+        T h = h_;
+
+        std::size_t const m = static_cast<std::size_t>( n_ % N );
+
+        if( m > 0 )
+        {
+            // the partial last word, padded with zeroes
+
+            T w = 0;
+
+            for( std::size_t i = 0; i < m; ++i )
+            {
+                w = static_cast<T>( w | static_cast<T>( buffer_[ i ] ) << ( i * 8 ) );
+            }
+
+            h = round( h, w );
+        }
+
+        T r = static_cast<T>( h ^ static_cast<T>( n_ ) * mix_const<T>::length );
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp[ 1 ] = { 0xFF };
+        BOOST_HASH2_STATS_SUSPEND();
+        update( tmp, 1 );
+        BOOST_HASH2_STATS_RESUME();
+
+        return r;
+    }
+
+    // One-shot hashing, equivalent to constructing from seed and
+    // calling update( p, n ) and result()
+
+    BOOST_CXX14_CONSTEXPR static T hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        mix_impl h( seed );
+        h.update( p, n );
+
+        return h.result();
+    }
+
+    static T hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.word( self.h_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + N + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        mix_impl tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace detail
+
+class mix32: public detail::mix_impl<std::uint32_t>
+{
+public:
+
+    constexpr mix32() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit mix32( std::uint64_t seed ): detail::mix_impl<std::uint32_t>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR mix32( unsigned char const * p, std::size_t n ): detail::mix_impl<std::uint32_t>( p, n )
+    {
+    }
+};
+
+class mix64: public detail::mix_impl<std::uint64_t>
+{
+public:
+
+    constexpr mix64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit mix64( std::uint64_t seed ): detail::mix_impl<std::uint64_t>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR mix64( unsigned char const * p, std::size_t n ): detail::mix_impl<std::uint64_t>( p, n )
+    {
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MIX_HPP_INCLUDED
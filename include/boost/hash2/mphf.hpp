@@ -0,0 +1,659 @@
+#ifndef BOOST_HASH2_MPHF_HPP_INCLUDED
+#define BOOST_HASH2_MPHF_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// mphf, a minimal perfect hash function over a static set of keys, and
+// mphf_view, which queries one in place from its serialized form
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// The keys are split by hash into partitions of about mphf_partition_size
+// keys, and each partition is built independently, as in PTHash-HEM. In a
+// partition of m keys, the keys are hashed into (m + 4) / 5 buckets, with
+// 60% of the keys going into the first 30% of the buckets. Each bucket has
+// a pilot, the smallest integer that places all of its keys into free
+// slots of the partition; the buckets are processed from the largest down.
+// The pilots of a partition are stored with the bit width of the largest.
+//
+// The serialized form, all integers little-endian:
+//
+//   8 bytes     "hash2mph"
+//   8 bytes     n, the number of keys
+//   8 bytes     the seed of the hash algorithm
+//   8 bytes     P, the number of partitions
+//   16 * (P+1)  for each partition, its first slot, and the bit position
+//               of its pilots shifted left by 8 plus their bit width; the
+//               last entry has the first slot n and the total bit count
+//   8 * (W+1)   the pilots, in W 64 bit words and a padding word
+
+constexpr std::size_t mphf_partition_size = 2048;
+constexpr std::size_t mphf_header_size = 32;
+constexpr std::size_t mphf_record_size = 16;
+constexpr std::uint32_t mphf_max_pilot = 1u << 20;
+
+inline std::uint64_t mphf_mix( std::uint64_t h ) noexcept
+{
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    h ^= h >> 33;
+
+    return h;
+}
+
+inline std::uint64_t mphf_pilot_hash( std::uint64_t d ) noexcept
+{
+    d *= 0x9E3779B97F4A7C15ull;
+
+    d ^= d >> 32;
+    d *= 0xD6E8FEB86659FD93ull;
+    d ^= d >> 32;
+
+    return d;
+}
+
+inline std::size_t mphf_partition_count( std::uint64_t n ) noexcept
+{
+    return n == 0? 1: static_cast<std::size_t>( ( n + mphf_partition_size - 1 ) / mphf_partition_size );
+}
+
+inline std::size_t mphf_bucket_count( std::size_t m ) noexcept
+{
+    return ( m + 4 ) / 5;
+}
+
+inline std::size_t mphf_bucket( std::uint64_t h, std::size_t b ) noexcept
+{
+    std::size_t b1 = ( b * 3 + 9 ) / 10;
+
+    if( b1 > b ) b1 = b;
+
+    std::uint64_t const x = detail::mphf_mix( h );
+    std::uint64_t const y = x << 32 | x >> 32;
+
+    // 0x9999... is 60% of 2^64
+
+    if( x < 0x9999999999999999ull || b1 == b )
+    {
+        return hash2::reduce( y, b1 );
+    }
+    else
+    {
+        return b1 + hash2::reduce( y, b - b1 );
+    }
+}
+
+inline std::size_t mphf_position( std::uint64_t h, std::uint64_t pilot, std::size_t m ) noexcept
+{
+    return hash2::reduce( detail::mphf_mix( h ^ detail::mphf_pilot_hash( pilot ) ), m );
+}
+
+inline std::uint32_t mphf_read_bits( unsigned char const* p, std::uint64_t pos, unsigned w ) noexcept
+{
+    unsigned char const* q = p + pos / 64 * 8;
+    unsigned const s = pos % 64;
+
+    std::uint64_t x = detail::read64le( q ) >> s;
+
+    if( s + w > 64 )
+    {
+        x |= detail::read64le( q + 8 ) << ( 64 - s );
+    }
+
+    return static_cast<std::uint32_t>( x & ( ( std::uint64_t( 1 ) << w ) - 1 ) );
+}
+
+// the slot of the key with hash value h; p is the serialized form
+
+inline std::size_t mphf_lookup( unsigned char const* p, std::size_t partitions, std::uint64_t h ) noexcept
+{
+    std::size_t const j = hash2::reduce( h, partitions );
+
+    unsigned char const* r = p + mphf_header_size + j * mphf_record_size;
+
+    std::uint64_t const first = detail::read64le( r );
+    std::uint64_t const bits = detail::read64le( r + 8 );
+    std::size_t const m = static_cast<std::size_t>( detail::read64le( r + mphf_record_size ) - first );
+
+    if( m == 0 )
+    {
+        // not a key; any slot will do
+
+        return first > 0? static_cast<std::size_t>( first - 1 ): 0;
+    }
+
+    unsigned const w = bits & 0xFF;
+
+    std::uint32_t pilot = 0;
+
+    if( w != 0 )
+    {
+        unsigned char const* pilots = p + mphf_header_size + ( partitions + 1 ) * mphf_record_size;
+        pilot = detail::mphf_read_bits( pilots, ( bits >> 8 ) + detail::mphf_bucket( h, detail::mphf_bucket_count( m ) ) * w, w );
+    }
+
+    return static_cast<std::size_t>( first ) + detail::mphf_position( h, pilot, m );
+}
+
+// checks the serialized form of size n at p, and returns the number of
+// partitions, or 0 if it's invalid
+
+inline std::size_t mphf_validate( unsigned char const* p, std::size_t n ) noexcept
+{
+    if( n < mphf_header_size || std::memcmp( p, "hash2mph", 8 ) != 0 ) return 0;
+
+    std::uint64_t const keys = detail::read64le( p + 8 );
+    std::uint64_t const partitions = detail::read64le( p + 24 );
+
+    if( partitions != detail::mphf_partition_count( keys ) ) return 0;
+    if( partitions >= ( n - mphf_header_size ) / mphf_record_size ) return 0;
+
+    unsigned char const* r = p + mphf_header_size;
+
+    std::uint64_t first = 0;
+    std::uint64_t bits = 0;
+
+    for( std::uint64_t j = 0; j < partitions; ++j, r += mphf_record_size )
+    {
+        std::uint64_t const first2 = detail::read64le( r + mphf_record_size );
+        std::uint64_t const bits2 = detail::read64le( r + mphf_record_size + 8 );
+
+        if( detail::read64le( r ) != first || first2 < first || first2 > keys ) return 0;
+        if( detail::read64le( r + 8 ) >> 8 != bits ) return 0;
+
+        unsigned const w = detail::read64le( r + 8 ) & 0xFF;
+
+        if( w > 32 ) return 0;
+
+        bits += static_cast<std::uint64_t>( detail::mphf_bucket_count( static_cast<std::size_t>( first2 - first ) ) ) * w;
+
+        if( bits2 >> 8 != bits ) return 0;
+
+        first = first2;
+    }
+
+    if( first != keys || ( detail::read64le( r + 8 ) & 0xFF ) != 0 ) return 0;
+
+    std::uint64_t const words = ( bits + 63 ) / 64 + 1;
+
+    if( n != mphf_header_size + ( partitions + 1 ) * mphf_record_size + words * 8 ) return 0;
+
+    return static_cast<std::size_t>( partitions );
+}
+
+// builds one partition from the hash values of its keys; fails when two
+// keys in a bucket have the same hash value, or a bucket runs out of
+// pilots, in which case the whole function is rebuilt with the next seed
+
+class mphf_partition_builder
+{
+private:
+
+    std::vector<std::size_t> bucket_;
+    std::vector<std::size_t> first_;
+    std::vector<std::uint64_t> order_;
+    std::vector<std::size_t> by_size_;
+    std::vector<std::uint64_t> taken_;
+    std::vector<std::size_t> pos_;
+
+public:
+
+    bool build( std::uint64_t const* h, std::size_t m, std::uint32_t* pilots, unsigned& width )
+    {
+        std::size_t const b = detail::mphf_bucket_count( m );
+
+        // the keys, by bucket
+
+        bucket_.resize( m );
+        first_.assign( b + 1, 0 );
+        order_.resize( m );
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            bucket_[ i ] = detail::mphf_bucket( h[ i ], b );
+            ++first_[ bucket_[ i ] + 1 ];
+        }
+
+        std::size_t max_size = 0;
+
+        for( std::size_t j = 0; j < b; ++j )
+        {
+            max_size = (std::max)( max_size, first_[ j + 1 ] );
+            first_[ j + 1 ] += first_[ j ];
+        }
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            order_[ --first_[ bucket_[ i ] + 1 ] ] = h[ i ];
+        }
+
+        // first_[ j + 1 ] now is the start of bucket j; shift back
+
+        for( std::size_t j = 0; j < b; ++j )
+        {
+            first_[ j ] = first_[ j + 1 ];
+        }
+
+        first_[ b ] = m;
+
+        // the buckets, largest first
+
+        by_size_.clear();
+
+        for( std::size_t s = max_size; s > 0; --s )
+        {
+            for( std::size_t j = 0; j < b; ++j )
+            {
+                if( first_[ j + 1 ] - first_[ j ] == s )
+                {
+                    by_size_.push_back( j );
+                }
+            }
+        }
+
+        taken_.assign( ( m + 63 ) / 64, 0 );
+        pos_.resize( max_size );
+
+        std::uint32_t max_pilot = 0;
+
+        for( std::size_t j = 0; j < b; ++j )
+        {
+            pilots[ j ] = 0;
+        }
+
+        for( std::size_t j: by_size_ )
+        {
+            std::uint64_t const* k = order_.data() + first_[ j ];
+            std::size_t const s = first_[ j + 1 ] - first_[ j ];
+
+            for( std::size_t i = 1; i < s; ++i )
+            {
+                for( std::size_t i2 = 0; i2 < i; ++i2 )
+                {
+                    if( k[ i ] == k[ i2 ] ) return false;
+                }
+            }
+
+            std::uint32_t d = 0;
+
+            for( ;; ++d )
+            {
+                if( d == mphf_max_pilot ) return false;
+
+                std::size_t i = 0;
+
+                for( ; i < s; ++i )
+                {
+                    std::size_t const q = detail::mphf_position( k[ i ], d, m );
+
+                    if( taken_[ q / 64 ] >> ( q % 64 ) & 1 ) break;
+                    if( std::find( pos_.data(), pos_.data() + i, q ) != pos_.data() + i ) break;
+
+                    pos_[ i ] = q;
+                }
+
+                if( i == s ) break;
+            }
+
+            for( std::size_t i = 0; i < s; ++i )
+            {
+                taken_[ pos_[ i ] / 64 ] |= std::uint64_t( 1 ) << ( pos_[ i ] % 64 );
+            }
+
+            pilots[ j ] = d;
+            max_pilot = (std::max)( max_pilot, d );
+        }
+
+        width = 0;
+
+        while( width < 32 && ( std::uint64_t( 1 ) << width ) <= max_pilot )
+        {
+            ++width;
+        }
+
+        return true;
+    }
+};
+
+} // namespace detail
+
+// mphf<T, H, Flavor>, a minimal perfect hash function; maps the n
+// distinct keys it was built from to distinct values in [0, n), using
+// about 2.6 bits per key. Values that aren't keys are mapped to some
+// value in [0, n).
+//
+// The serialized form, data() and data_size(), can be stored, and then
+// mapped into memory and queried in place with mphf_view.
+
+template<class T, class H, class Flavor = default_flavor> class mphf
+{
+private:
+
+    std::vector<unsigned char> data_;
+
+    H h_;
+    std::size_t n_ = 0;
+    std::size_t partitions_ = 1;
+
+private:
+
+    template<class It> static void hash_range( H const& h0, It first, It last, std::uint64_t* out )
+    {
+        for( ; first != last; ++first )
+        {
+            *out++ = detail::hash_value64<H, Flavor, T>( h0, *first );
+        }
+    }
+
+    template<class It> static void hash_keys( H const& h0, It first, std::size_t n, std::uint64_t* out, task_executor& /*ex*/, std::false_type )
+    {
+        hash_range( h0, first, std::next( first, n ), out );
+    }
+
+    // random access keys are hashed in parallel
+
+    template<class It> static void hash_keys( H const& h0, It first, std::size_t n, std::uint64_t* out, task_executor& ex, std::true_type )
+    {
+        run_parallel( ex, n, [&]( std::size_t i, std::size_t j ){ hash_range( h0, first + i, first + j, out + i ); } );
+    }
+
+    // calls f( i, j ) for the consecutive subranges [i, j) of [0, n), one per task
+
+    template<class F> static void run_parallel( task_executor& ex, std::size_t n, F const& f )
+    {
+        std::size_t const parts = detail::parallel_parts( ex, n, 1 );
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){ f( n * t / parts, n * ( t + 1 ) / parts ); } );
+    }
+
+    template<class It> void init( It first, It last, task_executor& ex )
+    {
+        std::size_t const n = static_cast<std::size_t>( std::distance( first, last ) );
+
+        // a failure under three seeds means that some key occurs more
+        // than once; then keys with the same hash value are merged
+
+        for( std::uint64_t seed = 0;; ++seed )
+        {
+            if( build( first, n, seed, seed >= 3, ex ) ) break;
+        }
+    }
+
+    template<class It> bool build( It first, std::size_t n, std::uint64_t seed, bool dedupe, task_executor& ex )
+    {
+        H const h0( seed );
+
+        std::vector<std::uint64_t> h( n );
+        hash_keys( h0, first, n, h.data(), ex, std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>() );
+
+        // the keys, by partition
+
+        std::size_t const partitions = detail::mphf_partition_count( n );
+
+        std::vector<std::uint64_t> start( partitions + 1 ); // the first slot of each partition
+        std::vector<std::uint64_t> g( n );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            ++start[ hash2::reduce( h[ i ], partitions ) + 1 ];
+        }
+
+        for( std::size_t j = 0; j < partitions; ++j )
+        {
+            start[ j + 1 ] += start[ j ];
+        }
+
+        {
+            std::vector<std::uint64_t> next( start.begin(), start.end() - 1 );
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                g[ next[ hash2::reduce( h[ i ], partitions ) ]++ ] = h[ i ];
+            }
+        }
+
+        h.clear();
+        h.shrink_to_fit();
+
+        if( dedupe )
+        {
+            // the same hash value under several seeds means the same key
+
+            std::size_t k = 0;
+
+            for( std::size_t j = 0; j < partitions; ++j )
+            {
+                std::uint64_t* p = g.data() + start[ j ];
+                std::uint64_t* q = g.data() + start[ j + 1 ];
+
+                std::sort( p, q );
+                q = std::unique( p, q );
+
+                start[ j ] = k;
+                k = static_cast<std::size_t>( std::copy( p, q, g.data() + k ) - g.data() );
+            }
+
+            start[ partitions ] = k;
+            n = k;
+        }
+
+        // the pilots, in parallel over the partitions
+
+        std::vector<std::uint64_t> pilot_start( partitions + 1 );
+
+        for( std::size_t j = 0; j < partitions; ++j )
+        {
+            pilot_start[ j + 1 ] = pilot_start[ j ] + detail::mphf_bucket_count( static_cast<std::size_t>( start[ j + 1 ] - start[ j ] ) );
+        }
+
+        std::vector<std::uint32_t> pilots( static_cast<std::size_t>( pilot_start[ partitions ] ) );
+        std::vector<unsigned char> width( partitions );
+        std::vector<unsigned char> failed( partitions );
+
+        run_parallel( ex, partitions, [&]( std::size_t i, std::size_t j ){
+
+            detail::mphf_partition_builder pb;
+
+            for( ; i < j; ++i )
+            {
+                unsigned w = 0;
+
+                if( !pb.build( g.data() + start[ i ], static_cast<std::size_t>( start[ i + 1 ] - start[ i ] ), pilots.data() + pilot_start[ i ], w ) )
+                {
+                    failed[ i ] = 1;
+                    return;
+                }
+
+                width[ i ] = static_cast<unsigned char>( w );
+            }
+        });
+
+        if( std::find( failed.begin(), failed.end(), 1 ) != failed.end() ) return false;
+
+        // serialize
+
+        std::uint64_t bits = 0;
+
+        for( std::size_t j = 0; j < partitions; ++j )
+        {
+            bits += ( pilot_start[ j + 1 ] - pilot_start[ j ] ) * width[ j ];
+        }
+
+        std::size_t const words = static_cast<std::size_t>( ( bits + 63 ) / 64 + 1 );
+
+        data_.assign( detail::mphf_header_size + ( partitions + 1 ) * detail::mphf_record_size + words * 8, 0 );
+
+        unsigned char* p = data_.data();
+
+        std::memcpy( p, "hash2mph", 8 );
+        detail::write64le( p + 8, n );
+        detail::write64le( p + 16, seed );
+        detail::write64le( p + 24, partitions );
+
+        unsigned char* r = p + detail::mphf_header_size;
+        std::vector<std::uint64_t> w( words );
+
+        bits = 0;
+
+        for( std::size_t j = 0; j < partitions; ++j, r += detail::mphf_record_size )
+        {
+            detail::write64le( r, start[ j ] );
+            detail::write64le( r + 8, bits << 8 | width[ j ] );
+
+            for( std::uint64_t k = pilot_start[ j ]; k < pilot_start[ j + 1 ]; ++k, bits += width[ j ] )
+            {
+                std::uint64_t const x = pilots[ static_cast<std::size_t>( k ) ];
+
+                w[ static_cast<std::size_t>( bits / 64 ) ] |= x << ( bits % 64 );
+
+                if( bits % 64 + width[ j ] > 64 )
+                {
+                    w[ static_cast<std::size_t>( bits / 64 + 1 ) ] |= x >> ( 64 - bits % 64 );
+                }
+            }
+        }
+
+        detail::write64le( r, n );
+        detail::write64le( r + 8, bits << 8 );
+
+        r += detail::mphf_record_size;
+
+        for( std::size_t k = 0; k < words; ++k )
+        {
+            detail::write64le( r + k * 8, w[ k ] );
+        }
+
+        h_ = h0;
+        n_ = n;
+        partitions_ = partitions;
+
+        return true;
+    }
+
+public:
+
+    using value_type = T;
+    using hash_type = H;
+
+    // builds the function for the keys in [first, last), on up to `threads`
+    // threads; threads == 0 means std::thread::hardware_concurrency()
+
+    template<class It> mphf( It first, It last, unsigned threads = 0 )
+    {
+        thread_executor ex( threads );
+        init( first, last, ex );
+    }
+
+    // same, but builds it on ex
+
+    template<class It> mphf( It first, It last, task_executor& ex )
+    {
+        init( first, last, ex );
+    }
+
+    // the number of distinct keys
+
+    std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+    std::size_t operator()( T const& v ) const
+    {
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+        return detail::mphf_lookup( data_.data(), partitions_, h );
+    }
+
+    // the serialized form
+
+    unsigned char const* data() const noexcept
+    {
+        return data_.data();
+    }
+
+    std::size_t data_size() const noexcept
+    {
+        return data_.size();
+    }
+};
+
+// mphf_view<T, H, Flavor>, queries the serialized form of an mphf in
+// place, without copying it; the memory must outlive the view
+
+template<class T, class H, class Flavor = default_flavor> class mphf_view
+{
+private:
+
+    unsigned char const* p_ = nullptr;
+
+    H h_;
+    std::size_t n_ = 0;
+    std::size_t partitions_ = 0;
+
+public:
+
+    using value_type = T;
+    using hash_type = H;
+
+    mphf_view() = default;
+
+    // checks the serialized form [p, p+n), and on success, refers to it
+
+    bool load( unsigned char const* p, std::size_t n )
+    {
+        std::size_t partitions = detail::mphf_validate( p, n );
+
+        if( partitions == 0 ) return false;
+
+        p_ = p;
+        h_ = H( detail::read64le( p + 16 ) );
+        n_ = static_cast<std::size_t>( detail::read64le( p + 8 ) );
+        partitions_ = partitions;
+
+        return true;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return n_;
+    }
+
+    std::size_t operator()( T const& v ) const
+    {
+        BOOST_ASSERT( p_ != nullptr );
+
+        std::uint64_t h = detail::hash_value64<H, Flavor>( h_, v );
+        return detail::mphf_lookup( p_, partitions_, h );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MPHF_HPP_INCLUDED
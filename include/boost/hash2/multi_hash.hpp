@@ -0,0 +1,110 @@
+#ifndef BOOST_HASH2_MULTI_HASH_HPP_INCLUDED
+#define BOOST_HASH2_MULTI_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// multi_hash<H...>, computes several hash values in a single pass
+
+#include <boost/mp11/integer_sequence.hpp>
+#include <boost/mp11/tuple.hpp>
+#include <boost/config.hpp>
+#include <tuple>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+struct multi_hash_update
+{
+    unsigned char const* p;
+    std::size_t n;
+
+    template<class H> void operator()( H& h ) const
+    {
+        h.update( p, n );
+    }
+};
+
+} // namespace detail
+
+// the input is passed to the hash algorithms in sub-blocks of this size,
+// each to all of them in turn, so that it's still in the L1 cache when the
+// later ones read it
+
+template<class... H> class multi_hash
+{
+private:
+
+    static_assert( sizeof...(H) > 0, "multi_hash requires at least one hash algorithm" );
+
+    static constexpr std::size_t sub_block_size = 16 * 1024;
+
+    std::tuple<H...> h_;
+
+private:
+
+    template<std::size_t... I> std::tuple<typename H::result_type...> result_( mp11::index_sequence<I...> )
+    {
+        return std::tuple<typename H::result_type...>( std::get<I>( h_ ).result()... );
+    }
+
+public:
+
+    using result_type = std::tuple<typename H::result_type...>;
+
+    multi_hash() = default;
+
+    explicit multi_hash( std::uint64_t seed ): h_( H( seed )... )
+    {
+    }
+
+    multi_hash( unsigned char const* p, std::size_t n ): h_( H( p, n )... )
+    {
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+
+        while( n > sub_block_size )
+        {
+            mp11::tuple_for_each( h_, detail::multi_hash_update{ p, sub_block_size } );
+
+            p += sub_block_size;
+            n -= sub_block_size;
+        }
+
+        mp11::tuple_for_each( h_, detail::multi_hash_update{ p, n } );
+    }
+
+    result_type result()
+    {
+        return result_( mp11::index_sequence_for<H...>() );
+    }
+
+    // the hash algorithms, in the order of H...
+
+    std::tuple<H...> const& hashers() const noexcept
+    {
+        return h_;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class... H> constexpr std::size_t multi_hash<H...>::sub_block_size;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MULTI_HASH_HPP_INCLUDED
@@ -0,0 +1,156 @@
+#ifndef BOOST_HASH2_MULTISET_HASH_HPP_INCLUDED
+#define BOOST_HASH2_MULTISET_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// multiset_hash, an incrementally maintained hash value of an unordered
+// collection of elements
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/assert.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class H, class Flavor, bool = has_unordered_element_hash<Flavor>::value> struct multiset_element_hash
+{
+    using type = H;
+};
+
+template<class H, class Flavor> struct multiset_element_hash<H, Flavor, true>
+{
+    using type = typename Flavor::unordered_element_hash;
+};
+
+} // namespace detail
+
+// multiset_hash<H, Flavor>
+//
+// The elements are combined with the same commutative sum as in
+// hash_append_unordered_range, so adding or removing one element costs
+// a single element hash, and result() is the value that H would return
+// after hash_append of an unordered container with the same elements
+
+template<class H, class Flavor = default_flavor> class multiset_hash
+{
+private:
+
+    using element_hash = typename detail::multiset_element_hash<H, Flavor>::type;
+
+    H h_;
+    element_hash h1_;
+
+    std::uint64_t w_ = 0;
+    std::uint64_t m_ = 0;
+
+public:
+
+    using hash_type = H;
+    using result_type = typename H::result_type;
+
+    multiset_hash(): h_(), h1_( detail::unordered_element_hash( h_, Flavor(), detail::has_unordered_element_hash<Flavor>() ) )
+    {
+    }
+
+    explicit multiset_hash( std::uint64_t seed ): h_( seed ), h1_( detail::unordered_element_hash( h_, Flavor(), detail::has_unordered_element_hash<Flavor>() ) )
+    {
+    }
+
+    multiset_hash( unsigned char const* seed, std::size_t n ): h_( seed, n ), h1_( detail::unordered_element_hash( h_, Flavor(), detail::has_unordered_element_hash<Flavor>() ) )
+    {
+    }
+
+    // h is the state in which the container would be appended
+
+    explicit multiset_hash( H const& h ): h_( h ), h1_( detail::unordered_element_hash( h_, Flavor(), detail::has_unordered_element_hash<Flavor>() ) )
+    {
+    }
+
+    template<class T> void add( T const& v )
+    {
+        w_ += detail::unordered_element_value( h1_, Flavor(), v );
+        ++m_;
+    }
+
+    // v must have been added, and not removed since
+
+    template<class T> void remove( T const& v )
+    {
+        BOOST_ASSERT( m_ > 0 );
+
+        w_ -= detail::unordered_element_value( h1_, Flavor(), v );
+        --m_;
+    }
+
+    // the elements of another multiset_hash constructed from the same
+    // hash algorithm state
+
+    void merge( multiset_hash const& other ) noexcept
+    {
+        w_ += other.w_;
+        m_ += other.m_;
+    }
+
+    void clear() noexcept
+    {
+        w_ = 0;
+        m_ = 0;
+    }
+
+    std::uint64_t size() const noexcept
+    {
+        return m_;
+    }
+
+    // the sum of the element hash values, which identifies the multiset
+
+    std::uint64_t sum() const noexcept
+    {
+        return w_;
+    }
+
+    // the result of a copy of the initial state after appending the multiset
+
+    result_type result() const
+    {
+        H h( h_ );
+        append_to( h );
+
+        return h.result();
+    }
+
+    // the same as hash_append_unordered_range( h, Flavor(), first, last ) over
+    // the elements, when h is in the initial state
+
+    void append_to( H& h ) const
+    {
+        hash2::hash_append( h, Flavor(), w_ );
+        hash2::hash_append_size( h, Flavor(), m_ );
+    }
+
+    friend bool operator==( multiset_hash const& x, multiset_hash const& y ) noexcept
+    {
+        return x.w_ == y.w_ && x.m_ == y.m_;
+    }
+
+    friend bool operator!=( multiset_hash const& x, multiset_hash const& y ) noexcept
+    {
+        return !( x == y );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_MULTISET_HASH_HPP_INCLUDED
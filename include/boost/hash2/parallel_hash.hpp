@@ -0,0 +1,115 @@
+#ifndef BOOST_HASH2_PARALLEL_HASH_HPP_INCLUDED
+#define BOOST_HASH2_PARALLEL_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// parallel_hash, hashing a single buffer on several threads with
+// the algorithms that support it
+
+#include <boost/hash2/executor.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <utility>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// has_update_parallel<Hash> is true when Hash has a member
+// update_parallel( void const* p, std::size_t n, unsigned threads ),
+// equivalent to update( p, n ), that splits large inputs across threads
+// and merges the partial results (crc32c, blake3, k12), and an overload
+// update_parallel( void const* p, std::size_t n, task_executor& ex ) that
+// runs the parts on ex
+
+template<class Hash, class En = void> struct has_update_parallel: std::false_type
+{
+};
+
+template<class Hash> struct has_update_parallel<Hash, decltype( std::declval<Hash&>().update_parallel( std::declval<void const*>(), std::size_t(), 0u ), void() )>: std::true_type
+{
+};
+
+namespace detail
+{
+
+template<class Hash> void parallel_update( Hash& h, void const* p, std::size_t n, task_executor& ex, std::true_type )
+{
+    h.update_parallel( p, n, ex );
+}
+
+template<class Hash> void parallel_update( Hash& h, void const* p, std::size_t n, task_executor& /*ex*/, std::false_type )
+{
+    h.update( p, n );
+}
+
+} // namespace detail
+
+// Returns the result of Hash( seed ) after update( p, n ); algorithms for
+// which has_update_parallel is true hash on ex, the others on the calling
+// thread
+
+template<class Hash> typename Hash::result_type parallel_hash( task_executor& ex, void const* p, std::size_t n, std::uint64_t seed = 0 )
+{
+    Hash h( seed );
+    detail::parallel_update( h, p, n, ex, has_update_parallel<Hash>() );
+
+    return h.result();
+}
+
+} // namespace hash2
+} // namespace boost
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+#include <execution>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class Hash> void parallel_update( Hash& h, void const* p, std::size_t n, unsigned threads, std::true_type )
+{
+    h.update_parallel( p, n, threads );
+}
+
+template<class Hash> void parallel_update( Hash& h, void const* p, std::size_t n, unsigned /*threads*/, std::false_type )
+{
+    h.update( p, n );
+}
+
+} // namespace detail
+
+// Returns the result of Hash( seed ) after update( p, n ). Under a
+// parallel policy, algorithms for which has_update_parallel is true
+// use all hardware threads; the others, and all algorithms under
+// std::execution::seq, hash on the calling thread. The result doesn't
+// depend on the policy.
+
+template<class Hash, class ExecutionPolicy>
+    typename std::enable_if< std::is_execution_policy< typename std::decay<ExecutionPolicy>::type >::value, typename Hash::result_type >::type
+    parallel_hash( ExecutionPolicy&& /*policy*/, void const* p, std::size_t n, std::uint64_t seed = 0 )
+{
+    unsigned const threads = std::is_same< typename std::decay<ExecutionPolicy>::type, std::execution::sequenced_policy >::value? 1: 0;
+
+    Hash h( seed );
+    detail::parallel_update( h, p, n, threads, has_update_parallel<Hash>() );
+
+    return h.result();
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #if !defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+#endif // #ifndef BOOST_HASH2_PARALLEL_HASH_HPP_INCLUDED
@@ -0,0 +1,489 @@
+#ifndef BOOST_HASH2_PATTERN_MATCHER_HPP_INCLUDED
+#define BOOST_HASH2_PATTERN_MATCHER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// pattern_matcher<R>, Rabin-Karp search for many patterns of the same
+// length at once; the windows of the text are rolled with R, filtered
+// by the fingerprints of the patterns, and only the hits are compared
+
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// the number of lanes of windows rolled side by side; the recurrence of
+// a single lane is serial, so independent ones are interleaved instead
+
+constexpr std::size_t pattern_lanes = 8;
+
+// the number of windows per lane whose values are computed before they
+// are probed
+
+constexpr std::size_t pattern_lane_run = 32;
+
+// the number of windows per lane, per block of the text; not a multiple
+// of 4096, so that the lanes don't fall into the same cache sets
+
+constexpr std::size_t pattern_lane_block = 16000;
+
+// the minimum number of bytes of text per task
+
+constexpr std::size_t pattern_min_text = 1024 * 1024;
+
+} // namespace detail
+
+struct pattern_match
+{
+    std::size_t offset;
+    std::size_t pattern;
+};
+
+inline bool operator==( pattern_match const& x, pattern_match const& y ) noexcept
+{
+    return x.offset == y.offset && x.pattern == y.pattern;
+}
+
+inline bool operator!=( pattern_match const& x, pattern_match const& y ) noexcept
+{
+    return !( x == y );
+}
+
+template<class R = rabin_karp_64> class pattern_matcher
+{
+private:
+
+    static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+    struct slot
+    {
+        std::uint64_t fp;
+        std::size_t index;
+    };
+
+    struct workspace
+    {
+        std::vector<R> lanes;
+        std::vector<pattern_match> hits[ detail::pattern_lanes ];
+    };
+
+    std::size_t w_;
+
+    // the rolling hash, from which the lanes are copied
+
+    R r_;
+
+    // the patterns, w_ bytes each, and their fingerprints
+
+    std::vector<unsigned char> data_;
+    std::vector<std::uint64_t> fp_;
+
+    // an open addressing table of the fingerprints, at most half full and
+    // indexed by their high bits, and in front of it a filter of two bits
+    // per fingerprint in a 64 bit word, so that most windows of the text
+    // cost a single load
+
+    std::vector<slot> table_;
+    std::vector<std::uint64_t> filter_;
+
+    int shift_; // 64 - log2( table_.size() )
+
+private:
+
+    // the values of R aren't necessarily mixed; the high bits of the
+    // product depend on all of them
+
+    static std::uint64_t mix( std::uint64_t h ) noexcept
+    {
+        return h * 0x9E3779B97F4A7C15ull;
+    }
+
+    // the word of the filter is selected by the high bits, as is the slot
+    // of the table, and the two bits in it by bits 20 to 31
+
+    static std::uint64_t filter_bits( std::uint64_t x ) noexcept
+    {
+        return ( std::uint64_t( 1 ) << ( ( x >> 20 ) & 63 ) ) | ( std::uint64_t( 1 ) << ( ( x >> 26 ) & 63 ) );
+    }
+
+    void insert( std::uint64_t x, std::size_t k ) noexcept
+    {
+        filter_[ x >> ( shift_ + 1 ) ] |= filter_bits( x );
+
+        std::size_t const mask = table_.size() - 1;
+
+        std::size_t i = static_cast<std::size_t>( x >> shift_ );
+
+        while( table_[ i ].index != npos )
+        {
+            i = ( i + 1 ) & mask;
+        }
+
+        table_[ i ].fp = x;
+        table_[ i ].index = k;
+    }
+
+    void rehash( std::size_t n )
+    {
+        int shift = 64;
+
+        for( std::size_t m = n; m > 1; m >>= 1 )
+        {
+            --shift;
+        }
+
+        slot const empty = { 0, npos };
+
+        table_.assign( n, empty );
+        filter_.assign( n / 2, 0 );
+
+        shift_ = shift;
+
+        for( std::size_t k = 0; k < fp_.size(); ++k )
+        {
+            insert( fp_[ k ], k );
+        }
+    }
+
+    // the index of the pattern equal to the w_ bytes at p, or npos
+
+    std::size_t lookup( std::uint64_t x, unsigned char const* p ) const noexcept
+    {
+        std::size_t const mask = table_.size() - 1;
+
+        for( std::size_t i = static_cast<std::size_t>( x >> shift_ );; i = ( i + 1 ) & mask )
+        {
+            slot const& s = table_[ i ];
+
+            if( s.index == npos ) return npos;
+
+            if( s.fp == x && std::memcmp( data_.data() + s.index * w_, p, w_ ) == 0 )
+            {
+                return s.index;
+            }
+        }
+    }
+
+    // called for the windows that pass the filter
+
+    BOOST_NOINLINE void verify( std::uint64_t x, unsigned char const* p, std::size_t offset, std::vector<pattern_match>& hits ) const
+    {
+        std::size_t const k = lookup( x, p );
+
+        if( k != npos )
+        {
+            pattern_match m = { offset, k };
+            hits.push_back( m );
+        }
+    }
+
+    // filter and shift are filter_.data() and shift_ + 1, kept in
+    // registers by the caller
+
+    BOOST_FORCEINLINE void probe( std::uint64_t const* filter, int shift, std::uint64_t h, unsigned char const* p, std::size_t offset, std::vector<pattern_match>& hits ) const
+    {
+        std::uint64_t const x = mix( h );
+        std::uint64_t const b = filter_bits( x );
+
+        if( BOOST_UNLIKELY( ( filter[ x >> shift ] & b ) == b ) )
+        {
+            verify( x, p, offset, hits );
+        }
+    }
+
+    // the windows starting in [0, m) of p, in L lanes of consecutive
+    // windows; the matches of lane i are appended to ws.hits[ i ], with
+    // base added to their offsets
+
+    template<std::size_t L> void scan_lanes( unsigned char const* p, std::size_t m, std::size_t base, workspace& ws ) const
+    {
+        std::size_t const w = w_;
+        std::size_t const q = m / L;
+
+        R* r = ws.lanes.data();
+
+        std::uint64_t const* filter = filter_.data();
+        int const shift = shift_ + 1;
+
+        for( std::size_t i = 0; i < L; ++i )
+        {
+            r[ i ].reset();
+            r[ i ].update( p + i * q, w );
+
+            probe( filter, shift, r[ i ].value(), p + i * q, base + i * q, ws.hits[ i ] );
+        }
+
+        // the values of a run of windows are computed first, so that the
+        // states of the lanes stay in registers, and then probed, so that
+        // the loads from the filter overlap
+
+        std::size_t const J = detail::pattern_lane_run;
+
+        std::uint64_t v[ L ][ J ];
+
+        for( std::size_t j0 = 1; j0 < q; j0 += J )
+        {
+            std::size_t const k = q - j0 < J? q - j0: J;
+
+            for( std::size_t i = 0; i < L; ++i )
+            {
+                R& ri = r[ i ];
+
+                for( std::size_t j = 0; j < k; ++j )
+                {
+                    std::size_t const s = i * q + j0 + j;
+
+                    ri.roll( p[ s - 1 ], p[ s + w - 1 ] );
+                    v[ i ][ j ] = ri.value();
+                }
+            }
+
+            for( std::size_t i = 0; i < L; ++i )
+            {
+                for( std::size_t j = 0; j < k; ++j )
+                {
+                    std::size_t const s = i * q + j0 + j;
+                    probe( filter, shift, v[ i ][ j ], p + s, base + s, ws.hits[ i ] );
+                }
+            }
+        }
+
+        // the last lane takes the rest
+
+        for( std::size_t s = L * q; s < m; ++s )
+        {
+            r[ L - 1 ].roll( p[ s - 1 ], p[ s + w - 1 ] );
+            probe( filter, shift, r[ L - 1 ].value(), p + s, base + s, ws.hits[ L - 1 ] );
+        }
+    }
+
+    void scan( unsigned char const* p, std::size_t m, std::size_t base, workspace& ws ) const
+    {
+        for( std::size_t i = 0; i < detail::pattern_lanes; ++i )
+        {
+            ws.hits[ i ].clear();
+        }
+
+        if( ws.lanes.empty() )
+        {
+            ws.lanes.assign( detail::pattern_lanes, r_ );
+        }
+
+        // a lane fills its window before rolling it, so that it's not
+        // worth splitting few windows
+
+        if( m >= detail::pattern_lanes * w_ * 4 )
+        {
+            scan_lanes<detail::pattern_lanes>( p, m, base, ws );
+        }
+        else
+        {
+            scan_lanes<1>( p, m, base, ws );
+        }
+    }
+
+    // the windows starting in [0, m) of p, in blocks, calling f with the
+    // matches of each in order
+
+    template<class F> void search_blocks( unsigned char const* p, std::size_t m, std::size_t base, F& f, workspace& ws ) const
+    {
+        std::size_t const block = detail::pattern_lanes * detail::pattern_lane_block;
+
+        for( std::size_t i = 0; i < m; i += block )
+        {
+            std::size_t const k = m - i < block? m - i: block;
+
+            scan( p + i, k, base + i, ws );
+
+            for( std::size_t j = 0; j < detail::pattern_lanes; ++j )
+            {
+                for( pattern_match const& x: ws.hits[ j ] )
+                {
+                    f( x.offset, x.pattern );
+                }
+            }
+        }
+    }
+
+public:
+
+    // length is the length of the patterns, and of the window of R;
+    // seed is passed to R
+
+    explicit pattern_matcher( std::size_t length, std::uint64_t seed = 0 ): w_( length ), r_( length, seed )
+    {
+        BOOST_ASSERT( length > 0 );
+        rehash( 16 );
+    }
+
+    std::size_t length() const noexcept
+    {
+        return w_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return fp_.size();
+    }
+
+    bool empty() const noexcept
+    {
+        return fp_.empty();
+    }
+
+    // the length() bytes of pattern i
+
+    unsigned char const* pattern( std::size_t i ) const noexcept
+    {
+        BOOST_ASSERT( i < size() );
+        return data_.data() + i * w_;
+    }
+
+    void reserve( std::size_t n )
+    {
+        data_.reserve( n * w_ );
+        fp_.reserve( n );
+
+        std::size_t m = table_.size();
+
+        while( m < 2 * n )
+        {
+            m *= 2;
+        }
+
+        if( m != table_.size() )
+        {
+            rehash( m );
+        }
+    }
+
+    // adds the pattern [p, p + n), n == length(), and returns its index;
+    // if an equal pattern has been added, returns the index of that
+
+    std::size_t add( void const* p, std::size_t n )
+    {
+        BOOST_ASSERT( n == w_ );
+        (void)n;
+
+        unsigned char const* q = static_cast<unsigned char const*>( p );
+
+        r_.reset();
+        r_.update( q, w_ );
+
+        std::uint64_t const x = mix( r_.value() );
+
+        std::size_t k = lookup( x, q );
+
+        if( k != npos ) return k;
+
+        k = fp_.size();
+
+        data_.insert( data_.end(), q, q + w_ );
+        fp_.push_back( x );
+
+        if( 2 * fp_.size() > table_.size() )
+        {
+            rehash( table_.size() * 2 );
+        }
+        else
+        {
+            insert( x, k );
+        }
+
+        return k;
+    }
+
+    // calls f( offset, pattern ) for each occurrence of a pattern in the
+    // text [p, p + n), in order of offset
+
+    template<class F> void search( void const* p, std::size_t n, F f ) const
+    {
+        if( n < w_ || empty() ) return;
+
+        workspace ws;
+        search_blocks( static_cast<unsigned char const*>( p ), n - w_ + 1, 0, f, ws );
+    }
+
+    // returns the occurrences of the patterns in [p, p + n), in order of
+    // offset, searching on ex; the text is split into parts that overlap
+    // by length() - 1 bytes, so that no occurrence is missed or repeated
+
+    std::vector<pattern_match> find_all( void const* p, std::size_t n, task_executor& ex ) const
+    {
+        std::vector<pattern_match> r;
+
+        if( n < w_ || empty() ) return r;
+
+        unsigned char const* q = static_cast<unsigned char const*>( p );
+
+        // the parts are ranges of windows, each of which ends length() - 1
+        // bytes past its start
+
+        std::size_t const m = n - w_ + 1;
+
+        unsigned const parts = detail::parallel_parts( ex, m, detail::pattern_min_text );
+
+        std::vector< std::vector<pattern_match> > v( parts );
+
+        hash2::bulk_execute( ex, parts, [&]( std::size_t t ){
+
+            std::size_t const first = m / parts * t;
+            std::size_t const last = t + 1 == parts? m: m / parts * ( t + 1 );
+
+            std::vector<pattern_match>& vt = v[ t ];
+
+            auto f = [&]( std::size_t offset, std::size_t pattern ){
+
+                pattern_match x = { offset, pattern };
+                vt.push_back( x );
+            };
+
+            workspace ws;
+            search_blocks( q + first, last - first, first, f, ws );
+        });
+
+        std::size_t k = 0;
+
+        for( unsigned t = 0; t < parts; ++t )
+        {
+            k += v[ t ].size();
+        }
+
+        r.reserve( k );
+
+        for( unsigned t = 0; t < parts; ++t )
+        {
+            r.insert( r.end(), v[ t ].begin(), v[ t ].end() );
+        }
+
+        return r;
+    }
+
+    // same, on up to threads threads; threads == 0 means
+    // std::thread::hardware_concurrency()
+
+    std::vector<pattern_match> find_all( void const* p, std::size_t n, unsigned threads = 0 ) const
+    {
+        thread_executor ex( threads );
+        return find_all( p, n, ex );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_PATTERN_MATCHER_HPP_INCLUDED
@@ -0,0 +1,210 @@
+#ifndef BOOST_HASH2_PBKDF2_HPP_INCLUDED
+#define BOOST_HASH2_PBKDF2_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// PBKDF2 key derivation function, https://tools.ietf.org/html/rfc8018#section-5.2
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// computes the derived key block i into [out, out+n), n <= sizeof( H::result_type )
+
+template<class H> void pbkdf2_block( hmac_key<H> const& key, unsigned char const* salt, std::size_t sn, std::size_t iterations, std::uint32_t i, unsigned char* out, std::size_t n )
+{
+    unsigned char ctr[ 4 ];
+    detail::write32be( ctr, i );
+
+    hmac<H> h( key );
+
+    h.update( salt, sn );
+    h.update( ctr, 4 );
+
+    typename H::result_type u = h.result();
+    typename H::result_type t = u;
+
+    for( std::size_t j = 1; j < iterations; ++j )
+    {
+        hmac<H> h2( key );
+
+        h2.update( u.data(), u.size() );
+        u = h2.result();
+
+        for( std::size_t k = 0; k < u.size(); ++k )
+        {
+            t[ k ] = static_cast<unsigned char>( t[ k ] ^ u[ k ] );
+        }
+    }
+
+    std::memcpy( out, t.data(), n );
+}
+
+// computes the Hm::lanes derived key blocks starting from i into [out, out+n),
+// using a multi-buffer HMAC implementation
+
+template<class Hm, class H> void pbkdf2_blocks( hmac_key<H> const& key, unsigned char const* salt, std::size_t sn, std::size_t iterations, std::uint32_t i, unsigned char* out, std::size_t n )
+{
+    constexpr std::size_t N = Hm::lanes;
+
+    unsigned char ctr[ N ][ 4 ];
+    unsigned char const* p[ N ];
+
+    Hm h( key );
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        p[ j ] = salt;
+    }
+
+    h.update( p, sn );
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        detail::write32be( ctr[ j ], static_cast<std::uint32_t>( i + j ) );
+        p[ j ] = ctr[ j ];
+    }
+
+    h.update( p, 4 );
+
+    typename Hm::result_type u = h.result();
+    typename Hm::result_type t = u;
+
+    for( std::size_t k = 1; k < iterations; ++k )
+    {
+        Hm h2( key );
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            p[ j ] = u[ j ].data();
+        }
+
+        h2.update( p, u[ 0 ].size() );
+        u = h2.result();
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            for( std::size_t m = 0; m < u[ j ].size(); ++m )
+            {
+                t[ j ][ m ] = static_cast<unsigned char>( t[ j ][ m ] ^ u[ j ][ m ] );
+            }
+        }
+    }
+
+    for( std::size_t j = 0; j < N && n > 0; ++j )
+    {
+        std::size_t m = n < t[ j ].size()? n: t[ j ].size();
+
+        std::memcpy( out, t[ j ].data(), m );
+
+        out += m;
+        n -= m;
+    }
+}
+
+template<class H> void pbkdf2_( hmac_key<H> const& key, unsigned char const* salt, std::size_t sn, std::size_t iterations, unsigned char* out, std::size_t n, std::false_type )
+{
+    std::size_t const M = sizeof( typename H::result_type );
+
+    for( std::uint32_t i = 1; n > 0; ++i )
+    {
+        std::size_t m = n < M? n: M;
+
+        detail::pbkdf2_block( key, salt, sn, iterations, i, out, m );
+
+        out += m;
+        n -= m;
+    }
+}
+
+template<class H> void pbkdf2_( hmac_key<H> const& key, unsigned char const* salt, std::size_t sn, std::size_t iterations, unsigned char* out, std::size_t n, std::true_type )
+{
+    using multi = detail::hmac_multi<H>;
+
+    std::size_t const M = sizeof( typename H::result_type );
+
+    std::uint32_t i = 1;
+
+    // the blocks are independent, so they are computed in groups,
+    // one block per lane
+
+    while( n > M )
+    {
+        std::size_t k = ( n + M - 1 ) / M; // remaining blocks
+        std::size_t m;
+
+        if( k >= 8 )
+        {
+            k = 8;
+            m = n < k * M? n: k * M;
+
+            detail::pbkdf2_blocks< typename multi::template type<8> >( key, salt, sn, iterations, i, out, m );
+        }
+        else if( k >= 4 )
+        {
+            k = 4;
+            m = n < k * M? n: k * M;
+
+            detail::pbkdf2_blocks< typename multi::template type<4> >( key, salt, sn, iterations, i, out, m );
+        }
+        else
+        {
+            k = 2;
+            m = n < k * M? n: k * M;
+
+            detail::pbkdf2_blocks< typename multi::template type<2> >( key, salt, sn, iterations, i, out, m );
+        }
+
+        i += static_cast<std::uint32_t>( k );
+
+        out += m;
+        n -= m;
+    }
+
+    if( n > 0 )
+    {
+        detail::pbkdf2_block( key, salt, sn, iterations, i, out, n );
+    }
+}
+
+} // namespace detail
+
+// pbkdf2<H>, derives n bytes into out from the password [p, p+pn)
+// and the salt [s, s+sn), using iterations iterations of hmac<H>
+//
+// The padded password is hashed once, into an hmac_key<H>, and reused
+// by all iterations; when a multi-buffer implementation of hmac<H> is
+// available, the output blocks are computed in parallel lanes
+
+template<class H> void pbkdf2( unsigned char const* p, std::size_t pn, unsigned char const* s, std::size_t sn, std::size_t iterations, unsigned char* out, std::size_t n )
+{
+    BOOST_ASSERT( iterations >= 1 );
+    BOOST_ASSERT( n / sizeof( typename H::result_type ) < 0xFFFFFFFFu );
+
+    hmac_key<H> const key( p, pn );
+
+    detail::pbkdf2_( key, s, sn, iterations, out, n, std::integral_constant<bool, detail::hmac_multi<H>::value>() );
+}
+
+template<class H> void pbkdf2( void const* p, std::size_t pn, void const* s, std::size_t sn, std::size_t iterations, void* out, std::size_t n )
+{
+    hash2::pbkdf2<H>( static_cast<unsigned char const*>( p ), pn, static_cast<unsigned char const*>( s ), sn, iterations, static_cast<unsigned char*>( out ), n );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_PBKDF2_HPP_INCLUDED
@@ -0,0 +1,325 @@
+#ifndef BOOST_HASH2_PERFECT_HASH_HPP_INCLUDED
+#define BOOST_HASH2_PERFECT_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// perfect_hash, a minimal perfect hash table over a fixed set of
+// strings, constructible at compile time
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/memcmp.hpp>
+#include <boost/container_hash/is_contiguous_range.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+# include <string_view>
+# include <array>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+BOOST_CXX14_CONSTEXPR inline std::size_t string_length( char const* p ) noexcept
+{
+    std::size_t n = 0;
+
+    while( p[ n ] != 0 )
+    {
+        ++n;
+    }
+
+    return n;
+}
+
+// the value with which a pilot displaces the positions of its bucket
+
+BOOST_CXX14_CONSTEXPR inline std::uint64_t pilot_hash( std::uint64_t d ) noexcept
+{
+    d *= 0x9E3779B97F4A7C15ull;
+
+    d ^= d >> 32;
+    d *= 0xD6E8FEB86659FD93ull;
+    d ^= d >> 32;
+
+    return d;
+}
+
+} // namespace detail
+
+// perfect_hash<H, N> maps each of N distinct strings to its index, with
+// one evaluation of H and one comparison per lookup
+//
+// The keys are hashed, with a seed, into N/2+1 buckets. Each bucket has
+// a pilot, a small integer chosen at construction, which places all the
+// keys of the bucket into free slots of a table with exactly N slots.
+// The buckets are processed from the largest down, trying pilots in
+// order; should a bucket run out of pilots, the next seed is tried.
+//
+// The keys aren't copied; the table refers to the strings it was
+// constructed from.
+
+template<class H, std::size_t N> class perfect_hash
+{
+public:
+
+    static constexpr std::size_t npos = static_cast<std::size_t>( -1 );
+
+private:
+
+    static constexpr std::size_t M = N > 0? N: 1; // slots
+    static constexpr std::size_t B = N / 2 + 1; // buckets
+
+    static constexpr std::size_t max_pilots = 65536;
+
+    std::uint64_t seed_ = 0;
+
+    std::uint16_t pilot_[ B ] = {};
+
+    char const* key_[ M ] = {};
+    std::size_t size_[ M ] = {};
+    std::size_t index_[ M ] = {};
+
+private:
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash_key( std::uint64_t seed, char const* p, std::size_t n )
+    {
+        H h( seed );
+        hash2::hash_append_range( h, {}, p, p + n );
+
+        return hash2::get_integral_result<std::uint64_t>( h.result() );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::size_t bucket( std::uint64_t h ) noexcept
+    {
+        return static_cast<std::size_t>( ( h >> 32 ) % B );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::size_t position( std::uint64_t h, std::uint64_t d ) noexcept
+    {
+        return static_cast<std::size_t>( ( h ^ detail::pilot_hash( d ) ) % M );
+    }
+
+    // places the keys with seed; false when a bucket runs out of pilots
+
+    BOOST_CXX14_CONSTEXPR bool build( std::uint64_t seed, char const* const* p, std::size_t const* n )
+    {
+        seed_ = seed;
+
+        std::uint64_t h[ M ] = {};
+        std::size_t b[ M ] = {};
+
+        std::size_t first[ B + 1 ] = {}; // where the keys of each bucket start in order
+        std::size_t order[ M ] = {}; // the keys, by bucket
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            h[ i ] = hash_key( seed, p[ i ], n[ i ] );
+            b[ i ] = bucket( h[ i ] );
+
+            ++first[ b[ i ] + 1 ];
+        }
+
+        std::size_t max_size = 0;
+
+        for( std::size_t j = 0; j < B; ++j )
+        {
+            if( first[ j + 1 ] > max_size )
+            {
+                max_size = first[ j + 1 ];
+            }
+
+            first[ j + 1 ] += first[ j ];
+        }
+
+        {
+            std::size_t next[ B ] = {};
+
+            for( std::size_t i = 0; i < N; ++i )
+            {
+                order[ first[ b[ i ] ] + next[ b[ i ] ]++ ] = i;
+            }
+        }
+
+        bool taken[ M ] = {};
+        std::size_t keys[ M ] = {}; // the distinct keys of the current bucket
+
+        for( std::size_t k = 0; k < M; ++k )
+        {
+            key_[ k ] = nullptr;
+            size_[ k ] = 0;
+            index_[ k ] = npos;
+        }
+
+        for( std::size_t j = 0; j < B; ++j )
+        {
+            pilot_[ j ] = 0;
+        }
+
+        for( std::size_t s = max_size; s > 0; --s )
+        {
+            for( std::size_t j = 0; j < B; ++j )
+            {
+                if( first[ j + 1 ] - first[ j ] != s ) continue;
+
+                std::size_t const* q = order + first[ j ];
+
+                // a key given more than once keeps its first index; the
+                // later copies are dropped and leave their slots empty
+
+                std::size_t m = 0;
+
+                for( std::size_t i = 0; i < s; ++i )
+                {
+                    bool dup = false;
+
+                    for( std::size_t i2 = 0; i2 < m && !dup; ++i2 )
+                    {
+                        std::size_t x = keys[ i2 ], y = q[ i ];
+                        dup = h[ x ] == h[ y ] && n[ x ] == n[ y ] && detail::equal_chars( p[ x ], p[ y ], n[ x ] );
+                    }
+
+                    if( !dup )
+                    {
+                        keys[ m++ ] = q[ i ];
+                    }
+                }
+
+                std::size_t d = 0;
+
+                for( ; d < max_pilots; ++d )
+                {
+                    std::size_t i = 0;
+
+                    for( ; i < m; ++i )
+                    {
+                        std::size_t k = position( h[ keys[ i ] ], d );
+
+                        if( taken[ k ] ) break;
+                        taken[ k ] = true;
+                    }
+
+                    if( i == m ) break;
+
+                    // undo the partial placement
+
+                    for( std::size_t i2 = 0; i2 < i; ++i2 )
+                    {
+                        taken[ position( h[ keys[ i2 ] ], d ) ] = false;
+                    }
+                }
+
+                if( d == max_pilots ) return false;
+
+                pilot_[ j ] = static_cast<std::uint16_t>( d );
+
+                for( std::size_t i = 0; i < m; ++i )
+                {
+                    std::size_t k = position( h[ keys[ i ] ], d );
+
+                    key_[ k ] = p[ keys[ i ] ];
+                    size_[ k ] = n[ keys[ i ] ];
+                    index_[ k ] = keys[ i ];
+                }
+            }
+        }
+
+        return true;
+    }
+
+public:
+
+    // constructs the table for the keys [p[i], p[i]+n[i]), i in [0, N)
+
+    BOOST_CXX14_CONSTEXPR perfect_hash( char const* const* p, std::size_t const* n )
+    {
+        std::uint64_t seed = 0;
+
+        while( !build( seed, p, n ) )
+        {
+            ++seed;
+        }
+    }
+
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    // returns the index of the key [p, p+n), or npos if it's not one of the keys
+
+    BOOST_CXX14_CONSTEXPR std::size_t find( char const* p, std::size_t n ) const
+    {
+        std::uint64_t h = hash_key( seed_, p, n );
+        std::size_t k = position( h, pilot_[ bucket( h ) ] );
+
+        return size_[ k ] == n && key_[ k ] != nullptr && detail::equal_chars( key_[ k ], p, n )? index_[ k ]: npos;
+    }
+
+    template<class S>
+        BOOST_CXX14_CONSTEXPR
+        typename std::enable_if< container_hash::is_contiguous_range<S>::value, std::size_t >::type
+        find( S const& s ) const
+    {
+        return find( s.data(), s.size() );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::size_t find( char const* s ) const
+    {
+        return find( s, detail::string_length( s ) );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, std::size_t N> constexpr std::size_t perfect_hash<H, N>::npos;
+
+#endif
+
+// make_perfect_hash<H>( { "key1", "key2", ... } )
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR perfect_hash<H, N> make_perfect_hash( char const* const (&keys)[ N ] )
+{
+    std::size_t n[ N ] = {};
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        n[ i ] = detail::string_length( keys[ i ] );
+    }
+
+    return perfect_hash<H, N>( keys, n );
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+
+template<class H, std::size_t N> constexpr perfect_hash<H, N> make_perfect_hash( std::array<std::string_view, N> const& keys )
+{
+    char const* p[ N > 0? N: 1 ] = {};
+    std::size_t n[ N > 0? N: 1 ] = {};
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        p[ i ] = keys[ i ].data();
+        n[ i ] = keys[ i ].size();
+    }
+
+    return perfect_hash<H, N>( p, n );
+}
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_PERFECT_HASH_HPP_INCLUDED
@@ -0,0 +1,367 @@
+#ifndef BOOST_HASH2_POLY1305_HPP_INCLUDED
+#define BOOST_HASH2_POLY1305_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Poly1305, https://datatracker.ietf.org/doc/html/rfc8439#section-2.5
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/poly1305_x86.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The accumulator and r are kept in five limbs of 26 bits, as in
+// poly1305-donna, so that the products fit in 64 bits
+
+class poly1305
+{
+private:
+
+    // the key of the example in RFC 8439, section 2.5.2
+
+    std::uint32_t r_[ 5 ] = { 0x00BED685, 0x03555502, 0x0047C036, 0x01003949, 0x000806D5 };
+    std::uint32_t s_[ 4 ] = { 0x8A800301, 0xFDB20DFB, 0xAFF6BF4A, 0x1BF54941 };
+
+    std::uint32_t h_[ 5 ] = {};
+
+    unsigned char buffer_[ 16 ] = {};
+    std::size_t m_ = 0;
+
+private:
+
+    // h = h * r mod 2^130-5, partially reduced
+
+    BOOST_CXX14_CONSTEXPR static void multiply( std::uint32_t (&h)[ 5 ], std::uint32_t const (&r)[ 5 ] )
+    {
+        std::uint64_t const h0 = h[ 0 ], h1 = h[ 1 ], h2 = h[ 2 ], h3 = h[ 3 ], h4 = h[ 4 ];
+        std::uint64_t const r0 = r[ 0 ], r1 = r[ 1 ], r2 = r[ 2 ], r3 = r[ 3 ], r4 = r[ 4 ];
+        std::uint64_t const s1 = r1 * 5, s2 = r2 * 5, s3 = r3 * 5, s4 = r4 * 5;
+
+        std::uint64_t d0 = h0 * r0 + h1 * s4 + h2 * s3 + h3 * s2 + h4 * s1;
+        std::uint64_t d1 = h0 * r1 + h1 * r0 + h2 * s4 + h3 * s3 + h4 * s2;
+        std::uint64_t d2 = h0 * r2 + h1 * r1 + h2 * r0 + h3 * s4 + h4 * s3;
+        std::uint64_t d3 = h0 * r3 + h1 * r2 + h2 * r1 + h3 * r0 + h4 * s4;
+        std::uint64_t d4 = h0 * r4 + h1 * r3 + h2 * r2 + h3 * r1 + h4 * r0;
+
+        std::uint64_t c = 0;
+
+        c = d0 >> 26; d0 &= 0x3FFFFFF; d1 += c;
+        c = d1 >> 26; d1 &= 0x3FFFFFF; d2 += c;
+        c = d2 >> 26; d2 &= 0x3FFFFFF; d3 += c;
+        c = d3 >> 26; d3 &= 0x3FFFFFF; d4 += c;
+        c = d4 >> 26; d4 &= 0x3FFFFFF; d0 += c * 5;
+        c = d0 >> 26; d0 &= 0x3FFFFFF; d1 += c;
+
+        h[ 0 ] = static_cast<std::uint32_t>( d0 );
+        h[ 1 ] = static_cast<std::uint32_t>( d1 );
+        h[ 2 ] = static_cast<std::uint32_t>( d2 );
+        h[ 3 ] = static_cast<std::uint32_t>( d3 );
+        h[ 4 ] = static_cast<std::uint32_t>( d4 );
+    }
+
+    // h = ( h + m ) * r, where m is the 16 byte block at p, plus hibit * 2^128
+
+    BOOST_CXX14_CONSTEXPR static void block( std::uint32_t (&h)[ 5 ], std::uint32_t const (&r)[ 5 ], unsigned char const* p, std::uint32_t hibit )
+    {
+        h[ 0 ] += detail::read32le( p + 0 ) & 0x3FFFFFF;
+        h[ 1 ] += ( detail::read32le( p + 3 ) >> 2 ) & 0x3FFFFFF;
+        h[ 2 ] += ( detail::read32le( p + 6 ) >> 4 ) & 0x3FFFFFF;
+        h[ 3 ] += ( detail::read32le( p + 9 ) >> 6 ) & 0x3FFFFFF;
+        h[ 4 ] += ( detail::read32le( p + 12 ) >> 8 ) | ( hibit << 24 );
+
+        multiply( h, r );
+    }
+
+    BOOST_CXX14_CONSTEXPR void init( unsigned char const* k )
+    {
+        // r, clamped as the specification requires
+
+        r_[ 0 ] = detail::read32le( k + 0 ) & 0x3FFFFFF;
+        r_[ 1 ] = ( detail::read32le( k + 3 ) >> 2 ) & 0x3FFFF03;
+        r_[ 2 ] = ( detail::read32le( k + 6 ) >> 4 ) & 0x3FFC0FF;
+        r_[ 3 ] = ( detail::read32le( k + 9 ) >> 6 ) & 0x3F03FFF;
+        r_[ 4 ] = ( detail::read32le( k + 12 ) >> 8 ) & 0x00FFFFF;
+
+        s_[ 0 ] = detail::read32le( k + 16 );
+        s_[ 1 ] = detail::read32le( k + 20 );
+        s_[ 2 ] = detail::read32le( k + 24 );
+        s_[ 3 ] = detail::read32le( k + 28 );
+    }
+
+    BOOST_CXX14_CONSTEXPR void blocks( unsigned char const* p, std::size_t n )
+    {
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+        if( n >= 256 && !detail::is_constant_evaluated() && detail::has_x86_avx2() )
+        {
+            std::size_t const m = n & ~static_cast<std::size_t>( 63 );
+
+            // r, r^2, r^3, r^4
+
+            std::uint32_t rp[ 4 ][ 5 ] = {};
+
+            for( int i = 0; i < 5; ++i )
+            {
+                rp[ 0 ][ i ] = rp[ 1 ][ i ] = r_[ i ];
+            }
+
+            multiply( rp[ 1 ], r_ );
+
+            for( int i = 0; i < 5; ++i )
+            {
+                rp[ 2 ][ i ] = rp[ 3 ][ i ] = rp[ 1 ][ i ];
+            }
+
+            multiply( rp[ 2 ], r_ );
+            multiply( rp[ 3 ], rp[ 1 ] );
+
+            detail::poly1305_blocks_avx2( h_, rp, p, m );
+
+            p += m;
+            n -= m;
+        }
+
+#endif
+
+        while( n >= 16 )
+        {
+            block( h_, r_, p, 1 );
+
+            p += 16;
+            n -= 16;
+        }
+    }
+
+public:
+
+    using result_type = digest<16>;
+
+    poly1305() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit poly1305( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    // A 32 byte seed is the one-time key, r followed by s;
+    // other seeds are used as a prefix of the message
+
+    BOOST_CXX14_CONSTEXPR poly1305( unsigned char const * p, std::size_t n )
+    {
+        if( n == 32 )
+        {
+            init( p );
+        }
+        else if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( poly1305, "poly1305", n );
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 16 - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < 16 ) return;
+
+            block( h_, r_, buffer_, 1 );
+            m_ = 0;
+        }
+
+        std::size_t const m = n & ~static_cast<std::size_t>( 15 );
+
+        if( m > 0 )
+        {
+            blocks( p, m );
+
+            p += m;
+            n -= m;
+        }
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( poly1305, "poly1305" );
+
+        std::uint32_t h[ 5 ] = { h_[ 0 ], h_[ 1 ], h_[ 2 ], h_[ 3 ], h_[ 4 ] };
+
+        if( m_ > 0 )
+        {
+            // the partial last block, followed by a one byte
+
+            unsigned char tmp[ 16 ] = {};
+            detail::memcpy( tmp, buffer_, m_ );
+            tmp[ m_ ] = 1;
+
+            block( h, r_, tmp, 0 );
+        }
+
+        // full carry
+
+        std::uint32_t c = 0;
+
+        c = h[ 1 ] >> 26; h[ 1 ] &= 0x3FFFFFF; h[ 2 ] += c;
+        c = h[ 2 ] >> 26; h[ 2 ] &= 0x3FFFFFF; h[ 3 ] += c;
+        c = h[ 3 ] >> 26; h[ 3 ] &= 0x3FFFFFF; h[ 4 ] += c;
+        c = h[ 4 ] >> 26; h[ 4 ] &= 0x3FFFFFF; h[ 0 ] += c * 5;
+        c = h[ 0 ] >> 26; h[ 0 ] &= 0x3FFFFFF; h[ 1 ] += c;
+
+        // g = h + 5 - 2^130; h = g if g is not negative, without branches
+
+        std::uint32_t g[ 5 ] = {};
+
+        g[ 0 ] = h[ 0 ] + 5; c = g[ 0 ] >> 26; g[ 0 ] &= 0x3FFFFFF;
+        g[ 1 ] = h[ 1 ] + c; c = g[ 1 ] >> 26; g[ 1 ] &= 0x3FFFFFF;
+        g[ 2 ] = h[ 2 ] + c; c = g[ 2 ] >> 26; g[ 2 ] &= 0x3FFFFFF;
+        g[ 3 ] = h[ 3 ] + c; c = g[ 3 ] >> 26; g[ 3 ] &= 0x3FFFFFF;
+        g[ 4 ] = h[ 4 ] + c - ( 1u << 26 );
+
+        std::uint32_t const mask = ( g[ 4 ] >> 31 ) - 1;
+
+        for( int i = 0; i < 5; ++i )
+        {
+            h[ i ] = ( h[ i ] & ~mask ) | ( g[ i ] & mask );
+        }
+
+        // ( h + s ) mod 2^128
+
+        std::uint64_t f = 0;
+
+        f = static_cast<std::uint64_t>( ( h[ 0 ] | ( h[ 1 ] << 26 ) ) ) + s_[ 0 ];
+        std::uint32_t const t0 = static_cast<std::uint32_t>( f );
+
+        f = static_cast<std::uint64_t>( ( h[ 1 ] >> 6 ) | ( h[ 2 ] << 20 ) ) + s_[ 1 ] + ( f >> 32 );
+        std::uint32_t const t1 = static_cast<std::uint32_t>( f );
+
+        f = static_cast<std::uint64_t>( ( h[ 2 ] >> 12 ) | ( h[ 3 ] << 14 ) ) + s_[ 2 ] + ( f >> 32 );
+        std::uint32_t const t2 = static_cast<std::uint32_t>( f );
+
+        f = static_cast<std::uint64_t>( ( h[ 3 ] >> 18 ) | ( h[ 4 ] << 8 ) ) + s_[ 3 ] + ( f >> 32 );
+        std::uint32_t const t3 = static_cast<std::uint32_t>( f );
+
+        result_type r;
+
+        detail::write32le( r.data() + 0, t0 );
+        detail::write32le( r.data() + 4, t1 );
+        detail::write32le( r.data() + 8, t2 );
+        detail::write32le( r.data() + 12, t3 );
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp[ 1 ] = { 0xFF };
+        BOOST_HASH2_STATS_SUSPEND();
+        update( tmp, 1 );
+        BOOST_HASH2_STATS_RESUME();
+
+        return r;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.r_ );
+        ar.words( self.s_ );
+        ar.words( self.h_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 20 + 16 + 20 + 16 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        poly1305 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || tmp.m_ >= 16 ) return false;
+
+        // r must be clamped, and the limbs of h within the bounds
+        // that keep the products from overflowing
+
+        std::uint32_t const rmask[ 5 ] = { 0x3FFFFFF, 0x3FFFF03, 0x3FFC0FF, 0x3F03FFF, 0x00FFFFF };
+
+        for( int i = 0; i < 5; ++i )
+        {
+            if( ( tmp.r_[ i ] & ~rmask[ i ] ) != 0 || tmp.h_[ i ] >= ( 1u << 27 ) ) return false;
+        }
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_POLY1305_HPP_INCLUDED
@@ -0,0 +1,372 @@
+#ifndef BOOST_HASH2_POLYMUR_HPP_INCLUDED
+#define BOOST_HASH2_POLYMUR_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Polynomial hashing modulo 2^61-1, after PolymurHash,
+// https://github.com/orlp/polymur-hash
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// The message is split into 7 byte limbs m[0], ..., m[L-1], the last
+// one padded with zeroes, and the result is mix( H ) + s, where
+//
+//     H = m[0] * k^(L+1) + m[1] * k^L + ... + m[L-1] * k^2 + n * k
+//
+// modulo 2^61-1, n is the message length, and k and s are derived
+// from the seed. Two distinct messages of at most n bytes collide for
+// at most n / 7 + 2 of the about 2^61 values of k.
+//
+// Blocks of seven limbs are evaluated with the powers k^7, ..., k^1;
+// the seven products of a block are independent, and only the one
+// with the running sum is on the critical path.
+
+class polymur_64
+{
+private:
+
+    static constexpr std::uint64_t P = ( std::uint64_t( 1 ) << 61 ) - 1;
+
+    // the fractional bits of the square roots of 2, 3 and 5, as in PolymurHash
+
+    static constexpr std::uint64_t A1 = 0x6A09E667F3BCC908ull;
+    static constexpr std::uint64_t A2 = 0xBB67AE8584CAA73Bull;
+    static constexpr std::uint64_t A3 = 0x3C6EF372FE94F82Bull;
+
+    static constexpr std::size_t N = 49;
+
+    // k_[ i ] == k^(i+1); the values for seed 0
+
+    std::uint64_t k_[ 7 ] =
+    {
+        0x00A5CE825E9414B4ull, 0x12B326CAF6EC8A79ull, 0x14EA5178146CFD7Cull, 0x08B55E42A97A510Dull,
+        0x1E8C1E916AED0303ull, 0x1492EBE0A0BAF4E7ull, 0x13ECD225E4821761ull,
+    };
+
+    std::uint64_t s_ = 0x7ED8458A06E5DEB6ull;
+
+    std::uint64_t h_ = 0;
+
+    unsigned char buffer_[ N ] = {};
+    std::size_t m_ = 0; // == n_ % N
+
+    std::uint64_t n_ = 0;
+
+private:
+
+    // the mx3 mixer, https://jonkagstrom.com/mx3/mx3_rev2.html
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t mix( std::uint64_t x )
+    {
+        x ^= x >> 32;
+        x *= 0x0E9846AF9B1A615Dull;
+        x ^= x >> 32;
+        x *= 0x0E9846AF9B1A615Dull;
+        x ^= x >> 28;
+
+        return x;
+    }
+
+    // ( hi, lo ) += a * b
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static void mul_add( std::uint64_t& lo, std::uint64_t& hi, std::uint64_t a, std::uint64_t b )
+    {
+        std::uint64_t h = 0;
+        std::uint64_t l = detail::mul128( a, b, h );
+
+        lo += l;
+        hi += h + ( lo < l );
+    }
+
+    // ( hi, lo ) mod P, for ( hi, lo ) < 2^124
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t reduce( std::uint64_t lo, std::uint64_t hi )
+    {
+        std::uint64_t x = ( lo & P ) + ( ( lo >> 61 ) | ( hi << 3 ) );
+
+        x = ( x & P ) + ( x >> 61 );
+
+        return x >= P? x - P: x;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t limb( unsigned char const* p )
+    {
+        return detail::read64le( p ) & 0x00FFFFFFFFFFFFFFull;
+    }
+
+    // The sum of eight products of at most ( 2^61 + 2^56 ) * 2^61
+    // stays below 2^124, so a block needs a single reduction
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t block( std::uint64_t h, unsigned char const* p ) const
+    {
+        std::uint64_t lo = 0, hi = 0;
+
+        mul_add( lo, hi, h + limb( p ), k_[ 6 ] );
+        mul_add( lo, hi, limb( p + 7 ), k_[ 5 ] );
+        mul_add( lo, hi, limb( p + 14 ), k_[ 4 ] );
+        mul_add( lo, hi, limb( p + 21 ), k_[ 3 ] );
+        mul_add( lo, hi, limb( p + 28 ), k_[ 2 ] );
+        mul_add( lo, hi, limb( p + 35 ), k_[ 1 ] );
+        mul_add( lo, hi, detail::read64le( p + 41 ) >> 8, k_[ 0 ] );
+
+        return reduce( lo, hi );
+    }
+
+    BOOST_CXX14_CONSTEXPR void init( std::uint64_t k_seed, std::uint64_t s_seed )
+    {
+        s_ = s_seed ^ A1;
+
+        std::uint64_t k = 0;
+
+        do
+        {
+            k_seed += A2;
+            k = mix( k_seed ) & P;
+        }
+        while( k < 2 || k == P );
+
+        k_[ 0 ] = k;
+        powers();
+    }
+
+    // k_[ 1 ], ..., k_[ 6 ] from k_[ 0 ]
+
+    BOOST_CXX14_CONSTEXPR void powers()
+    {
+        for( int i = 1; i < 7; ++i )
+        {
+            std::uint64_t lo = 0, hi = 0;
+            mul_add( lo, hi, k_[ i - 1 ], k_[ 0 ] );
+
+            k_[ i ] = reduce( lo, hi );
+        }
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+
+    polymur_64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit polymur_64( std::uint64_t seed )
+    {
+        init( mix( seed ), mix( seed + A3 ) );
+    }
+
+    // A 16 byte seed is used as the two 64 bit keys, from which k and s
+    // are derived; other seeds are hashed to obtain them
+
+    BOOST_CXX14_CONSTEXPR polymur_64( unsigned char const * p, std::size_t n )
+    {
+        if( n == 16 )
+        {
+            init( detail::read64le( p + 0 ), detail::read64le( p + 8 ) );
+        }
+        else if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+
+            update( p, n );
+
+            std::uint64_t k_seed = result();
+            std::uint64_t s_seed = result();
+
+            BOOST_HASH2_STATS_RESUME();
+
+            *this = polymur_64();
+            init( k_seed, s_seed );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( polymur_64, "polymur_64", n );
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            h_ = block( h_, buffer_ );
+            m_ = 0;
+        }
+
+        std::uint64_t h = h_;
+
+        while( n >= N )
+        {
+            h = block( h, p );
+
+            p += N;
+            n -= N;
+        }
+
+        h_ = h;
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( polymur_64, "polymur_64" );
+
+        std::uint64_t h = h_;
+
+        if( m_ > 0 )
+        {
+            // the t limbs of the partial last block, with k^t, ..., k^1
+
+            unsigned char tmp[ 56 ] = {};
+            detail::memcpy( tmp, buffer_, m_ );
+
+            std::size_t const t = ( m_ + 6 ) / 7;
+
+            std::uint64_t lo = 0, hi = 0;
+
+            mul_add( lo, hi, h + limb( tmp ), k_[ t - 1 ] );
+
+            for( std::size_t i = 1; i < t; ++i )
+            {
+                mul_add( lo, hi, limb( tmp + 7 * i ), k_[ t - 1 - i ] );
+            }
+
+            h = reduce( lo, hi );
+        }
+
+        {
+            std::uint64_t lo = 0, hi = 0;
+            mul_add( lo, hi, h + ( n_ & P ) + ( n_ >> 61 ), k_[ 0 ] );
+
+            h = reduce( lo, hi );
+        }
+
+        std::uint64_t r = mix( h ) + s_;
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp[ 1 ] = { 0xFF };
+        BOOST_HASH2_STATS_SUSPEND();
+        update( tmp, 1 );
+        BOOST_HASH2_STATS_RESUME();
+
+        return r;
+    }
+
+    // One-shot hashing, equivalent to constructing from seed and
+    // calling update( p, n ) and result()
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        polymur_64 h( seed );
+        h.update( p, n );
+
+        return h.result();
+    }
+
+    static std::uint64_t hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u64( self.k_[ 0 ] );
+        ar.u64( self.s_ );
+        ar.u64( self.h_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming; the
+    // powers of k are recomputed on load
+
+    static constexpr std::size_t state_size = 1 + 8 + 8 + 8 + N + 8 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        polymur_64 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        std::uint64_t const k = tmp.k_[ 0 ];
+
+        if( !ar.ok() || k < 2 || k >= P || tmp.h_ >= P || !( tmp.m_ < N && tmp.m_ == tmp.n_ % N ) ) return false;
+
+        tmp.powers();
+
+        *this = tmp;
+        return true;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+constexpr std::uint64_t polymur_64::P;
+constexpr std::uint64_t polymur_64::A1;
+constexpr std::uint64_t polymur_64::A2;
+constexpr std::uint64_t polymur_64::A3;
+constexpr std::size_t polymur_64::N;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_POLYMUR_HPP_INCLUDED
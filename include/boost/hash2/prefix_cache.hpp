@@ -0,0 +1,175 @@
+#ifndef BOOST_HASH2_PREFIX_CACHE_HPP_INCLUDED
+#define BOOST_HASH2_PREFIX_CACHE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// prefix_cache, the states of a hash algorithm after absorbing
+// frequently used message prefixes
+
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/assert.hpp>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// prefix_cache<H>
+//
+// get( p, n ) returns a copy of the state of H after update( p, n ); the
+// states of the most recently used prefixes are kept in a small cache,
+// looked up by a rapidhash_64 of the prefix, which is much cheaper than
+// absorbing it into a cryptographic hash, and verified by comparing the
+// prefix bytes, so that a collision never returns the wrong state
+
+template<class H> class prefix_cache
+{
+private:
+
+    struct entry
+    {
+        std::uint64_t key;
+        std::uint64_t tick;
+
+        std::vector<unsigned char> prefix;
+        H h;
+    };
+
+    H h0_;
+
+    std::size_t capacity_;
+    std::vector<entry> entries_;
+
+    std::uint64_t tick_ = 0;
+
+    static std::uint64_t key( unsigned char const* p, std::size_t n ) noexcept
+    {
+        return rapidhash_64::hash( p, n );
+    }
+
+    // the index of the entry for [p, p + n), or size() when there's none
+
+    std::size_t find( std::uint64_t k, unsigned char const* p, std::size_t n ) const noexcept
+    {
+        std::size_t i = 0;
+
+        for( ; i < entries_.size(); ++i )
+        {
+            entry const& e = entries_[ i ];
+
+            if( e.key == k && e.prefix.size() == n && ( n == 0 || std::memcmp( e.prefix.data(), p, n ) == 0 ) )
+            {
+                break;
+            }
+        }
+
+        return i;
+    }
+
+public:
+
+    using hash_type = H;
+
+    explicit prefix_cache( std::size_t capacity = 8 ): capacity_( capacity )
+    {
+        BOOST_ASSERT( capacity > 0 );
+        entries_.reserve( capacity );
+    }
+
+    // the prefixes are absorbed into copies of h, which can be seeded
+
+    explicit prefix_cache( H const& h, std::size_t capacity = 8 ): h0_( h ), capacity_( capacity )
+    {
+        BOOST_ASSERT( capacity > 0 );
+        entries_.reserve( capacity );
+    }
+
+    prefix_cache( prefix_cache const& ) = default;
+    prefix_cache& operator=( prefix_cache const& ) = default;
+
+    // a copy of the initial state after update( p, n ); when the prefix
+    // isn't cached, the least recently used entry is replaced
+
+    H get( unsigned char const* p, std::size_t n )
+    {
+        std::uint64_t const k = key( p, n );
+
+        std::size_t const i = find( k, p, n );
+
+        if( i < entries_.size() )
+        {
+            entries_[ i ].tick = ++tick_;
+            return entries_[ i ].h;
+        }
+
+        H h( h0_ );
+        h.update( p, n );
+
+        entry* e = nullptr;
+
+        if( entries_.size() < capacity_ )
+        {
+            entries_.push_back( entry{ k, 0, {}, h0_ } );
+            e = &entries_.back();
+        }
+        else
+        {
+            e = &entries_.front();
+
+            for( entry& e2: entries_ )
+            {
+                if( e2.tick < e->tick ) e = &e2;
+            }
+        }
+
+        e->key = k;
+        e->tick = ++tick_;
+        e->prefix.assign( p, p + n );
+        e->h = h;
+
+        return h;
+    }
+
+    H get( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        return get( p, n );
+    }
+
+    bool contains( unsigned char const* p, std::size_t n ) const noexcept
+    {
+        return find( key( p, n ), p, n ) < entries_.size();
+    }
+
+    bool contains( void const* pv, std::size_t n ) const noexcept
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        return contains( p, n );
+    }
+
+    std::size_t size() const noexcept
+    {
+        return entries_.size();
+    }
+
+    std::size_t capacity() const noexcept
+    {
+        return capacity_;
+    }
+
+    void clear() noexcept
+    {
+        entries_.clear();
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_PREFIX_CACHE_HPP_INCLUDED
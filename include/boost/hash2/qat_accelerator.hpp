@@ -0,0 +1,377 @@
+#ifndef BOOST_HASH2_QAT_ACCELERATOR_HPP_INCLUDED
+#define BOOST_HASH2_QAT_ACCELERATOR_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// qat_accelerator, an accelerator that computes the hashes and HMACs of
+// the MD5 and SHA families on an Intel QuickAssist (QAT) device
+//
+// This header requires the QAT user space library (qatlib), and linking
+// with -lqat -lusdm; the rest of the library doesn't
+
+#include <boost/hash2/accelerator.hpp>
+#include <qat/cpa.h>
+#include <qat/cpa_cy_im.h>
+#include <qat/cpa_cy_sym.h>
+#include <qat/icp_sal_user.h>
+#include <qat/icp_sal_poll.h>
+#include <qat/qae_mem.h>
+#include <system_error>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// qat_accelerator uses a crypto instance of the QAT device, polled by
+// the thread calling poll; it's used by one thread at a time, and has
+// at most one batch in flight; a batch submitted while another is, or
+// when no device is available, is hashed on the CPU
+
+class qat_accelerator: public accelerator
+{
+private:
+
+    // a message in flight, in memory the device can access
+
+    struct op
+    {
+        CpaFlatBuffer flat;
+        CpaBufferList list;
+        CpaCySymOpData data;
+
+        unsigned char* digest;
+
+        CpaStatus status;
+        bool done;
+    };
+
+    CpaInstanceHandle instance_;
+    int node_;
+
+    std::size_t offload_size_;
+
+    bool started_;
+    bool available_;
+
+    // the batch in flight
+
+    offload_batch const* batch_;
+
+    void* session_;
+    std::vector<op> ops_;
+
+    std::size_t submitted_;
+    std::size_t completed_;
+
+    bool failed_;
+
+private:
+
+    static void callback( void* tag, CpaStatus status, CpaCySymOp, void*, CpaBufferList*, CpaBoolean )
+    {
+        op* p = static_cast<op*>( tag );
+
+        p->status = status;
+        p->done = true;
+    }
+
+    static bool hash_algorithm( char const* name, CpaCySymHashAlgorithm& r ) noexcept
+    {
+        if( std::strcmp( name, "md5" ) == 0 ) { r = CPA_CY_SYM_HASH_MD5; return true; }
+        if( std::strcmp( name, "sha1" ) == 0 ) { r = CPA_CY_SYM_HASH_SHA1; return true; }
+        if( std::strcmp( name, "sha224" ) == 0 ) { r = CPA_CY_SYM_HASH_SHA224; return true; }
+        if( std::strcmp( name, "sha256" ) == 0 ) { r = CPA_CY_SYM_HASH_SHA256; return true; }
+        if( std::strcmp( name, "sha384" ) == 0 ) { r = CPA_CY_SYM_HASH_SHA384; return true; }
+        if( std::strcmp( name, "sha512" ) == 0 ) { r = CPA_CY_SYM_HASH_SHA512; return true; }
+
+        return false;
+    }
+
+    void* allocate( std::size_t n )
+    {
+        return qaeMemAllocNUMA( n, node_, 64 );
+    }
+
+    static void deallocate( void* p )
+    {
+        if( p ) qaeMemFreeNUMA( &p );
+    }
+
+    // frees the memory of the batch in flight, once the device is done
+
+    void release()
+    {
+        for( std::size_t i = 0; i < ops_.size(); ++i )
+        {
+            deallocate( ops_[ i ].flat.pData );
+            deallocate( ops_[ i ].list.pPrivateMetaData );
+            deallocate( ops_[ i ].digest );
+        }
+
+        ops_.clear();
+
+        if( session_ )
+        {
+            cpaCySymRemoveSession( instance_, session_ );
+            deallocate( session_ );
+
+            session_ = 0;
+        }
+
+        batch_ = 0;
+    }
+
+    // queues the messages not yet submitted, polling the device while
+    // its ring is full
+
+    void submit_pending()
+    {
+        while( !failed_ && submitted_ < ops_.size() )
+        {
+            op& o = ops_[ submitted_ ];
+
+            CpaBoolean verify = CPA_FALSE;
+            CpaStatus st = cpaCySymPerformOp( instance_, &o, &o.data, &o.list, &o.list, &verify );
+
+            if( st == CPA_STATUS_RETRY )
+            {
+                icp_sal_CyPollInstance( instance_, 0 );
+                continue;
+            }
+
+            if( st != CPA_STATUS_SUCCESS )
+            {
+                failed_ = true;
+                break;
+            }
+
+            ++submitted_;
+        }
+    }
+
+public:
+
+    // messages of at least offload_size bytes are hashed by the device;
+    // the default is where, on a typical device, the latency of the
+    // offload is repaid
+
+    explicit qat_accelerator( std::size_t offload_size = 16384, Cpa16U instance = 0 ):
+        instance_( 0 ), node_( 0 ), offload_size_( offload_size == 0? 1: offload_size ), started_( false ), available_( false ),
+        batch_( 0 ), session_( 0 ), submitted_( 0 ), completed_( 0 ), failed_( false )
+    {
+        started_ = icp_sal_userStartMultiProcess( "SSL", CPA_FALSE ) == CPA_STATUS_SUCCESS;
+
+        if( !started_ ) return;
+
+        Cpa16U n = 0;
+
+        if( cpaCyGetNumInstances( &n ) != CPA_STATUS_SUCCESS || instance >= n ) return;
+
+        std::vector<CpaInstanceHandle> v( n );
+
+        if( cpaCyGetInstances( n, v.data() ) != CPA_STATUS_SUCCESS ) return;
+
+        instance_ = v[ instance ];
+
+        CpaInstanceInfo2 info;
+
+        if( cpaCyInstanceGetInfo2( instance_, &info ) == CPA_STATUS_SUCCESS )
+        {
+            node_ = static_cast<int>( info.nodeAffinity );
+        }
+
+        if( cpaCySetAddressTranslation( instance_, qaeVirtToPhysNUMA ) != CPA_STATUS_SUCCESS ) return;
+        if( cpaCyStartInstance( instance_ ) != CPA_STATUS_SUCCESS ) return;
+
+        available_ = true;
+    }
+
+    qat_accelerator( qat_accelerator const& ) = delete;
+    qat_accelerator& operator=( qat_accelerator const& ) = delete;
+
+    ~qat_accelerator()
+    {
+        if( batch_ )
+        {
+            // the batch is abandoned; the device still needs its memory
+
+            for( std::size_t i = 0; i < submitted_; )
+            {
+                if( ops_[ i ].done )
+                {
+                    ++i;
+                }
+                else
+                {
+                    icp_sal_CyPollInstance( instance_, 0 );
+                }
+            }
+
+            release();
+        }
+
+        if( available_ ) cpaCyStopInstance( instance_ );
+        if( started_ ) icp_sal_userStop();
+    }
+
+    // whether a device has been found and started
+
+    bool available() const noexcept
+    {
+        return available_;
+    }
+
+    std::size_t offload_size() const noexcept override
+    {
+        return offload_size_;
+    }
+
+    bool submit( offload_batch const& b, std::error_code& ec ) override
+    {
+        CpaCySymHashAlgorithm alg;
+
+        if( !available_ || batch_ || !hash_algorithm( b.algorithm, alg ) ) return false;
+
+        // the device doesn't take empty HMAC keys
+
+        if( b.hmac && b.key_size == 0 ) return false;
+
+        CpaCySymSessionSetupData sd;
+        std::memset( &sd, 0, sizeof( sd ) );
+
+        sd.sessionPriority = CPA_CY_PRIORITY_NORMAL;
+        sd.symOperation = CPA_CY_SYM_OP_HASH;
+        sd.hashSetupData.hashAlgorithm = alg;
+        sd.hashSetupData.hashMode = b.hmac? CPA_CY_SYM_HASH_MODE_AUTH: CPA_CY_SYM_HASH_MODE_PLAIN;
+        sd.hashSetupData.digestResultLenInBytes = static_cast<Cpa32U>( b.digest_size );
+        sd.hashSetupData.authModeSetupData.authKey = const_cast<Cpa8U*>( b.key );
+        sd.hashSetupData.authModeSetupData.authKeyLenInBytes = static_cast<Cpa32U>( b.key_size );
+        sd.digestIsAppended = CPA_FALSE;
+        sd.verifyDigest = CPA_FALSE;
+
+        Cpa32U size = 0;
+        Cpa32U meta = 0;
+
+        if( cpaCySymSessionCtxGetSize( instance_, &sd, &size ) != CPA_STATUS_SUCCESS ) return false;
+        if( cpaCyBufferListGetMetaSize( instance_, 1, &meta ) != CPA_STATUS_SUCCESS ) return false;
+
+        for( std::size_t j = 0; j < b.size; ++j )
+        {
+            if( b.messages[ j ].size > 0xFFFFFFFFu ) return false;
+        }
+
+        batch_ = &b;
+        submitted_ = completed_ = 0;
+        failed_ = false;
+
+        session_ = allocate( size );
+
+        if( !session_ || cpaCySymInitSession( instance_, &qat_accelerator::callback, &sd, session_ ) != CPA_STATUS_SUCCESS )
+        {
+            deallocate( session_ );
+            session_ = 0;
+
+            batch_ = 0;
+            return false;
+        }
+
+        // the messages are copied to memory the device can access
+
+        ops_.resize( b.size );
+
+        for( std::size_t j = 0; j < b.size; ++j )
+        {
+            op& o = ops_[ j ];
+            std::memset( &o, 0, sizeof( o ) );
+
+            o.flat.dataLenInBytes = static_cast<Cpa32U>( b.messages[ j ].size );
+            o.flat.pData = static_cast<Cpa8U*>( allocate( b.messages[ j ].size ) );
+
+            o.list.numBuffers = 1;
+            o.list.pBuffers = &o.flat;
+            o.list.pPrivateMetaData = meta? allocate( meta ): 0;
+
+            o.digest = static_cast<unsigned char*>( allocate( b.digest_size ) );
+
+            if( !o.flat.pData || ( meta && !o.list.pPrivateMetaData ) || !o.digest )
+            {
+                ops_.resize( j + 1 );
+                release();
+
+                ec = std::make_error_code( std::errc::not_enough_memory );
+                return true;
+            }
+
+            std::memcpy( o.flat.pData, b.messages[ j ].data, b.messages[ j ].size );
+
+            o.data.sessionCtx = session_;
+            o.data.packetType = CPA_CY_SYM_PACKET_TYPE_FULL;
+            o.data.hashStartSrcOffsetInBytes = 0;
+            o.data.messageLenToHashInBytes = static_cast<Cpa32U>( b.messages[ j ].size );
+            o.data.pDigestResult = o.digest;
+        }
+
+        submit_pending();
+
+        if( failed_ && submitted_ == 0 )
+        {
+            release();
+
+            ec = std::make_error_code( std::errc::io_error );
+        }
+
+        return true;
+    }
+
+    bool poll( offload_batch const& b, std::error_code& ec ) override
+    {
+        if( batch_ != &b ) return true;
+
+        icp_sal_CyPollInstance( instance_, 0 );
+
+        submit_pending();
+
+        completed_ = 0;
+
+        for( std::size_t i = 0; i < submitted_; ++i )
+        {
+            completed_ += ops_[ i ].done;
+        }
+
+        if( completed_ < submitted_ ) return false;
+
+        bool ok = !failed_;
+
+        for( std::size_t i = 0; i < ops_.size() && ok; ++i )
+        {
+            ok = ops_[ i ].status == CPA_STATUS_SUCCESS;
+        }
+
+        if( ok )
+        {
+            for( std::size_t i = 0; i < ops_.size(); ++i )
+            {
+                std::memcpy( b.messages[ i ].digest, ops_[ i ].digest, b.digest_size );
+            }
+        }
+        else
+        {
+            ec = std::make_error_code( std::errc::io_error );
+        }
+
+        release();
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_QAT_ACCELERATOR_HPP_INCLUDED
@@ -0,0 +1,137 @@
+#ifndef BOOST_HASH2_RANDOM_SEED_HPP_INCLUDED
+#define BOOST_HASH2_RANDOM_SEED_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// random_seed, a per-process random seed for hash flooding resistance,
+// and randomly_seeded<H>, a hash algorithm seeded with it by default
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <random>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(__linux__)
+# include <sys/syscall.h>
+# include <unistd.h>
+# include <cerrno>
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+# include <stdlib.h>
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// fills [p, p+n) from the entropy source of the operating system;
+// returns false if there is none, or it fails
+
+inline bool random_bytes_os( unsigned char* p, std::size_t n ) noexcept
+{
+#if defined(__linux__) && defined(SYS_getrandom)
+
+    while( n > 0 )
+    {
+        long r = ::syscall( SYS_getrandom, p, n, 0 );
+
+        if( r < 0 )
+        {
+            if( errno == EINTR ) continue;
+            return false;
+        }
+
+        p += r;
+        n -= static_cast<std::size_t>( r );
+    }
+
+    return true;
+
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+
+    ::arc4random_buf( p, n );
+    return true;
+
+#else
+
+    (void)p;
+    (void)n;
+
+    return false;
+
+#endif
+}
+
+inline digest<32> make_random_seed()
+{
+    digest<32> r;
+
+    if( !detail::random_bytes_os( r.data(), r.size() ) )
+    {
+        std::random_device rd;
+
+        for( std::size_t i = 0; i < r.size(); i += 4 )
+        {
+            std::uint32_t x = rd();
+
+            r[ i + 0 ] = static_cast<unsigned char>( x );
+            r[ i + 1 ] = static_cast<unsigned char>( x >> 8 );
+            r[ i + 2 ] = static_cast<unsigned char>( x >> 16 );
+            r[ i + 3 ] = static_cast<unsigned char>( x >> 24 );
+        }
+    }
+
+    return r;
+}
+
+} // namespace detail
+
+// 32 random bytes, obtained from the operating system on first use, with
+// a single call where it has one (getrandom on Linux, arc4random_buf on
+// macOS and the BSDs), and std::random_device otherwise; the same for the
+// rest of the process
+
+inline digest<32> const& random_seed_bytes()
+{
+    static digest<32> const r = detail::make_random_seed();
+    return r;
+}
+
+// the first eight of the random bytes, as a 64 bit seed
+
+inline std::uint64_t random_seed()
+{
+    return detail::read64le( hash2::random_seed_bytes().data() );
+}
+
+// randomly_seeded<H>, H whose default constructor seeds it with the
+// random bytes; for instance, hash<T, randomly_seeded<siphash_64>> makes
+// every default constructed container use the per-process seed
+
+template<class H> class randomly_seeded: public H
+{
+public:
+
+    randomly_seeded(): H( hash2::random_seed_bytes().data(), hash2::random_seed_bytes().size() )
+    {
+    }
+
+    explicit randomly_seeded( std::uint64_t seed ): H( seed )
+    {
+    }
+
+    randomly_seeded( unsigned char const* p, std::size_t n ): H( p, n )
+    {
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_RANDOM_SEED_HPP_INCLUDED
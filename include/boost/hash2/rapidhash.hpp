@@ -0,0 +1,397 @@
+#ifndef BOOST_HASH2_RAPIDHASH_HPP_INCLUDED
+#define BOOST_HASH2_RAPIDHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// rapidhash, https://github.com/Nicoshev/rapidhash
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+class rapidhash_64
+{
+private:
+
+    static constexpr std::uint64_t P0 = 0x2d358dccaa6c78a5ull;
+    static constexpr std::uint64_t P1 = 0x8bb84b93962eacc9ull;
+    static constexpr std::uint64_t P2 = 0x4b33a62ed433d4a3ull;
+
+    // Inputs of up to short_size bytes are kept in buffer_ until result(),
+    // and hashed exactly as by rapidhash. Longer ones are processed in
+    // 96 byte blocks as they arrive, before their length is known, so the
+    // length isn't mixed into the initial seed, as rapidhash does; it's
+    // only mixed in at the end.
+
+    static constexpr std::size_t short_size = 112;
+
+private:
+
+    // the seed, premixed
+    std::uint64_t seed_ = premix( 0 );
+
+    // the three lanes of the block loop
+    std::uint64_t s0_ = 0;
+    std::uint64_t s1_ = 0;
+    std::uint64_t s2_ = 0;
+
+    // While n_ <= short_size, buffer_ holds the whole input. After that,
+    // its first 16 bytes are the last 16 bytes of the processed blocks,
+    // which the final step may read, followed by the 1 to 96 unprocessed
+    // bytes.
+    unsigned char buffer_[ short_size ] = {};
+
+    std::uint64_t n_ = 0;
+
+private:
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t mix( std::uint64_t a, std::uint64_t b )
+    {
+        std::uint64_t hi = 0;
+        std::uint64_t lo = detail::mul128( a, b, hi );
+
+        return lo ^ hi;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t premix( std::uint64_t seed )
+    {
+        return seed ^ mix( seed ^ P0, P1 );
+    }
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static void block( unsigned char const* p, std::uint64_t& s0, std::uint64_t& s1, std::uint64_t& s2 )
+    {
+        s0 = mix( detail::read64le( p +  0 ) ^ P0, detail::read64le( p +  8 ) ^ s0 );
+        s1 = mix( detail::read64le( p + 16 ) ^ P1, detail::read64le( p + 24 ) ^ s1 );
+        s2 = mix( detail::read64le( p + 32 ) ^ P2, detail::read64le( p + 40 ) ^ s2 );
+        s0 = mix( detail::read64le( p + 48 ) ^ P0, detail::read64le( p + 56 ) ^ s0 );
+        s1 = mix( detail::read64le( p + 64 ) ^ P1, detail::read64le( p + 72 ) ^ s1 );
+        s2 = mix( detail::read64le( p + 80 ) ^ P2, detail::read64le( p + 88 ) ^ s2 );
+    }
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t finalize( std::uint64_t a, std::uint64_t b, std::uint64_t seed, std::uint64_t n )
+    {
+        a ^= P1;
+        b ^= seed;
+
+        a = detail::mul128( a, b, b );
+
+        return mix( a ^ P0 ^ n, b ^ P1 );
+    }
+
+    // the last 0 to 48 bytes [p, p+m) of an input of n > 16 bytes;
+    // reads the 16 bytes before p when m < 16
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t tail( unsigned char const* p, std::size_t m, std::uint64_t n, std::uint64_t seed )
+    {
+        if( m > 16 )
+        {
+            seed = mix( detail::read64le( p ) ^ P2, detail::read64le( p + 8 ) ^ seed ^ P1 );
+
+            if( m > 32 )
+            {
+                seed = mix( detail::read64le( p + 16 ) ^ P2, detail::read64le( p + 24 ) ^ seed );
+            }
+        }
+
+        return finalize( detail::read64le( p + m - 16 ), detail::read64le( p + m - 8 ), seed, n );
+    }
+
+    // the last 0 to 96 bytes [p, p+m) of an input of n > 48 bytes, after
+    // its blocks; reads the 16 bytes before p when m < 16
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t tail_long( unsigned char const* p, std::size_t m, std::uint64_t n, std::uint64_t s0, std::uint64_t s1, std::uint64_t s2 )
+    {
+        if( m >= 96 )
+        {
+            block( p, s0, s1, s2 );
+
+            p += 96;
+            m -= 96;
+        }
+
+        if( m >= 48 )
+        {
+            s0 = mix( detail::read64le( p +  0 ) ^ P0, detail::read64le( p +  8 ) ^ s0 );
+            s1 = mix( detail::read64le( p + 16 ) ^ P1, detail::read64le( p + 24 ) ^ s1 );
+            s2 = mix( detail::read64le( p + 32 ) ^ P2, detail::read64le( p + 40 ) ^ s2 );
+
+            p += 48;
+            m -= 48;
+        }
+
+        return tail( p, m, n, s0 ^ s1 ^ s2 );
+    }
+
+    // rapidhash, with a premixed seed
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash_short( unsigned char const* p, std::size_t n, std::uint64_t seed )
+    {
+        seed ^= n;
+
+        if( n <= 16 )
+        {
+            std::uint64_t a = 0;
+            std::uint64_t b = 0;
+
+            if( n >= 4 )
+            {
+                unsigned char const* q = p + n - 4;
+                std::size_t d = ( n & 24 ) >> ( n >> 3 );
+
+                a = static_cast<std::uint64_t>( detail::read32le( p ) ) << 32 | detail::read32le( q );
+                b = static_cast<std::uint64_t>( detail::read32le( p + d ) ) << 32 | detail::read32le( q - d );
+            }
+            else if( n > 0 )
+            {
+                a = static_cast<std::uint64_t>( p[ 0 ] ) << 56 | static_cast<std::uint64_t>( p[ n >> 1 ] ) << 32 | p[ n - 1 ];
+            }
+
+            return finalize( a, b, seed, n );
+        }
+
+        if( n <= 48 )
+        {
+            return tail( p, n, n, seed );
+        }
+
+        std::uint64_t s0 = seed;
+        std::uint64_t s1 = seed;
+        std::uint64_t s2 = seed;
+
+        std::size_t m = n;
+
+        for( ; m >= 96; p += 96, m -= 96 )
+        {
+            block( p, s0, s1, s2 );
+        }
+
+        return tail_long( p, m, n, s0, s1, s2 );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::size_t buffered() const
+    {
+        return n_ <= short_size? static_cast<std::size_t>( n_ ): 16 + static_cast<std::size_t>( ( n_ - 1 ) % 96 ) + 1;
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+
+    rapidhash_64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit rapidhash_64( std::uint64_t seed ): seed_( premix( seed ) )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR rapidhash_64( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( rapidhash_64, "rapidhash_64", n );
+
+        if( n == 0 ) return;
+
+        std::size_t m = buffered();
+        bool long_ = n_ > short_size;
+
+        n_ += n;
+
+        for( ;; )
+        {
+            std::size_t k = short_size - m;
+
+            if( n <= k )
+            {
+                detail::memcpy( buffer_ + m, p, n );
+                return;
+            }
+
+            // buffer_ is full, and more input follows, so its unprocessed
+            // bytes aren't the last ones
+
+            detail::memcpy( buffer_ + m, p, k );
+
+            p += k;
+            n -= k;
+
+            if( !long_ )
+            {
+                s0_ = s1_ = s2_ = seed_;
+
+                block( buffer_, s0_, s1_, s2_ );
+                detail::memcpy( buffer_, buffer_ + 80, 32 );
+
+                m = 32;
+                long_ = true;
+            }
+            else
+            {
+                block( buffer_ + 16, s0_, s1_, s2_ );
+                detail::memcpy( buffer_, buffer_ + 96, 16 );
+
+                m = 16;
+
+                if( n > 96 )
+                {
+                    std::uint64_t s0 = s0_;
+                    std::uint64_t s1 = s1_;
+                    std::uint64_t s2 = s2_;
+
+                    do
+                    {
+                        block( p, s0, s1, s2 );
+
+                        p += 96;
+                        n -= 96;
+                    }
+                    while( n > 96 );
+
+                    s0_ = s0;
+                    s1_ = s1;
+                    s2_ = s2;
+
+                    detail::memcpy( buffer_, p - 16, 16 );
+                }
+            }
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( rapidhash_64, "rapidhash_64" );
+
+        std::uint64_t r = 0;
+
+        if( n_ <= short_size )
+        {
+            r = hash_short( buffer_, static_cast<std::size_t>( n_ ), seed_ );
+        }
+        else
+        {
+            std::size_t m = buffered();
+            r = tail_long( buffer_ + 16, m - 16, n_, s0_, s1_, s2_ );
+        }
+
+        // clear buffered plaintext
+        detail::memset( buffer_, 0, short_size );
+
+        // start over, seeded with the result, so that repeated calls
+        // return a pseudorandom sequence
+        seed_ = premix( r );
+
+        s0_ = s1_ = s2_ = 0;
+        n_ = 0;
+
+        return r;
+    }
+
+    // One-shot hashing, equivalent to constructing from seed and calling
+    // update( p, n ) and result(), but reading the input in place
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        BOOST_HASH2_STATS_MESSAGES( rapidhash_64, "rapidhash_64", 1, n );
+
+        seed = premix( seed );
+
+        if( n <= short_size )
+        {
+            return hash_short( p, n, seed );
+        }
+
+        std::uint64_t s0 = seed;
+        std::uint64_t s1 = seed;
+        std::uint64_t s2 = seed;
+
+        std::size_t m = n;
+
+        for( ; m > 96; p += 96, m -= 96 )
+        {
+            block( p, s0, s1, s2 );
+        }
+
+        return tail_long( p, m, n, s0, s1, s2 );
+    }
+
+    static std::uint64_t hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u64( self.seed_ );
+
+        ar.u64( self.s0_ );
+        ar.u64( self.s1_ );
+        ar.u64( self.s2_ );
+
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 153;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        rapidhash_64 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_RAPIDHASH_HPP_INCLUDED
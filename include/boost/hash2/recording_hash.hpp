@@ -0,0 +1,247 @@
+#ifndef BOOST_HASH2_RECORDING_HASH_HPP_INCLUDED
+#define BOOST_HASH2_RECORDING_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// recording_hash<H>, records the bytes passed to H, and the hash_append
+// overloads that produced them
+
+#include <boost/hash2/detail/has_update_word.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// exposes H::block_size, when present
+
+template<class H, class En = void> struct recording_hash_base
+{
+};
+
+template<class H> struct recording_hash_base<H, decltype( (void)H::block_size )>
+{
+    static constexpr int block_size = H::block_size;
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H> constexpr int recording_hash_base<H, decltype( (void)H::block_size )>::block_size;
+
+#endif
+
+} // namespace detail
+
+// the bytes [first, last) of the recording were produced by the
+// hash_append overload name, nested depth levels deep
+
+struct recorded_span
+{
+    char const* name;
+
+    std::size_t first;
+    std::size_t last;
+
+    int depth;
+};
+
+template<class H> class recording_hash: public detail::recording_hash_base<H>
+{
+private:
+
+    H h_;
+
+    std::vector<unsigned char> bytes_;
+    std::vector<recorded_span> spans_;
+
+    // the indices into spans_ of the spans not yet ended
+    std::vector<std::size_t> open_;
+
+public:
+
+    using result_type = typename H::result_type;
+
+    recording_hash() = default;
+
+    explicit recording_hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    recording_hash( unsigned char const * p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    void update( unsigned char const* p, std::size_t n )
+    {
+        bytes_.insert( bytes_.end(), p, p + n );
+        h_.update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // only present when H::update_word is, so that hash_append makes
+    // the same calls as it would with H
+
+    template<class H2 = H>
+    typename std::enable_if<detail::has_update_word<H2>::value>::type update_word( std::uint64_t w )
+    {
+        unsigned char tmp[ 8 ];
+        detail::write64le( tmp, w );
+
+        bytes_.insert( bytes_.end(), tmp, tmp + 8 );
+        h_.update_word( w );
+    }
+
+    result_type result()
+    {
+        return h_.result();
+    }
+
+    // called by hash_append
+
+    void trace_begin( char const* name )
+    {
+        recorded_span s = { name, bytes_.size(), bytes_.size(), static_cast<int>( open_.size() ) };
+
+        spans_.push_back( s );
+        open_.push_back( spans_.size() - 1 );
+    }
+
+    void trace_end()
+    {
+        BOOST_ASSERT( !open_.empty() );
+
+        spans_[ open_.back() ].last = bytes_.size();
+        open_.pop_back();
+    }
+
+    // the recording
+
+    std::vector<unsigned char> const& bytes() const noexcept
+    {
+        return bytes_;
+    }
+
+    // in the order in which they began; each span is followed by the
+    // spans nested in it
+
+    std::vector<recorded_span> const& spans() const noexcept
+    {
+        return spans_;
+    }
+
+    // discards the recording, keeping the allocated storage, so that
+    // a recording_hash can be reused without allocating again
+
+    void clear() noexcept
+    {
+        bytes_.clear();
+        spans_.clear();
+        open_.clear();
+    }
+
+    void reserve( std::size_t bytes, std::size_t spans )
+    {
+        bytes_.reserve( bytes );
+        spans_.reserve( spans );
+    }
+
+    // the wrapped hash algorithm
+
+    H const& hasher() const noexcept
+    {
+        return h_;
+    }
+};
+
+// to_string
+
+namespace detail
+{
+
+inline void append_recorded_bytes( std::string& r, unsigned char const* p, std::size_t first, std::size_t last, int depth )
+{
+    char const* digits = "0123456789abcdef";
+
+    for( std::size_t i = first; i < last; i += 16 )
+    {
+        r.append( 2 * depth, ' ' );
+
+        for( std::size_t j = i; j < last && j < i + 16; ++j )
+        {
+            if( j != i ) r += ' ';
+
+            r += digits[ p[ j ] >> 4 ];
+            r += digits[ p[ j ] & 15 ];
+        }
+
+        r += '\n';
+    }
+}
+
+// formats the spans starting at spans[ i ] that are nested depth levels
+// deep, up to the first one that isn't, along with the bytes in [first,
+// last) outside them; returns the index of the first span not formatted
+
+inline std::size_t append_recorded_spans( std::string& r, std::vector<unsigned char> const& bytes, std::vector<recorded_span> const& spans, std::size_t i, std::size_t first, std::size_t last, int depth )
+{
+    std::size_t pos = first;
+
+    while( i < spans.size() && spans[ i ].depth == depth )
+    {
+        recorded_span const& s = spans[ i ];
+
+        detail::append_recorded_bytes( r, bytes.data(), pos, s.first, depth );
+
+        r.append( 2 * depth, ' ' );
+        r += s.name;
+        r += " [";
+        r += std::to_string( s.first );
+        r += ", ";
+        r += std::to_string( s.last );
+        r += ")\n";
+
+        i = detail::append_recorded_spans( r, bytes, spans, i + 1, s.first, s.last, depth + 1 );
+
+        pos = s.last;
+    }
+
+    detail::append_recorded_bytes( r, bytes.data(), pos, last, depth );
+
+    return i;
+}
+
+} // namespace detail
+
+// one line per span, indented by its depth and followed by the bytes
+// in it, in hexadecimal
+
+template<class H> std::string to_string( recording_hash<H> const& h )
+{
+    std::string r;
+    detail::append_recorded_spans( r, h.bytes(), h.spans(), 0, 0, h.bytes().size(), 0 );
+
+    return r;
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_RECORDING_HASH_HPP_INCLUDED
@@ -0,0 +1,74 @@
+#ifndef BOOST_HASH2_REDUCE_HPP_INCLUDED
+#define BOOST_HASH2_REDUCE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// reduce, mapping a hash result to [0, n) without a division, and
+// fastmod, the remainder by a fixed divisor without a division
+
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// the high half of the product of the 64 bit result and n (Lemire);
+// unlike a remainder, this uses the high bits of the result, which the
+// multipliers of get_integral_result spread a shorter result into
+
+template<class R> BOOST_CXX14_CONSTEXPR std::size_t reduce( R const& r, std::size_t n ) noexcept
+{
+    std::uint64_t hi = 0;
+    detail::mul128( hash2::get_integral_result<std::uint64_t>( r ), n, hi );
+
+    return static_cast<std::size_t>( hi );
+}
+
+// fastmod(n)( r ) is get_integral_result<std::uint32_t>( r ) % n, computed
+// with two multiplications by a precomputed reciprocal of n (Lemire,
+// Kaser, Kurz, "Faster Remainder by Direct Computation", 2019)
+
+class fastmod
+{
+private:
+
+    std::uint64_t m_;
+    std::uint32_t n_;
+
+public:
+
+    BOOST_CXX14_CONSTEXPR explicit fastmod( std::uint32_t n ) noexcept: m_( 0 ), n_( n )
+    {
+        BOOST_ASSERT( n > 0 );
+
+        m_ = ~std::uint64_t( 0 ) / n + 1;
+    }
+
+    constexpr std::uint32_t divisor() const noexcept
+    {
+        return n_;
+    }
+
+    template<class R> BOOST_CXX14_CONSTEXPR std::uint32_t operator()( R const& r ) const noexcept
+    {
+        std::uint64_t const x = m_ * hash2::get_integral_result<std::uint32_t>( r );
+
+        std::uint64_t hi = 0;
+        detail::mul128( x, n_, hi );
+
+        return static_cast<std::uint32_t>( hi );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_REDUCE_HPP_INCLUDED
@@ -19,6 +19,14 @@
 #include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/hash2/detail/multi_buffer.hpp>
+#include <boost/hash2/detail/ripemd_x86.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/hash2/endian.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
@@ -30,10 +38,34 @@ namespace boost
 namespace hash2
 {
 
+class ripemd_128;
+
+namespace detail
+{
+
+struct ripemd_160_lanes;
+
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
+
+// defined in src/ripemd.cpp
+
+void ripemd_128_transform_compiled( ripemd_128& h, unsigned char const block[ 64 ] );
+void ripemd_160_transform_compiled( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] );
+
+#endif
+
+} // namespace detail
+
 class ripemd_128
 {
 private:
 
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
+
+    friend void detail::ripemd_128_transform_compiled( ripemd_128& h, unsigned char const block[ 64 ] );
+
+#endif
+
     std::uint32_t state_[ 4 ] = { 0x67452301u, 0xEFCDAB89u, 0x98BADCFEu, 0x10325476u };
 
     static constexpr int N = 64;
@@ -99,6 +131,21 @@ private:
     }
 
     BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ] )
+    {
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::ripemd_128_transform_compiled( *this, block );
+            return;
+        }
+
+#endif
+
+        transform_impl( block );
+    }
+
+    BOOST_CXX14_CONSTEXPR void transform_impl( unsigned char const block[ 64 ] )
     {
         std::uint32_t aa = state_[ 0 ];
         std::uint32_t bb = state_[ 1 ];
@@ -276,8 +323,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -285,13 +334,17 @@ public:
     {
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
+        BOOST_HASH2_STATS_UPDATE( ripemd_128, "ripemd_128", n );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         if( n == 0 ) return;
@@ -352,6 +405,8 @@ public:
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( ripemd_128, "ripemd_128" );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         unsigned char bits[ 8 ] = {};
@@ -362,10 +417,14 @@ public:
 
         unsigned char padding[ 64 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
+
         update( padding, k );
 
         update( bits, 8 );
 
+        BOOST_HASH2_STATS_RESUME();
+
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -377,12 +436,60 @@ public:
 
         return digest;
     }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 16 + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        ripemd_128 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        tmp.m_ = static_cast<std::size_t>( tmp.n_ % N );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
 };
 
 class ripemd_160
 {
 private:
 
+    friend struct detail::ripemd_160_lanes;
+
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
+
+    friend void detail::ripemd_160_transform_compiled( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] );
+
+#endif
+
     std::uint32_t state_[ 5 ] = { 0x67452301u, 0xefcdab89u, 0x98badcfeu, 0x10325476u, 0xc3d2e1f0u };
 
     static constexpr int N = 64;
@@ -470,19 +577,34 @@ private:
         c = detail::rotl(c, 10);
     }
 
-    BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ] )
+    static BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] )
     {
-        std::uint32_t aa = state_[ 0 ];
-        std::uint32_t bb = state_[ 1 ];
-        std::uint32_t cc = state_[ 2 ];
-        std::uint32_t dd = state_[ 3 ];
-        std::uint32_t ee = state_[ 4 ];
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
 
-        std::uint32_t aaa = state_[ 0 ];
-        std::uint32_t bbb = state_[ 1 ];
-        std::uint32_t ccc = state_[ 2 ];
-        std::uint32_t ddd = state_[ 3 ];
-        std::uint32_t eee = state_[ 4 ];
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::ripemd_160_transform_compiled( block, state );
+            return;
+        }
+
+#endif
+
+        transform_impl( block, state );
+    }
+
+    static BOOST_CXX14_CONSTEXPR void transform_impl( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] )
+    {
+        std::uint32_t aa = state[ 0 ];
+        std::uint32_t bb = state[ 1 ];
+        std::uint32_t cc = state[ 2 ];
+        std::uint32_t dd = state[ 3 ];
+        std::uint32_t ee = state[ 4 ];
+
+        std::uint32_t aaa = state[ 0 ];
+        std::uint32_t bbb = state[ 1 ];
+        std::uint32_t ccc = state[ 2 ];
+        std::uint32_t ddd = state[ 3 ];
+        std::uint32_t eee = state[ 4 ];
 
         std::uint32_t X[ 16 ] = {};
 
@@ -673,12 +795,17 @@ private:
         RR5(ccc, ddd, eee, aaa, bbb, X[ 9] , 11);
         RR5(bbb, ccc, ddd, eee, aaa, X[11] , 11);
 
-        ddd += cc + state_[ 1 ];
-        state_[ 1 ] = state_[ 2 ] + dd + eee;
-        state_[ 2 ] = state_[ 3 ] + ee + aaa;
-        state_[ 3 ] = state_[ 4 ] + aa + bbb;
-        state_[ 4 ] = state_[ 0 ] + bb + ccc;
-        state_[ 0 ] = ddd;
+        ddd += cc + state[ 1 ];
+        state[ 1 ] = state[ 2 ] + dd + eee;
+        state[ 2 ] = state[ 3 ] + ee + aaa;
+        state[ 3 ] = state[ 4 ] + aa + bbb;
+        state[ 4 ] = state[ 0 ] + bb + ccc;
+        state[ 0 ] = ddd;
+    }
+
+    BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ] )
+    {
+        transform( block, state_ );
     }
 
 public:
@@ -696,8 +823,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -705,13 +834,17 @@ public:
     {
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
+        BOOST_HASH2_STATS_UPDATE( ripemd_160, "ripemd_160", n );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         if( n == 0 ) return;
@@ -772,6 +905,8 @@ public:
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( ripemd_160, "ripemd_160" );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         unsigned char bits[ 8 ] = {};
@@ -782,10 +917,14 @@ public:
 
         unsigned char padding[ 64 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
+
         update( padding, k );
 
         update( bits, 8 );
 
+        BOOST_HASH2_STATS_RESUME();
+
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -797,11 +936,137 @@ public:
 
         return digest;
     }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 20 + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        ripemd_160 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        tmp.m_ = static_cast<std::size_t>( tmp.n_ % N );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
 };
 
 using hmac_ripemd_160 = hmac<ripemd_160>;
 using hmac_ripemd_128 = hmac<ripemd_128>;
 
+// multi-buffer variant
+
+namespace detail
+{
+
+struct ripemd_160_lanes
+{
+    using word_type = std::uint32_t;
+
+    static constexpr int state_words = 5;
+    static constexpr int block_size = 64;
+    static constexpr int digest_size = 20;
+    static constexpr int length_size = 8;
+    static constexpr endian byte_order = endian::little;
+
+    static void init( std::uint32_t state[ 5 ] )
+    {
+        std::uint32_t const iv[ 5 ] = { 0x67452301u, 0xefcdab89u, 0x98badcfeu, 0x10325476u, 0xc3d2e1f0u };
+        std::memcpy( state, iv, sizeof( iv ) );
+    }
+
+    static void transform( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] )
+    {
+        ripemd_160::transform( block, state );
+    }
+
+    static std::size_t transform_lanes( unsigned char const* const block[], std::uint32_t* state, std::size_t n, std::size_t stride )
+    {
+        std::size_t j = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( detail::has_x86_avx512f() )
+        {
+            for( ; j + 16 <= n; j += 16 )
+            {
+                detail::ripemd_160_transform_avx512( block + j, state + j, stride );
+            }
+        }
+
+        if( detail::has_x86_avx2() )
+        {
+            for( ; j + 8 <= n; j += 8 )
+            {
+                detail::ripemd_160_transform_avx2( block + j, state + j, stride );
+            }
+        }
+
+#else
+
+        (void)block;
+        (void)state;
+        (void)n;
+        (void)stride;
+
+#endif
+
+        return j;
+    }
+};
+
+} // namespace detail
+
+// ripemd_160_multi<N>
+//
+// N independent computations over messages of equal length,
+// interleaved so that they can be processed in SIMD lanes
+
+template<std::size_t N> class ripemd_160_multi: public detail::multi_buffer<detail::ripemd_160_lanes, N>
+{
+public:
+
+    using detail::multi_buffer<detail::ripemd_160_lanes, N>::multi_buffer;
+};
+
+namespace detail
+{
+
+template<> struct multi_lane<ripemd_160>
+{
+    static constexpr bool value = true;
+    template<std::size_t N> using type = ripemd_160_multi<N>;
+};
+
+} // namespace detail
+
 } // namespace hash2
 } // namespace boost
 
@@ -0,0 +1,282 @@
+#ifndef BOOST_HASH2_ROLLING_HASH_HPP_INCLUDED
+#define BOOST_HASH2_ROLLING_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Rolling hash functions over a window of the last w bytes, whose value
+// is updated in constant time when a byte enters the window and another
+// leaves it
+
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// 256 pseudorandom words, from splitmix64 seeded with seed
+
+inline void rolling_table( std::uint64_t seed, std::uint64_t* t ) noexcept
+{
+    std::uint64_t x = seed;
+
+    for( int i = 0; i < 256; ++i )
+    {
+        x += 0x9E3779B97F4A7C15ull;
+
+        std::uint64_t z = x;
+
+        z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+        z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+        z = z ^ ( z >> 31 );
+
+        t[ i ] = z;
+    }
+}
+
+} // namespace detail
+
+// rabin_karp_64, the polynomial hash
+//
+//   c[0] * B^(w-1) + c[1] * B^(w-2) + ... + c[w-1]  (mod 2^64)
+//
+// of the bytes c[i] in the window, with an odd base B derived from the seed
+
+class rabin_karp_64
+{
+private:
+
+    std::size_t w_;
+
+    std::uint64_t b_;
+    std::uint64_t bw_; // B^w
+
+    std::uint64_t h_ = 0;
+
+private:
+
+    void init( std::uint64_t seed ) noexcept
+    {
+        std::uint64_t t[ 256 ];
+        detail::rolling_table( seed, t );
+
+        b_ = t[ 0 ] | 1;
+        bw_ = 1;
+
+        for( std::size_t i = 0; i < w_; ++i )
+        {
+            bw_ *= b_;
+        }
+    }
+
+public:
+
+    explicit rabin_karp_64( std::size_t window ): w_( window )
+    {
+        BOOST_ASSERT( window > 0 );
+        init( 0 );
+    }
+
+    rabin_karp_64( std::size_t window, std::uint64_t seed ): w_( window )
+    {
+        BOOST_ASSERT( window > 0 );
+        init( seed );
+    }
+
+    std::size_t window_size() const noexcept
+    {
+        return w_;
+    }
+
+    void reset() noexcept
+    {
+        h_ = 0;
+    }
+
+    // adds c to the window, without removing a byte; used to fill it
+
+    void update( unsigned char c ) noexcept
+    {
+        h_ = h_ * b_ + c;
+    }
+
+    void update( unsigned char const* p, std::size_t n ) noexcept
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            update( p[ i ] );
+        }
+    }
+
+    // out is the byte that leaves the full window, the one added w bytes ago
+
+    void roll( unsigned char out, unsigned char in ) noexcept
+    {
+        h_ = h_ * b_ - out * bw_ + in;
+    }
+
+    std::uint64_t value() const noexcept
+    {
+        return h_;
+    }
+};
+
+// buzhash_64, the cyclic polynomial hash
+//
+//   rotl( T[c[0]], w-1 ) ^ rotl( T[c[1]], w-2 ) ^ ... ^ T[c[w-1]]
+//
+// with a table T of 256 pseudorandom words derived from the seed
+
+class buzhash_64
+{
+private:
+
+    std::size_t w_;
+
+    std::uint64_t t_[ 256 ];
+    std::uint64_t u_[ 256 ]; // rotl( t_[i], w % 64 )
+
+    std::uint64_t h_ = 0;
+
+private:
+
+    void init( std::uint64_t seed ) noexcept
+    {
+        detail::rolling_table( seed, t_ );
+
+        int r = static_cast<int>( w_ % 64 );
+
+        for( int i = 0; i < 256; ++i )
+        {
+            u_[ i ] = r == 0? t_[ i ]: detail::rotl( t_[ i ], r );
+        }
+    }
+
+public:
+
+    explicit buzhash_64( std::size_t window ): w_( window )
+    {
+        BOOST_ASSERT( window > 0 );
+        init( 0 );
+    }
+
+    buzhash_64( std::size_t window, std::uint64_t seed ): w_( window )
+    {
+        BOOST_ASSERT( window > 0 );
+        init( seed );
+    }
+
+    std::size_t window_size() const noexcept
+    {
+        return w_;
+    }
+
+    void reset() noexcept
+    {
+        h_ = 0;
+    }
+
+    void update( unsigned char c ) noexcept
+    {
+        h_ = detail::rotl( h_, 1 ) ^ t_[ c ];
+    }
+
+    void update( unsigned char const* p, std::size_t n ) noexcept
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            update( p[ i ] );
+        }
+    }
+
+    void roll( unsigned char out, unsigned char in ) noexcept
+    {
+        h_ = detail::rotl( h_, 1 ) ^ u_[ out ] ^ t_[ in ];
+    }
+
+    std::uint64_t value() const noexcept
+    {
+        return h_;
+    }
+};
+
+// gear_hash_64, the Gear hash of FastCDC
+//
+//   ( T[c[0]] << 63 ) + ( T[c[1]] << 62 ) + ... + T[c[63]]  (mod 2^64)
+//
+// over an implicit window of 64 bytes; older bytes are shifted out, so
+// roll doesn't need the outgoing byte. Bit k of the value only depends
+// on the last k + 1 bytes, so the high bits should be used
+
+class gear_hash_64
+{
+private:
+
+    std::uint64_t t_[ 256 ];
+
+    std::uint64_t h_ = 0;
+
+public:
+
+    gear_hash_64()
+    {
+        detail::rolling_table( 0, t_ );
+    }
+
+    explicit gear_hash_64( std::uint64_t seed )
+    {
+        detail::rolling_table( seed, t_ );
+    }
+
+    std::size_t window_size() const noexcept
+    {
+        return 64;
+    }
+
+    void reset() noexcept
+    {
+        h_ = 0;
+    }
+
+    void update( unsigned char c ) noexcept
+    {
+        h_ = ( h_ << 1 ) + t_[ c ];
+    }
+
+    void update( unsigned char const* p, std::size_t n ) noexcept
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            update( p[ i ] );
+        }
+    }
+
+    void roll( unsigned char /*out*/, unsigned char in ) noexcept
+    {
+        update( in );
+    }
+
+    std::uint64_t value() const noexcept
+    {
+        return h_;
+    }
+
+    std::uint64_t const* table() const noexcept
+    {
+        return t_;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_ROLLING_HASH_HPP_INCLUDED
@@ -0,0 +1,143 @@
+#ifndef BOOST_HASH2_SEEDED_PROTOTYPE_HPP_INCLUDED
+#define BOOST_HASH2_SEEDED_PROTOTYPE_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// seeded_prototype, a hash algorithm seeded once and handed out as copies
+
+#include <atomic>
+#include <mutex>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// a process-wide source of stamps; each seeding of each prototype gets
+// its own, so that a stamp never identifies two different states
+
+inline std::uint64_t next_prototype_stamp() noexcept
+{
+    static std::atomic<std::uint64_t> n( 0 );
+    return n.fetch_add( 1, std::memory_order_relaxed ) + 1;
+}
+
+} // namespace detail
+
+// seeded_prototype<H>
+//
+// the seeded state of H is computed by the constructor and by rotate;
+// get copies it into a small per-thread cache, tagged with the stamp of
+// the seeding, and subsequently returns copies of the cached state
+// without taking the lock, until the stamp changes
+
+template<class H> class seeded_prototype
+{
+private:
+
+    // the number of prototypes of the same type a thread caches at once
+
+    static constexpr std::size_t cache_size = 4;
+
+    struct cache
+    {
+        std::uint64_t stamp[ cache_size ] = {};
+        H h[ cache_size ];
+        std::size_t next = 0;
+    };
+
+    static cache& local_cache()
+    {
+        static thread_local cache c;
+        return c;
+    }
+
+    mutable std::mutex mx_;
+    H h_;
+    std::atomic<std::uint64_t> stamp_;
+
+public:
+
+    using hash_type = H;
+
+    explicit seeded_prototype( std::uint64_t seed ): h_( seed ), stamp_( detail::next_prototype_stamp() )
+    {
+    }
+
+    seeded_prototype( unsigned char const* p, std::size_t n ): h_( p, n ), stamp_( detail::next_prototype_stamp() )
+    {
+    }
+
+    seeded_prototype( seeded_prototype const& ) = delete;
+    seeded_prototype& operator=( seeded_prototype const& ) = delete;
+
+    // a copy of the seeded state; can be called concurrently with rotate
+
+    H get() const
+    {
+        cache& c = local_cache();
+
+        std::uint64_t const s = stamp_.load( std::memory_order_acquire );
+
+        for( std::size_t i = 0; i < cache_size; ++i )
+        {
+            if( c.stamp[ i ] == s ) return c.h[ i ];
+        }
+
+        std::size_t const i = c.next;
+        c.next = ( i + 1 ) % cache_size;
+
+        {
+            std::lock_guard<std::mutex> lock( mx_ );
+
+            c.h[ i ] = h_;
+            c.stamp[ i ] = stamp_.load( std::memory_order_relaxed );
+        }
+
+        return c.h[ i ];
+    }
+
+    // the stamp of the current seeding; changes on each rotate
+
+    std::uint64_t stamp() const noexcept
+    {
+        return stamp_.load( std::memory_order_acquire );
+    }
+
+    // reseeds; the state is computed before the lock is taken, so that
+    // concurrent calls to get are delayed by a copy at most, and those
+    // that still have the previous state cached keep returning it until
+    // they observe the new stamp
+
+    void rotate( std::uint64_t seed )
+    {
+        H h( seed );
+
+        std::lock_guard<std::mutex> lock( mx_ );
+
+        h_ = h;
+        stamp_.store( detail::next_prototype_stamp(), std::memory_order_release );
+    }
+
+    void rotate( unsigned char const* p, std::size_t n )
+    {
+        H h( p, n );
+
+        std::lock_guard<std::mutex> lock( mx_ );
+
+        h_ = h;
+        stamp_.store( detail::next_prototype_stamp(), std::memory_order_release );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SEEDED_PROTOTYPE_HPP_INCLUDED
@@ -0,0 +1,44 @@
+#ifndef BOOST_HASH2_SEGMENTED_ITERATOR_HPP_INCLUDED
+#define BOOST_HASH2_SEGMENTED_ITERATOR_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <type_traits>
+#include <iterator>
+#include <utility>
+
+namespace boost
+{
+namespace hash2
+{
+
+// segmented_iterator_traits
+//
+// A specialization for a random access iterator type It, whose elements
+// are stored in contiguous blocks, provides
+//
+//     static T const* segment_end( It const& it );
+//
+// returning a pointer one past the last element of the block containing *it
+
+template<class It, class En = void> struct segmented_iterator_traits
+{
+};
+
+// is_segmented_iterator
+
+template<class It, class En = void> struct is_segmented_iterator: std::false_type
+{
+};
+
+template<class It> struct is_segmented_iterator<It, decltype( (void)segmented_iterator_traits<It>::segment_end( std::declval<It const&>() ), void() )>:
+    std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<It>::iterator_category>
+{
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SEGMENTED_ITERATOR_HPP_INCLUDED
@@ -14,6 +14,11 @@
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/hash2/detail/memcpy.hpp>
 #include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/sha_x86.hpp>
+#include <boost/hash2/detail/sha_arm.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
@@ -88,13 +93,31 @@ private:
         b = detail::rotl( b, 30 );
     }
 
-    BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ] )
+    static BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] )
     {
-        std::uint32_t a = state_[ 0 ];
-        std::uint32_t b = state_[ 1 ];
-        std::uint32_t c = state_[ 2 ];
-        std::uint32_t d = state_[ 3 ];
-        std::uint32_t e = state_[ 4 ];
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_sha() )
+        {
+            detail::sha1_transform_x86( block, state );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_SHA2_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::sha1_transform_arm( block, state );
+            return;
+        }
+
+#endif
+
+        std::uint32_t a = state[ 0 ];
+        std::uint32_t b = state[ 1 ];
+        std::uint32_t c = state[ 2 ];
+        std::uint32_t d = state[ 3 ];
+        std::uint32_t e = state[ 4 ];
 
         std::uint32_t w[ 80 ] = {};
 
@@ -183,11 +206,16 @@ private:
         R5( c, d, e, a, b, w, 78 );
         R5( b, c, d, e, a, w, 79 );
 
-        state_[ 0 ] += a;
-        state_[ 1 ] += b;
-        state_[ 2 ] += c;
-        state_[ 3 ] += d;
-        state_[ 4 ] += e;
+        state[ 0 ] += a;
+        state[ 1 ] += b;
+        state[ 2 ] += c;
+        state[ 3 ] += d;
+        state[ 4 ] += e;
+    }
+
+    BOOST_CXX14_CONSTEXPR void transform( unsigned char const block[ 64 ] )
+    {
+        transform( block, state_ );
     }
 
 public:
@@ -205,8 +233,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -214,13 +244,17 @@ public:
     {
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
+        BOOST_HASH2_STATS_UPDATE( sha1_160, "sha1_160", n );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         if( n == 0 ) return;
@@ -281,6 +315,8 @@ public:
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( sha1_160, "sha1_160" );
+
         BOOST_ASSERT( m_ == n_ % N );
 
         unsigned char bits[ 8 ] = {};
@@ -291,10 +327,14 @@ public:
 
         unsigned char padding[ 64 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
+
         update( padding, k );
 
         update( bits, 8 );
 
+        BOOST_HASH2_STATS_RESUME();
+
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -306,6 +346,77 @@ public:
 
         return digest;
     }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint32_t st[ 5 ] = { state_[ 0 ], state_[ 1 ], state_[ 2 ], state_[ 3 ], state_[ 4 ] };
+
+        unsigned char block[ N ] = {};
+
+        detail::memcpy( block, buffer_, m_ );
+        block[ m_ ] = 0x80;
+
+        if( m_ >= 56 )
+        {
+            transform( block, st );
+            detail::memset( block, 0, N );
+        }
+
+        detail::write64be( block + 56, n_ * 8 );
+        transform( block, st );
+
+        result_type digest;
+
+        for( int i = 0; i < 5; ++i )
+        {
+            detail::write32be( digest.data() + i * 4, st[ i ] );
+        }
+
+        return digest;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 20 + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        sha1_160 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        tmp.m_ = static_cast<std::size_t>( tmp.n_ % N );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
 };
 
 using hmac_sha1_160 = hmac<sha1_160>;
@@ -16,6 +16,13 @@
 #include <boost/hash2/detail/memcpy.hpp>
 #include <boost/hash2/detail/memset.hpp>
 #include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/sha_x86.hpp>
+#include <boost/hash2/detail/sha_arm.hpp>
+#include <boost/hash2/detail/sha_riscv.hpp>
+#include <boost/hash2/detail/sha_wasm.hpp>
+#include <boost/hash2/detail/multi_buffer.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
 #include <boost/assert.hpp>
 #include <array>
 #include <cstdint>
@@ -29,6 +36,15 @@ namespace hash2
 namespace detail
 {
 
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
+
+// defined in src/sha2.cpp
+
+void sha2_256_transform_compiled( unsigned char const block[ 64 ], std::uint32_t state[ 8 ] );
+void sha2_512_transform_compiled( unsigned char const block[ 128 ], std::uint64_t state[ 8 ] );
+
+#endif
+
 template<class Word, class Algo, int M>
 struct sha2_base
 {
@@ -101,6 +117,74 @@ struct sha2_base
 
         BOOST_ASSERT( m_ == n_ % N );
     }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the state after the padding of the message so far, computed
+    // without modifying *this
+
+    BOOST_CXX14_CONSTEXPR void final_state( Word st[ 8 ] ) const
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            st[ i ] = state_[ i ];
+        }
+
+        // the length field is 8 bytes for SHA-256, 16 for SHA-512
+        std::size_t const L = 2 * sizeof( Word );
+
+        unsigned char block[ N ] = {};
+
+        detail::memcpy( block, buffer_, m_ );
+        block[ m_ ] = 0x80;
+
+        if( m_ >= N - L )
+        {
+            Algo::transform( block, st );
+            detail::memset( block, 0, N );
+        }
+
+        detail::write64be( block + N - 8, n_ * 8 );
+        Algo::transform( block, st );
+    }
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 8 * sizeof( Word ) + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        sha2_base tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        tmp.m_ = static_cast<std::size_t>( tmp.n_ % N );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
 };
 
 template<class = void>
@@ -117,6 +201,32 @@ struct sha2_256_constants
         0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
         0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
     };
+
+    // the padding block of a 64 byte message: 0x80, 55 zero bytes, and
+    // the bit length 512
+
+    constexpr static unsigned char const padding64[ 64 ] =
+    {
+        0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02, 0,
+    };
+
+    // K[ t ] + W[ t ] for that block, whose message schedule doesn't
+    // depend on the message
+
+    constexpr static std::uint32_t const KW64[ 64 ] =
+    {
+        0xc28a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf374,
+        0x649b69c1, 0xf0fe4786, 0x0fe1edc6, 0x240cf254, 0x4fe9346f, 0x6cc984be, 0x61b9411e, 0x16f988fa,
+        0xf2c65152, 0xa88e5a6d, 0xb019fc65, 0xb9d99ec7, 0x9a1231c3, 0xe70eeaa0, 0xfdb1232b, 0xc7353eb0,
+        0x3069bad5, 0xcb976d5f, 0x5a0f118f, 0xdc1eeefd, 0x0a35b689, 0xde0b7a04, 0x58f4ca9d, 0xe15d5b16,
+        0x007f3e86, 0x37088980, 0xa507ea32, 0x6fab9537, 0x17406110, 0x0d8cd6f1, 0xcdaa3b6d, 0xc0bbbe37,
+        0x83613bda, 0xdb48a363, 0x0b02e931, 0x6fd15ca7, 0x521afaca, 0x31338431, 0x6ed41a95, 0x6d437890,
+        0xc39c91f2, 0x9eccabbd, 0xb5c9a0e6, 0x532fb63c, 0xd2c741c6, 0x07237ea3, 0xa4954b68, 0x4c191d76,
+    };
 };
 
 template<class = void>
@@ -159,6 +269,12 @@ struct sha2_512_constants
 template<class T>
 constexpr std::uint32_t sha2_256_constants<T>::K[ 64 ];
 
+template<class T>
+constexpr unsigned char sha2_256_constants<T>::padding64[ 64 ];
+
+template<class T>
+constexpr std::uint32_t sha2_256_constants<T>::KW64[ 64 ];
+
 template<class  T>
 constexpr std::uint64_t sha2_512_constants<T>::K[ 80 ];
 
@@ -197,9 +313,50 @@ struct sha2_256_base : public sha2_base<std::uint32_t, sha2_256_base, 64>
     }
 
     BOOST_CXX14_CONSTEXPR static void transform( unsigned char const block[ 64 ], std::uint32_t state[ 8 ] )
+    {
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::sha2_256_transform_compiled( block, state );
+            return;
+        }
+
+#endif
+
+        transform_impl( block, state );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void transform_impl( unsigned char const block[ 64 ], std::uint32_t state[ 8 ] )
     {
         auto K = sha2_256_constants<>::K;
 
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_sha() )
+        {
+            detail::sha2_256_transform_x86( block, state, K );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_SHA2_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::sha2_256_transform_arm( block, state, K );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_RISCV_ZVKNHA_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::sha2_256_transform_riscv( block, state, K );
+            return;
+        }
+
+#endif
+
         std::uint32_t W[ 64 ] = {};
 
         for( int t = 0; t < 16; ++t )
@@ -245,6 +402,104 @@ struct sha2_256_base : public sha2_base<std::uint32_t, sha2_256_base, 64>
         state[6] += g;
         state[7] += h;
     }
+
+    // the padding block of a 64 byte message; the portable code skips
+    // the message schedule, which is the same for all such messages
+
+    BOOST_CXX14_CONSTEXPR static void transform_padding64( std::uint32_t state[ 8 ] )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_sha() )
+        {
+            transform( sha2_256_constants<>::padding64, state );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_SHA2_INTRINSICS) || defined(BOOST_HASH2_HAS_RISCV_ZVKNHA_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            transform( sha2_256_constants<>::padding64, state );
+            return;
+        }
+
+#endif
+
+        auto KW = sha2_256_constants<>::KW64;
+
+        std::uint32_t a = state[ 0 ];
+        std::uint32_t b = state[ 1 ];
+        std::uint32_t c = state[ 2 ];
+        std::uint32_t d = state[ 3 ];
+        std::uint32_t e = state[ 4 ];
+        std::uint32_t f = state[ 5 ];
+        std::uint32_t g = state[ 6 ];
+        std::uint32_t h = state[ 7 ];
+
+        for( int t = 0; t < 64; ++t )
+        {
+            std::uint32_t T1 = h + Sigma1( e ) + Ch( e, f, g ) + KW[ t ];
+            std::uint32_t T2 = Sigma0( a ) + Maj( a, b, c );
+
+            h = g;
+            g = f;
+            f = e;
+            e = d + T1;
+            d = c;
+            c = b;
+            b = a;
+            a = T1 + T2;
+        }
+
+        state[ 0 ] += a;
+        state[ 1 ] += b;
+        state[ 2 ] += c;
+        state[ 3 ] += d;
+        state[ 4 ] += e;
+        state[ 5 ] += f;
+        state[ 6 ] += g;
+        state[ 7 ] += h;
+    }
+
+    // processes a prefix of the n lanes of a word-major state, state[ i * stride + j ]
+    // being word i of lane j, and returns its length (possibly 0)
+
+    static std::size_t transform_lanes( unsigned char const* const block[], std::uint32_t* state, std::size_t n, std::size_t stride )
+    {
+        std::size_t j = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        // a single SHA-NI stream is faster than eight AVX2 lanes,
+        // so the AVX2 kernel is only used when SHA-NI is absent
+
+        if( !detail::has_x86_sha() && detail::has_x86_avx2() )
+        {
+            for( ; j + 8 <= n; j += 8 )
+            {
+                detail::sha2_256_transform_avx2( block + j, state + j, stride, sha2_256_constants<>::K );
+            }
+        }
+
+#elif defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+        for( ; j + 4 <= n; j += 4 )
+        {
+            detail::sha2_256_transform_wasm( block + j, state + j, stride, sha2_256_constants<>::K );
+        }
+
+#else
+
+        (void)block;
+        (void)state;
+        (void)n;
+        (void)stride;
+
+#endif
+
+        return j;
+    }
 };
 
 struct sha2_512_base : public sha2_base<std::uint64_t, sha2_512_base, 128>
@@ -280,9 +535,60 @@ struct sha2_512_base : public sha2_base<std::uint64_t, sha2_512_base, 128>
     }
 
     BOOST_CXX14_CONSTEXPR static void transform( unsigned char const block[ 128 ], std::uint64_t state[ 8 ] )
+    {
+#if defined(BOOST_HASH2_SEPARATE_COMPILATION)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::sha2_512_transform_compiled( block, state );
+            return;
+        }
+
+#endif
+
+        transform_impl( block, state );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void transform_impl( unsigned char const block[ 128 ], std::uint64_t state[ 8 ] )
     {
         auto K = sha2_512_constants<>::K;
 
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+# if defined(BOOST_HASH2_HAS_X86_SHA512_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_sha512() )
+        {
+            detail::sha2_512_transform_sha512( block, state, K );
+            return;
+        }
+
+# endif
+
+        if( !detail::is_constant_evaluated() && detail::has_x86_avx2_bmi2() )
+        {
+            detail::sha2_512_transform_avx2( block, state, K );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_SHA512_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::sha2_512_transform_arm( block, state, K );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_RISCV_ZVKNHB_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::sha2_512_transform_riscv( block, state, K );
+            return;
+        }
+
+#endif
+
         std::uint64_t W[ 80 ] = {};
 
         for( int t = 0; t < 16; ++t )
@@ -330,27 +636,105 @@ struct sha2_512_base : public sha2_base<std::uint64_t, sha2_512_base, 128>
     }
 };
 
+struct sha2_256_lanes;
+
 } // namespace detail
 
 class sha2_256 : detail::sha2_256_base
 {
+public:
+
+    using result_type = digest<32>;
+
 private:
 
+    friend struct detail::sha2_256_lanes;
+
+    BOOST_CXX14_CONSTEXPR static void init( std::uint32_t state[ 8 ] )
+    {
+        state[ 0 ] = 0x6a09e667;
+        state[ 1 ] = 0xbb67ae85;
+        state[ 2 ] = 0x3c6ef372;
+        state[ 3 ] = 0xa54ff53a;
+        state[ 4 ] = 0x510e527f;
+        state[ 5 ] = 0x9b05688c;
+        state[ 6 ] = 0x1f83d9ab;
+        state[ 7 ] = 0x5be0cd19;
+    }
+
     BOOST_CXX14_CONSTEXPR void init()
     {
-        state_[ 0 ] = 0x6a09e667;
-        state_[ 1 ] = 0xbb67ae85;
-        state_[ 2 ] = 0x3c6ef372;
-        state_[ 3 ] = 0xa54ff53a;
-        state_[ 4 ] = 0x510e527f;
-        state_[ 5 ] = 0x9b05688c;
-        state_[ 6 ] = 0x1f83d9ab;
-        state_[ 7 ] = 0x5be0cd19;
+        init( state_ );
     }
 
-public:
+    BOOST_CXX14_CONSTEXPR static result_type to_digest( std::uint32_t const state[ 8 ] )
+    {
+        result_type r;
 
-    using result_type = digest<32>;
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32be( &r[ i * 4 ], state[ i ] );
+        }
+
+        return r;
+    }
+
+    // the padded block of a 32 byte message
+
+    BOOST_CXX14_CONSTEXPR static void pad32( unsigned char const* p, unsigned char block[ 64 ] )
+    {
+        detail::memcpy( block, p, 32 );
+        detail::memset( block + 32, 0, 32 );
+
+        block[ 32 ] = 0x80;
+        block[ 62 ] = 0x01; // bit length 256
+    }
+
+    // eight messages of one block, followed by the 64 byte padding block
+    // when padding64 is true, in parallel lanes; returns false, and does
+    // nothing, when the lanes aren't supported
+
+    static bool hash_x8( unsigned char const* const block[ 8 ], bool padding64, result_type r[ 8 ] )
+    {
+        std::uint32_t iv[ 8 ] = {};
+        init( iv );
+
+        std::uint32_t st[ 64 ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            for( int j = 0; j < 8; ++j )
+            {
+                st[ i * 8 + j ] = iv[ i ];
+            }
+        }
+
+        if( transform_lanes( block, st, 8, 8 ) != 8 ) return false;
+
+        if( padding64 )
+        {
+            unsigned char const* const pad = detail::sha2_256_constants<>::padding64;
+            unsigned char const* const block2[ 8 ] = { pad, pad, pad, pad, pad, pad, pad, pad };
+
+            transform_lanes( block2, st, 8, 8 );
+        }
+
+        for( int j = 0; j < 8; ++j )
+        {
+            std::uint32_t tmp[ 8 ];
+
+            for( int i = 0; i < 8; ++i )
+            {
+                tmp[ i ] = st[ i * 8 + j ];
+            }
+
+            r[ j ] = to_digest( tmp );
+        }
+
+        return true;
+    }
+
+public:
 
     static constexpr int block_size = 64;
 
@@ -368,8 +752,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -379,32 +765,163 @@ public:
 
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
-    using detail::sha2_256_base::update;
+    using detail::sha2_256_base::state_size;
+    using detail::sha2_256_base::save_state;
+    using detail::sha2_256_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha2_256, "sha2_256", n );
+        detail::sha2_256_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( sha2_256, "sha2_256" );
+
         unsigned char bits[ 8 ] = {};
         detail::write64be( bits, n_ * 8 );
 
-        std::size_t k = m_ < 56 ? 56 - m_ : 64 + 56 - m_;
-        unsigned char padding[ 64 ] = { 0x80 };
+        std::size_t k = m_ < 56 ? 56 - m_ : 64 + 56 - m_;
+        unsigned char padding[ 64 ] = { 0x80 };
+
+        BOOST_HASH2_STATS_SUSPEND();
+        update( padding, k );
+        update( bits, 8 );
+        BOOST_HASH2_STATS_RESUME();
+        BOOST_ASSERT( m_ == 0 );
+
+        result_type digest;
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32be( &digest[ i * 4 ], state_[ i ] );
+        }
+
+        return digest;
+    }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint32_t st[ 8 ] = {};
+        final_state( st );
+
+        result_type digest;
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write32be( &digest[ i * 4 ], st[ i ] );
+        }
+
+        return digest;
+    }
+
+    // The digests of 64 and 32 byte messages, such as the interior nodes
+    // of a binary tree of sha2_256 digests, or the second pass of double
+    // SHA-256, without the buffering of update; the padding block of a 64
+    // byte message is compressed with a precomputed message schedule
+
+    BOOST_CXX14_CONSTEXPR static result_type hash64( unsigned char const* p )
+    {
+        BOOST_HASH2_STATS_MESSAGES( sha2_256, "sha2_256", 1, 64 );
+
+        std::uint32_t st[ 8 ] = {};
+        init( st );
+
+        transform( p, st );
+        transform_padding64( st );
+
+        return to_digest( st );
+    }
+
+    BOOST_CXX14_CONSTEXPR static result_type hash32( unsigned char const* p )
+    {
+        BOOST_HASH2_STATS_MESSAGES( sha2_256, "sha2_256", 1, 32 );
+
+        unsigned char block[ 64 ] = {};
+        pad32( p, block );
+
+        std::uint32_t st[ 8 ] = {};
+        init( st );
+
+        transform( block, st );
+
+        return to_digest( st );
+    }
+
+    // the digests of the n consecutive messages at p into r[ 0 ] ... r[ n - 1 ];
+    // groups of eight use the multi-buffer lanes where they are faster
+
+    static void hash64( unsigned char const* p, std::size_t n, result_type* r )
+    {
+        BOOST_HASH2_STATS_MESSAGES( sha2_256, "sha2_256", n, n * 64 );
+
+        std::size_t i = 0;
+
+        for( ; i + 8 <= n; i += 8 )
+        {
+            unsigned char const* block[ 8 ];
+
+            for( std::size_t j = 0; j < 8; ++j )
+            {
+                block[ j ] = p + ( i + j ) * 64;
+            }
+
+            if( !hash_x8( block, true, r + i ) ) break;
+        }
+
+        BOOST_HASH2_STATS_SUSPEND();
+
+        for( ; i < n; ++i )
+        {
+            r[ i ] = hash64( p + i * 64 );
+        }
+
+        BOOST_HASH2_STATS_RESUME();
+    }
+
+    static void hash32( unsigned char const* p, std::size_t n, result_type* r )
+    {
+        BOOST_HASH2_STATS_MESSAGES( sha2_256, "sha2_256", n, n * 32 );
+
+        std::size_t i = 0;
+
+        for( ; i + 8 <= n; i += 8 )
+        {
+            unsigned char tmp[ 8 ][ 64 ];
+            unsigned char const* block[ 8 ];
 
-        update( padding, k );
-        update( bits, 8 );
-        BOOST_ASSERT( m_ == 0 );
+            for( std::size_t j = 0; j < 8; ++j )
+            {
+                pad32( p + ( i + j ) * 32, tmp[ j ] );
+                block[ j ] = tmp[ j ];
+            }
 
-        result_type digest;
-        for( int i = 0; i < 8; ++i )
+            if( !hash_x8( block, false, r + i ) ) break;
+        }
+
+        BOOST_HASH2_STATS_SUSPEND();
+
+        for( ; i < n; ++i )
         {
-            detail::write32be( &digest[ i * 4 ], state_[ i ] );
+            r[ i ] = hash32( p + i * 32 );
         }
 
-        return digest;
+        BOOST_HASH2_STATS_RESUME();
     }
 };
 
@@ -444,8 +961,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -455,24 +974,44 @@ public:
 
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
 
-    using detail::sha2_256_base::update;
+    using detail::sha2_256_base::state_size;
+    using detail::sha2_256_base::save_state;
+    using detail::sha2_256_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha2_224, "sha2_224", n );
+        detail::sha2_256_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( sha2_224, "sha2_224" );
+
         unsigned char bits[ 8 ] = {};
         detail::write64be( bits, n_ * 8 );
 
         std::size_t k = m_ < 56 ? 56 - m_ : 64 + 56 - m_;
         unsigned char padding[ 64 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
         update( padding, k );
         update( bits, 8 );
+        BOOST_HASH2_STATS_RESUME();
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -482,6 +1021,22 @@ public:
 
         return digest;
     }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint32_t st[ 8 ] = {};
+        final_state( st );
+
+        result_type digest;
+        for( int i = 0; i < 7; ++i ) {
+            detail::write32be( &digest[ i * 4 ], st[ i ] );
+        }
+
+        return digest;
+    }
 };
 
 class sha2_512 : detail::sha2_512_base
@@ -504,7 +1059,21 @@ public:
 
     using result_type = digest<64>;
 
-    using detail::sha2_512_base::update;
+    using detail::sha2_512_base::state_size;
+    using detail::sha2_512_base::save_state;
+    using detail::sha2_512_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha2_512, "sha2_512", n );
+        detail::sha2_512_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
 
     static constexpr int block_size = 128;
 
@@ -522,8 +1091,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -533,21 +1104,27 @@ public:
 
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( sha2_512, "sha2_512" );
+
         unsigned char bits[ 16 ] = { 0 };
         detail::write64be( bits + 8, n_ * 8 );
 
         std::size_t k = m_ < 112 ? 112 - m_ : 128 + 112 - m_;
         unsigned char padding[ 128 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
         update( padding, k );
         update( bits, 16 );
+        BOOST_HASH2_STATS_RESUME();
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -558,6 +1135,23 @@ public:
 
         return digest;
     }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint64_t st[ 8 ] = {};
+        final_state( st );
+
+        result_type digest;
+        for( int i = 0; i < 8; ++i )
+        {
+            detail::write64be( &digest[ i * 8 ], st[ i ] );
+        }
+
+        return digest;
+    }
 };
 
 class sha2_384 : detail::sha2_512_base
@@ -582,7 +1176,21 @@ public:
 
     static constexpr int block_size = 128;
 
-    using detail::sha2_512_base::update;
+    using detail::sha2_512_base::state_size;
+    using detail::sha2_512_base::save_state;
+    using detail::sha2_512_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha2_384, "sha2_384", n );
+        detail::sha2_512_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
 
     BOOST_CXX14_CONSTEXPR sha2_384()
     {
@@ -598,8 +1206,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -609,21 +1219,27 @@ public:
 
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( sha2_384, "sha2_384" );
+
         unsigned char bits[ 16 ] = { 0 };
         detail::write64be( bits + 8, n_ * 8 );
 
         std::size_t k = m_ < 112 ? 112 - m_ : 128 + 112 - m_;
         unsigned char padding[ 128 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
         update( padding, k );
         update( bits, 16 );
+        BOOST_HASH2_STATS_RESUME();
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -634,6 +1250,23 @@ public:
 
         return digest;
     }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint64_t st[ 8 ] = {};
+        final_state( st );
+
+        result_type digest;
+        for( int i = 0; i < 6; ++i )
+        {
+            detail::write64be( &digest[ i * 8 ], st[ i ] );
+        }
+
+        return digest;
+    }
 };
 
 class sha2_512_224 : detail::sha2_512_base
@@ -658,7 +1291,21 @@ public:
 
     static constexpr int block_size = 128;
 
-    using detail::sha2_512_base::update;
+    using detail::sha2_512_base::state_size;
+    using detail::sha2_512_base::save_state;
+    using detail::sha2_512_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha2_512_224, "sha2_512_224", n );
+        detail::sha2_512_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
 
     BOOST_CXX14_CONSTEXPR sha2_512_224()
     {
@@ -674,8 +1321,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -685,22 +1334,28 @@ public:
 
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( sha2_512_224, "sha2_512_224" );
+
         unsigned char bits[ 16 ] = { 0 };
         detail::write64be( bits + 8, n_ * 8 );
 
         std::size_t k = m_ < 112 ? 112 - m_ : 128 + 112 - m_;
         unsigned char padding[ 128 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
         update( padding, k );
         update( bits, 16 );
+        BOOST_HASH2_STATS_RESUME();
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -712,6 +1367,24 @@ public:
 
         return digest;
     }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint64_t st[ 8 ] = {};
+        final_state( st );
+
+        result_type digest;
+        for( int i = 0; i < 3; ++i )
+        {
+            detail::write64be( &digest[ i * 8 ], st[ i ] );
+        }
+        detail::write32be( &digest[ 3 * 8 ], st[ 3 ] >> 32 );
+
+        return digest;
+    }
 };
 
 class sha2_512_256 : detail::sha2_512_base
@@ -736,7 +1409,21 @@ public:
 
     static constexpr int block_size = 128;
 
-    using detail::sha2_512_base::update;
+    using detail::sha2_512_base::state_size;
+    using detail::sha2_512_base::save_state;
+    using detail::sha2_512_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha2_512_256, "sha2_512_256", n );
+        detail::sha2_512_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
 
     BOOST_CXX14_CONSTEXPR sha2_512_256()
     {
@@ -752,8 +1439,10 @@ public:
             unsigned char tmp[ 8 ] = {};
             detail::write64le( tmp, seed );
 
+            BOOST_HASH2_STATS_SUSPEND();
             update( tmp, 8 );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
@@ -763,21 +1452,27 @@ public:
 
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR result_type result()
     {
+        BOOST_HASH2_STATS_RESULT( sha2_512_256, "sha2_512_256" );
+
         unsigned char bits[ 16 ] = { 0 };
         detail::write64be( bits + 8, n_ * 8 );
 
         std::size_t k = m_ < 112 ? 112 - m_ : 128 + 112 - m_;
         unsigned char padding[ 128 ] = { 0x80 };
 
+        BOOST_HASH2_STATS_SUSPEND();
         update( padding, k );
         update( bits, 16 );
+        BOOST_HASH2_STATS_RESUME();
         BOOST_ASSERT( m_ == 0 );
 
         result_type digest;
@@ -788,6 +1483,23 @@ public:
 
         return digest;
     }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR result_type snapshot_result() const
+    {
+        std::uint64_t st[ 8 ] = {};
+        final_state( st );
+
+        result_type digest;
+        for( int i = 0; i < 4; ++i )
+        {
+            detail::write64be( &digest[ i * 8 ], st[ i ] );
+        }
+
+        return digest;
+    }
 };
 
 // hmac wrappers
@@ -799,6 +1511,244 @@ using hmac_sha2_384 = hmac<sha2_384>;
 using hmac_sha2_512_224 = hmac<sha2_512_224>;
 using hmac_sha2_512_256 = hmac<sha2_512_256>;
 
+// multi-buffer variants
+
+namespace detail
+{
+
+struct sha2_256_lanes
+{
+    using word_type = std::uint32_t;
+
+    static constexpr int state_words = 8;
+    static constexpr int block_size = 64;
+    static constexpr int digest_size = 32;
+    static constexpr int length_size = 8;
+    static constexpr endian byte_order = endian::big;
+
+    static void init( std::uint32_t state[ 8 ] )
+    {
+        std::uint32_t const iv[ 8 ] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+        std::memcpy( state, iv, sizeof( iv ) );
+    }
+
+    static void transform( unsigned char const block[ 64 ], std::uint32_t state[ 8 ] )
+    {
+        sha2_256_base::transform( block, state );
+    }
+
+    // the chaining value of h, which must be at a block boundary
+
+    static std::uint64_t midstate( sha2_256 const& h, std::uint32_t state[ 8 ] )
+    {
+        BOOST_ASSERT( h.m_ == 0 );
+
+        std::memcpy( state, h.state_, sizeof( h.state_ ) );
+        return h.n_;
+    }
+
+    static std::size_t transform_lanes( unsigned char const* const block[], std::uint32_t* state, std::size_t n, std::size_t stride )
+    {
+        return sha2_256_base::transform_lanes( block, state, n, stride );
+    }
+};
+
+struct sha2_512_lanes
+{
+    using word_type = std::uint64_t;
+
+    static constexpr int state_words = 8;
+    static constexpr int block_size = 128;
+    static constexpr int digest_size = 64;
+    static constexpr int length_size = 16;
+    static constexpr endian byte_order = endian::big;
+
+    static void init( std::uint64_t state[ 8 ] )
+    {
+        std::uint64_t const iv[ 8 ] = { 0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179 };
+        std::memcpy( state, iv, sizeof( iv ) );
+    }
+
+    static void transform( unsigned char const block[ 128 ], std::uint64_t state[ 8 ] )
+    {
+        sha2_512_base::transform( block, state );
+    }
+
+    static std::size_t transform_lanes( unsigned char const* const block[], std::uint64_t* state, std::size_t n, std::size_t stride )
+    {
+        std::size_t j = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+# if defined(BOOST_HASH2_HAS_X86_SHA512_INTRINSICS)
+
+        // as with SHA-NI, a single stream using the SHA512 extensions
+        // is faster than four AVX2 lanes
+
+        if( !detail::has_x86_sha512() && detail::has_x86_avx2() )
+
+# else
+
+        if( detail::has_x86_avx2() )
+
+# endif
+        {
+            for( ; j + 4 <= n; j += 4 )
+            {
+                detail::sha2_512_transform_avx2_x4( block + j, state + j, stride, sha2_512_constants<>::K );
+            }
+        }
+
+#else
+
+        (void)block;
+        (void)state;
+        (void)n;
+        (void)stride;
+
+#endif
+
+        return j;
+    }
+};
+
+} // namespace detail
+
+// sha2_256_multi<N>, sha2_512_multi<N>
+//
+// N independent computations over messages of equal length,
+// interleaved so that they can be processed in SIMD lanes
+
+template<std::size_t N> class sha2_256_multi: public detail::multi_buffer<detail::sha2_256_lanes, N>
+{
+public:
+
+    using detail::multi_buffer<detail::sha2_256_lanes, N>::multi_buffer;
+};
+
+template<std::size_t N> class sha2_512_multi: public detail::multi_buffer<detail::sha2_512_lanes, N>
+{
+public:
+
+    using detail::multi_buffer<detail::sha2_512_lanes, N>::multi_buffer;
+};
+
+namespace detail
+{
+
+template<> struct multi_lane<sha2_256>
+{
+    static constexpr bool value = true;
+    template<std::size_t N> using type = sha2_256_multi<N>;
+};
+
+template<> struct multi_lane<sha2_512>
+{
+    static constexpr bool value = true;
+    template<std::size_t N> using type = sha2_512_multi<N>;
+};
+
+} // namespace detail
+
+// hmac_sha2_256_multi<N>
+//
+// N HMAC-SHA-256 computations with the same key over messages of equal
+// length; both passes start from the states precomputed in hmac_key
+
+template<std::size_t N> class hmac_sha2_256_multi
+{
+private:
+
+    using multi_type = detail::multi_buffer<detail::sha2_256_lanes, N>;
+
+    std::uint32_t outer_[ 8 ];
+    std::uint64_t outer_n_;
+
+    multi_type inner_;
+
+    static multi_type make_inner( hmac_key<sha2_256> const& key )
+    {
+        std::uint32_t iv[ 8 ];
+        std::uint64_t n = detail::sha2_256_lanes::midstate( detail::hmac_key_access::inner( key ), iv );
+
+        return multi_type( iv, n );
+    }
+
+public:
+
+    using result_type = std::array<digest<32>, N>;
+
+    static constexpr int block_size = 64;
+    static constexpr std::size_t lanes = N;
+
+    explicit hmac_sha2_256_multi( hmac_key<sha2_256> const& key ):
+        outer_n_( detail::sha2_256_lanes::midstate( detail::hmac_key_access::outer( key ), outer_ ) ), inner_( make_inner( key ) )
+    {
+    }
+
+    // appends [p[j], p[j]+n) to message j, for each j in [0, N)
+
+    void update( unsigned char const* const p[ N ], std::size_t n )
+    {
+        inner_.update( p, n );
+    }
+
+    void update( void const* const p[ N ], std::size_t n )
+    {
+        inner_.update( p, n );
+    }
+
+    result_type result()
+    {
+        result_type r = inner_.result();
+
+        unsigned char const* q[ N ];
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            q[ j ] = r[ j ].data();
+        }
+
+        multi_type outer( outer_, outer_n_ );
+        outer.update( q, 32 );
+
+        return outer.result();
+    }
+};
+
+namespace detail
+{
+
+template<> struct hmac_multi<sha2_256>
+{
+    static constexpr bool value = true;
+    template<std::size_t N> using type = hmac_sha2_256_multi<N>;
+};
+
+} // namespace detail
+
+// verify, checks the HMAC-SHA-256 of each of the N messages [p[j], p[j]+n)
+// against tag[j], and stores the outcome in ok[j]; returns the number of
+// messages that passed
+
+template<std::size_t N> std::size_t verify( hmac_key<sha2_256> const& key, unsigned char const* const (&p)[ N ], std::size_t n, digest<32> const (&tag)[ N ], bool (&ok)[ N ] )
+{
+    hmac_sha2_256_multi<N> h( key );
+    h.update( p, n );
+
+    typename hmac_sha2_256_multi<N>::result_type r = h.result();
+
+    std::size_t k = 0;
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        ok[ j ] = r[ j ] == tag[ j ];
+        k += ok[ j ];
+    }
+
+    return k;
+}
+
 } // namespace hash2
 } // namespace boost
 
@@ -0,0 +1,715 @@
+#ifndef BOOST_HASH2_SHA3_HPP_INCLUDED
+#define BOOST_HASH2_SHA3_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// SHA-3 and SHAKE, https://nvlpubs.nist.gov/nistpubs/FIPS/NIST.FIPS.202.pdf
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/keccak.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+// R: the rate, in bytes
+// Rounds: 24 for Keccak-f[1600], 12 for the Keccak-p[1600, 12] of TurboSHAKE
+
+template<int R, int Rounds = 24>
+struct sha3_base
+{
+    static constexpr int N = R;
+
+    std::uint64_t state_[ 25 ] = {};
+
+    unsigned char buffer_[ N ] = {};
+    std::size_t m_ = 0; // < N
+
+    BOOST_CXX14_CONSTEXPR void absorb( unsigned char const* p )
+    {
+        for( int i = 0; i < N / 8; ++i )
+        {
+            state_[ i ] ^= detail::read64le( p + i * 8 );
+        }
+
+        permute( state_ );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void permute( std::uint64_t A[ 25 ] )
+    {
+        if( Rounds == 12 )
+        {
+            detail::keccak_permute12( A );
+        }
+        else
+        {
+            detail::keccak_permute( A );
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_ASSERT( m_ < N );
+
+        if( m_ > 0 )
+        {
+            std::size_t k = N - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < N ) return;
+
+            BOOST_ASSERT( m_ == N );
+
+            absorb( buffer_ );
+            m_ = 0;
+
+            detail::memset( buffer_, 0, N );
+        }
+
+        BOOST_ASSERT( m_ == 0 );
+
+        while( n >= N )
+        {
+            absorb( p );
+
+            p += N;
+            n -= N;
+        }
+
+        BOOST_ASSERT( n < N );
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    // pads the buffered input with the domain separation suffix ds
+    // and the final bit of pad10*1, and absorbs it
+
+    BOOST_CXX14_CONSTEXPR void finalize( unsigned char ds )
+    {
+        BOOST_ASSERT( m_ < N );
+
+        buffer_[ m_ ] = ds;
+        buffer_[ N - 1 ] |= 0x80;
+
+        absorb( buffer_ );
+        m_ = 0;
+
+        detail::memset( buffer_, 0, N );
+    }
+
+    // copies the first n bytes of the state to out
+
+    BOOST_CXX14_CONSTEXPR void extract( unsigned char* out, std::size_t n ) const
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            out[ i ] = static_cast<unsigned char>( state_[ i / 8 ] >> ( i % 8 * 8 ) );
+        }
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 200 + N + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        sha3_base tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ < N ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<int R, int Rounds> constexpr int sha3_base<R, Rounds>::N;
+
+#endif
+
+} // namespace detail
+
+class sha3_256: detail::sha3_base<136>
+{
+public:
+
+    using result_type = digest<32>;
+
+    static constexpr int block_size = 136;
+
+    sha3_256() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit sha3_256( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR sha3_256( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    using detail::sha3_base<136>::state_size;
+    using detail::sha3_base<136>::save_state;
+    using detail::sha3_base<136>::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha3_256, "sha3_256", n );
+        detail::sha3_base<136>::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( sha3_256, "sha3_256" );
+
+        finalize( 0x06 );
+
+        result_type digest;
+        extract( digest.data(), digest.size() );
+
+        return digest;
+    }
+};
+
+class sha3_224: detail::sha3_base<144>
+{
+public:
+
+    using result_type = digest<28>;
+
+    static constexpr int block_size = 144;
+
+    sha3_224() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit sha3_224( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR sha3_224( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    using detail::sha3_base<144>::state_size;
+    using detail::sha3_base<144>::save_state;
+    using detail::sha3_base<144>::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha3_224, "sha3_224", n );
+        detail::sha3_base<144>::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( sha3_224, "sha3_224" );
+
+        finalize( 0x06 );
+
+        result_type digest;
+        extract( digest.data(), digest.size() );
+
+        return digest;
+    }
+};
+
+class sha3_512: detail::sha3_base<72>
+{
+public:
+
+    using result_type = digest<64>;
+
+    static constexpr int block_size = 72;
+
+    sha3_512() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit sha3_512( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR sha3_512( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    using detail::sha3_base<72>::state_size;
+    using detail::sha3_base<72>::save_state;
+    using detail::sha3_base<72>::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha3_512, "sha3_512", n );
+        detail::sha3_base<72>::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( sha3_512, "sha3_512" );
+
+        finalize( 0x06 );
+
+        result_type digest;
+        extract( digest.data(), digest.size() );
+
+        return digest;
+    }
+};
+
+class sha3_384: detail::sha3_base<104>
+{
+public:
+
+    using result_type = digest<48>;
+
+    static constexpr int block_size = 104;
+
+    sha3_384() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit sha3_384( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR sha3_384( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    using detail::sha3_base<104>::state_size;
+    using detail::sha3_base<104>::save_state;
+    using detail::sha3_base<104>::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( sha3_384, "sha3_384", n );
+        detail::sha3_base<104>::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( sha3_384, "sha3_384" );
+
+        finalize( 0x06 );
+
+        result_type digest;
+        extract( digest.data(), digest.size() );
+
+        return digest;
+    }
+};
+
+// SHAKE128 and SHAKE256 are extendable-output functions; each call to
+// result() returns the next bytes of the output
+
+class shake128: detail::sha3_base<168>
+{
+private:
+
+    bool squeezing_ = false;
+    std::size_t k_ = 0; // bytes of the current output block already returned
+
+public:
+
+    using result_type = digest<32>;
+
+    static constexpr int block_size = 168;
+
+    shake128() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit shake128( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR shake128( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( shake128, "shake128", n );
+
+        // input after result() is absorbed into the current state
+
+        squeezing_ = false;
+        detail::sha3_base<168>::update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( shake128, "shake128" );
+
+        if( !squeezing_ )
+        {
+            finalize( 0x1F );
+
+            squeezing_ = true;
+            k_ = 0;
+        }
+
+        result_type digest;
+
+        for( std::size_t i = 0; i < digest.size(); ++i )
+        {
+            if( k_ == N )
+            {
+                detail::keccak_permute( state_ );
+                k_ = 0;
+            }
+
+            digest[ i ] = static_cast<unsigned char>( state_[ k_ / 8 ] >> ( k_ % 8 * 8 ) );
+            ++k_;
+        }
+
+        return digest;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+
+        ar.u8( self.squeezing_ );
+        ar.u64( self.k_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 200 + N + 8 + 1 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        shake128 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ < N && tmp.k_ <= N ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+class shake256: detail::sha3_base<136>
+{
+private:
+
+    bool squeezing_ = false;
+    std::size_t k_ = 0; // bytes of the current output block already returned
+
+public:
+
+    using result_type = digest<64>;
+
+    static constexpr int block_size = 136;
+
+    shake256() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit shake256( std::uint64_t seed )
+    {
+        if( seed != 0 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, seed );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR shake256( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( shake256, "shake256", n );
+
+        // input after result() is absorbed into the current state
+
+        squeezing_ = false;
+        detail::sha3_base<136>::update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( shake256, "shake256" );
+
+        if( !squeezing_ )
+        {
+            finalize( 0x1F );
+
+            squeezing_ = true;
+            k_ = 0;
+        }
+
+        result_type digest;
+
+        for( std::size_t i = 0; i < digest.size(); ++i )
+        {
+            if( k_ == N )
+            {
+                detail::keccak_permute( state_ );
+                k_ = 0;
+            }
+
+            digest[ i ] = static_cast<unsigned char>( state_[ k_ / 8 ] >> ( k_ % 8 * 8 ) );
+            ++k_;
+        }
+
+        return digest;
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.state_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+
+        ar.u8( self.squeezing_ );
+        ar.u64( self.k_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 200 + N + 8 + 1 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        shake256 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ < N && tmp.k_ <= N ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+using hmac_sha3_256 = hmac<sha3_256>;
+using hmac_sha3_224 = hmac<sha3_224>;
+using hmac_sha3_512 = hmac<sha3_512>;
+using hmac_sha3_384 = hmac<sha3_384>;
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SHA3_HPP_INCLUDED
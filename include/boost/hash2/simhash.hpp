@@ -0,0 +1,114 @@
+#ifndef BOOST_HASH2_SIMHASH_HPP_INCLUDED
+#define BOOST_HASH2_SIMHASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+BOOST_FORCEINLINE int popcount64( std::uint64_t x ) noexcept
+{
+#if defined(__GNUC__) || defined(__clang__)
+
+    return __builtin_popcountll( x );
+
+#else
+
+    x = x - ( ( x >> 1 ) & 0x5555555555555555ull );
+    x = ( x & 0x3333333333333333ull ) + ( ( x >> 2 ) & 0x3333333333333333ull );
+    x = ( x + ( x >> 4 ) ) & 0x0F0F0F0F0F0F0F0Full;
+
+    return static_cast<int>( ( x * 0x0101010101010101ull ) >> 56 );
+
+#endif
+}
+
+} // namespace detail
+
+// simhash<H, Flavor>, 64 bit SimHash (Charikar) signatures of a sequence
+// of tokens; similar sequences have signatures at a small Hamming distance
+
+template<class H, class Flavor = default_flavor> class simhash
+{
+private:
+
+    H h_;
+
+public:
+
+    using hash_type = H;
+
+    simhash(): h_()
+    {
+    }
+
+    explicit simhash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    simhash( unsigned char const* seed, std::size_t n ): h_( seed, n )
+    {
+    }
+
+    template<class It> std::uint64_t signature( It first, It last ) const
+    {
+        // c[ j ] counts the tokens whose hash value has bit j set; the
+        // inner loop has no branches, and vectorizes
+
+        std::size_t c[ 64 ] = {};
+        std::size_t n = 0;
+
+        for( ; first != last; ++first, ++n )
+        {
+            std::uint64_t h = detail::hash_value64<H, Flavor>( h_, *first );
+
+            for( int j = 0; j < 64; ++j )
+            {
+                c[ j ] += static_cast<std::size_t>( h >> j & 1 );
+            }
+        }
+
+        std::uint64_t r = 0;
+
+        for( int j = 0; j < 64; ++j )
+        {
+            r |= static_cast<std::uint64_t>( 2 * c[ j ] > n ) << j;
+        }
+
+        return r;
+    }
+
+    template<class R> std::uint64_t signature( R const& r ) const
+    {
+        using std::begin;
+        using std::end;
+
+        return signature( begin( r ), end( r ) );
+    }
+
+    // the number of differing bits
+
+    static int distance( std::uint64_t s1, std::uint64_t s2 ) noexcept
+    {
+        return detail::popcount64( s1 ^ s2 );
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SIMHASH_HPP_INCLUDED
@@ -8,10 +8,14 @@
 // SipHash, https://131002.net/siphash/
 
 #include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/hash2/detail/memcpy.hpp>
 #include <boost/hash2/detail/memset.hpp>
 #include <boost/hash2/detail/config.hpp>
+#include <boost/hash2/detail/siphash_x86.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
 #include <boost/assert.hpp>
 #include <cstdint>
 #include <cstring>
@@ -22,7 +26,12 @@ namespace boost
 namespace hash2
 {
 
-class siphash_64
+namespace detail
+{
+
+// C compression rounds, D finalization rounds
+
+template<int C, int D> class siphash_64_impl
 {
 private:
 
@@ -56,31 +65,48 @@ private:
         v2 = detail::rotl(v2, 32);
     }
 
-    BOOST_CXX14_CONSTEXPR void update_( unsigned char const * p )
+    BOOST_CXX14_CONSTEXPR void compress( std::uint64_t m )
     {
-        std::uint64_t m = detail::read64le( p );
-
         v3 ^= m;
 
-        sipround();
-        sipround();
+        for( int i = 0; i < C; ++i )
+        {
+            sipround();
+        }
 
         v0 ^= m;
     }
 
+    BOOST_CXX14_CONSTEXPR void update_( unsigned char const * p )
+    {
+        compress( detail::read64le( p ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t finalize()
+    {
+        v2 ^= 0xFF;
+
+        for( int i = 0; i < D; ++i )
+        {
+            sipround();
+        }
+
+        return v0 ^ v1 ^ v2 ^ v3;
+    }
+
 public:
 
     using result_type = std::uint64_t;
 
-    siphash_64() = default;
+    siphash_64_impl() = default;
 
-    BOOST_CXX14_CONSTEXPR explicit siphash_64( std::uint64_t seed )
+    BOOST_CXX14_CONSTEXPR explicit siphash_64_impl( std::uint64_t seed )
     {
         v0 ^= seed;
         v2 ^= seed;
     }
 
-    BOOST_CXX14_CONSTEXPR siphash_64( unsigned char const * p, std::size_t n )
+    BOOST_CXX14_CONSTEXPR siphash_64_impl( unsigned char const * p, std::size_t n )
     {
         if( n == 16 )
         {
@@ -94,13 +120,17 @@ public:
         }
         else if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
+        BOOST_HASH2_STATS_UPDATE( siphash_64_impl, C == 2? "siphash_64": "siphash13_64", n );
+
         BOOST_ASSERT( m_ == n_ % 8 );
 
         if( n == 0 ) return;
@@ -160,8 +190,35 @@ public:
         update( p, n );
     }
 
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w; completes the buffered
+    // partial word, if any, and mixes it in directly
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( siphash_64_impl, C == 2? "siphash_64": "siphash13_64", 8 );
+
+        BOOST_ASSERT( m_ == n_ % 8 );
+
+        n_ += 8;
+
+        if( m_ == 0 )
+        {
+            compress( w );
+        }
+        else
+        {
+            std::uint64_t const b = detail::read64le( buffer_ ) & ( ( static_cast<std::uint64_t>( 1 ) << ( 8 * m_ ) ) - 1 );
+
+            compress( b | ( w << ( 8 * m_ ) ) );
+            detail::write64le( buffer_, w >> ( 64 - 8 * m_ ) );
+        }
+    }
+
     BOOST_CXX14_CONSTEXPR std::uint64_t result()
     {
+        BOOST_HASH2_STATS_RESULT( siphash_64_impl, C == 2? "siphash_64": "siphash13_64" );
+
         BOOST_ASSERT( m_ == n_ % 8 );
 
         detail::memset( buffer_ + m_, 0, 8 - m_ );
@@ -170,12 +227,7 @@ public:
 
         update_( buffer_ );
 
-        v2 ^= 0xFF;
-
-        sipround();
-        sipround();
-        sipround();
-        sipround();
+        std::uint64_t r = finalize();
 
         n_ += 8 - m_;
         m_ = 0;
@@ -183,11 +235,205 @@ public:
         // clear buffered plaintext
         detail::memset( buffer_, 0, 8 );
 
-        return v0 ^ v1 ^ v2 ^ v3;
+        return r;
+    }
+
+    // One-shot hashing of a single message, equivalent to constructing
+    // from ( key, 16 ) and calling update( p, n ) and result(), but
+    // without going through the buffer
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash( unsigned char const (&key)[ 16 ], unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_MESSAGES( siphash_64_impl, C == 2? "siphash_64": "siphash13_64", 1, n );
+
+        siphash_64_impl h( key, 16 );
+
+        unsigned char const* q = p;
+
+        for( std::size_t i = n / 8; i > 0; --i, q += 8 )
+        {
+            h.update_( q );
+        }
+
+        std::size_t const r = n % 8;
+
+        std::uint64_t m = static_cast<std::uint64_t>( n & 0xFF ) << 56;
+
+        if( r == 0 )
+        {
+        }
+        else if( p != q )
+        {
+            // at least one full word precedes the tail; load the last
+            // eight bytes and shift out the ones already consumed
+
+            m |= detail::read64le( q + r - 8 ) >> ( 64 - 8 * r );
+        }
+        else if( r >= 4 )
+        {
+            m |= detail::read32le( q ) | static_cast<std::uint64_t>( detail::read32le( q + r - 4 ) ) << ( 8 * ( r - 4 ) );
+        }
+        else
+        {
+            m |= static_cast<std::uint64_t>( q[ 0 ] ) | static_cast<std::uint64_t>( q[ r / 2 ] ) << ( 8 * ( r / 2 ) ) | static_cast<std::uint64_t>( q[ r - 1 ] ) << ( 8 * ( r - 1 ) );
+        }
+
+        h.compress( m );
+
+        return h.finalize();
+    }
+
+    static std::uint64_t hash( unsigned char const (&key)[ 16 ], void const* p, std::size_t n )
+    {
+        return hash( key, static_cast<unsigned char const*>( p ), n );
+    }
+
+    // Equivalent to a copy of *this after update( p, N ) and result(), for
+    // N known at compile time; at a word boundary, the input is read in
+    // place, and the final partial word is assembled with a fixed shift
+
+    template<std::size_t N> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t hash_fixed( unsigned char const* p ) const
+    {
+        siphash_64_impl h( *this );
+
+        if( m_ != 0 )
+        {
+            h.update( p, N );
+            return h.result();
+        }
+
+        BOOST_HASH2_STATS_MESSAGES( siphash_64_impl, C == 2? "siphash_64": "siphash13_64", 1, N );
+
+        for( std::size_t i = 0; i < N / 8; ++i )
+        {
+            h.update_( p + i * 8 );
+        }
+
+        std::size_t const r = N % 8;
+
+        // shifts out the consumed bytes of the last eight; not 64 when r
+        // is 0, even though it's unused then, as some compilers warn
+
+        int const s = r == 0? 0: static_cast<int>( 64 - 8 * r );
+
+        std::uint64_t m = static_cast<std::uint64_t>( ( n_ + N ) & 0xFF ) << 56;
+
+        if( r == 0 )
+        {
+        }
+        else if( N >= 8 )
+        {
+            m |= detail::read64le( p + N - 8 ) >> s;
+        }
+        else
+        {
+            for( std::size_t i = 0; i < r; ++i )
+            {
+                m |= static_cast<std::uint64_t>( p[ i ] ) << ( 8 * i );
+            }
+        }
+
+        h.compress( m );
+
+        return h.finalize();
+    }
+
+    // Computes out[ i ], for i in [0, k), as a copy of *this would after
+    // update( p[ i ], n[ i ] ) and result(); the messages are processed
+    // in parallel AVX2 lanes, eight at a time, when available
+
+    void hash_batch( unsigned char const* const p[], std::size_t const n[], std::size_t k, std::uint64_t out[] ) const
+    {
+        BOOST_HASH2_STATS_BATCH( siphash_64_impl, C == 2? "siphash_64": "siphash13_64", n, k );
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( m_ == 0 && k >= 4 && detail::has_x86_avx2() )
+        {
+            std::uint64_t const v[ 4 ] = { v0, v1, v2, v3 };
+
+            detail::siphash_64_batch_avx2<C, D>( v, n_, p, n, k, out );
+            return;
+        }
+
+#endif
+
+        BOOST_HASH2_STATS_SUSPEND();
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            siphash_64_impl h( *this );
+
+            h.update( p[ i ], n[ i ] );
+            out[ i ] = h.result();
+        }
+
+        BOOST_HASH2_STATS_RESUME();
+    }
+
+    void hash_batch( void const* const p[], std::size_t const n[], std::size_t k, std::uint64_t out[] ) const
+    {
+        unsigned char const* q[ 8 ];
+
+        for( std::size_t i = 0; i < k; i += 8 )
+        {
+            std::size_t m = k - i < 8? k - i: 8;
+
+            for( std::size_t j = 0; j < m; ++j )
+            {
+                q[ j ] = static_cast<unsigned char const*>( p[ i + j ] );
+            }
+
+            hash_batch( q, n + i, m, out + i );
+        }
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u64( self.v0 );
+        ar.u64( self.v1 );
+        ar.u64( self.v2 );
+        ar.u64( self.v3 );
+
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 49;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        siphash_64_impl tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        tmp.m_ = static_cast<std::size_t>( tmp.n_ % 8 );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
     }
 };
 
-class siphash_32
+template<int C, int D> class siphash_32_impl
 {
 private:
 
@@ -221,25 +467,42 @@ private:
         v2 = detail::rotl(v2, 16);
     }
 
-    BOOST_CXX14_CONSTEXPR void update_( unsigned char const * p )
+    BOOST_CXX14_CONSTEXPR void compress( std::uint32_t m )
     {
-        std::uint32_t m = detail::read32le( p );
-
         v3 ^= m;
 
-        sipround();
-        sipround();
+        for( int i = 0; i < C; ++i )
+        {
+            sipround();
+        }
 
         v0 ^= m;
     }
 
+    BOOST_CXX14_CONSTEXPR void update_( unsigned char const * p )
+    {
+        compress( detail::read32le( p ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint32_t finalize()
+    {
+        v2 ^= 0xFF;
+
+        for( int i = 0; i < D; ++i )
+        {
+            sipround();
+        }
+
+        return v1 ^ v3;
+    }
+
 public:
 
     using result_type = std::uint32_t;
 
-    siphash_32() = default;
+    siphash_32_impl() = default;
 
-    BOOST_CXX14_CONSTEXPR explicit siphash_32( std::uint64_t seed )
+    BOOST_CXX14_CONSTEXPR explicit siphash_32_impl( std::uint64_t seed )
     {
         std::uint32_t k0 = static_cast<std::uint32_t>( seed );
         std::uint32_t k1 = static_cast<std::uint32_t>( seed >> 32 );
@@ -250,7 +513,7 @@ public:
         v3 ^= k1;
     }
 
-    BOOST_CXX14_CONSTEXPR siphash_32( unsigned char const * p, std::size_t n )
+    BOOST_CXX14_CONSTEXPR siphash_32_impl( unsigned char const * p, std::size_t n )
     {
         if( n == 8 )
         {
@@ -264,13 +527,17 @@ public:
         }
         else if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
+        BOOST_HASH2_STATS_UPDATE( siphash_32_impl, C == 2? "siphash_32": "siphash13_32", n );
+
         BOOST_ASSERT( m_ == n_ % 4 );
 
         if( n == 0 ) return;
@@ -330,8 +597,36 @@ public:
         update( p, n );
     }
 
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( siphash_32_impl, C == 2? "siphash_32": "siphash13_32", 8 );
+
+        BOOST_ASSERT( m_ == n_ % 4 );
+
+        n_ += 8;
+
+        if( m_ == 0 )
+        {
+            compress( static_cast<std::uint32_t>( w ) );
+            compress( static_cast<std::uint32_t>( w >> 32 ) );
+        }
+        else
+        {
+            std::uint32_t const b = detail::read32le( buffer_ ) & ( ( static_cast<std::uint32_t>( 1 ) << ( 8 * m_ ) ) - 1 );
+
+            compress( b | static_cast<std::uint32_t>( w << ( 8 * m_ ) ) );
+            compress( static_cast<std::uint32_t>( w >> ( 32 - 8 * m_ ) ) );
+            detail::write32le( buffer_, static_cast<std::uint32_t>( w >> ( 64 - 8 * m_ ) ) );
+        }
+    }
+
     BOOST_CXX14_CONSTEXPR std::uint32_t result()
     {
+        BOOST_HASH2_STATS_RESULT( siphash_32_impl, C == 2? "siphash_32": "siphash13_32" );
+
         BOOST_ASSERT( m_ == n_ % 4 );
 
         detail::memset( buffer_ + m_, 0, 4 - m_ );
@@ -340,12 +635,7 @@ public:
 
         update_( buffer_ );
 
-        v2 ^= 0xFF;
-
-        sipround();
-        sipround();
-        sipround();
-        sipround();
+        std::uint32_t r = finalize();
 
         n_ += 4 - m_;
         m_ = 0;
@@ -353,7 +643,164 @@ public:
         // clear buffered plaintext
         detail::memset( buffer_, 0, 4 );
 
-        return v1 ^ v3;
+        return r;
+    }
+
+    // One-shot hashing of a single message, equivalent to constructing
+    // from ( key, 8 ) and calling update( p, n ) and result(), but
+    // without going through the buffer
+
+    BOOST_CXX14_CONSTEXPR static std::uint32_t hash( unsigned char const (&key)[ 8 ], unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_MESSAGES( siphash_32_impl, C == 2? "siphash_32": "siphash13_32", 1, n );
+
+        siphash_32_impl h( key, 8 );
+
+        unsigned char const* q = p;
+
+        for( std::size_t i = n / 4; i > 0; --i, q += 4 )
+        {
+            h.update_( q );
+        }
+
+        std::size_t const r = n % 4;
+
+        std::uint32_t m = static_cast<std::uint32_t>( n & 0xFF ) << 24;
+
+        if( r == 0 )
+        {
+        }
+        else if( p != q )
+        {
+            // at least one full word precedes the tail; load the last
+            // four bytes and shift out the ones already consumed
+
+            m |= detail::read32le( q + r - 4 ) >> ( 32 - 8 * r );
+        }
+        else
+        {
+            m |= static_cast<std::uint32_t>( q[ 0 ] ) | static_cast<std::uint32_t>( q[ r / 2 ] ) << ( 8 * ( r / 2 ) ) | static_cast<std::uint32_t>( q[ r - 1 ] ) << ( 8 * ( r - 1 ) );
+        }
+
+        h.compress( m );
+
+        return h.finalize();
+    }
+
+    static std::uint32_t hash( unsigned char const (&key)[ 8 ], void const* p, std::size_t n )
+    {
+        return hash( key, static_cast<unsigned char const*>( p ), n );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u32( self.v0 );
+        ar.u32( self.v1 );
+        ar.u32( self.v2 );
+        ar.u32( self.v3 );
+
+        ar.bytes( self.buffer_ );
+        ar.u32( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 25;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        siphash_32_impl tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        tmp.m_ = tmp.n_ % 4;
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace detail
+
+// SipHash-2-4 and HalfSipHash-2-4
+
+class siphash_64: public detail::siphash_64_impl<2, 4>
+{
+public:
+
+    siphash_64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit siphash_64( std::uint64_t seed ): detail::siphash_64_impl<2, 4>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR siphash_64( unsigned char const * p, std::size_t n ): detail::siphash_64_impl<2, 4>( p, n )
+    {
+    }
+};
+
+class siphash_32: public detail::siphash_32_impl<2, 4>
+{
+public:
+
+    siphash_32() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit siphash_32( std::uint64_t seed ): detail::siphash_32_impl<2, 4>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR siphash_32( unsigned char const * p, std::size_t n ): detail::siphash_32_impl<2, 4>( p, n )
+    {
+    }
+};
+
+// SipHash-1-3 and HalfSipHash-1-3, with one compression and three
+// finalization rounds, faster on short inputs
+
+class siphash13_64: public detail::siphash_64_impl<1, 3>
+{
+public:
+
+    siphash13_64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit siphash13_64( std::uint64_t seed ): detail::siphash_64_impl<1, 3>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR siphash13_64( unsigned char const * p, std::size_t n ): detail::siphash_64_impl<1, 3>( p, n )
+    {
+    }
+};
+
+class siphash13_32: public detail::siphash_32_impl<1, 3>
+{
+public:
+
+    siphash13_32() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit siphash13_32( std::uint64_t seed ): detail::siphash_32_impl<1, 3>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR siphash13_32( unsigned char const * p, std::size_t n ): detail::siphash_32_impl<1, 3>( p, n )
+    {
     }
 };
 
@@ -0,0 +1,56 @@
+#ifndef BOOST_HASH2_SNAPSHOT_RESULT_HPP_INCLUDED
+#define BOOST_HASH2_SNAPSHOT_RESULT_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// snapshot_result, the digest of the message so far, without ending it
+
+#include <boost/config.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// Hash::snapshot_result() is an optional const member, equivalent to
+// a copy of the hash object followed by result()
+
+template<class Hash, class En = void> struct has_snapshot_result: std::false_type
+{
+};
+
+template<class Hash> struct has_snapshot_result<Hash, decltype( std::declval<Hash const&>().snapshot_result(), void() )>: std::true_type
+{
+};
+
+template<class H> BOOST_CXX14_CONSTEXPR typename H::result_type snapshot_result_( H const& h, std::true_type )
+{
+    return h.snapshot_result();
+}
+
+template<class H> BOOST_CXX14_CONSTEXPR typename H::result_type snapshot_result_( H const& h, std::false_type )
+{
+    H h2( h );
+    return h2.result();
+}
+
+} // namespace detail
+
+// the value h.result() would return, leaving h unchanged
+
+template<class H> BOOST_CXX14_CONSTEXPR typename H::result_type snapshot_result( H const& h )
+{
+    return detail::snapshot_result_( h, detail::has_snapshot_result<H>() );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_SNAPSHOT_RESULT_HPP_INCLUDED
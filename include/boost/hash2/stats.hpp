@@ -0,0 +1,79 @@
+#ifndef BOOST_HASH2_STATS_HPP_INCLUDED
+#define BOOST_HASH2_STATS_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// stats_snapshot(), the usage statistics of the hash algorithms, when
+// BOOST_HASH2_ENABLE_STATS is defined
+
+#include <boost/hash2/detail/stats.hpp>
+#include <vector>
+#include <cstdint>
+
+namespace boost
+{
+namespace hash2
+{
+
+struct algorithm_stats
+{
+    // the name of the algorithm, such as "sha2_256"
+    char const* name;
+
+    // the number of calls to update, update_word included
+    std::uint64_t update_calls;
+
+    // the total number of bytes passed to update and update_word
+    std::uint64_t bytes;
+
+    // the number of calls to result
+    std::uint64_t result_calls;
+};
+
+// the counts of the algorithms used by the program so far, in the order in
+// which they were first used, summed over all threads; empty when
+// BOOST_HASH2_ENABLE_STATS isn't defined
+//
+// the counts of the other threads are read while they are being updated,
+// so a snapshot may miss their most recent calls; the counts only grow, and
+// the rates are the differences between snapshots
+
+inline std::vector<algorithm_stats> stats_snapshot()
+{
+    std::vector<algorithm_stats> r;
+
+#if defined(BOOST_HASH2_ENABLE_STATS)
+
+    detail::stats_registry& s = detail::stats_instance();
+    std::lock_guard<std::mutex> lock( s.mx );
+
+    r.resize( s.size );
+
+    for( std::size_t i = 0; i < s.size; ++i )
+    {
+        algorithm_stats& a = r[ i ];
+
+        a.name = s.names[ i ];
+        a.update_calls = s.retired[ i ][ 0 ] + s.sink.c[ i ].update_calls.load( std::memory_order_relaxed );
+        a.bytes = s.retired[ i ][ 1 ] + s.sink.c[ i ].bytes.load( std::memory_order_relaxed );
+        a.result_calls = s.retired[ i ][ 2 ] + s.sink.c[ i ].result_calls.load( std::memory_order_relaxed );
+
+        for( detail::stats_block const* b: s.blocks )
+        {
+            a.update_calls += b->c[ i ].update_calls.load( std::memory_order_relaxed );
+            a.bytes += b->c[ i ].bytes.load( std::memory_order_relaxed );
+            a.result_calls += b->c[ i ].result_calls.load( std::memory_order_relaxed );
+        }
+    }
+
+#endif
+
+    return r;
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_STATS_HPP_INCLUDED
@@ -0,0 +1,551 @@
+#ifndef BOOST_HASH2_STRING_INTERNER_HPP_INCLUDED
+#define BOOST_HASH2_STRING_INTERNER_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// string_interner<H>, a concurrent string interner that keeps each string
+// once, together with its hash value, and hands out pointer-sized handles
+// that hash without reading the characters
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/concurrent_digest_map.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class H, class Flavor, std::size_t Shards> class string_interner;
+
+namespace detail
+{
+
+// a string in the arena of a string_interner; the characters and a null
+// terminator follow
+
+struct interned_record
+{
+    std::size_t hash;
+    std::size_t size;
+
+    char const* data() const noexcept
+    {
+        return static_cast<char const*>( static_cast<void const*>( this + 1 ) );
+    }
+};
+
+// [p, p+n), as a range of char that hash<std::string> accepts
+
+struct interner_key
+{
+    char const* p;
+    std::size_t n;
+
+    char const* data() const noexcept
+    {
+        return p;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return n;
+    }
+};
+
+} // namespace detail
+
+// interned_string, a handle to a string kept by a string_interner; valid
+// for the lifetime of the interner
+
+class interned_string
+{
+private:
+
+    detail::interned_record const* p_;
+
+    template<class H, class Flavor, std::size_t Shards> friend class string_interner;
+
+    explicit interned_string( detail::interned_record const* p ) noexcept: p_( p )
+    {
+    }
+
+public:
+
+    constexpr interned_string() noexcept: p_( nullptr )
+    {
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return p_ != nullptr;
+    }
+
+    char const* data() const noexcept
+    {
+        return p_? p_->data(): "";
+    }
+
+    char const* c_str() const noexcept
+    {
+        return data();
+    }
+
+    std::size_t size() const noexcept
+    {
+        return p_? p_->size: 0;
+    }
+
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    std::string str() const
+    {
+        return std::string( data(), size() );
+    }
+
+    // the value hash<std::string, H, Flavor> of the interner returns
+    // for the string, or 0 for an empty handle
+
+    std::size_t hash_value() const noexcept
+    {
+        return p_? p_->hash: 0;
+    }
+
+    // an interner keeps each string once, so the handles it returns
+    // are equal if and only if the strings are
+
+    friend bool operator==( interned_string const& a, interned_string const& b ) noexcept
+    {
+        return a.p_ == b.p_;
+    }
+
+    friend bool operator!=( interned_string const& a, interned_string const& b ) noexcept
+    {
+        return a.p_ != b.p_;
+    }
+
+    // hash_append appends the stored hash value instead of the characters
+
+    template<class Hash, class Flavor>
+    friend void tag_invoke( hash_append_tag const&, Hash& h, Flavor const& f, interned_string const& v )
+    {
+        hash2::hash_append( h, f, v.hash_value() );
+    }
+};
+
+// the hash function object returns the stored hash value; H2 and the
+// seed are ignored, as the value was already computed by the interner
+
+template<class H2, class Flavor2> class hash<interned_string, H2, Flavor2>
+{
+public:
+
+    using is_avalanching = std::true_type;
+
+    hash()
+    {
+    }
+
+    explicit hash( std::uint64_t /*seed*/ )
+    {
+    }
+
+    hash( unsigned char const* /*seed*/, std::size_t /*n*/ )
+    {
+    }
+
+    std::size_t operator()( interned_string const& v ) const noexcept
+    {
+        return v.hash_value();
+    }
+};
+
+// string_interner<H, Flavor, Shards>
+//
+// the strings are hashed once, by hash<std::string, H, Flavor>, and kept
+// in the arena of their shard after their hash value and size, so that
+// the table only holds pointers to them, and grows without rehashing
+//
+// the tables are those of concurrent_digest_map, groups of 16 slots with
+// one byte fingerprints published with release stores, except that they
+// grow; a full table is replaced by one twice its size, and kept until
+// the interner is destroyed, for the lookups that may still be reading
+// it, so that lookups need no locks. interning a string that isn't found
+// takes the mutex of its shard, and looks for it again
+//
+// the low byte of the hash value selects the shard, the next byte is the
+// fingerprint, and the rest the first group
+//
+// all member functions can be called concurrently
+
+template<class H, class Flavor = default_flavor, std::size_t Shards = 64> class string_interner
+{
+public:
+
+    using hasher = hash<std::string, H, Flavor>;
+
+    static constexpr std::size_t shard_count = Shards;
+
+private:
+
+    static_assert( Shards > 0 && Shards <= 256 && ( Shards & ( Shards - 1 ) ) == 0, "Shards must be a power of two no larger than 256" );
+
+    static constexpr std::size_t G = 16;
+
+    // the size of the arena chunks; longer strings get chunks of their own
+    static constexpr std::size_t chunk_size = 65536;
+
+    using record = detail::interned_record;
+
+    struct group
+    {
+        std::atomic<std::uint64_t> fp[ 2 ];
+        record const* slots[ G ];
+    };
+
+    struct table
+    {
+        std::unique_ptr<group[]> groups;
+        std::size_t mask;
+        std::size_t limit;
+    };
+
+    // separate cache lines, so that the writers of one shard don't
+    // invalidate the lines the readers of another use
+
+    struct shard
+    {
+        unsigned char pad1_[ 64 ];
+
+        std::atomic<table const*> tab;
+
+        std::mutex mx;
+        std::atomic<std::size_t> size;
+
+        // the current table, and those it replaced
+        std::vector< std::unique_ptr<table> > tables;
+
+        std::vector< std::unique_ptr<unsigned char[]> > chunks;
+        unsigned char* pos;
+        std::size_t avail;
+
+        unsigned char pad2_[ 64 ];
+    };
+
+    hasher hf_;
+    std::unique_ptr<shard[]> shards_;
+
+private:
+
+    static unsigned char fingerprint( std::size_t h ) noexcept
+    {
+        unsigned char r = static_cast<unsigned char>( h >> 8 );
+        return r + ( r == 0 );
+    }
+
+    static std::size_t group_count( std::size_t capacity ) noexcept
+    {
+        std::size_t m = capacity / Shards;
+        m += m / 8;
+
+        std::size_t n = ( m * 8 / 7 + G - 1 ) / G;
+
+        std::size_t r = 1;
+        while( r < n ) r *= 2;
+
+        return r;
+    }
+
+    static std::unique_ptr<table> make_table( std::size_t n )
+    {
+        std::unique_ptr<table> t( new table );
+
+        t->groups.reset( new group[ n ] );
+        t->mask = n - 1;
+        t->limit = n * G / 8 * 7;
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            t->groups[ j ].fp[ 0 ].store( 0, std::memory_order_relaxed );
+            t->groups[ j ].fp[ 1 ].store( 0, std::memory_order_relaxed );
+        }
+
+        return t;
+    }
+
+    // the string [p, p+n) with the hash value h in t, or nullptr, and the
+    // group and slot of the first empty slot on the probe sequence
+    // otherwise; the fingerprint words are loaded with acquire, and a
+    // slot is only read after its published fingerprint has been observed
+
+    static record const* probe( table const& t, std::size_t h, char const* p, std::size_t n, group*& eg, unsigned& ei ) noexcept
+    {
+        unsigned char const fp = fingerprint( h );
+
+        std::size_t g = ( h >> 16 ) & t.mask;
+
+        for( std::size_t i = 0; i <= t.mask; ++i )
+        {
+            group& gr = t.groups[ g ];
+
+            for( unsigned w = 0; w < 2; ++w )
+            {
+                std::uint64_t x = gr.fp[ w ].load( std::memory_order_acquire );
+
+                for( std::uint64_t m = detail::match_bytes( x, fp ); m != 0; m &= m - 1 )
+                {
+                    record const* r = gr.slots[ w * 8 + detail::lowest_byte( m ) ];
+
+                    if( r->hash == h && r->size == n && ( n == 0 || std::memcmp( r->data(), p, n ) == 0 ) ) return r;
+                }
+
+                std::uint64_t e = detail::match_bytes( x, 0 );
+
+                if( e != 0 )
+                {
+                    eg = &gr;
+                    ei = w * 8 + detail::lowest_byte( e );
+
+                    return nullptr;
+                }
+            }
+
+            g = ( g + i + 1 ) & t.mask;
+        }
+
+        eg = nullptr;
+        return nullptr;
+    }
+
+    // only the thread holding the mutex of the shard writes its fingerprints
+
+    static void publish( group* eg, unsigned ei, record const* r ) noexcept
+    {
+        eg->slots[ ei ] = r;
+
+        std::atomic<std::uint64_t>& x = eg->fp[ ei / 8 ];
+        x.store( x.load( std::memory_order_relaxed ) | std::uint64_t( fingerprint( r->hash ) ) << ( ei % 8 * 8 ), std::memory_order_release );
+    }
+
+    // replaces the table of s by one twice its size; the records are
+    // moved by their stored hash values
+
+    static void grow( shard& s )
+    {
+        table const& t = *s.tab.load( std::memory_order_relaxed );
+
+        std::unique_ptr<table> t2 = make_table( ( t.mask + 1 ) * 2 );
+
+        for( std::size_t j = 0; j <= t.mask; ++j )
+        {
+            group const& gr = t.groups[ j ];
+
+            for( unsigned w = 0; w < 2; ++w )
+            {
+                std::uint64_t x = gr.fp[ w ].load( std::memory_order_relaxed );
+
+                for( std::uint64_t m = ~detail::match_bytes( x, 0 ) & 0x8080808080808080ull; m != 0; m &= m - 1 )
+                {
+                    record const* r = gr.slots[ w * 8 + detail::lowest_byte( m ) ];
+
+                    // r isn't in t2, so this finds the slot for it
+
+                    group* eg = nullptr;
+                    unsigned ei = 0;
+
+                    probe( *t2, r->hash, nullptr, 0, eg, ei );
+                    publish( eg, ei, r );
+                }
+            }
+        }
+
+        s.tab.store( t2.get(), std::memory_order_release );
+        s.tables.push_back( std::move( t2 ) );
+    }
+
+    // a record for n characters in the arena of s
+
+    static record* allocate( shard& s, std::size_t n )
+    {
+        std::size_t const k = ( sizeof( record ) + n + 1 + alignof( record ) - 1 ) / alignof( record ) * alignof( record );
+
+        if( k > s.avail )
+        {
+            if( k > chunk_size / 4 )
+            {
+                s.chunks.emplace_back( new unsigned char[ k ] );
+                return static_cast<record*>( static_cast<void*>( s.chunks.back().get() ) );
+            }
+
+            s.chunks.emplace_back( new unsigned char[ chunk_size ] );
+
+            s.pos = s.chunks.back().get();
+            s.avail = chunk_size;
+        }
+
+        record* r = static_cast<record*>( static_cast<void*>( s.pos ) );
+
+        s.pos += k;
+        s.avail -= k;
+
+        return r;
+    }
+
+    static record const* lookup( shard const& s, std::size_t h, char const* p, std::size_t n ) noexcept
+    {
+        group* eg = nullptr;
+        unsigned ei = 0;
+
+        return probe( *s.tab.load( std::memory_order_acquire ), h, p, n, eg, ei );
+    }
+
+public:
+
+    // capacity is the number of strings the tables hold before they grow
+
+    explicit string_interner( std::size_t capacity = 0, hasher const& hf = hasher() ): hf_( hf ), shards_( new shard[ Shards ] )
+    {
+        std::size_t const n = group_count( capacity );
+
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            shard& s = shards_[ i ];
+
+            s.tables.push_back( make_table( n ) );
+            s.tab.store( s.tables.back().get(), std::memory_order_relaxed );
+
+            s.size.store( 0, std::memory_order_relaxed );
+
+            s.pos = nullptr;
+            s.avail = 0;
+        }
+    }
+
+    string_interner( string_interner const& ) = delete;
+    string_interner& operator=( string_interner const& ) = delete;
+
+    hasher const& hash_function() const noexcept
+    {
+        return hf_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        std::size_t r = 0;
+
+        for( std::size_t i = 0; i < Shards; ++i )
+        {
+            r += shards_[ i ].size.load( std::memory_order_relaxed );
+        }
+
+        return r;
+    }
+
+    // the handle for [p, p+n), which is kept if it isn't already
+
+    interned_string intern( char const* p, std::size_t n )
+    {
+        std::size_t const h = hf_( detail::interner_key{ p, n } );
+        shard& s = shards_[ h & ( Shards - 1 ) ];
+
+        if( record const* r = lookup( s, h, p, n ) )
+        {
+            return interned_string( r );
+        }
+
+        std::lock_guard<std::mutex> lock( s.mx );
+
+        group* eg = nullptr;
+        unsigned ei = 0;
+
+        table const* t = s.tab.load( std::memory_order_relaxed );
+
+        if( record const* r = probe( *t, h, p, n, eg, ei ) )
+        {
+            return interned_string( r );
+        }
+
+        std::size_t const k = s.size.load( std::memory_order_relaxed );
+
+        if( eg == nullptr || k >= t->limit )
+        {
+            grow( s );
+            probe( *s.tab.load( std::memory_order_relaxed ), h, p, n, eg, ei );
+        }
+
+        record* r = ::new( static_cast<void*>( allocate( s, n ) ) ) record{ h, n };
+
+        char* q = static_cast<char*>( static_cast<void*>( r + 1 ) );
+
+        if( n != 0 ) std::memcpy( q, p, n );
+        q[ n ] = 0;
+
+        publish( eg, ei, r );
+
+        s.size.store( k + 1, std::memory_order_relaxed );
+
+        return interned_string( r );
+    }
+
+    interned_string intern( char const* s )
+    {
+        return intern( s, std::strlen( s ) );
+    }
+
+    // S is a contiguous range of char, such as std::string or std::string_view
+
+    template<class S>
+        typename std::enable_if< detail::is_range_of_char<S, char>::value, interned_string >::type
+        intern( S const& s )
+    {
+        return intern( s.data(), s.size() );
+    }
+
+    // lock-free; the handle for [p, p+n), or an empty handle if it hasn't
+    // been interned
+
+    interned_string find( char const* p, std::size_t n ) const
+    {
+        std::size_t const h = hf_( detail::interner_key{ p, n } );
+        return interned_string( lookup( shards_[ h & ( Shards - 1 ) ], h, p, n ) );
+    }
+
+    interned_string find( char const* s ) const
+    {
+        return find( s, std::strlen( s ) );
+    }
+
+    template<class S>
+        typename std::enable_if< detail::is_range_of_char<S, char>::value, interned_string >::type
+        find( S const& s ) const
+    {
+        return find( s.data(), s.size() );
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class H, class Flavor, std::size_t Shards> constexpr std::size_t string_interner<H, Flavor, Shards>::shard_count;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_STRING_INTERNER_HPP_INCLUDED
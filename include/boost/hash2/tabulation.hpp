@@ -0,0 +1,877 @@
+#ifndef BOOST_HASH2_TABULATION_HPP_INCLUDED
+#define BOOST_HASH2_TABULATION_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Simple tabulation hashing, https://arxiv.org/abs/1011.5200
+
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class = void>
+struct tabulation_constants
+{
+    // eight tables of 256 random words, 16 KB in total, so that they
+    // stay in the L1 cache; the output of splitmix64 from a zero state
+
+    constexpr static std::uint64_t const table[ 8 ][ 256 ] =
+    {
+        {
+            0xe220a8397b1dcdafull, 0x6e789e6aa1b965f4ull, 0x06c45d188009454full, 0xf88bb8a8724c81ecull,
+            0x1b39896a51a8749bull, 0x53cb9f0c747ea2eaull, 0x2c829abe1f4532e1ull, 0xc584133ac916ab3cull,
+            0x3ee5789041c98ac3ull, 0xf3b8488c368cb0a6ull, 0x657eecdd3cb13d09ull, 0xc2d326e0055bdef6ull,
+            0x8621a03fe0bbdb7bull, 0x8e1f7555983aa92full, 0xb54e0f1600cc4d19ull, 0x84bb3f97971d80abull,
+            0x7d29825c75521255ull, 0xc3cf17102b7f7f86ull, 0x3466e9a083914f64ull, 0xd81a8d2b5a4485acull,
+            0xdb01602b100b9ed7ull, 0xa9038a921825f10dull, 0xedf5f1d90dca2f6aull, 0x54496ad67bd2634cull,
+            0xdd7c01d4f5407269ull, 0x935e82f1db4c4f7bull, 0x69b82ebc92233300ull, 0x40d29eb57de1d510ull,
+            0xa2f09dabb45c6316ull, 0xee521d7a0f4d3872ull, 0xf16952ee72f3454full, 0x377d35dea8e40225ull,
+            0x0c7de8064963bab0ull, 0x05582d37111ac529ull, 0xd254741f599dc6f7ull, 0x69630f7593d108c3ull,
+            0x417ef96181daa383ull, 0x3c3c41a3b43343a1ull, 0x6e19905dcbe531dfull, 0x4fa9fa7324851729ull,
+            0x84eb4454a792922aull, 0x134f7096918175ceull, 0x07dc930b302278a8ull, 0x12c015a97019e937ull,
+            0xcc06c31652ebf438ull, 0xecee65630a691e37ull, 0x3e84ecb1763e79adull, 0x690ed476743aae49ull,
+            0x774615d7b1a1f2e1ull, 0x22b353f04f4f52daull, 0xe3ddd86ba71a5eb1ull, 0xdf268adeb6513356ull,
+            0x2098eb73d4367d77ull, 0x03d6845323ce3c71ull, 0xc952c5620043c714ull, 0x9b196bca844f1705ull,
+            0x30260345dd9e0ec1ull, 0xcf448a5882bb9698ull, 0xf4a578dccbc87656ull, 0xbfdeaed9a17b3c8full,
+            0xed79402d1d5c5d7bull, 0x55f070ab1cbbf170ull, 0x3e00a34929a88f1dull, 0xe255b237b8bb18fbull,
+            0x2a7b67af6c6ad50eull, 0x466d5e7f3e46f143ull, 0x42375cb399a4fc72ull, 0x8c8a1f148a8bb259ull,
+            0x32fcab5daed5bdfcull, 0x9e60398c8d8553c0ull, 0xee89cceb8c4064c0ull, 0xdb0215941d86a66full,
+            0x5ccde78203c367a8ull, 0xf1bcbc6a1ec11786ull, 0xef054fceee954551ull, 0xdf82012d0555c6dfull,
+            0x292566ff72403c08ull, 0xc4dd302a1bfa1137ull, 0xd85f219db5c554e1ull, 0x6a27ff807441bcd2ull,
+            0x96a573e9b48216e8ull, 0x46a9fdac40bf0048ull, 0x3dd12464a0ee15b4ull, 0x451e521296a7eea1ull,
+            0x56e4398a98f8a0fdull, 0x7b7dc2160e3335a7ull, 0xc679ee0bebcb1ccaull, 0x928d6f2d7453424eull,
+            0x1b38994205234c6dull, 0x8086d193a6f2b568ull, 0x21c6e26639ac2c65ull, 0xd9dccac414d23c6full,
+            0x91cd642057e00235ull, 0x77fc607dc6589373ull, 0x05b8abe26dd3aee7ull, 0x12f6436ac376cc66ull,
+            0x64952424897b2307ull, 0xee8c2baf6343e5c3ull, 0xdc4c613d9eba2304ull, 0x3505b7796bd1a506ull,
+            0x8176daf800a05f50ull, 0x8bd8ff7a0385cdbcull, 0x1a764a3cd78101daull, 0xbe4d15bf6ca266acull,
+            0xa85e1f38bb2dc749ull, 0x56759a968493cd8cull, 0xf3a9bce7336bd182ull, 0x365b15013741519bull,
+            0x1f7a44a6b109ac94ull, 0x3521d628813cb177ull, 0x6a77afab0f7c9370ull, 0x179642d8cde95015ull,
+            0x5ef102a8fb354461ull, 0xf51c504764ed82f2ull, 0xc58427f041ce6808ull, 0xfad8fc45c9643c37ull,
+            0xcf8682f9a70fa9c0ull, 0x7e1b3b75a4005729ull, 0x992dd867927b52d8ull, 0x7fbd5db142f6791full,
+            0x370595aacab4adaeull, 0xb1392dbdc5ab61d6ull, 0x9fea7dfc79d452d9ull, 0x40b12b120085641cull,
+            0xa192afe3157c85d0ull, 0xc847729f4e08f3a3ull, 0x6f1384a306c41fc2ull, 0x12d05c4045a39c19ull,
+            0x9899202fd20f0841ull, 0xe9c7191857e774b8ull, 0x4eead809af5b0cc3ull, 0xe809acafa23864a4ull,
+            0x4da1edaba1d0f7bdull, 0x846eb9673349f8e4ull, 0x87bae55b86039fe8ull, 0x7f367b8bd953eff2ull,
+            0x3884700f650d04e1ull, 0xbfe4b2ab46980cadull, 0xc5fc89075299106cull, 0x37b2fa361adea7cdull,
+            0x7d75d813f04895b4ull, 0x702f5b393f62c0e0ull, 0x0a3fc775f4ecf37full, 0xe4b23787a352437full,
+            0xf83fa245c34d6363ull, 0xb99bcf040786cf50ull, 0x38b6ea0a0e6c9d8aull, 0x093fdc76776e37e1ull,
+            0x1a75e6f76ba7eee8ull, 0x442cdcfee9660c62ull, 0x22d58d35116b5e0bull, 0x87d4a5180f6a3645ull,
+            0x589fb216bd82131bull, 0x91d031cad319aec0ull, 0xabecf76a553d320bull, 0xb8686cb347612dcfull,
+            0xfcab66337c0a77f5ull, 0xac318214381ec437ull, 0x6eb7f0fca24494aeull, 0xcf42861dcdc895a9ull,
+            0x4abad7a1586d7a91ull, 0xc21b318dc2f49745ull, 0xd49474dc2acbd1f0ull, 0xb1d4873747c1c8e1ull,
+            0x5434dc8c7d015bf6ull, 0xe1c486287511b6a9ull, 0xa8616df62e89a193ull, 0x31ce6319498d8347ull,
+            0xafd0b486123d6faaull, 0xe6495f5d102301ebull, 0x0dc51ced17a43c52ull, 0x8bcbcde81355ef2dull,
+            0x2412af73fdee7cfcull, 0xc8d589e486e29eedull, 0x23390e8664517f89ull, 0x251ade58e8a6849dull,
+            0xf8555dbd2e8f9cb0ull, 0xcb417c3eef54f7c3ull, 0x8028f8e1aac3a919ull, 0x10e31052acf748a0ull,
+            0x2d886c073b1e1b78ull, 0x972974d90df9faeeull, 0xbc1b7b38796893baull, 0x1958ed432070e652ull,
+            0xca5f297197a12dccull, 0xe025a27375704f28ull, 0x418010a570a924fbull, 0x9828e2941bfc419cull,
+            0x4fbacd2f52b85c1full, 0x33dd5b756211cc67ull, 0x23c8dfdd1db57ff0ull, 0x32f81801a1a8e901ull,
+            0x26884eac5ada36daull, 0xcaa82f9bb42e37d4ull, 0x19fb1a7491d6a7d1ull, 0x5aa0243aa357f38eull,
+            0xb31d917809e447f0ull, 0x3f9c197225215be0ull, 0xdc3c315a1e33c095ull, 0x3dd399ad533e80acull,
+            0x566f32cce8301d95ull, 0xc880188083d9ba21ull, 0xb9cc357f3b0e7d2eull, 0x0237d2123a8a8d6cull,
+            0xbf636e9aa7cbf6bdull, 0xd7bd4284c4e2a6a7ull, 0xda2ebb47d50577a9ull, 0x90ba1c11b539087dull,
+            0x44993d31552b4f57ull, 0x32c2d6f80a8a8898ull, 0x450583ed7fb54b19ull, 0xec2b0b09e50ef3efull,
+            0xd918a0b6e2efd65cull, 0xe37a868d9785f572ull, 0x7d1a6118f2b0f37aull, 0x9e2e3cc13b343439ull,
+            0xefd82c11212e37e8ull, 0xaf89c05cd4fc75edull, 0x55bc16bb9697108eull, 0x6c4701fa5db69beeull,
+            0x9237338441daf445ull, 0x248cf0831e81a5fcull, 0xacc13557e77de273ull, 0x520970c25e06513aull,
+            0x657329cb02987cabull, 0xa9b0b3366a4e55a8ull, 0xc4d06ca2f39acdd4ull, 0x5dce37d68170cde1ull,
+            0x5f1e44e77e1854c9ull, 0x6883d452d55df899ull, 0x05c5bd62f1067032ull, 0xe680b683ce60fab0ull,
+            0x5dc9da3f286d18b1ull, 0x94b4bf3ab85ed6d8ull, 0xce65f449e3acc5a3ull, 0x34b0209642cea639ull,
+            0xc14c3c771d904827ull, 0x6addcee2bd9cdee5ull, 0xe24eed137ffbb613ull, 0x75dd58ef79963d1bull,
+            0xfdb83ecf6cc24920ull, 0x7a1d0057c57169fbull, 0x339200f4feb62d07ull, 0xd33f4d4ac88469f4ull,
+            0x8226f234e68dfee4ull, 0x320def4f2a105536ull, 0x7786f3b13aefc159ull, 0xb28225ac9df63ee2ull,
+            0x781b9d0376cc6044ull, 0x05bd0115226c6ab6ull, 0xd302230207bdfdabull, 0xdb898abd8e0d2933ull,
+            0x9e79a397ba00b9ccull, 0x89df84a5f0003ee8ull, 0x011f04f2a75fb9beull, 0x5a5832bb47bcf19eull,
+        },
+        {
+            0xcbdc6d34b7c7534dull, 0x28a0d62b36f7e211ull, 0x56c4553d5d0b9393ull, 0x6926f3234c55dbf2ull,
+            0x13fd156d281831abull, 0x788fde493e59653dull, 0x984456f3129d0de5ull, 0x75fef0b6764f4cbaull,
+            0x3d1500b0edf98a29ull, 0xa149d1519fd97dc4ull, 0x1288259c4a188588ull, 0x304014a30b42d718ull,
+            0x7e9d7e05138f2863ull, 0x8379ec73f35176f4ull, 0x72076caedab9cd77ull, 0x933d40d047d5c211ull,
+            0x521d6aec56c0137bull, 0x4972307f6da2e896ull, 0x6381fc65071e876dull, 0xe5eba2b5b975969aull,
+            0xf9819878b6052e93ull, 0x42cab1f6274738afull, 0xe8e4342ae5cfb767ull, 0x6eb46bd2bd74a766ull,
+            0x4dca29b4fd8880c0ull, 0xf5de3740c3cb338dull, 0x7c0dddf3352b6dbdull, 0xa6208f121e7b9d80ull,
+            0x22bb0c2a84214635ull, 0x0f721606cabc211eull, 0xa434826569f1a127ull, 0x07c801c0f8fe99e7ull,
+            0x77335155fdf6900bull, 0x7de131ff132472a9ull, 0x9614024d783ce84full, 0x0807e7c5ec9c7b14ull,
+            0x0c5857e188e1c693ull, 0x3c6250408655f23dull, 0x1d94501ac76ca8cfull, 0xa75002a693f4354aull,
+            0x4bf2d03583341074ull, 0xcec9908f230b6711ull, 0xfc001b32f9982685ull, 0xa837b30638cacfb2ull,
+            0xdaa5f80fe9d0f70dull, 0x45ab1a6a22d6bc17ull, 0x476cf802330034e5ull, 0x08b65c623f08199dull,
+            0x619957d95328ea3cull, 0xad6fed10cbda8dcdull, 0xedb0d0d28761fcc0ull, 0x23a06397a6335d81ull,
+            0x2649be21534f387full, 0x6bad9f5f9193499bull, 0x71cce7c3593342d9ull, 0xd6f316c5c285c4deull,
+            0xb73a83eeec718640ull, 0x2804d8c04de3388bull, 0xd9da1024dc5ea567ull, 0xf47ec04292326b23ull,
+            0xa6b94cf241e7e821ull, 0x0c1dee5409bc203full, 0x33ba05bc3ee276faull, 0x032cd31b757b30bbull,
+            0x3ccd39a590b78295ull, 0x4a264b709d0105efull, 0x1fa19cfc9778db71ull, 0x8436631985e92e8bull,
+            0x5d34de04733d0a15ull, 0x2b181597907baf2eull, 0xcece4d103307428bull, 0x63a90e6c8f8391c2ull,
+            0x4c47a8c4017695ecull, 0x5fe135a23112e31bull, 0xcbd065fd22102737ull, 0x63fa700bfc399149ull,
+            0xe23b1de2babad561ull, 0x50c2dbee5d134327ull, 0x93c051781267eff5ull, 0x9aa83a6d8eb8abb3ull,
+            0x2d2fe50e4473ade9ull, 0x5fa1690e247adf55ull, 0x62f4f57b730a8d16ull, 0x616308740e528066ull,
+            0x861731f13c272113ull, 0x3c6caec2abb41615ull, 0x58dc98d3a4b965dfull, 0xac67e58c447a30f3ull,
+            0x717d1b34d0f226b5ull, 0x5068123375a5b3c6ull, 0x65955f41cfd0e893ull, 0x7a05e7206258c3f8ull,
+            0x530b98a49018d298ull, 0x4164a427d5be9ebbull, 0x8ed388d35f43ad87ull, 0xeda8fa6a8a59bc0eull,
+            0xa6b3a6712afcd38aull, 0x857b0535c58d6b14ull, 0x35ccc2bf24fbceb1ull, 0x91757f9b2437ce51ull,
+            0x4f9a23e2b151be74ull, 0x78779a725ea2d9feull, 0xcc4ec68084cc7e95ull, 0xb6966a6140bf3535ull,
+            0x89de59fa33170a0aull, 0x45891bd34267a6efull, 0x68eb3b32aa806aacull, 0xae2e7ecc4c8e0da9ull,
+            0x9c6973b1cd7c1a97ull, 0xb2a774c1f3488fb5ull, 0x00bb92e27d083dcaull, 0x5d9f2c93ff73a7a1ull,
+            0xf77effea672d02c9ull, 0x2c8f635e04e16818ull, 0x63ccdda60ab7b0a9ull, 0x1cce0bba630053b2ull,
+            0xeabd508b9df52a49ull, 0x85232b4a312d42a2ull, 0x907271a5478cde49ull, 0x5a63530cfad0b243ull,
+            0xab1a732b3f586b99ull, 0xadeae4869d4467b3ull, 0x2a4176cc70fa8c52ull, 0x871ed802e15cf126ull,
+            0x41a665fe26a7a248ull, 0xe6855668819e63a0ull, 0x7946342a93638d09ull, 0xcee7f6ce76c24791ull,
+            0x90746e60ef10929cull, 0x303f222ec15a3656ull, 0x91ca8850bdb392a5ull, 0x282be21753fd8812ull,
+            0x8da4658f613ba6a7ull, 0x39f0f2e09ba26805ull, 0xe10e043370f4ce5full, 0xe3ef8013856fc40cull,
+            0x10155b096e22e7f7ull, 0xb06fa4f0d3afe2d3ull, 0x98dabb1c64aa2138ull, 0x662426bd0482cb44ull,
+            0xd49604a4e3af5c6aull, 0x1d73b2634c39403eull, 0x894fb150a04be81cull, 0x2a2e37a33a8f339dull,
+            0x412b63228c0d97d9ull, 0xe4534eb1558ea880ull, 0x22d471edcc01f620ull, 0x1810596a0c2284f9ull,
+            0x55ea875e6ee39c26ull, 0xfda91f81674f3233ull, 0x99fb91542b2ef76cull, 0x4850117266c0d41full,
+            0x4c84fdeeb5b71336ull, 0x5b65923ac30ec1f4ull, 0x001fce785e79eaccull, 0xe7035aadba840af9ull,
+            0xef062cfb5d3a3fa4ull, 0x91cf003dc64d2047ull, 0x6a6bbae4c69f0558ull, 0xbc83ebe6cd2818d8ull,
+            0xc3a32910d5aeaa2dull, 0x2f124b01d8c37ff7ull, 0x89908fb20936c74full, 0x30307ace765d040bull,
+            0x2efc3e93492e7d12ull, 0xb5af6d95d72949eaull, 0x9217fa5ec037abe8ull, 0xa27ca1090743f1bdull,
+            0x9e58d128e268bc60ull, 0x331f5ff8d2f1cccaull, 0x1318b39f628757d7ull, 0xf1eedce334401c5eull,
+            0x10448c3a57ddd877ull, 0xc6220951fb35d453ull, 0xa492fa1749559626ull, 0xc16c742d1cc888f8ull,
+            0x4ee6be96e6483c3bull, 0xd8c4cbbb86af34bdull, 0xc23fe6e086e66126ull, 0x593573115d89d57dull,
+            0xeae4b6ca31a0b512ull, 0x1303e0c57b6e8645ull, 0xa7ce5911a9cb5e60ull, 0xac52a06a93326442ull,
+            0x1cfa401114d214feull, 0x657c7edd5a6a2d11ull, 0x74f7dfc8ad75e5beull, 0xb93bd966433a5eb5ull,
+            0x395abf3428c5ef4dull, 0x3a7c844c5ed8c333ull, 0xc6a32156c0e52c52ull, 0x811e01f4016f91f7ull,
+            0x5fd205755dc324cfull, 0x8b8e6cb9d7a25c5eull, 0x6a393c91b09a4f24ull, 0x2419d24941d2879eull,
+            0xcb11d3d322378c3full, 0x89a0d947e7359ba9ull, 0x9ac235af1b306ee2ull, 0xdb17fbea36289ad2ull,
+            0x5ede9c17dedafd6bull, 0xef0cd7b4e4ec0de6ull, 0xa4b32cc50529ec8aull, 0x3729e60466e76c72ull,
+            0xbc1b968695dfd347ull, 0x1208879d7d4bde63ull, 0x8eccc08b8c8ddefaull, 0x61d1b6bfda572c2dull,
+            0x2e5bfe8ae0bfc011ull, 0xbb93b47e50da3162ull, 0x4dc253ba47fe4964ull, 0x214619698f00fb1aull,
+            0x7065de8fd6721979ull, 0x319c324c72c708c9ull, 0x5ef5bbc18466cf1dull, 0xf1cae3b64977eec5ull,
+            0x6ff929d26a842420ull, 0xe8bab64cef650d0eull, 0xa0fff83df2901695ull, 0xd0ae24de4223d192ull,
+            0xbc60367453eec23full, 0x6d8046b801afbc9dull, 0x26018251926c0991ull, 0x1a68be3a035b5707ull,
+            0x242ae4893b70b22eull, 0xb99c78cbc599a070ull, 0xed8916b381e9a6e2ull, 0x37695a55e05cd381ull,
+            0x5c6c9c4ed6632ee1ull, 0xcd463f48a9a8274eull, 0x24e864649fafa6c7ull, 0xba69a8bac9998133ull,
+            0x292bb3d3fb84ffd6ull, 0x32fbf0c6bd46a684ull, 0xffa0d42a285685ceull, 0xf8ec28585e907988ull,
+            0x955d78582b84939bull, 0x7a8e5ece174ec569ull, 0x0bde70207d0f01f9ull, 0xf9d49516f6bcd773ull,
+            0x5ca61d38ace08deaull, 0x73acebd3d49d7857ull, 0xf4721387d67a23c1ull, 0x400830fb417eed4full,
+            0x43613db3f0b2e10dull, 0x0c2683675b3e7196ull, 0x0f0a3c18070a38e0ull, 0x00fba4231f3fd447ull,
+            0x4a83615e584ea5bbull, 0xd1c390e9829e2e7dull, 0x62c7bae420fe77b5ull, 0xca9b275e0cfacc12ull,
+            0x6e0bb5df568d5670ull, 0x47b0f2e81ea86cf0ull, 0x6b4b89c9cc0875b7ull, 0x4980af326a4b65d8ull,
+        },
+        {
+            0x83fcc71fa8833aa3ull, 0x327eee6ec9598964ull, 0x04dfae11b8dcf861ull, 0x4c3433717af5c89aull,
+            0x22b7ba9e68349351ull, 0x47666d1b6fcaa9e7ull, 0x556e1ab391b34d79ull, 0xa6a3245dd1c3fe53ull,
+            0xa8241f6fae45b8d5ull, 0xc1d7ed7b9c6bec16ull, 0x9fc26e2d14919f22ull, 0x4fc2ccc9159d054full,
+            0x4a6881df0c028b9bull, 0x45a577f1bab58960ull, 0xa1bdb57c6ca2dbc1ull, 0xebfde16cec9e9974ull,
+            0x4e7911ddbed4fc71ull, 0x71e606409319727bull, 0xdc0d879ed0bbe640ull, 0x4293a2a13fb2fb89ull,
+            0xaf24d14180037e79ull, 0x53be5793563e006cull, 0x157786cbc486d2a0ull, 0xb0752c30eaa58544ull,
+            0xbb61ee342e9a8210ull, 0x635d396b1bd1da07ull, 0x4d7c14a84bc6fdb5ull, 0x613a9c99235d15beull,
+            0xfb7c05e13c1703fcull, 0x3f7d3faa5694d6aeull, 0x21dc527f0ab4ab9bull, 0x0251b77b538e03fcull,
+            0x802e57a14bf8215dull, 0x51ec9407992ac5b8ull, 0x48a69543e5dc1734ull, 0x22abaa84fd19e270ull,
+            0x8f34cbb275b951ecull, 0xdf92f91b1cb7a033ull, 0x157f0e4ccdb056a8ull, 0xd889bab710a7570eull,
+            0xe180887a35c9acd9ull, 0x16c94ed584523d02ull, 0x3cb6b899028ba353ull, 0xade4153860320f39ull,
+            0x62a15d96596742b3ull, 0xc24e3101c5ab7a66ull, 0xd2f48e99a11767a6ull, 0x1542a77e8df4cc9full,
+            0x70450553f57c306full, 0x6596e4bb0ab6fe55ull, 0xb31ad51edb07e16dull, 0x14f8ec0b2dd720c3ull,
+            0x66623fbeb6a18744ull, 0xbac8a59c8fc9f445ull, 0x0134cf3de391eae9ull, 0x3934dcea8dd8e425ull,
+            0x50621c6ebfc34e9bull, 0xa0d5ee425797481aull, 0xe65f9512ff9a97f3ull, 0x12a9fea1d634c54eull,
+            0x043aab402beaaba8ull, 0x3fbaaa86d4844270ull, 0xe179606eaa9381e4ull, 0x54238caebf32828cull,
+            0x6e3b64d7f5c88d2bull, 0x685f1f2fc2e6b27aull, 0xfd8563efde1f4398ull, 0x4423c5046aa5f8faull,
+            0x6bcf56187d539753ull, 0xd03a3b54209703fbull, 0x251d485d8178acd6ull, 0x3f66ca397592e07full,
+            0x552bdfce433cc6cbull, 0x44addd817db8b4dfull, 0xb000cbf3ce21b869ull, 0xd2e9983a72149fb3ull,
+            0xaf947e60ad892ed4ull, 0x577451b6ef6afcbfull, 0x78da7cb7c466fbfdull, 0xd5e3634444e34975ull,
+            0x344e8d54603a3643ull, 0x0b8d292730b546d0ull, 0x8acfe26983852bafull, 0xf4fe6ba91c741977ull,
+            0x86d2315d1e0dc68aull, 0x8d9d062df69ee643ull, 0x9ba452ec9b87acabull, 0x60d53c599f2efcf5ull,
+            0x05cf9a10ae33fd6eull, 0xed86e1913867a31full, 0xcbf6a4ee31486382ull, 0x5c088030503f61eaull,
+            0x371da374bf0bbd06ull, 0x67325e50cebaafc4ull, 0x40613d7fabc27df7ull, 0x873450e33f8ec632ull,
+            0xc87c2173dd433a8dull, 0xa337defd2fa45812ull, 0xc6d6572f9c4db5f7ull, 0x43df2a2bb9dc1f8eull,
+            0xa949f99ae4579ae7ull, 0x2ce95f8710af973eull, 0x9b6f7d1586d5c2a8ull, 0x1591bcac785b49b3ull,
+            0xefe019ea91a1cdb3ull, 0x0f308d530055c460ull, 0x549cbb2ebe9b6412ull, 0xe45cd3103ac8afb2ull,
+            0x8956d2c6a1c2a173ull, 0x3c6a03f08df43ecaull, 0x515e34df346c7f59ull, 0xdb1b56d7efbf053cull,
+            0xad13006e7260fc0full, 0x9aa291b6d59d39dfull, 0x3a91dfda8521dd07ull, 0x30e27d3a3f4ad189ull,
+            0x1b7cd23c60e3768eull, 0x1e65dbab69f02d4full, 0x647b114c433bbaa5ull, 0x7dcdca42f34b7db1ull,
+            0xc9bc4616c0261cf4ull, 0xbb980258f543d9bdull, 0xd0867d4a79935127ull, 0x7faa29c4257de927ull,
+            0x7c47efc4dc9daeb3ull, 0xfc4455323ed6a688ull, 0xa6c803ab2fc31dc5ull, 0xfe3316e8a126c648ull,
+            0x0e4d6fee8331db63ull, 0x748cfa660c95016aull, 0xb2747dbf2bc34adfull, 0xfa6ed441e6468e9eull,
+            0xae42190933ffc09aull, 0xff9c92fd3654a582ull, 0xd33fcd8cd9e61ac5ull, 0x371ad28c40094647ull,
+            0x5d9dc02bb2d14812ull, 0xaa7bf2b3524699c7ull, 0x4cb261d764240af1ull, 0xeb0074eb49c8f038ull,
+            0x2235c793c6b2ec94ull, 0x326ce3de14b10487ull, 0x7d26c935d601635cull, 0xfb023c83c005f89bull,
+            0x7a7abfe47cf11a74ull, 0x326d14295729a098ull, 0x4051c8e5a0e36e25ull, 0xad5fb3df4788ab9bull,
+            0xa06e91e446927881ull, 0x24765f3e77532660ull, 0x4ba5bdc5384f18c4ull, 0xc7f4e017f8732292ull,
+            0x6e992a983b7edde2ull, 0x8e833aefb26a1864ull, 0x1ba3adee92f08807ull, 0xd033c438ac3973adull,
+            0x109596208f6b9577ull, 0xc15e6593e972512aull, 0xcac8e49bb608b4daull, 0x8d2dda6d5c05dbe7ull,
+            0x61059bbb11e53600ull, 0x890dd6765d924d3bull, 0x326a9a09a42a8f64ull, 0xba22ce1e7d55ac2eull,
+            0x6e3070eca2371016ull, 0x4e6545c9f7372bbfull, 0x44285c955996db95ull, 0xc2c610e81ca500cdull,
+            0x6a2cf7bbc4f311bdull, 0xfc4b27eaf1ce13b0ull, 0xb82b569d4298bdeaull, 0x73cbe4a05d9c604aull,
+            0x0d0608d17a2f7994ull, 0xcf7e1d758bc7f5b5ull, 0x449c532e01903840ull, 0x109385b3578bc434ull,
+            0x5b0d87c9fca26014ull, 0x491c73c8f628c62aull, 0x3079ee10edbe7ba1ull, 0x0cff6b3d3e6c15b8ull,
+            0x1d6b458f2c076c70ull, 0xc61d459c911f3537ull, 0xda68adbdc675be53ull, 0x8de990e037753ab0ull,
+            0xa6092d6f9f9e0b84ull, 0x5b3b3a90aa6ac400ull, 0x66598cc7b6406583ull, 0x1ca70aee97a1b837ull,
+            0xaf82a4ce58ef93b7ull, 0xc7ce4b9b13282484ull, 0x2b889662669711b0ull, 0x994f1f541e8ec4b1ull,
+            0xa04691fbe4451815ull, 0xe7450f8101bd21d5ull, 0xaa94a8216c7141a7ull, 0x06316d1c8dd41b5cull,
+            0xfe600c367a8aa52bull, 0x0577481e942a07a3ull, 0x1a3704f86eefde92ull, 0x1ddd864f1b50782bull,
+            0x4e6e17f5f3b362dbull, 0x36c4e9881a205ff0ull, 0x87615288d5788a80ull, 0xf0ef34e4bd45b3fcull,
+            0x1bc57badac418d9eull, 0x9fc338c00035d21bull, 0x17dda7edf8cea21bull, 0x9bdae11a59ed17e3ull,
+            0x9aeb37281961af39ull, 0x426ac051d05d0541ull, 0x1f6bf9fcbd650853ull, 0xb6b485c32054d2dbull,
+            0x33cd737c1bd48bbcull, 0xbf7d815f20c6aa90ull, 0xbddcaa250dae14baull, 0xeadf33672f2eef00ull,
+            0x1dfcf9099f404e93ull, 0x9322250b5159a644ull, 0xf317f503a92d62bfull, 0xc81c284dd319fe2full,
+            0x6c99b2aac29b7da3ull, 0x09654e59fe299319ull, 0x7fac22d4a36c1cdbull, 0x031c79fc0e5d0ba8ull,
+            0x6786f2a8b25df1e6ull, 0xc5d9b45dc06a2973ull, 0x494c1be2f16aa7e5ull, 0xcd6572b288330281ull,
+            0x1fec2ad7e539e591ull, 0x70ff92eac7d644ebull, 0xa23a58e2a5158332ull, 0x8097046c8febebb5ull,
+            0xf48ef92917693662ull, 0xc768ecaf06040013ull, 0x64da73f83a1654d7ull, 0x4653bf0aa21d2e83ull,
+            0x89ceaa06806a3ab2ull, 0x11266d2e4dc768e4ull, 0x72e16539c447b502ull, 0xfa65940fded7d4c1ull,
+            0x4d12ed9b2035457cull, 0xe945d4cb35ed57edull, 0x75d44c13bffb0f19ull, 0xf690c8970c88d47aull,
+            0xe1ae0e7fc137e303ull, 0x5ce6c3417289b541ull, 0xd71c344eab53f9bfull, 0xac337044a96df7afull,
+            0xafe25963a3014e07ull, 0x5b92f7a78b315407ull, 0x120a9962ff1fa138ull, 0xbec62925bc2c2731ull,
+            0x840784564071255bull, 0xb96ac0ee3219851full, 0x2b686d2aaf437b55ull, 0x862caf81e41a1a19ull,
+        },
+        {
+            0x1c787a8631a3cc4cull, 0xada2b6b30a0fbd78ull, 0xe9bff1ac37cd3760ull, 0x5b1c44f240a786dfull,
+            0xdd2e5d6f2b4b30d5ull, 0x74cdd16b7f0fb3c4ull, 0x39edba15ba6d5deaull, 0x893a48adc5c59fc3ull,
+            0x5d88d67ac62f910aull, 0x6637c1ce6357a2c8ull, 0xfc7b432fba88a23cull, 0xcbd18ebcd1f9b00dull,
+            0xcc5d77cdfdf2f139ull, 0x0f87eec1b08afc93ull, 0xdad6d0b2edb856a9ull, 0xf1967332fb44fe31ull,
+            0x7e2ea1f8378a6b05ull, 0xf7030484c2112723ull, 0xc9270af5de5dd831ull, 0x17b0c92492db0be6ull,
+            0x65ef9855875761f5ull, 0xf70f6fc08fbc6cd2ull, 0x31a80f56d1763c8bull, 0x719544336229e7d2ull,
+            0x297d5f1702685620ull, 0xfecaaf16b0750091ull, 0x4e48827cf8c61f54ull, 0x041cbea18af9baecull,
+            0xbfc582141f1f8448ull, 0x1f2db364484c8c42ull, 0xb156cd02f199bf01ull, 0x805880df9cd1f3efull,
+            0xf1de0875b332446full, 0x81487f13496e7b8aull, 0xa1c603e2d2b1c755ull, 0xb5be0c9a1bb00e12ull,
+            0x982fad98f4955b0bull, 0x6f71eec14e3c2891ull, 0xd61f8c52a46143c3ull, 0x9be3190d6b9b942eull,
+            0x6e8e1898868eb0a2ull, 0x553f7f84144a4c23ull, 0x228fd26aaba0c661ull, 0x98ec5ef763a53fcfull,
+            0xa6ae40dddfd3d2f3ull, 0x1a9f21e6e88f29c1ull, 0x7abf2e6dbc13d977ull, 0xbf4e2f41816ea15eull,
+            0x3ff81d2834cb6d60ull, 0xa8f148af30f4b908ull, 0xd6e2f0e513d0d43eull, 0xb1bdab8e9dc78bf4ull,
+            0x219142e8b65466f4ull, 0x003f9cf0bcf3d599ull, 0x4615e70816e98019ull, 0x533b11bf7e56aad2ull,
+            0x0c5d654dedaa707aull, 0x72dca3b0fc2499edull, 0x8b733297980fe1b3ull, 0x999051b19bfb8a9dull,
+            0xdd0253a971577375ull, 0x69a7bf83e48e8c0dull, 0xd7a6ad2b2561d503ull, 0x7907d7cf9a5031b0ull,
+            0x84ed151ff847e34aull, 0x15be59597232432cull, 0xfbe3ff25e49e4f60ull, 0x5e249603b186ffeeull,
+            0x8507c98608ea78c6ull, 0x9195b6d500d6ae15ull, 0xfec636268e3c8614ull, 0x08ada769154f454bull,
+            0xc2500e05c8d70685ull, 0x58eb04418d0b1ad1ull, 0xc97791448b561151ull, 0x6c85ac83841a3e00ull,
+            0x9d47ceec316ed9a1ull, 0x52de011a7eddd2acull, 0xbc4b86a9c00b5e45ull, 0xded704b13adb6e3bull,
+            0x4329a1e75142a10eull, 0xe7e50951d69a7671ull, 0x557476edbb8a95eaull, 0x663ebff1a5e39994ull,
+            0xaf9af9b3c29b2694ull, 0x453357c6b11305b1ull, 0x585e6dc6d06b262cull, 0x58ed3a5d5d00380dull,
+            0x4a32b3d69c5f01d5ull, 0x20891874afbbb0efull, 0xb1c90ce9e15b4f3cull, 0x18aa1c1eeb83b16cull,
+            0xf11899606a6d6736ull, 0xaf48318d5e70a70cull, 0xa9286580641fbbfdull, 0x36c56baa2207c4f9ull,
+            0xe0e958c0f377a821ull, 0x0f75ce694dc1214bull, 0xcf159796fca24ac2ull, 0x4659e12f0dcd9b22ull,
+            0x181f9ca7e6edde4dull, 0xe929338b0dabd75dull, 0x9b44af40d00612dfull, 0x473b2fde7c81271aull,
+            0x531a053abe4ff456ull, 0xd5c96d9663416a25ull, 0xe717d499fb7e07c9ull, 0xf345c856825636b0ull,
+            0xf19b5cf97a5256d2ull, 0x7e4abe7c23759694ull, 0xe011541207817d06ull, 0x1e85b7721b0da94eull,
+            0x46fc5fae7f0111b6ull, 0xbee130c6a8eadbacull, 0x5e2326a69245104aull, 0xcaf8fdbab4d45a22ull,
+            0x3e71da41991cdaa4ull, 0xebc84d9fe6e487fbull, 0x4fc6043c1494e02aull, 0xd899f02fd3a838aaull,
+            0xcb8fff34fe2991a0ull, 0x0c934108adc7a05bull, 0x0cc782382665902bull, 0x4039ce309b7c44b6ull,
+            0x0a2fef70e2e86413ull, 0xbbf44f08d99f71f0ull, 0xbe9d439b72a16fd9ull, 0xe083e973e85a0d41ull,
+            0xb59016b59e4fae77ull, 0xba969207a2d24a3eull, 0x5c7e9d93361405e0ull, 0x120f608cb0b0dd50ull,
+            0x51996d8170206e76ull, 0xb8c208af5531ad2bull, 0x1ef6c3fefe2a4be3ull, 0x5b4a1d2d79cf30d4ull,
+            0x451a1d408b25a91cull, 0x20d510415336f591ull, 0xf865610091f9a8deull, 0xe7e8b60122b7966dull,
+            0x527388e726faf47aull, 0xc024bfdbf760976aull, 0xa9e2b0fe7eac52e3ull, 0x3d41bdc4fc80e848ull,
+            0xe9bd659eb1579de7ull, 0x7a714ce5673c8122ull, 0x972f832e08355295ull, 0xcdf44a12045d8dd0ull,
+            0xd3f0f8faa55212a9ull, 0xed3d984cb6644d81ull, 0x8be8d60b4485d41cull, 0xb3cac41c4b918341ull,
+            0x0a0a2cdfa2008305ull, 0x94e6dbedbe6b68a3ull, 0x123e36c07ed816ffull, 0x885f72f34bbe4785ull,
+            0x43329c4d29e3cffbull, 0xf6979f488a710c47ull, 0x7e7cde8d8f46787bull, 0x84a95bec490896b7ull,
+            0xc52618f6694b8387ull, 0x76a6c217d1089392ull, 0x026ee55dd2dd39c5ull, 0x59f5c6677a574d98ull,
+            0x2f2a9d5d0dd5a55cull, 0x796214cffd60a880ull, 0x7ec3e4e0253c70e0ull, 0x934e9236377b91b0ull,
+            0x619286a21ef373e1ull, 0x45f9eab44163f574ull, 0x9c3c605e8d5b2b11ull, 0x9a2f227b30b811a5ull,
+            0x702a0d0a8ce6c733ull, 0xfa2d8827866d9fc6ull, 0xb4108938233d1830ull, 0x8a3dbdf68cd7478full,
+            0xba728edfb4b585ffull, 0x83283d3057c3dbdcull, 0x7660e3423e1ad80eull, 0xade45225fdb20295ull,
+            0x962c6522f4f079dfull, 0x868d023f5fbf1093ull, 0xabf6a70a2a6b42a8ull, 0x56fe1d479716ba2full,
+            0x9813381202146af8ull, 0xe55ccd6690bffa90ull, 0x1704394c3eb89798ull, 0x9a6e866a9dc9abf0ull,
+            0x93b164239e813f5dull, 0x2314e36753d7c4ceull, 0x802e5174e8540765ull, 0xec9a47306f30514full,
+            0xad2dd576a5ce1156ull, 0x30b231ea97bcdd39ull, 0x352ba4c080b9c7e7ull, 0xe82b6f0a8f1223bfull,
+            0x2307f663fc695848ull, 0x250ca4352f2f3f59ull, 0x2b06d21d3092a0f3ull, 0xc762ef5ee4ec6f0eull,
+            0x14c9b2f083e10ca8ull, 0x225185718b516ddaull, 0x9e48481bbdcf6f7eull, 0xcf05039e1fcfde99ull,
+            0xf88653cb07cb44aaull, 0xf4568323204bfc56ull, 0x44b25f42bf60a917ull, 0x2d5b6baff2b4274bull,
+            0xebc80a0626163999ull, 0x6ccb50acd0bc7529ull, 0xd7e256de2d8ccb63ull, 0xdff1daeab724b4b6ull,
+            0x0544c135018be211ull, 0xc2871c3da105747cull, 0xbc6263c3ea5c60a8ull, 0x60f31c81c295713full,
+            0xf27ed05a79ae9fafull, 0x9c6f22e716537e6dull, 0x01aa054d293d992dull, 0x87142d777055abbaull,
+            0x94af7aea9ee8c3f3ull, 0xad84533a4b9dbd08ull, 0xe2fb4ef179f18ce6ull, 0x1261e404c6a53438ull,
+            0x6ced8657f15f4dc2ull, 0x4e1c842ba2b38949ull, 0x118ff129dc6fe759ull, 0x371732bcd7aafe34ull,
+            0x96f74c6d5a2743d8ull, 0x82c1e9ad78bfdac2ull, 0x13ca922f0af7dcbcull, 0x14e0abb2bfcf7c3eull,
+            0x2cfa2f23425329e1ull, 0xdcad513c211f942dull, 0x7b9b825c35c18b75ull, 0xad1d5088c022a188ull,
+            0xf804f37aa5267870ull, 0x5ef0afac47dcdf79ull, 0x315974ec6c94b8bdull, 0x96c792007d4d6defull,
+            0x716dc70126a22888ull, 0x8ff949d9b2334c46ull, 0x39d99bef581fe0d3ull, 0x70b322adc0939f80ull,
+            0xaf273e82d37541bcull, 0xf43d8225366812aaull, 0x7dc7392b1197006full, 0x619c7313cb6308fcull,
+            0xf6dd0bff853210c5ull, 0x49cb12f89f2428eeull, 0x1a388cc8169dda78ull, 0x293fa87171ec42a0ull,
+            0xb055491d413a1636ull, 0xb350348997b6ecdbull, 0xf69029b901efa3adull, 0x2cdf2105ab2a3571ull,
+        },
+        {
+            0x6d6409c74776d986ull, 0x02ec155877fe5197ull, 0x9acb73c63488b544ull, 0xede8f6a37fcc2cb7ull,
+            0xa1edcbb1fec6412dull, 0x386d687e05228a93ull, 0x3f85c7fe3f785264ull, 0x6f639edcc040b8e5ull,
+            0xdfce21f83b7755ffull, 0xa601bd724de89bbcull, 0x8aac30d865ab3cb7ull, 0xbd7ae693afc834aeull,
+            0x20192f04754c32b2ull, 0xc100953ea60b69d7ull, 0x973999a9d24aa499ull, 0xe7240b58f7437b66ull,
+            0xe668587f1d4a037full, 0x06ae1c54dd761a39ull, 0xca07d06bee139491ull, 0x6393c105dde1c64eull,
+            0xd5255d8c378b98e2ull, 0xd4552612c1f1d4f9ull, 0x30690c25ed4f7cefull, 0xdc34e363aca033e7ull,
+            0xfa7a7e12a7b013cfull, 0xfaf3411ec4419276ull, 0xc809163506c7e8b3ull, 0x8b4aefe3756b12c0ull,
+            0xa21824f63c2589b5ull, 0x55b6219c5b913bcfull, 0x076b58f812dc9c02ull, 0x6ccc0c955063d06cull,
+            0x398e82b74e12edbeull, 0xa23b8182a1b85711ull, 0x3d23786aa371c9d3ull, 0x109154a4c05cd63full,
+            0xfa853e863bfe9035ull, 0xb30d96588269c854ull, 0x66c73752db5307e9ull, 0x296a0e365de45193ull,
+            0x78ca41583772a5b0ull, 0xc46bdfe034420633ull, 0xd3211ad946f6ed88ull, 0x3c4cf8e28d2f8144ull,
+            0xa10f9e704282773bull, 0xee9bd7282c23bd8aull, 0x81782d05daedfbf3ull, 0x60ea5863d54b0a88ull,
+            0x163f2a81dc6fe620ull, 0x3596a1576c0e92daull, 0x0b3c5e690bce60f5ull, 0xc054f621443fd761ull,
+            0xa1ed3b3bf1dcb889ull, 0xc9a635ad26e2d0eaull, 0x73a38af6a00c0b84ull, 0x4a0f35afad1087c4ull,
+            0x3b6d91c19ff13e05ull, 0x90d5ce60b4758cb9ull, 0x0da5582499eadb64ull, 0xac6b53949cf432bdull,
+            0x203a49718d3b7b63ull, 0x0b35626d6ade27b3ull, 0xafff333119e2c51aull, 0xd8ed26c708f4957eull,
+            0x11849b2f994b24f4ull, 0xfedb3214154d889aull, 0x297f4020cfbbd623ull, 0x0714d9e98f934930ull,
+            0x58e7241018095febull, 0x69872186b327d60full, 0xafc825616a2c77f9ull, 0x1fa822b5ad17358aull,
+            0x5367bdeb91b31f7bull, 0xb0632057a55fce36ull, 0x3ab2a323be2f67efull, 0xec5efdb0545ef5ebull,
+            0xba7e84c37852f71aull, 0xd6a372f2c29a76f7ull, 0x3490de83107132ccull, 0x14e6e1d6b9302ed5ull,
+            0xe060ac0d21583070ull, 0xe1b6f2e2c40e9605ull, 0x043b6cb4d3cae5e7ull, 0xa4737b64c8fb95c2ull,
+            0x61b7867e6e20a24bull, 0xff5e2ad319c56194ull, 0x025516561842b5a3ull, 0xd0b26ed700ec27d5ull,
+            0xa9bd6ef9e36493f5ull, 0x7b27c09b5bbe8c3dull, 0xe36f563c43a8493full, 0xba1c650215c3e455ull,
+            0xc7d459fa82f40580ull, 0xe2f8225b2cbb1c0eull, 0x3f14b449f96a7f20ull, 0x61357519fe182f2aull,
+            0x8b83d986e219fb6full, 0x94b38b7abb242e6eull, 0x12afd6400243e1f5ull, 0xbe4a7fe4e6ce592bull,
+            0x95f073d53e712572ull, 0xa1d242d8569d0631ull, 0x3fda95ed9487e334ull, 0x238c64abdf0eabdeull,
+            0xe4889f33c5d28d21ull, 0x4302de9e756e9971ull, 0x6677cf580bab3119ull, 0xa233981e02378be6ull,
+            0xfae0eecdd859b051ull, 0xb6c1681a42a2e495ull, 0xb77055296bf4d9c4ull, 0x970f4ad049d7d4bdull,
+            0xef8766428a950ba7ull, 0x362415ff120aff1bull, 0x7b2526f7880b22f2ull, 0xeef2f3c81e801089ull,
+            0x8be156b9ceaac048ull, 0x0e9b281d7fc45fa4ull, 0x7f0fb9369be8cc38ull, 0x75aa4238a2a028fcull,
+            0x8be73169eb130dc4ull, 0x24d4c95b71922201ull, 0xfcb6ba3b42f2608eull, 0x4f08f8bf20c0b719ull,
+            0xeb21527f56157325ull, 0x531c1a6d384dfd73ull, 0xfbd3d1fc3547df1bull, 0x21d2c515fae99e54ull,
+            0x78bade4dc251da96ull, 0x568afc94ddbdb109ull, 0xde7a2f41230e8fd1ull, 0x20ffec8840928fc4ull,
+            0x8dc4f179ff72adf3ull, 0x8acd4c30aa899185ull, 0xb8f125ac611b40f4ull, 0x295f6cdb84226bfdull,
+            0x48505fd1fe9b161full, 0x38fbbf941cc0dae3ull, 0x0c26405afa8658adull, 0xdf9d96fcd710fe66ull,
+            0x1c71885d7c665219ull, 0x7d6f81adc84bdc43ull, 0xb9c22394bf215af7ull, 0xdc196e74cc1abc84ull,
+            0x07fa5680c4b9c755ull, 0xd083145ac12da6bcull, 0x0974738297c0ac7eull, 0xcd9ba1649f4f8125ull,
+            0x9a90817bf934efffull, 0x882c2edbcf3d1f36ull, 0x79449f0ef14c6d77ull, 0xa5d33076e4293f67ull,
+            0x4081c3fdd379467bull, 0x5f28fcc35b125da9ull, 0x5cb5970a34a66ed8ull, 0xf053243d0dbc1c5full,
+            0xd9cf3749fb271271ull, 0x8685432873df9143ull, 0x25ef3698ae5df247ull, 0xfebd7bc251d6e9fbull,
+            0x0a06049b3cf09de2ull, 0x689d1aa8c0746c86ull, 0x1985ddefded2ecb9ull, 0x120cd969469689f5ull,
+            0xfde510c6bdf987f7ull, 0x5f19483aad28d613ull, 0xb3963872303ba0dbull, 0x18aae3accf17696eull,
+            0x86102570c93819d1ull, 0xc4e5e4c6eb121f41ull, 0x16cf1bf2ed4f4350ull, 0xcd4ffbf45fc3dd5full,
+            0x8ff25120b91ea5e8ull, 0x3748a5db370f5956ull, 0x1088db23b3619b13ull, 0xfe8f4975cf8327e6ull,
+            0x8e8a1e610cdde378ull, 0xa06f7ddd1e545f31ull, 0x3467f3b218e84977ull, 0xdb0dc32070cf463full,
+            0x4f54f683e066e9a3ull, 0x025424ceb8dfdaa7ull, 0x86e03f9c549dabe3ull, 0x1e333dc1ec3ab895ull,
+            0xd108d17c78349cf0ull, 0x7e72804348a479d9ull, 0x55bb29400502e350ull, 0x32d4cf5128efcdeaull,
+            0x29b86b620fed6a35ull, 0x7bb502199e5b1bcfull, 0x6367de97925b8111ull, 0x9683cd9a9c3c055bull,
+            0xaf83acc9b54d845aull, 0x90f842e5ba86751bull, 0x468e43d8672aee25ull, 0x466fbdf85f48b025ull,
+            0x0697463a0c2a1ff9ull, 0x2edf3e663711791aull, 0xfca3816f09a9d22bull, 0x87be545773b83f1cull,
+            0x0854808a3f3b5157ull, 0x9bd0ca60dcf290c8ull, 0x0f75757dd25d47b3ull, 0x59d2bf0e215f2e7dull,
+            0xd8cd7dd8247250bbull, 0x658d0684b85d8fe5ull, 0x2804b7d284468fc5ull, 0x646cdc9e6da24c7cull,
+            0x71c4477e25c02166ull, 0x74907d9146d5f596ull, 0xdf34b78a642501beull, 0xf64d7ecc37b22997ull,
+            0x6c24b23040de8093ull, 0xc92a22bafa960871ull, 0x7c8544a2361a7f1cull, 0x629768c321ccc2a5ull,
+            0xe91b41ec74682847ull, 0x5efbb15848f13bd2ull, 0xa7bc7a59393afa57ull, 0x0da4519ce6392778ull,
+            0x81589c96ba181408ull, 0x08dea71f3c1d63f2ull, 0xa07702c4f425e8ceull, 0x59a20b2f02d772d4ull,
+            0x49fa93b5369110e8ull, 0xeef64a98be539ebfull, 0x51528cc72d6a2747ull, 0xe60496eefc7e5e15ull,
+            0xc6d308586e78db9aull, 0xc80f620d27d384d6ull, 0xeb94f401843f2d6eull, 0xf695442e3d67e1baull,
+            0x2f1bb89326db33e2ull, 0xf957a06d595e3cb5ull, 0x28ff6919ca7327d9ull, 0xa2edf4b7efacdd5full,
+            0x5b5363cb9ea34ef3ull, 0x4f1e545e8341e85full, 0x9ed6fe717246064bull, 0x6c76eff13ae580ebull,
+            0x0078f17c99a8fac6ull, 0x0422f19d36fe18b1ull, 0x63ee268a71f13d8bull, 0xb2ccef3bf06f5d26ull,
+            0xc298c30b42f3396eull, 0x456dc7f4f1e70907ull, 0x277311177758237cull, 0xa29030826db1078dull,
+            0x8a629016a225c09aull, 0xae0f3c10a228aff1ull, 0xb1ba3d13f2d90e35ull, 0x526af5c88b157d85ull,
+            0x94a0af78ae4a032aull, 0xb85fbf3109883631ull, 0xbfa6e07003195e6full, 0x425d307b6ea0baa4ull,
+        },
+        {
+            0x3afb15e4867d027aull, 0xa10e645e4c68f49dull, 0xc91a07754228954dull, 0x96398acde133105cull,
+            0x709e49f4b275af77ull, 0x8bcfe554d9ea67feull, 0x88551547ba14967full, 0x3983d03bc0b7ba7dull,
+            0xd5ebf8596b21e9b3ull, 0x45b3e63191a5bc79ull, 0x5e7d43f7a63de659ull, 0xbc2275c2245273fbull,
+            0xaaa44fd69059cc16ull, 0x0934ba717f0c09e2ull, 0x53041b631e77abc2ull, 0xa869c02ed151f07dull,
+            0x705fefb4fc453708ull, 0x5b1f8920c744a83full, 0x58951dd4fe2619efull, 0x67d7970b8c94353bull,
+            0x6de521a218dc3d0eull, 0x1265ee125f650a12ull, 0xcd29d5089a7aec87ull, 0x2482f13a209a158dull,
+            0x6ce8d639b191f515ull, 0xc4fdbc42c8291bceull, 0xd6eb61b5c9c6bad6ull, 0xf04e0cf3df06de79ull,
+            0xe28216bc3d2f4f00ull, 0x5f3371b118ea5ab8ull, 0x7806229c5a65c7efull, 0x45d902b678412ec1ull,
+            0x2f5953aead943f04ull, 0x59579886825c0beaull, 0xba3230a45d6d15abull, 0x86f9e75476c3c21aull,
+            0x733fc23d98fd0739ull, 0xc4e752c355e7c6f8ull, 0xb308c19b5a979c51ull, 0xfeb767fac638c89bull,
+            0x4b54898db256453full, 0x026448e99bf3e2eeull, 0x19d48db0c7ca454cull, 0x16ca17f0729d76c4ull,
+            0x1f10a18c8f368e89ull, 0x8c86eb73ccceda68ull, 0x475863998c82d746ull, 0x646ba7331c1adf87ull,
+            0x6444a1c860045ed2ull, 0xa29a54270ad90c0eull, 0x9eb5c2a026126b5dull, 0x612830c07bfc28a8ull,
+            0xa0df218fb2818adaull, 0x3cf0031dc085af93ull, 0x973934d5c6c97b39ull, 0xa2f352f70c7664f1ull,
+            0xcfa83e0525879315ull, 0x89cbda80c377df3bull, 0x38165a1ba5c54330ull, 0x2df5df603a79c763ull,
+            0x90ee34e54ee8aeecull, 0x3130d6d884f52ab1ull, 0x8760678f72f618adull, 0xa803831c0af66ed7ull,
+            0xc051a9fe71ce655dull, 0xd58de27ad72b6573ull, 0x77f7eb1108105c7aull, 0x93af83c1e0a0deb1ull,
+            0xc94fe01ca7656a47ull, 0x7594deaa71feba98ull, 0xa7944d444e20e36full, 0x3374c214445adb87ull,
+            0x00ca8c557b09e7acull, 0x71312b94ed82a2afull, 0x09dbfd56544434e3ull, 0x9cca8b93ee6e577full,
+            0x8ced447a1a4d895full, 0x619c66828a1963f8ull, 0x903f0ef305f7853full, 0x1a5c6b8e713b833bull,
+            0x233cbda71be2fae0ull, 0xc67378246404af5dull, 0x1644424c22a1ac35ull, 0x5eb88d36afc1a2a0ull,
+            0x3512d31b5ba77460ull, 0x7056ad3885317bd4ull, 0xca73e1a7e353192cull, 0x4fb93d60782d3a57ull,
+            0xbc52b5cb25551421ull, 0xaedc5b5c8ecf54ecull, 0xca2a8c0b29154676ull, 0x98a01835221e7c52ull,
+            0x03f17acce90442ddull, 0x051bb3602404c37aull, 0x8891f5d3f38931f7ull, 0x21270b66af178869ull,
+            0x09fee3c797700836ull, 0x96c4f91f0ff277b0ull, 0xd3df78f5a26db2b3ull, 0xc0e6f3ea5a9cb288ull,
+            0x26066e6769621ebfull, 0xfad19ec0ef387282ull, 0xd002c99d70405cd5ull, 0x324bd5bb2e25b672ull,
+            0x8d693afbd982be42ull, 0xd4b44dbf84cb55a0ull, 0x4b83e8815638513bull, 0x8c8a802977f6a7caull,
+            0x58bf51521c862a74ull, 0x8ae1fa3b5633feb5ull, 0xc307fca890e0a255ull, 0x16c5a8dd41f61975ull,
+            0xd6403b54313b760cull, 0x17203819ba8d862eull, 0x9450d5540a9943feull, 0xb676752154d58800ull,
+            0xeb72616c34896bd3ull, 0xccb3198f6c80cb07ull, 0x06af1b9095ead452ull, 0xa0a2d3744ec0bcbeull,
+            0xaac575257e2801fcull, 0xf3d59358c4ade08full, 0x98138ef812b39be7ull, 0xf1b85e601b0b330eull,
+            0x027fad6988526882ull, 0xf0eeef6582d1a420ull, 0x6358cdd54ae69e40ull, 0xcc7c014bc0d9f6a2ull,
+            0xaf335104982f3ddfull, 0xcc9f5dfc8a5c49d1ull, 0x34ce7926f0bed0b3ull, 0x6867e1a14ea1beebull,
+            0x62a705f31c5c41f9ull, 0x425d103e782b2c44ull, 0x0ffc22533e5209d2ull, 0x7e4753aae7e1ff1eull,
+            0x6e73ccf47f69c3bfull, 0x62e255cfc951d116ull, 0xbe867a99afab0d97ull, 0x1b56d8455e88ef2dull,
+            0x988c7e53129516e7ull, 0x346e09f0dddfbd25ull, 0x659b14df6488360full, 0x6a6918f981d5caa7ull,
+            0x1e474c261bff1170ull, 0xc57af27d5f202734ull, 0x0105f454f4d40006ull, 0x025a1ccc06301233ull,
+            0xc26ab6e32345aabdull, 0x8f50ff829f461096ull, 0xf92f212fa707882bull, 0x64567277dc873a02ull,
+            0xc78a4c7b615795dcull, 0x9dad34ba0ccc9cfcull, 0xc77995134ba37f91ull, 0xfaed11c518be6b3bull,
+            0xfd820ff0e6a8e478ull, 0x2fbb4fdbf19d4437ull, 0x3171117cd6ab5de2ull, 0x44371f1fe6f5192bull,
+            0x8bc6b9143ccd82e9ull, 0x61acb15625941cecull, 0x5dff728e8d447c67ull, 0x19a5ca5d8f09890aull,
+            0x43947963c3e8016aull, 0xfc798f1604435d9full, 0x88da8a6638869035ull, 0xccfaf0195f8ec2c4ull,
+            0xee1380bc7b0aa025ull, 0xb91828e8ea58602full, 0x65c2bb24c29d837aull, 0xcb2cc0265053126dull,
+            0xa6c338ea91e6d173ull, 0x94bfb2de858d846full, 0x4b6905e19a5cc731ull, 0xc4009e25a4cd40c4ull,
+            0x44c64fd50d050b0aull, 0xdf8c8d6f9b4677c3ull, 0xd27c9a48f5f468deull, 0xb8d19c10b49d1469ull,
+            0xe3a70e04f77df761ull, 0xeb3cb3ca1a833a2aull, 0xa20f007129c303d4ull, 0x6719abce344a2a18ull,
+            0xf97dfe8981752de7ull, 0x64847480676d87ccull, 0x07c9e49e8d4463ffull, 0x1fc9823464e7c11bull,
+            0x2c3aac041b63b682ull, 0xdf7f5da36d12b328ull, 0xa97c511a3646f185ull, 0xc28878f4595c5417ull,
+            0x9b11d53e77d3160eull, 0xc6ace3f828040263ull, 0x6ac3805e9bb7e9deull, 0xecff7aa5d0cff07dull,
+            0x75d5bb77898dd72cull, 0x1b06ea642d451531ull, 0x1a9fb2e77924827cull, 0xc8aacd9f9d4e7086ull,
+            0xc5b897f8fdeec2aaull, 0x33d1c7ba7a72ee1full, 0x788f4637bf93bdadull, 0x1da4192d263a7368ull,
+            0xc4456628891045d5ull, 0x5c38426cd770aeb9ull, 0x7cbf9581c9857663ull, 0x76fb37f21456bd8dull,
+            0x86ab52b99c97f487ull, 0x9c973ab2969a4902ull, 0xbde10fc36cf8a488ull, 0xc220efea140a29dcull,
+            0x9b9f7ccbbffbaf20ull, 0x0c54f398918d05b2ull, 0x5efb274aa5d3c990ull, 0xf0468498da9b47f7ull,
+            0xde9d836c7831566bull, 0xaf8eff301a0528fbull, 0x9e8dbd49a61b4a14ull, 0x79aa3cd00285b2b5ull,
+            0xefb90700ada0ebf3ull, 0x517190b1d6bc9a7cull, 0x74bbe6b75c2b6b89ull, 0x92a91096f05f44eeull,
+            0x0722b931f46409a8ull, 0xbaf8535750a98db9ull, 0xc7950141ebea483bull, 0xc9d0db21aa447604ull,
+            0x144c00b141c18385ull, 0x6ae71a10813a8a14ull, 0x3fe66e842bc0ff39ull, 0xe889f319b6521f75ull,
+            0x3132cd4eab53db00ull, 0x73e7967c954feb25ull, 0xded8b1c9866a49b4ull, 0x9bcb7b6bea6683adull,
+            0x8448bbf6121d2d41ull, 0x333a0a691d1df5dbull, 0xa99b4ec32af8491aull, 0xd74e6a6fcb8ba348ull,
+            0xda8f9fddc580062bull, 0x622a90555af38e68ull, 0x350f3ee985561a49ull, 0xc5434f803264a655ull,
+            0x85ccfed3313466b0ull, 0xf2bf14021cf560d1ull, 0x6814b9322b880b8eull, 0xb8b1de00733636a0ull,
+            0xa9da90cc2051b453ull, 0xa1e674de7d4e6de0ull, 0x8c1bafdf18dda3aaull, 0xb2505125b796bbafull,
+            0x43710dfad4d9309bull, 0x6733dc1d00cb2cc7ull, 0xbdcca25a6d7eaf81ull, 0x7227db930c4abe97ull,
+        },
+        {
+            0xd58e37a27bc5fc88ull, 0xcdc13ec6be55f9e5ull, 0xbfe968f6ba5ecc83ull, 0x227125f981c8ba50ull,
+            0xeeb00cd2be6f9e8eull, 0x45fb6e93f20323d0ull, 0xf7bde2b824ed3436ull, 0x1c5ac745d58b90ffull,
+            0xb92e6e127fd6734bull, 0xa0fa878ad07a9f6cull, 0xf0b9aeef370a3ac4ull, 0x1849af3270ca6a75ull,
+            0xb19fdbbe3c7ec0f8ull, 0x0bbe19d8d4197eb3ull, 0xa67dfb3b35433680ull, 0x1900252480b350d6ull,
+            0x5d274872102bd6edull, 0x4fe1f6b0926e6087ull, 0x411e89c0548d7025ull, 0x87c67881c264752bull,
+            0xe0c7439ffc66b833ull, 0xf8f6865d75114479ull, 0x5a7a1c9ef4bed3a4ull, 0x97a31d7ba3f3601bull,
+            0x38be00c4f09dd94aull, 0x346ad2cc94a5f034ull, 0x37c0b84a93409c76ull, 0x85321ae2556e77e6ull,
+            0xfd68eabcccaebe27ull, 0x884bf3d04676a4abull, 0x37033fbbbfa4f3d1ull, 0x6d9618799f4069ebull,
+            0xdcc8e19cac586312ull, 0xf74fcb0d4440f5caull, 0x46c22150c79b6472ull, 0x837385fa72881c4bull,
+            0x8584f1bfef1560a2ull, 0xc0fc22422aa0e91aull, 0xa9b3dd575f03509eull, 0xc431dc0506c5fd40ull,
+            0x5932e97f6e1cc269ull, 0x87f16fe382af66fbull, 0x727c9b4af143be26ull, 0xee1edf831f78d9a5ull,
+            0x3e4781decd15edb2ull, 0x746dc3c85adfad5dull, 0xbc07c566d93d3b0cull, 0x7d084b07f8164964ull,
+            0xb22d58f7039bca2dull, 0xe7cb07e87bc0edd4ull, 0x6c77eca6861547b6ull, 0x0d1d5d7c52bc8711ull,
+            0x629989f8d1f81e31ull, 0x9c9104f9f18c3ea9ull, 0x623de3a3e2c8db6aull, 0xdc773dde986bf477ull,
+            0xbd2e9c167cafeb81ull, 0x93e98bb4bdaf7d2full, 0xe3bbf095eb27c934ull, 0x6d097323257200b8ull,
+            0x251344100094d5bdull, 0x796a9a3a7efa44f9ull, 0x0574b95f270580f5ull, 0x66d33f1df5679a9eull,
+            0xcf88d42b147f84b6ull, 0x788c5aa345550fbeull, 0xf9528bd16bf49967ull, 0x2bc05d39df37bcb4ull,
+            0x482d0b3d163ed0b0ull, 0x723a1422d1d8bb4bull, 0xb8e383b2a247046eull, 0xe058d00556f1c9baull,
+            0x8e1bf5f814a71773ull, 0xcfa324b6b410a09eull, 0xe7a6a8b9b1d6f825ull, 0xdee3dd829c785122ull,
+            0x8cc46c7b2dc71816ull, 0x8cea94e76c46aef9ull, 0x251ce4434c45744bull, 0x37c63218d737285dull,
+            0x6ecbba9366c9eae7ull, 0x1f60eca81dd5bfdfull, 0xc941dc640aac6edfull, 0x8521348c3570b8ceull,
+            0xdd5884688f7d559bull, 0x73cdb1301734b532ull, 0xe6806ab67ef0d609ull, 0xe578108f29b376acull,
+            0xe007d527a1cdd0efull, 0x4be4d8e87f485ea2ull, 0x61d8bf6f49fc4b8full, 0x022954a8ef14a0ddull,
+            0xa275efc0a1d126e2ull, 0x6dbea4387c63de00ull, 0xce231f385bfc13ffull, 0x164a0d1cb428ed73ull,
+            0x724b262cc9b0cce0ull, 0x72ef15700d43125eull, 0x8db42e556f8e4e23ull, 0x114e5800bcb0eb57ull,
+            0x1baccd8649159ea0ull, 0x08ef141323bb9983ull, 0x45e66acfa546e323ull, 0x9f4fa27f9f1078c1ull,
+            0x1813a8797471d96full, 0x0cc07fe5f3b35662ull, 0x63a020e47fb24565ull, 0xf96f05ae32e0c9e0ull,
+            0x1707f82f05d53cfcull, 0x23dad613ea451125ull, 0xa80565133dfda532ull, 0x0f735e48eafbb170ull,
+            0x99c727908bb16cefull, 0x4202396f1f0168f9ull, 0xb45f78b4229bd1d4ull, 0x11fa5c77d2ec3d36ull,
+            0x769e0b9804231249ull, 0x660c53d496673a1bull, 0xafcf178e54a301caull, 0x9c0afd39093e8f96ull,
+            0x908d0d578ed43ef9ull, 0xb2d55ca50120af2full, 0x719a1243c5f0f01cull, 0x6d47d58787762daaull,
+            0x6297b8952c461e42ull, 0xd2d086df780ae135ull, 0x7bd13cc462d3554dull, 0x00db3ba099aa1369ull,
+            0xc200081f4e9b7b59ull, 0xcd8c3c4dc9d46ec5ull, 0x886ed83daf72174full, 0xa6dabef5340cd668ull,
+            0x5bb3677199c4f3e7ull, 0x30e77f2ac5a50242ull, 0xb24697ccc96d8392ull, 0x0a58ce8feeb9b148ull,
+            0x7e0dd569ede6ec38ull, 0x676d4e8073ff5b4bull, 0x9fd733e5f84515acull, 0x181ee57dd481faa2ull,
+            0xd48908d2d0ca2cf5ull, 0xaa777d78bb5b8c38ull, 0x247ea417976b606eull, 0xb95d179be0a7dd1cull,
+            0x4181ac63fd7044abull, 0x258030520afc4ffdull, 0x7531e6369fc9d22aull, 0x4e93ca71813f94c7ull,
+            0x195bf244d3a9aae2ull, 0x1e4ed91fc3e79ba2ull, 0xb24d4d6644a6b686ull, 0x744c32d9090fcca0ull,
+            0xf66a7a663e018ac2ull, 0xc37ce5f978d650f4ull, 0x34010b47badc21d6ull, 0x88b3c8f839ded493ull,
+            0x021148ee585a21c3ull, 0x10b0d2d3782f5852ull, 0xb8c2aeb0958bd62aull, 0xf39ea053e4d4d85full,
+            0xeafe0cf22b77ace6ull, 0x4ec8507000f6aad5ull, 0xd61caaff0fa2cf88ull, 0x8757a2c6c0d49909ull,
+            0xf64c0228e2be8515ull, 0xce21823f2237886full, 0xa2f99641196d05e4ull, 0xaefdb73ee7d7dcecull,
+            0x5d78bc80d4755f98ull, 0x26bce63c4b5a7d09ull, 0xfb314193e898c55aull, 0xe1844d41355d4a98ull,
+            0xc1fcfa5d2ae82ec6ull, 0xc469552aa122a2f1ull, 0x0d44e9f9f6d73aa1ull, 0x82128145f0262931ull,
+            0x7539513df930c3dcull, 0xbbd8b034f4e97e4full, 0x3cfd7d5198f36daeull, 0x3c04b804888d61feull,
+            0x0134b68925bc4c12ull, 0xa2ee0155864683ecull, 0xcb0acadcba2d00ebull, 0x120623f343b2fbc4ull,
+            0x00b183ee02db3338ull, 0x77017c7ecdeb4529ull, 0x8f62ad710ed7f92cull, 0x1ef93bc39b8e852full,
+            0xa86a24228dcb2d07ull, 0x5250cb02c83f77faull, 0x4d078db4318df4eeull, 0x1070acfa4eea2e31ull,
+            0x022c491c62d3287full, 0x7389d9d5e5d3021bull, 0x2346997521a561e1ull, 0x850dda33ac4ecf57ull,
+            0x68a6daa90258389eull, 0x8bda6e0a33dc564eull, 0x6d524ff8b9e350a3ull, 0x21840c1a5525dcd1ull,
+            0x6c26f2f4f9b4c785ull, 0xc50f830b4ac9d9faull, 0xda2f9947379e36b1ull, 0x2daa9fcc1b47e263ull,
+            0xa651da4a4bfef96dull, 0x317be59e82b8619eull, 0xf5c9039b9dbfd8cdull, 0x265539cfe9bd7726ull,
+            0xc7ee7bafc66f73b0ull, 0x715d698168f318acull, 0x1e15c9ca80f51383ull, 0x45709dcf1b46598bull,
+            0xf45720ee20df17e1ull, 0xccf3cfd62471c0ddull, 0x6def88c85b1b7591ull, 0xe68b90af04ac6d61ull,
+            0x40ef3380537a501eull, 0x4958f751a07830e4ull, 0x94a0f9effa4d565bull, 0x6a4e36bc3b47cc23ull,
+            0xf3ea512228d0f71dull, 0x54f2f1e20b9d5fe8ull, 0xf620e81bf76c17d3ull, 0x2aac85d5c990337full,
+            0xe358cbda1fc6b7b4ull, 0x8df8bf5cfe02236dull, 0x43f1e6c9c8c518ceull, 0x1292ab4a98a7d0a4ull,
+            0x5910f5c429e72b4full, 0x578001b8f56438fcull, 0xab5a7074b3604425ull, 0xc4a007d0dc3c5b31ull,
+            0x01882914236521a5ull, 0x5ce5c33379adc1deull, 0xd76578523b84acbfull, 0x7d7af2f9e190defcull,
+            0x122de506f1678538ull, 0x05ae45d91d6d5b14ull, 0xd633c57df80c7813ull, 0x4f4297a22aec1512ull,
+            0x67af6007a7c50ad3ull, 0xc5ce0ac46e01e4f4ull, 0xf9586f7e15abc2d0ull, 0x192682115b8f40b6ull,
+            0xa54fa69cedb4d693ull, 0xaa0461366a5f0e4full, 0xc04e72269d18e944ull, 0x1543e61b63d70fa1ull,
+            0x1f835303806bca7eull, 0x8ca7786775c73ca8ull, 0xec1905e7134ded0full, 0x6030cbe19d255af3ull,
+            0x71b5cad5a1f4f27full, 0x7d3a8734e542dfb2ull, 0x0e881b3277be9795ull, 0x43129879088ff039ull,
+        },
+        {
+            0x94502f0c7f79966aull, 0x6b202d693c9f5cefull, 0x88ceae792980b724ull, 0x6285570c1e6db4ffull,
+            0x9855fab2abf65c36ull, 0x4d3a9763b8d991c8ull, 0xb389dab8fbcb92b9ull, 0xb8ef0ad54d535fd5ull,
+            0xce62af5d9d2f1867ull, 0xead9d9e334ef8fafull, 0xa93051e6c57eb817ull, 0x7184115caa635a56ull,
+            0x1ac727bec5599111ull, 0x0798ed810d787a69ull, 0x43beac1fd384b889ull, 0xcb32c1c8d6982280ull,
+            0xd6ce134de6ad127dull, 0xc865caf4982d7b85ull, 0xa101012b7584edcdull, 0x58d463cbeca82b0eull,
+            0x06472b07f1b9d8eaull, 0xf474f609cc28086cull, 0x9a1ad48f99ca9f54ull, 0x5517759c05c6381eull,
+            0x59acb0a20a51b520ull, 0xa7fe97cb339398e2ull, 0xbae71f18e84df71aull, 0xedfb1d054aceca41ull,
+            0x10095527c29dad37ull, 0xed3b07f25279b589ull, 0xffeebe4bfd78d1e3ull, 0x16cfaea84c323ca1ull,
+            0xaaad590cf8e87c46ull, 0x4b9b5aee45e78334ull, 0xc83b8bfc426d2e04ull, 0x49daecb6b8117395ull,
+            0x1fad833042ee71e7ull, 0x56c1a3900526f774ull, 0x897d7cfbb2bfdfaeull, 0x1c375af01f77c53dull,
+            0x3da3145db8f6c830ull, 0x674077c04dedf5cbull, 0x2677c7bf0b9b2a6cull, 0xba549aaa02a41b2bull,
+            0x7e565d570feb5c72ull, 0x4b1f8b840a09a7d6ull, 0x8b1981b7494207e0ull, 0xb1ac7afab48cd1b2ull,
+            0x2e328e9dc4107b71ull, 0xb956dd45b16d3eb2ull, 0x1d0f9043874a1151ull, 0xd29bd35aa86a7516ull,
+            0xfd52a725b3534428ull, 0x757b74db1b84893bull, 0xc2f324ded6847a63ull, 0x5eadfdc4fff5531cull,
+            0x811a56d856f81c8eull, 0x1849ba7595a365f7ull, 0xc5728dc9089fa408ull, 0x57b7de79a6964c43ull,
+            0xb959f6e4b131c1a6ull, 0x6f42a3aecfa743ccull, 0xfd6ce7c2d9113698ull, 0xeca0d37108ec12d8ull,
+            0x526f00e1609765b0ull, 0xee7b8b6f77321acaull, 0xb0ba7190b2cb2f47ull, 0xefa24b003a91034cull,
+            0xdd79ae08a3e2d18cull, 0x69bf25d826d5ca5aull, 0x963a9336b31a4c71ull, 0x38f8219e1ddd8ca1ull,
+            0x234c07aae7ab02b0ull, 0x01e6fa5f6846e5f4ull, 0x756b7604c861b167ull, 0x557f1c1358149179ull,
+            0xf36bbdc85bae6dbfull, 0x49c593aa54316864ull, 0x0080cd08379cb4f7ull, 0xd8ef6606170fd344ull,
+            0x657db0729b1a2f88ull, 0x8752dc4e8618f58bull, 0xf50850d1b82c39a6ull, 0xfa1d7b583eafc342ull,
+            0xe271b7c1aa4603c8ull, 0x570d3d4d5addcd9bull, 0x934108c3dc2caa7aull, 0x16733527d992537bull,
+            0x0590993661d85272ull, 0xb5967116ccff170aull, 0xbe4b37cd8408c0eaull, 0x3e6f67e6eabe8896ull,
+            0x9646358a576418d5ull, 0xf2f8c4a4528ea1f3ull, 0x524188bdf6e69c39ull, 0x9c6609d2dd7589ddull,
+            0x2b28c7ef705dd835ull, 0xa9c0677876c8ec52ull, 0x15c683b057b86473ull, 0xefc198448ce3b0a9ull,
+            0x26546368ea45c2d4ull, 0x305f1ffabe56a41full, 0xc286331b7f43dc09ull, 0x5c9a7a63dd0290feull,
+            0x25b98a697788e540ull, 0x19d28ae2d4dcdf75ull, 0x6a2f6fa4355cdb1bull, 0xa6f7c71de8a5a7e7ull,
+            0x38e38df6d95d20d6ull, 0x299d19ddbdd19e47ull, 0x5d75cf598f160ef5ull, 0x42cc84490c9f1bbeull,
+            0xed135c10f8ef1c27ull, 0xb598cd6945c4eef7ull, 0x0a6745630866bc0eull, 0xbf612c91652bab1cull,
+            0x6c2fc2abe0f47735ull, 0x28faf9b36567288dull, 0x9bedda924729c7cdull, 0x319f6edc0def5176ull,
+            0xd5d4be66bcaa6367ull, 0x22554f60c2539edaull, 0x72f7d9bd35dbf315ull, 0x4629c6cea7af899cull,
+            0x72e0c47f289fd7f9ull, 0xc51267b4346321ecull, 0x3dc34171132285ffull, 0x07e29abe70ffe53full,
+            0x04a5499862c06fa2ull, 0xe110c0a9b7ecb3a2ull, 0xf6883fa0de86f5baull, 0xafbaf5bbf8ba4d36ull,
+            0xc1e6be6585e07683ull, 0x6a57498101738fcfull, 0xafa817b4bdaba448ull, 0x959fd2fbc11a3127ull,
+            0xaf12e78373d8b3c1ull, 0xdae03683323e160cull, 0x39640dfe70f657efull, 0xdee99224604d241aull,
+            0xb2a575b0474015d5ull, 0x748d1a1c00558f2bull, 0x62410eda0dc8cfabull, 0x8ec5debfc9d8de1dull,
+            0xf3a47196a77110feull, 0x81e364d03d9ca0b0ull, 0xb63cdbc332d44278ull, 0xd973549f01f34960ull,
+            0x4b8223f67b228b2cull, 0x378317507af73e21ull, 0xb8145e7799343925ull, 0xf825579893510185ull,
+            0xfc431dc3f29203edull, 0x8aea6a34f85b1215ull, 0x09d92aeaeaa9d777ull, 0x468330e300a65056ull,
+            0x1befbc03ec83c210ull, 0x81300026cff0ede9ull, 0x8679806f018439a1ull, 0x8964e3bb71ff3567ull,
+            0x12e32c1977a13811ull, 0x39499470cd2c8676ull, 0xfbb46a369c4947d8ull, 0x737463f8f4bd6f12ull,
+            0xafcc7be4d1e68553ull, 0xafc4adbe5b1996c6ull, 0x3a8686e1414e87dcull, 0x99d1a0a0ba9f5768ull,
+            0x73d9fb7a74a95164ull, 0x9f59cc2417864aabull, 0x4cf37e1ab5e247c7ull, 0x2c81528db3bb7668ull,
+            0x15db453f4560fed5ull, 0xdd665dea3e79d512ull, 0x2566de734c3d836eull, 0xc1e63903852ae27eull,
+            0xc3ae43a12ef0ede3ull, 0xc32115721bf1be57ull, 0x824e502629730ce0ull, 0x678c5227bf532d63ull,
+            0x68b307de9c6e7571ull, 0xe72132a18c710199ull, 0xd8333d37a24aa1e6ull, 0x3fec435770664db9ull,
+            0xc8cb04cae0337abfull, 0xbe2f3f93fec30116ull, 0xd820886393d8c66bull, 0xc4b62c4ce114bae6ull,
+            0x89cc94f9e725b588ull, 0xc5f69de0f3e319ccull, 0xd2ba21f131467f2eull, 0x24c3c8098d4a6871ull,
+            0x8ed0923f32b524e2ull, 0x08d489b9fa5d2617ull, 0x5cc69fd8aa94de05ull, 0x98eae2e97b36fa24ull,
+            0x0be0ad77310f53c0ull, 0x28d942274bfa2e10ull, 0x9591cb5957b04c7cull, 0xb63bc0c58f8f2150ull,
+            0xfb8de686670f784full, 0x9da183b737cc352bull, 0xb13c25f097121e94ull, 0x8679c6b0b7761198ull,
+            0x2dcd6d9c6e9c3bd6ull, 0xc1fcdc305c88125bull, 0x667a5643b2bf8136ull, 0x61acc64e02fb3919ull,
+            0x1e3a6ce2fd05d9ffull, 0x44e823e16c039586ull, 0xdbef7eb0167713f0ull, 0x7dd5f7d6302460a5ull,
+            0x43a68707ea214d3eull, 0xf91beea0ff9b9ed0ull, 0x16b365e246fe837dull, 0x72d04e91f002a7b7ull,
+            0xbcd1463390ffeab8ull, 0xe691c309334a5d59ull, 0xb2799e84f6b3fa35ull, 0x52f23ab545895ff7ull,
+            0xb9d011f19376f274ull, 0x51c90aa15e32de7full, 0x53ecf8aa6184b78bull, 0xd20883fe6676f646ull,
+            0xf333764dba9e1642ull, 0x307f3d93bdaa765aull, 0xa977de978f861617ull, 0x5cf2ff568e40e5a9ull,
+            0x06e464d2ddd3c6cfull, 0xb5518b0434caeed3ull, 0x0427685d88cc5fafull, 0xa0dc902ffe5cb5ceull,
+            0xa2404a1a7fda9233ull, 0x3d228daa11c889c6ull, 0x0b0d5067049e0292ull, 0x14aaacb3fb59278bull,
+            0x1959ac08f19bfa18ull, 0xd8aa2b6f22eccee2ull, 0xe5810709bc37f765ull, 0x83d43bdd41ba066bull,
+            0x7217cdee664f4b4eull, 0x23f62199bd19640dull, 0x1516ae477cd5e77eull, 0x1bc6457be2dd6014ull,
+            0x7403c6e3b1884df1ull, 0x2e22d90eae212147ull, 0x7399d863f200e341ull, 0x761e7947e3987656ull,
+            0x9368f7da1cc5ea4cull, 0xd74d6db8f1146f7cull, 0x4ea76b99c8c6f5c4ull, 0x8d0575ab151d0fcfull,
+            0xec4e00e2ead77f08ull, 0x8dcdba10f0fb56f4ull, 0xfb9d3776c3935a3aull, 0x28b3bf5520dddf02ull,
+        },
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr std::uint64_t tabulation_constants<T>::table[ 8 ][ 256 ];
+
+#endif
+
+} // namespace detail
+
+// Simple tabulation applied to the input eight bytes at a time, each word
+// xored into the state before the lookups, with the length mixed into the
+// result. For a single word key w, the result is the simple tabulation
+// hash of w xored with the seeded state, which is 3-independent.
+
+class tabulation_64
+{
+private:
+
+    // an odd constant, so that messages of different lengths whose
+    // padded words are the same produce different results
+
+    static constexpr std::uint64_t K = 0x9E3779B97F4A7C15ull;
+
+    std::uint64_t h_ = 0;
+
+    unsigned char buffer_[ 8 ] = {};
+    std::size_t m_ = 0; // == n_ % 8
+
+    std::uint64_t n_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t round( std::uint64_t h, std::uint64_t w )
+    {
+        std::uint64_t const x = h ^ w;
+
+        return
+            detail::tabulation_constants<>::table[ 0 ][ x & 0xFF ] ^
+            detail::tabulation_constants<>::table[ 1 ][ ( x >> 8 ) & 0xFF ] ^
+            detail::tabulation_constants<>::table[ 2 ][ ( x >> 16 ) & 0xFF ] ^
+            detail::tabulation_constants<>::table[ 3 ][ ( x >> 24 ) & 0xFF ] ^
+            detail::tabulation_constants<>::table[ 4 ][ ( x >> 32 ) & 0xFF ] ^
+            detail::tabulation_constants<>::table[ 5 ][ ( x >> 40 ) & 0xFF ] ^
+            detail::tabulation_constants<>::table[ 6 ][ ( x >> 48 ) & 0xFF ] ^
+            detail::tabulation_constants<>::table[ 7 ][ x >> 56 ];
+    }
+
+    // the n bytes at p, 1 <= n <= 8, padded with zeroes
+
+    static std::uint64_t load_word( unsigned char const* p, std::size_t n )
+    {
+        if( n == 8 )
+        {
+            return detail::read64le( p );
+        }
+
+        unsigned char tmp[ 8 ] = {};
+        detail::memcpy( tmp, p, n );
+
+        return detail::read64le( tmp );
+    }
+
+public:
+
+    typedef std::uint64_t result_type;
+
+    constexpr tabulation_64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit tabulation_64( std::uint64_t seed )
+    {
+        if( seed )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update_word( seed );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR tabulation_64( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( tabulation_64, "tabulation_64", n );
+
+        n_ += n;
+
+        if( m_ > 0 )
+        {
+            std::size_t k = 8 - m_;
+
+            if( n < k )
+            {
+                k = n;
+            }
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+            m_ += k;
+
+            if( m_ < 8 ) return;
+
+            h_ = round( h_, detail::read64le( buffer_ ) );
+            m_ = 0;
+        }
+
+        std::uint64_t h = h_;
+
+        while( n >= 8 )
+        {
+            h = round( h, detail::read64le( p ) );
+
+            p += 8;
+            n -= 8;
+        }
+
+        h_ = h;
+
+        if( n > 0 )
+        {
+            detail::memcpy( buffer_, p, n );
+            m_ = n;
+        }
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( tabulation_64, "tabulation_64", 8 );
+
+        if( m_ == 0 )
+        {
+            h_ = round( h_, w );
+            n_ += 8;
+        }
+        else
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, w );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( tabulation_64, "tabulation_64" );
+
+        std::uint64_t h = h_;
+
+        if( m_ > 0 )
+        {
+            // the partial last word, padded with zeroes
+
+            std::uint64_t w = 0;
+
+            for( std::size_t i = 0; i < m_; ++i )
+            {
+                w |= static_cast<std::uint64_t>( buffer_[ i ] ) << ( i * 8 );
+            }
+
+            h = round( h, w );
+        }
+
+        std::uint64_t r = h ^ n_ * K;
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp[ 1 ] = { 0xFF };
+        BOOST_HASH2_STATS_SUSPEND();
+        update( tmp, 1 );
+        BOOST_HASH2_STATS_RESUME();
+
+        return r;
+    }
+
+    // One-shot hashing, equivalent to constructing from seed and
+    // calling update( p, n ) and result()
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        tabulation_64 h( seed );
+        h.update( p, n );
+
+        return h.result();
+    }
+
+    static std::uint64_t hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+    // Sets out[ i ] to the result of a copy of *this after
+    // update( p[ i ], n[ i ] ) and result(). Keys of up to eight
+    // bytes are looked up directly, without the copy; the lookups
+    // of consecutive keys are independent, and overlap.
+    //
+    // Vector gathers don't help here, as the lookups are bound by
+    // the load ports and a gather issues a load per lane.
+
+    void hash_batch( unsigned char const* const p[], std::size_t const n[], std::size_t k, std::uint64_t out[] ) const
+    {
+        BOOST_HASH2_STATS_BATCH( tabulation_64, "tabulation_64", n, k );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            if( m_ == 0 && n[ i ] - 1 < 8 )
+            {
+                out[ i ] = round( h_, load_word( p[ i ], n[ i ] ) ) ^ ( n_ + n[ i ] ) * K;
+            }
+            else
+            {
+                tabulation_64 h( *this );
+
+                BOOST_HASH2_STATS_SUSPEND();
+                h.update( p[ i ], n[ i ] );
+                out[ i ] = h.result();
+                BOOST_HASH2_STATS_RESUME();
+            }
+        }
+    }
+
+    void hash_batch( void const* const p[], std::size_t const n[], std::size_t k, std::uint64_t out[] ) const
+    {
+        unsigned char const* q[ 8 ];
+
+        for( std::size_t i = 0; i < k; i += 8 )
+        {
+            std::size_t m = k - i < 8? k - i: 8;
+
+            for( std::size_t j = 0; j < m; ++j )
+            {
+                q[ j ] = static_cast<unsigned char const*>( p[ i + j ] );
+            }
+
+            hash_batch( q, n + i, m, out + i );
+        }
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u64( self.h_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 8 + 8 + 8 + 8;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        tabulation_64 tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ < 8 && tmp.m_ == tmp.n_ % 8 ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+constexpr std::uint64_t tabulation_64::K;
+
+#endif
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_TABULATION_HPP_INCLUDED
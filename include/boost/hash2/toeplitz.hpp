@@ -0,0 +1,315 @@
+#ifndef BOOST_HASH2_TOEPLITZ_HPP_INCLUDED
+#define BOOST_HASH2_TOEPLITZ_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The Toeplitz hash, as used by Receive Side Scaling (RSS),
+// https://learn.microsoft.com/en-us/windows-hardware/drivers/network/rss-hashing-functions
+
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/toeplitz_x86.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+template<class = void>
+struct toeplitz_constants
+{
+    // the default RSS key of Microsoft, which most NICs also use
+
+    constexpr static unsigned char const key[ 40 ] =
+    {
+        0x6d, 0x5a, 0x56, 0xda, 0x25, 0x5b, 0x0e, 0xc2,
+        0x41, 0x67, 0x25, 0x3d, 0x43, 0xa3, 0x8f, 0xb0,
+        0xd0, 0xca, 0x2b, 0xcb, 0xae, 0x7b, 0x30, 0xb4,
+        0x77, 0xcb, 0x2d, 0xa3, 0x80, 0x30, 0xf2, 0x0c,
+        0x6a, 0x42, 0xb7, 0x3b, 0xbe, 0xac, 0x01, 0xfa,
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr unsigned char toeplitz_constants<T>::key[ 40 ];
+
+#endif
+
+} // namespace detail
+
+// toeplitz_32
+//
+// The hash is linear in the input: each bit set in the message xors into
+// the result the 32 key bits starting at its position. The key repeats
+// for messages longer than it; RSS uses 40 byte keys, long enough for the
+// 36 bytes of an IPv6 4-tuple.
+
+class toeplitz_32
+{
+public:
+
+    static constexpr std::size_t max_key_size = 64;
+
+private:
+
+    // w_[ q ] is the key bytes q to q + 7, big endian, wrapping around at k_
+
+    std::uint64_t w_[ max_key_size ] = {};
+
+    std::uint32_t k_ = 0;
+    std::uint32_t q_ = 0; // the key position of the next byte
+    std::uint32_t r_ = 0;
+
+private:
+
+    BOOST_CXX14_CONSTEXPR void init( unsigned char const* key, std::uint32_t k )
+    {
+        k_ = k;
+
+        for( std::uint32_t i = 0; i < k; ++i )
+        {
+            std::uint64_t w = 0;
+            std::uint32_t m = i;
+
+            for( int j = 0; j < 8; ++j )
+            {
+                w = ( w << 8 ) | key[ m ];
+
+                if( ++m == k ) m = 0;
+            }
+
+            w_[ i ] = w;
+        }
+    }
+
+    // the xor of the contributions of p[0..n), starting at key position q
+
+    BOOST_CXX14_CONSTEXPR std::uint32_t compute( std::uint32_t q, unsigned char const* p, std::size_t n ) const
+    {
+        std::uint32_t r = 0;
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( n >= 8 && !detail::is_constant_evaluated() && detail::has_x86_ssse3_pclmul() )
+        {
+            std::size_t m = n & ~static_cast<std::size_t>( 7 );
+
+            if( detail::has_x86_gfni_pclmul() )
+            {
+                r = detail::toeplitz_update_gfni( w_, k_, q, p, m );
+            }
+            else
+            {
+                r = detail::toeplitz_update_ssse3( w_, k_, q, p, m );
+            }
+
+            detail::toeplitz_advance( q, static_cast<std::uint32_t>( m % k_ ), k_ );
+
+            p += m;
+            n -= m;
+        }
+
+#endif
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            std::uint64_t const w = w_[ q ];
+            std::uint32_t const b = p[ i ];
+
+            for( int j = 0; j < 8; ++j )
+            {
+                r ^= static_cast<std::uint32_t>( w >> ( 32 - j ) ) & ( 0u - ( ( b >> ( 7 - j ) ) & 1 ) );
+            }
+
+            if( ++q == k_ ) q = 0;
+        }
+
+        return r;
+    }
+
+public:
+
+    typedef std::uint32_t result_type;
+
+    BOOST_CXX14_CONSTEXPR toeplitz_32()
+    {
+        init( detail::toeplitz_constants<>::key, 40 );
+    }
+
+    // the default key, with its first 8 bytes xored with the seed
+
+    BOOST_CXX14_CONSTEXPR explicit toeplitz_32( std::uint64_t seed )
+    {
+        unsigned char tmp[ 40 ] = {};
+
+        for( int i = 0; i < 40; ++i )
+        {
+            tmp[ i ] = detail::toeplitz_constants<>::key[ i ];
+        }
+
+        for( int i = 0; i < 8; ++i )
+        {
+            tmp[ i ] ^= static_cast<unsigned char>( seed >> ( 8 * i ) );
+        }
+
+        init( tmp, 40 );
+    }
+
+    // the key p[0..n); keys longer than max_key_size are folded into it
+
+    BOOST_CXX14_CONSTEXPR toeplitz_32( unsigned char const * p, std::size_t n )
+    {
+        if( n == 0 )
+        {
+            init( detail::toeplitz_constants<>::key, 40 );
+        }
+        else
+        {
+            unsigned char tmp[ max_key_size ] = {};
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                tmp[ i % max_key_size ] ^= p[ i ];
+            }
+
+            init( tmp, static_cast<std::uint32_t>( n < max_key_size? n: max_key_size ) );
+        }
+    }
+
+    constexpr std::size_t key_size() const noexcept
+    {
+        return k_;
+    }
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const * p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( toeplitz_32, "toeplitz_32", n );
+
+        r_ ^= compute( q_, p, n );
+
+        q_ = static_cast<std::uint32_t>( ( q_ + n % k_ ) % k_ );
+    }
+
+    void update( void const * pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR std::uint32_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( toeplitz_32, "toeplitz_32" );
+
+        std::uint32_t r = r_;
+
+        // advance as if by update( "\xFF", 1 ), to allow
+        // multiple result() calls to generate a sequence
+        // of distinct values
+
+        unsigned char const tmp[ 1 ] = { 0xFF };
+        BOOST_HASH2_STATS_SUSPEND();
+        update( tmp, 1 );
+        BOOST_HASH2_STATS_RESUME();
+
+        return r;
+    }
+
+    // the result of a copy after update( p, n ), without the copy
+
+    std::uint32_t hash( void const* p, std::size_t n ) const
+    {
+        BOOST_HASH2_STATS_MESSAGES( toeplitz_32, "toeplitz_32", 1, n );
+
+        return r_ ^ compute( q_, static_cast<unsigned char const*>( p ), n );
+    }
+
+    // out[ i ] = hash( p[ i ], n[ i ] ), for the 5-tuples of a burst of packets
+
+    void hash_batch( unsigned char const* const p[], std::size_t const n[], std::size_t k, std::uint64_t out[] ) const
+    {
+        BOOST_HASH2_STATS_BATCH( toeplitz_32, "toeplitz_32", n, k );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            out[ i ] = r_ ^ compute( q_, p[ i ], n[ i ] );
+        }
+    }
+
+    void hash_batch( void const* const p[], std::size_t const n[], std::size_t k, std::uint64_t out[] ) const
+    {
+        BOOST_HASH2_STATS_BATCH( toeplitz_32, "toeplitz_32", n, k );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            out[ i ] = r_ ^ compute( q_, static_cast<unsigned char const*>( p[ i ] ), n[ i ] );
+        }
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming; the key,
+    // its size, the key position and the result
+
+    static constexpr std::size_t state_size = 1 + max_key_size + 12;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        unsigned char key[ max_key_size ] = {};
+
+        for( std::uint32_t i = 0; i < k_; ++i )
+        {
+            key[ i ] = static_cast<unsigned char>( w_[ i ] >> 56 );
+        }
+
+        detail::state_writer ar( p );
+
+        ar.bytes( key );
+        ar.u32( k_ );
+        ar.u32( q_ );
+        ar.u32( r_ );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        unsigned char key[ max_key_size ] = {};
+        std::uint32_t k = 0, q = 0, r = 0;
+
+        detail::state_reader ar( p );
+
+        ar.bytes( key );
+        ar.u32( k );
+        ar.u32( q );
+        ar.u32( r );
+
+        if( !ar.ok() || k == 0 || k > max_key_size || q >= k ) return false;
+
+        init( key, k );
+
+        q_ = q;
+        r_ = r;
+
+        return true;
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_TOEPLITZ_HPP_INCLUDED
@@ -0,0 +1,189 @@
+#ifndef BOOST_HASH2_TYPE_HASH_HPP_INCLUDED
+#define BOOST_HASH2_TYPE_HASH_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// type_hash<T, H>(), a hash of the name of a type, computed at compile
+// time, for keying registries by type
+
+#include <boost/hash2/literal.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/config.hpp>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+// type_hash_name<T>
+//
+// specialize, with a member function static constexpr char const* name(),
+// to give T a name that doesn't depend on the compiler
+
+template<class T> struct type_hash_name
+{
+};
+
+namespace detail
+{
+
+struct type_name_span
+{
+    char const* p;
+    std::size_t n;
+};
+
+// the signature of this function, which contains the name of T
+
+template<class T> constexpr type_name_span raw_type_name() noexcept
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+
+    return { __FUNCSIG__, sizeof( __FUNCSIG__ ) - 1 };
+
+#else
+
+    return { __PRETTY_FUNCTION__, sizeof( __PRETTY_FUNCTION__ ) - 1 };
+
+#endif
+}
+
+// the position of the name of T in raw_type_name<T>(), from the last
+// occurrence of "int" in raw_type_name<int>()
+
+inline BOOST_CXX14_CONSTEXPR std::size_t type_name_prefix() noexcept
+{
+    type_name_span const r = raw_type_name<int>();
+
+    std::size_t i = r.n - 3;
+
+    while( i > 0 && !( r.p[ i ] == 'i' && r.p[ i+1 ] == 'n' && r.p[ i+2 ] == 't' ) )
+    {
+        --i;
+    }
+
+    return i;
+}
+
+inline BOOST_CXX14_CONSTEXPR std::size_t type_name_suffix() noexcept
+{
+    return raw_type_name<int>().n - type_name_prefix() - 3;
+}
+
+// the name of T, as spelled by the compiler
+
+template<class T> BOOST_CXX14_CONSTEXPR type_name_span type_name() noexcept
+{
+    type_name_span const r = raw_type_name<T>();
+
+    std::size_t const m = detail::type_name_prefix();
+    std::size_t const k = detail::type_name_suffix();
+
+    return { r.p + m, r.n - m - k };
+}
+
+// whether the keyword s, followed by a space, starts at p[i], in [p, p+n)
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR bool type_name_keyword( char const* p, std::size_t n, std::size_t i, char const (&s)[ N ] ) noexcept
+{
+    if( n - i < N ) return false;
+
+    if( i > 0 )
+    {
+        char c = p[ i - 1 ];
+
+        if( c == '_' || ( c >= '0' && c <= '9' ) || ( c >= 'A' && c <= 'Z' ) || ( c >= 'a' && c <= 'z' ) ) return false;
+    }
+
+    for( std::size_t j = 0; j < N - 1; ++j )
+    {
+        if( p[ i + j ] != s[ j ] ) return false;
+    }
+
+    return p[ i + N - 1 ] == ' ';
+}
+
+// the name of T, as spelled by the compiler, without the class-key and
+// enum keywords MSVC adds and without whitespace, hashed with H
+
+template<class H> BOOST_CXX14_CONSTEXPR std::uint64_t normalized_type_hash( type_name_span r )
+{
+    H h;
+
+    for( std::size_t i = 0; i < r.n; ++i )
+    {
+        if( type_name_keyword( r.p, r.n, i, "class" ) || type_name_keyword( r.p, r.n, i, "union" ) )
+        {
+            i += 5;
+        }
+        else if( type_name_keyword( r.p, r.n, i, "struct" ) )
+        {
+            i += 6;
+        }
+        else if( type_name_keyword( r.p, r.n, i, "enum" ) )
+        {
+            i += 4;
+        }
+        else if( r.p[ i ] != ' ' )
+        {
+            unsigned char const c[ 1 ] = { static_cast<unsigned char>( r.p[ i ] ) };
+            h.update( c, 1 );
+        }
+    }
+
+    return hash2::get_integral_result<std::uint64_t>( h.result() );
+}
+
+template<class T, class H, class E = void> struct stable_type_hash_impl
+{
+    static BOOST_CXX14_CONSTEXPR std::uint64_t fn()
+    {
+        return detail::normalized_type_hash<H>( detail::type_name<T>() );
+    }
+};
+
+inline BOOST_CXX14_CONSTEXPR std::size_t type_name_length( char const* p ) noexcept
+{
+    std::size_t n = 0;
+    while( p[ n ] ) ++n;
+
+    return n;
+}
+
+template<class T, class H> struct stable_type_hash_impl<T, H, decltype( (void)type_hash_name<T>::name() )>
+{
+    static BOOST_CXX14_CONSTEXPR std::uint64_t fn()
+    {
+        return hash2::literal<H>( type_hash_name<T>::name(), detail::type_name_length( type_hash_name<T>::name() ) );
+    }
+};
+
+} // namespace detail
+
+// the name of T, as spelled by the compiler, hashed with H; the same in
+// every program built with the same compiler and standard library
+
+template<class T, class H = fnv1a_64> BOOST_CXX14_CONSTEXPR std::uint64_t type_hash()
+{
+    return hash2::literal<H>( detail::type_name<T>().p, detail::type_name<T>().n );
+}
+
+// the name given by type_hash_name<T>, if specialized, or else the name
+// of T with keywords and whitespace removed, hashed with H; the same
+// across compilers for types whose qualified names they spell alike
+
+template<class T, class H = fnv1a_64> BOOST_CXX14_CONSTEXPR std::uint64_t stable_type_hash()
+{
+    return detail::stable_type_hash_impl<T, H>::fn();
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_TYPE_HASH_HPP_INCLUDED
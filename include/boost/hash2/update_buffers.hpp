@@ -0,0 +1,220 @@
+#ifndef BOOST_HASH2_UPDATE_BUFFERS_HPP_INCLUDED
+#define BOOST_HASH2_UPDATE_BUFFERS_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// update_buffers, passing a sequence of buffers, such as an iovec array
+// or an Asio buffer sequence, to a hash algorithm
+
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <type_traits>
+#include <iterator>
+#include <utility>
+#include <cstddef>
+
+namespace boost
+{
+namespace hash2
+{
+
+namespace detail
+{
+
+// fragments shorter than this are gathered in a local buffer of
+// update_buffers_size bytes, and passed to the hash algorithm together
+
+std::size_t const update_buffers_min = 64;
+std::size_t const update_buffers_size = 1024;
+
+// the block based algorithms, which have a block_size member, already
+// gather the bytes of a partial block cheaply, and take the fragments
+// as they are; the others have a fixed cost per update call that the
+// gathering avoids
+
+template<class H, class En = void> struct update_buffers_gather: std::true_type
+{
+};
+
+template<class H> struct update_buffers_gather<H, decltype( (void)H::block_size )>: std::false_type
+{
+};
+
+// a buffer is an object with iov_base and iov_len members, as struct iovec,
+// or with data() and size() members, where data() returns a pointer to void
+// or to a character type, as std::string_view or boost::asio::const_buffer
+
+template<class T> struct is_buffer_element: std::integral_constant<bool, sizeof( T ) == 1 && std::is_integral<typename std::remove_cv<T>::type>::value>
+{
+};
+
+// void is specialized, so that sizeof is never applied to it
+
+template<> struct is_buffer_element<void>: std::true_type
+{
+};
+
+template<> struct is_buffer_element<void const>: std::true_type
+{
+};
+
+template<> struct is_buffer_element<void volatile>: std::true_type
+{
+};
+
+template<> struct is_buffer_element<void const volatile>: std::true_type
+{
+};
+
+template<class P> struct is_buffer_pointer: std::false_type
+{
+};
+
+template<class T> struct is_buffer_pointer<T*>: is_buffer_element<T>
+{
+};
+
+template<class B, class En = void> struct is_iovec_buffer: std::false_type
+{
+};
+
+template<class B> struct is_iovec_buffer<B, decltype( (void)std::declval<B const&>().iov_base, (void)std::declval<B const&>().iov_len, void() )>: std::true_type
+{
+};
+
+template<class B, class En = void> struct is_data_buffer: std::false_type
+{
+};
+
+template<class B> struct is_data_buffer<B, decltype( (void)std::declval<B const&>().data(), (void)std::declval<B const&>().size(), void() )>:
+    is_buffer_pointer<decltype( std::declval<B const&>().data() )>
+{
+};
+
+template<class B> struct is_buffer: std::integral_constant<bool, is_iovec_buffer<B>::value || is_data_buffer<B>::value>
+{
+};
+
+template<class B> unsigned char const* buffer_data( B const& b, std::true_type )
+{
+    return static_cast<unsigned char const*>( static_cast<void const*>( b.iov_base ) );
+}
+
+template<class B> std::size_t buffer_size( B const& b, std::true_type )
+{
+    return static_cast<std::size_t>( b.iov_len );
+}
+
+template<class B> unsigned char const* buffer_data( B const& b, std::false_type )
+{
+    return static_cast<unsigned char const*>( static_cast<void const*>( b.data() ) );
+}
+
+template<class B> std::size_t buffer_size( B const& b, std::false_type )
+{
+    return static_cast<std::size_t>( b.size() );
+}
+
+} // namespace detail
+
+// passes the bytes of the buffers in [first, last) to h, in order; the
+// result is the same as that of calling h.update once per buffer
+//
+// large buffers are passed to h directly, without copying; runs of small
+// ones, such as the headers of a chain of packets, are gathered first,
+// unless H is block based
+
+template<class H, class It> void update_buffers( H& h, It first, It last )
+{
+    using B = typename std::iterator_traits<It>::value_type;
+
+    static_assert( detail::is_buffer<B>::value, "The elements of the sequence must be buffers" );
+
+    using is_iovec = detail::is_iovec_buffer<B>;
+
+    unsigned char buffer[ detail::update_buffers_size ];
+
+    std::size_t m = 0; // the bytes in buffer
+    std::size_t m2 = 0; // the bytes written to buffer, to be cleared
+
+    for( ; first != last; ++first )
+    {
+        unsigned char const* p = detail::buffer_data( *first, is_iovec() );
+        std::size_t const n = detail::buffer_size( *first, is_iovec() );
+
+        if( n == 0 ) continue;
+
+        if( detail::update_buffers_gather<H>::value && n < detail::update_buffers_min )
+        {
+            if( n > detail::update_buffers_size - m )
+            {
+                h.update( buffer, m );
+                m = 0;
+            }
+
+            detail::memcpy( buffer + m, p, n );
+            m += n;
+
+            if( m > m2 ) m2 = m;
+        }
+        else
+        {
+            if( m > 0 )
+            {
+                h.update( buffer, m );
+                m = 0;
+            }
+
+            h.update( p, n );
+        }
+    }
+
+    if( m > 0 )
+    {
+        h.update( buffer, m );
+    }
+
+    // clear gathered plaintext
+    detail::memset( buffer, 0, m2 );
+}
+
+// an array of n buffers, such as struct iovec
+
+template<class H, class B> void update_buffers( H& h, B const* p, std::size_t n )
+{
+    hash2::update_buffers( h, p, p + n );
+}
+
+namespace detail
+{
+
+template<class H, class S> void update_buffers_( H& h, S const& s, std::true_type )
+{
+    using is_iovec = detail::is_iovec_buffer<S>;
+    h.update( detail::buffer_data( s, is_iovec() ), detail::buffer_size( s, is_iovec() ) );
+}
+
+template<class H, class S> void update_buffers_( H& h, S const& s, std::false_type )
+{
+    using std::begin;
+    using std::end;
+
+    hash2::update_buffers( h, begin( s ), end( s ) );
+}
+
+} // namespace detail
+
+// a buffer, or a sequence of buffers, such as a std::vector<iovec> or
+// an Asio ConstBufferSequence
+
+template<class H, class S> void update_buffers( H& h, S const& s )
+{
+    detail::update_buffers_( h, s, detail::is_buffer<S>() );
+}
+
+} // namespace hash2
+} // namespace boost
+
+#endif // #ifndef BOOST_HASH2_UPDATE_BUFFERS_HPP_INCLUDED
@@ -0,0 +1,988 @@
+#ifndef BOOST_HASH2_XXH3_HPP_INCLUDED
+#define BOOST_HASH2_XXH3_HPP_INCLUDED
+
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// XXH3, https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md
+
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/hash2/detail/rot.hpp>
+#include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/memset.hpp>
+#include <boost/hash2/detail/mul128.hpp>
+#include <boost/hash2/detail/is_constant_evaluated.hpp>
+#include <boost/hash2/detail/xxh3_x86.hpp>
+#include <boost/hash2/detail/xxh3_arm.hpp>
+#include <boost/hash2/detail/xxh3_wasm.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstring>
+#include <cstddef>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(push)
+# pragma warning(disable: 4307) // '+': integral constant overflow
+#endif
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+template<class = void>
+struct xxh3_constants
+{
+    // the default secret, taken from FARSH
+
+    constexpr static unsigned char const secret[ 192 ] =
+    {
+        0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+        0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+        0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+        0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+        0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+        0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+        0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+        0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+        0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+        0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+        0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+        0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e,
+    };
+};
+
+#if defined(BOOST_NO_CXX17_INLINE_VARIABLES)
+
+template<class T>
+constexpr unsigned char xxh3_constants<T>::secret[ 192 ];
+
+#endif
+
+class xxh3_base
+{
+protected:
+
+    static constexpr std::uint32_t P32_1 = 0x9E3779B1U;
+    static constexpr std::uint32_t P32_2 = 0x85EBCA77U;
+    static constexpr std::uint32_t P32_3 = 0xC2B2AE3DU;
+
+    static constexpr std::uint64_t P64_1 = 0x9E3779B185EBCA87ULL;
+    static constexpr std::uint64_t P64_2 = 0xC2B2AE3D27D4EB4FULL;
+    static constexpr std::uint64_t P64_3 = 0x165667B19E3779F9ULL;
+    static constexpr std::uint64_t P64_4 = 0x85EBCA77C2B2AE63ULL;
+    static constexpr std::uint64_t P64_5 = 0x27D4EB2F165667C5ULL;
+
+    static constexpr std::uint64_t PMX_1 = 0x165667919E3779F9ULL;
+    static constexpr std::uint64_t PMX_2 = 0x9FB21C651E98DF25ULL;
+
+    static constexpr std::size_t secret_size = 192;
+    static constexpr std::size_t stripes_per_block = ( secret_size - 64 ) / 8;
+
+    static constexpr std::size_t buffer_size = 256;
+
+protected:
+
+    std::uint64_t acc_[ 8 ] = { P32_3, P64_1, P64_2, P64_3, P64_4, P32_2, P64_5, P32_1 };
+
+    // the secret used for inputs longer than 240 bytes;
+    // derived from the seed when the seed is not zero
+    unsigned char secret_[ secret_size ] = {};
+
+    unsigned char buffer_[ buffer_size ] = {};
+    std::size_t m_ = 0; // bytes in buffer_
+
+    std::uint64_t n_ = 0;
+
+    std::size_t stripes_ = 0; // stripes consumed in the current block
+
+    std::uint64_t seed_ = 0;
+
+protected:
+
+    BOOST_CXX14_CONSTEXPR xxh3_base()
+    {
+        init_secret( 0 );
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_base( std::uint64_t seed ): seed_( seed )
+    {
+        init_secret( seed );
+    }
+
+    BOOST_CXX14_CONSTEXPR void init_secret( std::uint64_t seed )
+    {
+        unsigned char const* k = xxh3_constants<>::secret;
+
+        for( std::size_t i = 0; i < secret_size; i += 16 )
+        {
+            detail::write64le( secret_ + i + 0, detail::read64le( k + i + 0 ) + seed );
+            detail::write64le( secret_ + i + 8, detail::read64le( k + i + 8 ) - seed );
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint32_t byteswap( std::uint32_t x )
+    {
+        return ( x << 24 ) | ( ( x << 8 ) & 0x00FF0000u ) | ( ( x >> 8 ) & 0x0000FF00u ) | ( x >> 24 );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t byteswap( std::uint64_t x )
+    {
+        return ( static_cast<std::uint64_t>( byteswap( static_cast<std::uint32_t>( x ) ) ) << 32 ) | byteswap( static_cast<std::uint32_t>( x >> 32 ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t mul128_fold64( std::uint64_t x, std::uint64_t y )
+    {
+        std::uint64_t hi = 0;
+        std::uint64_t lo = detail::mul128( x, y, hi );
+
+        return lo ^ hi;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t xxh64_avalanche( std::uint64_t h )
+    {
+        h ^= h >> 33;
+        h *= P64_2;
+        h ^= h >> 29;
+        h *= P64_3;
+        h ^= h >> 32;
+
+        return h;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t avalanche( std::uint64_t h )
+    {
+        h ^= h >> 37;
+        h *= PMX_1;
+        h ^= h >> 32;
+
+        return h;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t rrmxmx( std::uint64_t h, std::uint64_t len )
+    {
+        h ^= detail::rotl( h, 49 ) ^ detail::rotl( h, 24 );
+        h *= PMX_2;
+        h ^= ( h >> 35 ) + len;
+        h *= PMX_2;
+        h ^= h >> 28;
+
+        return h;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t mix16( unsigned char const* p, unsigned char const* secret, std::uint64_t seed )
+    {
+        return mul128_fold64(
+            detail::read64le( p + 0 ) ^ ( detail::read64le( secret + 0 ) + seed ),
+            detail::read64le( p + 8 ) ^ ( detail::read64le( secret + 8 ) - seed ) );
+    }
+
+    // stripe accumulation
+
+    BOOST_CXX14_CONSTEXPR static void accumulate_scalar( std::uint64_t acc[ 8 ], unsigned char const* p, unsigned char const* secret, std::size_t n )
+    {
+        for( std::size_t k = 0; k < n; ++k, p += 64, secret += 8 )
+        {
+            for( int i = 0; i < 8; ++i )
+            {
+                std::uint64_t v = detail::read64le( p + i * 8 );
+                std::uint64_t w = v ^ detail::read64le( secret + i * 8 );
+
+                acc[ i ^ 1 ] += v;
+                acc[ i ] += ( w & 0xFFFFFFFFu ) * ( w >> 32 );
+            }
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR static void accumulate( std::uint64_t acc[ 8 ], unsigned char const* p, unsigned char const* secret, std::size_t n )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            if( detail::has_x86_avx2() )
+            {
+                detail::xxh3_accumulate_avx2( acc, p, secret, n );
+                return;
+            }
+
+            if( detail::has_x86_sse2() )
+            {
+                detail::xxh3_accumulate_sse2( acc, p, secret, n );
+                return;
+            }
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::xxh3_accumulate_neon( acc, p, secret, n );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::xxh3_accumulate_wasm( acc, p, secret, n );
+            return;
+        }
+
+#endif
+
+        accumulate_scalar( acc, p, secret, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR static void scramble( std::uint64_t acc[ 8 ], unsigned char const* secret )
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            if( detail::has_x86_avx2() )
+            {
+                detail::xxh3_scramble_avx2( acc, secret );
+                return;
+            }
+
+            if( detail::has_x86_sse2() )
+            {
+                detail::xxh3_scramble_sse2( acc, secret );
+                return;
+            }
+        }
+
+#elif defined(BOOST_HASH2_HAS_ARM_NEON_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::xxh3_scramble_neon( acc, secret );
+            return;
+        }
+
+#elif defined(BOOST_HASH2_HAS_WASM_SIMD128_INTRINSICS)
+
+        if( !detail::is_constant_evaluated() )
+        {
+            detail::xxh3_scramble_wasm( acc, secret );
+            return;
+        }
+
+#endif
+
+        for( int i = 0; i < 8; ++i )
+        {
+            std::uint64_t a = acc[ i ];
+
+            a ^= a >> 47;
+            a ^= detail::read64le( secret + i * 8 );
+            a *= P32_1;
+
+            acc[ i ] = a;
+        }
+    }
+
+    // processes n stripes from p, scrambling at the end of each block
+
+    BOOST_CXX14_CONSTEXPR static void consume( std::uint64_t acc[ 8 ], std::size_t& stripes, unsigned char const* p, std::size_t n, unsigned char const* secret )
+    {
+        if( n >= stripes_per_block - stripes )
+        {
+            std::size_t k = stripes_per_block - stripes;
+
+            do
+            {
+                accumulate( acc, p, secret + stripes * 8, k );
+                scramble( acc, secret + secret_size - 64 );
+
+                p += k * 64;
+                n -= k;
+
+                k = stripes_per_block;
+                stripes = 0;
+            }
+            while( n >= stripes_per_block );
+        }
+
+        if( n > 0 )
+        {
+            accumulate( acc, p, secret + stripes * 8, n );
+            stripes += n;
+        }
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t merge_accs( std::uint64_t const acc[ 8 ], unsigned char const* secret, std::uint64_t start )
+    {
+        std::uint64_t r = start;
+
+        for( int i = 0; i < 4; ++i )
+        {
+            r += mul128_fold64( acc[ 2 * i + 0 ] ^ detail::read64le( secret + 16 * i + 0 ), acc[ 2 * i + 1 ] ^ detail::read64le( secret + 16 * i + 8 ) );
+        }
+
+        return avalanche( r );
+    }
+
+    // the accumulators for the whole input, n_ > 240; doesn't modify the state
+
+    BOOST_CXX14_CONSTEXPR void digest_long( std::uint64_t acc[ 8 ] ) const
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            acc[ i ] = acc_[ i ];
+        }
+
+        unsigned char last[ 64 ] = {};
+
+        if( m_ >= 64 )
+        {
+            std::size_t stripes = stripes_;
+            consume( acc, stripes, buffer_, ( m_ - 1 ) / 64, secret_ );
+
+            detail::memcpy( last, buffer_ + m_ - 64, 64 );
+        }
+        else
+        {
+            // the tail of buffer_ holds the last stripe consumed by update
+
+            std::size_t k = 64 - m_;
+
+            detail::memcpy( last, buffer_ + buffer_size - k, k );
+            detail::memcpy( last + k, buffer_, m_ );
+        }
+
+        accumulate( acc, last, secret_ + secret_size - 64 - 7, 1 );
+    }
+
+    // restarts the stream from the digest d, so that repeated calls to
+    // result() return a pseudorandom sequence and no plaintext is retained
+
+    template<bool Scrub> BOOST_CXX14_CONSTEXPR void reset( unsigned char const* d, std::size_t n )
+    {
+        std::uint64_t const acc[ 8 ] = { P32_3, P64_1, P64_2, P64_3, P64_4, P32_2, P64_5, P32_1 };
+
+        for( int i = 0; i < 8; ++i )
+        {
+            acc_[ i ] = acc[ i ];
+        }
+
+        if( Scrub )
+        {
+            detail::memset( buffer_, 0, buffer_size );
+        }
+
+        m_ = 0;
+        n_ = 0;
+        stripes_ = 0;
+
+        update( d, n );
+    }
+
+public:
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_ASSERT( m_ <= buffer_size );
+
+        if( n == 0 ) return;
+
+        std::size_t const n0 = n; // the size of the input
+        n_ += n;
+
+        if( n <= buffer_size - m_ )
+        {
+            detail::memcpy( buffer_ + m_, p, n );
+            m_ += n;
+
+            return;
+        }
+
+        if( m_ > 0 )
+        {
+            std::size_t k = buffer_size - m_;
+
+            detail::memcpy( buffer_ + m_, p, k );
+
+            p += k;
+            n -= k;
+
+            consume( acc_, stripes_, buffer_, buffer_size / 64, secret_ );
+            m_ = 0;
+        }
+
+        BOOST_ASSERT( n > 0 );
+
+        // n can only exceed buffer_size when the input does; testing n0
+        // makes this visible to the optimizer when update is inlined with
+        // a small constant size, as for the 16 byte rendezvous messages
+
+        if( n0 > buffer_size && n > buffer_size )
+        {
+            // always leave at least one byte for the final stripe
+            std::size_t k = ( n - 1 ) / 64;
+
+            consume( acc_, stripes_, p, k, secret_ );
+
+            p += k * 64;
+            n -= k * 64;
+
+            // keep the last consumed stripe, for when fewer than 64 bytes remain
+            detail::memcpy( buffer_ + buffer_size - 64, p - 64, 64 );
+        }
+
+        BOOST_ASSERT( n > 0 && n <= buffer_size );
+
+        detail::memcpy( buffer_, p, n );
+        m_ = n;
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.words( self.acc_ );
+        ar.bytes( self.secret_ );
+        ar.bytes( self.buffer_ );
+        ar.u64( self.m_ );
+        ar.u64( self.n_ );
+        ar.u64( self.stripes_ );
+        ar.u64( self.seed_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 1 + 64 + secret_size + buffer_size + 32;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        xxh3_base tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() || !( tmp.m_ <= buffer_size && tmp.m_ <= tmp.n_ && tmp.stripes_ < stripes_per_block ) ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+template<bool Scrub> class xxh3_64_impl: private xxh3_base
+{
+private:
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash_0to16( unsigned char const* p, std::size_t n, unsigned char const* secret, std::uint64_t seed )
+    {
+        if( n > 8 )
+        {
+            std::uint64_t bitflip1 = ( detail::read64le( secret + 24 ) ^ detail::read64le( secret + 32 ) ) + seed;
+            std::uint64_t bitflip2 = ( detail::read64le( secret + 40 ) ^ detail::read64le( secret + 48 ) ) - seed;
+
+            std::uint64_t lo = detail::read64le( p ) ^ bitflip1;
+            std::uint64_t hi = detail::read64le( p + n - 8 ) ^ bitflip2;
+
+            std::uint64_t acc = n + byteswap( lo ) + hi + mul128_fold64( lo, hi );
+
+            return avalanche( acc );
+        }
+
+        if( n >= 4 )
+        {
+            seed ^= static_cast<std::uint64_t>( byteswap( static_cast<std::uint32_t>( seed ) ) ) << 32;
+
+            std::uint32_t x1 = detail::read32le( p );
+            std::uint32_t x2 = detail::read32le( p + n - 4 );
+
+            std::uint64_t bitflip = ( detail::read64le( secret + 8 ) ^ detail::read64le( secret + 16 ) ) - seed;
+            std::uint64_t x = x2 + ( static_cast<std::uint64_t>( x1 ) << 32 );
+
+            return rrmxmx( x ^ bitflip, n );
+        }
+
+        if( n > 0 )
+        {
+            std::uint32_t c1 = p[ 0 ];
+            std::uint32_t c2 = p[ n >> 1 ];
+            std::uint32_t c3 = p[ n - 1 ];
+
+            std::uint32_t combined = ( c1 << 16 ) | ( c2 << 24 ) | c3 | ( static_cast<std::uint32_t>( n ) << 8 );
+            std::uint64_t bitflip = ( detail::read32le( secret ) ^ detail::read32le( secret + 4 ) ) + seed;
+
+            return xxh64_avalanche( combined ^ bitflip );
+        }
+
+        return xxh64_avalanche( seed ^ detail::read64le( secret + 56 ) ^ detail::read64le( secret + 64 ) );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash_17to128( unsigned char const* p, std::size_t n, unsigned char const* secret, std::uint64_t seed )
+    {
+        std::uint64_t acc = n * P64_1;
+
+        if( n > 32 )
+        {
+            if( n > 64 )
+            {
+                if( n > 96 )
+                {
+                    acc += mix16( p + 48, secret + 96, seed );
+                    acc += mix16( p + n - 64, secret + 112, seed );
+                }
+
+                acc += mix16( p + 32, secret + 64, seed );
+                acc += mix16( p + n - 48, secret + 80, seed );
+            }
+
+            acc += mix16( p + 16, secret + 32, seed );
+            acc += mix16( p + n - 32, secret + 48, seed );
+        }
+
+        acc += mix16( p + 0, secret + 0, seed );
+        acc += mix16( p + n - 16, secret + 16, seed );
+
+        return avalanche( acc );
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash_129to240( unsigned char const* p, std::size_t n, unsigned char const* secret, std::uint64_t seed )
+    {
+        std::uint64_t acc = n * P64_1;
+
+        for( std::size_t i = 0; i < 8; ++i )
+        {
+            acc += mix16( p + 16 * i, secret + 16 * i, seed );
+        }
+
+        acc = avalanche( acc );
+
+        std::uint64_t acc2 = mix16( p + n - 16, secret + 136 - 17, seed );
+
+        for( std::size_t i = 8; i < n / 16; ++i )
+        {
+            acc2 += mix16( p + 16 * i, secret + 16 * ( i - 8 ) + 3, seed );
+        }
+
+        return avalanche( acc + acc2 );
+    }
+
+public:
+
+    using result_type = std::uint64_t;
+
+    BOOST_CXX14_CONSTEXPR xxh3_64_impl()
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_64_impl( std::uint64_t seed ): xxh3_base( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxh3_64_impl( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    using xxh3_base::state_size;
+    using xxh3_base::save_state;
+    using xxh3_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( xxh3_64_impl, Scrub? "xxh3_64": "xxh3_64_noscrub", n );
+        xxh3_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( xxh3_64_impl, Scrub? "xxh3_64": "xxh3_64_noscrub" );
+
+        std::uint64_t r = 0;
+
+        if( n_ > 240 )
+        {
+            std::uint64_t acc[ 8 ] = {};
+            digest_long( acc );
+
+            r = merge_accs( acc, secret_ + 11, n_ * P64_1 );
+        }
+        else
+        {
+            std::size_t n = static_cast<std::size_t>( n_ );
+            unsigned char const* secret = detail::xxh3_constants<>::secret;
+
+            if( n <= 16 )
+            {
+                r = hash_0to16( buffer_, n, secret, seed_ );
+            }
+            else if( n <= 128 )
+            {
+                r = hash_17to128( buffer_, n, secret, seed_ );
+            }
+            else
+            {
+                r = hash_129to240( buffer_, n, secret, seed_ );
+            }
+        }
+
+        unsigned char tmp[ 8 ] = {};
+        detail::write64le( tmp, r );
+
+        reset<Scrub>( tmp, 8 );
+
+        return r;
+    }
+};
+
+template<bool Scrub> class xxh3_128_impl: private xxh3_base
+{
+private:
+
+    struct u128
+    {
+        std::uint64_t lo;
+        std::uint64_t hi;
+    };
+
+    BOOST_CXX14_CONSTEXPR static u128 hash_0to16( unsigned char const* p, std::size_t n, unsigned char const* secret, std::uint64_t seed )
+    {
+        u128 r = { 0, 0 };
+
+        if( n > 8 )
+        {
+            std::uint64_t bitflipl = ( detail::read64le( secret + 32 ) ^ detail::read64le( secret + 40 ) ) - seed;
+            std::uint64_t bitfliph = ( detail::read64le( secret + 48 ) ^ detail::read64le( secret + 56 ) ) + seed;
+
+            std::uint64_t x_lo = detail::read64le( p );
+            std::uint64_t x_hi = detail::read64le( p + n - 8 );
+
+            std::uint64_t m_hi = 0;
+            std::uint64_t m_lo = detail::mul128( x_lo ^ x_hi ^ bitflipl, P64_1, m_hi );
+
+            m_lo += static_cast<std::uint64_t>( n - 1 ) << 54;
+            x_hi ^= bitfliph;
+
+            m_hi += x_hi + ( x_hi & 0xFFFFFFFFu ) * ( P32_2 - 1 );
+            m_lo ^= byteswap( m_hi );
+
+            std::uint64_t h_hi = 0;
+            std::uint64_t h_lo = detail::mul128( m_lo, P64_2, h_hi );
+
+            h_hi += m_hi * P64_2;
+
+            r.lo = avalanche( h_lo );
+            r.hi = avalanche( h_hi );
+        }
+        else if( n >= 4 )
+        {
+            seed ^= static_cast<std::uint64_t>( byteswap( static_cast<std::uint32_t>( seed ) ) ) << 32;
+
+            std::uint32_t x_lo = detail::read32le( p );
+            std::uint32_t x_hi = detail::read32le( p + n - 4 );
+
+            std::uint64_t x = x_lo + ( static_cast<std::uint64_t>( x_hi ) << 32 );
+            std::uint64_t bitflip = ( detail::read64le( secret + 16 ) ^ detail::read64le( secret + 24 ) ) + seed;
+
+            std::uint64_t m_hi = 0;
+            std::uint64_t m_lo = detail::mul128( x ^ bitflip, P64_1 + ( n << 2 ), m_hi );
+
+            m_hi += m_lo << 1;
+            m_lo ^= m_hi >> 3;
+
+            m_lo ^= m_lo >> 35;
+            m_lo *= PMX_2;
+            m_lo ^= m_lo >> 28;
+
+            r.lo = m_lo;
+            r.hi = avalanche( m_hi );
+        }
+        else if( n > 0 )
+        {
+            std::uint32_t c1 = p[ 0 ];
+            std::uint32_t c2 = p[ n >> 1 ];
+            std::uint32_t c3 = p[ n - 1 ];
+
+            std::uint32_t combinedl = ( c1 << 16 ) | ( c2 << 24 ) | c3 | ( static_cast<std::uint32_t>( n ) << 8 );
+            std::uint32_t combinedh = detail::rotl( byteswap( combinedl ), 13 );
+
+            std::uint64_t bitflipl = ( detail::read32le( secret + 0 ) ^ detail::read32le( secret + 4 ) ) + seed;
+            std::uint64_t bitfliph = ( detail::read32le( secret + 8 ) ^ detail::read32le( secret + 12 ) ) - seed;
+
+            r.lo = xxh64_avalanche( combinedl ^ bitflipl );
+            r.hi = xxh64_avalanche( combinedh ^ bitfliph );
+        }
+        else
+        {
+            r.lo = xxh64_avalanche( seed ^ detail::read64le( secret + 64 ) ^ detail::read64le( secret + 72 ) );
+            r.hi = xxh64_avalanche( seed ^ detail::read64le( secret + 80 ) ^ detail::read64le( secret + 88 ) );
+        }
+
+        return r;
+    }
+
+    BOOST_CXX14_CONSTEXPR static void mix32( u128& acc, unsigned char const* p1, unsigned char const* p2, unsigned char const* secret, std::uint64_t seed )
+    {
+        acc.lo += mix16( p1, secret + 0, seed );
+        acc.lo ^= detail::read64le( p2 ) + detail::read64le( p2 + 8 );
+        acc.hi += mix16( p2, secret + 16, seed );
+        acc.hi ^= detail::read64le( p1 ) + detail::read64le( p1 + 8 );
+    }
+
+    BOOST_CXX14_CONSTEXPR static u128 finalize( u128 acc, std::size_t n, std::uint64_t seed )
+    {
+        u128 r = { 0, 0 };
+
+        r.lo = avalanche( acc.lo + acc.hi );
+        r.hi = 0 - avalanche( acc.lo * P64_1 + acc.hi * P64_4 + ( n - seed ) * P64_2 );
+
+        return r;
+    }
+
+    BOOST_CXX14_CONSTEXPR static u128 hash_17to128( unsigned char const* p, std::size_t n, unsigned char const* secret, std::uint64_t seed )
+    {
+        u128 acc = { n * P64_1, 0 };
+
+        if( n > 32 )
+        {
+            if( n > 64 )
+            {
+                if( n > 96 )
+                {
+                    mix32( acc, p + 48, p + n - 64, secret + 96, seed );
+                }
+
+                mix32( acc, p + 32, p + n - 48, secret + 64, seed );
+            }
+
+            mix32( acc, p + 16, p + n - 32, secret + 32, seed );
+        }
+
+        mix32( acc, p, p + n - 16, secret, seed );
+
+        return finalize( acc, n, seed );
+    }
+
+    BOOST_CXX14_CONSTEXPR static u128 hash_129to240( unsigned char const* p, std::size_t n, unsigned char const* secret, std::uint64_t seed )
+    {
+        u128 acc = { n * P64_1, 0 };
+
+        for( std::size_t i = 32; i < 160; i += 32 )
+        {
+            mix32( acc, p + i - 32, p + i - 16, secret + i - 32, seed );
+        }
+
+        acc.lo = avalanche( acc.lo );
+        acc.hi = avalanche( acc.hi );
+
+        for( std::size_t i = 160; i <= n; i += 32 )
+        {
+            mix32( acc, p + i - 32, p + i - 16, secret + 3 + i - 160, seed );
+        }
+
+        mix32( acc, p + n - 16, p + n - 32, secret + 136 - 17 - 16, 0 - seed );
+
+        return finalize( acc, n, seed );
+    }
+
+public:
+
+    // the canonical representation, high 64 bits first, big endian
+    using result_type = digest<16>;
+
+    BOOST_CXX14_CONSTEXPR xxh3_128_impl()
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_128_impl( std::uint64_t seed ): xxh3_base( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxh3_128_impl( unsigned char const * p, std::size_t n )
+    {
+        if( n != 0 )
+        {
+            BOOST_HASH2_STATS_SUSPEND();
+            update( p, n );
+            result();
+            BOOST_HASH2_STATS_RESUME();
+        }
+    }
+
+    using xxh3_base::state_size;
+    using xxh3_base::save_state;
+    using xxh3_base::load_state;
+
+    BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
+    {
+        BOOST_HASH2_STATS_UPDATE( xxh3_128_impl, Scrub? "xxh3_128": "xxh3_128_noscrub", n );
+        xxh3_base::update( p, n );
+    }
+
+    void update( void const* pv, std::size_t n )
+    {
+        unsigned char const* p = static_cast<unsigned char const*>( pv );
+        update( p, n );
+    }
+
+    BOOST_CXX14_CONSTEXPR result_type result()
+    {
+        BOOST_HASH2_STATS_RESULT( xxh3_128_impl, Scrub? "xxh3_128": "xxh3_128_noscrub" );
+
+        u128 r = { 0, 0 };
+
+        if( n_ > 240 )
+        {
+            std::uint64_t acc[ 8 ] = {};
+            digest_long( acc );
+
+            r.lo = merge_accs( acc, secret_ + 11, n_ * P64_1 );
+            r.hi = merge_accs( acc, secret_ + secret_size - 64 - 11, ~( n_ * P64_2 ) );
+        }
+        else
+        {
+            std::size_t n = static_cast<std::size_t>( n_ );
+            unsigned char const* secret = detail::xxh3_constants<>::secret;
+
+            if( n <= 16 )
+            {
+                r = hash_0to16( buffer_, n, secret, seed_ );
+            }
+            else if( n <= 128 )
+            {
+                r = hash_17to128( buffer_, n, secret, seed_ );
+            }
+            else
+            {
+                r = hash_129to240( buffer_, n, secret, seed_ );
+            }
+        }
+
+        result_type digest;
+
+        detail::write64be( digest.data() + 0, r.hi );
+        detail::write64be( digest.data() + 8, r.lo );
+
+        reset<Scrub>( digest.data(), 16 );
+
+        return digest;
+    }
+};
+
+} // namespace detail
+
+class xxh3_64: public detail::xxh3_64_impl<true>
+{
+public:
+
+    BOOST_CXX14_CONSTEXPR xxh3_64()
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_64( std::uint64_t seed ): detail::xxh3_64_impl<true>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxh3_64( unsigned char const * p, std::size_t n ): detail::xxh3_64_impl<true>( p, n )
+    {
+    }
+};
+
+class xxh3_128: public detail::xxh3_128_impl<true>
+{
+public:
+
+    BOOST_CXX14_CONSTEXPR xxh3_128()
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_128( std::uint64_t seed ): detail::xxh3_128_impl<true>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxh3_128( unsigned char const * p, std::size_t n ): detail::xxh3_128_impl<true>( p, n )
+    {
+    }
+};
+
+// Variants that don't clear the buffered plaintext in result(), for
+// hashing non-secret data; the hash values are the same as those of
+// xxh3_64 and xxh3_128
+
+class xxh3_64_noscrub: public detail::xxh3_64_impl<false>
+{
+public:
+
+    BOOST_CXX14_CONSTEXPR xxh3_64_noscrub()
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_64_noscrub( std::uint64_t seed ): detail::xxh3_64_impl<false>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxh3_64_noscrub( unsigned char const * p, std::size_t n ): detail::xxh3_64_impl<false>( p, n )
+    {
+    }
+};
+
+class xxh3_128_noscrub: public detail::xxh3_128_impl<false>
+{
+public:
+
+    BOOST_CXX14_CONSTEXPR xxh3_128_noscrub()
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR explicit xxh3_128_noscrub( std::uint64_t seed ): detail::xxh3_128_impl<false>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxh3_128_noscrub( unsigned char const * p, std::size_t n ): detail::xxh3_128_impl<false>( p, n )
+    {
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(pop)
+#endif
+
+#endif // #ifndef BOOST_HASH2_XXH3_HPP_INCLUDED
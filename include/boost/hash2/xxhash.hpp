@@ -8,9 +8,12 @@
 // xxHash, https://cyan4973.github.io/xxHash/
 
 #include <boost/hash2/detail/read.hpp>
+#include <boost/hash2/detail/write.hpp>
 #include <boost/hash2/detail/rot.hpp>
 #include <boost/hash2/detail/memset.hpp>
 #include <boost/hash2/detail/memcpy.hpp>
+#include <boost/hash2/detail/state_io.hpp>
+#include <boost/hash2/detail/stats.hpp>
 #include <boost/assert.hpp>
 #include <boost/config.hpp>
 #include <cstdint>
@@ -27,7 +30,10 @@ namespace boost
 namespace hash2
 {
 
-class xxhash_32
+namespace detail
+{
+
+template<bool Scrub> class xxhash_32_impl
 {
 private:
 
@@ -45,9 +51,9 @@ private:
     std::uint32_t v4_ = static_cast<std::uint32_t>( 0 ) - P1;
 
     unsigned char buffer_[ 16 ] = {};
-    std::size_t m_ = 0; // == n_ % 16
 
-    std::size_t n_ = 0;
+    // the number of bytes in buffer_ is n_ % 16
+    std::uint64_t n_ = 0;
 
 private:
 
@@ -67,6 +73,42 @@ private:
         return seed;
     }
 
+    // processes the last m < 16 bytes
+
+    BOOST_CXX14_CONSTEXPR static std::uint32_t tail( std::uint32_t h, unsigned char const* p, std::size_t m )
+    {
+        while( m >= 4 )
+        {
+            h += detail::read32le( p ) * P3;
+            h = detail::rotl( h, 17 ) * P4;
+
+            p += 4;
+            m -= 4;
+        }
+
+        while( m > 0 )
+        {
+            h += p[0] * P5;
+            h = detail::rotl( h, 11 ) * P1;
+
+            ++p;
+            --m;
+        }
+
+        return h;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint32_t avalanche( std::uint32_t h )
+    {
+        h ^= h >> 15;
+        h *= P2;
+        h ^= h >> 13;
+        h *= P3;
+        h ^= h >> 16;
+
+        return h;
+    }
+
     BOOST_CXX14_CONSTEXPR void update_( unsigned char const * p, std::size_t k )
     {
         std::uint32_t v1 = v1_;
@@ -92,9 +134,9 @@ public:
 
     using result_type = std::uint32_t;
 
-    xxhash_32() = default;
+    xxhash_32_impl() = default;
 
-    BOOST_CXX14_CONSTEXPR explicit xxhash_32( std::uint64_t seed )
+    BOOST_CXX14_CONSTEXPR explicit xxhash_32_impl( std::uint64_t seed )
     {
         std::uint32_t s0 = static_cast<std::uint32_t>( seed );
         std::uint32_t s1 = static_cast<std::uint32_t>( seed >> 32 );
@@ -110,48 +152,49 @@ public:
         }
     }
 
-    BOOST_CXX14_CONSTEXPR xxhash_32( unsigned char const * p, std::size_t n )
+    BOOST_CXX14_CONSTEXPR xxhash_32_impl( unsigned char const * p, std::size_t n )
     {
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
-        BOOST_ASSERT( m_ == n_ % 16 );
+        BOOST_HASH2_STATS_UPDATE( xxhash_32_impl, Scrub? "xxhash_32": "xxhash_32_noscrub", n );
 
         if( n == 0 ) return;
 
+        std::size_t m = static_cast<std::size_t>( n_ % 16 );
+
         n_ += n;
 
-        if( m_ > 0 )
+        if( m > 0 )
         {
-            std::size_t k = 16 - m_;
+            std::size_t k = 16 - m;
 
             if( n < k )
             {
                 k = n;
             }
 
-            detail::memcpy( buffer_ + m_, p, k );
+            detail::memcpy( buffer_ + m, p, k );
 
             p += k;
             n -= k;
-            m_ += k;
+            m += k;
 
-            if( m_ < 16 ) return;
+            if( m < 16 ) return;
 
-            BOOST_ASSERT( m_ == 16 );
+            BOOST_ASSERT( m == 16 );
 
             update_( buffer_, 1 );
-            m_ = 0;
         }
 
-        BOOST_ASSERT( m_ == 0 );
-
         {
             std::size_t k = n / 16;
 
@@ -166,10 +209,7 @@ public:
         if( n > 0 )
         {
             detail::memcpy( buffer_, p, n );
-            m_ = n;
         }
-
-        BOOST_ASSERT( m_ == n_ % 16 );
     }
 
     void update( void const* pv, std::size_t n )
@@ -178,9 +218,43 @@ public:
         update( p, n );
     }
 
-    BOOST_CXX14_CONSTEXPR std::uint32_t result()
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( xxhash_32_impl, Scrub? "xxhash_32": "xxhash_32_noscrub", 8 );
+
+        std::size_t m = static_cast<std::size_t>( n_ % 16 );
+
+        if( m > 8 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, w );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+            return;
+        }
+
+        detail::write64le( buffer_ + m, w );
+
+        n_ += 8;
+
+        if( m + 8 == 16 )
+        {
+            update_( buffer_, 1 );
+        }
+    }
+
+private:
+
+    // the value of h before the avalanche, for the message so far
+
+    BOOST_CXX14_CONSTEXPR std::uint32_t final_() const
     {
-        BOOST_ASSERT( m_ == n_ % 16 );
+        std::size_t m = static_cast<std::size_t>( n_ % 16 );
 
         std::uint32_t h = 0;
 
@@ -195,33 +269,28 @@ public:
 
         h += static_cast<std::uint32_t>( n_ );
 
-        unsigned char const * p = buffer_;
+        h = tail( h, buffer_, m );
 
-        std::size_t m = m_;
+        return h;
+    }
 
-        while( m >= 4 )
-        {
-            h += detail::read32le( p ) * P3;
-            h = detail::rotl( h, 17 ) * P4;
+public:
 
-            p += 4;
-            m -= 4;
-        }
+    BOOST_CXX14_CONSTEXPR std::uint32_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( xxhash_32_impl, Scrub? "xxhash_32": "xxhash_32_noscrub" );
 
-        while( m > 0 )
-        {
-            h += p[0] * P5;
-            h = detail::rotl( h, 11 ) * P1;
+        std::size_t m = static_cast<std::size_t>( n_ % 16 );
 
-            ++p;
-            --m;
-        }
+        std::uint32_t h = final_();
 
-        n_ += 16 - m_;
-        m_ = 0;
+        n_ += 16 - m;
 
-        // clear buffered plaintext
-        detail::memset( buffer_, 0, 16 );
+        if( Scrub )
+        {
+            // clear buffered plaintext
+            detail::memset( buffer_, 0, 16 );
+        }
 
         // perturb state
         v1_ += h;
@@ -229,18 +298,113 @@ public:
         v3_ -= h;
         v4_ -= h;
 
-        // apply final mix
-        h ^= h >> 15;
-        h *= P2;
-        h ^= h >> 13;
-        h *= P3;
-        h ^= h >> 16;
+        return avalanche( h );
+    }
 
-        return h;
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR std::uint32_t snapshot_result() const
+    {
+        return avalanche( final_() );
+    }
+
+    // One-shot hashing, equivalent to constructing from seed and calling
+    // update( p, n ) and result(), but reading the input in place
+
+    BOOST_CXX14_CONSTEXPR static std::uint32_t hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        BOOST_HASH2_STATS_MESSAGES( xxhash_32_impl, Scrub? "xxhash_32": "xxhash_32_noscrub", 1, n );
+
+        std::uint32_t const s0 = static_cast<std::uint32_t>( seed );
+        std::uint32_t const s1 = static_cast<std::uint32_t>( seed >> 32 );
+
+        std::uint32_t h = 0;
+
+        if( n >= 16 )
+        {
+            std::uint32_t v1 = s0 + P1 + P2;
+            std::uint32_t v2 = s0 + P2;
+            std::uint32_t v3 = s0;
+            std::uint32_t v4 = s0 - P1;
+
+            if( s1 != 0 )
+            {
+                v1 = round( v1, s1 );
+                v2 = round( v2, s1 );
+                v3 = round( v3, s1 );
+                v4 = round( v4, s1 );
+            }
+
+            for( std::size_t i = n / 16; i > 0; --i, p += 16 )
+            {
+                v1 = round( v1, detail::read32le( p +  0 ) );
+                v2 = round( v2, detail::read32le( p +  4 ) );
+                v3 = round( v3, detail::read32le( p +  8 ) );
+                v4 = round( v4, detail::read32le( p + 12 ) );
+            }
+
+            h = detail::rotl( v1, 1 ) + detail::rotl( v2, 7 ) + detail::rotl( v3, 12 ) + detail::rotl( v4, 18 );
+        }
+        else
+        {
+            h = ( s1 != 0? round( s0, s1 ): s0 ) + P5;
+        }
+
+        h += static_cast<std::uint32_t>( n );
+
+        return avalanche( tail( h, p, n % 16 ) );
+    }
+
+    static std::uint32_t hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+private:
+
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u32( self.v1_ );
+        ar.u32( self.v2_ );
+        ar.u32( self.v3_ );
+        ar.u32( self.v4_ );
+
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 41;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        xxhash_32_impl tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
     }
 };
 
-class xxhash_64
+template<bool Scrub> class xxhash_64_impl
 {
 private:
 
@@ -258,8 +422,8 @@ private:
     std::uint64_t v4_ = static_cast<std::uint64_t>( 0 ) - P1;
 
     unsigned char buffer_[ 32 ] = {};
-    std::size_t m_ = 0; // == n_ % 32
 
+    // the number of bytes in buffer_ is n_ % 32
     std::uint64_t n_ = 0;
 
 private:
@@ -288,6 +452,62 @@ private:
         return acc;
     }
 
+    // processes the last m < 32 bytes; inlined so that the loops unroll
+    // when m is a constant, as in hash_fixed
+
+    BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR static std::uint64_t tail( std::uint64_t h, unsigned char const* p, std::size_t m )
+    {
+        while( m >= 8 )
+        {
+            std::uint64_t k1 = round( 0, detail::read64le( p ) );
+
+            h ^= k1;
+            h = detail::rotl( h, 27 ) * P1 + P4;
+
+            p += 8;
+            m -= 8;
+        }
+
+        while( m >= 4 )
+        {
+            h ^= static_cast<std::uint64_t>( detail::read32le( p ) ) * P1;
+            h = detail::rotl( h, 23 ) * P2 + P3;
+
+            p += 4;
+            m -= 4;
+        }
+
+        while( m > 0 )
+        {
+            h ^= p[0] * P5;
+            h = detail::rotl( h, 11 ) * P1;
+
+            ++p;
+            --m;
+        }
+
+        return h;
+    }
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t avalanche( std::uint64_t h )
+    {
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+
+        return h;
+    }
+
+    // The four lanes are independent, but each is a serial add-rotate-multiply
+    // chain, so the loop is bound by the multiply latency. 64 bit vector
+    // multiplication (AVX-512DQ VPMULLQ, or its AVX2 emulation) has several
+    // times the latency of the scalar one, which makes a SIMD version of this
+    // loop slower rather than faster; scalar code keeps the four chains in flight.
+    // The same holds for WebAssembly SIMD128, whose i64x2.mul engines lower to
+    // that emulation.
+
     BOOST_CXX14_CONSTEXPR void update_( unsigned char const * p, std::size_t k )
     {
         std::uint64_t v1 = v1_;
@@ -313,55 +533,56 @@ public:
 
     typedef std::uint64_t result_type;
 
-    xxhash_64() = default;
+    xxhash_64_impl() = default;
 
-    BOOST_CXX14_CONSTEXPR explicit xxhash_64( std::uint64_t seed )
+    BOOST_CXX14_CONSTEXPR explicit xxhash_64_impl( std::uint64_t seed )
     {
         init( seed );
     }
 
-    BOOST_CXX14_CONSTEXPR xxhash_64( unsigned char const * p, std::size_t n )
+    BOOST_CXX14_CONSTEXPR xxhash_64_impl( unsigned char const * p, std::size_t n )
     {
         if( n != 0 )
         {
+            BOOST_HASH2_STATS_SUSPEND();
             update( p, n );
             result();
+            BOOST_HASH2_STATS_RESUME();
         }
     }
 
     BOOST_CXX14_CONSTEXPR void update( unsigned char const* p, std::size_t n )
     {
-        BOOST_ASSERT( m_ == n_ % 32 );
+        BOOST_HASH2_STATS_UPDATE( xxhash_64_impl, Scrub? "xxhash_64": "xxhash_64_noscrub", n );
 
         if( n == 0 ) return;
 
+        std::size_t m = static_cast<std::size_t>( n_ % 32 );
+
         n_ += n;
 
-        if( m_ > 0 )
+        if( m > 0 )
         {
-            std::size_t k = 32 - m_;
+            std::size_t k = 32 - m;
 
             if( n < k )
             {
                 k = n;
             }
 
-            detail::memcpy( buffer_ + m_, p, k );
+            detail::memcpy( buffer_ + m, p, k );
 
             p += k;
             n -= k;
-            m_ += k;
+            m += k;
 
-            if( m_ < 32 ) return;
+            if( m < 32 ) return;
 
-            BOOST_ASSERT( m_ == 32 );
+            BOOST_ASSERT( m == 32 );
 
             update_( buffer_, 1 );
-            m_ = 0;
         }
 
-        BOOST_ASSERT( m_ == 0 );
-
         {
             std::size_t k = n / 32;
 
@@ -376,10 +597,7 @@ public:
         if( n > 0 )
         {
             detail::memcpy( buffer_, p, n );
-            m_ = n;
         }
-
-        BOOST_ASSERT( m_ == n_ % 32 );
     }
 
     void update( void const* pv, std::size_t n )
@@ -388,9 +606,43 @@ public:
         update( p, n );
     }
 
-    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    // equivalent to update( p, 8 ), where p points to the
+    // little-endian representation of w
+
+    BOOST_CXX14_CONSTEXPR void update_word( std::uint64_t w )
+    {
+        BOOST_HASH2_STATS_UPDATE( xxhash_64_impl, Scrub? "xxhash_64": "xxhash_64_noscrub", 8 );
+
+        std::size_t m = static_cast<std::size_t>( n_ % 32 );
+
+        if( m > 24 )
+        {
+            unsigned char tmp[ 8 ] = {};
+            detail::write64le( tmp, w );
+
+            BOOST_HASH2_STATS_SUSPEND();
+            update( tmp, 8 );
+            BOOST_HASH2_STATS_RESUME();
+            return;
+        }
+
+        detail::write64le( buffer_ + m, w );
+
+        n_ += 8;
+
+        if( m + 8 == 32 )
+        {
+            update_( buffer_, 1 );
+        }
+    }
+
+private:
+
+    // the value of h before the avalanche, for the message so far
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t final_() const
     {
-        BOOST_ASSERT( m_ == n_ % 32 );
+        std::size_t m = static_cast<std::size_t>( n_ % 32 );
 
         std::uint64_t h = 0;
 
@@ -410,59 +662,251 @@ public:
 
         h += n_;
 
-        unsigned char const * p = buffer_;
+        h = tail( h, buffer_, m );
 
-        std::size_t m = m_;
+        return h;
+    }
 
-        while( m >= 8 )
+public:
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t result()
+    {
+        BOOST_HASH2_STATS_RESULT( xxhash_64_impl, Scrub? "xxhash_64": "xxhash_64_noscrub" );
+
+        std::size_t m = static_cast<std::size_t>( n_ % 32 );
+
+        std::uint64_t h = final_();
+
+        n_ += 32 - m;
+
+        if( Scrub )
         {
-            std::uint64_t k1 = round( 0, detail::read64le( p ) );
+            // clear buffered plaintext
+            detail::memset( buffer_, 0, 32 );
+        }
 
-            h ^= k1;
-            h = detail::rotl( h, 27 ) * P1 + P4;
+        // perturb state
+        v1_ += h;
+        v2_ += h;
+        v3_ -= h;
+        v4_ -= h;
 
-            p += 8;
-            m -= 8;
+        return avalanche( h );
+    }
+
+    // the value result() would return, computed without modifying *this,
+    // so that an intermediate digest doesn't end the message
+
+    BOOST_CXX14_CONSTEXPR std::uint64_t snapshot_result() const
+    {
+        return avalanche( final_() );
+    }
+
+    // One-shot hashing, equivalent to constructing from seed and calling
+    // update( p, n ) and result(), but reading the input in place
+
+    BOOST_CXX14_CONSTEXPR static std::uint64_t hash( unsigned char const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        BOOST_HASH2_STATS_MESSAGES( xxhash_64_impl, Scrub? "xxhash_64": "xxhash_64_noscrub", 1, n );
+
+        std::uint64_t h = 0;
+
+        if( n >= 32 )
+        {
+            std::uint64_t v1 = seed + P1 + P2;
+            std::uint64_t v2 = seed + P2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - P1;
+
+            for( std::size_t i = n / 32; i > 0; --i, p += 32 )
+            {
+                v1 = round( v1, detail::read64le( p +  0 ) );
+                v2 = round( v2, detail::read64le( p +  8 ) );
+                v3 = round( v3, detail::read64le( p + 16 ) );
+                v4 = round( v4, detail::read64le( p + 24 ) );
+            }
+
+            h = detail::rotl( v1, 1 ) + detail::rotl( v2, 7 ) + detail::rotl( v3, 12 ) + detail::rotl( v4, 18 );
+
+            h = merge_round( h, v1 );
+            h = merge_round( h, v2 );
+            h = merge_round( h, v3 );
+            h = merge_round( h, v4 );
+        }
+        else
+        {
+            h = seed + P5;
         }
 
-        while( m >= 4 )
+        h += n;
+
+        return avalanche( tail( h, p, n % 32 ) );
+    }
+
+    static std::uint64_t hash( void const* p, std::size_t n, std::uint64_t seed = 0 )
+    {
+        return hash( static_cast<unsigned char const*>( p ), n, seed );
+    }
+
+    // Equivalent to a copy of *this after update( p, N ) and result(), for
+    // N known at compile time. At a block boundary, which includes a newly
+    // constructed object, the input is read in place, and the loops have
+    // constant trip counts, so that the code is straight-line
+
+    template<std::size_t N> BOOST_FORCEINLINE BOOST_CXX14_CONSTEXPR std::uint64_t hash_fixed( unsigned char const* p ) const
+    {
+        if( n_ % 32 != 0 )
         {
-            h ^= static_cast<std::uint64_t>( detail::read32le( p ) ) * P1;
-            h = detail::rotl( h, 23 ) * P2 + P3;
+            xxhash_64_impl h( *this );
 
-            p += 4;
-            m -= 4;
+            h.update( p, N );
+            return h.result();
         }
 
-        while( m > 0 )
+        BOOST_HASH2_STATS_MESSAGES( xxhash_64_impl, Scrub? "xxhash_64": "xxhash_64_noscrub", 1, N );
+
+        std::uint64_t const n = n_ + N;
+
+        std::uint64_t h = 0;
+
+        if( n >= 32 )
         {
-            h ^= p[0] * P5;
-            h = detail::rotl( h, 11 ) * P1;
+            std::uint64_t v1 = v1_;
+            std::uint64_t v2 = v2_;
+            std::uint64_t v3 = v3_;
+            std::uint64_t v4 = v4_;
 
-            ++p;
-            --m;
+            for( std::size_t i = 0; i < N / 32; ++i, p += 32 )
+            {
+                v1 = round( v1, detail::read64le( p +  0 ) );
+                v2 = round( v2, detail::read64le( p +  8 ) );
+                v3 = round( v3, detail::read64le( p + 16 ) );
+                v4 = round( v4, detail::read64le( p + 24 ) );
+            }
+
+            h = detail::rotl( v1, 1 ) + detail::rotl( v2, 7 ) + detail::rotl( v3, 12 ) + detail::rotl( v4, 18 );
+
+            h = merge_round( h, v1 );
+            h = merge_round( h, v2 );
+            h = merge_round( h, v3 );
+            h = merge_round( h, v4 );
+        }
+        else
+        {
+            h = v3_ + P5;
         }
 
-        n_ += 32 - m_;
-        m_ = 0;
+        h += n;
 
-        // clear buffered plaintext
-        detail::memset( buffer_, 0, 32 );
+        return avalanche( tail( h, p, N % 32 ) );
+    }
 
-        // perturb state
-        v1_ += h;
-        v2_ += h;
-        v3_ -= h;
-        v4_ -= h;
+private:
 
-        // apply final mix
-        h ^= h >> 33;
-        h *= P2;
-        h ^= h >> 29;
-        h *= P3;
-        h ^= h >> 32;
+    template<class Self, class Ar> BOOST_CXX14_CONSTEXPR static void visit_state( Self& self, Ar& ar )
+    {
+        ar.u64( self.v1_ );
+        ar.u64( self.v2_ );
+        ar.u64( self.v3_ );
+        ar.u64( self.v4_ );
 
-        return h;
+        ar.bytes( self.buffer_ );
+        ar.u64( self.n_ );
+    }
+
+public:
+
+    // the serialized state, for checkpointing and resuming
+
+    static constexpr std::size_t state_size = 73;
+
+    BOOST_CXX14_CONSTEXPR void save_state( unsigned char* p ) const
+    {
+        detail::state_writer ar( p );
+        visit_state( *this, ar );
+
+        BOOST_ASSERT( ar.size() == state_size );
+    }
+
+    BOOST_CXX14_CONSTEXPR bool load_state( unsigned char const* p, std::size_t n )
+    {
+        if( n != state_size ) return false;
+
+        xxhash_64_impl tmp;
+
+        detail::state_reader ar( p );
+        visit_state( tmp, ar );
+
+        if( !ar.ok() ) return false;
+
+        *this = tmp;
+        return true;
+    }
+};
+
+} // namespace detail
+
+class xxhash_32: public detail::xxhash_32_impl<true>
+{
+public:
+
+    xxhash_32() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit xxhash_32( std::uint64_t seed ): detail::xxhash_32_impl<true>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxhash_32( unsigned char const * p, std::size_t n ): detail::xxhash_32_impl<true>( p, n )
+    {
+    }
+};
+
+class xxhash_64: public detail::xxhash_64_impl<true>
+{
+public:
+
+    xxhash_64() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit xxhash_64( std::uint64_t seed ): detail::xxhash_64_impl<true>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxhash_64( unsigned char const * p, std::size_t n ): detail::xxhash_64_impl<true>( p, n )
+    {
+    }
+};
+
+// Variants that don't clear the buffered plaintext in result(), for
+// hashing non-secret data such as cache keys; the hash values are the
+// same as those of xxhash_32 and xxhash_64
+
+class xxhash_32_noscrub: public detail::xxhash_32_impl<false>
+{
+public:
+
+    xxhash_32_noscrub() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit xxhash_32_noscrub( std::uint64_t seed ): detail::xxhash_32_impl<false>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxhash_32_noscrub( unsigned char const * p, std::size_t n ): detail::xxhash_32_impl<false>( p, n )
+    {
+    }
+};
+
+class xxhash_64_noscrub: public detail::xxhash_64_impl<false>
+{
+public:
+
+    xxhash_64_noscrub() = default;
+
+    BOOST_CXX14_CONSTEXPR explicit xxhash_64_noscrub( std::uint64_t seed ): detail::xxhash_64_impl<false>( seed )
+    {
+    }
+
+    BOOST_CXX14_CONSTEXPR xxhash_64_noscrub( unsigned char const * p, std::size_t n ): detail::xxhash_64_impl<false>( p, n )
+    {
     }
 };
 
@@ -0,0 +1,571 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The boost.hash2 module. The headers are included in the global module
+// fragment, so that they, and Boost.ContainerHash, Boost.Describe and Mp11
+// with them, are parsed once, when the module is built; their public names
+// are then exported by using-declarations. The exported functions keep
+// their constexpr, and the templates are instantiated in the importing
+// translation units, as they are when the headers are included.
+//
+// json.hpp, async_hash.hpp and qat_accelerator.hpp, which require other
+// libraries, aren't part of the module; the headers can still be included
+// along with it.
+
+module;
+
+#include <boost/hash2/accelerator.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/any_hash.hpp>
+#include <boost/hash2/batch_find.hpp>
+#include <boost/hash2/binary_fuse_filter.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/block_index.hpp>
+#include <boost/hash2/bloom_filter.hpp>
+#include <boost/hash2/bucketer.hpp>
+#include <boost/hash2/buffered_hash.hpp>
+#include <boost/hash2/chunk_digest.hpp>
+#include <boost/hash2/combine_columns.hpp>
+#include <boost/hash2/concat_hash.hpp>
+#include <boost/hash2/concurrent_digest_map.hpp>
+#include <boost/hash2/consistent_hash.hpp>
+#include <boost/hash2/count_min_sketch.hpp>
+#include <boost/hash2/counting_hash.hpp>
+#include <boost/hash2/crc32.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/hash2/cuckoo_filter.hpp>
+#include <boost/hash2/dedup_index.hpp>
+#include <boost/hash2/delta_sync.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/digest_cache.hpp>
+#include <boost/hash2/digest_hasher.hpp>
+#include <boost/hash2/endian.hpp>
+#include <boost/hash2/executor.hpp>
+#include <boost/hash2/fast_hash.hpp>
+#include <boost/hash2/fastcdc.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/frame_checksum.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/ghash.hpp>
+#include <boost/hash2/has_constant_size.hpp>
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/hash160.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/hash_append_fwd.hpp>
+#include <boost/hash2/hash_append_parallel.hpp>
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/hash_column.hpp>
+#include <boost/hash2/hash_directory.hpp>
+#include <boost/hash2/hash_engine.hpp>
+#include <boost/hash2/hash_file.hpp>
+#include <boost/hash2/hash_fixed.hpp>
+#include <boost/hash2/hash_indices.hpp>
+#include <boost/hash2/hash_partition.hpp>
+#include <boost/hash2/hashed.hpp>
+#include <boost/hash2/hashing_copy.hpp>
+#include <boost/hash2/hashing_stream.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/hkdf.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/hmac_drbg.hpp>
+#include <boost/hash2/hyperloglog.hpp>
+#include <boost/hash2/is_contiguously_hashable.hpp>
+#include <boost/hash2/is_endian_independent.hpp>
+#include <boost/hash2/is_trivially_equality_comparable.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/literal.hpp>
+#include <boost/hash2/lsh.hpp>
+#include <boost/hash2/lthash.hpp>
+#include <boost/hash2/manifest_diff.hpp>
+#include <boost/hash2/mapped_digest_index.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/merkle_tree.hpp>
+#include <boost/hash2/minhash.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/mphf.hpp>
+#include <boost/hash2/multi_hash.hpp>
+#include <boost/hash2/multiset_hash.hpp>
+#include <boost/hash2/parallel_hash.hpp>
+#include <boost/hash2/pattern_matcher.hpp>
+#include <boost/hash2/pbkdf2.hpp>
+#include <boost/hash2/perfect_hash.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/prefix_cache.hpp>
+#include <boost/hash2/random_seed.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/recording_hash.hpp>
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/hash2/seeded_prototype.hpp>
+#include <boost/hash2/segmented_iterator.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/simhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/snapshot_result.hpp>
+#include <boost/hash2/stats.hpp>
+#include <boost/hash2/string_interner.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/toeplitz.hpp>
+#include <boost/hash2/type_hash.hpp>
+#include <boost/hash2/update_buffers.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/xxhash.hpp>
+
+export module boost.hash2;
+
+export namespace boost
+{
+namespace hash2
+{
+
+    // <boost/hash2/accelerator.hpp>
+    using hash2::offload_message;
+    using hash2::offload_batch;
+    using hash2::accelerator;
+    using hash2::digest_batch;
+
+    // <boost/hash2/adler32.hpp>
+    using hash2::adler32;
+
+    // <boost/hash2/aes_hash.hpp>
+    using hash2::aes_hash_128;
+
+    // <boost/hash2/any_hash.hpp>
+    using hash2::any_hash_registry;
+    using hash2::any_hash;
+    using hash2::swap;
+
+    // <boost/hash2/batch_find.hpp>
+    using hash2::batch_find;
+
+    // <boost/hash2/binary_fuse_filter.hpp>
+    using hash2::binary_fuse_filter;
+    using hash2::binary_fuse_filter_view;
+
+    // <boost/hash2/blake2.hpp>
+    using hash2::blake2b_512;
+    using hash2::blake2s_256;
+    using hash2::hmac_blake2b_512;
+    using hash2::hmac_blake2s_256;
+
+    // <boost/hash2/blake3.hpp>
+    using hash2::blake3;
+
+    // <boost/hash2/block_index.hpp>
+    using hash2::block_index;
+
+    // <boost/hash2/bloom_filter.hpp>
+    using hash2::bloom_filter;
+    using hash2::counting_bloom_filter;
+
+    // <boost/hash2/bucketer.hpp>
+    using hash2::bucketer;
+
+    // <boost/hash2/buffered_hash.hpp>
+    using hash2::buffered_hash;
+
+    // <boost/hash2/chunk_digest.hpp>
+    using hash2::chunk_record;
+    using hash2::chunk_digester;
+
+    // <boost/hash2/combine_columns.hpp>
+    using hash2::combine_columns;
+
+    // <boost/hash2/concat_hash.hpp>
+    using hash2::concat_hash;
+
+    // <boost/hash2/concurrent_digest_map.hpp>
+    using hash2::concurrent_digest_map;
+
+    // <boost/hash2/consistent_hash.hpp>
+    using hash2::jump_consistent_hash;
+    using hash2::rendezvous_hash;
+    using hash2::maglev_table;
+
+    // <boost/hash2/count_min_sketch.hpp>
+    using hash2::count_min_sketch;
+    using hash2::heavy_hitters;
+
+    // <boost/hash2/counting_hash.hpp>
+    using hash2::update_counts;
+    using hash2::counting_hash;
+
+    // <boost/hash2/crc32.hpp>
+    using hash2::crc32;
+
+    // <boost/hash2/crc32c.hpp>
+    using hash2::crc32c;
+
+    // <boost/hash2/crc64.hpp>
+    using hash2::crc64_xz;
+    using hash2::crc64_nvme;
+
+    // <boost/hash2/cuckoo_filter.hpp>
+    using hash2::cuckoo_filter;
+
+    // <boost/hash2/dedup_index.hpp>
+    using hash2::dedup_index;
+
+    // <boost/hash2/delta_sync.hpp>
+    using hash2::block_signature;
+    using hash2::delta_signature;
+    using hash2::delta_op;
+    using hash2::delta_matcher;
+
+    // <boost/hash2/digest.hpp>
+    using hash2::digest;
+    using hash2::to_chars;
+    using hash2::from_chars;
+    using hash2::to_base64;
+    using hash2::to_base64url;
+    using hash2::from_base64;
+    using hash2::from_base64url;
+    using hash2::to_string;
+    using hash2::operator==;
+    using hash2::operator!=;
+    using hash2::operator<;
+    using hash2::operator>;
+    using hash2::operator<=;
+    using hash2::operator>=;
+    using hash2::operator<<;
+
+    // <boost/hash2/digest_cache.hpp>
+    using hash2::file_identity;
+    using hash2::digest_cache;
+
+    // <boost/hash2/digest_hasher.hpp>
+    using hash2::digest_hasher;
+    using hash2::digest_equal;
+
+    // <boost/hash2/endian.hpp>
+    using hash2::endian;
+
+    // <boost/hash2/executor.hpp>
+    using hash2::task_executor;
+    using hash2::bulk_execute;
+    using hash2::thread_executor;
+    using hash2::work_stealing_executor;
+
+    // <boost/hash2/fast_hash.hpp>
+    using hash2::fast_hash;
+    using hash2::fast_hash_algorithm;
+
+    // <boost/hash2/fastcdc.hpp>
+    using hash2::fastcdc;
+
+    // <boost/hash2/flavor.hpp>
+    using hash2::default_flavor;
+    using hash2::little_endian_flavor;
+    using hash2::big_endian_flavor;
+    using hash2::default_flavor_32;
+    using hash2::little_endian_flavor_32;
+    using hash2::big_endian_flavor_32;
+    using hash2::unsized_flavor;
+
+    // <boost/hash2/fnv1a.hpp>
+    using hash2::fnv1a_32;
+    using hash2::fnv1a_64;
+    using hash2::fnv1a_64_wide;
+
+    // <boost/hash2/frame_checksum.hpp>
+    using hash2::lz4_content_checksum;
+    using hash2::zstd_content_checksum;
+    using hash2::write_frame_checksum;
+    using hash2::lz4_block_checksum;
+    using hash2::lz4_header_checksum;
+    using hash2::hashing_compress;
+
+    // <boost/hash2/get_integral_result.hpp>
+    using hash2::get_integral_result;
+    using hash2::get_result_words;
+
+    // <boost/hash2/ghash.hpp>
+    using hash2::ghash;
+
+    // <boost/hash2/has_constant_size.hpp>
+    using hash2::has_constant_size;
+
+    // <boost/hash2/hash.hpp>
+    using hash2::hash;
+    using hash2::key_equal;
+
+    // <boost/hash2/hash160.hpp>
+    using hash2::hash160;
+    using hash2::hash160_batch;
+
+    // <boost/hash2/hash_append.hpp>
+    using hash2::hash_append_range;
+    using hash2::hash_append_size;
+    using hash2::hash_append_sized_range;
+    using hash2::hash_append_unordered_range;
+    using hash2::hash_append_tag;
+    using hash2::hash_append;
+
+    // <boost/hash2/hash_append_parallel.hpp>
+    using hash2::hash_append_range_tree;
+
+    // <boost/hash2/hash_batch.hpp>
+    using hash2::hash_batch;
+
+    // <boost/hash2/hash_column.hpp>
+    using hash2::hash_column;
+
+    // <boost/hash2/hash_directory.hpp>
+    using hash2::hash_directory;
+
+    // <boost/hash2/hash_engine.hpp>
+    using hash2::hash_engine;
+
+    // <boost/hash2/hash_file.hpp>
+    using hash2::hash_file;
+    using hash2::file_backend;
+
+    // <boost/hash2/hash_fixed.hpp>
+    using hash2::hash_fixed;
+
+    // <boost/hash2/hash_indices.hpp>
+    using hash2::hash_indices;
+
+    // <boost/hash2/hash_partition.hpp>
+    using hash2::hash_partition;
+
+    // <boost/hash2/hashed.hpp>
+    using hash2::hashed;
+
+    // <boost/hash2/hashing_copy.hpp>
+    using hash2::hashing_copy;
+
+    // <boost/hash2/hashing_stream.hpp>
+    using hash2::hashing_streambuf;
+    using hash2::hashing_ostream;
+    using hash2::hash_stream;
+    using hash2::hashing_istreambuf;
+    using hash2::hashing_istream;
+
+    // <boost/hash2/highwayhash.hpp>
+    using hash2::highwayhash_64;
+    using hash2::highwayhash_128;
+    using hash2::highwayhash_256;
+
+    // <boost/hash2/hkdf.hpp>
+    using hash2::hkdf_extract;
+    using hash2::hkdf_expand;
+    using hash2::hkdf;
+
+    // <boost/hash2/hmac.hpp>
+    using hash2::hmac;
+    using hash2::hmac_key;
+    using hash2::verify;
+
+    // <boost/hash2/hmac_drbg.hpp>
+    using hash2::hmac_drbg;
+
+    // <boost/hash2/hyperloglog.hpp>
+    using hash2::hyperloglog;
+    using hash2::concurrent_hyperloglog;
+
+    // <boost/hash2/is_contiguously_hashable.hpp>
+    using hash2::is_contiguously_hashable;
+
+    // <boost/hash2/is_endian_independent.hpp>
+    using hash2::is_endian_independent;
+
+    // <boost/hash2/is_trivially_equality_comparable.hpp>
+    using hash2::is_trivially_equality_comparable;
+
+    // <boost/hash2/k12.hpp>
+    using hash2::k12;
+
+    // <boost/hash2/literal.hpp>
+    using hash2::literal;
+    using hash2::literal_equal;
+
+    // <boost/hash2/lsh.hpp>
+    using hash2::hyperplane_lsh;
+    using hash2::pstable_lsh;
+
+    // <boost/hash2/lthash.hpp>
+    using hash2::lthash;
+
+    // <boost/hash2/manifest_diff.hpp>
+    using hash2::manifest;
+    using hash2::manifest_difference;
+    using hash2::manifest_diff;
+
+    // <boost/hash2/mapped_digest_index.hpp>
+    using hash2::mapped_digest_index;
+
+    // <boost/hash2/md5.hpp>
+    using hash2::md5_128;
+    using hash2::hmac_md5_128;
+    using hash2::md5_128_multi;
+
+    // <boost/hash2/merkle_tree.hpp>
+    using hash2::merkle_tree;
+
+    // <boost/hash2/minhash.hpp>
+    using hash2::minhash;
+
+    // <boost/hash2/mix.hpp>
+    using hash2::mix32;
+    using hash2::mix64;
+
+    // <boost/hash2/mphf.hpp>
+    using hash2::mphf;
+    using hash2::mphf_view;
+
+    // <boost/hash2/multi_hash.hpp>
+    using hash2::multi_hash;
+
+    // <boost/hash2/multiset_hash.hpp>
+    using hash2::multiset_hash;
+
+    // <boost/hash2/parallel_hash.hpp>
+    using hash2::has_update_parallel;
+    using hash2::parallel_hash;
+
+    // <boost/hash2/pattern_matcher.hpp>
+    using hash2::pattern_match;
+    using hash2::pattern_matcher;
+
+    // <boost/hash2/pbkdf2.hpp>
+    using hash2::pbkdf2;
+
+    // <boost/hash2/perfect_hash.hpp>
+    using hash2::perfect_hash;
+    using hash2::make_perfect_hash;
+
+    // <boost/hash2/poly1305.hpp>
+    using hash2::poly1305;
+
+    // <boost/hash2/polymur.hpp>
+    using hash2::polymur_64;
+
+    // <boost/hash2/prefix_cache.hpp>
+    using hash2::prefix_cache;
+
+    // <boost/hash2/random_seed.hpp>
+    using hash2::random_seed_bytes;
+    using hash2::random_seed;
+    using hash2::randomly_seeded;
+
+    // <boost/hash2/rapidhash.hpp>
+    using hash2::rapidhash_64;
+
+    // <boost/hash2/recording_hash.hpp>
+    using hash2::recorded_span;
+    using hash2::recording_hash;
+
+    // <boost/hash2/reduce.hpp>
+    using hash2::reduce;
+    using hash2::fastmod;
+
+    // <boost/hash2/ripemd.hpp>
+    using hash2::ripemd_128;
+    using hash2::ripemd_160;
+    using hash2::hmac_ripemd_160;
+    using hash2::hmac_ripemd_128;
+    using hash2::ripemd_160_multi;
+
+    // <boost/hash2/rolling_hash.hpp>
+    using hash2::rabin_karp_64;
+    using hash2::buzhash_64;
+    using hash2::gear_hash_64;
+
+    // <boost/hash2/seeded_prototype.hpp>
+    using hash2::seeded_prototype;
+
+    // <boost/hash2/segmented_iterator.hpp>
+    using hash2::segmented_iterator_traits;
+    using hash2::is_segmented_iterator;
+
+    // <boost/hash2/sha1.hpp>
+    using hash2::sha1_160;
+    using hash2::hmac_sha1_160;
+
+    // <boost/hash2/sha2.hpp>
+    using hash2::sha2_256;
+    using hash2::sha2_224;
+    using hash2::sha2_512;
+    using hash2::sha2_384;
+    using hash2::sha2_512_224;
+    using hash2::sha2_512_256;
+    using hash2::hmac_sha2_256;
+    using hash2::hmac_sha2_224;
+    using hash2::hmac_sha2_512;
+    using hash2::hmac_sha2_384;
+    using hash2::hmac_sha2_512_224;
+    using hash2::hmac_sha2_512_256;
+    using hash2::sha2_256_multi;
+    using hash2::sha2_512_multi;
+    using hash2::hmac_sha2_256_multi;
+
+    // <boost/hash2/sha3.hpp>
+    using hash2::sha3_256;
+    using hash2::sha3_224;
+    using hash2::sha3_512;
+    using hash2::sha3_384;
+    using hash2::shake128;
+    using hash2::shake256;
+    using hash2::hmac_sha3_256;
+    using hash2::hmac_sha3_224;
+    using hash2::hmac_sha3_512;
+    using hash2::hmac_sha3_384;
+
+    // <boost/hash2/simhash.hpp>
+    using hash2::simhash;
+
+    // <boost/hash2/siphash.hpp>
+    using hash2::siphash_64;
+    using hash2::siphash_32;
+    using hash2::siphash13_64;
+    using hash2::siphash13_32;
+
+    // <boost/hash2/snapshot_result.hpp>
+    using hash2::snapshot_result;
+
+    // <boost/hash2/stats.hpp>
+    using hash2::algorithm_stats;
+    using hash2::stats_snapshot;
+
+    // <boost/hash2/string_interner.hpp>
+    using hash2::string_interner;
+    using hash2::interned_string;
+
+    // <boost/hash2/tabulation.hpp>
+    using hash2::tabulation_64;
+
+    // <boost/hash2/toeplitz.hpp>
+    using hash2::toeplitz_32;
+
+    // <boost/hash2/type_hash.hpp>
+    using hash2::type_hash_name;
+    using hash2::type_hash;
+    using hash2::stable_type_hash;
+
+    // <boost/hash2/update_buffers.hpp>
+    using hash2::update_buffers;
+
+    // <boost/hash2/xxh3.hpp>
+    using hash2::xxh3_64;
+    using hash2::xxh3_128;
+    using hash2::xxh3_64_noscrub;
+    using hash2::xxh3_128_noscrub;
+
+    // <boost/hash2/xxhash.hpp>
+    using hash2::xxhash_32;
+    using hash2::xxhash_64;
+    using hash2::xxhash_32_noscrub;
+    using hash2::xxhash_64_noscrub;
+
+} // namespace hash2
+} // namespace boost
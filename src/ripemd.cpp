@@ -0,0 +1,32 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The RIPEMD block functions for BOOST_HASH2_SEPARATE_COMPILATION
+
+#ifndef BOOST_HASH2_SEPARATE_COMPILATION
+# define BOOST_HASH2_SEPARATE_COMPILATION
+#endif
+
+#include <boost/hash2/ripemd.hpp>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+void ripemd_128_transform_compiled( ripemd_128& h, unsigned char const block[ 64 ] )
+{
+    h.transform_impl( block );
+}
+
+void ripemd_160_transform_compiled( unsigned char const block[ 64 ], std::uint32_t state[ 5 ] )
+{
+    ripemd_160::transform_impl( block, state );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
@@ -0,0 +1,34 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// The SHA-2 block functions for BOOST_HASH2_SEPARATE_COMPILATION,
+// with their x86 and ARM code paths selected at run time as in the
+// header-only mode
+
+#ifndef BOOST_HASH2_SEPARATE_COMPILATION
+# define BOOST_HASH2_SEPARATE_COMPILATION
+#endif
+
+#include <boost/hash2/sha2.hpp>
+
+namespace boost
+{
+namespace hash2
+{
+namespace detail
+{
+
+void sha2_256_transform_compiled( unsigned char const block[ 64 ], std::uint32_t state[ 8 ] )
+{
+    sha2_256_base::transform_impl( block, state );
+}
+
+void sha2_512_transform_compiled( unsigned char const block[ 128 ], std::uint64_t state[ 8 ] )
+{
+    sha2_512_base::transform_impl( block, state );
+}
+
+} // namespace detail
+} // namespace hash2
+} // namespace boost
@@ -0,0 +1,253 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/accelerator.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+// an engine that computes SHA-256 on the CPU, completing on the third
+// poll, or failing when told to
+
+class test_accelerator: public boost::hash2::accelerator
+{
+public:
+
+    std::size_t offload_size_;
+
+    bool fail_;
+
+    std::size_t batches_;
+    std::size_t messages_;
+
+    int polls_;
+
+    explicit test_accelerator( std::size_t offload_size, bool fail = false ):
+        offload_size_( offload_size ), fail_( fail ), batches_( 0 ), messages_( 0 ), polls_( 0 )
+    {
+    }
+
+    std::size_t offload_size() const noexcept override
+    {
+        return offload_size_;
+    }
+
+    bool submit( boost::hash2::offload_batch const& b, std::error_code& ) override
+    {
+        if( std::strcmp( b.algorithm, "sha256" ) != 0 ) return false;
+
+        BOOST_TEST_LE( b.key_size, 64u );
+        BOOST_TEST_EQ( b.digest_size, 32u );
+
+        ++batches_;
+        messages_ += b.size;
+
+        polls_ = 0;
+
+        return true;
+    }
+
+    bool poll( boost::hash2::offload_batch const& b, std::error_code& ec ) override
+    {
+        if( ++polls_ < 3 ) return false;
+
+        if( fail_ )
+        {
+            ec = std::make_error_code( std::errc::io_error );
+            return true;
+        }
+
+        for( std::size_t j = 0; j < b.size; ++j )
+        {
+            boost::hash2::digest<32> r;
+
+            if( b.hmac )
+            {
+                boost::hash2::hmac_sha2_256 h( b.key, b.key_size );
+                h.update( b.messages[ j ].data, b.messages[ j ].size );
+                r = h.result();
+            }
+            else
+            {
+                boost::hash2::sha2_256 h;
+                h.update( b.messages[ j ].data, b.messages[ j ].size );
+                r = h.result();
+            }
+
+            std::memcpy( b.messages[ j ].digest, r.data(), 32 );
+        }
+
+        return true;
+    }
+};
+
+static std::vector<std::string> make_messages()
+{
+    std::vector<std::string> v;
+
+    // runs of equal sizes, for the multi-buffer code, and sizes on
+    // both sides of the offload size
+
+    for( std::size_t i = 0; i < 40; ++i )
+    {
+        std::size_t n = i < 17? 24: i < 20? i: i < 30? 300: 1000 + i;
+        v.push_back( std::string( n, static_cast<char>( 'a' + i % 26 ) ) );
+    }
+
+    return v;
+}
+
+template<class H> static std::vector<typename H::result_type> reference( std::vector<std::string> const& v, unsigned char const* key = 0, std::size_t n = 0 )
+{
+    std::vector<typename H::result_type> r;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        H h( key, n );
+        h.update( v[ i ].data(), v[ i ].size() );
+
+        r.push_back( h.result() );
+    }
+
+    return r;
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    std::vector<std::string> const v = make_messages();
+
+    unsigned char key[ 100 ];
+
+    for( int i = 0; i < 100; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+    }
+
+    // CPU only
+
+    {
+        std::vector<digest<32>> r;
+        digest_batch<sha2_256>( v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<sha2_256>( v ) );
+    }
+
+    {
+        std::vector<digest<64>> r;
+        digest_batch<sha2_512>( v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<sha2_512>( v ) );
+    }
+
+    {
+        std::vector<digest<20>> r;
+        digest_batch<sha1_160>( v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<sha1_160>( v ) );
+    }
+
+    // the large messages are offloaded
+
+    {
+        test_accelerator acc( 256 );
+
+        std::vector<digest<32>> r;
+        digest_batch<sha2_256>( acc, v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<sha2_256>( v ) );
+
+        BOOST_TEST_EQ( acc.batches_, 1u );
+        BOOST_TEST_EQ( acc.messages_, 20u );
+    }
+
+    // HMAC, with keys shorter and longer than the block size
+
+    for( std::size_t n: { 0, 16, 64, 100 } )
+    {
+        test_accelerator acc( 256 );
+
+        std::vector<digest<32>> r;
+        digest_batch<hmac_sha2_256>( acc, key, n, v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<hmac_sha2_256>( v, key, n ) );
+
+        BOOST_TEST_EQ( acc.batches_, 1u );
+        BOOST_TEST_EQ( acc.messages_, 20u );
+    }
+
+    // small requests stay on the CPU
+
+    {
+        test_accelerator acc( 4096 );
+
+        std::vector<digest<32>> r;
+        digest_batch<sha2_256>( acc, v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<sha2_256>( v ) );
+
+        BOOST_TEST_EQ( acc.batches_, 0u );
+    }
+
+    // so do the algorithms the engine doesn't implement
+
+    {
+        test_accelerator acc( 0 );
+
+        std::vector<digest<64>> r;
+        digest_batch<sha2_512>( acc, v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<sha2_512>( v ) );
+
+        BOOST_TEST_EQ( acc.batches_, 0u );
+    }
+
+    {
+        test_accelerator acc( 0 );
+
+        std::vector<digest<32>> r;
+        digest_batch<hmac_sha3_256>( acc, key, 16, v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<hmac_sha3_256>( v, key, 16 ) );
+
+        BOOST_TEST_EQ( acc.batches_, 0u );
+    }
+
+    // a failure of the engine is recovered from on the CPU
+
+    {
+        test_accelerator acc( 0, true );
+
+        std::vector<digest<32>> r;
+        digest_batch<hmac_sha2_256>( acc, key, 32, v.begin(), v.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r == reference<hmac_sha2_256>( v, key, 32 ) );
+
+        BOOST_TEST_EQ( acc.batches_, 1u );
+        BOOST_TEST_EQ( acc.messages_, 40u );
+    }
+
+    // an empty batch
+
+    {
+        test_accelerator acc( 0 );
+
+        std::vector<std::string> e;
+        std::vector<digest<32>> r;
+
+        digest_batch<sha2_256>( acc, e.begin(), e.end(), std::back_inserter( r ) );
+
+        BOOST_TEST( r.empty() );
+        BOOST_TEST_EQ( acc.batches_, 0u );
+    }
+
+    return boost::report_errors();
+}
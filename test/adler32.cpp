@@ -0,0 +1,121 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/adler32.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using boost::hash2::adler32;
+
+static std::uint32_t adler32_reference( unsigned char const* p, std::size_t n )
+{
+    std::uint32_t a = 1, b = 0;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        a = ( a + p[ i ] ) % 65521;
+        b = ( b + a ) % 65521;
+    }
+
+    return ( b << 16 ) | a;
+}
+
+static std::uint32_t digest( unsigned char const* p, std::size_t n )
+{
+    adler32 h;
+
+    h.update( p, n );
+
+    return h.result();
+}
+
+static void test( char const* s, std::uint32_t r )
+{
+    adler32 h;
+
+    h.update( s, std::strlen( s ) );
+
+    BOOST_TEST_EQ( h.result(), r );
+}
+
+int main()
+{
+    test( "", 0x00000001 );
+    test( "a", 0x00620062 );
+    test( "Wikipedia", 0x11e60398 );
+    test( "123456789", 0x091e01de );
+    test( "The quick brown fox jumps over the lazy dog", 0x5bdc0fda );
+
+    // lengths around the block and reduction sizes, against a plain implementation
+
+    std::vector<unsigned char> v( 20000 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    {
+        std::size_t const lengths[] = { 1, 31, 32, 33, 63, 64, 65, 5551, 5552, 5553, 5600, 11104, 20000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint32_t const r = adler32_reference( v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                adler32 h;
+
+                h.update( v.data(), split );
+                h.update( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            // unaligned input
+
+            BOOST_TEST_EQ( digest( v.data() + 1, n - 1 ), adler32_reference( v.data() + 1, n - 1 ) );
+        }
+    }
+
+    // the largest sums, with all bytes 0xFF
+
+    {
+        std::vector<unsigned char> w( 20000, 0xFF );
+
+        BOOST_TEST_EQ( digest( w.data(), w.size() ), adler32_reference( w.data(), w.size() ) );
+    }
+
+    // combine
+
+    BOOST_TEST_EQ( adler32::combine( 0x12345678, 1, 0 ), 0x12345678 );
+
+    {
+        std::size_t const lengths[] = { 0, 1, 100, 5552, 20000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint32_t const r = digest( v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                if( split > n ) continue;
+
+                std::uint32_t const ra = digest( v.data(), split );
+                std::uint32_t const rb = digest( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( adler32::combine( ra, rb, n - split ), r );
+            }
+        }
+    }
+
+    return boost::report_errors();
+}
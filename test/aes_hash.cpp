@@ -0,0 +1,198 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+using boost::hash2::aes_hash_128;
+
+static std::string hash( std::uint64_t seed, unsigned char const* p, std::size_t n )
+{
+    aes_hash_128 h( seed );
+    h.update( p, n );
+
+    return to_string( h.result() );
+}
+
+int main()
+{
+    unsigned char buffer[ 1024 ];
+
+    for( int i = 0; i < 1024; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    // fixed test vectors, the same for the portable and the accelerated code
+
+    BOOST_TEST_EQ( hash( 0, buffer, 0 ), std::string( "6162590f8510115d984a718e352a5746" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 1 ), std::string( "6971163ad0f9c66733b7dd7a30b52e69" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 15 ), std::string( "ee50757c0cc437453d164b40fd6eadd2" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 16 ), std::string( "4a130da2907cf65d2e58b08efd560884" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 17 ), std::string( "a2e3eceb7b372429f5b92e054fd0ae75" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 63 ), std::string( "512f7dd60512ea2cd4d6e7d08c593983" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 64 ), std::string( "e6947d9397b17345b50972d49c02f315" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 65 ), std::string( "7430b17cdc95055490495289b0ed6ece" ) );
+    BOOST_TEST_EQ( hash( 0, buffer, 200 ), std::string( "5148d8563790b1de5ce74daa08fb15a0" ) );
+
+    BOOST_TEST_EQ( hash( 7, buffer, 0 ), std::string( "e679720b1401fbfbc8cd2d5739ae3df5" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 1 ), std::string( "55e01809c10777977f67725508f442f5" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 15 ), std::string( "0c9fa7fd957efdb6b48b9b1adbc02073" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 16 ), std::string( "105d23a5e718086e8a5e850e92f06086" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 17 ), std::string( "20fce4c0eece705be64dfbeee7627a97" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 63 ), std::string( "9687f0462b66c63a40260791470ba7d4" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 64 ), std::string( "abd23ec06c5d29afa6036f2ec38d773b" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 65 ), std::string( "8bd711b0386376da3363dff1567c8307" ) );
+    BOOST_TEST_EQ( hash( 7, buffer, 200 ), std::string( "ee3a5e7114a58ead12356a084de14f2c" ) );
+
+    // the default seed is 0
+
+    {
+        aes_hash_128 h1;
+        aes_hash_128 h2( 0 );
+
+        h1.update( buffer, 17 );
+        h2.update( buffer, 17 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // incremental updates, across the blocks, are equivalent to a single one
+
+    std::uint64_t const seeds[] = { 0, 1, 7, 0xbdd89aa982704029ull, 0xFFFFFFFFFFFFFFFFull };
+
+    for( std::uint64_t seed: seeds )
+    {
+        for( std::size_t n = 0; n <= 300; ++n )
+        {
+            aes_hash_128 h0( seed );
+            h0.update( buffer, n );
+
+            aes_hash_128::result_type const r = h0.result();
+
+            for( std::size_t k = 1; k < 100; k += 7 )
+            {
+                aes_hash_128 h( seed );
+
+                std::size_t i = 0;
+
+                for( ; i + k <= n; i += k )
+                {
+                    h.update( buffer + i, k );
+                }
+
+                h.update( buffer + i, n - i );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            {
+                aes_hash_128 h( seed );
+
+                h.update( buffer, n / 3 );
+                h.update( static_cast<void const*>( buffer + n / 3 ), n - n / 3 );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+        }
+    }
+
+    // zero padding doesn't produce collisions
+
+    {
+        unsigned char const zeros[ 64 ] = {};
+
+        for( std::size_t n = 0; n < 64; ++n )
+        {
+            BOOST_TEST_NE( hash( 0, zeros, n ), hash( 0, zeros, n + 1 ) );
+        }
+    }
+
+    // repeated calls to result
+
+    {
+        aes_hash_128 h1( 7 );
+        aes_hash_128 h2( 7 );
+
+        h1.update( buffer, 200 );
+        h2.update( buffer, 200 );
+
+        aes_hash_128::result_type const r1 = h1.result();
+        aes_hash_128::result_type const r2 = h1.result();
+        aes_hash_128::result_type const r3 = h1.result();
+
+        BOOST_TEST_NE( r1, r2 );
+        BOOST_TEST_NE( r2, r3 );
+
+        BOOST_TEST_EQ( h2.result(), r1 );
+        BOOST_TEST_EQ( h2.result(), r2 );
+        BOOST_TEST_EQ( h2.result(), r3 );
+    }
+
+    // byte sequence seeds
+
+    {
+        aes_hash_128 h1( buffer, 0 );
+        aes_hash_128 h2;
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        // a 16 byte seed is the key; 16 zero bytes are the same as seed 0
+
+        unsigned char const zeros[ 16 ] = {};
+
+        aes_hash_128 h1( zeros, 16 );
+        aes_hash_128 h2;
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        aes_hash_128 h1( buffer, 16 );
+        aes_hash_128 h2( buffer + 1, 16 );
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+    }
+
+    {
+        aes_hash_128 h1( buffer, 17 );
+        aes_hash_128 h2;
+
+        h2.update( buffer, 17 );
+        h2.result();
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        aes_hash_128 h1( buffer, 17 );
+        aes_hash_128 h2( buffer, 18 );
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,58 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v21[ 21 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v200[ 200 ] = {};
+
+    BOOST_CXX14_CONSTEXPR digest<16> r1 = {{ 117, 23, 210, 107, 173, 66, 92, 42, 205, 102, 220, 37, 217, 160, 67, 73 }};
+    BOOST_CXX14_CONSTEXPR digest<16> r2 = {{ 140, 164, 146, 201, 136, 100, 141, 7, 84, 156, 251, 235, 141, 165, 204, 231 }};
+    BOOST_CXX14_CONSTEXPR digest<16> r3 = {{ 116, 190, 132, 47, 146, 24, 124, 175, 87, 128, 194, 235, 171, 179, 206, 177 }};
+
+    TEST_EQ( test<aes_hash_128>( 0, v21 ), r1 );
+    TEST_EQ( test<aes_hash_128>( 0, v45 ), r2 );
+    TEST_EQ( test<aes_hash_128>( 0, v200 ), r3 );
+
+    BOOST_CXX14_CONSTEXPR digest<16> r4 = {{ 169, 21, 174, 67, 249, 168, 112, 166, 225, 104, 54, 102, 177, 110, 184, 91 }};
+    BOOST_CXX14_CONSTEXPR digest<16> r5 = {{ 242, 72, 10, 160, 110, 139, 35, 142, 70, 29, 244, 242, 39, 106, 147, 45 }};
+    BOOST_CXX14_CONSTEXPR digest<16> r6 = {{ 243, 15, 242, 54, 60, 3, 92, 94, 115, 240, 177, 202, 41, 122, 68, 235 }};
+
+    TEST_EQ( test<aes_hash_128>( 7, v21 ), r4 );
+    TEST_EQ( test<aes_hash_128>( 7, v45 ), r5 );
+    TEST_EQ( test<aes_hash_128>( 7, v200 ), r6 );
+
+    return boost::report_errors();
+}
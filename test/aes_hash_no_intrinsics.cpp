@@ -0,0 +1,9 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Runs the aes_hash_128 tests through the portable code path
+
+#define BOOST_HASH2_DISABLE_INTRINSICS
+
+#include "aes_hash.cpp"
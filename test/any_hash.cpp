@@ -0,0 +1,202 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/any_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::any_hash;
+using boost::hash2::any_hash_registry;
+
+static unsigned char buffer[ 32768 ];
+
+template<class R> std::vector<unsigned char> to_bytes( R const& r )
+{
+    return std::vector<unsigned char>( r.data(), r.data() + r.size() );
+}
+
+std::vector<unsigned char> to_bytes( std::uint64_t r )
+{
+    std::vector<unsigned char> v;
+
+    for( int i = 0; i < 8; ++i )
+    {
+        v.push_back( static_cast<unsigned char>( r >> ( i * 8 ) ) );
+    }
+
+    return v;
+}
+
+std::vector<unsigned char> to_bytes( std::uint32_t r )
+{
+    std::vector<unsigned char> v;
+
+    for( int i = 0; i < 4; ++i )
+    {
+        v.push_back( static_cast<unsigned char>( r >> ( i * 8 ) ) );
+    }
+
+    return v;
+}
+
+// compares h against H, with writes of the given sizes
+
+template<class H> void test( any_hash h, H h2 )
+{
+    std::size_t const sizes[] = { 1, 3, 8, 0, 7, 64, 2, 4095, 4096, 4097, 5, 1, 300, 9000, 17, 4000, 90, 6 };
+
+    std::size_t k = 0;
+
+    for( std::size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i )
+    {
+        h.update( buffer + k, sizes[ i ] );
+        h2.update( buffer + k, sizes[ i ] );
+
+        k += sizes[ i ];
+    }
+
+    // copies continue independently
+
+    any_hash h3( h );
+    H h4( h2 );
+
+    std::vector<unsigned char> r = to_bytes( h2.result() );
+
+    BOOST_TEST_EQ( h.result_size(), r.size() );
+    BOOST_TEST( h.result() == r );
+
+    h3.update( buffer, 5 );
+    h4.update( buffer, 5 );
+
+    BOOST_TEST( h3.result() == to_bytes( h4.result() ) );
+    BOOST_TEST( h.result() != h3.result() );
+}
+
+int main()
+{
+    for( std::size_t i = 0; i < sizeof( buffer ); ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    using namespace boost::hash2;
+
+    // wrapping
+
+    test( any_hash( sha2_256() ), sha2_256() );
+    test( any_hash( md5_128( 7 ) ), md5_128( 7 ) );
+    test( any_hash( fnv1a_64() ), fnv1a_64() );
+    test( any_hash( xxhash_32( 5 ) ), xxhash_32( 5 ) );
+
+    // the builtin registry
+
+    any_hash_registry const& reg = any_hash_registry::builtin();
+
+    test( reg.make( "sha2_256" ), sha2_256() );
+    test( reg.make( "sha2_512_224" ), sha2_512_224() );
+    test( reg.make( "sha3_384" ), sha3_384() );
+    test( reg.make( "ripemd_160" ), ripemd_160() );
+    test( reg.make( "blake2b_512" ), blake2b_512() );
+    test( reg.make( "blake3" ), blake3() );
+
+    test( reg.make( 0x12 ), sha2_256() );
+    test( reg.make( 0x13 ), sha2_512() );
+    test( reg.make( 0x11 ), sha1_160() );
+    test( reg.make( 0xD5 ), md5_128() );
+    test( reg.make( 0x16 ), sha3_256() );
+    test( reg.make( 0xB260 ), blake2s_256() );
+
+    {
+        unsigned char const key[] = { 1, 2, 3, 4, 5 };
+
+        test( reg.make( "sha1_160", key, sizeof( key ) ), sha1_160( key, sizeof( key ) ) );
+        test( reg.make( 0x1053, key, sizeof( key ) ), ripemd_160( key, sizeof( key ) ) );
+    }
+
+    BOOST_TEST( reg.contains( "sha2_384" ) );
+    BOOST_TEST( reg.contains( 0x20 ) );
+
+    BOOST_TEST( !reg.contains( "sha2_257" ) );
+    BOOST_TEST( !reg.contains( 0x7777 ) );
+    BOOST_TEST( !reg.contains( any_hash_registry::no_code ) );
+
+    BOOST_TEST( !reg.make( "sha2_257" ) );
+    BOOST_TEST( !reg.make( 0x7777 ) );
+
+    BOOST_TEST_EQ( reg.names().size(), 17u );
+    BOOST_TEST_EQ( reg.names().front(), std::string( "md5_128" ) );
+
+    // a user-defined registry
+
+    {
+        any_hash_registry r;
+
+        BOOST_TEST( r.names().empty() );
+
+        BOOST_TEST( r.add<fnv1a_64>( "fnv1a_64" ) );
+        BOOST_TEST( r.add<xxhash_64>( "xxhash_64", 0xB3E2 ) );
+
+        BOOST_TEST( !r.add<fnv1a_32>( "fnv1a_64" ) );
+        BOOST_TEST( !r.add<fnv1a_32>( "fnv1a_32", 0xB3E2 ) );
+
+        BOOST_TEST( r.add<fnv1a_32>( "fnv1a_32" ) );
+
+        test( r.make( "fnv1a_64" ), fnv1a_64() );
+        test( r.make( "fnv1a_32" ), fnv1a_32() );
+        test( r.make( 0xB3E2 ), xxhash_64() );
+
+        BOOST_TEST( !r.make( "sha2_256" ) );
+
+        BOOST_TEST_EQ( r.names().size(), 3u );
+    }
+
+    // empty any_hash, assignment, swap
+
+    {
+        any_hash h;
+        BOOST_TEST( !h );
+
+        any_hash h2 = reg.make( "sha2_256" );
+        BOOST_TEST( h2 );
+
+        h = h2;
+        BOOST_TEST( h );
+
+        h.update( buffer, 10 );
+
+        any_hash h3;
+        swap( h, h3 );
+
+        BOOST_TEST( !h );
+        BOOST_TEST( h3 );
+
+        sha2_256 h4;
+        h4.update( buffer, 10 );
+
+        BOOST_TEST( h3.result() == to_bytes( h4.result() ) );
+        BOOST_TEST( h2.result() == to_bytes( sha2_256().result() ) );
+    }
+
+    // hash_append
+
+    {
+        any_hash h = reg.make( "sha2_256" );
+        sha2_256 h2;
+
+        std::vector<std::string> v{ "one", "two", "three" };
+
+        hash_append( h, {}, v );
+        hash_append( h2, {}, v );
+
+        BOOST_TEST( h.result() == to_bytes( h2.result() ) );
+    }
+
+    return boost::report_errors();
+}
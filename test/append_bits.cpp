@@ -0,0 +1,168 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/recording_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <bitset>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::recording_hash;
+using boost::hash2::fnv1a_64;
+
+// the expected encoding: eight bits to a byte, least significant first
+
+template<class V> std::vector<unsigned char> packed( V const& v, std::size_t n )
+{
+    std::vector<unsigned char> r( ( n + 7 ) / 8 );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( v[ i ] ) r[ i / 8 ] |= static_cast<unsigned char>( 1u << ( i % 8 ) );
+    }
+
+    return r;
+}
+
+static bool bit( std::size_t i )
+{
+    return ( ( i * 0x9E3779B97F4A7C15ull ) >> 61 ) & 1;
+}
+
+void test_vector( std::size_t n )
+{
+    std::vector<bool> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = bit( i );
+    }
+
+    recording_hash<fnv1a_64> h;
+    boost::hash2::hash_append( h, {}, v );
+
+    std::vector<unsigned char> expected = packed( v, n );
+
+    {
+        recording_hash<fnv1a_64> h2;
+        boost::hash2::hash_append_size( h2, {}, n );
+
+        expected.insert( expected.end(), h2.bytes().begin(), h2.bytes().end() );
+    }
+
+    BOOST_TEST( h.bytes() == expected );
+
+    // the bits past the end don't matter
+
+    std::vector<bool> v2( v );
+    v2.resize( n + 100, true );
+    v2.resize( n );
+
+    fnv1a_64 h3;
+    boost::hash2::hash_append( h3, {}, v2 );
+
+    BOOST_TEST_EQ( h3.result(), h.result() );
+}
+
+template<std::size_t N> void test_bitset()
+{
+    std::bitset<N> b;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        b[ i ] = bit( i );
+    }
+
+    recording_hash<fnv1a_64> h;
+    boost::hash2::hash_append( h, {}, b );
+
+    if( N == 0 )
+    {
+        BOOST_TEST_EQ( h.bytes().size(), 1u );
+    }
+    else
+    {
+        BOOST_TEST( h.bytes() == packed( b, N ) );
+    }
+
+    // a vector<bool> with the same bits hashes the same bytes, plus its size
+
+    std::vector<bool> v( N );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        v[ i ] = b[ i ];
+    }
+
+    recording_hash<fnv1a_64> h2;
+    boost::hash2::hash_append( h2, {}, v );
+
+    if( N != 0 )
+    {
+        BOOST_TEST( std::vector<unsigned char>( h2.bytes().begin(), h2.bytes().begin() + h.bytes().size() ) == h.bytes() );
+    }
+}
+
+int main()
+{
+    std::size_t const ns[] = { 0, 1, 7, 8, 9, 31, 32, 33, 63, 64, 65, 127, 128, 129, 1000, 2047, 2048, 2049, 100001 };
+
+    for( std::size_t n: ns )
+    {
+        test_vector( n );
+    }
+
+    test_bitset<0>();
+    test_bitset<1>();
+    test_bitset<7>();
+    test_bitset<8>();
+    test_bitset<9>();
+    test_bitset<63>();
+    test_bitset<64>();
+    test_bitset<65>();
+    test_bitset<1000>();
+    test_bitset<5000>();
+
+    // distinct values, distinct hashes
+
+    {
+        std::vector<bool> v1( 100 ), v2( 100 ), v3( 101 );
+        v2[ 99 ] = true;
+
+        boost::hash2::xxhash_64 h1, h2, h3;
+
+        boost::hash2::hash_append( h1, {}, v1 );
+        boost::hash2::hash_append( h2, {}, v2 );
+        boost::hash2::hash_append( h3, {}, v3 );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+        BOOST_TEST_NE( h1.result(), h3.result() );
+    }
+
+    // the packed encoding is a deliberate change from the range encoding,
+    // one byte per element, which hash_append_range still uses
+
+    {
+        std::vector<bool> v( 20 );
+        v[ 3 ] = true;
+
+        recording_hash<fnv1a_64> h1;
+        boost::hash2::hash_append( h1, {}, v );
+
+        recording_hash<fnv1a_64> h2;
+        boost::hash2::hash_append_range( h2, {}, v.begin(), v.end() );
+        boost::hash2::hash_append_size( h2, {}, v.size() );
+
+        BOOST_TEST_EQ( h1.bytes().size(), 3u + 8u );
+        BOOST_TEST_EQ( h2.bytes().size(), 20u + 8u );
+
+        BOOST_TEST( h1.bytes() != h2.bytes() );
+    }
+
+    return boost::report_errors();
+}
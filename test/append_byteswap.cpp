@@ -0,0 +1,92 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Ranges of integers, hashed with a non-native byte order
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/recording_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::recording_hash;
+
+enum class E: std::int32_t
+{
+};
+
+template<class H, class Flavor, class T> void test( std::size_t n )
+{
+    std::vector<T> v;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v.push_back( static_cast<T>( i * 0x9E3779B97F4A7C15ull + ( i >> 3 ) ) );
+    }
+
+    // the range, and the elements one at a time
+
+    recording_hash<H> h1;
+    boost::hash2::hash_append_range( h1, Flavor(), v.data(), v.data() + n );
+
+    recording_hash<H> h2;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        boost::hash2::hash_append( h2, Flavor(), v[ i ] );
+    }
+
+    BOOST_TEST( h1.bytes() == h2.bytes() );
+
+    auto r = h2.result();
+    BOOST_TEST( h1.result() == r );
+
+    // const elements, and the container
+
+    H h3;
+    boost::hash2::hash_append_range( h3, Flavor(), static_cast<T const*>( v.data() ), static_cast<T const*>( v.data() ) + n );
+
+    BOOST_TEST( h3.result() == r );
+
+    H h4;
+    boost::hash2::hash_append( h4, Flavor(), v );
+
+    H h5;
+    boost::hash2::hash_append_range( h5, Flavor(), v.begin(), v.end() );
+    boost::hash2::hash_append_size( h5, Flavor(), n );
+
+    BOOST_TEST( h4.result() == h5.result() );
+}
+
+template<class H, class Flavor> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 255, 256, 257, 1000, 4099 };
+
+    for( std::size_t n: sizes )
+    {
+        test<H, Flavor, std::uint16_t>( n );
+        test<H, Flavor, std::int16_t>( n );
+        test<H, Flavor, std::uint32_t>( n );
+        test<H, Flavor, std::int32_t>( n );
+        test<H, Flavor, std::uint64_t>( n );
+        test<H, Flavor, std::int64_t>( n );
+        test<H, Flavor, char16_t>( n );
+        test<H, Flavor, char32_t>( n );
+        test<H, Flavor, E>( n );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_64, boost::hash2::big_endian_flavor>();
+    test<boost::hash2::fnv1a_64, boost::hash2::little_endian_flavor>();
+    test<boost::hash2::xxhash_64, boost::hash2::big_endian_flavor>();
+    test<boost::hash2::xxhash_64, boost::hash2::little_endian_flavor>();
+
+    return boost::report_errors();
+}
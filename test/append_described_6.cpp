@@ -0,0 +1,184 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/recording_hash.hpp>
+#include <boost/describe/class.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_DESCRIBE_CXX14)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_DESCRIBE_CXX14 is not defined" )
+int main() {}
+
+#elif defined(BOOST_MSVC) && BOOST_MSVC >= 1910 && BOOST_MSVC < 1930
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_MSVC is 191x or 192x" )
+int main() {}
+
+#else
+
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <cstring>
+
+// Adjacent contiguously hashable members are passed to a single update call
+
+struct X
+{
+    std::uint32_t a;
+    std::uint32_t b;
+    std::uint16_t c;
+    std::uint64_t d; // preceded by padding
+    float e; // not contiguously hashable
+    std::uint8_t f[ 3 ];
+    std::uint8_t g;
+    std::string h;
+    std::uint8_t i;
+};
+
+BOOST_DESCRIBE_STRUCT(X, (), (a, b, c, d, e, f, g, h, i))
+
+class counting_hash
+{
+private:
+
+    boost::hash2::fnv1a_64 h_;
+
+public:
+
+    using result_type = std::uint64_t;
+
+    int calls = 0;
+
+    counting_hash() = default;
+
+    explicit counting_hash( std::uint64_t seed ): h_( seed )
+    {
+    }
+
+    counting_hash( unsigned char const* p, std::size_t n ): h_( p, n )
+    {
+    }
+
+    void update( void const* p, std::size_t n )
+    {
+        ++calls;
+        h_.update( p, n );
+    }
+
+    result_type result()
+    {
+        return h_.result();
+    }
+};
+
+template<class Flavor> void test( int calls )
+{
+    Flavor fl;
+
+    X x = { 1, 2, 3, 4, -0.0f, { 5, 6, 7 }, 8, "x", 9 };
+
+    counting_hash h1;
+
+    hash_append( h1, fl, x );
+
+    counting_hash h2;
+
+    hash_append( h2, fl, x.a );
+    hash_append( h2, fl, x.b );
+    hash_append( h2, fl, x.c );
+    hash_append( h2, fl, x.d );
+    hash_append( h2, fl, x.e );
+    hash_append( h2, fl, x.f );
+    hash_append( h2, fl, x.g );
+    hash_append( h2, fl, x.h );
+    hash_append( h2, fl, x.i );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+    BOOST_TEST_EQ( h1.calls, calls );
+}
+
+// a hash with trace_begin and trace_end gets one span per member,
+// as the members aren't fused for it
+
+template<class Flavor> void test_trace()
+{
+    using boost::hash2::recording_hash;
+    using boost::hash2::fnv1a_64;
+
+    Flavor fl;
+
+    X x = { 1, 2, 3, 4, -0.0f, { 5, 6, 7 }, 8, "x", 9 };
+
+    recording_hash<fnv1a_64> h1;
+
+    hash_append( h1, fl, x );
+
+    recording_hash<fnv1a_64> h2;
+
+    hash_append( h2, fl, x.a );
+    hash_append( h2, fl, x.b );
+    hash_append( h2, fl, x.c );
+    hash_append( h2, fl, x.d );
+    hash_append( h2, fl, x.e );
+    hash_append( h2, fl, x.f );
+    hash_append( h2, fl, x.g );
+    hash_append( h2, fl, x.h );
+    hash_append( h2, fl, x.i );
+
+    BOOST_TEST( h1.bytes() == h2.bytes() );
+
+    // the spans of h1 are those of h2, nested in the described_class span
+
+    BOOST_TEST_EQ( h1.spans().size(), h2.spans().size() + 1 );
+
+    if( h1.spans().size() == h2.spans().size() + 1 )
+    {
+        BOOST_TEST_EQ( std::strcmp( h1.spans()[ 0 ].name, "described_class" ), 0 );
+
+        for( std::size_t i = 0; i < h2.spans().size(); ++i )
+        {
+            auto const& s1 = h1.spans()[ i + 1 ];
+            auto const& s2 = h2.spans()[ i ];
+
+            BOOST_TEST_EQ( std::strcmp( s1.name, s2.name ), 0 );
+            BOOST_TEST_EQ( s1.first, s2.first );
+            BOOST_TEST_EQ( s1.last, s2.last );
+            BOOST_TEST_EQ( s1.depth, s2.depth + 1 );
+        }
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // { a, b, c }, { d }, { e }, { f, g }, h (two calls), { i }
+
+    if( endian::native == endian::little )
+    {
+        test<little_endian_flavor>( 7 );
+        test<big_endian_flavor>( 9 );
+    }
+    else
+    {
+        test<little_endian_flavor>( 9 );
+        test<big_endian_flavor>( 7 );
+    }
+
+    test<default_flavor>( 7 );
+
+    test_trace<little_endian_flavor>();
+    test_trace<big_endian_flavor>();
+    test_trace<default_flavor>();
+
+    return boost::report_errors();
+}
+
+#endif
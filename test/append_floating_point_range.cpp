@@ -0,0 +1,105 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// Ranges of float and double, hashed through a buffer
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/recording_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::recording_hash;
+
+template<class T> std::vector<T> make_vector( std::size_t n, bool negative_zero )
+{
+    typedef std::numeric_limits<T> L;
+
+    T const special[] = { T( 0 ), -T( 0 ), T( 1 ), -T( 1 ), L::infinity(), -L::infinity(), L::quiet_NaN(), L::min(), L::denorm_min(), L::max(), L::epsilon() };
+    std::size_t const M = sizeof( special ) / sizeof( special[ 0 ] );
+
+    std::vector<T> v;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        T x = i % 3 == 0? special[ i / 3 % M ]: static_cast<T>( static_cast<double>( i * 0x9E3779B97F4A7C15ull ) / -7.0 );
+
+        if( x == 0 )
+        {
+            x = negative_zero? -T( 0 ): T( 0 );
+        }
+
+        v.push_back( x );
+    }
+
+    return v;
+}
+
+template<class H, class Flavor, class T> void test( std::size_t n )
+{
+    std::vector<T> v = make_vector<T>( n, false );
+
+    // the range, and the elements one at a time
+
+    recording_hash<H> h1;
+    boost::hash2::hash_append_range( h1, Flavor(), v.data(), v.data() + n );
+
+    recording_hash<H> h2;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        boost::hash2::hash_append( h2, Flavor(), v[ i ] );
+    }
+
+    BOOST_TEST( h1.bytes() == h2.bytes() );
+
+    auto r = h2.result();
+    BOOST_TEST( h1.result() == r );
+
+    // const elements
+
+    H h3;
+    boost::hash2::hash_append_range( h3, Flavor(), static_cast<T const*>( v.data() ), static_cast<T const*>( v.data() ) + n );
+
+    BOOST_TEST( h3.result() == r );
+
+    // -0.0 and +0.0 hash the same
+
+    std::vector<T> w = make_vector<T>( n, true );
+
+    H h4;
+    boost::hash2::hash_append( h4, Flavor(), v );
+
+    H h5;
+    boost::hash2::hash_append( h5, Flavor(), w );
+
+    BOOST_TEST( h4.result() == h5.result() );
+}
+
+template<class H, class Flavor> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 3, 7, 8, 15, 16, 17, 63, 64, 65, 127, 128, 129, 1000, 4099 };
+
+    for( std::size_t n: sizes )
+    {
+        test<H, Flavor, float>( n );
+        test<H, Flavor, double>( n );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_64, boost::hash2::default_flavor>();
+    test<boost::hash2::fnv1a_64, boost::hash2::little_endian_flavor>();
+    test<boost::hash2::fnv1a_64, boost::hash2::big_endian_flavor>();
+    test<boost::hash2::xxhash_64, boost::hash2::default_flavor>();
+    test<boost::hash2::xxhash_64, boost::hash2::big_endian_flavor>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,109 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/json.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/json/parse.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace json = boost::json;
+
+template<class Hash = boost::hash2::fnv1a_64, class T> typename Hash::result_type hv( T const& v )
+{
+    Hash h;
+    boost::hash2::hash_append( h, {}, v );
+
+    return h.result();
+}
+
+static std::uint64_t hv( char const* s )
+{
+    return hv( json::parse( s ) );
+}
+
+int main()
+{
+    using boost::hash2::detail::has_tag_invoke;
+
+    BOOST_TEST( has_tag_invoke<json::value>::value );
+    BOOST_TEST( has_tag_invoke<json::object>::value );
+    BOOST_TEST( has_tag_invoke<json::array>::value );
+    BOOST_TEST( has_tag_invoke<json::string>::value );
+
+    // types convertible to json::value are unaffected
+
+    BOOST_TEST( !has_tag_invoke<int>::value );
+    BOOST_TEST( !has_tag_invoke<std::string>::value );
+
+    // the members of objects are unordered
+
+    BOOST_TEST_EQ( hv( R"({"a":1,"b":[true,null,"x"]})" ), hv( R"({"b":[true,null,"x"],"a":1})" ) );
+    BOOST_TEST_EQ( hv( R"({"x":{"p":1,"q":2},"y":3})" ), hv( R"({"y":3,"x":{"q":2,"p":1}})" ) );
+
+    // the elements of arrays aren't
+
+    BOOST_TEST_NE( hv( "[1,2]" ), hv( "[2,1]" ) );
+
+    // whitespace doesn't matter, as the values are hashed, not the text
+
+    BOOST_TEST_EQ( hv( R"( { "a" : [ 1 , 2 ] } )" ), hv( R"({"a":[1,2]})" ) );
+
+    // keys and values are distinguished
+
+    BOOST_TEST_NE( hv( R"({"a":"b"})" ), hv( R"({"b":"a"})" ) );
+    BOOST_TEST_NE( hv( R"({"a":1,"b":2})" ), hv( R"({"a":2,"b":1})" ) );
+
+    // and so are the kinds
+
+    {
+        std::vector<std::uint64_t> v;
+
+        for( char const* s: { "null", "false", "true", "0", "-1", "0.0", "\"\"", "\"0\"", "[]", "[null]", "{}", "{\"\":null}", "[[]]", "[[],[]]", "[[[]]]" } )
+        {
+            v.push_back( hv( s ) );
+        }
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            for( std::size_t j = 0; j < i; ++j )
+            {
+                BOOST_TEST_NE( v[ i ], v[ j ] );
+            }
+        }
+    }
+
+    // integers are hashed by value, however they are stored; doubles aren't
+    // integers
+
+    BOOST_TEST_EQ( hv( json::value( std::int64_t( 5 ) ) ), hv( json::value( std::uint64_t( 5 ) ) ) );
+    BOOST_TEST_NE( hv( json::value( std::int64_t( -5 ) ) ), hv( json::value( std::uint64_t( -5 ) ) ) );
+    BOOST_TEST_NE( hv( "1" ), hv( "1.0" ) );
+    BOOST_TEST_EQ( hv( "0.0" ), hv( "-0.0" ) );
+    BOOST_TEST_EQ( hv( "18446744073709551615" ), hv( json::value( std::uint64_t( -1 ) ) ) );
+
+    // a string, array or object hashes as the value holding it
+
+    {
+        json::value v = json::parse( R"({"a":[1,"two",{"three":3}]})" );
+
+        BOOST_TEST_EQ( hv( v.as_object() ), hv( v ) );
+        BOOST_TEST_EQ( hv( v.at( "a" ).as_array() ), hv( v.at( "a" ) ) );
+        BOOST_TEST_EQ( hv( v.at( "a" ).at( 1 ).as_string() ), hv( v.at( "a" ).at( 1 ) ) );
+    }
+
+    // the same holds for other hash algorithms
+
+    {
+        json::value v1 = json::parse( R"({"id":17,"tags":["a","b"],"meta":{"x":null,"y":false}})" );
+        json::value v2 = json::parse( R"({"meta":{"y":false,"x":null},"tags":["a","b"],"id":17})" );
+
+        BOOST_TEST( hv<boost::hash2::sha2_256>( v1 ) == hv<boost::hash2::sha2_256>( v2 ) );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,134 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX17_HDR_OPTIONAL)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX17_HDR_OPTIONAL is defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/buffered_hash.hpp>
+#include <boost/hash2/counting_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <optional>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+enum class E: std::uint16_t
+{
+    a = 0x0102
+};
+
+// the same as hash_append of the discriminator, then of the value
+
+template<class Hash, class Flavor, class T> void test( std::optional<T> const& v )
+{
+    Flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append( h1, f, v );
+
+    Hash h2;
+
+    if( v )
+    {
+        boost::hash2::hash_append( h2, f, static_cast<unsigned char>( 1 ) );
+        boost::hash2::hash_append( h2, f, *v );
+    }
+    else
+    {
+        boost::hash2::hash_append( h2, f, static_cast<unsigned char>( 0 ) );
+    }
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+// with the bytes given
+
+template<class Hash, class Flavor, class T, std::size_t N> void test( std::optional<T> const& v, unsigned char const (&ref)[ N ] )
+{
+    Flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append( h1, f, v );
+
+    Hash h2;
+    h2.update( ref, N );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+// in a single update call
+
+template<class Flavor, class T> void test_calls( T const& v )
+{
+    Flavor f;
+
+    boost::hash2::counting_hash< boost::hash2::buffered_hash<boost::hash2::fnv1a_64> > h;
+    boost::hash2::hash_append( h, f, v );
+
+    BOOST_TEST_EQ( h.counts().update_calls, 1u );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32, little_endian_flavor>( std::optional<int>(), { 0x00 } );
+    test<fnv1a_32, little_endian_flavor>( std::optional<int>( 0x01020304 ), { 0x01, 0x04, 0x03, 0x02, 0x01 } );
+    test<fnv1a_32, big_endian_flavor>( std::optional<int>( 0x01020304 ), { 0x01, 0x01, 0x02, 0x03, 0x04 } );
+    test<fnv1a_32, little_endian_flavor>( std::optional<E>( E::a ), { 0x01, 0x02, 0x01 } );
+    test<fnv1a_32, big_endian_flavor>( std::optional<E>( E::a ), { 0x01, 0x01, 0x02 } );
+    test<fnv1a_32, little_endian_flavor>( std::optional<bool>( true ), { 0x01, 0x01 } );
+    test<fnv1a_32, little_endian_flavor>( std::optional<float>( -0.0f ), { 0x01, 0x00, 0x00, 0x00, 0x00 } );
+
+    test<fnv1a_64, default_flavor>( std::optional<int>() );
+    test<fnv1a_64, default_flavor>( std::optional<int>( 5 ) );
+    test<fnv1a_64, big_endian_flavor>( std::optional<std::uint64_t>( 5 ) );
+    test<fnv1a_64, default_flavor>( std::optional<double>( 3.14 ) );
+    test<fnv1a_64, default_flavor>( std::optional<double>( -0.0 ) );
+    test<fnv1a_64, default_flavor>( std::optional<std::string>( "abc" ) );
+    test<fnv1a_64, default_flavor>( std::optional< std::vector<int> >( std::vector<int>{ 1, 2, 3 } ) );
+    test<fnv1a_64, default_flavor>( std::optional< std::optional<int> >( std::optional<int>() ) );
+    test<fnv1a_64, default_flavor>( std::optional< std::optional<int> >( std::optional<int>( 7 ) ) );
+
+    // std::nullopt is an empty optional
+
+    {
+        fnv1a_64 h1, h2;
+
+        hash_append( h1, {}, std::nullopt );
+        hash_append( h2, {}, std::optional<int>() );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // an empty optional differs from an engaged one holding 0
+
+    {
+        fnv1a_64 h1, h2;
+
+        hash_append( h1, {}, std::optional<unsigned char>() );
+        hash_append( h2, {}, std::optional<unsigned char>( 0 ) );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+    }
+
+    test_calls<default_flavor>( std::optional<int>() );
+    test_calls<default_flavor>( std::optional<int>( 5 ) );
+    test_calls<big_endian_flavor>( std::optional<std::uint64_t>( 5 ) );
+    test_calls<default_flavor>( std::optional<double>( 3.14 ) );
+    test_calls<little_endian_flavor>( std::optional<E>( E::a ) );
+
+    return boost::report_errors();
+}
+
+#endif
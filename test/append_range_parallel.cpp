@@ -0,0 +1,80 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append_parallel.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX17_HDR_EXECUTION is defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <execution>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// std::execution::par may require linking with a backend library (TBB
+// for libstdc++), so only seq is tested here; the threads are tested
+// through update_parallel itself, and the result doesn't depend on the
+// policy
+
+template<class Hash, class T> void test( std::size_t n )
+{
+    std::vector<T> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<T>( i * 0x9E3779B97F4A7C15ull >> 37 );
+    }
+
+    boost::hash2::default_flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append_range( h1, f, v.data(), v.data() + n );
+
+    Hash h2;
+    boost::hash2::hash_append_range( std::execution::seq, h2, f, v.data(), v.data() + n );
+
+    BOOST_TEST( h1.result() == h2.result() );
+
+    T const* p = v.data();
+
+    Hash h3( 7 );
+    boost::hash2::hash_append_range( h3, f, p, p + n );
+
+    Hash h4( 7 );
+    boost::hash2::hash_append_range( std::execution::seq, h4, f, p, p + n );
+
+    BOOST_TEST( h3.result() == h4.result() );
+}
+
+template<class Hash> void test()
+{
+    std::size_t const lengths[] = { 0, 1, 1000, 1 << 20, 3 << 20 };
+
+    for( std::size_t n: lengths )
+    {
+        test<Hash, unsigned char>( n );
+        test<Hash, std::uint32_t>( n );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::crc32c>();
+    test<boost::hash2::blake3>();
+    test<boost::hash2::k12>();
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,175 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append_parallel.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION)
+# include <execution>
+#endif
+
+// the tree computed level by level, with each level in a new vector
+
+template<class Hash, class T> typename Hash::result_type reference( std::uint64_t seed, std::vector<T> const& v, std::size_t group )
+{
+    using R = typename Hash::result_type;
+
+    boost::hash2::default_flavor f;
+
+    Hash const h0( seed );
+
+    std::vector<R> level;
+
+    for( std::size_t i = 0; i < v.size(); i += group )
+    {
+        Hash h( h0 );
+
+        unsigned char const prefix = 0x00;
+        h.update( &prefix, 1 );
+
+        for( std::size_t j = i; j < i + group && j < v.size(); ++j )
+        {
+            boost::hash2::hash_append( h, f, v[ j ] );
+        }
+
+        level.push_back( h.result() );
+    }
+
+    while( level.size() > 1 )
+    {
+        std::vector<R> next;
+
+        for( std::size_t j = 0; j < level.size(); j += 2 )
+        {
+            if( j + 1 == level.size() )
+            {
+                next.push_back( level[ j ] );
+                break;
+            }
+
+            Hash h( h0 );
+
+            unsigned char const prefix = 0x01;
+            h.update( &prefix, 1 );
+
+            boost::hash2::hash_append( h, f, level[ j ] );
+            boost::hash2::hash_append( h, f, level[ j + 1 ] );
+
+            next.push_back( h.result() );
+        }
+
+        level.swap( next );
+    }
+
+    Hash h( h0 );
+
+    if( !level.empty() )
+    {
+        boost::hash2::hash_append( h, f, level[ 0 ] );
+    }
+
+    boost::hash2::hash_append_size( h, f, v.size() );
+
+    return h.result();
+}
+
+template<class Hash, class T> void test( std::vector<T> const& v, std::size_t group )
+{
+    boost::hash2::default_flavor f;
+
+    auto const r = reference<Hash>( 7, v, group );
+
+    for( unsigned threads = 1; threads <= 8; threads *= 2 )
+    {
+        boost::hash2::thread_executor ex( threads );
+
+        Hash h( 7 );
+        boost::hash2::hash_append_range_tree( ex, h, f, v.begin(), v.end(), group );
+
+        BOOST_TEST( h.result() == r );
+    }
+
+    {
+        boost::hash2::work_stealing_executor ex( 3 );
+
+        Hash h( 7 );
+        boost::hash2::hash_append_range_tree( ex, h, f, v.begin(), v.end(), group );
+
+        BOOST_TEST( h.result() == r );
+    }
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+    {
+        Hash h( 7 );
+        boost::hash2::hash_append_range_tree( std::execution::seq, h, f, v.data(), v.data() + v.size(), group );
+
+        BOOST_TEST( h.result() == r );
+    }
+
+#endif
+}
+
+template<class Hash> void test()
+{
+    std::size_t const lengths[] = { 0, 1, 2, 100, 1024, 1025, 5000, 70001 };
+
+    for( std::size_t n: lengths )
+    {
+        std::vector<std::string> v;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            v.push_back( std::string( i % 37, 'x' ) + std::to_string( i ) );
+        }
+
+        test<Hash>( v, 1 );
+        test<Hash>( v, 3 );
+        test<Hash>( v, 1024 );
+
+        std::vector<std::uint32_t> w( v.size() );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            w[ i ] = static_cast<std::uint32_t>( i * 0x9E3779B9u );
+        }
+
+        test<Hash>( w, 1000 );
+    }
+
+    // the grouping is part of the result, and the encoding is not that of hash_append_range
+
+    {
+        std::vector<std::string> v( 3000, "abc" );
+
+        boost::hash2::thread_executor ex( 2 );
+        boost::hash2::default_flavor f;
+
+        Hash h1, h2, h3;
+
+        boost::hash2::hash_append_range_tree( ex, h1, f, v.begin(), v.end(), 1000 );
+        boost::hash2::hash_append_range_tree( ex, h2, f, v.begin(), v.end(), 1024 );
+        boost::hash2::hash_append_range( h3, f, v.begin(), v.end() );
+
+        auto const r1 = h1.result();
+
+        BOOST_TEST( r1 != h2.result() );
+        BOOST_TEST( r1 != h3.result() );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::sha2_256>();
+
+    return boost::report_errors();
+}
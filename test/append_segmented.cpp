@@ -0,0 +1,229 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/segmented_iterator.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <deque>
+#include <list>
+#include <vector>
+#include <string>
+#include <iterator>
+#include <cstdint>
+#include <cstddef>
+
+// fnv1a_64, counting the calls to update
+
+class counting_fnv1a_64: public boost::hash2::fnv1a_64
+{
+public:
+
+    std::size_t updates = 0;
+
+    void update( void const* p, std::size_t n )
+    {
+        ++updates;
+        boost::hash2::fnv1a_64::update( p, n );
+    }
+};
+
+// a user-defined segmented sequence, blocks of 5 elements
+
+template<class T> class blocked_iterator
+{
+private:
+
+    T const* const* blocks_;
+    std::ptrdiff_t i_;
+
+public:
+
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef T value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T const* pointer;
+    typedef T const& reference;
+
+    static constexpr std::ptrdiff_t block_size = 5;
+
+    blocked_iterator( T const* const* blocks, std::ptrdiff_t i ): blocks_( blocks ), i_( i )
+    {
+    }
+
+    T const& operator*() const
+    {
+        return blocks_[ i_ / block_size ][ i_ % block_size ];
+    }
+
+    blocked_iterator& operator++()
+    {
+        ++i_;
+        return *this;
+    }
+
+    blocked_iterator& operator+=( std::ptrdiff_t n )
+    {
+        i_ += n;
+        return *this;
+    }
+
+    friend std::ptrdiff_t operator-( blocked_iterator const& a, blocked_iterator const& b )
+    {
+        return a.i_ - b.i_;
+    }
+
+    friend bool operator==( blocked_iterator const& a, blocked_iterator const& b )
+    {
+        return a.i_ == b.i_;
+    }
+
+    friend bool operator!=( blocked_iterator const& a, blocked_iterator const& b )
+    {
+        return a.i_ != b.i_;
+    }
+
+    T const* segment_end() const
+    {
+        return blocks_[ i_ / block_size ] + block_size;
+    }
+};
+
+namespace boost
+{
+namespace hash2
+{
+
+template<class T> struct segmented_iterator_traits< blocked_iterator<T> >
+{
+    static T const* segment_end( blocked_iterator<T> const& it )
+    {
+        return it.segment_end();
+    }
+};
+
+} // namespace hash2
+} // namespace boost
+
+template<class T> void test_deque( std::size_t n )
+{
+    std::deque<T> d;
+    std::list<T> l;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        T x = static_cast<T>( i * 0x9E3779B97F4A7C15ull >> 40 );
+
+        d.push_back( x );
+        l.push_back( x );
+    }
+
+    // start the deque in the middle of a block
+
+    d.push_front( 7 );
+    d.pop_front();
+
+    counting_fnv1a_64 h1;
+    boost::hash2::hash_append( h1, {}, d );
+
+    counting_fnv1a_64 h2;
+    boost::hash2::hash_append( h2, {}, l );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+
+    // the library doesn't specialize segmented_iterator_traits for the
+    // iterators of std::deque, whose layout is private to the implementation
+
+    BOOST_TEST( !boost::hash2::is_segmented_iterator<typename std::deque<T>::const_iterator>::value );
+
+    // subranges
+
+    for( std::size_t i = 0; i < n; i += n / 7 + 1 )
+    {
+        std::size_t j = i + ( n - i ) / 3;
+
+        counting_fnv1a_64 h3;
+        boost::hash2::hash_append_range( h3, {}, d.begin() + i, d.begin() + j );
+
+        counting_fnv1a_64 h4;
+        boost::hash2::hash_append_range( h4, {}, std::next( l.begin(), i ), std::next( l.begin(), j ) );
+
+        BOOST_TEST_EQ( h3.result(), h4.result() );
+    }
+}
+
+void test_blocked( std::ptrdiff_t n )
+{
+    std::vector< std::vector<std::uint32_t> > storage;
+    std::vector<std::uint32_t const*> blocks;
+
+    std::ptrdiff_t const B = blocked_iterator<std::uint32_t>::block_size;
+
+    for( std::ptrdiff_t i = 0; i < n; i += B )
+    {
+        std::vector<std::uint32_t> block;
+
+        for( std::ptrdiff_t j = 0; j < B; ++j )
+        {
+            block.push_back( static_cast<std::uint32_t>( ( i + j ) * 0x9E3779B9u ) );
+        }
+
+        storage.push_back( block );
+        blocks.push_back( storage.back().data() );
+    }
+
+    BOOST_TEST( boost::hash2::is_segmented_iterator< blocked_iterator<std::uint32_t> >::value );
+
+    for( std::ptrdiff_t i = 0; i <= n; ++i )
+    {
+        blocked_iterator<std::uint32_t> first( blocks.data(), i ), last( blocks.data(), n );
+
+        counting_fnv1a_64 h1;
+        boost::hash2::hash_append_range( h1, {}, first, last );
+
+        counting_fnv1a_64 h2;
+
+        for( std::ptrdiff_t j = i; j < n; ++j )
+        {
+            boost::hash2::hash_append( h2, {}, static_cast<std::uint32_t>( j * 0x9E3779B9u ) );
+        }
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+        BOOST_TEST_EQ( h1.updates, static_cast<std::size_t>( i == n? 0: ( n - 1 ) / B - i / B + 1 ) );
+    }
+}
+
+int main()
+{
+    for( std::size_t n = 0; n < 2500; n = n * 2 + 1 )
+    {
+        test_deque<unsigned char>( n );
+        test_deque<std::uint16_t>( n );
+        test_deque<std::uint64_t>( n );
+        test_deque<float>( n );
+    }
+
+    // not contiguously hashable, element by element
+
+    {
+        std::deque<std::string> d = { "a", "bc", "def" };
+        std::list<std::string> l( d.begin(), d.end() );
+
+        boost::hash2::fnv1a_64 h1;
+        boost::hash2::hash_append( h1, {}, d );
+
+        boost::hash2::fnv1a_64 h2;
+        boost::hash2::hash_append( h2, {}, l );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    test_blocked( 0 );
+    test_blocked( 1 );
+    test_blocked( 5 );
+    test_blocked( 23 );
+    test_blocked( 60 );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,104 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <list>
+#include <utility>
+
+template<class Hash, class Flavor, class T> void test_container( unsigned char const* expected, std::size_t n )
+{
+    unsigned char w[] = { 1, 2, 3, 4 };
+    T v( w, w + sizeof(w) / sizeof(w[0]) );
+
+    Flavor f;
+
+    Hash h0;
+    h0.update( expected, n );
+
+    typename Hash::result_type const r = h0.result();
+
+    {
+        Hash h;
+        boost::hash2::hash_append( h, f, v );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    {
+        Hash h;
+        boost::hash2::hash_append_sized_range( h, f, v.begin(), v.end() );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+}
+
+template<class Hash, class Flavor> void test( unsigned char const* expected, std::size_t n )
+{
+    test_container< Hash, Flavor, std::string >( expected, n );
+    test_container< Hash, Flavor, std::vector<unsigned char> >( expected, n );
+    test_container< Hash, Flavor, std::list<char> >( expected, n );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    {
+        unsigned char const expected[] = { 1, 2, 3, 4, 4, 0, 0, 0 };
+
+        test<fnv1a_32, little_endian_flavor_32>( expected, sizeof( expected ) );
+        test<fnv1a_64, little_endian_flavor_32>( expected, sizeof( expected ) );
+    }
+
+    {
+        unsigned char const expected[] = { 1, 2, 3, 4, 0, 0, 0, 4 };
+
+        test<fnv1a_32, big_endian_flavor_32>( expected, sizeof( expected ) );
+        test<fnv1a_64, big_endian_flavor_32>( expected, sizeof( expected ) );
+    }
+
+    {
+        unsigned char const expected[] = { 1, 2, 3, 4 };
+
+        test<fnv1a_32, unsized_flavor>( expected, sizeof( expected ) );
+        test<fnv1a_64, unsized_flavor>( expected, sizeof( expected ) );
+    }
+
+    {
+        // a variable-length range as the last component
+
+        std::pair<std::uint32_t, std::string> v( 0x01020304, "abc" );
+
+        fnv1a_64 h1;
+        hash_append( h1, unsized_flavor(), v );
+
+        fnv1a_64 h2;
+        hash_append( h2, default_flavor(), v.first );
+        h2.update( "abc", 3 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        // default_flavor_32 hashes sizes as 32 bit values
+
+        std::vector<int> v( 5, 7 );
+
+        fnv1a_64 h1;
+        hash_append( h1, default_flavor_32(), v );
+
+        fnv1a_64 h2;
+        hash_append_range( h2, default_flavor(), v.begin(), v.end() );
+        hash_append( h2, default_flavor(), static_cast<std::uint32_t>( v.size() ) );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,73 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <memory>
+
+template<class Hash, class Flavor, class P> void test( P const& p )
+{
+    Flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append( h1, f, p );
+
+    Hash h2;
+    boost::hash2::hash_append( h2, f, p.get() );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+struct X
+{
+};
+
+struct D
+{
+    void operator()( X* p ) const
+    {
+        delete p;
+    }
+};
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32, default_flavor>( std::unique_ptr<X>() );
+    test<fnv1a_32, default_flavor>( std::unique_ptr<X>( new X ) );
+    test<fnv1a_32, default_flavor>( std::unique_ptr<X, D>( new X ) );
+    test<fnv1a_32, default_flavor>( std::unique_ptr<int[]>( new int[ 4 ] ) );
+    test<fnv1a_32, little_endian_flavor>( std::shared_ptr<X>() );
+    test<fnv1a_32, big_endian_flavor>( std::shared_ptr<X>( new X ) );
+    test<fnv1a_32, default_flavor>( std::shared_ptr<X const>( new X ) );
+
+    // a null smart pointer hashes as nullptr
+
+    {
+        fnv1a_32 h1, h2;
+
+        hash_append( h1, {}, std::shared_ptr<int>() );
+        hash_append( h2, {}, nullptr );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // equal pointers hash equally
+
+    {
+        std::shared_ptr<X> p1( new X );
+        std::shared_ptr<X> p2( p1 );
+
+        fnv1a_32 h1, h2;
+
+        hash_append( h1, {}, p1 );
+        hash_append( h2, {}, p2 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
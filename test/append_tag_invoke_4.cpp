@@ -0,0 +1,93 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// tag_invoke takes precedence over the range and tuple-like cases
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <string>
+
+struct X: std::vector<int>
+{
+    template<class Hash, class Flavor>
+    friend void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, X const& x )
+    {
+        boost::hash2::hash_append( h, f, std::string( "X" ) );
+        boost::hash2::hash_append( h, f, x.size() );
+    }
+};
+
+struct Y: std::unordered_set<int>
+{
+    template<class Hash, class Flavor>
+    friend void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, Y const& y )
+    {
+        boost::hash2::hash_append( h, f, std::string( "Y" ) );
+        boost::hash2::hash_append( h, f, y.size() );
+    }
+};
+
+struct Z: std::pair<int, int>
+{
+    template<class Hash, class Flavor>
+    friend void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, Z const& z )
+    {
+        boost::hash2::hash_append( h, f, std::string( "Z" ) );
+        boost::hash2::hash_append( h, f, z.first );
+    }
+};
+
+template<class T> static std::size_t hv( T const& v )
+{
+    boost::hash2::fnv1a_64 h;
+    boost::hash2::hash_append( h, {}, v );
+
+    return static_cast<std::size_t>( h.result() );
+}
+
+template<class T1, class T2> static std::size_t hv( T1 const& v1, T2 const& v2 )
+{
+    boost::hash2::fnv1a_64 h;
+
+    boost::hash2::hash_append( h, {}, v1 );
+    boost::hash2::hash_append( h, {}, v2 );
+
+    return static_cast<std::size_t>( h.result() );
+}
+
+int main()
+{
+    {
+        X x;
+
+        x.push_back( 1 );
+        x.push_back( 2 );
+
+        BOOST_TEST_EQ( hv( x ), hv( std::string( "X" ), x.size() ) );
+    }
+
+    {
+        Y y;
+
+        y.insert( 1 );
+        y.insert( 2 );
+
+        BOOST_TEST_EQ( hv( y ), hv( std::string( "Y" ), y.size() ) );
+    }
+
+    {
+        Z z;
+
+        z.first = 1;
+        z.second = 2;
+
+        BOOST_TEST_EQ( hv( z ), hv( std::string( "Z" ), 1 ) );
+    }
+
+    return boost::report_errors();
+}
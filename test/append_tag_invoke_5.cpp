@@ -0,0 +1,127 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// tag_invoke takes precedence over the std::optional, std::variant and
+// smart pointer cases
+
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX17_HDR_OPTIONAL) || defined(BOOST_NO_CXX17_HDR_VARIANT)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX17_HDR_OPTIONAL or BOOST_NO_CXX17_HDR_VARIANT is defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <optional>
+#include <variant>
+#include <memory>
+#include <string>
+
+namespace N
+{
+
+struct X
+{
+    int v;
+};
+
+// found by argument-dependent lookup, as N is an associated namespace
+// of std::optional<X> and the others
+
+template<class Hash, class Flavor>
+void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, std::optional<X> const& x )
+{
+    boost::hash2::hash_append( h, f, std::string( "optional" ) );
+    boost::hash2::hash_append( h, f, x? x->v: -1 );
+}
+
+template<class Hash, class Flavor>
+void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, std::variant<X, int> const& x )
+{
+    boost::hash2::hash_append( h, f, std::string( "variant" ) );
+    boost::hash2::hash_append( h, f, x.index() );
+}
+
+template<class Hash, class Flavor>
+void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, std::unique_ptr<X> const& x )
+{
+    boost::hash2::hash_append( h, f, std::string( "unique_ptr" ) );
+    boost::hash2::hash_append( h, f, x? x->v: -1 );
+}
+
+template<class Hash, class Flavor>
+void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, std::shared_ptr<X> const& x )
+{
+    boost::hash2::hash_append( h, f, std::string( "shared_ptr" ) );
+    boost::hash2::hash_append( h, f, x? x->v: -1 );
+}
+
+} // namespace N
+
+template<class T> static std::size_t hv( T const& v )
+{
+    boost::hash2::fnv1a_64 h;
+    boost::hash2::hash_append( h, {}, v );
+
+    return static_cast<std::size_t>( h.result() );
+}
+
+template<class T1, class T2> static std::size_t hv( T1 const& v1, T2 const& v2 )
+{
+    boost::hash2::fnv1a_64 h;
+
+    boost::hash2::hash_append( h, {}, v1 );
+    boost::hash2::hash_append( h, {}, v2 );
+
+    return static_cast<std::size_t>( h.result() );
+}
+
+int main()
+{
+    using N::X;
+
+    {
+        std::optional<X> x( X{ 5 } );
+
+        BOOST_TEST_EQ( hv( x ), hv( std::string( "optional" ), 5 ) );
+        BOOST_TEST_EQ( hv( std::optional<X>() ), hv( std::string( "optional" ), -1 ) );
+    }
+
+    {
+        std::variant<X, int> x( 3 );
+
+        BOOST_TEST_EQ( hv( x ), hv( std::string( "variant" ), std::size_t( 1 ) ) );
+    }
+
+    {
+        std::unique_ptr<X> x( new X{ 7 } );
+
+        BOOST_TEST_EQ( hv( x ), hv( std::string( "unique_ptr" ), 7 ) );
+    }
+
+    {
+        std::shared_ptr<X> x( new X{ 9 } );
+
+        BOOST_TEST_EQ( hv( x ), hv( std::string( "shared_ptr" ), 9 ) );
+    }
+
+    // types without a tag_invoke still use the built-in encoding
+
+    {
+        std::optional<int> x( 4 );
+
+        BOOST_TEST_EQ( hv( x ), hv( static_cast<unsigned char>( 1 ), 4 ) );
+        BOOST_TEST_EQ( hv( std::nullopt ), hv( static_cast<unsigned char>( 0 ) ) );
+        BOOST_TEST_EQ( hv( std::monostate() ), hv( '\x00' ) );
+    }
+
+    return boost::report_errors();
+}
+
+#endif
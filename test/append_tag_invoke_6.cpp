@@ -0,0 +1,114 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// the tag_invoke of an enum is used by the bulk paths of hash_append, in
+// ranges of enums, and as the value of a std::optional or std::variant,
+// under a flavor with a non-native byte order
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+
+#if !defined(BOOST_NO_CXX17_HDR_OPTIONAL)
+# include <optional>
+#endif
+
+#if !defined(BOOST_NO_CXX17_HDR_VARIANT)
+# include <variant>
+#endif
+
+namespace N
+{
+
+enum class E: std::uint32_t
+{
+    a = 1, b = 2
+};
+
+template<class Hash, class Flavor>
+void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, E const& e )
+{
+    boost::hash2::hash_append( h, f, std::string( "E" ) );
+    boost::hash2::hash_append( h, f, static_cast<std::uint32_t>( e ) * 3 );
+}
+
+} // namespace N
+
+template<class Flavor> static void test()
+{
+    using N::E;
+
+    Flavor f;
+
+    // a vector of enums is its elements, then its size
+
+    {
+        std::vector<E> v{ E::a, E::b, E::a };
+
+        boost::hash2::fnv1a_64 h1;
+        boost::hash2::hash_append( h1, f, v );
+
+        boost::hash2::fnv1a_64 h2;
+
+        for( E e: v )
+        {
+            boost::hash2::hash_append( h2, f, e );
+        }
+
+        boost::hash2::hash_append_size( h2, f, v.size() );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+#if !defined(BOOST_NO_CXX17_HDR_OPTIONAL)
+
+    // an engaged optional is the byte 1, then the value
+
+    {
+        std::optional<E> v( E::b );
+
+        boost::hash2::fnv1a_64 h1;
+        boost::hash2::hash_append( h1, f, v );
+
+        boost::hash2::fnv1a_64 h2;
+        boost::hash2::hash_append( h2, f, static_cast<unsigned char>( 1 ) );
+        boost::hash2::hash_append( h2, f, E::b );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+#endif
+
+#if !defined(BOOST_NO_CXX17_HDR_VARIANT)
+
+    // a variant is index() + 1, then the alternative
+
+    {
+        std::variant<int, E> v( E::a );
+
+        boost::hash2::fnv1a_64 h1;
+        boost::hash2::hash_append( h1, f, v );
+
+        boost::hash2::fnv1a_64 h2;
+        boost::hash2::hash_append( h2, f, static_cast<unsigned char>( 2 ) );
+        boost::hash2::hash_append( h2, f, E::a );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+#endif
+}
+
+int main()
+{
+    test<boost::hash2::little_endian_flavor>();
+    test<boost::hash2::big_endian_flavor>();
+
+    return boost::report_errors();
+}
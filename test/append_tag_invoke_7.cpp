@@ -0,0 +1,86 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// tag_invoke takes precedence over the std::vector<bool> case
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstddef>
+
+namespace N
+{
+
+template<class T> struct allocator: std::allocator<T>
+{
+    template<class U> struct rebind
+    {
+        typedef allocator<U> other;
+    };
+
+    allocator() = default;
+
+    template<class U> allocator( allocator<U> const& ) noexcept
+    {
+    }
+};
+
+// found by argument-dependent lookup, as N is an associated namespace
+// of std::vector<bool, N::allocator<bool>>
+
+template<class Hash, class Flavor>
+void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, std::vector<bool, allocator<bool>> const& v )
+{
+    boost::hash2::hash_append( h, f, std::string( "bits" ) );
+    boost::hash2::hash_append( h, f, v.size() );
+}
+
+} // namespace N
+
+template<class T> static std::size_t hv( T const& v )
+{
+    boost::hash2::fnv1a_64 h;
+    boost::hash2::hash_append( h, {}, v );
+
+    return static_cast<std::size_t>( h.result() );
+}
+
+template<class T1, class T2> static std::size_t hv( T1 const& v1, T2 const& v2 )
+{
+    boost::hash2::fnv1a_64 h;
+
+    boost::hash2::hash_append( h, {}, v1 );
+    boost::hash2::hash_append( h, {}, v2 );
+
+    return static_cast<std::size_t>( h.result() );
+}
+
+int main()
+{
+    {
+        std::vector<bool, N::allocator<bool>> v( 3, true );
+
+        BOOST_TEST_EQ( hv( v ), hv( std::string( "bits" ), v.size() ) );
+    }
+
+    // std::vector<bool> without a tag_invoke still uses the packed bits
+
+    {
+        std::vector<bool> v( 3, true );
+
+        boost::hash2::fnv1a_64 h;
+
+        unsigned char const b[] = { 0x07 };
+        h.update( b, 1 );
+
+        boost::hash2::hash_append_size( h, {}, v.size() );
+
+        BOOST_TEST_EQ( hv( v ), static_cast<std::size_t>( h.result() ) );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,131 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+struct sip_flavor: boost::hash2::default_flavor
+{
+    using unordered_element_hash = boost::hash2::siphash_64;
+};
+
+struct xx_big_flavor: boost::hash2::big_endian_flavor
+{
+    using unordered_element_hash = boost::hash2::xxhash_64;
+};
+
+template<class Hash, class Flavor> void test()
+{
+    Flavor f;
+
+    std::vector<std::string> v;
+
+    for( int i = 0; i < 97; ++i )
+    {
+        v.push_back( std::to_string( i * 7919 ) );
+    }
+
+    typename Hash::result_type r1, r2, r3;
+
+    {
+        std::unordered_set<std::string> s( v.begin(), v.end() );
+
+        Hash h;
+        hash_append( h, f, s );
+
+        r1 = h.result();
+    }
+
+    {
+        // reverse insertion order, different bucket count
+
+        std::unordered_set<std::string> s( v.rbegin(), v.rend(), 1031 );
+
+        Hash h;
+        hash_append( h, f, s );
+
+        r2 = h.result();
+    }
+
+    BOOST_TEST( r1 == r2 );
+
+    {
+        // the element hashes depend on the state of h
+
+        std::unordered_set<std::string> s( v.begin(), v.end() );
+
+        Hash h( 1 );
+        hash_append( h, f, s );
+
+        r3 = h.result();
+    }
+
+    BOOST_TEST( r1 != r3 );
+
+    {
+        // the result differs from the one without unordered_element_hash
+
+        std::unordered_set<std::string> s( v.begin(), v.end() );
+
+        Hash h;
+        hash_append( h, boost::hash2::default_flavor(), s );
+
+        r3 = h.result();
+    }
+
+    BOOST_TEST( r1 != r3 );
+
+    {
+        std::unordered_map<int, std::unordered_set<std::string>> m1, m2;
+
+        for( int i = 0; i < 31; ++i )
+        {
+            m1[ i ].insert( v.begin() + i, v.begin() + i + 5 );
+            m2[ 30 - i ].insert( v.begin() + 30 - i, v.begin() + 35 - i );
+        }
+
+        m2.rehash( 257 );
+
+        Hash h1;
+        hash_append( h1, f, m1 );
+
+        Hash h2;
+        hash_append( h2, f, m2 );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        // a differing element changes the result
+
+        std::unordered_set<std::string> s1( v.begin(), v.end() );
+        std::unordered_set<std::string> s2( v.begin() + 1, v.end() );
+
+        s2.insert( "x" );
+
+        Hash h1;
+        hash_append( h1, f, s1 );
+
+        Hash h2;
+        hash_append( h2, f, s2 );
+
+        BOOST_TEST( h1.result() != h2.result() );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::sha2_512, sip_flavor>();
+    test<boost::hash2::sha2_256, xx_big_flavor>();
+    test<boost::hash2::xxhash_64, sip_flavor>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,89 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_append_parallel.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX17_HDR_EXECUTION is defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <execution>
+#include <unordered_map>
+#include <string>
+
+struct sip_flavor: boost::hash2::default_flavor
+{
+    using unordered_element_hash = boost::hash2::siphash_64;
+};
+
+// std::execution::par and par_unseq may require linking with a
+// backend library (TBB for libstdc++), so only seq is tested here;
+// the result doesn't depend on the policy
+
+template<class Hash, class Flavor> void test()
+{
+    Flavor f;
+
+    std::unordered_map<std::string, int> m;
+
+    for( int i = 0; i < 1031; ++i )
+    {
+        m[ std::to_string( i * 7919 ) ] = i;
+    }
+
+    {
+        Hash h1;
+        boost::hash2::hash_append_unordered_range( h1, f, m.begin(), m.end() );
+
+        Hash h2;
+        boost::hash2::hash_append_unordered_range( std::execution::seq, h2, f, m.begin(), m.end() );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        Hash h1( 7 );
+        hash_append( h1, f, m );
+
+        Hash h2( 7 );
+        boost::hash2::hash_append_unordered_range( std::execution::seq, h2, f, m.begin(), m.end() );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        std::unordered_map<std::string, int> m2;
+
+        Hash h1;
+        boost::hash2::hash_append_unordered_range( h1, f, m2.begin(), m2.end() );
+
+        Hash h2;
+        boost::hash2::hash_append_unordered_range( std::execution::seq, h2, f, m2.begin(), m2.end() );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_64, boost::hash2::default_flavor>();
+    test<boost::hash2::siphash_64, boost::hash2::default_flavor>();
+    test<boost::hash2::sha2_256, boost::hash2::big_endian_flavor>();
+
+    test<boost::hash2::fnv1a_64, sip_flavor>();
+    test<boost::hash2::sha2_512, sip_flavor>();
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,164 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/detail/has_update_word.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> void test()
+{
+    BOOST_TEST( boost::hash2::detail::has_update_word<H>::value );
+
+    unsigned char buffer[ 64 ];
+
+    for( int i = 0; i < 64; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    std::uint64_t const w = 0x0123456789ABCDEFull;
+
+    unsigned char tmp[ 8 ];
+    boost::hash2::detail::write64le( tmp, w );
+
+    // preceded by 0 to 63 bytes, so that every buffer offset is exercised
+
+    for( std::size_t i = 0; i < 64; ++i )
+    {
+        H h1( 7 );
+        H h2( 7 );
+
+        h1.update( buffer, i );
+        h1.update( tmp, 8 );
+        h1.update( buffer, 13 );
+        h1.update( tmp, 8 );
+        h1.update( tmp, 8 );
+
+        h2.update( buffer, i );
+        h2.update_word( w );
+        h2.update( buffer, 13 );
+        h2.update_word( w );
+        h2.update_word( w );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // hash_append of 64 bit integers must not depend on whether update_word is used
+
+    {
+        H h1;
+        H h2;
+
+        std::int64_t const v[] = { -1, 0, 1, 0x7F00FF00FF00FF01 };
+
+        for( std::size_t i = 0; i < 4; ++i )
+        {
+            boost::hash2::detail::write64le( tmp, static_cast<std::uint64_t>( v[ i ] ) );
+            h1.update( tmp, 8 );
+
+            boost::hash2::detail::write64be( tmp, static_cast<std::uint64_t>( v[ i ] ) );
+            h1.update( tmp, 8 );
+        }
+
+        for( std::size_t i = 0; i < 4; ++i )
+        {
+            hash_append( h2, boost::hash2::little_endian_flavor(), v[ i ] );
+            hash_append( h2, boost::hash2::big_endian_flavor(), v[ i ] );
+        }
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+// counts the calls to update and update_word
+
+struct probe_hash
+{
+    int updates = 0;
+    int words = 0;
+
+    void update( void const* /*p*/, std::size_t /*n*/ )
+    {
+        ++updates;
+    }
+
+    void update_word( std::uint64_t /*w*/ )
+    {
+        ++words;
+    }
+};
+
+enum class E64: std::uint64_t
+{
+    v = 5
+};
+
+template<class Flavor> void test_probe()
+{
+    // 64 bit integral, enum and pointer values use update_word in every
+    // flavor, including those with native byte order
+
+    {
+        probe_hash h;
+
+        int x = 0;
+
+        boost::hash2::hash_append( h, Flavor(), std::uint64_t( 1 ) );
+        boost::hash2::hash_append( h, Flavor(), std::int64_t( -1 ) );
+        boost::hash2::hash_append( h, Flavor(), E64::v );
+        boost::hash2::hash_append( h, Flavor(), 1.0 );
+
+        BOOST_TEST_EQ( h.words, 4 );
+        BOOST_TEST_EQ( h.updates, 0 );
+
+        if( sizeof( void* ) == 8 )
+        {
+            boost::hash2::hash_append( h, Flavor(), &x );
+
+            BOOST_TEST_EQ( h.words, 5 );
+            BOOST_TEST_EQ( h.updates, 0 );
+        }
+    }
+
+    // other sizes use update
+
+    {
+        probe_hash h;
+
+        boost::hash2::hash_append( h, Flavor(), std::uint32_t( 1 ) );
+        boost::hash2::hash_append( h, Flavor(), 'a' );
+
+        BOOST_TEST_EQ( h.words, 0 );
+        BOOST_TEST_EQ( h.updates, 2 );
+    }
+}
+
+int main()
+{
+    test_probe<boost::hash2::default_flavor>();
+    test_probe<boost::hash2::little_endian_flavor>();
+    test_probe<boost::hash2::big_endian_flavor>();
+
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::fnv1a_64_wide>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::siphash_32>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_32>();
+    test<boost::hash2::siphash13_64>();
+
+    BOOST_TEST( !boost::hash2::detail::has_update_word<boost::hash2::md5_128>::value );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,144 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if defined(BOOST_NO_CXX17_HDR_VARIANT)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX17_HDR_VARIANT is defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/buffered_hash.hpp>
+#include <boost/hash2/counting_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <variant>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include <cstdint>
+
+// the same as hash_append of index() + 1 as a byte, then of the alternative
+
+template<class Hash, class Flavor, class... T> void test( std::variant<T...> const& v )
+{
+    Flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append( h1, f, v );
+
+    Hash h2;
+
+    boost::hash2::hash_append( h2, f, static_cast<unsigned char>( v.index() + 1 ) );
+    std::visit( [&]( auto const& x ){ boost::hash2::hash_append( h2, f, x ); }, v );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+// with the bytes given
+
+template<class Hash, class Flavor, class V, std::size_t N> void test( V const& v, unsigned char const (&ref)[ N ] )
+{
+    Flavor f;
+
+    Hash h1;
+    boost::hash2::hash_append( h1, f, v );
+
+    Hash h2;
+    h2.update( ref, N );
+
+    BOOST_TEST_EQ( h1.result(), h2.result() );
+}
+
+// in a single update call
+
+template<class Flavor, class T> void test_calls( T const& v )
+{
+    Flavor f;
+
+    boost::hash2::counting_hash< boost::hash2::buffered_hash<boost::hash2::fnv1a_64> > h;
+    boost::hash2::hash_append( h, f, v );
+
+    BOOST_TEST_EQ( h.counts().update_calls, 1u );
+}
+
+struct Y
+{
+    Y() = default;
+
+    Y( Y const& )
+    {
+        throw std::runtime_error( "Y" );
+    }
+
+    Y& operator=( Y const& ) = default;
+
+    template<class Hash, class Flavor> friend void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, Y const& )
+    {
+        boost::hash2::hash_append( h, f, 'Y' );
+    }
+};
+
+int main()
+{
+    using namespace boost::hash2;
+
+    using V = std::variant<int, float, std::uint16_t>;
+
+    test<fnv1a_32, little_endian_flavor>( V( 0x01020304 ), { 0x01, 0x04, 0x03, 0x02, 0x01 } );
+    test<fnv1a_32, big_endian_flavor>( V( 0x01020304 ), { 0x01, 0x01, 0x02, 0x03, 0x04 } );
+    test<fnv1a_32, little_endian_flavor>( V( -0.0f ), { 0x02, 0x00, 0x00, 0x00, 0x00 } );
+    test<fnv1a_32, little_endian_flavor>( V( std::uint16_t( 0x0102 ) ), { 0x03, 0x02, 0x01 } );
+    test<fnv1a_32, little_endian_flavor>( std::variant<std::monostate, int>(), { 0x01, 0x00 } );
+
+    test<fnv1a_64, default_flavor>( V( 5 ) );
+    test<fnv1a_64, default_flavor>( V( 5.0f ) );
+    test<fnv1a_64, default_flavor>( std::variant<int, std::string>( "abc" ) );
+    test<fnv1a_64, default_flavor>( std::variant<std::string, std::vector<int>>( std::vector<int>{ 1, 2, 3 } ) );
+    test<fnv1a_64, default_flavor>( std::variant<std::monostate, double>( 3.14 ) );
+
+    // the same value in different alternatives hashes differently
+
+    {
+        fnv1a_64 h1, h2;
+
+        hash_append( h1, {}, std::variant<int, int>( std::in_place_index<0>, 1 ) );
+        hash_append( h2, {}, std::variant<int, int>( std::in_place_index<1>, 1 ) );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+    }
+
+    // valueless by exception
+
+    {
+        std::variant<int, Y> v;
+        Y y;
+
+        try
+        {
+            v = y;
+        }
+        catch( std::exception const& )
+        {
+        }
+
+        BOOST_TEST( v.valueless_by_exception() );
+
+        test<fnv1a_32, default_flavor>( v, { 0x00 } );
+    }
+
+    test_calls<default_flavor>( V( 5 ) );
+    test_calls<big_endian_flavor>( V( 5 ) );
+    test_calls<default_flavor>( V( 5.0f ) );
+    test_calls<default_flavor>( std::variant<std::monostate, int>() );
+    test_calls<default_flavor>( std::variant<std::uint64_t, double>( 2.5 ) );
+
+    return boost::report_errors();
+}
+
+#endif
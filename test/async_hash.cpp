@@ -0,0 +1,256 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/async_hash.hpp>
+#include <boost/asio/local/connect_pair.hpp>
+#include <boost/asio/local/stream_protocol.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_ASIO_HAS_LOCAL_SOCKETS)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_ASIO_HAS_LOCAL_SOCKETS is not defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/asio/io_context.hpp>
+#include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/asio/write.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if defined(BOOST_ASIO_HAS_CO_AWAIT)
+# include <boost/asio/co_spawn.hpp>
+# include <boost/asio/detached.hpp>
+# include <boost/asio/use_awaitable.hpp>
+#endif
+
+namespace asio = boost::asio;
+using socket_type = asio::local::stream_protocol::socket;
+using namespace boost::hash2;
+
+static std::vector<unsigned char> make_data( std::size_t n )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint32_t x = 1;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return v;
+}
+
+template<class H> static typename H::result_type expected( std::vector<unsigned char> const& v, std::size_t n )
+{
+    H h;
+    h.update( v.data(), n );
+
+    return h.result();
+}
+
+// closes the second socket of the pair once the data has been written
+// to it; the write fails when the first one is closed before reading
+// it all, which is expected
+
+struct writer
+{
+    socket_type& s;
+
+    void operator()( boost::system::error_code const&, std::size_t ) const
+    {
+        s.close();
+    }
+};
+
+template<class H> static void test( std::size_t n, std::size_t buffer_size )
+{
+    std::vector<unsigned char> const v = make_data( n );
+    std::vector<unsigned char> buffer( buffer_size );
+
+    // to the end of the stream
+
+    {
+        asio::io_context io;
+
+        socket_type s1( io ), s2( io );
+        asio::local::connect_pair( s1, s2 );
+
+        asio::async_write( s2, asio::buffer( v ), writer{ s2 } );
+
+        H h;
+
+        boost::system::error_code ec2;
+        std::uint64_t m2 = 0;
+
+        async_hash( s1, h, asio::buffer( buffer ), static_cast<std::uint64_t>( -1 ), [&]( boost::system::error_code ec, std::uint64_t m ){
+
+            ec2 = ec;
+            m2 = m;
+        });
+
+        io.run();
+
+        BOOST_TEST( !ec2 );
+        BOOST_TEST_EQ( m2, n );
+        BOOST_TEST( h.result() == expected<H>( v, n ) );
+    }
+
+    // a given size, shorter than the stream
+
+    {
+        asio::io_context io;
+
+        socket_type s1( io ), s2( io );
+        asio::local::connect_pair( s1, s2 );
+
+        asio::async_write( s2, asio::buffer( v ), writer{ s2 } );
+
+        std::size_t const k = n / 3;
+
+        H h;
+
+        boost::system::error_code ec2;
+        std::uint64_t m2 = 0;
+
+        async_hash( s1, h, asio::buffer( buffer ), k, [&]( boost::system::error_code ec, std::uint64_t m ){
+
+            ec2 = ec;
+            m2 = m;
+
+            s1.close();
+        });
+
+        io.run();
+
+        BOOST_TEST( !ec2 );
+        BOOST_TEST_EQ( m2, k );
+        BOOST_TEST( h.result() == expected<H>( v, k ) );
+    }
+
+    // a given size, longer than the stream
+
+    {
+        asio::io_context io;
+
+        socket_type s1( io ), s2( io );
+        asio::local::connect_pair( s1, s2 );
+
+        asio::async_write( s2, asio::buffer( v ), writer{ s2 } );
+
+        H h;
+
+        boost::system::error_code ec2;
+        std::uint64_t m2 = 0;
+
+        async_hash( s1, h, asio::buffer( buffer ), n + 1, [&]( boost::system::error_code ec, std::uint64_t m ){
+
+            ec2 = ec;
+            m2 = m;
+        });
+
+        io.run();
+
+        BOOST_TEST( ec2 == asio::error::eof );
+        BOOST_TEST_EQ( m2, n );
+        BOOST_TEST( h.result() == expected<H>( v, n ) );
+    }
+
+    // hashing on a strand of a thread pool
+
+    {
+        asio::io_context io;
+        asio::thread_pool pool( 2 );
+
+        socket_type s1( io ), s2( io );
+        asio::local::connect_pair( s1, s2 );
+
+        asio::async_write( s2, asio::buffer( v ), writer{ s2 } );
+
+        H h;
+
+        boost::system::error_code ec2;
+        std::uint64_t m2 = 0;
+
+        async_hash( asio::make_strand( pool ), s1, h, asio::buffer( buffer ), static_cast<std::uint64_t>( -1 ), [&]( boost::system::error_code ec, std::uint64_t m ){
+
+            ec2 = ec;
+            m2 = m;
+        });
+
+        io.run();
+        pool.join();
+
+        BOOST_TEST( !ec2 );
+        BOOST_TEST_EQ( m2, n );
+        BOOST_TEST( h.result() == expected<H>( v, n ) );
+    }
+}
+
+#if defined(BOOST_ASIO_HAS_CO_AWAIT)
+
+static asio::awaitable<void> hash_part( socket_type& s, std::uint64_t size, sha2_256::result_type& r )
+{
+    std::vector<unsigned char> buffer( 65536 );
+
+    sha2_256 h;
+    std::uint64_t m = co_await async_hash( s, h, asio::buffer( buffer ), size, asio::use_awaitable );
+
+    BOOST_TEST_EQ( m, size );
+
+    r = h.result();
+}
+
+static void test_coroutine( std::size_t n )
+{
+    std::vector<unsigned char> const v = make_data( n );
+
+    asio::io_context io;
+
+    socket_type s1( io ), s2( io );
+    asio::local::connect_pair( s1, s2 );
+
+    asio::async_write( s2, asio::buffer( v ), writer{ s2 } );
+
+    sha2_256::result_type r;
+
+    asio::co_spawn( io, hash_part( s1, n, r ), asio::detached );
+
+    io.run();
+
+    BOOST_TEST( r == expected<sha2_256>( v, n ) );
+}
+
+#endif
+
+int main()
+{
+    std::size_t const sizes[] = { 0, 1, 1000, 65536, 100000, 3 * 1024 * 1024 + 7 };
+
+    for( std::size_t n: sizes )
+    {
+        test<sha2_256>( n, 1000 );
+        test<sha2_256>( n, 65536 );
+        test<xxh3_128>( n, 1024 * 1024 );
+    }
+
+#if defined(BOOST_ASIO_HAS_CO_AWAIT)
+
+    test_coroutine( 0 );
+    test_coroutine( 1000000 );
+
+#endif
+
+    return boost::report_errors();
+}
+
+#endif
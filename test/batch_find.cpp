@@ -0,0 +1,162 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/batch_find.hpp>
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <unordered_map>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <cstddef>
+
+// a container without a bucket interface, as the open addressing ones
+
+template<class K, class V, class H> class flat_map
+{
+private:
+
+    std::unordered_map<K, V, H> m_;
+
+public:
+
+    using key_type = K;
+    using const_iterator = typename std::unordered_map<K, V, H>::const_iterator;
+
+    void emplace( K const& k, V const& v )
+    {
+        m_.emplace( k, v );
+    }
+
+    bool empty() const
+    {
+        return m_.empty();
+    }
+
+    const_iterator find( K const& k ) const
+    {
+        return m_.find( k );
+    }
+
+    const_iterator end() const
+    {
+        return m_.end();
+    }
+};
+
+template<class Map, class K> void test( Map const& m, std::vector<K> const& v )
+{
+    // every batch length, including partial groups
+
+    for( std::size_t n = 0; n <= v.size(); ++n )
+    {
+        std::vector<typename Map::const_iterator> r;
+        boost::hash2::batch_find( m, v.begin(), v.begin() + n, std::back_inserter( r ) );
+
+        BOOST_TEST_EQ( r.size(), n );
+
+        for( std::size_t i = 0; i < r.size(); ++i )
+        {
+            BOOST_TEST( r[ i ] == m.find( v[ i ] ) );
+        }
+    }
+
+    // output pointers
+
+    {
+        std::vector<typename Map::const_iterator> r( v.size() );
+
+        typename Map::const_iterator* p = boost::hash2::batch_find( m, v.begin(), v.end(), r.data() );
+
+        BOOST_TEST_EQ( p - r.data(), static_cast<std::ptrdiff_t>( v.size() ) );
+
+        for( std::size_t i = 0; i < r.size(); ++i )
+        {
+            BOOST_TEST( r[ i ] == m.find( v[ i ] ) );
+        }
+    }
+
+    // forward iterators
+
+    {
+        std::list<K> const w( v.begin(), v.end() );
+        std::vector<typename Map::const_iterator> r;
+
+        boost::hash2::batch_find( m, w.begin(), w.end(), std::back_inserter( r ) );
+
+        BOOST_TEST_EQ( r.size(), v.size() );
+
+        for( std::size_t i = 0; i < r.size(); ++i )
+        {
+            BOOST_TEST( r[ i ] == m.find( v[ i ] ) );
+        }
+    }
+}
+
+template<class Map, class K> void test( std::vector<K> const& keys, std::vector<K> const& probes )
+{
+    Map m;
+
+    // an empty container
+
+    test( m, probes );
+
+    for( std::size_t i = 0; i < keys.size(); ++i )
+    {
+        m.emplace( keys[ i ], static_cast<int>( i ) );
+    }
+
+    test( m, probes );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    BOOST_TEST_TRAIT_TRUE(( detail::has_bucket_interface< std::unordered_map<int, int> > ));
+    BOOST_TEST_TRAIT_TRUE(( detail::has_bucket_interface< boost::unordered_map<int, int> > ));
+    BOOST_TEST_TRAIT_FALSE(( detail::has_bucket_interface< flat_map<int, int, std::hash<int>> > ));
+
+    std::vector<std::uint64_t> k1, p1;
+    std::vector<std::string> k2, p2;
+
+    for( std::uint64_t i = 0; i < 53; ++i )
+    {
+        std::uint64_t x = i * 0x9E3779B97F4A7C15ull;
+
+        k1.push_back( x );
+        k2.push_back( "key_" + std::to_string( x ) );
+
+        // half of the probes are present
+
+        std::uint64_t y = ( i & 1 )? x: ~x;
+
+        p1.push_back( y );
+        p2.push_back( "key_" + std::to_string( y ) );
+    }
+
+    {
+        using H1 = boost::hash2::hash<std::uint64_t, xxhash_64>;
+
+        test< std::unordered_map<std::uint64_t, int, H1> >( k1, p1 );
+        test< boost::unordered_map<std::uint64_t, int, H1> >( k1, p1 );
+        test< flat_map<std::uint64_t, int, H1> >( k1, p1 );
+    }
+
+    {
+        using H2 = boost::hash2::hash<std::string, siphash_64>;
+
+        test< std::unordered_map<std::string, int, H2> >( k2, p2 );
+        test< boost::unordered_map<std::string, int, H2> >( k2, p2 );
+        test< flat_map<std::string, int, H2> >( k2, p2 );
+    }
+
+    return boost::report_errors();
+}
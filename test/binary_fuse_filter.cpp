@@ -0,0 +1,219 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/binary_fuse_filter.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <list>
+#include <memory>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> void test_strings( std::size_t n, unsigned threads )
+{
+    std::vector<std::string> v;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v.push_back( "key_" + std::to_string( i ) );
+    }
+
+    boost::hash2::binary_fuse_filter<std::string, H> const f( v.begin(), v.end(), threads );
+
+    BOOST_TEST_EQ( f.size(), n );
+
+    // no false negatives
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST( f.may_contain( v[ i ] ) );
+    }
+
+    // false positives, about 1/256
+
+    std::vector<std::string> w;
+
+    for( std::size_t i = 0; i < 100000; ++i )
+    {
+        w.push_back( "other_" + std::to_string( i ) );
+    }
+
+    std::size_t fp = 0;
+
+    for( std::size_t i = 0; i < w.size(); ++i )
+    {
+        fp += f.may_contain( w[ i ] );
+    }
+
+    if( n == 0 )
+    {
+        BOOST_TEST_EQ( fp, 0u );
+    }
+    else
+    {
+        BOOST_TEST_LT( fp, 600u );
+    }
+
+    // bits per key, including the headers
+
+    if( n >= 100000 )
+    {
+        BOOST_TEST_LT( f.data_size() * 8.0 / n, 10.0 );
+    }
+
+    // the batch query agrees with the single one
+
+    {
+        bool out[ 100 ];
+
+        f.may_contain( v.begin(), v.begin() + ( n < 100? n: 100 ), out );
+
+        for( std::size_t i = 0; i < n && i < 100; ++i )
+        {
+            BOOST_TEST( out[ i ] );
+        }
+
+        std::unique_ptr<bool[]> out2( new bool[ w.size() ] );
+        f.may_contain( w.begin(), w.end(), out2.get() );
+
+        for( std::size_t i = 0; i < w.size(); ++i )
+        {
+            BOOST_TEST_EQ( out2[ i ], f.may_contain( w[ i ] ) );
+        }
+    }
+
+    // queried in place
+
+    boost::hash2::binary_fuse_filter_view<std::string, H> fv;
+
+    BOOST_TEST( fv.load( f.data(), f.data_size() ) );
+    BOOST_TEST_EQ( fv.size(), n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST( fv.may_contain( v[ i ] ) );
+    }
+
+    for( std::size_t i = 0; i < 1000; ++i )
+    {
+        BOOST_TEST_EQ( fv.may_contain( w[ i ] ), f.may_contain( w[ i ] ) );
+    }
+
+    {
+        bool out[ 64 ];
+        fv.may_contain( w.begin(), w.begin() + 64, out );
+
+        for( std::size_t i = 0; i < 64; ++i )
+        {
+            BOOST_TEST_EQ( out[ i ], f.may_contain( w[ i ] ) );
+        }
+    }
+
+    // the serialized form doesn't depend on the number of threads
+
+    {
+        boost::hash2::binary_fuse_filter<std::string, H> const f2( v.begin(), v.end(), 1 );
+
+        BOOST_TEST_EQ( f2.data_size(), f.data_size() );
+        BOOST_TEST( std::memcmp( f2.data(), f.data(), f.data_size() ) == 0 );
+    }
+}
+
+template<class H> void test()
+{
+    test_strings<H>( 0, 1 );
+    test_strings<H>( 1, 1 );
+    test_strings<H>( 2, 1 );
+    test_strings<H>( 10, 1 );
+    test_strings<H>( 1000, 2 );
+    test_strings<H>( 100000, 4 );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<xxhash_64>();
+    test<siphash_64>();
+    test<sha2_256>();
+
+    // more than one shard
+
+    test_strings<xxhash_64>( 2500000, 0 );
+
+    // integers, from a list
+
+    {
+        std::list<std::uint32_t> v;
+
+        for( std::uint32_t i = 0; i < 10000; ++i )
+        {
+            v.push_back( i * 7 );
+        }
+
+        // duplicates
+
+        v.push_back( 7 );
+        v.push_back( 14 );
+
+        binary_fuse_filter<std::uint32_t, xxhash_64> const f( v.begin(), v.end() );
+
+        BOOST_TEST_EQ( f.size(), 10000u );
+
+        for( std::uint32_t i = 0; i < 10000; ++i )
+        {
+            BOOST_TEST( f.may_contain( i * 7 ) );
+        }
+
+        std::vector<std::uint32_t> w;
+
+        for( std::uint32_t i = 0; i < 1000; ++i )
+        {
+            w.push_back( i );
+        }
+
+        bool out[ 1000 ];
+        f.may_contain( w.begin(), w.end(), out );
+
+        for( std::uint32_t i = 0; i < 1000; ++i )
+        {
+            BOOST_TEST_EQ( out[ i ], f.may_contain( i ) );
+        }
+    }
+
+    // invalid serialized forms
+
+    {
+        std::vector<std::uint64_t> v( 1000 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = i;
+        }
+
+        binary_fuse_filter<std::uint64_t, xxhash_64> const f( v.begin(), v.end() );
+        binary_fuse_filter_view<std::uint64_t, xxhash_64> fv;
+
+        BOOST_TEST( !fv.load( f.data(), f.data_size() - 8 ) );
+        BOOST_TEST( !fv.load( f.data(), 16 ) );
+
+        std::vector<unsigned char> d( f.data(), f.data() + f.data_size() );
+
+        d[ 0 ] = 'x';
+        BOOST_TEST( !fv.load( d.data(), d.size() ) );
+
+        d[ 0 ] = 'h';
+        BOOST_TEST( fv.load( d.data(), d.size() ) );
+
+        d[ 32 ] = 1; // the first offset
+        BOOST_TEST( !fv.load( d.data(), d.size() ) );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,214 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/blake2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+template<class H> std::string keyed_digest( std::vector<unsigned char> const & key, unsigned char const* p, std::size_t n, std::size_t split )
+{
+    H h( key.data(), key.size() );
+
+    h.update( p, split );
+    h.update( p + split, n - split );
+
+    return to_string( h.result() );
+}
+
+struct test_vector
+{
+    std::size_t n;
+    char const* digest;
+};
+
+template<class H, std::size_t N> void test_keyed( test_vector const (&tv)[ N ], std::size_t key_size )
+{
+    // https://github.com/BLAKE2/BLAKE2/tree/master/testvectors
+    // key is 00 01 02 ..., message is 00 01 02 ...
+
+    std::vector<unsigned char> key( key_size );
+
+    for( std::size_t i = 0; i < key_size; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i );
+    }
+
+    unsigned char msg[ 256 ] = {};
+
+    for( std::size_t i = 0; i < 256; ++i )
+    {
+        msg[ i ] = static_cast<unsigned char>( i );
+    }
+
+    for( test_vector const& t: tv )
+    {
+        std::size_t const splits[] = { 0, 1, t.n / 3, t.n / 2, t.n };
+
+        for( std::size_t split: splits )
+        {
+            if( split > t.n ) continue;
+
+            BOOST_TEST_EQ( keyed_digest<H>( key, msg, t.n, split ), std::string( t.digest ) );
+        }
+    }
+}
+
+template<class H> void test_seeds( char const* long_key_abc )
+{
+    // the integer seed is used as an eight byte little-endian key
+
+    {
+        unsigned char const key[ 8 ] = { 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, 0x00 };
+
+        H h1( 0x0001020304050607ull );
+        H h2( key, 8 );
+
+        h1.update( "abc", 3 );
+        h2.update( "abc", 3 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // a zero seed is the same as no seed
+
+    {
+        H h1;
+        H h2( 0 );
+        H h3( static_cast<unsigned char const*>( 0 ), 0 );
+
+        typename H::result_type r1 = h1.result();
+
+        BOOST_TEST_EQ( h2.result(), r1 );
+        BOOST_TEST_EQ( h3.result(), r1 );
+    }
+
+    // byte seeds longer than the maximum key size are hashed to form the key
+
+    {
+        unsigned char key[ 100 ] = {};
+
+        for( std::size_t i = 0; i < 100; ++i )
+        {
+            key[ i ] = static_cast<unsigned char>( i % 251 );
+        }
+
+        H h( key, 100 );
+        h.update( "abc", 3 );
+
+        BOOST_TEST_EQ( to_string( h.result() ), std::string( long_key_abc ) );
+    }
+}
+
+static void test_kernels()
+{
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    using namespace boost::hash2::detail;
+
+    unsigned char block[ 128 ] = {};
+
+    for( int i = 0; i < 128; ++i )
+    {
+        block[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+    }
+
+    // the SSE4.1 and AVX2 BLAKE2b transforms must agree
+
+    if( has_x86_sse41() && has_x86_avx2() )
+    {
+        std::uint64_t h1[ 8 ] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+        std::uint64_t h2[ 8 ] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+        for( int i = 0; i < 16; ++i )
+        {
+            blake2b_compress_sse41( h1, block, i * 128, 0, i == 15? ~std::uint64_t( 0 ): 0 );
+            blake2b_compress_avx2( h2, block, i * 128, 0, i == 15? ~std::uint64_t( 0 ): 0 );
+        }
+
+        BOOST_TEST_ALL_EQ( h1, h1 + 8, h2, h2 + 8 );
+    }
+
+#endif
+}
+
+int main()
+{
+    using boost::hash2::blake2b_512;
+    using boost::hash2::blake2s_256;
+
+    // https://datatracker.ietf.org/doc/html/rfc7693#appendix-A
+
+    BOOST_TEST_EQ( digest<blake2b_512>( "" ), std::string( "786a02f742015903c6c6fd852552d272912f4740e15847618a86e217f71f5419d25e1031afee585313896444934eb04b903a685b1448b755d56f701afe9be2ce" ) );
+    BOOST_TEST_EQ( digest<blake2b_512>( "abc" ), std::string( "ba80a53f981c4d0d6a2797b69f12f6e94c212f14685ac4b74b12bb6fdbffa2d17d87c5392aab792dc252d5de4533cc9518d38aa8dbf1925ab92386edd4009923" ) );
+    BOOST_TEST_EQ( digest<blake2b_512>( "The quick brown fox jumps over the lazy dog" ), std::string( "a8add4bdddfd93e4877d2746e62817b116364a1fa7bc148d95090bc7333b3673f82401cf7aa2e4cb1ecd90296e3f14cb5413f8ed77be73045b13914cdcd6a918" ) );
+
+    BOOST_TEST_EQ( digest<blake2s_256>( "" ), std::string( "69217a3079908094e11121d042354a7c1f55b6482ca1a51e1b250dfd1ed0eef9" ) );
+    BOOST_TEST_EQ( digest<blake2s_256>( "abc" ), std::string( "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982" ) );
+    BOOST_TEST_EQ( digest<blake2s_256>( "The quick brown fox jumps over the lazy dog" ), std::string( "606beeec743ccbeff6cbcdf5d5302aa855c256c29b88c8ed331ea1a6bf3c8812" ) );
+
+    {
+        test_vector const tv[] =
+        {
+            { 0, "10ebb67700b1868efb4417987acf4690ae9d972fb7a590c2f02871799aaa4786b5e996e8f0f4eb981fc214b005f42d2ff4233499391653df7aefcbc13fc51568" },
+            { 1, "961f6dd1e4dd30f63901690c512e78e4b45e4742ed197c3c5e45c549fd25f2e4187b0bc9fe30492b16b0d0bc4ef9b0f34c7003fac09a5ef1532e69430234cebd" },
+            { 2, "da2cfbe2d8409a0f38026113884f84b50156371ae304c4430173d08a99d9fb1b983164a3770706d537f49e0c916d9f32b95cc37a95b99d857436f0232c88a965" },
+            { 63, "bd965bf31e87d70327536f2a341cebc4768eca275fa05ef98f7f1b71a0351298de006fba73fe6733ed01d75801b4a928e54231b38e38c562b2e33ea1284992fa" },
+            { 64, "65676d800617972fbd87e4b9514e1c67402b7a331096d3bfac22f1abb95374abc942f16e9ab0ead33b87c91968a6e509e119ff07787b3ef483e1dcdccf6e3022" },
+            { 65, "939fa189699c5d2c81ddd1ffc1fa207c970b6a3685bb29ce1d3e99d42f2f7442da53e95a72907314f4588399a3ff5b0a92beb3f6be2694f9f86ecf2952d5b41c" },
+            { 127, "76d2d819c92bce55fa8e092ab1bf9b9eab237a25267986cacf2b8ee14d214d730dc9a5aa2d7b596e86a1fd8fa0804c77402d2fcd45083688b218b1cdfa0dcbcb" },
+            { 128, "72065ee4dd91c2d8509fa1fc28a37c7fc9fa7d5b3f8ad3d0d7a25626b57b1b44788d4caf806290425f9890a3a2a35a905ab4b37acfd0da6e4517b2525c9651e4" },
+            { 129, "64475dfe7600d7171bea0b394e27c9b00d8e74dd1e416a79473682ad3dfdbb706631558055cfc8a40e07bd015a4540dcdea15883cbbf31412df1de1cd4152b91" },
+            { 255, "142709d62e28fcccd0af97fad0f8465b971e82201dc51070faa0372aa43e92484be1c1e73ba10906d5d1853db6a4106e0a7bf9800d373d6dee2d46d62ef2a461" },
+        };
+
+        test_keyed<blake2b_512>( tv, 64 );
+    }
+
+    {
+        test_vector const tv[] =
+        {
+            { 0, "48a8997da407876b3d79c0d92325ad3b89cbb754d86ab71aee047ad345fd2c49" },
+            { 1, "40d15fee7c328830166ac3f918650f807e7e01e177258cdc0a39b11f598066f1" },
+            { 2, "6bb71300644cd3991b26ccd4d274acd1adeab8b1d7914546c1198bbe9fc9d803" },
+            { 63, "c65382513f07460da39833cb666c5ed82e61b9e998f4b0c4287cee56c3cc9bcd" },
+            { 64, "8975b0577fd35566d750b362b0897a26c399136df07bababbde6203ff2954ed4" },
+            { 65, "21fe0ceb0052be7fb0f004187cacd7de67fa6eb0938d927677f2398c132317a8" },
+            { 127, "ddbfea75cc467882eb3483ce5e2e756a4f4701b76b445519e89f22d60fa86e06" },
+            { 128, "0c311f38c35a4fb90d651c289d486856cd1413df9b0677f53ece2cd9e477c60a" },
+            { 129, "46a73a8dd3e70f59d3942c01df599def783c9da82fd83222cd662b53dce7dbdf" },
+            { 255, "3fb735061abc519dfe979e54c1ee5bfad0a9d858b3315bad34bde999efd724dd" },
+        };
+
+        test_keyed<blake2s_256>( tv, 32 );
+    }
+
+    test_seeds<blake2b_512>( "9d31206fda9b18bf8f0dbc1f73487646fc5782ca91b079ef225c363c55b351e25d50872ba2842553d6a252178b8fbe7fe3506627260b2411a9fd68d43e23e3cb" );
+    test_seeds<blake2s_256>( "025830540646d71c2b8b81479a32739cbb855f94fb0157596c5c63e7232eb08a" );
+
+    // long inputs
+
+    {
+        std::string s( 1000000, 'a' );
+
+        BOOST_TEST_EQ( digest<blake2b_512>( s ), std::string( "98fb3efb7206fd19ebf69b6f312cf7b64e3b94dbe1a17107913975a793f177e1d077609d7fba363cbba00d05f7aa4e4fa8715d6428104c0a75643b0ff3fd3eaf" ) );
+        BOOST_TEST_EQ( digest<blake2s_256>( s ), std::string( "bec0c0e6cde5b67acb73b81f79a67a4079ae1c60dac9d2661af18e9f8b50dfa5" ) );
+    }
+
+    test_kernels();
+
+    return boost::report_errors();
+}
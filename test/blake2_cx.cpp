@@ -0,0 +1,78 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstring>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+BOOST_CXX14_CONSTEXPR unsigned char to_byte( char c )
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return 0xff;
+}
+
+template<std::size_t N, std::size_t M = ( N - 1 ) / 2>
+BOOST_CXX14_CONSTEXPR boost::hash2::digest<M> digest_from_hex( char const (&str)[ N ] )
+{
+    boost::hash2::digest<M> dgst = {};
+    auto* p = dgst.data();
+    for( unsigned i = 0; i < M; ++i ) {
+        auto c1 = to_byte( str[ 2 * i ] );
+        auto c2 = to_byte( str[ 2 * i + 1 ] );
+        p[ i ] = ( c1 << 4 ) | c2;
+    }
+    return dgst;
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v21[ 21 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v300[ 300 ] = {};
+
+    TEST_EQ( test<blake2b_512>( 0, v21 ), digest_from_hex( "5e1a41668016ef0054c9648f19da05c4e4afed9a1f10c7cf9f98d4e8aa8aa02e2a4b3a0edf39fc58d787122179811f569a13106b0e0b1d842e157bc04e649ef4" ) );
+    TEST_EQ( test<blake2b_512>( 0, v45 ), digest_from_hex( "fcfad60a5c65bd80913f850d432c0f524b38cf77d1fce9a00233470071da2c8c2e60ae55e69f71f81ca1547db548f150448a56bcfba4e50ba9d7332d6ac3ecf2" ) );
+    TEST_EQ( test<blake2b_512>( 0, v300 ), digest_from_hex( "104b2a75c9b7062f1e945d3d366fd4e451957579ea7ef16575578202532b5368ba7c41e39ef11c54258c7104bae569474adc0374a0ba26debe286490807f42d2" ) );
+
+    TEST_EQ( test<blake2b_512>( 7, v21 ), digest_from_hex( "de84ff2ef3186addc9864063da4a5f7df16eaf07e674d17e6c62639f04b20e8d20f5d23f1d4cab9e8de4f4a9bfd08ec8da918cfedc01a099fd611b4c0c63e2b0" ) );
+    TEST_EQ( test<blake2b_512>( 7, v45 ), digest_from_hex( "b4c57caf95de80a5896a2ecf761c21f8c392cbd45d6187cf6258532be56ba4c3aee83709998ae361994890be89fadc40b825a0d430cc458949b6cfe9a5b61636" ) );
+    TEST_EQ( test<blake2b_512>( 7, v300 ), digest_from_hex( "d5e2e7b7dbac9331bb32a527b6ea8539e5335451f2e0dcd57a0cea45e536ebe39065c0e22bad04dc51ee9ebfc6da313cba219751ddb4882b9656b6bae2edeac5" ) );
+
+    TEST_EQ( test<blake2s_256>( 0, v21 ), digest_from_hex( "84a4932014cde6a7e7b88ed1f80b26cce2faf029c4c3a954ab55e17af30518a6" ) );
+    TEST_EQ( test<blake2s_256>( 0, v45 ), digest_from_hex( "410c70962f4592eee1f1191ea03e39343d2d3bdb3a6f0997bbbe112871ca6eaa" ) );
+    TEST_EQ( test<blake2s_256>( 0, v300 ), digest_from_hex( "64f7eed441ede5fcfd68a1796231454da299c89f71566ced1cc8050ede4d1f3c" ) );
+
+    TEST_EQ( test<blake2s_256>( 7, v21 ), digest_from_hex( "8cd722431e9044d59a33b4d1e23e94516e131f3965a3000c64824f755410e7ca" ) );
+    TEST_EQ( test<blake2s_256>( 7, v45 ), digest_from_hex( "dbb540f7635e4b6bee91be079dc0986a6bc26d37345f8720991bfe9503a10d17" ) );
+    TEST_EQ( test<blake2s_256>( 7, v300 ), digest_from_hex( "200bc6377911aab3738848cac8ced27da3426208c877f382678d76bbdfdcbb4d" ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,212 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/blake3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+template<class H> std::string hash( char const* s )
+{
+    H h;
+
+    h.update( s, std::strlen( s ) );
+
+    return to_string( h.result() );
+}
+
+struct test_vector
+{
+    std::size_t n;
+    char const* digest;
+};
+
+static void test_kernels( std::vector<unsigned char> const& v )
+{
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    using namespace boost::hash2::detail;
+
+    unsigned char const* inputs[ 8 ] = {};
+
+    for( int j = 0; j < 8; ++j )
+    {
+        inputs[ j ] = v.data() + j * 1024;
+    }
+
+    for( std::uint64_t counter: { std::uint64_t( 0 ), std::uint64_t( 0xFFFFFFFC ) } )
+    {
+        unsigned char expected[ 8 * 32 ] = {};
+
+        for( int j = 0; j < 8; ++j )
+        {
+            blake3_core::hash_one( inputs[ j ], 16, counter + j, 0, blake3_core::CHUNK_START, blake3_core::CHUNK_END, expected + j * 32 );
+        }
+
+        if( has_x86_sse41() )
+        {
+            unsigned char out[ 4 * 32 ] = {};
+            blake3_hash_many_sse41( inputs, 16, blake3_constants<>::IV, counter, true, 0, blake3_core::CHUNK_START, blake3_core::CHUNK_END, blake3_constants<>::S, out );
+
+            BOOST_TEST( std::memcmp( out, expected, sizeof( out ) ) == 0 );
+        }
+
+        if( has_x86_avx2() )
+        {
+            unsigned char out[ 8 * 32 ] = {};
+            blake3_hash_many_avx2( inputs, 16, blake3_constants<>::IV, counter, true, 0, blake3_core::CHUNK_START, blake3_core::CHUNK_END, blake3_constants<>::S, out );
+
+            BOOST_TEST( std::memcmp( out, expected, sizeof( out ) ) == 0 );
+        }
+    }
+
+#else
+
+    (void)v;
+
+#endif
+}
+
+// the extended output, from the "extended_hash" entries of the test vectors
+
+static void test_xof( std::vector<unsigned char> const& v )
+{
+    using boost::hash2::blake3;
+
+    test_vector const tv[] =
+    {
+        { 0, "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262e00f03e7b69af26b7faaf09fcd333050338ddfe085b8cc869ca98b206c08243a26f5487789e8f660afe6c99ef9e0c52b92e7393024a80459cf91f476f9ffdbda7001c22e159b402631f277ca96f2defdf1078282314e763699a31c5363165421cce14d" },
+        { 1, "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213c3a6cb8bf623e20cdb535f8d1a5ffb86342d9c0b64aca3bce1d31f60adfa137b358ad4d79f97b47c3d5e79f179df87a3b9776ef8325f8329886ba42f07fb138bb502f4081cbcec3195c5871e6c23e2cc97d3c69a613eba131e5f1351f3f1da786545e5" },
+        { 1024, "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af71cf8107265ecdaf8505b95d8fcec83a98a6a96ea5109d2c179c47a387ffbb404756f6eeae7883b446b70ebb144527c2075ab8ab204c0086bb22b7c93d465efc57f8d917f0b385c6df265e77003b85102967486ed57db5c5ca170ba441427ed9afa684e" },
+        { 1025, "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444f4c4a22b4b399155358a994e52bf255de60035742ec71bd08ac275a1b51cc6bfe332b0ef84b409108cda080e6269ed4b3e2c3f7d722aa4cdc98d16deb554e5627be8f955c98e1d5f9565a9194cad0c4285f93700062d9595adb992ae68ff12800ab67a" },
+        { 3073, "7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd39a27ae3b79d68d89da9bf25bc27139ae65a324918a5f9b7828181e52cf373c84f35b639b7fccbb985b6f2fa56aea0c18f531203497b8bbd3a07ceb5926f1cab74d14bd66486d9a91eba99059a98bd1cd25876b2af5a76c3e9eed554ed72ea952b603bf" },
+    };
+
+    for( test_vector const& t: tv )
+    {
+        blake3 h;
+        h.update( v.data(), t.n );
+
+        // long enough for the eight block kernels
+
+        unsigned char out[ 1100 ] = {};
+        h.squeeze( out, sizeof( out ) );
+
+        unsigned char w[ 131 ] = {};
+        std::memcpy( w, out, sizeof( w ) );
+
+        BOOST_TEST_EQ( to_string( boost::hash2::digest<131>( w ) ), std::string( t.digest ) );
+
+        for( std::size_t n: { 0, 31, 64, 511, 512, 513, 1099 } )
+        {
+            unsigned char out2[ 1100 ] = {};
+            h.squeeze( out2, n );
+
+            BOOST_TEST( std::memcmp( out, out2, n ) == 0 );
+        }
+
+        BOOST_TEST( std::memcmp( out, h.result().data(), 32 ) == 0 );
+    }
+}
+
+int main()
+{
+    using boost::hash2::blake3;
+
+    BOOST_TEST_EQ( hash<blake3>( "" ), std::string( "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262" ) );
+    BOOST_TEST_EQ( hash<blake3>( "abc" ), std::string( "6437b3ac38465133ffb63b75273a8db548c558465d79db03fd359c6cd5bd9d85" ) );
+    BOOST_TEST_EQ( hash<blake3>( "The quick brown fox jumps over the lazy dog" ), std::string( "2f1514181aadccd913abd94cfa592701a5686ab23f8df1dff1b74710febc6d4a" ) );
+
+    // Test vectors from https://github.com/BLAKE3-team/BLAKE3/blob/master/test_vectors/test_vectors.json
+    // (the input is the byte sequence 0, 1, ..., 250, 0, 1, ...)
+
+    std::vector<unsigned char> v( 1024 * 1024 + 1 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    test_vector const tv[] =
+    {
+        { 0, "af1349b9f5f9a1a6a0404dea36dcc9499bcb25c9adc112b7cc9a93cae41f3262" },
+        { 1, "2d3adedff11b61f14c886e35afa036736dcd87a74d27b5c1510225d0f592e213" },
+        { 3, "e1be4d7a8ab5560aa4199eea339849ba8e293d55ca0a81006726d184519e647f" },
+        { 64, "4eed7141ea4a5cd4b788606bd23f46e212af9cacebacdc7d1f4c6dc7f2511b98" },
+        { 65, "de1e5fa0be70df6d2be8fffd0e99ceaa8eb6e8c93a63f2d8d1c30ecb6b263dee" },
+        { 1023, "10108970eeda3eb932baac1428c7a2163b0e924c9a9e25b35bba72b28f70bd11" },
+        { 1024, "42214739f095a406f3fc83deb889744ac00df831c10daa55189b5d121c855af7" },
+        { 1025, "d00278ae47eb27b34faecf67b4fe263f82d5412916c1ffd97c8cb7fb814b8444" },
+        { 2048, "e776b6028c7cd22a4d0ba182a8bf62205d2ef576467e838ed6f2529b85fba24a" },
+        { 2049, "5f4d72f40d7a5f82b15ca2b2e44b1de3c2ef86c426c95c1af0b6879522563030" },
+        { 3072, "b98cb0ff3623be03326b373de6b9095218513e64f1ee2edd2525c7ad1e5cffd2" },
+        { 3073, "7124b49501012f81cc7f11ca069ec9226cecb8a2c850cfe644e327d22d3e1cd3" },
+        { 4096, "015094013f57a5277b59d8475c0501042c0b642e531b0a1c8f58d2163229e969" },
+        { 4097, "9b4052b38f1c5fc8b1f9ff7ac7b27cd242487b3d890d15c96a1c25b8aa0fb995" },
+        { 5120, "9cadc15fed8b5d854562b26a9536d9707cadeda9b143978f319ab34230535833" },
+        { 5121, "628bd2cb2004694adaab7bbd778a25df25c47b9d4155a55f8fbd79f2fe154cff" },
+        { 6144, "3e2e5b74e048f3add6d21faab3f83aa44d3b2278afb83b80b3c35164ebeca205" },
+        { 6145, "f1323a8631446cc50536a9f705ee5cb619424d46887f3c376c695b70e0f0507f" },
+        { 7168, "61da957ec2499a95d6b8023e2b0e604ec7f6b50e80a9678b89d2628e99ada77a" },
+        { 7169, "a003fc7a51754a9b3c7fae0367ab3d782dccf28855a03d435f8cfe74605e7817" },
+        { 8192, "aae792484c8efe4f19e2ca7d371d8c467ffb10748d8a5a1ae579948f718a2a63" },
+        { 8193, "bab6c09cb8ce8cf459261398d2e7aef35700bf488116ceb94a36d0f5f1b7bc3b" },
+        { 16384, "f875d6646de28985646f34ee13be9a576fd515f76b5b0a26bb324735041ddde4" },
+        { 31744, "62b6960e1a44bcc1eb1a611a8d6235b6b4b78f32e7abc4fb4c6cdcce94895c47" },
+        { 102400, "bc3e3d41a1146b069abffad3c0d44860cf664390afce4d9661f7902e7943e085" },
+    };
+
+    for( test_vector const& t: tv )
+    {
+        std::size_t const splits[] = { 0, 1, 64, 1023, 1024, 1025, t.n / 3, t.n / 2, t.n };
+
+        for( std::size_t split: splits )
+        {
+            if( split > t.n ) continue;
+
+            blake3 h;
+
+            h.update( v.data(), split );
+            h.update( v.data() + split, t.n - split );
+
+            BOOST_TEST_EQ( to_string( h.result() ), std::string( t.digest ) );
+        }
+
+        {
+            blake3 h;
+
+            h.update_parallel( v.data(), t.n, 4 );
+
+            BOOST_TEST_EQ( to_string( h.result() ), std::string( t.digest ) );
+        }
+    }
+
+    // update_parallel agrees with update on inputs large enough to be split
+
+    for( std::size_t n: { std::size_t( 512 * 1024 ), std::size_t( 1024 * 1024 ), v.size() } )
+    {
+        blake3 h1;
+        h1.update( v.data(), n );
+
+        blake3::result_type const r1 = h1.result();
+
+        for( unsigned threads = 0; threads <= 5; ++threads )
+        {
+            blake3 h2;
+
+            h2.update( v.data(), 5 );
+            h2.update_parallel( v.data() + 5, n - 5, threads );
+
+            BOOST_TEST_EQ( h2.result(), r1 );
+        }
+    }
+
+    test_kernels( v );
+    test_xof( v );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,70 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstring>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+BOOST_CXX14_CONSTEXPR unsigned char to_byte( char c )
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return 0xff;
+}
+
+template<std::size_t N, std::size_t M = ( N - 1 ) / 2>
+BOOST_CXX14_CONSTEXPR boost::hash2::digest<M> digest_from_hex( char const (&str)[ N ] )
+{
+    boost::hash2::digest<M> dgst = {};
+    auto* p = dgst.data();
+    for( unsigned i = 0; i < M; ++i ) {
+        auto c1 = to_byte( str[ 2 * i ] );
+        auto c2 = to_byte( str[ 2 * i + 1 ] );
+        p[ i ] = ( c1 << 4 ) | c2;
+    }
+    return dgst;
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v21[ 21 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v1500[ 1500 ] = {};
+
+    TEST_EQ( test<blake3>( 0, v21 ), digest_from_hex( "a07a347ec1b10d5a09447ff17eaac2ecd30d982fd0811c6d34e6db7c22ca5abe" ) );
+    TEST_EQ( test<blake3>( 0, v45 ), digest_from_hex( "2696272cc03ce98d166a3c7d211fa9e03ac67b1c98197158c498652b15b91c86" ) );
+    TEST_EQ( test<blake3>( 0, v1500 ), digest_from_hex( "2b6bdcd04e093f0b2c2ddfe0d0b3522da3b078651bf764ca180732497b0215ce" ) );
+
+    TEST_EQ( test<blake3>( 7, v21 ), digest_from_hex( "ed43fab6e3852908253e22daa27f55a5b0fa5537cba7cab0045f5ca54a12431d" ) );
+    TEST_EQ( test<blake3>( 7, v45 ), digest_from_hex( "07de1cb2c4994e452ceb3e57516e7a1937d8e966c0c33d00fdf1266b19576fb2" ) );
+    TEST_EQ( test<blake3>( 7, v1500 ), digest_from_hex( "3f19bb3dc253b8c3784699216aff68a44f5e2159f8b977b66586a2edd4cdd792" ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,240 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/block_index.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_HASH2_HAS_POSIX_FILES is not defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <system_error>
+#include <cstdio>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static char const* const fn = "block_index_test.tmp";
+static char const* const ifn = "block_index_test.idx";
+
+static std::string make_data( std::size_t n, std::uint32_t seed )
+{
+    std::string s( n, ' ' );
+
+    std::uint32_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        s[ i ] = static_cast<char>( x >> 24 );
+    }
+
+    return s;
+}
+
+static bool write_file( char const* name, std::string const& s )
+{
+    std::FILE* f = std::fopen( name, "wb" );
+    if( f == 0 ) return false;
+
+    bool r = std::fwrite( s.data(), 1, s.size(), f ) == s.size();
+
+    return std::fclose( f ) == 0 && r;
+}
+
+static std::string read_file( char const* name )
+{
+    std::string s;
+
+    std::FILE* f = std::fopen( name, "rb" );
+    if( f == 0 ) return s;
+
+    char buffer[ 4096 ];
+
+    for( ;; )
+    {
+        std::size_t n = std::fread( buffer, 1, sizeof( buffer ), f );
+        if( n == 0 ) break;
+
+        s.append( buffer, n );
+    }
+
+    std::fclose( f );
+    return s;
+}
+
+template<class H> static void test( std::size_t size, std::size_t block_size )
+{
+    std::string s = make_data( size, static_cast<std::uint32_t>( size ) );
+    BOOST_TEST( write_file( fn, s ) );
+
+    std::error_code ec;
+
+    block_index<H> ix( block_size );
+
+    ix.build( fn, ec, 4 );
+    BOOST_TEST( !ec );
+
+    BOOST_TEST_EQ( ix.file_size(), size );
+    BOOST_TEST_EQ( ix.block_size(), block_size );
+    BOOST_TEST_EQ( ix.block_count(), ( size + block_size - 1 ) / block_size );
+
+    {
+        merkle_tree<H> tree( block_size );
+        tree.build( s.data(), s.size(), 1 );
+
+        BOOST_TEST( ix.root() == tree.root() );
+    }
+
+    ix.save( ifn, ec );
+    BOOST_TEST( !ec );
+
+    block_index<H> ix2;
+
+    ix2.load( ifn, ec );
+    BOOST_TEST( !ec );
+
+    BOOST_TEST_EQ( ix2.file_size(), size );
+    BOOST_TEST_EQ( ix2.block_size(), block_size );
+    BOOST_TEST_EQ( ix2.block_count(), ix.block_count() );
+    BOOST_TEST( ix2.root() == ix.root() );
+
+    BOOST_TEST( ix2.verify( fn, 0, size, ec, 4 ) );
+    BOOST_TEST( !ec );
+
+    BOOST_TEST( ix2.verify( fn, size / 3, size / 3, ec ) );
+    BOOST_TEST( ix2.verify( fn, size, 0, ec ) );
+
+    // past the end of the file
+
+    BOOST_TEST( !ix2.verify( fn, size / 2, size - size / 2 + 1, ec ) );
+    BOOST_TEST( !ix2.verify( fn, size + 1, 0, ec ) );
+
+    if( size == 0 ) return;
+
+    // a damaged byte is detected by the ranges that touch its block, and
+    // only by those
+
+    std::size_t const k = size / 2;
+
+    s[ k ] = static_cast<char>( s[ k ] ^ 0x40 );
+    BOOST_TEST( write_file( fn, s ) );
+
+    BOOST_TEST( !ix2.verify( fn, 0, size, ec, 4 ) );
+    BOOST_TEST( !ix2.verify( fn, k, 1, ec ) );
+    BOOST_TEST( !ec );
+
+    std::size_t const b = k / block_size * block_size;
+
+    if( b > 0 )
+    {
+        BOOST_TEST( ix2.verify( fn, 0, b, ec ) );
+    }
+
+    if( b + block_size < size )
+    {
+        BOOST_TEST( ix2.verify( fn, b + block_size, size - b - block_size, ec ) );
+    }
+
+    // a file of another size doesn't match
+
+    s[ k ] = static_cast<char>( s[ k ] ^ 0x40 );
+    s += 'x';
+
+    BOOST_TEST( write_file( fn, s ) );
+    BOOST_TEST( !ix2.verify( fn, 0, 1, ec ) );
+    BOOST_TEST( !ec );
+
+    // a damaged sidecar is rejected
+
+    std::string t = read_file( ifn );
+
+    if( t.size() > 64 )
+    {
+        std::string t2 = t;
+
+        t2.back() = static_cast<char>( t2.back() ^ 1 );
+        BOOST_TEST( write_file( ifn, t2 ) );
+
+        block_index<H> ix3;
+
+        ix3.load( ifn, ec );
+        BOOST_TEST( ec == std::errc::invalid_argument );
+
+        t2 = t;
+        t2.resize( t2.size() - 1 );
+        BOOST_TEST( write_file( ifn, t2 ) );
+
+        ix3.load( ifn, ec );
+        BOOST_TEST( ec == std::errc::invalid_argument );
+    }
+}
+
+int main()
+{
+    test<sha2_256>( 0, 4096 );
+    test<sha2_256>( 1, 4096 );
+    test<sha2_256>( 4096, 4096 );
+    test<sha2_256>( 100000, 4096 );
+    test<sha2_256>( 100000, 1000 );
+    test<blake3>( 1000000, 65536 );
+
+    // a sidecar for another algorithm is rejected
+
+    {
+        BOOST_TEST( write_file( fn, make_data( 10000, 1 ) ) );
+
+        std::error_code ec;
+
+        block_index<sha2_256> ix( 1024 );
+
+        ix.build( fn, ec );
+        BOOST_TEST( !ec );
+
+        ix.save( ifn, ec );
+        BOOST_TEST( !ec );
+
+        block_index<sha2_512> ix2;
+
+        ix2.load( ifn, ec );
+        BOOST_TEST( ec == std::errc::invalid_argument );
+
+        block_index<sha2_256> ix3;
+
+        ix3.load( ifn, ec );
+        BOOST_TEST( !ec );
+        BOOST_TEST( ix3.root() == ix.root() );
+    }
+
+    // missing files
+
+    {
+        std::remove( fn );
+        std::remove( ifn );
+
+        std::error_code ec;
+
+        block_index<sha2_256> ix;
+
+        ix.build( fn, ec );
+        BOOST_TEST( ec == std::errc::no_such_file_or_directory );
+
+        ix.load( ifn, ec );
+        BOOST_TEST( ec == std::errc::no_such_file_or_directory );
+    }
+
+    return boost::report_errors();
+}
+
+#endif
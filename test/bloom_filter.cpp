@@ -0,0 +1,162 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/bloom_filter.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+template<class F> void test_bloom_filter( F f, double max_fpr )
+{
+    int const N = 10000;
+
+    BOOST_TEST_GE( f.capacity(), 100000u );
+
+    for( int i = 0; i < N; ++i )
+    {
+        f.insert( i );
+    }
+
+    for( int i = 0; i < N; ++i )
+    {
+        BOOST_TEST( f.may_contain( i ) );
+    }
+
+    int fp = 0;
+
+    for( int i = N; i < 2 * N; ++i )
+    {
+        fp += f.may_contain( i );
+    }
+
+    BOOST_TEST_LT( fp, N * max_fpr );
+
+    // copies are independent
+
+    F f2( f );
+
+    BOOST_TEST( f2.may_contain( 1 ) );
+
+    f.clear();
+
+    BOOST_TEST_NOT( f.may_contain( 1 ) );
+    BOOST_TEST( f2.may_contain( 1 ) );
+
+    f = f2;
+
+    BOOST_TEST( f.may_contain( 1 ) );
+}
+
+template<class F> void test_batch( F f )
+{
+    std::vector<std::string> v;
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        v.push_back( std::to_string( i ) );
+    }
+
+    F f2( f );
+
+    f.insert( v.begin(), v.begin() + 500 );
+
+    for( int i = 0; i < 500; ++i )
+    {
+        f2.insert( v[ i ] );
+    }
+
+    bool r[ 1000 ];
+    f.may_contain( v.begin(), v.end(), r );
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        BOOST_TEST_EQ( r[ i ], f2.may_contain( v[ i ] ) );
+    }
+
+    for( int i = 0; i < 500; ++i )
+    {
+        BOOST_TEST( r[ i ] );
+    }
+
+    // the values are converted to T
+
+    char const* s[] = { "1", "2", "1000" };
+
+    bool r2[ 3 ];
+    f.may_contain( s, s + 3, r2 );
+
+    BOOST_TEST( r2[ 0 ] );
+    BOOST_TEST( r2[ 1 ] );
+    BOOST_TEST_EQ( r2[ 2 ], f.may_contain( "1000" ) );
+}
+
+template<class F> void test_counting_bloom_filter( F f )
+{
+    int const N = 1000;
+
+    for( int i = 0; i < N; ++i )
+    {
+        f.insert( i );
+    }
+
+    f.insert( 0 );
+
+    for( int i = 0; i < N; ++i )
+    {
+        BOOST_TEST( f.may_contain( i ) );
+    }
+
+    for( int i = 1; i < N; i += 2 )
+    {
+        BOOST_TEST( f.erase( i ) );
+    }
+
+    for( int i = 0; i < N; i += 2 )
+    {
+        BOOST_TEST( f.may_contain( i ) );
+    }
+
+    int fp = 0;
+
+    for( int i = 1; i < N; i += 2 )
+    {
+        fp += f.may_contain( i );
+    }
+
+    BOOST_TEST_LT( fp, N / 20 );
+
+    BOOST_TEST( f.erase( 0 ) );
+    BOOST_TEST( f.may_contain( 0 ) );
+
+    f.clear();
+
+    BOOST_TEST_NOT( f.may_contain( 0 ) );
+    BOOST_TEST_NOT( f.erase( 0 ) );
+}
+
+int main()
+{
+    test_bloom_filter( bloom_filter<int, xxhash_64, 5>( 100000 ), 0.03 );
+    test_bloom_filter( bloom_filter<int, xxh3_128, 7, 64>( 100000 ), 0.03 );
+    test_bloom_filter( bloom_filter<int, siphash_64, 4, 32>( 100000, 7 ), 0.04 );
+    test_bloom_filter( bloom_filter<int, xxhash_64, 3, 8>( 100000 ), 0.06 );
+
+    unsigned char const seed[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+    test_batch( bloom_filter<std::string, siphash_64, 6>( 10000, seed, sizeof(seed) ) );
+    test_batch( bloom_filter<std::string, fnv1a_32, 4, 8>( 10000 ) );
+
+    test_counting_bloom_filter( counting_bloom_filter<int, xxhash_64, 5>( 10000 ) );
+    test_counting_bloom_filter( counting_bloom_filter<int, siphash_64, 4>( 10000, 7 ) );
+
+    return boost::report_errors();
+}
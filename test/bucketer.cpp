@@ -0,0 +1,159 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/bucketer.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> void test()
+{
+    using namespace boost::hash2;
+
+    bucketer<H> b1( std::string( "checkout-button-color" ) );
+    bucketer<H> b2( std::string( "checkout-button-color" ) );
+    bucketer<H> b3( std::string( "search-ranking" ) );
+    bucketer<H> b4( std::string( "checkout-button-color" ), 1 );
+
+    BOOST_TEST_EQ( b1.salt(), b2.salt() );
+    BOOST_TEST_NE( b1.salt(), b3.salt() );
+    BOOST_TEST_NE( b1.salt(), b4.salt() );
+
+    std::size_t const N = 100000;
+
+    std::vector<std::uint64_t> ids;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        ids.push_back( i * 1000003 );
+    }
+
+    // the hash value of a key is that of H( salt ) after hash_append
+
+    {
+        H h( b1.salt() );
+        hash_append( h, default_flavor(), ids[ 7 ] );
+
+        BOOST_TEST_EQ( b1.hash_value( ids[ 7 ] ), get_integral_result<std::uint64_t>( h.result() ) );
+    }
+
+    // the batch functions agree with the scalar ones
+
+    std::vector<std::uint64_t> hv;
+    b1.hash_values( ids.begin(), ids.end(), std::back_inserter( hv ) );
+
+    std::vector<std::size_t> bk;
+    b1.buckets( ids.begin(), ids.end(), 10, std::back_inserter( bk ) );
+
+    std::vector<double> ps;
+    b1.positions( ids.begin(), ids.end(), std::back_inserter( ps ) );
+
+    std::vector<std::uint64_t> sm;
+    b1.sample( ids.begin(), ids.end(), 0.1, std::back_inserter( sm ) );
+
+    BOOST_TEST_EQ( hv.size(), N );
+    BOOST_TEST_EQ( bk.size(), N );
+    BOOST_TEST_EQ( ps.size(), N );
+
+    std::size_t counts[ 10 ] = {};
+    std::size_t sampled = 0;
+    std::size_t same = 0;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( hv[ i ], b1.hash_value( ids[ i ] ) );
+        BOOST_TEST_EQ( bk[ i ], b1.bucket( ids[ i ], 10 ) );
+        BOOST_TEST_EQ( ps[ i ], b1.position( ids[ i ] ) );
+
+        BOOST_TEST_EQ( b1.bucket( ids[ i ], 10 ), b2.bucket( ids[ i ], 10 ) );
+
+        BOOST_TEST_GE( ps[ i ], 0.0 );
+        BOOST_TEST_LT( ps[ i ], 1.0 );
+
+        BOOST_TEST_EQ( b1.sampled( ids[ i ], 0.1 ), ps[ i ] < 0.1 );
+
+        // samples of lower rates are subsets of those of higher rates
+
+        if( b1.sampled( ids[ i ], 0.01 ) )
+        {
+            BOOST_TEST( b1.sampled( ids[ i ], 0.1 ) );
+        }
+
+        BOOST_TEST( !b1.sampled( ids[ i ], 0.0 ) );
+        BOOST_TEST( b1.sampled( ids[ i ], 1.0 ) );
+
+        ++counts[ bk[ i ] ];
+        sampled += b1.sampled( ids[ i ], 0.1 );
+        same += b1.bucket( ids[ i ], 10 ) == b3.bucket( ids[ i ], 10 );
+    }
+
+    BOOST_TEST_EQ( sm.size(), sampled );
+
+    for( std::size_t i = 0, j = 0; i < N; ++i )
+    {
+        if( b1.sampled( ids[ i ], 0.1 ) )
+        {
+            BOOST_TEST( j < sm.size() ) && BOOST_TEST_EQ( sm[ j ], ids[ i ] );
+            ++j;
+        }
+    }
+
+    // the buckets are about equally likely, and independent across
+    // experiments
+
+    for( std::size_t k = 0; k < 10; ++k )
+    {
+        BOOST_TEST_GT( counts[ k ], N / 10 * 95 / 100 );
+        BOOST_TEST_LT( counts[ k ], N / 10 * 105 / 100 );
+    }
+
+    BOOST_TEST_GT( sampled, N / 10 * 95 / 100 );
+    BOOST_TEST_LT( sampled, N / 10 * 105 / 100 );
+
+    BOOST_TEST_GT( same, N / 10 * 90 / 100 );
+    BOOST_TEST_LT( same, N / 10 * 110 / 100 );
+
+    // string keys
+
+    {
+        std::vector<std::string> v = { "alice", "bob", "carol", "dave", "eve", "frank", "grace", "heidi", "ivan", "judy" };
+
+        std::vector<std::size_t> r;
+        b1.buckets( v.begin(), v.end(), 3, std::back_inserter( r ) );
+
+        BOOST_TEST_EQ( r.size(), v.size() );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            BOOST_TEST_EQ( r[ i ], b1.bucket( v[ i ], 3 ) );
+        }
+    }
+
+    // empty ranges
+
+    {
+        std::vector<std::size_t> r;
+        b1.buckets( ids.begin(), ids.begin(), 3, std::back_inserter( r ) );
+
+        BOOST_TEST( r.empty() );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::siphash_64>();
+
+    return boost::report_errors();
+}
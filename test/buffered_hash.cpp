@@ -0,0 +1,136 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/buffered_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <type_traits>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+struct X
+{
+    std::uint32_t a;
+    std::uint64_t b;
+    unsigned char c;
+    std::string d;
+    std::vector<double> e;
+};
+
+template<class Hash, class Flavor> void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, X const& v )
+{
+    boost::hash2::hash_append( h, f, v.a );
+    boost::hash2::hash_append( h, f, v.b );
+    boost::hash2::hash_append( h, f, v.c );
+    boost::hash2::hash_append( h, f, v.d );
+    boost::hash2::hash_append( h, f, v.e );
+}
+
+template<class H, class B> void test()
+{
+    BOOST_TEST_TRAIT_SAME( typename B::result_type, typename H::result_type );
+
+    unsigned char buffer[ 1024 ];
+
+    for( int i = 0; i < 1024; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    // a mix of small, medium and large writes
+
+    std::size_t const sizes[] = { 1, 3, 8, 0, 7, 64, 2, 255, 256, 257, 5, 1, 300 };
+
+    {
+        H h1( 7 );
+        B h2( 7 );
+
+        std::size_t k = 0;
+
+        for( std::size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i )
+        {
+            h1.update( buffer + k, sizes[ i ] );
+            h2.update( buffer + k, sizes[ i ] );
+
+            k += sizes[ i ];
+
+            // intermediate results cover the flush in result()
+
+            H h3( h1 );
+            B h4( h2 );
+
+            BOOST_TEST( h3.result() == h4.result() );
+        }
+
+        BOOST_TEST( h1.result() == h2.result() );
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        H h1( buffer, 17 );
+        B h2( buffer, 17 );
+
+        h1.update( buffer, 1000 );
+        h2.update( buffer, 1000 );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        H h1;
+        B h2;
+
+        X x = { 1, 2, 3, "a string", { 1.0, 2.0, 3.0 } };
+
+        for( int i = 0; i < 40; ++i )
+        {
+            hash_append( h1, {}, x );
+            hash_append( h2, {}, x );
+
+            hash_append( h1, {}, static_cast<std::uint64_t>( i ) );
+            hash_append( h2, {}, static_cast<std::uint64_t>( i ) );
+        }
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+}
+
+template<class H, class En = void> struct has_block_size: std::false_type
+{
+};
+
+template<class H> struct has_block_size<H, decltype( (void)H::block_size )>: std::true_type
+{
+};
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test< fnv1a_32, buffered_hash<fnv1a_32> >();
+    test< xxhash_64, buffered_hash<xxhash_64> >();
+    test< xxhash_64, buffered_hash<xxhash_64, 8> >();
+    test< siphash_64, buffered_hash<siphash_64, 64> >();
+    test< sha2_256, buffered_hash<sha2_256> >();
+    test< sha2_512, buffered_hash<sha2_512, 1000> >();
+
+    BOOST_TEST_TRAIT_FALSE(( has_block_size< buffered_hash<xxhash_64> > ));
+    BOOST_TEST_TRAIT_TRUE(( has_block_size< buffered_hash<sha2_256> > ));
+
+    BOOST_TEST_EQ( buffered_hash<sha2_256>::block_size, sha2_256::block_size );
+
+    // usable as the underlying algorithm of hmac
+
+    test< hmac_sha2_256, hmac< buffered_hash<sha2_256> > >();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,51 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/buffered_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(disable: 4307) // integral constant overflow
+#endif
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, 3 );
+    h.update( v + 3, 1 );
+    h.update_word( 0x0102030405060708ull );
+    h.update( v + 4, N - 4 );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v45[ 45 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21 };
+
+    TEST_EQ( (test< buffered_hash<fnv1a_64> >( 7, v45 )), test<fnv1a_64>( 7, v45 ) );
+    TEST_EQ( (test< buffered_hash<xxhash_64, 16> >( 7, v45 )), test<xxhash_64>( 7, v45 ) );
+    TEST_EQ( (test< buffered_hash<siphash_64, 16> >( 7, v45 )), test<siphash_64>( 7, v45 ) );
+
+    return boost::report_errors();
+}
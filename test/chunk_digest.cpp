@@ -0,0 +1,122 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/chunk_digest.hpp>
+#include <boost/hash2/fastcdc.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::vector<unsigned char> make_data( std::size_t n )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint32_t x = 1;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return v;
+}
+
+template<class H> static void test( fastcdc const& c, H const& h, unsigned threads, std::vector<std::size_t> const& pieces )
+{
+    std::vector<unsigned char> v = make_data( 1 << 22 );
+
+    // the expected records
+
+    std::vector<std::size_t> sizes;
+    c.split( v.data(), v.size(), sizes );
+
+    std::vector< chunk_record<H> > expected;
+
+    {
+        std::uint64_t offset = 0;
+
+        for( std::size_t s: sizes )
+        {
+            H h2( h );
+            h2.update( v.data() + offset, s );
+
+            chunk_record<H> r = { offset, s, h2.result() };
+            expected.push_back( r );
+
+            offset += s;
+        }
+    }
+
+    chunk_digester<H> d( c, h, threads );
+
+    std::vector< chunk_record<H> > actual;
+
+    auto f = [&]( chunk_record<H> const& r ){ actual.push_back( r ); };
+
+    std::size_t k = 0;
+
+    for( std::size_t i = 0; k < v.size(); ++i )
+    {
+        std::size_t n = pieces[ i % pieces.size() ];
+        if( n > v.size() - k ) n = v.size() - k;
+
+        d.update( v.data() + k, n, f );
+        k += n;
+
+        BOOST_TEST_LE( d.offset(), k );
+    }
+
+    d.finish( f );
+
+    BOOST_TEST_EQ( actual.size(), expected.size() );
+
+    for( std::size_t i = 0; i < actual.size() && i < expected.size(); ++i )
+    {
+        BOOST_TEST_EQ( actual[ i ].offset, expected[ i ].offset );
+        BOOST_TEST_EQ( actual[ i ].size, expected[ i ].size );
+        BOOST_TEST( actual[ i ].digest == expected[ i ].digest );
+    }
+
+    BOOST_TEST_EQ( d.offset(), 0u );
+}
+
+template<class H> static void test( H const& h )
+{
+    fastcdc c( 2048, 8192, 65536 );
+
+    for( unsigned threads: { 1, 2, 4, 0 } )
+    {
+        test( c, h, threads, { std::size_t( 1 ) << 22 } );
+        test( c, h, threads, { std::size_t( 1 ) << 20, 100, 1000, 300000 } );
+        test( c, h, threads, { 1000, 1 } );
+        test( c, h, threads, { 65536, 65535, 65537 } );
+    }
+}
+
+int main()
+{
+    test( sha2_256() );
+    test( blake3() );
+    test( xxh3_128( 7 ) );
+
+    // empty input
+
+    {
+        chunk_digester<sha2_256> d( fastcdc( 64, 256, 1024 ) );
+
+        std::size_t n = 0;
+        d.finish( [&]( chunk_record<sha2_256> const& ){ ++n; } );
+
+        BOOST_TEST_EQ( n, 0u );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,57 @@
+// Copyright 2017, 2023, 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+import boost.hash2;
+
+struct X
+{
+    int a;
+    std::string b;
+
+    template<class Hash, class Flavor>
+    friend constexpr void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, X const& x )
+    {
+        boost::hash2::hash_append( h, f, x.a );
+        boost::hash2::hash_append( h, f, x.b );
+    }
+};
+
+// hash_append is still constexpr
+
+constexpr std::uint32_t hash_foobar()
+{
+    boost::hash2::fnv1a_32 hash;
+
+    char const str[ 6 ] = { 'f', 'o', 'o', 'b', 'a', 'r' };
+
+    boost::hash2::hash_append( hash, {}, str );
+
+    return hash.result();
+}
+
+static_assert( hash_foobar() == 0xbf9cf968ul, "hash_foobar() == 0xbf9cf968ul" );
+
+int main()
+{
+    boost::hash2::sha2_256 h1;
+
+    boost::hash2::hash_append( h1, {}, std::vector<int>{ 1, 2, 3 } );
+    boost::hash2::hash_append( h1, {}, X{ 1, "x" } );
+
+    boost::hash2::digest<32> d1 = h1.result();
+
+    boost::hash2::sha2_256 h2;
+
+    boost::hash2::hash_append( h2, {}, std::vector<int>{ 1, 2, 3 } );
+    boost::hash2::hash_append( h2, {}, 1 );
+    boost::hash2::hash_append( h2, {}, std::string( "x" ) );
+
+    boost::hash2::digest<32> d2 = h2.result();
+
+    return d1 == d2 && !( d1 < d2 ) && boost::hash2::to_string( d1 ).size() == 64? 0: 1;
+}
@@ -0,0 +1,146 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/combine_columns.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::vector< std::vector<std::uint64_t> > make_columns( std::size_t k, std::size_t n )
+{
+    std::vector< std::vector<std::uint64_t> > r( k, std::vector<std::uint64_t>( n ) );
+
+    std::uint64_t x = 1;
+
+    for( std::size_t j = 0; j < k; ++j )
+    {
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            x = x * 6364136223846793005ull + 1442695040888963407ull;
+            r[ j ][ i ] = x;
+        }
+    }
+
+    return r;
+}
+
+static std::vector<std::uint64_t> combine( std::vector< std::vector<std::uint64_t> > const& v, std::size_t n, std::uint64_t seed )
+{
+    std::vector<std::uint64_t const*> p;
+
+    for( auto const& c: v )
+    {
+        p.push_back( c.data() );
+    }
+
+    std::vector<std::uint64_t> r( n );
+    combine_columns( p.data(), p.size(), n, r.data(), seed );
+
+    return r;
+}
+
+static void test( std::size_t k, std::size_t n, std::uint64_t seed )
+{
+    std::vector< std::vector<std::uint64_t> > const v = make_columns( k, n );
+    std::vector<std::uint64_t> const r = combine( v, n, seed );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        mix64 h( seed );
+
+        for( std::size_t j = 0; j < k; ++j )
+        {
+            hash_append( h, {}, v[ j ][ i ] );
+        }
+
+        BOOST_TEST_EQ( r[ i ], h.result() );
+    }
+}
+
+template<class... T> static std::uint64_t hv( std::uint64_t seed, std::tuple<T...> const& t )
+{
+    mix64 h( seed );
+    hash_append( h, {}, t );
+
+    return h.result();
+}
+
+int main()
+{
+    for( std::size_t k = 0; k <= 5; ++k )
+    {
+        for( std::size_t n: { 0, 1, 3, 4, 7, 8, 9, 17, 100, 257 } )
+        {
+            test( k, n, 0 );
+            test( k, n, 7 );
+        }
+    }
+
+    // the result is that of hash_append of a tuple
+
+    {
+        std::size_t const n = 19;
+
+        std::vector< std::vector<std::uint64_t> > const v = make_columns( 3, n );
+
+        std::vector<std::uint64_t> const r1 = combine( { v[ 0 ] }, n, 5 );
+        std::vector<std::uint64_t> const r2 = combine( { v[ 0 ], v[ 1 ] }, n, 5 );
+        std::vector<std::uint64_t> const r3 = combine( v, n, 5 );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( r1[ i ], hv( 5, std::make_tuple( v[ 0 ][ i ] ) ) );
+            BOOST_TEST_EQ( r2[ i ], hv( 5, std::make_tuple( v[ 0 ][ i ], v[ 1 ][ i ] ) ) );
+            BOOST_TEST_EQ( r3[ i ], hv( 5, std::make_tuple( v[ 0 ][ i ], v[ 1 ][ i ], v[ 2 ][ i ] ) ) );
+        }
+    }
+
+    // the order of the columns matters
+
+    {
+        std::size_t const n = 33;
+
+        std::vector< std::vector<std::uint64_t> > const v = make_columns( 2, n );
+
+        std::vector<std::uint64_t> const r1 = combine( { v[ 0 ], v[ 1 ] }, n, 0 );
+        std::vector<std::uint64_t> const r2 = combine( { v[ 1 ], v[ 0 ] }, n, 0 );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_NE( r1[ i ], r2[ i ] );
+        }
+
+        // and equal values in different columns don't cancel out
+
+        std::vector<std::uint64_t> const r3 = combine( { v[ 0 ], v[ 0 ] }, n, 0 );
+        std::vector<std::uint64_t> const r4 = combine( { v[ 1 ], v[ 1 ] }, n, 0 );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_NE( r3[ i ], r4[ i ] );
+        }
+    }
+
+    // out may be one of the columns
+
+    {
+        std::size_t const n = 29;
+
+        std::vector< std::vector<std::uint64_t> > v = make_columns( 3, n );
+        std::vector<std::uint64_t> const r = combine( v, n, 3 );
+
+        std::uint64_t const* p[] = { v[ 0 ].data(), v[ 1 ].data(), v[ 2 ].data() };
+        combine_columns( p, 3, n, v[ 1 ].data(), 3 );
+
+        BOOST_TEST( v[ 1 ] == r );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,268 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/concat_hash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::uint64_t const P = ( std::uint64_t( 1 ) << 61 ) - 1;
+
+// a * b mod P, by doubling
+
+static std::uint64_t mulmod( std::uint64_t a, std::uint64_t b )
+{
+    std::uint64_t r = 0;
+
+    for( ; b != 0; b >>= 1 )
+    {
+        if( b & 1 ) r = ( r + a ) % P;
+        a = ( a + a ) % P;
+    }
+
+    return r;
+}
+
+template<class H> static std::uint64_t reference( concat_hash<H> const& h, std::string const& s )
+{
+    std::uint64_t const k = h.power( 1 );
+
+    std::uint64_t r = 0;
+
+    for( unsigned char c: s )
+    {
+        r = ( mulmod( r, k ) + c + 1 ) % P;
+    }
+
+    return r;
+}
+
+template<class H> static concat_hash<H> make( std::uint64_t seed, std::string const& s )
+{
+    concat_hash<H> h( seed );
+    h.update( s.data(), s.size() );
+
+    return h;
+}
+
+// a rope, whose nodes keep the value and the power of their subtrees
+
+struct node
+{
+    std::string leaf;
+    std::size_t size;
+
+    std::unique_ptr<node> left, right;
+
+    std::uint64_t value;
+    std::uint64_t power;
+};
+
+// leaves are hashed with hash_append_range, which passes the characters
+// of a string without its size
+
+template<class H> static void update_leaf( concat_hash<H> h, node& x )
+{
+    hash_append_range( h, {}, x.leaf.begin(), x.leaf.end() );
+
+    x.size = x.leaf.size();
+    x.value = h.value();
+    x.power = h.power();
+}
+
+template<class H> static void update_node( node& x )
+{
+    x.size = x.left->size + x.right->size;
+    x.value = concat_hash<H>::combine( x.left->value, x.right->value, x.right->power );
+    x.power = concat_hash<H>::combine( x.left->power, 0, x.right->power );
+}
+
+template<class H> static std::unique_ptr<node> make_rope( concat_hash<H> const& h0, std::string const& s, std::size_t leaf_size )
+{
+    std::unique_ptr<node> p( new node );
+
+    if( s.size() <= leaf_size )
+    {
+        p->leaf = s;
+        update_leaf( h0, *p );
+    }
+    else
+    {
+        std::size_t const m = s.size() / 3;
+
+        p->left = make_rope( h0, s.substr( 0, m ), leaf_size );
+        p->right = make_rope( h0, s.substr( m ), leaf_size );
+
+        update_node<H>( *p );
+    }
+
+    return p;
+}
+
+// replaces the character at position i, and recomputes the path to the
+// root; returns the number of nodes recomputed
+
+template<class H> static std::size_t edit( concat_hash<H> const& h0, node& x, std::size_t i, char c )
+{
+    if( !x.left )
+    {
+        x.leaf[ i ] = c;
+        update_leaf( h0, x );
+
+        return 1;
+    }
+
+    std::size_t r = i < x.left->size? edit( h0, *x.left, i, c ): edit( h0, *x.right, i - x.left->size, c );
+
+    update_node<H>( x );
+
+    return r + 1;
+}
+
+template<class H> static void test()
+{
+    std::string s;
+
+    for( std::size_t i = 0; i < 300; ++i )
+    {
+        s += static_cast<char>( i * 37 + ( i >> 3 ) );
+    }
+
+    // the value is the polynomial of the bytes plus one
+
+    for( std::size_t n = 0; n <= s.size(); n += n < 20? 1: 23 )
+    {
+        std::string const s2 = s.substr( 0, n );
+
+        concat_hash<H> const h = make<H>( 7, s2 );
+
+        BOOST_TEST_EQ( h.value(), reference( h, s2 ) );
+        BOOST_TEST_EQ( h.size(), n );
+        BOOST_TEST_EQ( h.power(), h.power( n ) );
+
+        // and doesn't depend on how the bytes are passed
+
+        concat_hash<H> h2( 7 );
+
+        for( char c: s2 )
+        {
+            h2.update( &c, 1 );
+        }
+
+        BOOST_TEST_EQ( h2.value(), h.value() );
+        BOOST_TEST_EQ( h2.power(), h.power() );
+    }
+
+    // the value of a concatenation, from the values of the parts
+
+    for( std::size_t m = 0; m <= 40; ++m )
+    {
+        std::string const a = s.substr( 0, m );
+        std::string const b = s.substr( m, 45 );
+
+        concat_hash<H> const ha = make<H>( 7, a );
+        concat_hash<H> const hb = make<H>( 7, b );
+        concat_hash<H> const hab = make<H>( 7, a + b );
+
+        BOOST_TEST_EQ( concat_hash<H>::combine( ha.value(), hb.value(), hb.power() ), hab.value() );
+        BOOST_TEST_EQ( concat_hash<H>::combine( ha.value(), hb.value(), ha.power( b.size() ) ), hab.value() );
+        BOOST_TEST_EQ( concat_hash<H>::combine( ha.power(), 0, hb.power() ), hab.power() );
+
+        concat_hash<H> h( ha );
+        h.append( hb );
+
+        BOOST_TEST_EQ( h.value(), hab.value() );
+        BOOST_TEST_EQ( h.power(), hab.power() );
+        BOOST_TEST_EQ( h.size(), hab.size() );
+
+        // the state can be continued after append
+
+        h.update( a.data(), a.size() );
+
+        BOOST_TEST_EQ( h.value(), make<H>( 7, a + b + a ).value() );
+    }
+
+    // leading zero bytes aren't lost
+
+    {
+        std::string const z( 1, '\0' );
+
+        BOOST_TEST_NE( make<H>( 7, "a" ).value(), make<H>( 7, z + "a" ).value() );
+        BOOST_TEST_NE( make<H>( 7, "" ).value(), make<H>( 7, z ).value() );
+        BOOST_TEST_NE( make<H>( 7, z ).value(), make<H>( 7, z + z ).value() );
+
+        BOOST_TEST_EQ( make<H>( 7, "" ).value(), 0u );
+        BOOST_TEST_EQ( make<H>( 7, "" ).power(), 1u );
+    }
+
+    // the seed determines k
+
+    {
+        concat_hash<H> const h1( 7 );
+        concat_hash<H> const h2( 8 );
+        concat_hash<H> const h3;
+
+        BOOST_TEST_NE( h1.power( 1 ), h2.power( 1 ) );
+        BOOST_TEST_NE( h1.power( 1 ), h3.power( 1 ) );
+
+        BOOST_TEST_NE( make<H>( 7, s ).value(), make<H>( 8, s ).value() );
+
+        unsigned char const seed[] = { 1, 2, 3 };
+        concat_hash<H> const h4( seed, sizeof( seed ) );
+
+        BOOST_TEST_NE( h4.power( 1 ), h3.power( 1 ) );
+        BOOST_TEST_LT( h4.power( 1 ), P );
+        BOOST_TEST_GE( h4.power( 1 ), 2u );
+    }
+
+    // result is the value, after which the state advances
+
+    {
+        concat_hash<H> h = make<H>( 7, s );
+
+        std::uint64_t const r1 = h.result();
+        std::uint64_t const r2 = h.result();
+
+        BOOST_TEST_EQ( r1, make<H>( 7, s ).value() );
+        BOOST_TEST_EQ( r2, make<H>( 7, s + '\xFF' ).value() );
+        BOOST_TEST_NE( r1, r2 );
+    }
+
+    // a rope only recomputes the path to an edited leaf
+
+    {
+        concat_hash<H> const h0( 7 );
+
+        std::string t = s + s + s;
+        std::unique_ptr<node> rope = make_rope( h0, t, 16 );
+
+        BOOST_TEST_EQ( rope->value, make<H>( 7, t ).value() );
+        BOOST_TEST_EQ( rope->power, make<H>( 7, t ).power() );
+
+        for( std::size_t i = 0; i < t.size(); i += 41 )
+        {
+            t[ i ] = static_cast<char>( t[ i ] + 1 );
+
+            std::size_t const k = edit( h0, *rope, i, t[ i ] );
+
+            BOOST_TEST_LE( k, 16u );
+            BOOST_TEST_EQ( rope->value, make<H>( 7, t ).value() );
+        }
+    }
+}
+
+int main()
+{
+    test<siphash_64>();
+    test<sha2_256>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,186 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/concurrent_digest_map.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static digest<32> make_key( std::uint64_t k )
+{
+    sha2_256 h;
+    h.update( &k, sizeof( k ) );
+    return h.result();
+}
+
+static void test_single()
+{
+    concurrent_digest_map<32, std::string> m( 1000 );
+
+    BOOST_TEST_EQ( m.size(), 0u );
+    BOOST_TEST_GE( m.capacity(), 1000u );
+
+    for( std::uint64_t i = 0; i < 1000; ++i )
+    {
+        BOOST_TEST( m.find( make_key( i ) ) == nullptr );
+
+        auto r = m.insert( make_key( i ), std::to_string( i ) );
+
+        BOOST_TEST( r.second );
+        BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, std::to_string( i ) );
+    }
+
+    BOOST_TEST_EQ( m.size(), 1000u );
+
+    for( std::uint64_t i = 0; i < 1000; ++i )
+    {
+        auto r = m.emplace( make_key( i ), "x" );
+
+        BOOST_TEST( !r.second );
+        BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, std::to_string( i ) );
+
+        std::string const* p = m.find( make_key( i ) );
+
+        BOOST_TEST_EQ( p, r.first );
+        BOOST_TEST( m.contains( make_key( i ) ) );
+    }
+
+    for( std::uint64_t i = 1000; i < 2000; ++i )
+    {
+        BOOST_TEST( !m.contains( make_key( i ) ) );
+    }
+
+    BOOST_TEST_EQ( m.size(), 1000u );
+}
+
+static void test_full()
+{
+    // keys that agree in the shard and fingerprint bytes
+
+    concurrent_digest_map<16, int, 4> m( 0 );
+
+    std::size_t n = 0;
+
+    for( int i = 0; ; ++i )
+    {
+        digest<16> k;
+
+        k[ 0 ] = 0;
+        k[ 1 ] = 0x55;
+
+        for( std::size_t j = 2; j < 16; ++j )
+        {
+            k[ j ] = static_cast<unsigned char>( i >> ( j % 4 * 8 ) );
+        }
+
+        auto r = m.insert( k, i );
+
+        if( r.first == nullptr )
+        {
+            BOOST_TEST( !r.second );
+            BOOST_TEST( !m.contains( k ) );
+            break;
+        }
+
+        BOOST_TEST( r.second );
+        ++n;
+    }
+
+    BOOST_TEST_EQ( m.size(), n );
+    BOOST_TEST_EQ( n, m.capacity() / 4 );
+}
+
+static void test_destructor()
+{
+    auto p = std::make_shared<int>( 0 );
+
+    {
+        concurrent_digest_map<32, std::shared_ptr<int>> m( 100 );
+
+        for( std::uint64_t i = 0; i < 100; ++i )
+        {
+            m.insert( make_key( i ), p );
+        }
+
+        BOOST_TEST_EQ( p.use_count(), 101 );
+    }
+
+    BOOST_TEST_EQ( p.use_count(), 1 );
+}
+
+static void test_threads()
+{
+    std::size_t const K = 20000;
+    int const T = 8;
+
+    std::vector< digest<32> > keys;
+
+    for( std::uint64_t i = 0; i < K; ++i )
+    {
+        keys.push_back( make_key( i ) );
+    }
+
+    concurrent_digest_map<32, std::uint64_t> m( K );
+
+    std::atomic<std::size_t> inserted( 0 );
+    std::atomic<std::size_t> errors( 0 );
+
+    std::vector<std::thread> th;
+
+    for( int t = 0; t < T; ++t )
+    {
+        th.emplace_back( [&, t]{
+
+            // every thread inserts every key, in a different order, and
+            // looks up the keys the other threads may have inserted
+
+            for( std::size_t i = 0; i < K; ++i )
+            {
+                std::size_t j = ( i * 7919 + t * ( K / T ) ) % K;
+
+                auto r = m.insert( keys[ j ], j );
+
+                if( r.first == nullptr || *r.first != j ) ++errors;
+                if( r.second ) ++inserted;
+
+                std::size_t k = ( j * 31 + 17 ) % K;
+
+                if( std::uint64_t const* p = m.find( keys[ k ] ) )
+                {
+                    if( *p != k ) ++errors;
+                }
+            }
+        });
+    }
+
+    for( auto& x: th ) x.join();
+
+    BOOST_TEST_EQ( errors.load(), 0u );
+    BOOST_TEST_EQ( inserted.load(), K );
+    BOOST_TEST_EQ( m.size(), K );
+
+    for( std::size_t i = 0; i < K; ++i )
+    {
+        std::uint64_t const* p = m.find( keys[ i ] );
+        BOOST_TEST( p != nullptr ) && BOOST_TEST_EQ( *p, i );
+    }
+}
+
+int main()
+{
+    test_single();
+    test_full();
+    test_destructor();
+    test_threads();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,329 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/consistent_hash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/detail/write.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::uint64_t mix( std::uint64_t x )
+{
+    x ^= x >> 33;
+    x *= 0xFF51AFD7ED558CCDull;
+    x ^= x >> 33;
+
+    return x;
+}
+
+static void test_jump()
+{
+    for( std::uint64_t k = 0; k < 1000; ++k )
+    {
+        BOOST_TEST_EQ( jump_consistent_hash( mix( k ), 1 ), 0 );
+    }
+
+    // a key either stays in its bucket, or moves to the new one
+
+    for( std::uint64_t k = 0; k < 1000; ++k )
+    {
+        std::uint64_t key = mix( k );
+
+        int b = jump_consistent_hash( key, 1 );
+
+        for( int n = 2; n <= 100; ++n )
+        {
+            int b2 = jump_consistent_hash( key, n );
+
+            BOOST_TEST_GE( b2, 0 );
+            BOOST_TEST_LT( b2, n );
+
+            if( b2 != b )
+            {
+                BOOST_TEST_EQ( b2, n - 1 );
+            }
+
+            b = b2;
+        }
+    }
+
+    // the keys are spread evenly
+
+    {
+        int const n = 10;
+        int c[ n ] = {};
+
+        for( std::uint64_t k = 0; k < 100000; ++k )
+        {
+            ++c[ jump_consistent_hash( mix( k ), n ) ];
+        }
+
+        for( int i = 0; i < n; ++i )
+        {
+            BOOST_TEST_GT( c[ i ], 9500 );
+            BOOST_TEST_LT( c[ i ], 10500 );
+        }
+    }
+}
+
+// the reference score, without batching
+
+template<class H> static std::uint64_t score( H const& h0, std::uint64_t k, std::uint64_t w )
+{
+    unsigned char buffer[ 16 ];
+
+    boost::hash2::detail::write64le( buffer + 0, k );
+    boost::hash2::detail::write64le( buffer + 8, w );
+
+    H h( h0 );
+    h.update( buffer, 16 );
+
+    return get_integral_result<std::uint64_t>( h.result() );
+}
+
+template<class H> static void test_rendezvous( std::size_t n )
+{
+    std::vector<std::string> nodes;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        nodes.push_back( "node-" + std::to_string( i ) );
+    }
+
+    rendezvous_hash<std::string, H> r( nodes.begin(), nodes.end(), 7 );
+
+    BOOST_TEST_EQ( r.size(), n );
+    BOOST_TEST( r.nodes() == nodes );
+
+    H h0( 7 );
+
+    std::vector<std::size_t> c( n );
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        std::size_t j = r.select_index( i );
+
+        BOOST_TEST_LT( j, n );
+        BOOST_TEST_EQ( r.select( i ), nodes[ j ] );
+
+        ++c[ j ];
+
+        // j has the highest score
+
+        std::uint64_t k = hash<int, H>( 7 )( i );
+        std::uint64_t s = score( h0, k, hash<std::string, H>( 7 )( nodes[ j ] ) );
+
+        for( std::size_t m = 0; m < n; ++m )
+        {
+            BOOST_TEST_LE( score( h0, k, hash<std::string, H>( 7 )( nodes[ m ] ) ), s );
+        }
+    }
+
+    for( std::size_t j = 0; j < n; ++j )
+    {
+        BOOST_TEST_GT( c[ j ], 0u );
+    }
+
+    // removing a node only moves the keys that were on it
+
+    if( n > 1 )
+    {
+        std::vector<std::string> nodes2( nodes );
+        nodes2.erase( nodes2.begin() + 1 );
+
+        rendezvous_hash<std::string, H> r2( nodes2.begin(), nodes2.end(), 7 );
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            if( r.select( i ) != nodes[ 1 ] )
+            {
+                BOOST_TEST_EQ( r2.select( i ), r.select( i ) );
+            }
+        }
+    }
+}
+
+template<class H, std::size_t M> static void test_maglev( std::size_t n )
+{
+    std::vector<std::string> nodes;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        nodes.push_back( "backend-" + std::to_string( i ) );
+    }
+
+    maglev_table<std::string, H, default_flavor, M> mt( nodes.begin(), nodes.end(), 7 );
+
+    BOOST_TEST_EQ( mt.size(), n );
+    BOOST_TEST_EQ( mt.table().size(), M );
+
+    // each node has M / n entries, rounded up or down
+
+    {
+        std::vector<std::size_t> c( n );
+
+        for( std::uint32_t i: mt.table() )
+        {
+            BOOST_TEST_LT( i, n );
+            ++c[ i ];
+        }
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_GE( c[ i ], M / n );
+            BOOST_TEST_LE( c[ i ], ( M + n - 1 ) / n );
+        }
+    }
+
+    // select_index is the entry at the hash of the key; select_indices,
+    // with hash_batch, agrees with it
+
+    {
+        std::vector<std::uint64_t> k1;
+        std::vector<std::string> k2;
+
+        for( std::size_t i = 0; i < 1000; ++i )
+        {
+            k1.push_back( mix( i ) );
+            k2.push_back( std::to_string( i ) );
+        }
+
+        std::vector<std::size_t> r1, r2;
+
+        mt.select_indices( k1.begin(), k1.end(), std::back_inserter( r1 ) );
+        mt.select_indices( k2.begin(), k2.end(), std::back_inserter( r2 ) );
+
+        BOOST_TEST_EQ( r1.size(), k1.size() );
+        BOOST_TEST_EQ( r2.size(), k2.size() );
+
+        for( std::size_t i = 0; i < k1.size(); ++i )
+        {
+            std::uint64_t const h1 = boost::hash2::hash<std::uint64_t, H>( 7 )( k1[ i ] );
+
+            BOOST_TEST_EQ( r1[ i ], mt.select_index( k1[ i ] ) );
+            BOOST_TEST_EQ( r1[ i ], mt.table()[ h1 % M ] );
+
+            BOOST_TEST_EQ( r2[ i ], mt.select_index( k2[ i ] ) );
+            BOOST_TEST_EQ( mt.select( k2[ i ] ), nodes[ r2[ i ] ] );
+        }
+    }
+
+    // adding a node takes about M / ( n + 1 ) entries, and moves few others
+
+    {
+        maglev_table<std::string, H, default_flavor, M> mt2( mt );
+
+        std::size_t const k = mt2.insert( "backend-new" );
+
+        BOOST_TEST_EQ( mt2.size(), n + 1 );
+
+        std::size_t c = 0;
+
+        for( std::uint32_t i: mt2.table() )
+        {
+            c += i == n;
+        }
+
+        BOOST_TEST_GE( c, M / ( n + 1 ) );
+        BOOST_TEST_GE( k, c );
+        BOOST_TEST_LE( k, 2 * c + n );
+
+        // and the table is the same as one built anew
+
+        std::vector<std::string> nodes2( nodes );
+        nodes2.push_back( "backend-new" );
+
+        maglev_table<std::string, H, default_flavor, M> mt3( nodes2.begin(), nodes2.end(), 7 );
+
+        BOOST_TEST( mt2.table() == mt3.table() );
+
+        // removing it again restores the table
+
+        BOOST_TEST_EQ( mt2.erase( n ), k );
+        BOOST_TEST( mt2.table() == mt.table() );
+    }
+
+    // removing a node moves its own entries, and a few others
+
+    if( n > 1 )
+    {
+        maglev_table<std::string, H, default_flavor, M> mt2( mt );
+
+        std::size_t c = 0;
+
+        for( std::uint32_t i: mt.table() )
+        {
+            c += i == 1;
+        }
+
+        std::size_t const k = mt2.erase( 1 );
+
+        BOOST_TEST_EQ( mt2.size(), n - 1 );
+        BOOST_TEST_GE( k, c );
+        BOOST_TEST_LE( k, 2 * c + n );
+
+        std::vector<std::string> nodes2( nodes );
+        nodes2.erase( nodes2.begin() + 1 );
+
+        BOOST_TEST( mt2.nodes() == nodes2 );
+
+        maglev_table<std::string, H, default_flavor, M> mt3( nodes2.begin(), nodes2.end(), 7 );
+
+        BOOST_TEST( mt2.table() == mt3.table() );
+    }
+}
+
+int main()
+{
+    test_jump();
+
+    for( std::size_t n: { 1, 3, 8, 13, 100 } )
+    {
+        test_rendezvous<siphash_64>( n );
+        test_rendezvous<siphash13_64>( n );
+        test_rendezvous<xxhash_64>( n );
+        test_rendezvous<xxh3_128>( n );
+    }
+
+    for( std::size_t n: { 1, 3, 8, 13, 100 } )
+    {
+        test_maglev<siphash_64, 65537>( n );
+        test_maglev<xxh3_64, 65537>( n );
+        test_maglev<xxh3_128, 251>( n );
+    }
+
+    {
+        maglev_table<int, siphash_64> mt;
+
+        BOOST_TEST( mt.empty() );
+        BOOST_TEST( mt.table().empty() );
+
+        BOOST_TEST_EQ( mt.insert( 1 ), 65537u );
+        BOOST_TEST_EQ( mt.select( 12345 ), 1 );
+
+        BOOST_TEST_EQ( mt.erase( 0 ), 65537u );
+        BOOST_TEST( mt.table().empty() );
+    }
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && !( defined(BOOST_GCC) && BOOST_GCC < 60000 )
+
+    {
+        constexpr int b = jump_consistent_hash( 12345, 10 );
+        BOOST_TEST_EQ( b, jump_consistent_hash( 12345, 10 ) );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
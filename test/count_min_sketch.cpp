@@ -0,0 +1,160 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/count_min_sketch.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+// value i occurs 1000 / ( i + 1 ) times
+
+static std::vector<int> make_stream()
+{
+    std::vector<int> r;
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        for( int j = 0; j < 1000 / ( i + 1 ); ++j )
+        {
+            r.push_back( i );
+        }
+
+        r.push_back( 10000 + i );
+    }
+
+    return r;
+}
+
+static std::uint64_t true_count( int i )
+{
+    return i < 2000? 1000 / ( i + 1 ): 1;
+}
+
+template<class S> void test_sketch( S s1, S s2 )
+{
+    std::vector<int> v = make_stream();
+
+    for( int x: v )
+    {
+        s1.insert( x );
+    }
+
+    s2.insert( v.begin(), v.end() );
+
+    std::uint64_t err = 0;
+
+    for( int i = 0; i < 100; ++i )
+    {
+        std::uint64_t e = s1.estimate( i );
+
+        BOOST_TEST_EQ( e, s2.estimate( i ) );
+        BOOST_TEST_GE( e, true_count( i ) );
+
+        err += e - true_count( i );
+    }
+
+    BOOST_TEST_LT( err, 100u * 20 );
+
+    // merge
+
+    S s3( s1 );
+    s3.merge( s2 );
+
+    BOOST_TEST_EQ( s3.estimate( 0 ), 2 * s1.estimate( 0 ) );
+
+    s1.clear();
+
+    BOOST_TEST_EQ( s1.estimate( 0 ), 0u );
+}
+
+template<class S> void test_conservative( S s1, S s2, S s3 )
+{
+    std::vector<int> v = make_stream();
+
+    for( int x: v )
+    {
+        s1.insert( x );
+        s2.insert_conservative( x );
+    }
+
+    s3.insert_conservative( v.begin(), v.end() );
+
+    for( int i = 0; i < 2000; ++i )
+    {
+        std::uint64_t e2 = s2.estimate( i );
+
+        BOOST_TEST_EQ( e2, s3.estimate( i ) );
+        BOOST_TEST_GE( e2, true_count( i ) );
+        BOOST_TEST_LE( e2, s1.estimate( i ) );
+    }
+
+    {
+        std::uint64_t e = s2.insert_conservative( 5, 10 );
+        BOOST_TEST_EQ( e, s2.estimate( 5 ) );
+    }
+
+    {
+        std::uint64_t e = s2.insert( 5, 10 );
+        BOOST_TEST_EQ( e, s2.estimate( 5 ) );
+    }
+}
+
+template<class S> void test_heavy_hitters( S s )
+{
+    std::vector<int> v = make_stream();
+
+    s.insert( v.begin(), v.end() );
+
+    auto top = s.top();
+
+    BOOST_TEST_EQ( top.size(), 5u );
+
+    for( std::size_t i = 0; i < top.size() && i < 5; ++i )
+    {
+        BOOST_TEST_EQ( top[ i ].first, static_cast<int>( i ) );
+        BOOST_TEST_GE( top[ i ].second, true_count( static_cast<int>( i ) ) );
+    }
+
+    s.clear();
+
+    BOOST_TEST_EQ( s.top().size(), 0u );
+}
+
+int main()
+{
+    test_sketch( count_min_sketch<xxhash_64>( 1024 ), count_min_sketch<xxhash_64>( 1024 ) );
+    test_sketch( count_min_sketch<xxh3_128, 5>( 2000, 7 ), count_min_sketch<xxh3_128, 5>( 2000, 7 ) );
+
+    test_conservative( count_min_sketch<siphash_64>( 512 ), count_min_sketch<siphash_64>( 512 ), count_min_sketch<siphash_64>( 512 ) );
+
+    test_heavy_hitters( heavy_hitters<int, xxhash_64>( 5, 1024 ) );
+    test_heavy_hitters( heavy_hitters<int, siphash_64, 3>( 5, 1024, 7 ) );
+
+    {
+        heavy_hitters<std::string, xxh3_128> s( 2, 256 );
+
+        for( int i = 0; i < 100; ++i )
+        {
+            s.insert( "hot" );
+            s.insert( "warm" + std::to_string( i % 3 ) );
+            s.insert( "cold" + std::to_string( i ) );
+        }
+
+        auto top = s.top();
+
+        BOOST_TEST_EQ( top.size(), 2u );
+        BOOST_TEST_EQ( top[ 0 ].first, std::string( "hot" ) );
+        BOOST_TEST_EQ( top[ 0 ].second, 100u );
+        BOOST_TEST_EQ( top[ 1 ].first.substr( 0, 4 ), std::string( "warm" ) );
+    }
+
+    return boost::report_errors();
+}
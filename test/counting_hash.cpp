@@ -0,0 +1,189 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/counting_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/detail/has_update_word.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <type_traits>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> void test()
+{
+    using boost::hash2::counting_hash;
+    using boost::hash2::update_counts;
+
+    typedef counting_hash<H> C;
+
+    BOOST_TEST_TRAIT_SAME( typename C::result_type, typename H::result_type );
+    BOOST_TEST_EQ( boost::hash2::detail::has_update_word<C>::value, boost::hash2::detail::has_update_word<H>::value );
+
+    unsigned char buffer[ 1024 ];
+
+    for( int i = 0; i < 1024; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    // same results as H
+
+    std::size_t const sizes[] = { 1, 3, 8, 0, 7, 64, 2, 255, 256, 257 };
+
+    {
+        H h1( 7 );
+        C h2( 7 );
+
+        std::size_t k = 0;
+
+        for( std::size_t i = 0; i < sizeof( sizes ) / sizeof( sizes[0] ); ++i )
+        {
+            h1.update( buffer + k, sizes[ i ] );
+            h2.update( buffer + k, sizes[ i ] );
+
+            k += sizes[ i ];
+        }
+
+        BOOST_TEST( h1.result() == h2.result() );
+        BOOST_TEST( h1.result() == h2.result() );
+
+        update_counts const& c = h2.counts();
+
+        BOOST_TEST_EQ( c.update_calls, 10u );
+        BOOST_TEST_EQ( c.update_word_calls, 0u );
+        BOOST_TEST_EQ( c.bytes, k );
+        BOOST_TEST_EQ( c.result_calls, 2u );
+
+        BOOST_TEST_EQ( c.size_histogram[ 0 ], 1u ); // 0
+        BOOST_TEST_EQ( c.size_histogram[ 1 ], 1u ); // 1
+        BOOST_TEST_EQ( c.size_histogram[ 2 ], 2u ); // 2, 3
+        BOOST_TEST_EQ( c.size_histogram[ 3 ], 1u ); // 7
+        BOOST_TEST_EQ( c.size_histogram[ 4 ], 1u ); // 8
+        BOOST_TEST_EQ( c.size_histogram[ 7 ], 1u ); // 64
+        BOOST_TEST_EQ( c.size_histogram[ 8 ], 1u ); // 255
+        BOOST_TEST_EQ( c.size_histogram[ 9 ], 2u ); // 256, 257
+
+        h2.reset_counts();
+
+        BOOST_TEST_EQ( h2.counts().update_calls, 0u );
+        BOOST_TEST_EQ( h2.counts().bytes, 0u );
+        BOOST_TEST_EQ( h2.counts().result_calls, 0u );
+        BOOST_TEST_EQ( h2.counts().size_histogram[ 9 ], 0u );
+    }
+
+    {
+        H h1( buffer, 16 );
+        C h2( buffer, 16 );
+
+        h1.update( buffer, 100 );
+        h2.update( static_cast<void const*>( buffer ), 100 );
+
+        H h3 = h2.hasher();
+
+        typename H::result_type const r = h1.result();
+
+        BOOST_TEST( h2.result() == r );
+        BOOST_TEST( h3.result() == r );
+    }
+
+    // a tuple is hashed one member at a time
+
+    {
+        std::tuple<std::uint32_t, std::uint16_t, std::uint8_t> const v( 1, 2, 3 );
+
+        H h1;
+        C h2;
+
+        boost::hash2::hash_append( h1, {}, v );
+        boost::hash2::hash_append( h2, {}, v );
+
+        BOOST_TEST( h1.result() == h2.result() );
+
+        update_counts const& c = h2.counts();
+
+        BOOST_TEST_EQ( c.update_calls, 3u );
+        BOOST_TEST_EQ( c.bytes, 7u );
+
+        BOOST_TEST_EQ( c.size_histogram[ 1 ], 1u );
+        BOOST_TEST_EQ( c.size_histogram[ 2 ], 1u );
+        BOOST_TEST_EQ( c.size_histogram[ 3 ], 1u );
+    }
+
+    // a string is hashed as its characters, followed by its size
+
+    {
+        std::string const v( "hello" );
+
+        H h1;
+        C h2;
+
+        boost::hash2::hash_append( h1, {}, v );
+        boost::hash2::hash_append( h2, {}, v );
+
+        BOOST_TEST( h1.result() == h2.result() );
+
+        update_counts const& c = h2.counts();
+
+        BOOST_TEST_EQ( c.update_calls, 2u );
+        BOOST_TEST_EQ( c.bytes, 13u );
+
+        BOOST_TEST_EQ( c.size_histogram[ 3 ], 1u );
+        BOOST_TEST_EQ( c.size_histogram[ 4 ], 1u );
+    }
+
+    // a vector of strings makes two calls per element
+
+    {
+        std::vector<std::string> const v{ "a", "bc", "def" };
+
+        H h1;
+        C h2;
+
+        boost::hash2::hash_append( h1, {}, v );
+        boost::hash2::hash_append( h2, {}, v );
+
+        BOOST_TEST( h1.result() == h2.result() );
+        BOOST_TEST_EQ( h2.counts().update_calls, 7u );
+        BOOST_TEST_EQ( h2.counts().bytes, 6u + 4 * 8u );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_64>();
+    test<siphash_64>();
+    test<sha2_256>();
+
+    BOOST_TEST( counting_hash<sha2_256>::block_size == sha2_256::block_size );
+
+    // update_word
+
+    {
+        unsigned char const tmp[ 8 ] = { 0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01 };
+
+        fnv1a_64 h1;
+        counting_hash<fnv1a_64> h2;
+
+        h1.update( tmp, 8 );
+        h2.update_word( 0x0123456789ABCDEFull );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+
+        BOOST_TEST_EQ( h2.counts().update_calls, 1u );
+        BOOST_TEST_EQ( h2.counts().update_word_calls, 1u );
+        BOOST_TEST_EQ( h2.counts().bytes, 8u );
+        BOOST_TEST_EQ( h2.counts().size_histogram[ 4 ], 1u );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,146 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc32.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using boost::hash2::crc32;
+
+static std::uint32_t crc32_bitwise( unsigned char const* p, std::size_t n )
+{
+    std::uint32_t c = 0xFFFFFFFFu;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        c ^= p[ i ];
+
+        for( int k = 0; k < 8; ++k )
+        {
+            c = ( c >> 1 ) ^ ( ( c & 1 )? 0xEDB88320u: 0u );
+        }
+    }
+
+    return ~c;
+}
+
+static std::uint32_t digest( unsigned char const* p, std::size_t n )
+{
+    crc32 h;
+
+    h.update( p, n );
+
+    return h.result();
+}
+
+static void test( char const* s, std::uint32_t r )
+{
+    crc32 h;
+
+    h.update( s, std::strlen( s ) );
+
+    BOOST_TEST_EQ( h.result(), r );
+}
+
+static void test_kernels()
+{
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+    using namespace boost::hash2::detail;
+
+    // the VPCLMULQDQ kernel must agree with the PCLMULQDQ one
+
+    if( has_x86_avx512_vpclmul() )
+    {
+        std::vector<unsigned char> v( 5120 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+        }
+
+        for( std::size_t n = 256; n <= v.size(); n += 48 )
+        {
+            BOOST_TEST_EQ( crc_update_vpclmul<32>( 0x12345678, v.data(), n, crc32_constants<>::clmul ), crc_update_pclmul<32>( 0x12345678, v.data(), n, crc32_constants<>::clmul ) );
+        }
+    }
+
+#endif
+}
+
+int main()
+{
+    // https://reveng.sourceforge.io/crc-catalogue/17plus.htm#crc.cat.crc-32-iso-hdlc
+
+    test( "", 0x00000000 );
+    test( "a", 0xe8b7be43 );
+    test( "123456789", 0xcbf43926 );
+    test( "The quick brown fox jumps over the lazy dog", 0x414fa339 );
+
+    // lengths around the folding block sizes, against a bitwise implementation
+
+    std::vector<unsigned char> v( 8000 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    {
+        std::size_t const lengths[] = { 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 255, 256, 257, 1023, 1024, 1025, 4096, 8000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint32_t const r = crc32_bitwise( v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                crc32 h;
+
+                h.update( v.data(), split );
+                h.update( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            // unaligned input
+
+            BOOST_TEST_EQ( digest( v.data() + 1, n - 1 ), crc32_bitwise( v.data() + 1, n - 1 ) );
+        }
+    }
+
+    // combine
+
+    BOOST_TEST_EQ( crc32::combine( 0x12345678, 0, 0 ), 0x12345678 );
+
+    {
+        std::size_t const lengths[] = { 0, 1, 100, 4096, 8000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint32_t const r = digest( v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                if( split > n ) continue;
+
+                std::uint32_t const ra = digest( v.data(), split );
+                std::uint32_t const rb = digest( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( crc32::combine( ra, rb, n - split ), r );
+            }
+        }
+    }
+
+    test_kernels();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,196 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc32c.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using boost::hash2::crc32c;
+
+static std::uint32_t crc32c_bitwise( unsigned char const* p, std::size_t n )
+{
+    std::uint32_t c = 0xFFFFFFFFu;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        c ^= p[ i ];
+
+        for( int k = 0; k < 8; ++k )
+        {
+            c = ( c >> 1 ) ^ ( ( c & 1 )? 0x82F63B78u: 0u );
+        }
+    }
+
+    return ~c;
+}
+
+static std::uint32_t digest( unsigned char const* p, std::size_t n )
+{
+    crc32c h;
+
+    h.update( p, n );
+
+    return h.result();
+}
+
+static void test( char const* s, std::uint32_t r )
+{
+    crc32c h;
+
+    h.update( s, std::strlen( s ) );
+
+    BOOST_TEST_EQ( h.result(), r );
+}
+
+static void test_kernels()
+{
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+    using namespace boost::hash2::detail;
+
+    // the three stream PCLMULQDQ kernel must agree with the plain CRC32 one
+
+    if( has_x86_sse42_pclmul() )
+    {
+        std::vector<unsigned char> v( 5000 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+        }
+
+        for( std::size_t n = 0; n <= v.size(); n += 61 )
+        {
+            BOOST_TEST_EQ( crc32c_update_pclmul( 0x12345678, v.data(), n ), crc32c_update_sse42( 0x12345678, v.data(), n ) );
+        }
+    }
+
+#endif
+}
+
+int main()
+{
+    // https://datatracker.ietf.org/doc/html/rfc3720#appendix-B.4
+
+    {
+        unsigned char v[ 32 ] = {};
+
+        BOOST_TEST_EQ( digest( v, 32 ), 0x8a9136aa );
+
+        std::memset( v, 0xFF, 32 );
+
+        BOOST_TEST_EQ( digest( v, 32 ), 0x62a8ab43 );
+
+        for( int i = 0; i < 32; ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i );
+        }
+
+        BOOST_TEST_EQ( digest( v, 32 ), 0x46dd794e );
+
+        for( int i = 0; i < 32; ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( 31 - i );
+        }
+
+        BOOST_TEST_EQ( digest( v, 32 ), 0x113fdb5c );
+    }
+
+    test( "", 0x00000000 );
+    test( "a", 0xc1d04330 );
+    test( "123456789", 0xe3069283 );
+    test( "The quick brown fox jumps over the lazy dog", 0x22620404 );
+
+    // lengths around the multi-stream block sizes, against a bitwise implementation
+
+    std::vector<unsigned char> v( 8000 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    {
+        std::size_t const lengths[] = { 1, 7, 8, 9, 191, 192, 193, 767, 768, 769, 3071, 3072, 3073, 4096, 8000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint32_t const r = crc32c_bitwise( v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                crc32c h;
+
+                h.update( v.data(), split );
+                h.update( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            // unaligned input
+
+            BOOST_TEST_EQ( digest( v.data() + 1, n - 1 ), crc32c_bitwise( v.data() + 1, n - 1 ) );
+        }
+    }
+
+    // combine
+
+    BOOST_TEST_EQ( crc32c::combine( 0x12345678, 0, 0 ), 0x12345678 );
+
+    {
+        std::size_t const lengths[] = { 0, 1, 100, 4096, 8000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint32_t const r = digest( v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                if( split > n ) continue;
+
+                std::uint32_t const ra = digest( v.data(), split );
+                std::uint32_t const rb = digest( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( crc32c::combine( ra, rb, n - split ), r );
+            }
+        }
+    }
+
+    // update_parallel agrees with update on inputs large enough to be split
+
+    {
+        std::vector<unsigned char> w( 5 * 1024 * 1024 + 7 );
+
+        for( std::size_t i = 0; i < w.size(); ++i )
+        {
+            w[ i ] = static_cast<unsigned char>( i * 7 + ( i >> 11 ) );
+        }
+
+        for( std::size_t n: { std::size_t( 1000 ), std::size_t( 2 * 1024 * 1024 ), w.size() } )
+        {
+            std::uint32_t const r = digest( w.data(), n );
+
+            for( unsigned threads = 0; threads <= 5; ++threads )
+            {
+                crc32c h;
+
+                h.update( w.data(), 5 );
+                h.update_parallel( w.data() + 5, n - 5, threads );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+        }
+    }
+
+    test_kernels();
+
+    return boost::report_errors();
+}
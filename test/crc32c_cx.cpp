@@ -0,0 +1,53 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc32c.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstring>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v1[ 1 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v300[ 300 ] = {};
+
+    TEST_EQ( test<crc32c>( 0, v1 ), 1383945041 );
+    TEST_EQ( test<crc32c>( 0, v45 ), 1316187503 );
+    TEST_EQ( test<crc32c>( 0, v300 ), 1683322640 );
+
+    TEST_EQ( test<crc32c>( 7, v1 ), 2089133753 );
+    TEST_EQ( test<crc32c>( 7, v45 ), 2390757075 );
+    TEST_EQ( test<crc32c>( 7, v300 ), 3469716681 );
+
+    // the CRC of v45 followed by v300
+
+    TEST_EQ( crc32c::combine( 1316187503, 1683322640, 300 ), 3391743580 );
+
+    return boost::report_errors();
+}
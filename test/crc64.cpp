@@ -0,0 +1,161 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using boost::hash2::crc64_xz;
+using boost::hash2::crc64_nvme;
+
+static std::uint64_t crc64_bitwise( std::uint64_t P, unsigned char const* p, std::size_t n )
+{
+    std::uint64_t c = ~std::uint64_t( 0 );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        c ^= p[ i ];
+
+        for( int k = 0; k < 8; ++k )
+        {
+            c = ( c >> 1 ) ^ ( ( c & 1 )? P: 0 );
+        }
+    }
+
+    return ~c;
+}
+
+template<class H> static std::uint64_t digest( unsigned char const* p, std::size_t n )
+{
+    H h;
+
+    h.update( p, n );
+
+    return h.result();
+}
+
+template<class H> static void test( char const* s, std::uint64_t r )
+{
+    H h;
+
+    h.update( s, std::strlen( s ) );
+
+    BOOST_TEST_EQ( h.result(), r );
+}
+
+static void test_kernels()
+{
+#if defined(BOOST_HASH2_HAS_X86_64_INTRINSICS)
+
+    using namespace boost::hash2::detail;
+
+    // the VPCLMULQDQ kernel must agree with the PCLMULQDQ one
+
+    if( has_x86_avx512_vpclmul() )
+    {
+        std::vector<unsigned char> v( 5120 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+        }
+
+        for( std::size_t n = 256; n <= v.size(); n += 48 )
+        {
+            BOOST_TEST_EQ( crc_update_vpclmul<64>( 0x0123456789ABCDEF, v.data(), n, crc64_xz_constants<>::clmul ), crc_update_pclmul<64>( 0x0123456789ABCDEF, v.data(), n, crc64_xz_constants<>::clmul ) );
+            BOOST_TEST_EQ( crc_update_vpclmul<64>( 0x0123456789ABCDEF, v.data(), n, crc64_nvme_constants<>::clmul ), crc_update_pclmul<64>( 0x0123456789ABCDEF, v.data(), n, crc64_nvme_constants<>::clmul ) );
+        }
+    }
+
+#endif
+}
+
+template<class H> static void test_variant( std::uint64_t P )
+{
+    // lengths around the folding block sizes, against a bitwise implementation
+
+    std::vector<unsigned char> v( 8000 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    {
+        std::size_t const lengths[] = { 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 255, 256, 257, 1023, 1024, 1025, 4096, 8000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint64_t const r = crc64_bitwise( P, v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                H h;
+
+                h.update( v.data(), split );
+                h.update( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            // unaligned input
+
+            BOOST_TEST_EQ( digest<H>( v.data() + 1, n - 1 ), crc64_bitwise( P, v.data() + 1, n - 1 ) );
+        }
+    }
+
+    // combine
+
+    BOOST_TEST_EQ( H::combine( 0x0123456789ABCDEF, 0, 0 ), 0x0123456789ABCDEF );
+
+    {
+        std::size_t const lengths[] = { 0, 1, 100, 4096, 8000 };
+
+        for( std::size_t n: lengths )
+        {
+            std::uint64_t const r = digest<H>( v.data(), n );
+
+            std::size_t const splits[] = { 0, 1, n / 3, n / 2, n };
+
+            for( std::size_t split: splits )
+            {
+                if( split > n ) continue;
+
+                std::uint64_t const ra = digest<H>( v.data(), split );
+                std::uint64_t const rb = digest<H>( v.data() + split, n - split );
+
+                BOOST_TEST_EQ( H::combine( ra, rb, n - split ), r );
+            }
+        }
+    }
+}
+
+int main()
+{
+    // https://reveng.sourceforge.io/crc-catalogue/17plus.htm#crc.cat.crc-64-xz
+
+    test<crc64_xz>( "", 0x0000000000000000 );
+    test<crc64_xz>( "a", 0x330284772e652b05 );
+    test<crc64_xz>( "123456789", 0x995dc9bbdf1939fa );
+    test<crc64_xz>( "The quick brown fox jumps over the lazy dog", 0x5b5eb8c2e54aa1c4 );
+
+    // https://reveng.sourceforge.io/crc-catalogue/17plus.htm#crc.cat.crc-64-nvme
+
+    test<crc64_nvme>( "", 0x0000000000000000 );
+    test<crc64_nvme>( "a", 0x8c2f8445b4cbfc3c );
+    test<crc64_nvme>( "123456789", 0xae8b14860a799888 );
+    test<crc64_nvme>( "The quick brown fox jumps over the lazy dog", 0xd76c54054954c143 );
+
+    test_variant<crc64_xz>( 0xC96C5795D7870F42 );
+    test_variant<crc64_nvme>( 0x9A6C9329AC4BC9B5 );
+
+    test_kernels();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,72 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc32.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstring>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v1[ 1 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v300[ 300 ] = {};
+
+    TEST_EQ( test<crc32>( 0, v1 ), 3523407757 );
+    TEST_EQ( test<crc32>( 0, v45 ), 3330316196 );
+    TEST_EQ( test<crc32>( 0, v300 ), 3040120786 );
+
+    TEST_EQ( test<crc32>( 7, v1 ), 2187884903 );
+    TEST_EQ( test<crc32>( 7, v45 ), 3134546056 );
+    TEST_EQ( test<crc32>( 7, v300 ), 882046679 );
+
+    TEST_EQ( test<crc64_xz>( 0, v1 ), 2282658103124508505 );
+    TEST_EQ( test<crc64_xz>( 0, v45 ), 8045996438957705962 );
+    TEST_EQ( test<crc64_xz>( 0, v300 ), 10690244231474873537u );
+
+    TEST_EQ( test<crc64_xz>( 7, v1 ), 2098381555963734287 );
+    TEST_EQ( test<crc64_xz>( 7, v45 ), 153011579260806565 );
+    TEST_EQ( test<crc64_xz>( 7, v300 ), 2789854958982829171 );
+
+    TEST_EQ( test<crc64_nvme>( 0, v1 ), 15409717344899729192u );
+    TEST_EQ( test<crc64_nvme>( 0, v45 ), 15610087914397290998u );
+    TEST_EQ( test<crc64_nvme>( 0, v300 ), 11871595890773150503u );
+
+    TEST_EQ( test<crc64_nvme>( 7, v1 ), 14435854772601210376u );
+    TEST_EQ( test<crc64_nvme>( 7, v45 ), 13927389732943095523u );
+    TEST_EQ( test<crc64_nvme>( 7, v300 ), 12511489613698376019u );
+
+    // the CRC of v45 followed by v300
+
+    TEST_EQ( crc32::combine( 3330316196, 3040120786, 300 ), 87023609 );
+    TEST_EQ( crc64_xz::combine( 8045996438957705962, 10690244231474873537u, 300 ), 14940805221352139004u );
+    TEST_EQ( crc64_nvme::combine( 15610087914397290998u, 11871595890773150503u, 300 ), 9120737213720717438 );
+
+    return boost::report_errors();
+}
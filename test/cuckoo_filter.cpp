@@ -0,0 +1,208 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/cuckoo_filter.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <thread>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, std::size_t Shards> void test( std::size_t m )
+{
+    boost::hash2::cuckoo_filter<std::uint64_t, H, Shards> f( m );
+
+    BOOST_TEST_GE( f.capacity(), m );
+    BOOST_TEST_EQ( f.size(), 0u );
+
+    // fill until the first failure
+
+    std::uint64_t n = 0;
+
+    while( f.insert( n * 0x9E3779B9 ) )
+    {
+        ++n;
+    }
+
+    BOOST_TEST_EQ( f.size(), n );
+    BOOST_TEST_GE( n, f.capacity() * 9 / 10 );
+
+    // no false negatives
+
+    for( std::uint64_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST( f.may_contain( i * 0x9E3779B9 ) );
+    }
+
+    // false positives, about 8 in 65536 when full
+
+    std::size_t fp = 0;
+
+    for( std::uint64_t i = 0; i < 100000; ++i )
+    {
+        fp += f.may_contain( i * 0x9E3779B9 + 1 );
+    }
+
+    BOOST_TEST_LT( fp, 40u );
+
+    // batch queries
+
+    {
+        std::vector<std::uint64_t> v;
+
+        for( std::uint64_t i = 0; i < 1000; ++i )
+        {
+            v.push_back( i * 0x9E3779B9 + ( i & 1 ) );
+        }
+
+        bool out[ 1000 ];
+        f.may_contain( v.begin(), v.end(), out );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            BOOST_TEST_EQ( out[ i ], f.may_contain( v[ i ] ) );
+        }
+    }
+
+    // erase half, insert others into some of the freed slots
+
+    for( std::uint64_t i = 0; i < n; i += 2 )
+    {
+        BOOST_TEST( f.erase( i * 0x9E3779B9 ) );
+    }
+
+    BOOST_TEST_EQ( f.size(), n / 2 );
+
+    for( std::uint64_t i = 1; i < n; i += 2 )
+    {
+        BOOST_TEST( f.may_contain( i * 0x9E3779B9 ) );
+    }
+
+    for( std::uint64_t i = 0; i < n / 4; ++i )
+    {
+        BOOST_TEST( f.insert( i * 0x9E3779B9 + 1 ) );
+    }
+
+    for( std::uint64_t i = 1; i < n; i += 2 )
+    {
+        BOOST_TEST( f.may_contain( i * 0x9E3779B9 ) );
+    }
+
+    for( std::uint64_t i = 0; i < n / 4; ++i )
+    {
+        BOOST_TEST( f.may_contain( i * 0x9E3779B9 + 1 ) );
+    }
+
+    f.clear();
+
+    BOOST_TEST_EQ( f.size(), 0u );
+    BOOST_TEST( !f.may_contain( 0x9E3779B9 ) );
+}
+
+// readers never miss a value that stays in the filter while writers
+// insert and erase others, moving its fingerprint around
+
+void test_concurrent()
+{
+    using filter = boost::hash2::cuckoo_filter<std::uint64_t, boost::hash2::xxhash_64, 4>;
+
+    filter f( 1 << 16 );
+
+    std::size_t const n = f.capacity() / 2;
+
+    for( std::uint64_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST( f.insert( i ) );
+    }
+
+    std::atomic<bool> done( false );
+    std::atomic<std::size_t> misses( 0 );
+
+    std::vector<std::thread> th;
+
+    for( int t = 0; t < 2; ++t )
+    {
+        th.emplace_back( [&, t]{
+
+            std::uint64_t const base = ( t + 1 ) * 0x100000000ull;
+
+            for( int round = 0; round < 20; ++round )
+            {
+                std::size_t k = 0;
+
+                while( f.insert( base + k ) && k < f.capacity() / 4 )
+                {
+                    ++k;
+                }
+
+                for( std::size_t i = 0; i < k; ++i )
+                {
+                    f.erase( base + i );
+                }
+            }
+        });
+    }
+
+    for( int t = 0; t < 2; ++t )
+    {
+        th.emplace_back( [&]{
+
+            while( !done.load() )
+            {
+                for( std::uint64_t i = 0; i < n; ++i )
+                {
+                    if( !f.may_contain( i ) ) ++misses;
+                }
+            }
+        });
+    }
+
+    th[ 0 ].join();
+    th[ 1 ].join();
+
+    done = true;
+
+    th[ 2 ].join();
+    th[ 3 ].join();
+
+    BOOST_TEST_EQ( misses.load(), 0u );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<xxhash_64, 64>( 100000 );
+    test<siphash_64, 1>( 10000 );
+    test<sha2_256, 8>( 1000 );
+    test<xxhash_64, 1>( 4 );
+
+    // strings
+
+    {
+        cuckoo_filter<std::string, xxhash_64> f( 100000, 7 );
+
+        for( int i = 0; i < 50000; ++i )
+        {
+            BOOST_TEST( f.insert( "key_" + std::to_string( i ) ) );
+        }
+
+        for( int i = 0; i < 50000; ++i )
+        {
+            BOOST_TEST( f.may_contain( "key_" + std::to_string( i ) ) );
+        }
+
+        BOOST_TEST( f.erase( "key_1" ) );
+        BOOST_TEST( !f.may_contain( "key_1" ) );
+    }
+
+    test_concurrent();
+
+    return boost::report_errors();
+}
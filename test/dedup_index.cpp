@@ -0,0 +1,254 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/dedup_index.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// a fingerprint that only depends on the size, so that chunks of the
+// same size collide
+
+struct size_hash
+{
+    using result_type = std::uint64_t;
+
+    std::uint64_t n = 0;
+
+    void update( void const*, std::size_t k )
+    {
+        n += k;
+    }
+
+    std::uint64_t result()
+    {
+        return n;
+    }
+};
+
+static std::string make_chunk( std::size_t i )
+{
+    std::string s( 100 + i % 50, ' ' );
+
+    for( std::size_t j = 0; j < s.size(); ++j )
+    {
+        s[ j ] = static_cast<char>( i * 31 + j * 7 );
+    }
+
+    return s;
+}
+
+template<class Fast> void test()
+{
+    using namespace boost::hash2;
+
+    using index_type = dedup_index<Fast, sha2_256, std::size_t>;
+
+    index_type ix( 4096 );
+
+    // the stored chunks, and the strong digests obtained from them
+
+    std::vector<std::string> store;
+    std::size_t calls = 0;
+
+    auto existing = [&]( std::size_t i ){
+
+        ++calls;
+
+        sha2_256 h;
+        h.update( store[ i ].data(), store[ i ].size() );
+
+        return h.result();
+    };
+
+    // unique chunks don't need strong digests
+
+    for( std::size_t i = 0; i < 200; ++i )
+    {
+        std::string s = make_chunk( i );
+
+        std::pair<std::size_t const*, bool> r = ix.insert( s.data(), s.size(), store.size(), existing );
+
+        BOOST_TEST( r.second );
+        BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, store.size() );
+
+        store.push_back( s );
+    }
+
+    BOOST_TEST_EQ( ix.size(), 200u );
+    BOOST_TEST_EQ( ix.fingerprint_hits(), 0u );
+    BOOST_TEST_EQ( calls, 0u );
+
+    // duplicates are found, and the strong digest of the stored chunk is
+    // obtained once
+
+    for( int k = 0; k < 2; ++k )
+    {
+        for( std::size_t i = 0; i < 50; ++i )
+        {
+            std::string s = make_chunk( i );
+
+            std::pair<std::size_t const*, bool> r = ix.insert( s.data(), s.size(), 999999, existing );
+
+            BOOST_TEST( !r.second );
+            BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, i );
+        }
+    }
+
+    BOOST_TEST_EQ( ix.size(), 200u );
+    BOOST_TEST_EQ( ix.fingerprint_hits(), 100u );
+    BOOST_TEST_EQ( ix.collisions(), 0u );
+    BOOST_TEST_EQ( calls, 50u );
+
+    // the same, with the digests computed in one pass
+
+    for( std::size_t i = 50; i < 60; ++i )
+    {
+        std::string s = make_chunk( i );
+
+        auto d = index_type::digests( s.data(), s.size() );
+
+        BOOST_TEST( d.first == index_type::fingerprint( s.data(), s.size() ) );
+
+        std::pair<std::size_t const*, bool> r = ix.insert( d.first, d.second, 999999, existing );
+
+        BOOST_TEST( !r.second );
+        BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, i );
+    }
+
+    BOOST_TEST_EQ( calls, 60u );
+
+    // find
+
+    {
+        std::string s = make_chunk( 70 );
+
+        std::size_t const* p = ix.find( s.data(), s.size(), existing );
+        BOOST_TEST( p != nullptr ) && BOOST_TEST_EQ( *p, 70u );
+
+        s = make_chunk( 1000 );
+
+        p = ix.find( s.data(), s.size(), existing );
+        BOOST_TEST( p == nullptr );
+    }
+}
+
+static void test_collisions()
+{
+    using namespace boost::hash2;
+
+    dedup_index<size_hash, sha2_256, std::size_t> ix( 1024 );
+
+    std::vector<std::string> store;
+
+    auto existing = [&]( std::size_t i ){
+
+        sha2_256 h;
+        h.update( store[ i ].data(), store[ i ].size() );
+
+        return h.result();
+    };
+
+    // chunks of 100 to 149 bytes; those 50 apart have the same size
+
+    for( std::size_t i = 0; i < 150; ++i )
+    {
+        std::string s = make_chunk( i );
+
+        std::pair<std::size_t const*, bool> r = ix.insert( s.data(), s.size(), store.size(), existing );
+
+        BOOST_TEST( r.second );
+        BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, store.size() );
+
+        store.push_back( s );
+    }
+
+    BOOST_TEST_EQ( ix.size(), 150u );
+    BOOST_TEST_EQ( ix.collisions(), 100u );
+
+    // and all of them are still found
+
+    for( std::size_t i = 0; i < 150; ++i )
+    {
+        std::string s = make_chunk( i );
+
+        std::pair<std::size_t const*, bool> r = ix.insert( s.data(), s.size(), 999999, existing );
+
+        BOOST_TEST( !r.second );
+        BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, i );
+
+        std::size_t const* p = ix.find( s.data(), s.size(), existing );
+        BOOST_TEST( p != nullptr ) && BOOST_TEST_EQ( *p, i );
+    }
+
+    BOOST_TEST_EQ( ix.size(), 150u );
+}
+
+static void test_threads()
+{
+    using namespace boost::hash2;
+
+    dedup_index<xxh3_128, sha2_256, std::size_t> ix( 4096 );
+
+    std::size_t const n = 1000;
+
+    std::vector<std::string> chunks;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        chunks.push_back( make_chunk( i ) );
+    }
+
+    // the value of a chunk is its index in chunks, so that its strong
+    // digest can be obtained by any thread
+
+    auto existing = [&]( std::size_t i ){
+
+        sha2_256 h;
+        h.update( chunks[ i ].data(), chunks[ i ].size() );
+
+        return h.result();
+    };
+
+    std::vector<std::thread> th;
+    std::vector<std::size_t> inserted( 4 );
+
+    for( std::size_t t = 0; t < 4; ++t )
+    {
+        th.emplace_back( [&, t]{
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                std::pair<std::size_t const*, bool> r = ix.insert( chunks[ i ].data(), chunks[ i ].size(), i, existing );
+
+                BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, i );
+                inserted[ t ] += r.second;
+            }
+
+        });
+    }
+
+    for( auto& x: th ) x.join();
+
+    BOOST_TEST_EQ( inserted[ 0 ] + inserted[ 1 ] + inserted[ 2 ] + inserted[ 3 ], n );
+    BOOST_TEST_EQ( ix.size(), n );
+    BOOST_TEST_EQ( ix.collisions(), 0u );
+}
+
+int main()
+{
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxh3_128>();
+
+    test_collisions();
+    test_threads();
+
+    return boost::report_errors();
+}
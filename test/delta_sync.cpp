@@ -0,0 +1,183 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/delta_sync.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+static std::vector<unsigned char> make_data( std::size_t n, std::uint64_t seed )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint64_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        v[ i ] = static_cast<unsigned char>( x >> 56 );
+    }
+
+    return v;
+}
+
+// applies the delta to the source, and checks the ops
+
+static std::vector<unsigned char> apply( std::vector<unsigned char> const& source, std::vector<unsigned char> const& target, std::vector<boost::hash2::delta_op> const& ops )
+{
+    std::vector<unsigned char> r;
+
+    for( boost::hash2::delta_op const& op: ops )
+    {
+        BOOST_TEST_EQ( op.target_offset, r.size() );
+        BOOST_TEST_GT( op.size, 0u );
+
+        if( op.copy )
+        {
+            BOOST_TEST_LE( op.source_offset + op.size, source.size() );
+            r.insert( r.end(), source.begin() + op.source_offset, source.begin() + op.source_offset + op.size );
+        }
+        else
+        {
+            r.insert( r.end(), target.begin() + op.target_offset, target.begin() + op.target_offset + op.size );
+        }
+    }
+
+    return r;
+}
+
+// the number of target bytes that need to be sent
+
+static std::size_t literal_size( std::vector<boost::hash2::delta_op> const& ops )
+{
+    std::size_t r = 0;
+
+    for( boost::hash2::delta_op const& op: ops )
+    {
+        if( !op.copy ) r += op.size;
+    }
+
+    return r;
+}
+
+template<class H, class R> std::vector<boost::hash2::delta_op> delta( std::vector<unsigned char> const& source, std::vector<unsigned char> const& target, std::size_t bs, unsigned threads )
+{
+    boost::hash2::delta_signature<H, R> sig( bs, 7 );
+
+    if( threads == 1 )
+    {
+        sig.generate( source.data(), source.size() );
+    }
+    else
+    {
+        sig.generate( source.data(), source.size(), threads );
+    }
+
+    BOOST_TEST_EQ( sig.source_size(), source.size() );
+    BOOST_TEST_EQ( sig.blocks().size(), ( source.size() + bs - 1 ) / bs );
+
+    // as if received from elsewhere
+
+    boost::hash2::delta_signature<H, R> sig2( bs, sig.seed(), sig.source_size(), sig.blocks() );
+    boost::hash2::delta_matcher<H, R> m( sig2 );
+
+    std::vector<boost::hash2::delta_op> ops;
+    m.match( target.data(), target.size(), [&]( boost::hash2::delta_op const& op ){ ops.push_back( op ); } );
+
+    BOOST_TEST( apply( source, target, ops ) == target );
+
+    return ops;
+}
+
+template<class H, class R> void test( unsigned threads )
+{
+    std::size_t const bs = 700;
+
+    std::vector<unsigned char> const source = make_data( 1000 * 1000 + 333, 1 );
+
+    // identical; a single copy
+
+    {
+        auto ops = delta<H, R>( source, source, bs, threads );
+
+        BOOST_TEST_EQ( ops.size(), 1u );
+        BOOST_TEST_EQ( literal_size( ops ), 0u );
+    }
+
+    // bytes inserted, changed, and removed
+
+    {
+        std::vector<unsigned char> target( source );
+
+        target.insert( target.begin() + 5000, 17, 'x' );
+        target[ 300000 ] ^= 1;
+        target.erase( target.begin() + 600000, target.begin() + 600100 );
+
+        auto ops = delta<H, R>( source, target, bs, threads );
+
+        // each edit costs at most two blocks
+
+        BOOST_TEST_LE( literal_size( ops ), 17 + 3 * 2 * bs );
+    }
+
+    // moved blocks, and a prefix
+
+    {
+        std::vector<unsigned char> target( source.begin() + 500000, source.end() );
+        target.insert( target.end(), source.begin(), source.begin() + 500000 );
+        target.insert( target.begin(), 3, 'y' );
+
+        auto ops = delta<H, R>( source, target, bs, threads );
+
+        BOOST_TEST_LE( literal_size( ops ), 3 + 2 * bs );
+    }
+
+    // unrelated, shorter than a block, and empty
+
+    {
+        std::vector<unsigned char> const target = make_data( 100000, 2 );
+        BOOST_TEST_EQ( literal_size( delta<H, R>( source, target, bs, threads ) ), target.size() );
+    }
+
+    {
+        std::vector<unsigned char> const target( source.begin(), source.begin() + bs - 1 );
+        delta<H, R>( source, target, bs, threads );
+    }
+
+    {
+        std::vector<unsigned char> const target;
+        BOOST_TEST( (delta<H, R>( source, target, bs, threads )).empty() );
+    }
+
+    {
+        std::vector<unsigned char> const empty;
+        BOOST_TEST_EQ( literal_size( delta<H, R>( empty, source, bs, threads ) ), source.size() );
+    }
+
+    // repeated blocks
+
+    {
+        std::vector<unsigned char> const zeros( 10 * bs, 0 );
+        std::vector<unsigned char> const target( 25 * bs + 11, 0 );
+
+        BOOST_TEST_LE( literal_size( delta<H, R>( zeros, target, bs, threads ) ), 11u );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<md5_128, buzhash_64>( 1 );
+    test<md5_128, buzhash_64>( 4 );
+    test<blake3, rabin_karp_64>( 1 );
+    test<blake3, rabin_karp_64>( 3 );
+
+    return boost::report_errors();
+}
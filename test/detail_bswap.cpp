@@ -0,0 +1,20 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/bswap.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+int main()
+{
+    using namespace boost::hash2::detail;
+
+    BOOST_TEST_EQ( bswap16( 0x0102 ), 0x0201 );
+    BOOST_TEST_EQ( bswap32( 0x01020304 ), 0x04030201 );
+    BOOST_TEST_EQ( bswap64( 0x0102030405060708 ), 0x0807060504030201 );
+
+    BOOST_TEST_EQ( bswap32( 0xFF000080 ), 0x800000FF );
+    BOOST_TEST_EQ( bswap64( 0xFF00000000000080 ), 0x80000000000000FF );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,100 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+int main()
+{
+    using namespace boost::hash2::detail;
+
+    // detection is cached
+
+    BOOST_TEST_EQ( &get_cpu_features(), &get_cpu_features() );
+
+#if !defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    BOOST_TEST( !has_x86_sse2() );
+    BOOST_TEST( !has_x86_aes() );
+    BOOST_TEST( !has_x86_avx2() );
+    BOOST_TEST( !has_x86_avx512f() );
+    BOOST_TEST( !has_x86_gfni_pclmul() );
+    BOOST_TEST( !has_x86_pclmul() );
+    BOOST_TEST( !has_x86_avx512_vpclmul() );
+
+#endif
+
+    cpu_features f = {};
+
+    f.sse2 = f.ssse3 = f.sse41 = f.sse42 = f.pclmul = f.aes = f.sha = f.avx2 = f.bmi = f.bmi2 = f.avx512f = f.gfni = f.vpclmul = true;
+
+    {
+        cpu_features g = limit_cpu_features( f, 0 );
+
+        BOOST_TEST( !g.sse2 );
+        BOOST_TEST( !g.sse41 );
+        BOOST_TEST( !g.sha );
+        BOOST_TEST( !g.avx2 );
+    }
+
+    {
+        cpu_features g = limit_cpu_features( f, 1 );
+
+        BOOST_TEST( g.sse2 );
+        BOOST_TEST( !g.ssse3 );
+        BOOST_TEST( !g.sse42 );
+        BOOST_TEST( !g.pclmul );
+        BOOST_TEST( !g.aes );
+        BOOST_TEST( !g.avx2 );
+    }
+
+    {
+        cpu_features g = limit_cpu_features( f, 2 );
+
+        BOOST_TEST( g.sse2 );
+        BOOST_TEST( g.sse41 );
+        BOOST_TEST( g.sse42 );
+        BOOST_TEST( g.pclmul );
+        BOOST_TEST( g.aes );
+        BOOST_TEST( g.sha );
+        BOOST_TEST( !g.avx2 );
+        BOOST_TEST( !g.bmi2 );
+    }
+
+    {
+        cpu_features g = limit_cpu_features( f, 3 );
+
+        BOOST_TEST( g.sse2 );
+        BOOST_TEST( g.sha );
+        BOOST_TEST( g.avx2 );
+        BOOST_TEST( g.bmi );
+        BOOST_TEST( g.bmi2 );
+        BOOST_TEST( !g.avx512f );
+        BOOST_TEST( !g.gfni );
+        BOOST_TEST( !g.vpclmul );
+    }
+
+    {
+        cpu_features g = limit_cpu_features( f, 4 );
+
+        BOOST_TEST( g.sse2 );
+        BOOST_TEST( g.avx2 );
+        BOOST_TEST( g.avx512f );
+        BOOST_TEST( g.gfni );
+        BOOST_TEST( g.vpclmul );
+    }
+
+    // limiting never adds features
+
+    {
+        cpu_features h = {};
+        cpu_features g = limit_cpu_features( h, 4 );
+
+        BOOST_TEST( !g.sse2 );
+        BOOST_TEST( !g.avx2 );
+        BOOST_TEST( !g.avx512f );
+    }
+
+    return boost::report_errors();
+}
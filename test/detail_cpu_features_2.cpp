@@ -0,0 +1,38 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+// BOOST_HASH2_X86_ISA_LEVEL limits the accelerated code paths at runtime
+
+#define BOOST_HASH2_X86_ISA_LEVEL 1
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/detail/cpu_features.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+int main()
+{
+    using namespace boost::hash2::detail;
+
+    BOOST_TEST( !has_x86_sse41() );
+    BOOST_TEST( !has_x86_sse42() );
+    BOOST_TEST( !has_x86_sha() );
+    BOOST_TEST( !has_x86_avx2() );
+    BOOST_TEST( !has_x86_bmi2() );
+
+    BOOST_TEST_EQ( digest<boost::hash2::sha2_256>( "abc" ), std::string( "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" ) );
+    BOOST_TEST_EQ( digest<boost::hash2::blake2s_256>( "abc" ), std::string( "508c5e8c327c14e2e1a72ba34eeb452f37458b209ed63a294d999b4c86675982" ) );
+
+    return boost::report_errors();
+}
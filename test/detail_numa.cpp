@@ -0,0 +1,76 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/detail/numa.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+#include <vector>
+
+int main()
+{
+    using namespace boost::hash2;
+
+    int const n = detail::numa_node_count();
+
+    BOOST_TEST_GE( n, 1 );
+    BOOST_TEST_EQ( detail::numa_node_count(), n );
+
+    std::vector<unsigned char> buffer( 1 << 20, 0x5A );
+
+    {
+        int node = detail::numa_node_of( buffer.data() );
+
+        BOOST_TEST_GE( node, -1 );
+        BOOST_TEST_LT( node, n );
+    }
+
+    // binding a worker to the node of a buffer is always allowed; the
+    // calling thread is left alone
+
+    {
+        bool r = true;
+
+        std::thread th( [&]{
+
+            int node = detail::numa_node_of( buffer.data() );
+
+            if( node >= 0 )
+            {
+                r = detail::numa_bind( node );
+            }
+
+            detail::numa_bind_worker( buffer.data() );
+        });
+
+        th.join();
+
+        BOOST_TEST( r );
+    }
+
+    // a node without CPUs that the thread may run on is rejected
+
+    {
+        bool r = true;
+
+        std::thread th( [&]{ r = detail::numa_bind( 1 << 20 ); } );
+        th.join();
+
+        BOOST_TEST( !r );
+    }
+
+    // the parallel modes give the same results with the binding
+
+    {
+        crc32c h1;
+        h1.update( buffer.data(), buffer.size() );
+
+        crc32c h2;
+        h2.update_parallel( buffer.data(), buffer.size(), 4 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
@@ -9,7 +9,9 @@
 #include <boost/config/workaround.hpp>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
 #include <type_traits>
+#include <cstdint>
 
 #define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
 
@@ -236,6 +238,49 @@ static void test_comparisons()
     }
 }
 
+template<std::size_t N> static void test_ordering()
+{
+    // operator< agrees with the byte order of the digests, wherever they
+    // differ, including at the boundaries of the words
+
+    std::uint32_t x = 1;
+
+    for( int k = 0; k < 64; ++k )
+    {
+        digest<N> v1, v2;
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            x = x * 1664525 + 1013904223;
+            v1[ i ] = v2[ i ] = static_cast<unsigned char>( x >> 24 );
+        }
+
+        std::size_t const j = ( x >> 8 ) % N;
+
+        v2[ j ] = static_cast<unsigned char>( v2[ j ] + 1 + ( x & 0x7F ) );
+
+        bool const lt = std::lexicographical_compare( v1.begin(), v1.end(), v2.begin(), v2.end() );
+
+        BOOST_TEST_EQ( v1 < v2, lt );
+        BOOST_TEST_EQ( v2 < v1, !lt );
+        BOOST_TEST_EQ( v1 > v2, !lt );
+        BOOST_TEST_EQ( v1 <= v2, lt );
+        BOOST_TEST_EQ( v1 >= v2, !lt );
+
+        BOOST_TEST_NOT( v1 < v1 );
+        BOOST_TEST( v1 <= v1 );
+        BOOST_TEST( v1 >= v1 );
+    }
+
+    {
+        digest<N> v1, v2;
+        v2[ 0 ] = 0x80;
+
+        BOOST_TEST_LT( v1, v2 );
+        BOOST_TEST_GT( v2, v1 );
+    }
+}
+
 static void test_to_chars()
 {
     digest<5> const d{{ 0x12, 0x34, 0x56, 0x78, 0x9A }};
@@ -277,6 +322,334 @@ static void test_to_chars()
     }
 }
 
+template<std::size_t N> static std::string reference_hex( digest<N> const& d )
+{
+    std::ostringstream os;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        os << std::hex << std::setw( 2 ) << std::setfill( '0' ) << +d[ i ];
+    }
+
+    return os.str();
+}
+
+template<std::size_t N> static void test_to_chars_long()
+{
+    digest<N> d;
+
+    for( int k = 0; k < 256; k += 7 )
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            d[ i ] = static_cast<unsigned char>( k + i * 13 );
+        }
+
+        char buffer[ 2 * N + 1 ];
+        to_chars( d, buffer );
+
+        BOOST_TEST_EQ( std::string( buffer ), reference_hex( d ) );
+    }
+}
+
+template<std::size_t N> static void test_to_chars_bulk()
+{
+    digest<N> d[ 5 ];
+
+    for( std::size_t j = 0; j < 5; ++j )
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            d[ j ][ i ] = static_cast<unsigned char>( j * 71 + i * 13 + 1 );
+        }
+    }
+
+    std::string r;
+
+    for( std::size_t j = 0; j < 5; ++j )
+    {
+        r += reference_hex( d[ j ] );
+    }
+
+    char buffer[ 10 * N + 1 ];
+
+    for( std::size_t i = 0; i < 10 * N + 1; ++i ) buffer[ i ] = 0x7F;
+
+    BOOST_TEST_EQ( to_chars( d, 5, buffer, buffer + 10 * N - 1 ), nullptr );
+
+    BOOST_TEST_EQ( to_chars( d, 5, buffer, buffer + 10 * N + 1 ), buffer + 10 * N );
+    BOOST_TEST_EQ( std::string( buffer, 10 * N ), r );
+    BOOST_TEST_EQ( buffer[ 10 * N ], 0x7F );
+
+    BOOST_TEST_EQ( to_chars( d, 0, buffer, buffer ), buffer );
+}
+
+static void test_from_chars()
+{
+    digest<5> const d{{ 0x12, 0x34, 0x56, 0x78, 0x9A }};
+
+    {
+        char const s[] = "123456789a";
+        digest<5> v;
+
+        BOOST_TEST_EQ( from_chars( s, s + 9, v ), nullptr );
+        BOOST_TEST_EQ( v, digest<5>() );
+
+        BOOST_TEST_EQ( from_chars( s, s + 10, v ), s + 10 );
+        BOOST_TEST_EQ( v, d );
+    }
+
+    {
+        char const s[] = "123456789Aff";
+        digest<5> v;
+
+        BOOST_TEST_EQ( from_chars( s, s + 12, v ), s + 10 );
+        BOOST_TEST_EQ( v, d );
+    }
+
+    {
+        char const s[] = "12345g789a";
+        digest<5> v;
+
+        BOOST_TEST_EQ( from_chars( s, s + 10, v ), nullptr );
+        BOOST_TEST_EQ( v, digest<5>() );
+    }
+}
+
+template<std::size_t N> static void test_from_chars_long()
+{
+    digest<N> d;
+
+    for( int k = 0; k < 256; k += 7 )
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            d[ i ] = static_cast<unsigned char>( k + i * 13 );
+        }
+
+        std::string s = reference_hex( d );
+
+        digest<N> v;
+
+        BOOST_TEST_EQ( from_chars( s.data(), s.data() + s.size(), v ), s.data() + s.size() );
+        BOOST_TEST_EQ( v, d );
+
+        for( std::size_t i = 0; i < s.size(); ++i )
+        {
+            if( s[ i ] >= 'a' ) s[ i ] = static_cast<char>( s[ i ] - 'a' + 'A' );
+        }
+
+        v = digest<N>();
+
+        BOOST_TEST_EQ( from_chars( s.data(), s.data() + s.size(), v ), s.data() + s.size() );
+        BOOST_TEST_EQ( v, d );
+    }
+
+    // a character other than a hex digit, at each position
+
+    char const invalid[] = { '/', ':', '@', 'G', '`', 'g', ' ', '\x80', '\xC1', '\xE6' };
+
+    for( std::size_t i = 0; i < 2 * N; ++i )
+    {
+        for( char c: invalid )
+        {
+            std::string s = reference_hex( d );
+            s[ i ] = c;
+
+            digest<N> v;
+
+            BOOST_TEST_EQ( from_chars( s.data(), s.data() + s.size(), v ), nullptr );
+        }
+    }
+}
+
+template<std::size_t N> static void test_from_chars_bulk()
+{
+    digest<N> d[ 5 ];
+
+    for( std::size_t j = 0; j < 5; ++j )
+    {
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            d[ j ][ i ] = static_cast<unsigned char>( j * 71 + i * 13 + 1 );
+        }
+    }
+
+    std::string s;
+
+    for( std::size_t j = 0; j < 5; ++j )
+    {
+        s += reference_hex( d[ j ] );
+    }
+
+    digest<N> v[ 5 ];
+
+    BOOST_TEST_EQ( from_chars( s.data(), s.data() + s.size() - 1, v, 5 ), nullptr );
+
+    BOOST_TEST_EQ( from_chars( s.data(), s.data() + s.size(), v, 5 ), s.data() + s.size() );
+
+    for( std::size_t j = 0; j < 5; ++j )
+    {
+        BOOST_TEST_EQ( v[ j ], d[ j ] );
+    }
+
+    BOOST_TEST_EQ( from_chars( s.data(), s.data(), v, 0 ), s.data() );
+
+    s[ s.size() - 1 ] = 'x';
+
+    BOOST_TEST_EQ( from_chars( s.data(), s.data() + s.size(), v, 5 ), nullptr );
+}
+
+// the test vectors of RFC 4648, section 10
+
+static void test_base64()
+{
+    {
+        digest<1> d{{ 'f' }};
+
+        char buffer[ 5 ];
+        to_base64( d, buffer );
+        BOOST_TEST_EQ( std::string( buffer ), std::string( "Zg==" ) );
+
+        char buffer2[ 3 ];
+        to_base64url( d, buffer2 );
+        BOOST_TEST_EQ( std::string( buffer2 ), std::string( "Zg" ) );
+
+        digest<1> v;
+
+        BOOST_TEST_EQ( from_base64( buffer, buffer + 4, v ), buffer + 4 );
+        BOOST_TEST_EQ( v, d );
+
+        v = digest<1>();
+
+        BOOST_TEST_EQ( from_base64url( buffer2, buffer2 + 2, v ), buffer2 + 2 );
+        BOOST_TEST_EQ( v, d );
+    }
+
+    {
+        digest<2> d{{ 'f', 'o' }};
+
+        char buffer[ 5 ];
+        to_base64( d, buffer );
+        BOOST_TEST_EQ( std::string( buffer ), std::string( "Zm8=" ) );
+
+        char buffer2[ 4 ];
+        to_base64url( d, buffer2 );
+        BOOST_TEST_EQ( std::string( buffer2 ), std::string( "Zm8" ) );
+
+        digest<2> v;
+
+        BOOST_TEST_EQ( from_base64( buffer, buffer + 4, v ), buffer + 4 );
+        BOOST_TEST_EQ( v, d );
+
+        v = digest<2>();
+
+        BOOST_TEST_EQ( from_base64url( buffer2, buffer2 + 3, v ), buffer2 + 3 );
+        BOOST_TEST_EQ( v, d );
+    }
+
+    {
+        digest<6> d{{ 'f', 'o', 'o', 'b', 'a', 'r' }};
+
+        char buffer[ 9 ];
+        to_base64( d, buffer );
+        BOOST_TEST_EQ( std::string( buffer ), std::string( "Zm9vYmFy" ) );
+
+        to_base64url( d, buffer );
+        BOOST_TEST_EQ( std::string( buffer ), std::string( "Zm9vYmFy" ) );
+
+        digest<6> v;
+
+        BOOST_TEST_EQ( from_base64( buffer, buffer + 8, v ), buffer + 8 );
+        BOOST_TEST_EQ( v, d );
+    }
+
+    {
+        digest<5> d{{ 'f', 'o', 'o', 'b', 'a' }};
+
+        char buffer[ 8 ] = {};
+
+        BOOST_TEST_EQ( to_base64( d, buffer, buffer + 7 ), nullptr );
+        BOOST_TEST_EQ( to_base64( d, buffer, buffer + 8 ), buffer + 8 );
+        BOOST_TEST_EQ( std::string( buffer, 8 ), std::string( "Zm9vYmE=" ) );
+
+        BOOST_TEST_EQ( to_base64url( d, buffer, buffer + 6 ), nullptr );
+        BOOST_TEST_EQ( to_base64url( d, buffer, buffer + 8 ), buffer + 7 );
+        BOOST_TEST_EQ( std::string( buffer, 7 ), std::string( "Zm9vYmE" ) );
+    }
+
+    // the digits 62 and 63
+
+    {
+        digest<3> d{{ 0xFB, 0xEF, 0xFF }};
+
+        char buffer[ 5 ];
+
+        to_base64( d, buffer );
+        BOOST_TEST_EQ( std::string( buffer ), std::string( "++//" ) );
+
+        to_base64url( d, buffer );
+        BOOST_TEST_EQ( std::string( buffer ), std::string( "--__" ) );
+
+        digest<3> v;
+
+        BOOST_TEST_EQ( from_base64url( buffer, buffer + 4, v ), buffer + 4 );
+        BOOST_TEST_EQ( v, d );
+
+        BOOST_TEST_EQ( from_base64( buffer, buffer + 4, v ), nullptr );
+    }
+
+    // invalid input
+
+    {
+        digest<1> v;
+
+        char const s1[] = "Zg=";
+        BOOST_TEST_EQ( from_base64( s1, s1 + 3, v ), nullptr );
+
+        char const s2[] = "Zg=x";
+        BOOST_TEST_EQ( from_base64( s2, s2 + 4, v ), nullptr );
+
+        char const s3[] = "Zh==";
+        BOOST_TEST_EQ( from_base64( s3, s3 + 4, v ), nullptr );
+
+        char const s4[] = "Z*==";
+        BOOST_TEST_EQ( from_base64( s4, s4 + 4, v ), nullptr );
+
+        BOOST_TEST_EQ( v, digest<1>() );
+    }
+}
+
+template<std::size_t N> static void test_base64_round_trip()
+{
+    digest<N> d;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        d[ i ] = static_cast<unsigned char>( i * 37 + 5 );
+    }
+
+    {
+        char buffer[ ( N + 2 ) / 3 * 4 + 1 ];
+        to_base64( d, buffer );
+
+        digest<N> v;
+
+        BOOST_TEST_EQ( from_base64( buffer, buffer + sizeof( buffer ) - 1, v ), buffer + sizeof( buffer ) - 1 );
+        BOOST_TEST_EQ( v, d );
+    }
+
+    {
+        char buffer[ ( N * 4 + 2 ) / 3 + 1 ];
+        to_base64url( d, buffer );
+
+        digest<N> v;
+
+        BOOST_TEST_EQ( from_base64url( buffer, buffer + sizeof( buffer ) - 1, v ), buffer + sizeof( buffer ) - 1 );
+        BOOST_TEST_EQ( v, d );
+    }
+}
+
 static void test_to_string()
 {
     digest<8> d{{ 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF }};
@@ -305,7 +678,51 @@ int main()
     test_iteration();
     test_element_access();
     test_comparisons();
+
+    test_ordering<1>();
+    test_ordering<7>();
+    test_ordering<8>();
+    test_ordering<9>();
+    test_ordering<20>();
+    test_ordering<32>();
+
     test_to_chars();
+
+    test_to_chars_long<1>();
+    test_to_chars_long<15>();
+    test_to_chars_long<16>();
+    test_to_chars_long<17>();
+    test_to_chars_long<20>();
+    test_to_chars_long<32>();
+    test_to_chars_long<64>();
+
+    test_to_chars_bulk<1>();
+    test_to_chars_bulk<5>();
+    test_to_chars_bulk<20>();
+    test_to_chars_bulk<32>();
+
+    test_from_chars();
+
+    test_from_chars_long<1>();
+    test_from_chars_long<15>();
+    test_from_chars_long<16>();
+    test_from_chars_long<17>();
+    test_from_chars_long<20>();
+    test_from_chars_long<32>();
+    test_from_chars_long<64>();
+
+    test_from_chars_bulk<1>();
+    test_from_chars_bulk<5>();
+    test_from_chars_bulk<20>();
+    test_from_chars_bulk<32>();
+
+    test_base64();
+
+    test_base64_round_trip<16>();
+    test_base64_round_trip<20>();
+    test_base64_round_trip<32>();
+    test_base64_round_trip<64>();
+
     test_to_string();
     test_stream_insert();
 
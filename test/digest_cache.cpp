@@ -0,0 +1,192 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+// the files are hashed right after they are written
+#define BOOST_HASH2_DIGEST_CACHE_RACY_NS 0
+
+#include <boost/hash2/digest_cache.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_HASH2_HAS_POSIX_FILES is not defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <system_error>
+#include <cstdio>
+
+using namespace boost::hash2;
+
+static char const* const fn = "digest_cache_test.tmp";
+static char const* const cfn = "digest_cache_test.cache";
+
+static bool write_file( char const* name, std::string const& s )
+{
+    std::FILE* f = std::fopen( name, "wb" );
+    if( f == 0 ) return false;
+
+    bool r = std::fwrite( s.data(), 1, s.size(), f ) == s.size();
+
+    return std::fclose( f ) == 0 && r;
+}
+
+template<class H> static typename H::result_type digest_of( std::string const& s )
+{
+    H h;
+    h.update( s.data(), s.size() );
+
+    return h.result();
+}
+
+int main()
+{
+    std::remove( cfn );
+
+    std::string const s1( 1000, 'a' );
+    std::string const s2( 1001, 'b' );
+
+    BOOST_TEST( write_file( fn, s1 ) );
+
+    {
+        digest_cache cache;
+
+        std::error_code ec;
+        cache.open( cfn, ec );
+
+        BOOST_TEST( !ec ) && BOOST_TEST( cache.is_open() );
+        BOOST_TEST_EQ( cache.size(), 0u );
+
+        // the first time, the file is hashed
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s1 ) );
+        BOOST_TEST( !ec );
+
+        BOOST_TEST_EQ( cache.hits(), 0u );
+        BOOST_TEST_EQ( cache.misses(), 1u );
+        BOOST_TEST_EQ( cache.size(), 1u );
+
+        // the second time, it's found
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s1 ) );
+        BOOST_TEST( !ec );
+
+        BOOST_TEST_EQ( cache.hits(), 1u );
+
+        // each algorithm has its own digest
+
+        BOOST_TEST( cache.hash_file<md5_128>( fn, ec ) == digest_of<md5_128>( s1 ) );
+        BOOST_TEST( !ec );
+
+        BOOST_TEST_EQ( cache.misses(), 2u );
+        BOOST_TEST_EQ( cache.size(), 2u );
+
+        // errors are reported
+
+        cache.hash_file<sha2_256>( "digest_cache_test.missing", ec );
+        BOOST_TEST( ec );
+    }
+
+    // the digests persist
+
+    {
+        digest_cache cache;
+
+        std::error_code ec;
+        cache.open( cfn, ec );
+
+        BOOST_TEST( !ec );
+        BOOST_TEST_EQ( cache.size(), 2u );
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s1 ) );
+        BOOST_TEST( cache.hash_file<md5_128>( fn, ec ) == digest_of<md5_128>( s1 ) );
+
+        BOOST_TEST_EQ( cache.hits(), 2u );
+        BOOST_TEST_EQ( cache.misses(), 0u );
+
+        // a changed file is hashed again, and its new digest supersedes
+        // the old one
+
+        BOOST_TEST( write_file( fn, s2 ) );
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s2 ) );
+        BOOST_TEST_EQ( cache.misses(), 1u );
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s2 ) );
+        BOOST_TEST_EQ( cache.hits(), 3u );
+
+        BOOST_TEST_EQ( cache.size(), 2u );
+    }
+
+    {
+        digest_cache cache;
+
+        std::error_code ec;
+        cache.open( cfn, ec );
+
+        BOOST_TEST( !ec );
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s2 ) );
+        BOOST_TEST_EQ( cache.hits(), 1u );
+
+        // md5 is stale
+
+        BOOST_TEST( cache.hash_file<md5_128>( fn, ec ) == digest_of<md5_128>( s2 ) );
+        BOOST_TEST_EQ( cache.misses(), 1u );
+    }
+
+    // a record cut short is dropped
+
+    {
+        std::FILE* f = std::fopen( cfn, "ab" );
+
+        BOOST_TEST( f != 0 ) && BOOST_TEST_EQ( std::fwrite( "xyz", 1, 3, f ), 3u );
+        if( f ) std::fclose( f );
+
+        digest_cache cache;
+
+        std::error_code ec;
+        cache.open( cfn, ec );
+
+        BOOST_TEST( !ec );
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s2 ) );
+        BOOST_TEST_EQ( cache.hits(), 1u );
+    }
+
+    // a file that isn't a cache isn't opened, and files are hashed
+    // without one
+
+    {
+        BOOST_TEST( write_file( cfn, std::string( 200, 'x' ) ) );
+
+        digest_cache cache;
+
+        std::error_code ec;
+        cache.open( cfn, ec );
+
+        BOOST_TEST( ec );
+        BOOST_TEST( !cache.is_open() );
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s2 ) );
+        BOOST_TEST( !ec );
+
+        BOOST_TEST( cache.hash_file<sha2_256>( fn, ec ) == digest_of<sha2_256>( s2 ) );
+        BOOST_TEST_EQ( cache.hits(), 0u );
+    }
+
+    std::remove( fn );
+    std::remove( cfn );
+
+    return boost::report_errors();
+}
+
+#endif
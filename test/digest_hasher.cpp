@@ -0,0 +1,118 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/digest_hasher.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <unordered_map>
+#include <type_traits>
+#include <cstddef>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using namespace boost::hash2;
+
+template<std::size_t N> static digest<N> make_digest( int k )
+{
+    digest<N> r;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        r[ i ] = static_cast<unsigned char>( k * 31 + i * 7 + 1 );
+    }
+
+    return r;
+}
+
+template<std::size_t N> static void test_hasher()
+{
+    digest_hasher h;
+
+    for( int k = 0; k < 16; ++k )
+    {
+        digest<N> d = make_digest<N>( k );
+        BOOST_TEST_EQ( h( d ), get_integral_result<std::size_t>( d ) );
+    }
+}
+
+template<std::size_t N> static void test_equal()
+{
+    digest_equal eq;
+
+    digest<N> const d = make_digest<N>( 3 );
+
+    BOOST_TEST( eq( d, d ) );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        digest<N> d2 = d;
+        d2[ i ] ^= 0x10;
+
+        BOOST_TEST_NOT( eq( d, d2 ) );
+        BOOST_TEST_NOT( eq( d2, d ) );
+    }
+}
+
+template<class M> static void test_map()
+{
+    M m;
+
+    for( int k = 0; k < 1000; ++k )
+    {
+        sha2_256 h;
+        h.update( &k, sizeof(k) );
+
+        m[ h.result() ] = k;
+    }
+
+    BOOST_TEST_EQ( m.size(), 1000u );
+
+    for( int k = 0; k < 1000; ++k )
+    {
+        sha2_256 h;
+        h.update( &k, sizeof(k) );
+
+        auto it = m.find( h.result() );
+
+        BOOST_TEST( it != m.end() ) && BOOST_TEST_EQ( it->second, k );
+    }
+}
+
+int main()
+{
+    STATIC_ASSERT( digest_hasher::is_avalanching::value );
+
+    test_hasher<8>();
+    test_hasher<16>();
+    test_hasher<20>();
+    test_hasher<32>();
+    test_hasher<64>();
+
+    test_equal<8>();
+    test_equal<13>();
+    test_equal<16>();
+    test_equal<20>();
+    test_equal<32>();
+
+    test_map< std::unordered_map<digest<32>, int, digest_hasher, digest_equal> >();
+    test_map< boost::unordered_map<digest<32>, int, digest_hasher, digest_equal> >();
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR) && !( defined(BOOST_GCC) && BOOST_GCC < 60000 )
+
+    {
+        constexpr digest<8> d1{{ 1, 2, 3, 4, 5, 6, 7, 8 }};
+        constexpr digest<8> d2{{ 1, 2, 3, 4, 5, 6, 7, 9 }};
+
+        STATIC_ASSERT( digest_hasher()( d1 ) == static_cast<std::size_t>( 0x0807060504030201ull ) );
+        STATIC_ASSERT( digest_equal()( d1, d1 ) );
+        STATIC_ASSERT( !digest_equal()( d1, d2 ) );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
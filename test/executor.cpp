@@ -0,0 +1,223 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/executor.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/merkle_tree.hpp>
+#include <boost/hash2/mphf.hpp>
+#include <boost/hash2/chunk_digest.hpp>
+#include <boost/hash2/parallel_hash.hpp>
+#include <boost/hash2/hash_append_parallel.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+// an executor that runs the calls on the calling thread, last to first,
+// as an adaptor to another pool may
+
+class reverse_executor: public task_executor
+{
+public:
+
+    unsigned concurrency() const noexcept override
+    {
+        return 4;
+    }
+
+    void bulk_execute( std::size_t n, void (*f)( void* ctx, std::size_t i ), void* ctx ) override
+    {
+        for( std::size_t i = n; i > 0; --i )
+        {
+            f( ctx, i - 1 );
+        }
+    }
+};
+
+static void test_bulk( task_executor& ex )
+{
+    BOOST_TEST_GE( ex.concurrency(), 1u );
+
+    for( std::size_t n = 0; n < 40; ++n )
+    {
+        std::vector< std::atomic<int> > v( n );
+
+        for( auto& x: v ) x = 0;
+
+        bulk_execute( ex, n, [&]( std::size_t i ){ ++v[ i ]; } );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST_EQ( v[ i ].load(), 1 );
+        }
+    }
+
+    // nested calls
+
+    {
+        std::atomic<int> k( 0 );
+
+        bulk_execute( ex, 8, [&]( std::size_t ){
+
+            bulk_execute( ex, 8, [&]( std::size_t ){
+
+                bulk_execute( ex, 4, [&]( std::size_t ){ ++k; } );
+            });
+        });
+
+        BOOST_TEST_EQ( k.load(), 256 );
+    }
+}
+
+template<class H> static void test_update_parallel( task_executor& ex, std::vector<unsigned char> const& v )
+{
+    H h1;
+    h1.update( v.data(), 17 );
+    h1.update( v.data() + 17, v.size() - 17 );
+
+    H h2;
+    h2.update( v.data(), 17 );
+    h2.update_parallel( v.data() + 17, v.size() - 17, ex );
+
+    BOOST_TEST( h1.result() == h2.result() );
+}
+
+static void test_algorithms( task_executor& ex )
+{
+    std::vector<unsigned char> v( 5 * 1024 * 1024 + 123 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 7 + ( i >> 11 ) );
+    }
+
+    test_update_parallel<crc32c>( ex, v );
+    test_update_parallel<blake3>( ex, v );
+    test_update_parallel<k12>( ex, v );
+
+    {
+        blake3 h( 5 );
+        h.update( v.data(), v.size() );
+
+        BOOST_TEST( parallel_hash<blake3>( ex, v.data(), v.size(), 5 ) == h.result() );
+    }
+
+    {
+        // without update_parallel, on the calling thread
+
+        sha2_256 h( 5 );
+        h.update( v.data(), v.size() );
+
+        BOOST_TEST( parallel_hash<sha2_256>( ex, v.data(), v.size(), 5 ) == h.result() );
+    }
+
+    {
+        merkle_tree<sha2_256> t1( 64 * 1024 ), t2( 64 * 1024 );
+
+        t1.build( v.data(), v.size(), 1u );
+        t2.build( v.data(), v.size(), ex );
+
+        BOOST_TEST( t1.root() == t2.root() );
+    }
+
+    {
+        fastcdc c( 2048, 8192, 65536 );
+
+        chunk_digester<sha2_256> d1( c, 1u ), d2( c, ex );
+        std::vector< chunk_record<sha2_256> > r1, r2;
+
+        d1.update( v.data(), v.size(), [&]( chunk_record<sha2_256> const& r ){ r1.push_back( r ); } );
+        d2.update( v.data(), v.size(), [&]( chunk_record<sha2_256> const& r ){ r2.push_back( r ); } );
+
+        BOOST_TEST_EQ( r1.size(), r2.size() );
+
+        for( std::size_t i = 0; i < r1.size() && i < r2.size(); ++i )
+        {
+            BOOST_TEST_EQ( r1[ i ].offset, r2[ i ].offset );
+            BOOST_TEST( r1[ i ].digest == r2[ i ].digest );
+        }
+    }
+
+    {
+        crc32c h1, h2;
+
+        hash_append_range( h1, default_flavor(), v.data(), v.data() + v.size() );
+        hash_append_range( ex, h2, default_flavor(), v.data(), v.data() + v.size() );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        std::vector<std::string> keys;
+
+        for( int i = 0; i < 20000; ++i )
+        {
+            keys.push_back( "key" + std::to_string( i ) );
+        }
+
+        sha2_256 h1, h2;
+
+        hash_append_unordered_range( h1, default_flavor(), keys.begin(), keys.end() );
+        hash_append_unordered_range( ex, h2, default_flavor(), keys.begin(), keys.end() );
+
+        BOOST_TEST( h1.result() == h2.result() );
+
+        mphf<std::string, xxhash_64> f1( keys.begin(), keys.end(), 1u );
+        mphf<std::string, xxhash_64> f2( keys.begin(), keys.end(), ex );
+
+        for( auto const& k: keys )
+        {
+            BOOST_TEST_EQ( f1( k ), f2( k ) );
+        }
+    }
+}
+
+int main()
+{
+    {
+        thread_executor ex( 4 );
+
+        BOOST_TEST_EQ( ex.concurrency(), 4u );
+
+        test_bulk( ex );
+        test_algorithms( ex );
+    }
+
+    {
+        thread_executor ex;
+        test_bulk( ex );
+    }
+
+    {
+        work_stealing_executor ex( 4 );
+
+        test_bulk( ex );
+        test_algorithms( ex );
+    }
+
+    {
+        work_stealing_executor ex( 1 );
+
+        BOOST_TEST_EQ( ex.concurrency(), 1u );
+
+        test_bulk( ex );
+    }
+
+    {
+        reverse_executor ex;
+
+        test_bulk( ex );
+        test_algorithms( ex );
+    }
+
+    return boost::report_errors();
+}
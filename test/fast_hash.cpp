@@ -0,0 +1,137 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fast_hash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::fast_hash;
+using boost::hash2::fast_hash_algorithm;
+
+static unsigned char buffer[ 1024 ];
+
+std::uint64_t result64( boost::hash2::aes_hash_128& h )
+{
+    return boost::hash2::detail::read64le( h.result().data() );
+}
+
+template<class H> std::uint64_t result64( H& h )
+{
+    return h.result();
+}
+
+// fast_hash is H, for the given constructor arguments
+
+template<class H, class... A> void test( A... a )
+{
+    std::size_t const sizes[] = { 0, 1, 3, 16, 17, 64, 95, 96, 97, 240, 241, 1024 };
+
+    for( std::size_t n: sizes )
+    {
+        fast_hash h( a... );
+        H h2( a... );
+
+        h.update( buffer, n );
+        h2.update( buffer, n );
+
+        // copies continue independently
+
+        fast_hash h3( h );
+        H h4( h2 );
+
+        BOOST_TEST_EQ( h.result(), result64( h2 ) );
+
+        // repeated calls
+
+        BOOST_TEST_EQ( h.result(), result64( h2 ) );
+
+        h3.update( buffer, 7 );
+        h4.update( buffer, 7 );
+
+        BOOST_TEST_EQ( h3.result(), result64( h4 ) );
+    }
+
+    // split writes
+
+    {
+        fast_hash h( a... );
+        H h2( a... );
+
+        for( std::size_t i = 0; i < sizeof( buffer ); i += 37 )
+        {
+            std::size_t n = sizeof( buffer ) - i < 37? sizeof( buffer ) - i: 37;
+
+            h.update( buffer + i, n );
+        }
+
+        h2.update( buffer, sizeof( buffer ) );
+
+        BOOST_TEST_EQ( h.result(), result64( h2 ) );
+    }
+}
+
+template<class... A> void test_( A... a )
+{
+    switch( fast_hash::algorithm() )
+    {
+    case fast_hash_algorithm::aes_hash_128:
+
+        test<boost::hash2::aes_hash_128>( a... );
+        break;
+
+    case fast_hash_algorithm::xxh3_64:
+
+        test<boost::hash2::xxh3_64>( a... );
+        break;
+
+    case fast_hash_algorithm::rapidhash_64:
+
+        test<boost::hash2::rapidhash_64>( a... );
+        break;
+    }
+}
+
+int main()
+{
+    for( std::size_t i = 0; i < sizeof( buffer ); ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+#if defined(BOOST_HASH2_DISABLE_INTRINSICS)
+
+    BOOST_TEST( fast_hash::algorithm() == fast_hash_algorithm::rapidhash_64 );
+
+#endif
+
+    test_();
+    test_( static_cast<std::uint64_t>( 0 ) );
+    test_( static_cast<std::uint64_t>( 0x0123456789ABCDEF ) );
+
+    {
+        unsigned char const seed[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17 };
+
+        test_( seed, static_cast<std::size_t>( 5 ) );
+        test_( seed, static_cast<std::size_t>( 16 ) );
+        test_( seed, static_cast<std::size_t>( 17 ) );
+    }
+
+    // seeds give different results
+
+    {
+        fast_hash h1( 1 ), h2( 2 );
+
+        h1.update( buffer, 100 );
+        h2.update( buffer, 100 );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,144 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fastcdc.hpp>
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <numeric>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::vector<unsigned char> make_data( std::size_t n, std::uint32_t seed )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint32_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return v;
+}
+
+// the boundary, computed a byte at a time with gear_hash_64
+
+static std::size_t reference_next( fastcdc const& c, gear_hash_64 const& g0, unsigned char const* p, std::size_t n )
+{
+    if( n <= c.min_size() ) return n;
+
+    std::size_t e = n < c.max_size()? n: c.max_size();
+
+    unsigned b = 0;
+    while( ( std::size_t( 2 ) << b ) <= c.avg_size() ) ++b;
+
+    std::uint64_t mask_s = ~std::uint64_t( 0 ) << ( 64 - ( b + 2 ) );
+    std::uint64_t mask_l = ~std::uint64_t( 0 ) << ( 64 - ( b - 2 ) );
+
+    for( std::size_t i = c.min_size(); i <= e; i += 2 )
+    {
+        gear_hash_64 g( g0 );
+        g.update( p + i - 64, 64 );
+
+        std::uint64_t m = i < c.avg_size()? mask_s: mask_l;
+
+        if( ( g.value() & m ) == 0 ) return i;
+    }
+
+    return e;
+}
+
+static void test( fastcdc const& c, gear_hash_64 const& g )
+{
+    std::vector<unsigned char> v = make_data( 1 << 20, 1 );
+
+    std::vector<std::size_t> r;
+    c.split( v.data(), v.size(), r );
+
+    BOOST_TEST_EQ( std::accumulate( r.begin(), r.end(), std::size_t( 0 ) ), v.size() );
+
+    std::size_t k = 0;
+
+    for( std::size_t i = 0; i < r.size(); ++i )
+    {
+        BOOST_TEST_EQ( r[ i ], reference_next( c, g, v.data() + k, v.size() - k ) );
+
+        if( i + 1 < r.size() )
+        {
+            BOOST_TEST_GE( r[ i ], c.min_size() );
+        }
+
+        BOOST_TEST_LE( r[ i ], c.max_size() );
+
+        k += r[ i ];
+    }
+
+    // the average is close to avg_size
+
+    double avg = static_cast<double>( v.size() ) / r.size();
+
+    BOOST_TEST_GT( avg, c.avg_size() * 0.6 );
+    BOOST_TEST_LT( avg, c.avg_size() * 1.6 );
+
+    // an insertion only changes the chunks around it
+
+    {
+        std::vector<unsigned char> v2( v );
+        v2.insert( v2.begin() + v2.size() / 2, 100, 0xAA );
+
+        std::vector<std::size_t> r2;
+        c.split( v2.data(), v2.size(), r2 );
+
+        std::size_t same = 0;
+
+        for( std::size_t i = 0; i < r.size() && i < r2.size(); ++i )
+        {
+            if( r[ r.size() - 1 - i ] != r2[ r2.size() - 1 - i ] ) break;
+            ++same;
+        }
+
+        for( std::size_t i = 0; i < r.size() && i < r2.size(); ++i )
+        {
+            if( r[ i ] != r2[ i ] ) break;
+            ++same;
+        }
+
+        BOOST_TEST_GE( same + 4, r.size() );
+    }
+}
+
+int main()
+{
+    test( fastcdc( 2048, 8192, 65536 ), gear_hash_64() );
+    test( fastcdc( 2048, 8192, 65536, 5 ), gear_hash_64( 5 ) );
+    test( fastcdc( 64, 256, 1024 ), gear_hash_64() );
+    test( fastcdc( 65, 300, 999 ), gear_hash_64() );
+    test( fastcdc( 1000, 4096, 4100 ), gear_hash_64() );
+
+    {
+        fastcdc c( 2048, 8192, 65536 );
+
+        std::vector<unsigned char> v = make_data( 100, 1 );
+
+        BOOST_TEST_EQ( c.next( v.data(), v.size() ), 100u );
+        BOOST_TEST_EQ( c.next( v.data(), 0 ), 0u );
+
+        // all-zero input is cut at max_size
+
+        std::vector<unsigned char> z( 200000 );
+        std::vector<std::size_t> r;
+
+        c.split( z.data(), z.size(), r );
+
+        BOOST_TEST_EQ( r.size(), 4u );
+        BOOST_TEST_EQ( r[ 0 ], 65536u );
+    }
+
+    return boost::report_errors();
+}
@@ -20,5 +20,17 @@ int main()
     BOOST_TEST_TRAIT_SAME( big_endian_flavor::size_type, std::uint64_t );
     BOOST_TEST( big_endian_flavor::byte_order == endian::big );
 
+    BOOST_TEST_TRAIT_SAME( default_flavor_32::size_type, std::uint32_t );
+    BOOST_TEST( default_flavor_32::byte_order == endian::native );
+
+    BOOST_TEST_TRAIT_SAME( little_endian_flavor_32::size_type, std::uint32_t );
+    BOOST_TEST( little_endian_flavor_32::byte_order == endian::little );
+
+    BOOST_TEST_TRAIT_SAME( big_endian_flavor_32::size_type, std::uint32_t );
+    BOOST_TEST( big_endian_flavor_32::byte_order == endian::big );
+
+    BOOST_TEST_TRAIT_SAME( unsized_flavor::size_type, void );
+    BOOST_TEST( unsized_flavor::byte_order == endian::native );
+
     return boost::report_errors();
 }
@@ -0,0 +1,94 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::fnv1a_64_wide;
+
+static void test( char const * s, std::uint64_t seed, std::uint64_t r )
+{
+    std::size_t n = std::strlen( s );
+
+    {
+        fnv1a_64_wide h( seed );
+
+        h.update( s, n );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    // byte at a time, and every split point
+
+    {
+        fnv1a_64_wide h( seed );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            h.update( s + i, 1 );
+        }
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    for( std::size_t i = 0; i <= n; ++i )
+    {
+        fnv1a_64_wide h( seed );
+
+        h.update( s, i );
+        h.update( s + i, n - i );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    BOOST_TEST_EQ( fnv1a_64_wide::hash( s, n, seed ), r );
+}
+
+int main()
+{
+    // reference values for the word-at-a-time construction
+
+    test( "", 0, 0x4ff326458797a46bull );
+    test( "a", 0, 0x6ceb8cdffcec94d8ull );
+    test( "abc", 0, 0x9433560f08c715abull );
+    test( "message digest", 0, 0xa30e9668f9bad388ull );
+    test( "abcdefghijklmnopqrstuvwxyz", 0, 0xdb777647a95d15fcull );
+    test( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0, 0xf360a7cdc9a13cc4ull );
+
+    test( "", 7, 0xa84f967d9fe1c8b8ull );
+    test( "a", 7, 0xa60ec48b903a97cdull );
+    test( "abc", 7, 0x816139a4b09392fbull );
+    test( "message digest", 7, 0xc4df0153b67b4619ull );
+    test( "abcdefghijklmnopqrstuvwxyz", 7, 0xbe03dfeb8275ed43ull );
+    test( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 7, 0xfb3e2832d0385cf7ull );
+
+    // zero padding of the last word doesn't collide
+
+    {
+        unsigned char const v[ 3 ] = { 'a', 'b', 0 };
+        BOOST_TEST_NE( fnv1a_64_wide::hash( v, 2 ), fnv1a_64_wide::hash( v, 3 ) );
+    }
+
+    // update_word is equivalent to update( p, 8 )
+
+    for( std::size_t i = 0; i < 8; ++i )
+    {
+        unsigned char const v[ 16 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01 };
+
+        fnv1a_64_wide h1, h2;
+
+        h1.update( v, i );
+        h2.update( v, i );
+
+        h1.update( v + 8, 8 );
+        h2.update_word( 0x0123456789ABCDEFull );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
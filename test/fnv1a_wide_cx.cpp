@@ -0,0 +1,59 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(disable: 4307) // integral constant overflow
+#endif
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N );
+
+    return h.result();
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR std::uint64_t test_hash( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    return boost::hash2::fnv1a_64_wide::hash( v, N, seed );
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v1[] = { 0 };
+    constexpr unsigned char v4[] = { 0, 1, 2, 3 };
+    constexpr unsigned char v16[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+    TEST_EQ( test<fnv1a_64_wide>( 0, v1 ), 0x18a305896b0d5f2full );
+    TEST_EQ( test<fnv1a_64_wide>( 0, v4 ), 0x2866d72bf060b82eull );
+    TEST_EQ( test<fnv1a_64_wide>( 0, v16 ), 0xa82950da41500abeull );
+
+    TEST_EQ( test<fnv1a_64_wide>( 7, v1 ), 0x042af73fec77f0a9ull );
+    TEST_EQ( test<fnv1a_64_wide>( 7, v4 ), 0x9e6942fc820edc72ull );
+    TEST_EQ( test<fnv1a_64_wide>( 7, v16 ), 0x814f0c889939e78full );
+
+    TEST_EQ( test_hash( 0, v16 ), 0xa82950da41500abeull );
+    TEST_EQ( test_hash( 7, v16 ), 0x814f0c889939e78full );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,109 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/frame_checksum.hpp>
+#include <boost/hash2/hashing_stream.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <ostream>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+template<class C> std::uint32_t checksum( std::string const& s )
+{
+    C c;
+    c.update( s.data(), s.size() );
+
+    return c.result();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // xxhash_32 and the low half of xxhash_64
+
+    BOOST_TEST_EQ( checksum<lz4_content_checksum>( "" ), 0x02CC5D05u );
+    BOOST_TEST_EQ( checksum<lz4_content_checksum>( "abc" ), 0x32D153FFu );
+
+    BOOST_TEST_EQ( checksum<zstd_content_checksum>( "" ), 0x51D8E999u );
+    BOOST_TEST_EQ( checksum<zstd_content_checksum>( "abc" ), 0xAD770999u );
+
+    // the fields are little endian
+
+    {
+        unsigned char buffer[ 5 ] = {};
+
+        zstd_content_checksum c;
+        BOOST_TEST( write_frame_checksum( c, buffer ) == buffer + zstd_content_checksum::size );
+
+        BOOST_TEST_EQ( buffer[ 0 ], 0x99 );
+        BOOST_TEST_EQ( buffer[ 1 ], 0xE9 );
+        BOOST_TEST_EQ( buffer[ 2 ], 0xD8 );
+        BOOST_TEST_EQ( buffer[ 3 ], 0x51 );
+        BOOST_TEST_EQ( buffer[ 4 ], 0 );
+    }
+
+    {
+        unsigned char buffer[ 4 ] = {};
+
+        lz4_content_checksum c;
+        write_frame_checksum( c, buffer );
+
+        BOOST_TEST_EQ( buffer[ 0 ], 0x05 );
+        BOOST_TEST_EQ( buffer[ 1 ], 0x5D );
+        BOOST_TEST_EQ( buffer[ 2 ], 0xCC );
+        BOOST_TEST_EQ( buffer[ 3 ], 0x02 );
+    }
+
+    // the frame descriptor written by the lz4 command line tool,
+    // 04 22 4D 18 64 40 A7
+
+    {
+        unsigned char const fd[] = { 0x64, 0x40 };
+        BOOST_TEST_EQ( lz4_header_checksum( fd, 2 ), 0xA7 );
+    }
+
+    BOOST_TEST_EQ( lz4_block_checksum( "abc", 3 ), 0x32D153FFu );
+
+    // hashing_compress passes the whole input, in order, to both
+
+    {
+        std::string s( 100000, ' ' );
+
+        for( std::size_t i = 0; i < s.size(); ++i )
+        {
+            s[ i ] = static_cast<char>( i * 7 + i / 256 );
+        }
+
+        std::string out;
+        std::size_t calls = 0;
+
+        lz4_content_checksum c;
+
+        hashing_compress( c, s.data(), s.size(), [&]( void const* p, std::size_t n ){
+
+            out.append( static_cast<char const*>( p ), n );
+            ++calls;
+
+        });
+
+        BOOST_TEST( out == s );
+        BOOST_TEST_GT( calls, 1u );
+
+        BOOST_TEST_EQ( c.result(), checksum<lz4_content_checksum>( s ) );
+
+        // the same, as a stream
+
+        hashing_streambuf<zstd_content_checksum> sb;
+        std::ostream os( &sb );
+
+        os << s;
+        os.flush();
+
+        BOOST_TEST_EQ( sb.result(), checksum<zstd_content_checksum>( s ) );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,153 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <set>
+#include <array>
+#include <cstdint>
+
+#if defined(BOOST_HAS_INT128)
+
+using T = boost::uint128_type;
+
+template<class R> void test_integral()
+{
+    using boost::hash2::get_integral_result;
+
+    std::set<std::uint64_t> lo, hi;
+
+    for( unsigned i = 0; i < 65536; ++i )
+    {
+        R r = static_cast<R>( i * 0x9E3779B97F4A7C15ull );
+        T t = get_integral_result<T>( r );
+
+        lo.insert( static_cast<std::uint64_t>( t ) );
+        hi.insert( static_cast<std::uint64_t>( t >> 64 ) );
+
+        // consistent with the 64 bit result
+
+        BOOST_TEST_EQ( static_cast<std::uint64_t>( get_integral_result<T>( get_integral_result<std::uint64_t>( r ) ) ), static_cast<std::uint64_t>( t ) );
+    }
+
+    BOOST_TEST_EQ( lo.size(), 65536u );
+    BOOST_TEST_EQ( hi.size(), 65536u );
+}
+
+void test_array()
+{
+    using boost::hash2::get_integral_result;
+
+    {
+        boost::hash2::xxh3_128 h;
+        h.update( "abc", 3 );
+
+        boost::hash2::digest<16> r = h.result();
+        T t = get_integral_result<T>( r );
+
+        BOOST_TEST_EQ( static_cast<std::uint64_t>( t ), boost::hash2::detail::read64le( r.data() ) );
+        BOOST_TEST_EQ( static_cast<std::uint64_t>( t >> 64 ), boost::hash2::detail::read64le( r.data() + 8 ) );
+
+        BOOST_TEST_EQ( static_cast<std::uint64_t>( t ), get_integral_result<std::uint64_t>( r ) );
+    }
+
+    {
+        std::array<unsigned char, 8> r = {{ 1, 2, 3, 4, 5, 6, 7, 8 }};
+        T t = get_integral_result<T>( r );
+
+        BOOST_TEST( t == get_integral_result<T>( get_integral_result<std::uint64_t>( r ) ) );
+    }
+
+    {
+        boost::hash2::sha2_256 h;
+        BOOST_TEST( get_integral_result<boost::int128_type>( h.result() ) != 0 );
+    }
+}
+
+#endif
+
+void test_words()
+{
+    using boost::hash2::get_result_words;
+    using boost::hash2::detail::read64le;
+
+    // from a result
+
+    {
+        boost::hash2::sha2_256 h;
+        h.update( "abc", 3 );
+
+        boost::hash2::digest<32> r = h.result();
+
+        std::array<std::uint64_t, 4> w = get_result_words<4>( r );
+
+        for( std::size_t i = 0; i < 4; ++i )
+        {
+            BOOST_TEST_EQ( w[ i ], read64le( r.data() + i * 8 ) );
+        }
+
+        std::array<std::uint64_t, 2> w2 = get_result_words<2>( r );
+
+        BOOST_TEST_EQ( w2[ 0 ], w[ 0 ] );
+        BOOST_TEST_EQ( w2[ 1 ], w[ 1 ] );
+    }
+
+    // from a hash algorithm with an integral result
+
+    {
+        boost::hash2::xxhash_64 h( 7 );
+        h.update( "abc", 3 );
+
+        boost::hash2::xxhash_64 h2( h );
+
+        std::array<std::uint64_t, 3> w = get_result_words<3>( h );
+
+        BOOST_TEST_EQ( w[ 0 ], h2.result() );
+        BOOST_TEST_EQ( w[ 1 ], h2.result() );
+        BOOST_TEST_EQ( w[ 2 ], h2.result() );
+
+        BOOST_TEST_NE( w[ 0 ], w[ 1 ] );
+        BOOST_TEST_NE( w[ 1 ], w[ 2 ] );
+    }
+
+    // from a hash algorithm with an array-like result
+
+    {
+        boost::hash2::sha2_256 h;
+        h.update( "abc", 3 );
+
+        boost::hash2::sha2_256 h2( h );
+
+        std::array<std::uint64_t, 6> w = get_result_words<6>( h );
+
+        boost::hash2::digest<32> r1 = h2.result();
+        boost::hash2::digest<32> r2 = h2.result();
+
+        BOOST_TEST_EQ( w[ 0 ], read64le( r1.data() ) );
+        BOOST_TEST_EQ( w[ 3 ], read64le( r1.data() + 24 ) );
+        BOOST_TEST_EQ( w[ 4 ], read64le( r2.data() ) );
+        BOOST_TEST_EQ( w[ 5 ], read64le( r2.data() + 8 ) );
+    }
+}
+
+int main()
+{
+#if defined(BOOST_HAS_INT128)
+
+    test_integral<std::uint32_t>();
+    test_integral<std::uint64_t>();
+    test_array();
+
+#endif
+
+    test_words();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,150 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/ghash.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using boost::hash2::ghash;
+
+static std::string tag( unsigned char const* key, void const* p, std::size_t n )
+{
+    ghash h( key, 16 );
+    h.update( p, n );
+
+    return to_string( h.result() );
+}
+
+static std::string tag( char const* s )
+{
+    ghash h;
+    h.update( s, std::strlen( s ) );
+
+    return to_string( h.result() );
+}
+
+static void test_incremental( unsigned char const* p, std::size_t n )
+{
+    unsigned char key[ 16 ];
+
+    for( int i = 0; i < 16; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+    }
+
+    for( std::size_t m = 0; m <= n; m += m < 80? 1: 37 )
+    {
+        std::string const r = tag( key, p, m );
+
+        for( std::size_t k = 1; k < 80; k += 7 )
+        {
+            ghash h( key, 16 );
+
+            std::size_t i = 0;
+
+            for( ; i + k <= m; i += k )
+            {
+                h.update( p + i, k );
+            }
+
+            h.update( p + i, m - i );
+
+            BOOST_TEST_EQ( to_string( h.result() ), r );
+        }
+    }
+}
+
+int main()
+{
+    // GCM test case 2 of the original submission: with the all-zero key,
+    // the default H, the tag is GHASH( C || 0^64 || 128 ) xor E( J0 )
+
+    {
+        unsigned char const c[ 32 ] =
+        {
+            0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92, 0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x80,
+        };
+
+        unsigned char const ej0[ 16 ] =
+        {
+            0x58, 0xe2, 0xfc, 0xce, 0xfa, 0x7e, 0x30, 0x61, 0x36, 0x7f, 0x1d, 0x57, 0xa4, 0xe7, 0x45, 0x5a,
+        };
+
+        ghash h;
+        h.update( c, 32 );
+
+        boost::hash2::digest<16> t = h.result();
+
+        for( int i = 0; i < 16; ++i )
+        {
+            t[ i ] ^= ej0[ i ];
+        }
+
+        BOOST_TEST_EQ( to_string( t ), std::string( "ab6e47d42cec13bdf53a67b21257bddf" ) );
+    }
+
+    // reference values
+
+    BOOST_TEST_EQ( tag( "" ), std::string( "00000000000000000000000000000000" ) );
+    BOOST_TEST_EQ( tag( "a" ), std::string( "aebb2588e5f8894b5125da4e2403770a" ) );
+    BOOST_TEST_EQ( tag( "abc" ), std::string( "c789a88a5540a6b85316713a9e548bee" ) );
+    BOOST_TEST_EQ( tag( "message digest" ), std::string( "e59cead3d80dd9537416c45459cca90d" ) );
+    BOOST_TEST_EQ( tag( "abcdefghijklmnopqrstuvwxyz" ), std::string( "be5c6cea412c2c2983582d0c05f46d7c" ) );
+    BOOST_TEST_EQ( tag( "12345678901234567890123456789012345678901234567890123456789012345678901234567890" ), std::string( "0f6c2d0d55270da84dff376926e8b7bb" ) );
+
+    {
+        std::vector<unsigned char> v( 4096 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+        }
+
+        std::size_t const n[] = { 64, 255, 256, 1024, 4096 };
+
+        char const* const r[] =
+        {
+            "dd286080404d69147b29bb30e51d2da8",
+            "6dff53f383af0df1160164d26e616a89",
+            "7de77d6e2eae27373f14fdd00623c4f7",
+            "51efbaa1dcd8d74758d2f79f177bde92",
+            "9c4d633dabd1af7325f5a8543197f875",
+        };
+
+        for( int i = 0; i < 5; ++i )
+        {
+            ghash h;
+            h.update( v.data(), n[ i ] );
+
+            BOOST_TEST_EQ( to_string( h.result() ), std::string( r[ i ] ) );
+        }
+
+        test_incremental( v.data(), 600 );
+    }
+
+    // the integer seed is a prefix of the message
+
+    {
+        ghash h1( 7 ), h2;
+
+        unsigned char const seed[ 8 ] = { 7 };
+        h2.update( seed, 8 );
+
+        h1.update( "abc", 3 );
+        h2.update( "abc", 3 );
+
+        std::string const r = to_string( h1.result() );
+
+        BOOST_TEST_EQ( r, to_string( h2.result() ) );
+        BOOST_TEST_EQ( r, std::string( "96b7c4ed5eca287cdefa65454fadbf1b" ) );
+    }
+
+    return boost::report_errors();
+}
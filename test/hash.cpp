@@ -0,0 +1,194 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <unordered_map>
+#include <string>
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+# include <string_view>
+#endif
+#include <vector>
+#include <array>
+#include <functional>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using namespace boost::hash2;
+
+template<class H, class T> std::size_t reference( H h, T const& v )
+{
+    hash_append( h, {}, v );
+    return get_integral_result<std::size_t>( h.result() );
+}
+
+template<class H> void test()
+{
+    STATIC_ASSERT( hash<int, H>::is_avalanching::value );
+
+    unsigned char const seed[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+    // not contiguous ranges
+
+    {
+        hash<int, H> h1;
+        hash<int, H> h2( 7 );
+        hash<int, H> h3( seed, sizeof(seed) );
+
+        for( int i = 0; i < 16; ++i )
+        {
+            BOOST_TEST_EQ( h1( i ), reference( H(), i ) );
+            BOOST_TEST_EQ( h2( i ), reference( H( 7 ), i ) );
+            BOOST_TEST_EQ( h3( i ), reference( H( seed, sizeof(seed) ), i ) );
+        }
+
+        BOOST_TEST_NE( h1( 1 ), h2( 1 ) );
+        BOOST_TEST_NE( h1( 1 ), h3( 1 ) );
+    }
+
+    {
+        using T = std::pair<int, std::string>;
+
+        hash<T, H> h;
+        T v( 1, "abc" );
+
+        BOOST_TEST_EQ( h( v ), reference( H(), v ) );
+    }
+
+    // contiguous ranges are hashed without their size
+
+    {
+        hash<std::string, H> h( 7 );
+        std::string v( "abcdef" );
+
+        H h2( 7 );
+        h2.update( v.data(), v.size() );
+
+        BOOST_TEST_EQ( h( v ), get_integral_result<std::size_t>( h2.result() ) );
+    }
+
+    {
+        hash<std::vector<std::uint32_t>, H, little_endian_flavor> h;
+        std::vector<std::uint32_t> v{ 0x01020304, 0x05060708 };
+
+        unsigned char const w[] = { 4, 3, 2, 1, 8, 7, 6, 5 };
+
+        H h2;
+        h2.update( w, sizeof(w) );
+
+        BOOST_TEST_EQ( h( v ), get_integral_result<std::size_t>( h2.result() ) );
+    }
+}
+
+template<class M> void test_map( M m )
+{
+    for( int i = 0; i < 1000; ++i )
+    {
+        m[ std::to_string( i ) ] = i;
+    }
+
+    BOOST_TEST_EQ( m.size(), 1000u );
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        auto it = m.find( std::to_string( i ) );
+        BOOST_TEST( it != m.end() ) && BOOST_TEST_EQ( it->second, i );
+    }
+}
+
+template<class H> void test_transparent()
+{
+    STATIC_ASSERT( std::is_same<typename hash<std::string, H>::is_transparent, void>::value );
+    STATIC_ASSERT( std::is_same<typename hash<std::vector<int>, H>::is_transparent, void>::value );
+
+    {
+        hash<std::string, H> h( 7 );
+
+        std::string s1( "abcdef" );
+        std::vector<char> s2( s1.begin(), s1.end() );
+        char const* s3 = "abcdef";
+
+        std::size_t r = h( s1 );
+
+        BOOST_TEST_EQ( h( s2 ), r );
+        BOOST_TEST_EQ( h( s3 ), r );
+        BOOST_TEST_EQ( h( "abcdef" ), r );
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+
+        BOOST_TEST_EQ( h( std::string_view( s1 ) ), r );
+
+#endif
+    }
+
+    {
+        hash<std::wstring, H> h;
+
+        BOOST_TEST_EQ( h( L"abc" ), h( std::wstring( L"abc" ) ) );
+    }
+
+    {
+        hash<std::vector<std::uint16_t>, H> h;
+
+        std::vector<std::uint16_t> v1{ 1, 2, 3 };
+        std::array<std::uint16_t, 3> v2{{ 1, 2, 3 }};
+
+        BOOST_TEST_EQ( h( v2 ), h( v1 ) );
+    }
+}
+
+template<class T> struct has_is_transparent
+{
+    template<class U> static std::true_type f( typename U::is_transparent* );
+    template<class U> static std::false_type f( ... );
+
+    using type = decltype( f<T>( 0 ) );
+};
+
+int main()
+{
+    STATIC_ASSERT( !has_is_transparent< hash<int, fnv1a_64> >::type::value );
+    STATIC_ASSERT( !has_is_transparent< hash<std::pair<int, int>, fnv1a_64> >::type::value );
+    STATIC_ASSERT( has_is_transparent< hash<std::string, fnv1a_64> >::type::value );
+
+    test_transparent<fnv1a_64>();
+    test_transparent<siphash_64>();
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<siphash_64>();
+    test<xxhash_64>();
+    test<sha2_256>();
+
+    using H1 = hash<std::string, siphash_64>;
+
+    test_map( std::unordered_map<std::string, int, H1>( 0, H1( 7 ) ) );
+    test_map( boost::unordered_map<std::string, int, H1>( 0, H1( 7 ) ) );
+
+#if defined(__cpp_lib_generic_unordered_lookup) && __cpp_lib_generic_unordered_lookup >= 201811L
+
+    {
+        std::unordered_map<std::string, int, H1, std::equal_to<>> m( 0, H1( 7 ) );
+
+        m[ "abc" ] = 1;
+
+        BOOST_TEST_EQ( m.count( std::string_view( "abc" ) ), 1u );
+        BOOST_TEST_EQ( m.count( "abc" ), 1u );
+        BOOST_TEST_EQ( m.count( "abd" ), 0u );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
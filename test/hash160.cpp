@@ -0,0 +1,72 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash160.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // the compressed public key of the private key 1, and its address hash
+
+    {
+        unsigned char const pk[] =
+        {
+            0x02, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07,
+            0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98,
+        };
+
+        BOOST_TEST_EQ( to_string( hash160( pk, sizeof( pk ) ) ), std::string( "751e76e8199196d454941c45d1b3a323f1433bd6" ) );
+    }
+
+    // hash160_batch against hash160
+
+    std::vector< std::vector<unsigned char> > keys;
+
+    for( std::size_t i = 0; i < 200; ++i )
+    {
+        // runs of 33 byte keys, broken by keys of other sizes
+
+        std::size_t n = ( i % 41 == 40 || i % 53 == 7 )? i % 70: 33;
+
+        std::vector<unsigned char> v( n );
+
+        for( std::size_t k = 0; k < n; ++k )
+        {
+            v[ k ] = static_cast<unsigned char>( i * 31 + k * 7 + 1 );
+        }
+
+        keys.push_back( v );
+    }
+
+    for( std::size_t m = 0; m <= keys.size(); m += 13 )
+    {
+        std::vector< digest<20> > r( m );
+
+        BOOST_TEST( hash160_batch( keys.begin(), keys.begin() + m, r.begin() ) == r.end() );
+
+        for( std::size_t i = 0; i < m; ++i )
+        {
+            BOOST_TEST_EQ( r[ i ], hash160( keys[ i ].data(), keys[ i ].size() ) );
+        }
+    }
+
+    {
+        std::vector<std::string> v = { "", "a", "abc", "message digest" };
+        std::vector< digest<20> > r( v.size() );
+
+        hash160_batch( v.begin(), v.end(), r.begin() );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            BOOST_TEST_EQ( r[ i ], hash160( v[ i ].data(), v[ i ].size() ) );
+        }
+    }
+
+    return boost::report_errors();
+}
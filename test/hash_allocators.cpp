@@ -0,0 +1,236 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+#include <boost/container/string.hpp>
+#include <boost/intrusive/list.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <unordered_map>
+#include <string>
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+# include <string_view>
+#endif
+#if !defined(BOOST_NO_CXX17_HDR_MEMORY_RESOURCE)
+# include <memory_resource>
+#endif
+#include <vector>
+#include <list>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using namespace boost::hash2;
+
+// a bump allocator over a fixed buffer, as a request arena would be
+
+struct arena
+{
+    alignas( 16 ) unsigned char buffer[ 64 * 1024 ];
+    std::size_t used = 0;
+};
+
+template<class T> struct arena_allocator
+{
+    using value_type = T;
+
+    arena* a;
+
+    explicit arena_allocator( arena& a ): a( &a )
+    {
+    }
+
+    template<class U> arena_allocator( arena_allocator<U> const& other ): a( other.a )
+    {
+    }
+
+    T* allocate( std::size_t n )
+    {
+        std::size_t k = ( a->used + alignof( T ) - 1 ) / alignof( T ) * alignof( T );
+
+        if( k + n * sizeof( T ) > sizeof( a->buffer ) ) throw std::bad_alloc();
+
+        a->used = k + n * sizeof( T );
+        return reinterpret_cast<T*>( a->buffer + k );
+    }
+
+    void deallocate( T*, std::size_t )
+    {
+    }
+
+    template<class U> bool operator==( arena_allocator<U> const& other ) const
+    {
+        return a == other.a;
+    }
+
+    template<class U> bool operator!=( arena_allocator<U> const& other ) const
+    {
+        return a != other.a;
+    }
+};
+
+using arena_string = std::basic_string< char, std::char_traits<char>, arena_allocator<char> >;
+
+// a handle to a string in an arena, which is not a range
+
+struct arena_string_ref
+{
+    char const* p;
+    std::uint32_t n;
+
+    char const* data() const { return p; }
+    std::uint32_t size() const { return n; }
+};
+
+// an element of an intrusive list, hashed as its value
+
+struct node: boost::intrusive::list_base_hook<>
+{
+    int v;
+
+    explicit node( int v ): v( v )
+    {
+    }
+
+    template<class Hash, class Flavor> friend void tag_invoke( hash_append_tag const&, Hash& h, Flavor const& f, node const& x )
+    {
+        hash_append( h, f, x.v );
+    }
+};
+
+template<class T> std::uint64_t append( T const& v )
+{
+    xxhash_64 h;
+    hash_append( h, {}, v );
+    return h.result();
+}
+
+int main()
+{
+    arena a;
+
+    std::string const s( "Content-Type: text/plain; charset=utf-8" );
+
+    arena_string const s1( s.begin(), s.end(), arena_allocator<char>( a ) );
+    boost::container::small_vector<char, 64> const s2( s.begin(), s.end() );
+    boost::container::static_vector<char, 64> const s3( s.begin(), s.end() );
+    boost::container::string const s4( s.begin(), s.end() );
+    arena_string_ref const s5 = { s1.data(), static_cast<std::uint32_t>( s1.size() ) };
+
+    // hash_append produces the same bytes whatever the container or allocator
+
+    {
+        std::uint64_t const r = append( s );
+
+        BOOST_TEST_EQ( append( s1 ), r );
+        BOOST_TEST_EQ( append( s2 ), r );
+        BOOST_TEST_EQ( append( s3 ), r );
+        BOOST_TEST_EQ( append( s4 ), r );
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+
+        BOOST_TEST_EQ( append( std::string_view( s ) ), r );
+
+#endif
+
+#if defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603L
+
+        std::pmr::monotonic_buffer_resource mr( a.buffer + a.used, sizeof( a.buffer ) - a.used );
+        std::pmr::string const s6( s.begin(), s.end(), &mr );
+
+        BOOST_TEST_EQ( append( s6 ), r );
+
+#endif
+    }
+
+    {
+        std::vector<int> const v{ 1, 2, 3, 4, 5 };
+        std::vector< int, arena_allocator<int> > const v1( v.begin(), v.end(), arena_allocator<int>( a ) );
+        boost::container::small_vector<int, 8> const v2( v.begin(), v.end() );
+
+        BOOST_TEST_EQ( append( v1 ), append( v ) );
+        BOOST_TEST_EQ( append( v2 ), append( v ) );
+
+        std::list<int> const l( v.begin(), v.end() );
+
+        std::vector<node> nodes( v.begin(), v.end() );
+        boost::intrusive::list<node> l1( nodes.begin(), nodes.end() );
+
+        BOOST_TEST_EQ( append( l ), append( v ) );
+        BOOST_TEST_EQ( append( l1 ), append( l ) );
+
+        l1.clear();
+    }
+
+    // hash<std::string> and key_equal<std::string> accept all of them;
+    // as none converts to std::string, no temporary is constructed
+
+    {
+        using Hash = boost::hash2::hash<std::string, siphash_64>;
+        using Eq = key_equal<std::string>;
+
+        STATIC_ASSERT( std::is_same<Eq::is_transparent, void>::value );
+
+        Hash const hf( 7 );
+        Eq const eq;
+
+        STATIC_ASSERT( !std::is_convertible<arena_string, std::string>::value );
+        STATIC_ASSERT( !std::is_convertible<arena_string_ref, std::string>::value );
+
+        std::size_t const r = hf( s );
+
+        BOOST_TEST_EQ( hf( s1 ), r );
+        BOOST_TEST_EQ( hf( s2 ), r );
+        BOOST_TEST_EQ( hf( s3 ), r );
+        BOOST_TEST_EQ( hf( s4 ), r );
+        BOOST_TEST_EQ( hf( s5 ), r );
+        BOOST_TEST_EQ( hf( s.c_str() ), r );
+
+        BOOST_TEST( eq( s, s1 ) );
+        BOOST_TEST( eq( s1, s ) );
+        BOOST_TEST( eq( s, s2 ) );
+        BOOST_TEST( eq( s, s3 ) );
+        BOOST_TEST( eq( s, s4 ) );
+        BOOST_TEST( eq( s5, s ) );
+        BOOST_TEST( eq( s1, s5 ) );
+        BOOST_TEST( eq( s, s.c_str() ) );
+        BOOST_TEST( eq( s.c_str(), s1 ) );
+
+        BOOST_TEST( !eq( s, "Content-Type" ) );
+        BOOST_TEST( !eq( s1, std::string( "Content-Type: text/plain; charset=utf-9" ) ) );
+
+        std::unordered_map<std::string, int, Hash, Eq> m( 0, Hash( 7 ) );
+
+        m[ s ] = 1;
+        m[ "Host" ] = 2;
+
+#if defined(__cpp_lib_generic_unordered_lookup) && __cpp_lib_generic_unordered_lookup >= 201811L
+
+        BOOST_TEST_EQ( m.count( s1 ), 1u );
+        BOOST_TEST_EQ( m.count( s2 ), 1u );
+        BOOST_TEST_EQ( m.count( s5 ), 1u );
+        BOOST_TEST_EQ( m.count( "Host" ), 1u );
+        BOOST_TEST_EQ( m.count( "Accept" ), 0u );
+
+#endif
+    }
+
+    // non-contiguous keys aren't transparent
+
+    {
+        using Eq = key_equal<int>;
+
+        BOOST_TEST( Eq()( 1, 1 ) );
+        BOOST_TEST( !Eq()( 1, 2 ) );
+    }
+
+    return boost::report_errors();
+}
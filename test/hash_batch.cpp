@@ -0,0 +1,129 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <cstddef>
+
+enum class E: std::uint16_t
+{
+};
+
+template<class H, class Flavor, class T> void test( std::vector<T> const& v, std::uint64_t seed )
+{
+    std::vector<typename H::result_type> r1;
+
+    for( T const& x: v )
+    {
+        H h( seed );
+        boost::hash2::hash_append( h, Flavor(), x );
+
+        r1.push_back( h.result() );
+    }
+
+    // every batch length, including partial groups
+
+    for( std::size_t n = 0; n <= v.size(); ++n )
+    {
+        std::vector<typename H::result_type> r2;
+        boost::hash2::hash_batch<H, Flavor>( v.begin(), v.begin() + n, std::back_inserter( r2 ), seed );
+
+        BOOST_TEST_EQ( r2.size(), n );
+        BOOST_TEST( std::equal( r2.begin(), r2.end(), r1.begin() ) );
+    }
+
+    // input iterators and output pointers
+
+    {
+        std::list<T> const w( v.begin(), v.end() );
+        std::vector<typename H::result_type> r2( v.size() );
+
+        typename H::result_type* p = boost::hash2::hash_batch<H, Flavor>( w.begin(), w.end(), r2.data(), seed );
+
+        BOOST_TEST_EQ( p - r2.data(), static_cast<std::ptrdiff_t>( v.size() ) );
+        BOOST_TEST( r2 == r1 );
+    }
+}
+
+template<class H, class T> void test( std::vector<T> const& v )
+{
+    for( std::uint64_t seed: { 0, 7 } )
+    {
+        test<H, boost::hash2::default_flavor>( v, seed );
+        test<H, boost::hash2::little_endian_flavor>( v, seed );
+        test<H, boost::hash2::big_endian_flavor>( v, seed );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    std::vector<std::uint64_t> v1;
+    std::vector<std::uint32_t> v2;
+    std::vector<E> v3;
+    std::vector<std::string> v4;
+    std::vector<std::string> v5;
+    std::vector< std::vector<unsigned char> > v6;
+
+    for( std::uint64_t i = 0; i < 37; ++i )
+    {
+        v1.push_back( i * 0x9E3779B97F4A7C15ull );
+        v2.push_back( static_cast<std::uint32_t>( i * 7919 ) );
+        v3.push_back( static_cast<E>( i * 31 ) );
+        v4.push_back( std::string( i, static_cast<char>( 'a' + i % 26 ) ) );
+
+        // runs of keys of the same size, broken by keys of other sizes
+
+        std::size_t n = i % 13 == 12? i: 70;
+
+        v5.push_back( std::string( n, static_cast<char>( 'a' + i % 26 ) ) );
+        v6.push_back( std::vector<unsigned char>( n + 100, static_cast<unsigned char>( i ) ) );
+    }
+
+    // H::hash_batch
+
+    test<siphash_64>( v1 );
+    test<siphash_64>( v2 );
+    test<siphash_64>( v3 );
+
+    test<tabulation_64>( v1 );
+    test<tabulation_64>( v2 );
+    test<tabulation_64>( v3 );
+    test<tabulation_64>( v4 );
+
+    // multi-lane
+
+    test<sha2_256>( v1 );
+    test<sha2_256>( v2 );
+    test<sha2_512>( v3 );
+
+    test<sha2_256>( v5 );
+    test<sha2_512>( v5 );
+    test<md5_128>( v5 );
+    test<ripemd_160>( v6 );
+    test<md5_128>( v6 );
+
+    // generic
+
+    test<siphash_64>( v4 );
+    test<sha2_256>( v4 );
+    test<xxhash_64>( v1 );
+    test<xxhash_64>( v4 );
+    test<fnv1a_32>( v2 );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,184 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_column.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+enum class E: std::uint16_t
+{
+};
+
+// every third value is null, and every value of the last byte of the
+// bitmap is valid
+
+static std::vector<unsigned char> make_validity( std::size_t n )
+{
+    std::vector<unsigned char> v( ( n + 7 ) / 8 );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        if( i % 3 != 0 || i + 8 >= n )
+        {
+            v[ i / 8 ] |= static_cast<unsigned char>( 1u << ( i % 8 ) );
+        }
+    }
+
+    return v;
+}
+
+template<class H, class T> static std::uint64_t row_hash( T const& v, std::uint64_t seed )
+{
+    H h( seed );
+    hash_append( h, {}, v );
+
+    return get_integral_result<std::uint64_t>( h.result() );
+}
+
+// a null is the empty message
+
+template<class H> static std::uint64_t null_hash( std::uint64_t seed )
+{
+    H h( seed );
+    return get_integral_result<std::uint64_t>( h.result() );
+}
+
+template<class H, class T> static void test_primitive( std::vector<T> const& v, std::uint64_t seed )
+{
+    std::size_t const n = v.size();
+    std::vector<unsigned char> const validity = make_validity( n );
+
+    std::vector<std::uint64_t> r1( n ), r2( n );
+
+    hash_column<H>( v.data(), nullptr, n, r1.data(), seed );
+    hash_column<H>( v.data(), validity.data(), n, r2.data(), seed );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( r1[ i ], row_hash<H>( v[ i ], seed ) );
+
+        bool const valid = ( validity[ i / 8 ] >> ( i % 8 ) & 1 ) != 0;
+        BOOST_TEST_EQ( r2[ i ], valid? r1[ i ]: null_hash<H>( seed ) );
+    }
+}
+
+template<class H, class O> static void test_string( std::vector<std::string> const& v, std::uint64_t seed )
+{
+    std::size_t const n = v.size();
+    std::vector<unsigned char> const validity = make_validity( n );
+
+    std::vector<O> offsets( 1, 0 );
+    std::string data;
+
+    for( std::string const& s: v )
+    {
+        data += s;
+        offsets.push_back( static_cast<O>( data.size() ) );
+    }
+
+    std::vector<std::uint64_t> r1( n ), r2( n );
+
+    hash_column<H>( offsets.data(), data.data(), nullptr, n, r1.data(), seed );
+    hash_column<H>( offsets.data(), data.data(), validity.data(), n, r2.data(), seed );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( r1[ i ], row_hash<H>( v[ i ], seed ) );
+
+        bool const valid = ( validity[ i / 8 ] >> ( i % 8 ) & 1 ) != 0;
+        BOOST_TEST_EQ( r2[ i ], valid? r1[ i ]: null_hash<H>( seed ) );
+    }
+}
+
+template<class H> static void test( std::uint64_t seed )
+{
+    std::vector<std::uint32_t> v1;
+    std::vector<std::int64_t> v2;
+    std::vector<double> v3;
+    std::vector<E> v4;
+    std::vector<std::string> v5;
+
+    for( std::size_t i = 0; i < 77; ++i )
+    {
+        v1.push_back( static_cast<std::uint32_t>( i * 0x9E3779B9u ) );
+        v2.push_back( -static_cast<std::int64_t>( i * i ) );
+        v3.push_back( i == 1? -0.0: i * 0.25 );
+        v4.push_back( static_cast<E>( i ) );
+
+        // runs of strings of the same size, and of different sizes
+
+        v5.push_back( i < 20? std::string( 5, static_cast<char>( 'a' + i ) ): std::string( i % 37, static_cast<char>( 'A' + i % 26 ) ) );
+    }
+
+    // in a column of bytes, a null and a 0 differ
+
+    {
+        std::uint8_t const v[ 2 ] = { 0, 0 };
+        unsigned char const validity[ 1 ] = { 0x01 };
+
+        std::uint64_t r[ 2 ];
+        hash_column<H>( v, validity, 2, r, seed );
+
+        BOOST_TEST_NE( r[ 0 ], r[ 1 ] );
+        BOOST_TEST_EQ( r[ 0 ], row_hash<H>( std::uint8_t( 0 ), seed ) );
+        BOOST_TEST_EQ( r[ 1 ], null_hash<H>( seed ) );
+
+        bool const w[ 2 ] = { false, false };
+
+        hash_column<H>( w, validity, 2, r, seed );
+
+        BOOST_TEST_NE( r[ 0 ], r[ 1 ] );
+
+        // also under a flavor without a size, as the values have a fixed size
+
+        hash_column<H, unsized_flavor>( v, validity, 2, r, seed );
+
+        BOOST_TEST_NE( r[ 0 ], r[ 1 ] );
+        BOOST_TEST_EQ( r[ 1 ], null_hash<H>( seed ) );
+    }
+
+    for( std::size_t n: { 0, 1, 7, 8, 9, 77 } )
+    {
+        test_primitive<H>( std::vector<std::uint32_t>( v1.begin(), v1.begin() + n ), seed );
+        test_primitive<H>( std::vector<std::int64_t>( v2.begin(), v2.begin() + n ), seed );
+        test_primitive<H>( std::vector<double>( v3.begin(), v3.begin() + n ), seed );
+        test_primitive<H>( std::vector<E>( v4.begin(), v4.begin() + n ), seed );
+
+        test_string<H, std::int32_t>( std::vector<std::string>( v5.begin(), v5.begin() + n ), seed );
+        test_string<H, std::int64_t>( std::vector<std::string>( v5.begin(), v5.begin() + n ), seed );
+    }
+}
+
+int main()
+{
+    test<fnv1a_64>( 0 );
+    test<fnv1a_32>( 7 );
+    test<xxh3_64>( 7 );
+    test<siphash_64>( 0 );
+    test<siphash_64>( 7 );
+    test<tabulation_64>( 7 );
+    test<sha2_256>( 7 );
+
+    // under a flavor without a size, an empty string would be the empty
+    // message, so only values of a fixed size are accepted
+
+    BOOST_TEST( ( detail::column_distinguishes_nulls<default_flavor, std::string>::value ) );
+    BOOST_TEST( ( detail::column_distinguishes_nulls<unsized_flavor, std::uint8_t>::value ) );
+    BOOST_TEST( ( detail::column_distinguishes_nulls<unsized_flavor, E>::value ) );
+    BOOST_TEST( ( detail::column_distinguishes_nulls<unsized_flavor, double>::value ) );
+    BOOST_TEST( ( !detail::column_distinguishes_nulls<unsized_flavor, std::string>::value ) );
+    BOOST_TEST( ( !detail::column_distinguishes_nulls<unsized_flavor, std::vector<int>>::value ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,247 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_directory.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_HASH2_HAS_POSIX_FILES is not defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+using namespace boost::hash2;
+
+static std::string const root = "hash_directory_test.tmp";
+
+static std::vector<unsigned char> make_data( std::size_t n, std::uint32_t seed )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint32_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return v;
+}
+
+static void write_file( std::string const& fn, std::vector<unsigned char> const& v )
+{
+    std::FILE* f = std::fopen( ( root + '/' + fn ).c_str(), "wb" );
+    BOOST_TEST( f != 0 );
+
+    if( f == 0 ) return;
+
+    BOOST_TEST_EQ( std::fwrite( v.data(), 1, v.size(), f ), v.size() );
+    std::fclose( f );
+}
+
+static void make_dir( std::string const& fn )
+{
+    BOOST_TEST_EQ( ::mkdir( ( root + '/' + fn ).c_str(), 0755 ), 0 );
+}
+
+static std::uint32_t mode_of( std::string const& fn )
+{
+    struct ::stat st;
+    BOOST_TEST_EQ( ::lstat( ( root + '/' + fn ).c_str(), &st ), 0 );
+
+    return static_cast<std::uint32_t>( st.st_mode );
+}
+
+template<class H> static void append_dir( H& h, std::string const& fn )
+{
+    hash_append( h, {}, fn );
+    hash_append( h, {}, mode_of( fn ) );
+}
+
+template<class H> static void append_file( H& h, std::string const& fn, std::vector<unsigned char> const& v )
+{
+    hash_append( h, {}, fn );
+    hash_append( h, {}, mode_of( fn ) );
+
+    H h2;
+    h2.update( v.data(), v.size() );
+
+    hash_append( h, {}, h2.result() );
+}
+
+template<class H> static void test()
+{
+    std::vector<unsigned char> const a = make_data( 100, 1 );
+    std::vector<unsigned char> const b = make_data( 70000, 2 );
+    std::vector<unsigned char> const c = make_data( 3 * 1024 * 1024 + 5, 3 );
+    std::vector<unsigned char> const e;
+
+    ::mkdir( root.c_str(), 0755 );
+
+    make_dir( "d" );
+    make_dir( "d/e" );
+    make_dir( "empty" );
+
+    write_file( "a", a );
+    write_file( "d/b", b );
+    write_file( "d/e/c", c );
+    write_file( "z", e );
+
+    BOOST_TEST_EQ( ::symlink( "d/b", ( root + "/link" ).c_str() ), 0 );
+
+    // many small files, to exercise the batching
+
+    make_dir( "m" );
+
+    for( int i = 0; i < 200; ++i )
+    {
+        write_file( "m/" + std::to_string( 1000 + i ), make_data( i * 13, i ) );
+    }
+
+    // the expected digest
+
+    H h;
+
+    append_file( h, "a", a );
+    append_dir( h, "d" );
+    append_file( h, "d/b", b );
+    append_dir( h, "d/e" );
+    append_file( h, "d/e/c", c );
+    append_dir( h, "empty" );
+
+    hash_append( h, {}, std::string( "link" ) );
+    hash_append( h, {}, mode_of( "link" ) );
+    hash_append( h, {}, std::string( "d/b" ) );
+
+    append_dir( h, "m" );
+
+    for( int i = 0; i < 200; ++i )
+    {
+        append_file( h, "m/" + std::to_string( 1000 + i ), make_data( i * 13, i ) );
+    }
+
+    append_file( h, "z", e );
+
+    typename H::result_type const r0 = h.result();
+
+    unsigned const threads[] = { 0, 1, 2, 7 };
+
+    for( unsigned t: threads )
+    {
+        std::error_code ec;
+        typename H::result_type r = hash_directory<H>( root.c_str(), ec, t );
+
+        BOOST_TEST( !ec );
+        BOOST_TEST( r == r0 );
+    }
+
+    // with a digest cache; the files are too recent to be stored in it,
+    // so both passes hash them
+
+    {
+        std::remove( "hash_directory_test.cache" );
+
+        digest_cache cache;
+
+        std::error_code ec;
+        cache.open( "hash_directory_test.cache", ec );
+
+        BOOST_TEST( !ec );
+
+        thread_executor ex( 2 );
+
+        for( int i = 0; i < 2; ++i )
+        {
+            typename H::result_type r = hash_directory<H>( root.c_str(), ec, ex, cache );
+
+            BOOST_TEST( !ec );
+            BOOST_TEST( r == r0 );
+        }
+
+        BOOST_TEST_EQ( cache.hits(), 0u );
+        BOOST_TEST_EQ( cache.misses(), 2 * 204u );
+
+        std::remove( "hash_directory_test.cache" );
+    }
+
+    // a change in a file, or in a mode, changes the digest
+
+    {
+        std::vector<unsigned char> b2( b );
+        b2[ 50000 ] ^= 1;
+
+        write_file( "d/b", b2 );
+
+        std::error_code ec;
+        typename H::result_type r = hash_directory<H>( root.c_str(), ec );
+
+        BOOST_TEST( !ec );
+        BOOST_TEST( r != r0 );
+
+        write_file( "d/b", b );
+
+        r = hash_directory<H>( root.c_str(), ec );
+
+        BOOST_TEST( !ec );
+        BOOST_TEST( r == r0 );
+
+        BOOST_TEST_EQ( ::chmod( ( root + "/a" ).c_str(), 0600 ), 0 );
+
+        r = hash_directory<H>( root.c_str(), ec );
+
+        BOOST_TEST( !ec );
+        BOOST_TEST( r != r0 );
+    }
+
+    // clean up
+
+    for( int i = 0; i < 200; ++i )
+    {
+        ::unlink( ( root + "/m/" + std::to_string( 1000 + i ) ).c_str() );
+    }
+
+    ::unlink( ( root + "/link" ).c_str() );
+    ::unlink( ( root + "/z" ).c_str() );
+    ::unlink( ( root + "/d/e/c" ).c_str() );
+    ::unlink( ( root + "/d/b" ).c_str() );
+    ::unlink( ( root + "/a" ).c_str() );
+
+    ::rmdir( ( root + "/m" ).c_str() );
+    ::rmdir( ( root + "/empty" ).c_str() );
+    ::rmdir( ( root + "/d/e" ).c_str() );
+    ::rmdir( ( root + "/d" ).c_str() );
+    ::rmdir( root.c_str() );
+}
+
+int main()
+{
+    test<sha2_256>();
+    test<xxh3_128>();
+
+    {
+        std::error_code ec;
+        sha2_256::result_type r = hash_directory<sha2_256>( "hash_directory_does_not_exist.tmp", ec );
+
+        BOOST_TEST( ec == std::errc::no_such_file_or_directory );
+        BOOST_TEST( r == sha2_256::result_type() );
+    }
+
+    return boost::report_errors();
+}
+
+#endif
@@ -0,0 +1,160 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_engine.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/detail/read.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <algorithm>
+#include <random>
+#include <type_traits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+// the values of consecutive result() calls, split into 64 bit words
+// when the result is array-like, with the words of a result that
+// cross a block of eight values dropped
+
+template<class H> std::vector<std::uint64_t> reference( H h, std::size_t n, std::true_type )
+{
+    std::vector<std::uint64_t> v;
+
+    while( v.size() < n )
+    {
+        v.push_back( h.result() );
+    }
+
+    return v;
+}
+
+template<class H> std::vector<std::uint64_t> reference( H h, std::size_t n, std::false_type )
+{
+    std::vector<std::uint64_t> v;
+
+    while( v.size() < n )
+    {
+        auto r = h.result();
+
+        for( std::size_t j = 0; j + 8 <= r.size(); j += 8 )
+        {
+            v.push_back( boost::hash2::detail::read64le( r.data() + j ) );
+
+            if( v.size() % 8 == 0 ) break;
+        }
+    }
+
+    return v;
+}
+
+template<class H> void test()
+{
+    using boost::hash2::hash_engine;
+    using R = typename H::result_type;
+
+    std::size_t const N = 67;
+
+    {
+        std::vector<std::uint64_t> const v = reference( H( 7 ), N, std::is_integral<R>() );
+
+        hash_engine<H> e( 7 );
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            BOOST_TEST_EQ( e(), v[ i ] );
+        }
+    }
+
+    {
+        unsigned char const seed[ 3 ] = { 1, 2, 3 };
+
+        H h( seed, 3 );
+        h.update( "abc", 3 );
+
+        std::vector<std::uint64_t> const v = reference( h, N, std::is_integral<R>() );
+
+        hash_engine<H> e( h );
+
+        for( std::size_t i = 0; i < N; ++i )
+        {
+            BOOST_TEST_EQ( e(), v[ i ] );
+        }
+    }
+
+    for( std::size_t k = 0; k < 20; ++k )
+    {
+        hash_engine<H> e1, e2;
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            e1();
+        }
+
+        e2.discard( k );
+
+        BOOST_TEST_EQ( e1(), e2() );
+    }
+
+    for( std::size_t k = 0; k < 20; ++k )
+    {
+        hash_engine<H> e1, e2;
+
+        e1();
+        e2();
+
+        typename hash_engine<H>::result_type w[ 20 ];
+        e2.generate( w, k );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            BOOST_TEST_EQ( e1(), w[ i ] );
+        }
+
+        BOOST_TEST_EQ( e1(), e2() );
+    }
+
+    {
+        hash_engine<H> e;
+
+        std::uniform_int_distribution<int> dist( 1, 6 );
+
+        for( int i = 0; i < 100; ++i )
+        {
+            int x = dist( e );
+
+            BOOST_TEST_GE( x, 1 );
+            BOOST_TEST_LE( x, 6 );
+        }
+
+        std::vector<int> v{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        std::shuffle( v.begin(), v.end(), e );
+
+        std::sort( v.begin(), v.end() );
+        BOOST_TEST_EQ( v.front(), 1 );
+        BOOST_TEST_EQ( v.back(), 9 );
+    }
+}
+
+int main()
+{
+    BOOST_TEST_TRAIT_SAME( boost::hash2::hash_engine<boost::hash2::fnv1a_32>::result_type, std::uint32_t );
+    BOOST_TEST_TRAIT_SAME( boost::hash2::hash_engine<boost::hash2::xxhash_64>::result_type, std::uint64_t );
+    BOOST_TEST_TRAIT_SAME( boost::hash2::hash_engine<boost::hash2::sha2_256>::result_type, std::uint64_t );
+
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::sha1_160>();
+    test<boost::hash2::sha2_224>();
+    test<boost::hash2::sha2_256>();
+    test<boost::hash2::sha2_512>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,182 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/hash_file.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+using namespace boost::hash2;
+
+static char const* const fn = "hash_file_test.tmp";
+
+static std::vector<unsigned char> make_data( std::size_t n, std::uint32_t seed )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint32_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return v;
+}
+
+static bool write_file( std::vector<unsigned char> const& v )
+{
+    std::FILE* f = std::fopen( fn, "wb" );
+    if( f == 0 ) return false;
+
+    bool r = std::fwrite( v.data(), 1, v.size(), f ) == v.size();
+
+    return std::fclose( f ) == 0 && r;
+}
+
+template<class H> static void test( std::size_t n )
+{
+    std::vector<unsigned char> v = make_data( n, static_cast<std::uint32_t>( n ) );
+
+    if( !BOOST_TEST( write_file( v ) ) ) return;
+
+    H h0;
+    h0.update( v.data(), v.size() );
+
+    typename H::result_type const r0 = h0.result();
+
+    file_backend const backends[] = { file_backend::automatic, file_backend::read, file_backend::mmap, file_backend::direct, file_backend::uring, file_backend::af_alg };
+
+    for( file_backend b: backends )
+    {
+        std::error_code ec;
+        typename H::result_type r = hash_file<H>( fn, ec, b );
+
+        BOOST_TEST( !ec );
+        BOOST_TEST( r == r0 );
+    }
+
+    {
+        H h( 7 );
+        h.update( "prefix", 6 );
+
+        std::error_code ec;
+        hash_file( h, fn, ec );
+
+        BOOST_TEST( !ec );
+
+        H h2( 7 );
+        h2.update( "prefix", 6 );
+        h2.update( v.data(), v.size() );
+
+        BOOST_TEST( h.result() == h2.result() );
+    }
+
+    std::remove( fn );
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+// a file of 16 MiB with two data regions, and holes before, between and
+// after them; on file systems without holes, it's a regular file
+
+template<class H> static void test_sparse()
+{
+    std::size_t const size = 16 * 1024 * 1024;
+
+    std::size_t const offsets[] = { 1024 * 1024 + 100, 9 * 1024 * 1024 };
+    std::size_t const n = 70000;
+
+    std::vector<unsigned char> v( size );
+
+    {
+        int fd = ::open( fn, O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+        if( !BOOST_TEST( fd >= 0 ) ) return;
+
+        for( std::size_t off: offsets )
+        {
+            std::vector<unsigned char> w = make_data( n, static_cast<std::uint32_t>( off ) );
+
+            BOOST_TEST_EQ( ::pwrite( fd, w.data(), n, static_cast< ::off_t >( off ) ), static_cast< ::ssize_t >( n ) );
+            std::copy( w.begin(), w.end(), v.begin() + off );
+        }
+
+        BOOST_TEST_EQ( ::ftruncate( fd, static_cast< ::off_t >( size ) ), 0 );
+        ::close( fd );
+    }
+
+    H h0;
+    h0.update( v.data(), v.size() );
+
+    typename H::result_type const r0 = h0.result();
+
+    std::error_code ec;
+    typename H::result_type r = hash_file<H>( fn, ec );
+
+    BOOST_TEST( !ec );
+    BOOST_TEST( r == r0 );
+
+    std::remove( fn );
+}
+
+#endif
+
+int main()
+{
+    std::size_t const sizes[] = { 0, 1, 100, 4095, 4096, 4097, 65535, 65536, 1024 * 1024, 1024 * 1024 + 1, 5 * 1024 * 1024 + 123 };
+
+    for( std::size_t n: sizes )
+    {
+        test<md5_128>( n );
+        test<sha1_160>( n );
+        test<sha2_256>( n );
+        test<sha2_512>( n );
+        test<xxh3_128>( n );
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+
+    test_sparse<crc32c>();
+    test_sparse<crc64_xz>();
+    test_sparse<sha2_256>();
+    test_sparse<xxh3_128>();
+
+#endif
+
+    {
+        std::error_code ec;
+        sha2_256::result_type r = hash_file<sha2_256>( "hash_file_does_not_exist.tmp", ec );
+
+        BOOST_TEST( ec == std::errc::no_such_file_or_directory );
+        BOOST_TEST( r == sha2_256::result_type() );
+    }
+
+    {
+        std::error_code ec;
+        sha2_256::result_type r = hash_file<sha2_256>( "hash_file_does_not_exist.tmp", ec, file_backend::af_alg );
+
+        BOOST_TEST( ec == std::errc::no_such_file_or_directory );
+        BOOST_TEST( r == sha2_256::result_type() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,89 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_fixed.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+static unsigned char buffer[ 256 ];
+
+// hash_fixed<N>( h, p ) is the same as a copy of h after update( p, N )
+
+template<std::size_t N, class H> void test( H const& h0 )
+{
+    for( std::size_t i = 0; i < 8; i += 3 )
+    {
+        unsigned char const* p = buffer + i;
+
+        H h( h0 );
+        h.update( p, N );
+
+        typename H::result_type r = h.result();
+
+        BOOST_TEST_EQ( boost::hash2::hash_fixed<N>( h0, p ), r );
+        BOOST_TEST_EQ( boost::hash2::hash_fixed<N>( h0, static_cast<void const*>( p ) ), r );
+    }
+}
+
+template<class H, std::size_t... N> void test_lengths( H const& h0 )
+{
+    int a[] = { ( test<N>( h0 ), 0 )... };
+    (void)a;
+}
+
+template<class H> void test()
+{
+    std::size_t const offsets[] = { 0, 1, 5, 8, 31, 32, 33, 64 };
+
+    for( std::size_t i = 0; i < sizeof( offsets ) / sizeof( offsets[0] ); ++i )
+    {
+        // the state of H after a prefix of offsets[ i ] bytes
+
+        H h( 7 );
+        h.update( buffer + 128, offsets[ i ] );
+
+        test_lengths<H, 0, 1, 3, 4, 7, 8, 9, 12, 15, 16, 17, 20, 24, 31, 32, 33, 40, 63, 64, 65, 100>( h );
+    }
+
+    {
+        H h( buffer + 200, 16 );
+        test_lengths<H, 0, 1, 7, 8, 16, 20, 32, 40>( h );
+    }
+
+    {
+        H h( 5 );
+        h.update( buffer, 16 );
+
+        BOOST_TEST_EQ( (boost::hash2::hash_fixed<H, 16>( buffer, 5 )), h.result() );
+    }
+
+    {
+        H h;
+        h.update( buffer, 20 );
+
+        BOOST_TEST_EQ( (boost::hash2::hash_fixed<H, 20>( static_cast<void const*>( buffer ) )), h.result() );
+    }
+}
+
+int main()
+{
+    for( int i = 0; i < 256; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_64>();
+
+    // no hash_fixed member, update and result are used
+
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::xxhash_32>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,125 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_indices.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/get_integral_result.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+// index(i) = h1 + i * h2 + ( i^3 - i ) / 6 (mod m), computed directly
+
+static std::size_t reference_index( std::uint64_t h1, std::uint64_t h2, std::size_t i, std::size_t m )
+{
+    std::uint64_t r = h1 % m;
+
+    r = ( r + ( h2 % m ) * i ) % m;
+    r = ( r + ( static_cast<std::uint64_t>( i ) * i * i - i ) / 6 % m ) % m;
+
+    return static_cast<std::size_t>( r );
+}
+
+template<class H> void test_words( std::string const& key, std::uint64_t& h1, std::uint64_t& h2, H h = H() )
+{
+    h.update( key.data(), key.size() );
+    detail::get_result_words( h.result(), h1, h2 );
+}
+
+template<class H> void test( std::size_t m )
+{
+    std::size_t const k = 7;
+
+    for( int j = 0; j < 64; ++j )
+    {
+        std::string key = "key" + std::to_string( j );
+
+        std::size_t out[ k ];
+        hash_indices<H>( key, k, m, out );
+
+        std::uint64_t h1, h2;
+        test_words<H>( key, h1, h2 );
+
+        for( std::size_t i = 0; i < k; ++i )
+        {
+            BOOST_TEST_LT( out[ i ], m );
+            BOOST_TEST_EQ( out[ i ], reference_index( h1, h2, i, m ) );
+        }
+    }
+}
+
+template<class H> void test_seeded( std::size_t m )
+{
+    std::size_t const k = 5;
+
+    H h( 7 );
+
+    std::string key( "abc" );
+
+    std::size_t out[ k ];
+    hash_indices<H>( h, key, k, m, out );
+
+    std::uint64_t h1, h2;
+    test_words<H>( key, h1, h2, h );
+
+    for( std::size_t i = 0; i < k; ++i )
+    {
+        BOOST_TEST_EQ( out[ i ], reference_index( h1, h2, i, m ) );
+    }
+}
+
+int main()
+{
+    // the two words
+
+    {
+        std::uint64_t h1, h2;
+
+        detail::get_result_words( std::uint64_t( 0x0123456789ABCDEFull ), h1, h2 );
+
+        BOOST_TEST_EQ( h1, 0x89ABCDEFu );
+        BOOST_TEST_EQ( h2, 0x01234567u );
+
+        digest<16> d{{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 }};
+
+        detail::get_result_words( d, h1, h2 );
+
+        BOOST_TEST_EQ( h1, 0x0807060504030201ull );
+        BOOST_TEST_EQ( h2, 0x100F0E0D0C0B0A09ull );
+    }
+
+    test<xxhash_64>( 1000 );
+    test<siphash_64>( 1 << 20 );
+    test<xxh3_128>( 1000 );
+    test<md5_128>( 999983 );
+    test<sha2_256>( 1000 );
+    test<sha2_256>( 1 );
+
+    test_seeded<siphash_64>( 1000 );
+    test_seeded<xxh3_128>( 1000 );
+
+    // a contiguous range is hashed as its elements
+
+    {
+        std::size_t out1[ 4 ], out2[ 4 ];
+
+        hash_indices<xxh3_128>( std::string( "abc" ), 4, 1000, out1 );
+        hash_indices<xxh3_128>( std::vector<char>{ 'a', 'b', 'c' }, 4, 1000, out2 );
+
+        for( std::size_t i = 0; i < 4; ++i )
+        {
+            BOOST_TEST_EQ( out1[ i ], out2[ i ] );
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,119 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hash_partition.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <list>
+#include <cstdint>
+#include <cstddef>
+
+// the partitions computed one key at a time
+
+template<class H, class T> void reference( std::vector<T> const& v, std::size_t nparts, std::uint64_t seed, std::vector<std::size_t>& offsets, std::vector<std::size_t>& perm )
+{
+    std::vector< std::vector<std::size_t> > parts( nparts );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        H h( seed );
+        boost::hash2::hash_append( h, {}, v[ i ] );
+
+        parts[ boost::hash2::reduce( h.result(), nparts ) ].push_back( i );
+    }
+
+    offsets.assign( 1, 0 );
+    perm.clear();
+
+    for( std::size_t p = 0; p < nparts; ++p )
+    {
+        perm.insert( perm.end(), parts[ p ].begin(), parts[ p ].end() );
+        offsets.push_back( perm.size() );
+    }
+}
+
+template<class H, class T> void test( std::vector<T> const& v, std::size_t nparts, std::uint64_t seed = 0 )
+{
+    std::vector<std::size_t> offsets, perm;
+    reference<H>( v, nparts, seed, offsets, perm );
+
+    for( unsigned threads = 1; threads <= 5; threads += 2 )
+    {
+        std::vector<std::size_t> offsets2( nparts + 1 ), perm2( v.size() );
+        boost::hash2::hash_partition<H>( v.begin(), v.end(), nparts, offsets2.data(), perm2.data(), threads, seed );
+
+        BOOST_TEST( offsets == offsets2 );
+        BOOST_TEST( perm == perm2 );
+    }
+
+    {
+        boost::hash2::work_stealing_executor ex( 3 );
+
+        std::vector<std::size_t> offsets2( nparts + 1 ), perm2( v.size() );
+        boost::hash2::hash_partition<H>( v.begin(), v.end(), nparts, offsets2.data(), perm2.data(), ex, seed );
+
+        BOOST_TEST( offsets == offsets2 );
+        BOOST_TEST( perm == perm2 );
+    }
+
+    {
+        std::list<T> const w( v.begin(), v.end() );
+
+        std::vector<std::size_t> offsets2( nparts + 1 ), perm2( v.size() );
+        boost::hash2::hash_partition<H>( w.begin(), w.end(), nparts, offsets2.data(), perm2.data(), 4, seed );
+
+        BOOST_TEST( offsets == offsets2 );
+        BOOST_TEST( perm == perm2 );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    {
+        std::vector<std::uint64_t> v;
+
+        for( std::uint64_t i = 0; i < 100000; ++i )
+        {
+            v.push_back( i * 0x9E3779B97F4A7C15ull );
+        }
+
+        test<xxhash_64>( v, 1 );
+        test<xxhash_64>( v, 7 );
+        test<xxhash_64>( v, 256 );
+        test<xxhash_64>( v, 4096, 5 );
+        test<xxhash_64>( v, 20000 );
+
+        test<siphash_64>( v, 64 );
+        test<sha2_256>( std::vector<std::uint64_t>( v.begin(), v.begin() + 20000 ), 64 );
+    }
+
+    {
+        std::vector<std::string> v;
+
+        for( int i = 0; i < 40000; ++i )
+        {
+            v.push_back( std::to_string( i ) + " key" );
+        }
+
+        test<xxhash_64>( v, 13 );
+        test<siphash_64>( v, 1024, 7 );
+    }
+
+    {
+        std::vector<int> v;
+        test<xxhash_64>( v, 16 );
+
+        v.push_back( 1 );
+        test<xxhash_64>( v, 16 );
+    }
+
+    return boost::report_errors();
+}
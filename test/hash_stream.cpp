@@ -0,0 +1,179 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <boost/hash2/hashing_stream.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <fstream>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <cstdio>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::string make_data( std::size_t n )
+{
+    std::string s( n, ' ' );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        s[ i ] = static_cast<char>( i * 0x9D + 0x3B );
+    }
+
+    return s;
+}
+
+template<class H> static typename H::result_type digest_of( std::string const& s )
+{
+    H h;
+    h.update( s.data(), s.size() );
+
+    return h.result();
+}
+
+// a stream buffer without a get area
+
+class unbuffered: public std::streambuf
+{
+private:
+
+    std::string s_;
+    std::size_t i_ = 0;
+
+protected:
+
+    int_type underflow() override
+    {
+        if( i_ == s_.size() ) return traits_type::eof();
+        return traits_type::to_int_type( s_[ i_ ] );
+    }
+
+    int_type uflow() override
+    {
+        if( i_ == s_.size() ) return traits_type::eof();
+        return traits_type::to_int_type( s_[ i_++ ] );
+    }
+
+public:
+
+    explicit unbuffered( std::string const& s ): s_( s )
+    {
+    }
+};
+
+template<class H> static void test( std::size_t n )
+{
+    std::string const s = make_data( n );
+    typename H::result_type const r0 = digest_of<H>( s );
+
+    {
+        std::istringstream is( s );
+
+        BOOST_TEST( hash_stream<H>( is ) == r0 );
+        BOOST_TEST( is.eof() );
+        BOOST_TEST( !is.bad() );
+    }
+
+    {
+        std::istringstream is( s );
+
+        H h( 7 );
+        hash_stream( h, *is.rdbuf() );
+
+        H h2( 7 );
+        h2.update( s.data(), s.size() );
+
+        BOOST_TEST( h.result() == h2.result() );
+    }
+
+    // a partially consumed stream
+
+    if( n >= 10 )
+    {
+        std::istringstream is( s );
+
+        char w[ 10 ];
+        is.read( w, 10 );
+
+        BOOST_TEST( hash_stream<H>( is ) == digest_of<H>( s.substr( 10 ) ) );
+    }
+
+    {
+        unbuffered sb( s );
+        std::istream is( &sb );
+
+        BOOST_TEST( hash_stream<H>( is ) == r0 );
+    }
+
+    {
+        char const* fn = "hash_stream_test.tmp";
+
+        {
+            std::ofstream os( fn, std::ios_base::binary );
+            os.write( s.data(), static_cast<std::streamsize>( s.size() ) );
+        }
+
+        {
+            std::ifstream is( fn, std::ios_base::binary );
+            BOOST_TEST( hash_stream<H>( is ) == r0 );
+        }
+
+        {
+            std::ifstream is( fn, std::ios_base::binary );
+
+            if( n >= 1 )
+            {
+                is.get();
+                BOOST_TEST( hash_stream<H>( is ) == digest_of<H>( s.substr( 1 ) ) );
+            }
+        }
+
+        std::remove( fn );
+    }
+
+    // hashing_istream hashes what is read through it
+
+    {
+        std::istringstream is( s );
+        hashing_istream<H> hs( is );
+
+        std::string t;
+
+        char buffer[ 1000 ];
+
+        while( hs.read( buffer, sizeof( buffer ) ), hs.gcount() > 0 )
+        {
+            t.append( buffer, static_cast<std::size_t>( hs.gcount() ) );
+        }
+
+        BOOST_TEST( t == s );
+        BOOST_TEST( hs.result() == r0 );
+        BOOST_TEST( hs.rdbuf()->source() == is.rdbuf() );
+    }
+}
+
+int main()
+{
+    std::size_t const sizes[] = { 0, 1, 100, 8191, 8192, 8193, 300000, 1000000 };
+
+    for( std::size_t n: sizes )
+    {
+        test<sha2_256>( n );
+        test<xxh3_128>( n );
+    }
+
+    {
+        std::istream is( 0 );
+        hash_stream<sha2_256>( is );
+
+        BOOST_TEST( is.bad() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,109 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hashed.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <cstddef>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using namespace boost::hash2;
+
+template<class H> void test()
+{
+    using K = hashed<std::string, H>;
+
+    std::string const s( "https://www.boost.org/doc/libs/release/libs/hash2/" );
+
+    K k1( s );
+
+    BOOST_TEST_EQ( k1.value(), s );
+    BOOST_TEST_EQ( k1.hash_value(), (hash<std::string, H>()( s )) );
+
+    std::string s2( s );
+    K k2( std::move( s2 ) );
+
+    BOOST_TEST_EQ( k2.value(), s );
+    BOOST_TEST_EQ( k2.hash_value(), k1.hash_value() );
+
+    BOOST_TEST( k1 == k2 );
+    BOOST_TEST_NOT( k1 != k2 );
+
+    K k3( s + "x" );
+
+    BOOST_TEST( k1 != k3 );
+    BOOST_TEST_NOT( k1 == k3 );
+
+    // seeded
+
+    {
+        hash<std::string, H> hf( 7 );
+        K k4( s, hf );
+
+        BOOST_TEST_EQ( k4.hash_value(), hf( s ) );
+    }
+
+    // hash function object
+
+    {
+        STATIC_ASSERT( hash<K, siphash_64>::is_avalanching::value );
+
+        BOOST_TEST_EQ( (hash<K, siphash_64>()( k1 )), k1.hash_value() );
+        BOOST_TEST_EQ( (hash<K, siphash_64>( 7 )( k1 )), k1.hash_value() );
+    }
+
+    // hash_append
+
+    {
+        H h1;
+        hash_append( h1, {}, k1 );
+
+        H h2;
+        hash_append( h2, {}, k1.hash_value() );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        std::tuple<int, K> t( 1, k1 );
+
+        H h1;
+        hash_append( h1, {}, t );
+
+        H h2;
+        hash_append( h2, {}, 1 );
+        hash_append( h2, {}, k1.hash_value() );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+int main()
+{
+    test<fnv1a_64>();
+    test<siphash_64>();
+
+    {
+        using K = hashed<std::string, siphash_64>;
+
+        std::unordered_set< K, hash<K, siphash_64> > s;
+
+        for( int i = 0; i < 100; ++i )
+        {
+            s.insert( K( std::to_string( i ) ) );
+        }
+
+        BOOST_TEST_EQ( s.size(), 100u );
+        BOOST_TEST_EQ( s.count( K( "17" ) ), 1u );
+        BOOST_TEST_EQ( s.count( K( "100" ) ), 0u );
+    }
+
+    return boost::report_errors();
+}
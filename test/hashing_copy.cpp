@@ -0,0 +1,73 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hashing_copy.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::vector<unsigned char> make_data( std::size_t n )
+{
+    std::vector<unsigned char> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    return v;
+}
+
+template<class H> static void test( std::size_t n )
+{
+    std::vector<unsigned char> const v = make_data( n );
+
+    H h0;
+    h0.update( v.data(), v.size() );
+
+    typename H::result_type const r0 = h0.result();
+
+    {
+        std::vector<unsigned char> w( n + 1, 0xEE );
+
+        typename H::result_type r = hashing_copy<H>( v.data(), w.data(), n );
+
+        BOOST_TEST( r == r0 );
+        BOOST_TEST( std::vector<unsigned char>( w.begin(), w.begin() + n ) == v );
+        BOOST_TEST_EQ( w[ n ], 0xEE );
+    }
+
+    {
+        std::vector<unsigned char> w( n );
+
+        H h( 7 );
+        hashing_copy( h, v.data(), w.data(), n );
+
+        H h2( 7 );
+        h2.update( v.data(), v.size() );
+
+        BOOST_TEST( h.result() == h2.result() );
+        BOOST_TEST( w == v );
+    }
+}
+
+int main()
+{
+    std::size_t const sizes[] = { 0, 1, 31, 16383, 16384, 16385, 100000 };
+
+    for( std::size_t n: sizes )
+    {
+        test<sha2_256>( n );
+        test<xxh3_128>( n );
+        test<fnv1a_64>( n );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,102 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hashing_stream.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <sstream>
+#include <string>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::string make_data( std::size_t n )
+{
+    std::string s( n, ' ' );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        s[ i ] = static_cast<char>( 'a' + i * 7 % 26 );
+    }
+
+    return s;
+}
+
+template<class H> static typename H::result_type digest_of( std::string const& s )
+{
+    H h;
+    h.update( s.data(), s.size() );
+
+    return h.result();
+}
+
+template<class H> static void test()
+{
+    std::string const big = make_data( 100000 );
+
+    // a mix of small and large writes, characters and formatted output
+
+    std::string expected;
+
+    {
+        std::ostringstream os;
+        hashing_ostream<H> hs( os );
+
+        hs << "abc" << 123 << ' ';
+        hs.put( 'x' );
+        hs.write( big.data(), 20000 );
+        hs << big.substr( 20000, 5 );
+        hs.write( big.data(), static_cast<std::streamsize>( big.size() ) );
+
+        expected = "abc123 x" + big.substr( 0, 20000 ) + big.substr( 20000, 5 ) + big;
+
+        BOOST_TEST( hs.result() == digest_of<H>( expected ) );
+        BOOST_TEST( os.str() == expected );
+    }
+
+    // without a target
+
+    {
+        hashing_ostream<H> hs;
+
+        hs << "abc" << 123 << ' ';
+        hs.write( big.data(), static_cast<std::streamsize>( big.size() ) );
+
+        BOOST_TEST( hs.good() );
+        BOOST_TEST( hs.result() == digest_of<H>( "abc123 " + big ) );
+    }
+
+    // the stream buffer, with a seeded hash; the destructor flushes
+
+    {
+        std::ostringstream os;
+
+        {
+            hashing_streambuf<H> sb( os.rdbuf(), H( 7 ) );
+
+            sb.sputn( big.data(), 1000 );
+            sb.sputc( 'q' );
+
+            H h( 7 );
+            h.update( big.data(), 1000 );
+            h.update( "q", 1 );
+
+            BOOST_TEST( sb.result() == h.result() );
+            BOOST_TEST( sb.target() == os.rdbuf() );
+
+            sb.sputn( big.data(), 10 );
+        }
+
+        BOOST_TEST( os.str() == big.substr( 0, 1000 ) + "q" + big.substr( 0, 10 ) );
+    }
+}
+
+int main()
+{
+    test<sha2_256>();
+    test<xxh3_128>();
+
+    return boost::report_errors();
+}
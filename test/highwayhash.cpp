@@ -0,0 +1,174 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+using namespace boost::hash2;
+
+template<class H> typename H::result_type hash( unsigned char const* key, unsigned char const* p, std::size_t n )
+{
+    H h( key, 32 );
+    h.update( p, n );
+
+    return h.result();
+}
+
+template<class H> void test_incremental( unsigned char const* key, unsigned char const* p )
+{
+    for( std::size_t n = 0; n <= 300; ++n )
+    {
+        typename H::result_type const r = hash<H>( key, p, n );
+
+        for( std::size_t k = 1; k < 80; k += 7 )
+        {
+            H h( key, 32 );
+
+            std::size_t i = 0;
+
+            for( ; i + k <= n; i += k )
+            {
+                h.update( p + i, k );
+            }
+
+            h.update( p + i, n - i );
+
+            BOOST_TEST_EQ( h.result(), r );
+        }
+
+        {
+            H h( key, 32 );
+
+            h.update( p, n / 3 );
+            h.update( static_cast<void const*>( p + n / 3 ), n - n / 3 );
+
+            BOOST_TEST_EQ( h.result(), r );
+        }
+    }
+}
+
+template<class H> void test_seeds( unsigned char const* p )
+{
+    // the default seed is 0, the all-zero key
+
+    {
+        unsigned char const zeros[ 32 ] = {};
+
+        H h1;
+        H h2( 0 );
+        H h3( zeros, 32 );
+        H h4( p, 0 );
+
+        h1.update( p, 17 );
+        h2.update( p, 17 );
+        h3.update( p, 17 );
+        h4.update( p, 17 );
+
+        typename H::result_type const r = h1.result();
+
+        BOOST_TEST_EQ( h2.result(), r );
+        BOOST_TEST_EQ( h3.result(), r );
+        BOOST_TEST_EQ( h4.result(), r );
+    }
+
+    // the integer seed is the first key word
+
+    {
+        unsigned char key[ 32 ] = { 7 };
+
+        H h1( 7 );
+        H h2( key, 32 );
+
+        h1.update( p, 40 );
+        h2.update( p, 40 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // other byte sequence seeds are hashed
+
+    {
+        H h1( p, 17 );
+        H h2;
+
+        h2.update( p, 17 );
+        h2.result();
+
+        h1.update( p, 5 );
+        h2.update( p, 5 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+int main()
+{
+    unsigned char key[ 32 ];
+
+    for( int i = 0; i < 32; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i );
+    }
+
+    unsigned char data[ 300 ];
+
+    for( int i = 0; i < 300; ++i )
+    {
+        data[ i ] = static_cast<unsigned char>( i );
+    }
+
+    // test vectors from the reference implementation, highwayhash_test.cc
+
+    std::uint64_t const expected64[ 65 ] =
+    {
+        0x907A56DE22C26E53ull, 0x7EAB43AAC7CDDD78ull, 0xB8D0569AB0B53D62ull, 0x5C6BEFAB8A463D80ull,
+        0xF205A46893007EDAull, 0x2B8A1668E4A94541ull, 0xBD4CCC325BEFCA6Full, 0x4D02AE1738F59482ull,
+        0xE1205108E55F3171ull, 0x32D2644EC77A1584ull, 0xF6E10ACDB103A90Bull, 0xC3BBF4615B415C15ull,
+        0x243CC2040063FA9Cull, 0xA89A58CE65E641FFull, 0x24B031A348455A23ull, 0x40793F86A449F33Bull,
+        0xCFAB3489F97EB832ull, 0x19FE67D2C8C5C0E2ull, 0x04DD90A69C565CC2ull, 0x75D9518E2371C504ull,
+        0x38AD9B1141D3DD16ull, 0x0264432CCD8A70E0ull, 0xA9DB5A6288683390ull, 0xD7B05492003F028Cull,
+        0x205F615AEA59E51Eull, 0xEEE0C89621052884ull, 0x1BFC1A93A7284F4Full, 0x512175B5B70DA91Dull,
+        0xF71F8976A0A2C639ull, 0xAE093FEF1F84E3E7ull, 0x22CA92B01161860Full, 0x9FC7007CCF035A68ull,
+        0xA0C964D9ECD580FCull, 0x2C90F73CA03181FCull, 0x185CF84E5691EB9Eull, 0x4FC1F5EF2752AA9Bull,
+        0xF5B7391A5E0A33EBull, 0xB9B84B83B4E96C9Cull, 0x5E42FE712A5CD9B4ull, 0xA150F2F90C3F97DCull,
+        0x7FA522D75E2D637Dull, 0x181AD0CC0DFFD32Bull, 0x3889ED981E854028ull, 0xFB4297E8C586EE2Dull,
+        0x6D064A45BB28059Cull, 0x90563609B3EC860Cull, 0x7AA4FCE94097C666ull, 0x1326BAC06B911E08ull,
+        0xB926168D2B154F34ull, 0x9919848945B1948Dull, 0xA2A98FC534825EBEull, 0xE9809095213EF0B6ull,
+        0x582E5483707BC0E9ull, 0x086E9414A88A6AF5ull, 0xEE86B98D20F6743Dull, 0xF89B7FF609B1C0A7ull,
+        0x4C7D9CC19E22C3E8ull, 0x9A97005024562A6Full, 0x5DD41CF423E6EBEFull, 0xDF13609C0468E227ull,
+        0x6E0DA4F64188155Aull, 0xB755BA4B50D7D4A1ull, 0x887A3484647479BDull, 0xAB8EEBE9BF2139A0ull,
+        0x75542C5D4CD2A6FFull,
+    };
+
+    for( std::size_t n = 0; n <= 64; ++n )
+    {
+        BOOST_TEST_EQ( hash<highwayhash_64>( key, data, n ), expected64[ n ] );
+    }
+
+    // the values for the empty input are those of the reference implementation
+
+    BOOST_TEST_EQ( to_string( hash<highwayhash_128>( key, data, 0 ) ), std::string( "c7fe8f9d8f26ed0f6f3e097f765e5633" ) );
+    BOOST_TEST_EQ( to_string( hash<highwayhash_128>( key, data, 1 ) ), std::string( "a8e7813689a8b0d6b4dc9cebf91d29dc" ) );
+    BOOST_TEST_EQ( to_string( hash<highwayhash_128>( key, data, 33 ) ), std::string( "6cc3c6e0af7816119d84a2e59db558f9" ) );
+    BOOST_TEST_EQ( to_string( hash<highwayhash_128>( key, data, 64 ) ), std::string( "f2c4d498711fbb98c88f91de7105bce0" ) );
+
+    BOOST_TEST_EQ( to_string( hash<highwayhash_256>( key, data, 0 ) ), std::string( "f574c8c22a4844dd1f35c713730146d9ff1487b9ccbeaeb3f41d75453123da41" ) );
+    BOOST_TEST_EQ( to_string( hash<highwayhash_256>( key, data, 1 ) ), std::string( "54825fe4bc41b9ed0fc6ca3def440de2474a32cb9b1b657284e475b24c627320" ) );
+    BOOST_TEST_EQ( to_string( hash<highwayhash_256>( key, data, 33 ) ), std::string( "e5a634f0cb1501f6d046cebf75ea366c90597282d3c8173b357a0011eda2da7e" ) );
+    BOOST_TEST_EQ( to_string( hash<highwayhash_256>( key, data, 64 ) ), std::string( "7524c16affe6d890f2c1da6e192a421a02b08e1ffe65379ebecf51c3c4d7bdc1" ) );
+
+    test_incremental<highwayhash_64>( key, data );
+    test_incremental<highwayhash_128>( key, data );
+    test_incremental<highwayhash_256>( key, data );
+
+    test_seeds<highwayhash_64>( data );
+    test_seeds<highwayhash_128>( data );
+    test_seeds<highwayhash_256>( data );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,56 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v21[ 21 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v200[ 200 ] = {};
+
+    TEST_EQ( test<highwayhash_64>( 0, v21 ), 17432890134856167681ull );
+    TEST_EQ( test<highwayhash_64>( 0, v45 ), 10842647717523869463ull );
+    TEST_EQ( test<highwayhash_64>( 0, v200 ), 8344573565040596012ull );
+
+    TEST_EQ( test<highwayhash_64>( 7, v21 ), 12511798563711046470ull );
+    TEST_EQ( test<highwayhash_64>( 7, v45 ), 1698341985880103326ull );
+    TEST_EQ( test<highwayhash_64>( 7, v200 ), 7326307563243776593ull );
+
+    BOOST_CXX14_CONSTEXPR digest<16> r1 = {{ 151, 197, 5, 95, 116, 219, 109, 90, 178, 213, 227, 136, 6, 66, 6, 81 }};
+    BOOST_CXX14_CONSTEXPR digest<32> r2 = {{ 18, 153, 88, 68, 250, 17, 112, 208, 106, 138, 8, 93, 79, 105, 88, 37, 154, 191, 169, 144, 21, 17, 153, 173, 168, 208, 161, 155, 133, 175, 100, 86 }};
+
+    TEST_EQ( test<highwayhash_128>( 7, v45 ), r1 );
+    TEST_EQ( test<highwayhash_256>( 7, v45 ), r2 );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,105 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hkdf.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+std::string from_hex( char const* str )
+{
+    auto f = []( char c ) { return ( c >= 'a' ? c - 'a' + 10 : c - '0' ); };
+
+    std::string s;
+    while( *str != '\0' )
+    {
+        s.push_back( static_cast<char>( ( f( str[ 0 ] ) << 4 ) + f( str[ 1 ] ) ) );
+        str += 2;
+    }
+    return s;
+}
+
+std::string to_hex( unsigned char const* p, std::size_t n )
+{
+    char const* digits = "0123456789abcdef";
+
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += digits[ p[ i ] >> 4 ];
+        r += digits[ p[ i ] & 0x0F ];
+    }
+
+    return r;
+}
+
+template<class H> void test( char const* ikm, char const* salt, char const* info, std::size_t n, char const* prk, char const* okm )
+{
+    std::string const k = from_hex( ikm );
+    std::string const s = from_hex( salt );
+    std::string const i = from_hex( info );
+
+    typename H::result_type r = boost::hash2::hkdf_extract<H>( s.data(), s.size(), k.data(), k.size() );
+
+    BOOST_TEST_EQ( to_string( r ), std::string( prk ) );
+
+    std::vector<unsigned char> out( n );
+
+    boost::hash2::hkdf_expand<H>( r.data(), r.size(), i.data(), i.size(), out.data(), n );
+    BOOST_TEST_EQ( to_hex( out.data(), n ), std::string( okm ) );
+
+    std::vector<unsigned char> out2( n );
+
+    boost::hash2::hkdf<H>( s.data(), s.size(), k.data(), k.size(), i.data(), i.size(), out2.data(), n );
+    BOOST_TEST_EQ( to_hex( out2.data(), n ), std::string( okm ) );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // https://tools.ietf.org/html/rfc5869#appendix-A
+
+    test<sha2_256>(
+        "0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b",
+        "000102030405060708090a0b0c",
+        "f0f1f2f3f4f5f6f7f8f9",
+        42,
+        "077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5",
+        "3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf34007208d5b887185865"
+    );
+
+    test<sha2_256>(
+        "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f404142434445464748494a4b4c4d4e4f",
+        "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9fa0a1a2a3a4a5a6a7a8a9aaabacadaeaf",
+        "b0b1b2b3b4b5b6b7b8b9babbbcbdbebfc0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedfe0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff",
+        82,
+        "06a6b88c5853361a06104c9ceb35b45cef760014904671014a193f40c15fc244",
+        "b11e398dc80327a1c8e7f78c596a49344f012eda2d4efad8a050cc4c19afa97c59045a99cac7827271cb41c65e590e09da3275600c2f09b8367793a9aca3db71cc30c58179ec3e87c14c01d5c1f3434f1d87"
+    );
+
+    test<sha2_256>(
+        "0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b0b",
+        "",
+        "",
+        42,
+        "19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04",
+        "8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d9d201395faa4b61a96c8"
+    );
+
+    test<sha1_160>(
+        "0b0b0b0b0b0b0b0b0b0b0b",
+        "000102030405060708090a0b0c",
+        "f0f1f2f3f4f5f6f7f8f9",
+        42,
+        "9b6c18c432a7bf8f0e71c8eb88f4b30baa2ba243",
+        "085a01ea1b10f36933068b56efa5ad81a4f14b822f5b091568a9cdd4f155fda2c22e422478d305f3f896"
+    );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,156 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hmac_drbg.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+std::string from_hex( char const* str )
+{
+    auto f = []( char c ) { return ( c >= 'a' ? c - 'a' + 10 : c - '0' ); };
+
+    std::string s;
+    while( *str != '\0' )
+    {
+        s.push_back( static_cast<char>( ( f( str[ 0 ] ) << 4 ) + f( str[ 1 ] ) ) );
+        str += 2;
+    }
+    return s;
+}
+
+std::string to_hex( unsigned char const* p, std::size_t n )
+{
+    char const* digits = "0123456789abcdef";
+
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += digits[ p[ i ] >> 4 ];
+        r += digits[ p[ i ] & 0x0F ];
+    }
+
+    return r;
+}
+
+template<class H> std::string generate( boost::hash2::hmac_drbg<H>& d, std::size_t n, char const* add = "" )
+{
+    std::vector<unsigned char> out( n );
+    d.generate( out.data(), n, add, std::char_traits<char>::length( add ) );
+
+    return to_hex( out.data(), n );
+}
+
+int main()
+{
+    using boost::hash2::hmac_drbg;
+    using boost::hash2::sha2_256;
+    using boost::hash2::sha1_160;
+
+    // NIST CAVP, HMAC_DRBG.rsp, [SHA-256], [PredictionResistance = False], COUNT = 0
+
+    {
+        std::string const e = from_hex( "ca851911349384bffe89de1cbdc46e6831e44d34a4fb935ee285dd14b71a7488" );
+        std::string const n = from_hex( "659ba96c601dc69fc902940805ec0ca8" );
+
+        hmac_drbg<sha2_256> d( e.data(), e.size(), n.data(), n.size() );
+
+        generate( d, 128 );
+
+        BOOST_TEST_EQ( generate( d, 128 ),
+            std::string(
+                "e528e9abf2dece54d47c7e75e5fe302149f817ea9fb4bee6f4199697d04d5b89"
+                "d54fbb978a15b5c443c9ec21036d2460b6f73ebad0dc2aba6e624abf07745bc1"
+                "07694bb7547bb0995f70de25d6b29e2d3011bb19d27676c07162c8b5ccde0668"
+                "961df86803482cb37ed6d5c0bb8d50cf1f50d476aa0458bdaba806f48be9dcb8"
+            )
+        );
+    }
+
+    unsigned char b[ 80 ];
+
+    for( int i = 0; i < 80; ++i )
+    {
+        b[ i ] = static_cast<unsigned char>( i );
+    }
+
+    // personalization string, additional input, reseed
+
+    {
+        hmac_drbg<sha2_256> d( b, 32, b + 32, 16, "personalization", 15 );
+
+        BOOST_TEST_EQ( generate( d, 40, "additional" ), std::string( "716476f354e136886871e544e2290dec02254ad3faa600406e582dfc4167288386b604cd7481fba4" ) );
+        BOOST_TEST_EQ( generate( d, 40 ), std::string( "00929eab4434ebbc0fcdf38c5044aa712add1440637355c10218105ba6e58264918f23729f6e1ef5" ) );
+
+        d.reseed( b + 48, 32, "x", 1 );
+
+        BOOST_TEST_EQ( generate( d, 64 ), std::string( "8514b943c25074bb1908b594f334069d5c78231d6ce913c00ffdf65573198e3f858c95728670d7b40cf1e1135f0e22be5998a8de53c2549e6b2f05d5d9ce5cc6" ) );
+    }
+
+    {
+        hmac_drbg<sha1_160> d( b, 32, b + 32, 16 );
+        BOOST_TEST_EQ( generate( d, 20 ), std::string( "d1504d6b8fc8939341136406dc3ea60b9414ac90" ) );
+    }
+
+    // requests of more than 65536 bytes are split
+
+    {
+        hmac_drbg<sha2_256> d( b, 32, b + 32, 16 );
+
+        std::vector<unsigned char> out( 70000 );
+        d.generate( out.data(), out.size() );
+
+        BOOST_TEST_EQ( to_hex( out.data() + out.size() - 16, 16 ), std::string( "b0197a344956aac4884a05a5f9a5f1a2" ) );
+    }
+
+    // UniformRandomBitGenerator, 256 bytes per request
+
+    {
+        hmac_drbg<sha2_256> d( b, 32, b + 32, 16 );
+
+        BOOST_TEST_EQ( d(), 0x22903e5a8780fb0full );
+        BOOST_TEST_EQ( d(), 0x61d3b0a13f1a94a4ull );
+        BOOST_TEST_EQ( d(), 0x3ca751f61c4ef11dull );
+
+        for( int i = 3; i < 32; ++i )
+        {
+            d();
+        }
+
+        BOOST_TEST_EQ( d(), 0x1726d81cc21c2212ull );
+
+        std::uniform_int_distribution<int> dist( 1, 6 );
+
+        for( int i = 0; i < 100; ++i )
+        {
+            int x = dist( d );
+
+            BOOST_TEST_GE( x, 1 );
+            BOOST_TEST_LE( x, 6 );
+        }
+
+        std::vector<int> v{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+        std::shuffle( v.begin(), v.end(), d );
+
+        std::sort( v.begin(), v.end() );
+        BOOST_TEST_EQ( v.front(), 1 );
+        BOOST_TEST_EQ( v.back(), 9 );
+    }
+
+    // the default constructor uses fresh entropy each time
+
+    {
+        hmac_drbg<sha2_256> d1, d2;
+        BOOST_TEST_NE( d1(), d2() );
+    }
+
+    return boost::report_errors();
+}
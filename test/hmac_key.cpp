@@ -0,0 +1,97 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <cstddef>
+
+template<class H> void test()
+{
+    unsigned char key[ 300 ];
+
+    for( std::size_t i = 0; i < sizeof( key ); ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i * 13 + 5 );
+    }
+
+    char const* messages[] = { "", "abc", "The quick brown fox jumps over the lazy dog" };
+
+    // key lengths shorter than, equal to, and longer than the block size
+    std::size_t const ns[] = { 0, 1, 20, static_cast<std::size_t>( H::block_size ), static_cast<std::size_t>( H::block_size ) + 1, sizeof( key ) };
+
+    for( std::size_t i = 0; i < sizeof( ns ) / sizeof( ns[ 0 ] ); ++i )
+    {
+        boost::hash2::hmac_key<H> const k( key, ns[ i ] );
+
+        for( std::size_t j = 0; j < sizeof( messages ) / sizeof( messages[ 0 ] ); ++j )
+        {
+            char const* m = messages[ j ];
+            std::size_t n = std::char_traits<char>::length( m );
+
+            boost::hash2::hmac<H> h1( key, ns[ i ] );
+            h1.update( m, n );
+
+            boost::hash2::hmac<H> h2( k );
+            h2.update( m, n );
+
+            BOOST_TEST( h1.result() == h2.result() );
+        }
+    }
+
+    {
+        boost::hash2::hmac_key<H> const k;
+
+        boost::hash2::hmac<H> h1;
+        boost::hash2::hmac<H> h2( k );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        boost::hash2::hmac_key<H> const k( 0 );
+
+        boost::hash2::hmac<H> h1;
+        boost::hash2::hmac<H> h2( k );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        boost::hash2::hmac_key<H> const k( 7 );
+
+        boost::hash2::hmac<H> h1( 7 );
+        boost::hash2::hmac<H> h2( k );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::md5_128>();
+    test<boost::hash2::sha1_160>();
+    test<boost::hash2::sha2_256>();
+    test<boost::hash2::sha2_224>();
+    test<boost::hash2::sha2_512>();
+    test<boost::hash2::sha2_384>();
+    test<boost::hash2::sha2_512_224>();
+    test<boost::hash2::sha2_512_256>();
+    test<boost::hash2::ripemd_160>();
+    test<boost::hash2::ripemd_128>();
+    test<boost::hash2::blake2b_512>();
+    test<boost::hash2::blake2s_256>();
+    test<boost::hash2::sha3_256>();
+    test<boost::hash2::sha3_224>();
+    test<boost::hash2::sha3_512>();
+    test<boost::hash2::sha3_384>();
+
+    return boost::report_errors();
+}
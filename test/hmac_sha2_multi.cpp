@@ -0,0 +1,135 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template<std::size_t N> void test( std::size_t k, std::size_t n, std::size_t split )
+{
+    std::vector<unsigned char> key( k + 1 );
+
+    for( std::size_t i = 0; i < k; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i * 5 + 3 );
+    }
+
+    std::vector<unsigned char> v[ N ];
+    unsigned char const* p[ N ];
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        v[ j ].resize( n + 1 );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            v[ j ][ i ] = static_cast<unsigned char>( i * 7 + j * 31 + 1 );
+        }
+
+        p[ j ] = v[ j ].data();
+    }
+
+    boost::hash2::hmac_key<boost::hash2::sha2_256> const hk( key.data(), k );
+
+    // hmac_sha2_256_multi
+
+    {
+        boost::hash2::hmac_sha2_256_multi<N> h( hk );
+
+        unsigned char const* q[ N ];
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            q[ j ] = p[ j ];
+        }
+
+        h.update( q, split );
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            q[ j ] += split;
+        }
+
+        h.update( q, n - split );
+
+        typename boost::hash2::hmac_sha2_256_multi<N>::result_type r = h.result();
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            boost::hash2::hmac_sha2_256 h2( key.data(), k );
+            h2.update( v[ j ].data(), n );
+
+            BOOST_TEST_EQ( r[ j ], h2.result() );
+        }
+    }
+
+    // verify
+
+    {
+        boost::hash2::digest<32> tag[ N ];
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            boost::hash2::hmac_sha2_256 h2( key.data(), k );
+            h2.update( v[ j ].data(), n );
+
+            tag[ j ] = h2.result();
+
+            BOOST_TEST( boost::hash2::verify( hk, v[ j ].data(), n, tag[ j ] ) );
+        }
+
+        bool ok[ N ];
+
+        BOOST_TEST_EQ( boost::hash2::verify( hk, p, n, tag, ok ), N );
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            BOOST_TEST( ok[ j ] );
+        }
+
+        // corrupt the last byte of the tag of the first message
+
+        tag[ 0 ][ 31 ] ^= 1;
+
+        BOOST_TEST( !boost::hash2::verify( hk, v[ 0 ].data(), n, tag[ 0 ] ) );
+
+        BOOST_TEST_EQ( boost::hash2::verify( hk, p, n, tag, ok ), N - 1 );
+
+        BOOST_TEST( !ok[ 0 ] );
+
+        for( std::size_t j = 1; j < N; ++j )
+        {
+            BOOST_TEST( ok[ j ] );
+        }
+    }
+}
+
+template<std::size_t N> void test()
+{
+    std::size_t const keys[] = { 0, 16, 64, 65, 200 };
+    std::size_t const lengths[] = { 0, 1, 31, 32, 55, 56, 63, 64, 65, 127, 128, 129, 1000 };
+
+    for( std::size_t k: keys )
+    {
+        for( std::size_t n: lengths )
+        {
+            test<N>( k, n, 0 );
+            test<N>( k, n, n / 3 );
+        }
+    }
+}
+
+int main()
+{
+    test<1>();
+    test<2>();
+    test<4>();
+    test<8>();
+    test<9>();
+    test<16>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,162 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/hyperloglog.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+#include <algorithm>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static bool close( double e, double n, double tolerance )
+{
+    return std::fabs( e - n ) <= tolerance * n;
+}
+
+template<class S> void test_estimate( S s, double tolerance )
+{
+    BOOST_TEST_EQ( s.estimate(), 0.0 );
+
+    std::size_t n = 0;
+
+    for( std::size_t k: { 10, 100, 1000, 10000, 100000 } )
+    {
+        for( ; n < k; ++n )
+        {
+            s.insert( n );
+            s.insert( n ); // duplicates don't count
+        }
+
+        double e = s.estimate();
+        BOOST_TEST( close( e, static_cast<double>( n ), tolerance ) ) || BOOST_LIGHTWEIGHT_TEST_OSTREAM << "n=" << n << " estimate=" << e << std::endl;
+    }
+
+    BOOST_TEST_NOT( s.is_sparse() );
+
+    s.clear();
+
+    BOOST_TEST( s.is_sparse() );
+    BOOST_TEST_EQ( s.estimate(), 0.0 );
+}
+
+template<class S> S make_sketch( std::size_t first, std::size_t last )
+{
+    S s;
+
+    for( std::size_t i = first; i < last; ++i )
+    {
+        s.insert( "user" + std::to_string( i ) );
+    }
+
+    return s;
+}
+
+template<class S> void test_merge()
+{
+    // sparse + sparse, sparse + dense, dense + sparse, dense + dense
+
+    std::size_t const sizes[] = { 50, 100000 };
+
+    for( std::size_t n1: sizes )
+    {
+        for( std::size_t n2: sizes )
+        {
+            S s1 = make_sketch<S>( 0, n1 );
+            S s2 = make_sketch<S>( n1 / 2, n1 / 2 + n2 );
+            S s3 = make_sketch<S>( 0, std::max( n1, n1 / 2 + n2 ) );
+
+            s1.merge( s2 );
+
+            BOOST_TEST_EQ( s1.estimate(), s3.estimate() );
+
+            unsigned char b1[ S::state_size ], b3[ S::state_size ];
+
+            s1.save_state( b1 );
+            s3.save_state( b3 );
+
+            BOOST_TEST_ALL_EQ( b1, b1 + S::state_size, b3, b3 + S::state_size );
+        }
+    }
+}
+
+template<class S> void test_state()
+{
+    S s1 = make_sketch<S>( 0, 30 );
+    S s2 = make_sketch<S>( 0, 30000 );
+
+    for( S const* p: { &s1, &s2 } )
+    {
+        std::vector<unsigned char> b( S::state_size );
+        p->save_state( b.data() );
+
+        S s3;
+
+        BOOST_TEST( s3.load_state( b.data(), b.size() ) );
+        BOOST_TEST_EQ( s3.estimate(), p->estimate() );
+
+        BOOST_TEST_NOT( s3.load_state( b.data(), b.size() - 1 ) );
+
+        b[ 0 ] = 64;
+        BOOST_TEST_NOT( s3.load_state( b.data(), b.size() ) );
+    }
+}
+
+void test_concurrent()
+{
+    concurrent_hyperloglog<xxhash_64, 12> s;
+    hyperloglog<xxhash_64, 12> s2;
+
+    std::vector<std::thread> th;
+
+    for( int t = 0; t < 4; ++t )
+    {
+        th.emplace_back( [&s, t]{
+
+            for( int i = 0; i < 20000; ++i )
+            {
+                s.insert( std::make_tuple( t, i ) );
+            }
+        });
+    }
+
+    for( auto& x: th ) x.join();
+
+    for( int t = 0; t < 4; ++t )
+    {
+        for( int i = 0; i < 20000; ++i )
+        {
+            s2.insert( std::make_tuple( t, i ) );
+        }
+    }
+
+    BOOST_TEST_EQ( s.estimate(), s2.estimate() );
+    BOOST_TEST( close( s.estimate(), 80000, 0.05 ) );
+}
+
+int main()
+{
+    test_estimate( hyperloglog<xxhash_64>(), 0.03 );
+    test_estimate( hyperloglog<xxh3_128, 12>(), 0.06 );
+    test_estimate( hyperloglog<siphash_64, 16>( 7 ), 0.02 );
+    test_estimate( hyperloglog<xxhash_64, 6>(), 0.5 );
+
+    test_merge< hyperloglog<xxhash_64> >();
+    test_merge< hyperloglog<siphash_64, 10> >();
+
+    test_state< hyperloglog<xxhash_64> >();
+    test_state< hyperloglog<xxhash_64, 6> >();
+
+    test_concurrent();
+
+    return boost::report_errors();
+}
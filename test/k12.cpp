@@ -0,0 +1,193 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/k12.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using boost::hash2::k12;
+
+// ptn(n) of RFC 9861, the repeating pattern 00 01 ... FA
+
+static std::vector<unsigned char> ptn( std::size_t n )
+{
+    std::vector<unsigned char> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    return v;
+}
+
+static std::string hash( std::vector<unsigned char> const& v )
+{
+    k12 h;
+
+    h.update( v.data(), v.size() );
+
+    return to_string( h.result() );
+}
+
+static void test_vectors()
+{
+    // KangarooTwelve(M, C = empty, 32) from RFC 9861
+
+    BOOST_TEST_EQ( hash( ptn( 0 ) ), std::string( "1ac2d450fc3b4205d19da7bfca1b37513c0803577ac7167f06fe2ce1f0ef39e5" ) );
+    BOOST_TEST_EQ( hash( ptn( 1 ) ), std::string( "2bda92450e8b147f8a7cb629e784a058efca7cf7d8218e02d345dfaa65244a1f" ) );
+    BOOST_TEST_EQ( hash( ptn( 17 ) ), std::string( "6bf75fa2239198db4772e36478f8e19b0f371205f6a9a93a273f51df37122888" ) );
+    BOOST_TEST_EQ( hash( ptn( 17 * 17 ) ), std::string( "0c315ebcdedbf61426de7dcf8fb725d1e74675d7f5327a5067f367b108ecb67c" ) );
+    BOOST_TEST_EQ( hash( ptn( 17 * 17 * 17 ) ), std::string( "cb552e2ec77d9910701d578b457ddf772c12e322e4ee7fe417f92c758f0d59d0" ) );
+    BOOST_TEST_EQ( hash( ptn( 17 * 17 * 17 * 17 ) ), std::string( "8701045e22205345ff4dda05555cbb5c3af1a771c2b89baef37db43d9998b9fe" ) );
+    BOOST_TEST_EQ( hash( ptn( 17 * 17 * 17 * 17 * 17 ) ), std::string( "844d610933b1b9963cbdeb5ae3b6b05cc7cbd67ceedf883eb678a0a8e0371682" ) );
+
+    // repeated calls to result() continue the output; the first 64
+    // bytes of KangarooTwelve(empty, empty, 64)
+
+    {
+        k12 h;
+
+        BOOST_TEST_EQ( to_string( h.result() ), std::string( "1ac2d450fc3b4205d19da7bfca1b37513c0803577ac7167f06fe2ce1f0ef39e5" ) );
+        BOOST_TEST_EQ( to_string( h.result() ), std::string( "4269c056b8c82e48276038b6d292966cc07a3d4645272e31ff38508139eb0a71" ) );
+    }
+}
+
+// the leaves are hashed one, four, or eight at a time depending on how
+// the input is split; the result must not depend on it
+
+static void test_incremental()
+{
+    std::size_t const sizes[] = { 8191, 8192, 8193, 8192 * 2, 8192 * 2 + 1, 8192 * 5 - 1, 8192 * 9, 8192 * 10 + 17, 8192 * 19 + 300 };
+
+    std::size_t const steps[] = { 1000, 8192, 8193, 8192 * 4, 8192 * 4 - 1, 8192 * 8 + 5 };
+
+    for( std::size_t n: sizes )
+    {
+        std::vector<unsigned char> const v = ptn( n );
+        std::string const r = hash( v );
+
+        for( std::size_t k: steps )
+        {
+            k12 h;
+
+            std::size_t i = 0;
+
+            for( ; i + k <= n; i += k )
+            {
+                h.update( v.data() + i, k );
+            }
+
+            h.update( v.data() + i, n - i );
+
+            BOOST_TEST_EQ( to_string( h.result() ), r );
+        }
+
+        {
+            k12 h;
+
+            h.update( v.data(), n / 3 );
+            h.update( static_cast<void const*>( v.data() + n / 3 ), n - n / 3 );
+
+            BOOST_TEST_EQ( to_string( h.result() ), r );
+        }
+    }
+}
+
+static void test_seeds()
+{
+    std::vector<unsigned char> const v = ptn( 8192 * 3 );
+
+    // the default seed is 0
+
+    {
+        k12 h1;
+        k12 h2( 0 );
+        k12 h3( v.data(), 0 );
+
+        h1.update( v.data(), 17 );
+        h2.update( v.data(), 17 );
+        h3.update( v.data(), 17 );
+
+        k12::result_type const r = h1.result();
+
+        BOOST_TEST_EQ( h2.result(), r );
+        BOOST_TEST_EQ( h3.result(), r );
+    }
+
+    // a seeded message is the message prefixed with 32 bytes of output
+
+    {
+        k12 h1( v.data(), 17 );
+
+        k12 h2;
+
+        h2.update( v.data(), 17 );
+        h2.result();
+
+        k12::result_type const prefix = h2.result();
+
+        k12 h3;
+
+        h3.update( prefix.data(), prefix.size() );
+        h3.update( v.data(), v.size() );
+
+        h1.update( v.data(), v.size() );
+
+        BOOST_TEST_EQ( h1.result(), h3.result() );
+    }
+
+    // different seeds give different results
+
+    {
+        k12 h1( 1 );
+        k12 h2( 2 );
+
+        h1.update( v.data(), v.size() );
+        h2.update( v.data(), v.size() );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+    }
+}
+
+// update_parallel agrees with update, including when the input starts
+// in the first chunk or in the middle of a leaf
+
+static void test_parallel()
+{
+    std::vector<unsigned char> const v = ptn( 8192 * 200 + 77 );
+
+    std::size_t const offsets[] = { 0, 5, 8192, 8192 * 2 + 100 };
+
+    for( std::size_t m: offsets )
+    {
+        k12 h1;
+        h1.update( v.data(), v.size() );
+
+        k12::result_type const r = h1.result();
+
+        for( unsigned threads = 0; threads <= 5; ++threads )
+        {
+            k12 h2;
+
+            h2.update( v.data(), m );
+            h2.update_parallel( v.data() + m, v.size() - m, threads );
+
+            BOOST_TEST_EQ( h2.result(), r );
+        }
+    }
+}
+
+int main()
+{
+    test_vectors();
+    test_incremental();
+    test_seeds();
+    test_parallel();
+
+    return boost::report_errors();
+}
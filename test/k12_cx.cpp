@@ -0,0 +1,49 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/k12.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR boost::hash2::k12::result_type test( unsigned char const (&v)[ N ], std::size_t n )
+{
+    boost::hash2::k12 h;
+
+    h.update( v, n / 3 );
+    h.update( v + n / 3, n - n / 3 );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using boost::hash2::digest;
+
+    // ptn(17) of RFC 9861
+
+    constexpr unsigned char v[ 17 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+    BOOST_CXX14_CONSTEXPR digest<32> r0 = {{ 0x1a, 0xc2, 0xd4, 0x50, 0xfc, 0x3b, 0x42, 0x05, 0xd1, 0x9d, 0xa7, 0xbf, 0xca, 0x1b, 0x37, 0x51, 0x3c, 0x08, 0x03, 0x57, 0x7a, 0xc7, 0x16, 0x7f, 0x06, 0xfe, 0x2c, 0xe1, 0xf0, 0xef, 0x39, 0xe5 }};
+    BOOST_CXX14_CONSTEXPR digest<32> r1 = {{ 0x2b, 0xda, 0x92, 0x45, 0x0e, 0x8b, 0x14, 0x7f, 0x8a, 0x7c, 0xb6, 0x29, 0xe7, 0x84, 0xa0, 0x58, 0xef, 0xca, 0x7c, 0xf7, 0xd8, 0x21, 0x8e, 0x02, 0xd3, 0x45, 0xdf, 0xaa, 0x65, 0x24, 0x4a, 0x1f }};
+    BOOST_CXX14_CONSTEXPR digest<32> r17 = {{ 0x6b, 0xf7, 0x5f, 0xa2, 0x23, 0x91, 0x98, 0xdb, 0x47, 0x72, 0xe3, 0x64, 0x78, 0xf8, 0xe1, 0x9b, 0x0f, 0x37, 0x12, 0x05, 0xf6, 0xa9, 0xa9, 0x3a, 0x27, 0x3f, 0x51, 0xdf, 0x37, 0x12, 0x28, 0x88 }};
+
+    TEST_EQ( test( v, 0 ), r0 );
+    TEST_EQ( test( v, 1 ), r1 );
+    TEST_EQ( test( v, 17 ), r17 );
+
+    return boost::report_errors();
+}
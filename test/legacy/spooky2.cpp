@@ -103,5 +103,22 @@ int main()
         BOOST_TEST_EQ( r, expected[ i ] );
     }
 
+    // the one-shot hash agrees with the incremental interface, on both
+    // sides of the 192 byte ShortHash threshold
+
+    for( int i = 0; i < N; ++i )
+    {
+        std::uint64_t const seeds[][ 2 ] = { { 0, 0 }, { 1, 0 }, { 0x0123456789abcdefull, 0xfedcba9876543210ull } };
+
+        for( auto const& s: seeds )
+        {
+            boost::hash2::spooky2_128 h( s[ 0 ], s[ 1 ] );
+
+            h.update( buf, i );
+
+            BOOST_TEST( boost::hash2::spooky2_128::hash( buf, i, s[ 0 ], s[ 1 ] ) == h.result() );
+        }
+    }
+
     return boost::report_errors();
 }
@@ -0,0 +1,148 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/literal.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <string>
+#include <vector>
+#include <cstring>
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+# include <string_view>
+#endif
+
+template<class H> void test_runtime()
+{
+    using namespace boost::hash2;
+
+    char const* const keys[] = { "", "a", "GET", "POST", "Content-Type", "a somewhat longer string, more than a block of some of the algorithms" };
+
+    for( char const* k: keys )
+    {
+        std::string s( k );
+
+        BOOST_TEST_EQ( literal<H>( s ), literal<H>( k, std::strlen( k ) ) );
+        BOOST_TEST_EQ( literal<H>( s ), literal<H>( std::vector<char>( s.begin(), s.end() ) ) );
+
+        BOOST_TEST( literal_equal( s, "GET" ) == ( s == "GET" ) );
+        BOOST_TEST( literal_equal( k, std::strlen( k ), "GET" ) == ( s == "GET" ) );
+    }
+
+    BOOST_TEST_EQ( literal<H>( std::string( "GET" ) ), literal<H>( "GET" ) );
+    BOOST_TEST_NE( literal<H>( std::string( "GET" ) ), literal<H>( "GETS" ) );
+
+    // the terminating null isn't part of the literal
+
+    BOOST_TEST_EQ( literal<H>( "" ), literal<H>( "x", 0 ) );
+
+    // embedded nulls are
+
+    BOOST_TEST_EQ( literal<H>( "a\0b" ), literal<H>( std::string( "a\0b", 3 ) ) );
+    BOOST_TEST_NE( literal<H>( "a\0b" ), literal<H>( "a" ) );
+}
+
+using namespace boost::hash2::literals;
+
+enum method { m_get, m_put, m_post, m_delete, m_head, m_options, m_other };
+
+method parse_method( std::string const& s )
+{
+    using boost::hash2::literal;
+    using boost::hash2::literal_equal;
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    switch( literal( s ) )
+    {
+    case "GET"_h2: if( literal_equal( s, "GET" ) ) return m_get; break;
+    case "PUT"_h2: if( literal_equal( s, "PUT" ) ) return m_put; break;
+    case "POST"_h2: if( literal_equal( s, "POST" ) ) return m_post; break;
+    case "DELETE"_h2: if( literal_equal( s, "DELETE" ) ) return m_delete; break;
+    case "HEAD"_h2: if( literal_equal( s, "HEAD" ) ) return m_head; break;
+    case "OPTIONS"_h2: if( literal_equal( s, "OPTIONS" ) ) return m_options; break;
+    }
+
+#else
+
+    std::uint64_t const h = literal( s );
+
+    if( h == "GET"_h2 && literal_equal( s, "GET" ) ) return m_get;
+    if( h == "PUT"_h2 && literal_equal( s, "PUT" ) ) return m_put;
+    if( h == "POST"_h2 && literal_equal( s, "POST" ) ) return m_post;
+    if( h == "DELETE"_h2 && literal_equal( s, "DELETE" ) ) return m_delete;
+    if( h == "HEAD"_h2 && literal_equal( s, "HEAD" ) ) return m_head;
+    if( h == "OPTIONS"_h2 && literal_equal( s, "OPTIONS" ) ) return m_options;
+
+#endif
+
+    return m_other;
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+template<class H> constexpr int parse_digit( char const* p, std::size_t n )
+{
+    switch( boost::hash2::literal<H>( p, n ) )
+    {
+    case boost::hash2::literal<H>( "zero" ): return 0;
+    case boost::hash2::literal<H>( "one" ): return 1;
+    case boost::hash2::literal<H>( "two" ): return 2;
+    default: return -1;
+    }
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT( "GET"_h2 == boost::hash2::literal( "GET" ) );
+STATIC_ASSERT( "GET"_h2 != "PUT"_h2 );
+STATIC_ASSERT( ""_h2 == boost::hash2::literal<boost::hash2::fnv1a_64>( "" ) );
+
+STATIC_ASSERT( boost::hash2::literal_equal( "GET", 3, "GET" ) );
+STATIC_ASSERT( !boost::hash2::literal_equal( "GETS", 4, "GET" ) );
+
+STATIC_ASSERT( parse_digit<boost::hash2::fnv1a_32>( "one", 3 ) == 1 );
+STATIC_ASSERT( parse_digit<boost::hash2::xxhash_64>( "two", 3 ) == 2 );
+STATIC_ASSERT( parse_digit<boost::hash2::siphash_64>( "zero", 4 ) == 0 );
+STATIC_ASSERT( parse_digit<boost::hash2::sha2_256>( "three", 5 ) == -1 );
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+
+STATIC_ASSERT( boost::hash2::literal( std::string_view( "POST" ) ) == "POST"_h2 );
+STATIC_ASSERT( boost::hash2::literal_equal( std::string_view( "POST" ), "POST" ) );
+
+#endif
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test_runtime<fnv1a_32>();
+    test_runtime<fnv1a_64>();
+    test_runtime<xxhash_64>();
+    test_runtime<siphash_64>();
+    test_runtime<sha2_256>();
+
+    BOOST_TEST_EQ( "GET"_h2, literal( std::string( "GET" ) ) );
+
+    BOOST_TEST_EQ( parse_method( "GET" ), m_get );
+    BOOST_TEST_EQ( parse_method( "PUT" ), m_put );
+    BOOST_TEST_EQ( parse_method( "POST" ), m_post );
+    BOOST_TEST_EQ( parse_method( "DELETE" ), m_delete );
+    BOOST_TEST_EQ( parse_method( "HEAD" ), m_head );
+    BOOST_TEST_EQ( parse_method( "OPTIONS" ), m_options );
+
+    BOOST_TEST_EQ( parse_method( "" ), m_other );
+    BOOST_TEST_EQ( parse_method( "get" ), m_other );
+    BOOST_TEST_EQ( parse_method( "GETS" ), m_other );
+    BOOST_TEST_EQ( parse_method( "PATCH" ), m_other );
+
+    return boost::report_errors();
+}
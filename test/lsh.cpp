@@ -0,0 +1,243 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/lsh.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+static std::vector<float> random_vector( std::size_t n, std::uint64_t seed )
+{
+    std::vector<float> v( n );
+
+    std::uint64_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        v[ i ] = static_cast<float>( static_cast<std::int32_t>( x >> 32 ) ) / 2147483648.0f;
+    }
+
+    return v;
+}
+
+// cos( theta ) * u + sin( theta ) * w, for u and w orthogonal
+
+static std::vector<float> at_angle( std::vector<float> const& u, std::vector<float> const& w, double theta )
+{
+    std::vector<float> v( u.size() );
+
+    for( std::size_t i = 0; i < u.size(); ++i )
+    {
+        v[ i ] = static_cast<float>( std::cos( theta ) * u[ i ] + std::sin( theta ) * w[ i ] );
+    }
+
+    return v;
+}
+
+template<class H> void test_hyperplane( std::size_t dim )
+{
+    using lsh = boost::hash2::hyperplane_lsh<H, 1024>;
+
+    lsh const l1( dim, 7 );
+    lsh const l2( dim, 7 );
+    lsh const l3( dim, 8 );
+
+    BOOST_TEST_EQ( l1.dimension(), dim );
+
+    std::vector<float> const u = random_vector( dim, 1 );
+
+    // the same seed, the same hyperplanes
+
+    BOOST_TEST( l1.signature( u.data() ) == l2.signature( u.data() ) );
+    BOOST_TEST( l1.signature( u.data() ) != l3.signature( u.data() ) );
+
+    // scaling doesn't change the signature, negation inverts it
+
+    {
+        std::vector<float> v( u ), w( u );
+
+        for( std::size_t i = 0; i < dim; ++i )
+        {
+            v[ i ] *= 4;
+            w[ i ] = -w[ i ];
+        }
+
+        BOOST_TEST( l1.signature( v.data() ) == l1.signature( u.data() ) );
+        BOOST_TEST_EQ( lsh::distance( l1.signature( w.data() ), l1.signature( u.data() ) ), 1024 );
+    }
+
+    // the angle estimate; w is made orthogonal to u
+
+    std::vector<float> w = random_vector( dim, 2 );
+
+    {
+        double uu = 0, uw = 0;
+
+        for( std::size_t i = 0; i < dim; ++i )
+        {
+            uu += u[ i ] * u[ i ];
+            uw += u[ i ] * w[ i ];
+        }
+
+        for( std::size_t i = 0; i < dim; ++i )
+        {
+            w[ i ] -= static_cast<float>( uw / uu * u[ i ] );
+        }
+    }
+
+    for( double theta: { 0.1, 0.5, 1.0, 2.0 } )
+    {
+        std::vector<float> const v = at_angle( u, w, theta );
+
+        typename lsh::signature_type const s1 = l1.signature( u.data() );
+        typename lsh::signature_type const s2 = l1.signature( v.data() );
+
+        double const d = lsh::distance( s1, s2 ) / 1024.0;
+
+        BOOST_TEST_LT( std::fabs( d - theta / 3.14159265358979323846 ), 0.06 );
+        BOOST_TEST_LT( std::fabs( lsh::similarity( s1, s2 ) - std::cos( theta ) ), 0.2 );
+    }
+
+    // band keys
+
+    {
+        typename lsh::signature_type s1 = l1.signature( u.data() );
+        typename lsh::signature_type s2 = s1;
+
+        s2[ 3 ] ^= 1u << 5; // bit 197, in band 6 of 32 bits
+
+        auto k1 = l1.template band_keys<32>( s1 );
+        auto k2 = l1.template band_keys<32>( s2 );
+        auto k3 = l3.template band_keys<32>( s1 );
+
+        for( std::size_t b = 0; b < 32; ++b )
+        {
+            BOOST_TEST_EQ( k1[ b ] != k2[ b ], b == 6 );
+            BOOST_TEST_NE( k1[ b ], k3[ b ] );
+        }
+
+        // equal bits in different bands give different keys
+
+        typename lsh::signature_type z = {};
+        auto k4 = l1.template band_keys<16>( z );
+
+        BOOST_TEST_NE( k4[ 0 ], k4[ 1 ] );
+    }
+}
+
+template<class H> void test_pstable( std::size_t dim )
+{
+    using lsh = boost::hash2::pstable_lsh<H, 64>;
+
+    lsh const l1( dim, 4.0f, 7 );
+    lsh const l2( dim, 4.0f, 7 );
+
+    BOOST_TEST_EQ( l1.dimension(), dim );
+    BOOST_TEST_EQ( l1.width(), 4.0f );
+
+    std::vector<float> const u = random_vector( dim, 1 );
+
+    BOOST_TEST( l1.signature( u.data() ) == l2.signature( u.data() ) );
+
+    // nearby vectors share most indices, distant ones few
+
+    std::vector<float> v( u ), w( u );
+
+    std::vector<float> const d = random_vector( dim, 3 );
+
+    for( std::size_t i = 0; i < dim; ++i )
+    {
+        v[ i ] += d[ i ] * 0.02f;
+        w[ i ] += d[ i ] * 4.0f;
+    }
+
+    typename lsh::signature_type const su = l1.signature( u.data() );
+    typename lsh::signature_type const sv = l1.signature( v.data() );
+    typename lsh::signature_type const sw = l1.signature( w.data() );
+
+    std::size_t mv = 0, mw = 0;
+
+    for( std::size_t i = 0; i < 64; ++i )
+    {
+        mv += su[ i ] == sv[ i ];
+        mw += su[ i ] == sw[ i ];
+    }
+
+    BOOST_TEST_GT( mv, 48u );
+
+    if( dim >= 16 )
+    {
+        BOOST_TEST_LT( mw, 32u );
+    }
+
+    // band keys
+
+    auto k1 = l1.template band_keys<16>( su );
+    auto k2 = l2.template band_keys<16>( su );
+
+    BOOST_TEST( k1 == k2 );
+
+    typename lsh::signature_type s2 = su;
+    ++s2[ 17 ];
+
+    auto k3 = l1.template band_keys<16>( s2 );
+
+    for( std::size_t b = 0; b < 16; ++b )
+    {
+        BOOST_TEST_EQ( k1[ b ] != k3[ b ], b == 4 );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    for( std::size_t dim: { 1, 15, 16, 17, 100, 768 } )
+    {
+        test_hyperplane<xxhash_64>( dim < 16? 16: dim );
+        test_pstable<xxhash_64>( dim );
+    }
+
+    test_hyperplane<siphash_64>( 200 );
+    test_pstable<siphash_64>( 200 );
+
+    // the projections don't depend on the code path, for exact sums
+
+    {
+        std::vector<float> w( 3 * 37 ), v( 37 );
+
+        for( std::size_t i = 0; i < w.size(); ++i )
+        {
+            w[ i ] = static_cast<float>( static_cast<int>( i % 7 ) - 3 );
+        }
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = static_cast<float>( i );
+        }
+
+        float p[ 3 ];
+        detail::lsh_project( w.data(), 3, v.data(), 37, p );
+
+        for( std::size_t r = 0; r < 3; ++r )
+        {
+            float s = 0;
+
+            for( std::size_t i = 0; i < 37; ++i )
+            {
+                s += w[ r * 37 + i ] * v[ i ];
+            }
+
+            BOOST_TEST_EQ( p[ r ], s );
+            BOOST_TEST_EQ( p[ r ], detail::lsh_dot( w.data() + r * 37, v.data(), 37 ) );
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,129 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/lthash.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+template<class L> void test()
+{
+    std::vector<std::string> v;
+
+    for( int i = 0; i < 100; ++i )
+    {
+        v.push_back( std::to_string( i * 7919 ) );
+    }
+
+    // the state doesn't depend on the order of the elements
+
+    L l1, l2;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        l1.add( v[ i ] );
+        l2.add( v[ v.size() - 1 - i ] );
+    }
+
+    BOOST_TEST( l1 == l2 );
+    BOOST_TEST( l1.result() == l2.result() );
+
+    // removing undoes adding
+
+    L l3( l1 );
+
+    l3.add( std::string( "extra" ) );
+    BOOST_TEST( l3 != l1 );
+
+    l3.remove( std::string( "extra" ) );
+    BOOST_TEST( l3 == l1 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        l3.remove( v[ i ] );
+    }
+
+    BOOST_TEST( l3 == L() );
+
+    // multiset semantics
+
+    L l4( l1 );
+    l4.add( v[ 0 ] );
+
+    BOOST_TEST( l4 != l1 );
+
+    // merge
+
+    L l5, l6;
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        ( i % 3 == 0? l5: l6 ).add( v[ i ] );
+    }
+
+    l5.merge( l6 );
+    BOOST_TEST( l5 == l1 );
+
+    l5.clear();
+    BOOST_TEST( l5 == L() );
+
+    // seeds
+
+    L l7( 7 );
+    L l8( 7 );
+    L l9( 8 );
+
+    l7.add( v[ 0 ] );
+    l8.add( v[ 0 ] );
+    l9.add( v[ 0 ] );
+
+    BOOST_TEST( l7 == l8 );
+    BOOST_TEST( l7 != l9 );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test< lthash<> >();
+    test< lthash<blake3, 16> >();
+    test< lthash<shake128, 64> >();
+
+    // the lanes of a single element are its XOF output, as little endian
+    // words; std::uint32_t( 1 ) is appended as 01 00 00 00
+
+    {
+        lthash<shake128, 16> l;
+        l.add( std::uint32_t( 1 ) );
+
+        BOOST_TEST_EQ( to_string( l.result() ), std::string( "6677d6c57f210d7836a5d23f1006602ef8f1033f4147ea0cc5e5e9e1ad799da5" ) );
+    }
+
+    {
+        lthash<blake3, 16> l;
+        l.add( std::uint32_t( 1 ) );
+
+        BOOST_TEST_EQ( to_string( l.result() ), std::string( "c610e85212d0697cb161d4ba431ba603f273feee7dcb7927c9ff5d74ae6cbfa3" ) );
+    }
+
+    {
+        lthash<> l;
+
+        l.add( std::uint32_t( 1 ) );
+        l.add( std::uint32_t( 2 ) );
+
+        lthash<>::result_type r = l.result();
+
+        unsigned char w[ 16 ] = {};
+        std::memcpy( w, r.data() + r.size() - 16, 16 );
+
+        BOOST_TEST_EQ( to_string( digest<16>( w ) ), std::string( "43ed9119e85a2baaa7e5d934ceedcd64" ) );
+    }
+
+    return boost::report_errors();
+}
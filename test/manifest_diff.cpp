@@ -0,0 +1,265 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/manifest_diff.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <map>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+using D = digest<32>;
+
+static D make_digest( std::string const& s )
+{
+    sha2_256 h;
+    h.update( s.data(), s.size() );
+
+    return h.result();
+}
+
+static std::string make_line( std::string const& path, D const& d, bool binary = true )
+{
+    return to_string( d ) + ( binary? " *": "  " ) + path + "\n";
+}
+
+static std::map<std::string, D> to_map( manifest<32> const& m )
+{
+    std::map<std::string, D> r;
+
+    for( std::size_t i = 0; i < m.size(); ++i )
+    {
+        r[ m.path( i ) ] = m.value( i );
+    }
+
+    return r;
+}
+
+static void test_parse()
+{
+    D const d1 = make_digest( "1" );
+    D const d2 = make_digest( "2" );
+
+    std::string s = make_line( "a/b", d1 ) + make_line( "c d", d2, false ) + "\r\n" + "xyz *oops\n" + to_string( d1 ) + " *\n" + to_string( d2 ) + "  last\r\n" + make_line( "no newline", d1 );
+    s.resize( s.size() - 1 );
+
+    manifest<32> m;
+    BOOST_TEST( m.sorted() );
+
+    m.parse( s.data(), s.size() );
+
+    BOOST_TEST_EQ( m.size(), 4u );
+    BOOST_TEST_EQ( m.malformed(), 2u );
+    BOOST_TEST_NOT( m.sorted() );
+
+    BOOST_TEST_EQ( m.path( 0 ), std::string( "a/b" ) );
+    BOOST_TEST_EQ( m.value( 0 ), d1 );
+    BOOST_TEST_EQ( m.path( 1 ), std::string( "c d" ) );
+    BOOST_TEST_EQ( m.value( 1 ), d2 );
+    BOOST_TEST_EQ( m.path( 2 ), std::string( "last" ) );
+    BOOST_TEST_EQ( m.path( 3 ), std::string( "no newline" ) );
+
+    m.sort( 1 );
+    BOOST_TEST( m.sorted() );
+
+    for( std::size_t i = 1; i < m.size(); ++i )
+    {
+        BOOST_TEST_LE( m.key( i - 1 ), m.key( i ) );
+    }
+
+    std::map<std::string, D> r = to_map( m );
+
+    BOOST_TEST_EQ( r.size(), 4u );
+    BOOST_TEST_EQ( r[ "c d" ], d2 );
+    BOOST_TEST_EQ( r[ "no newline" ], d1 );
+}
+
+static void test_diff( std::size_t n, unsigned threads )
+{
+    std::string s1, s2;
+
+    std::map<std::string, D> m1, m2;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        std::string path = "dir" + std::to_string( i % 97 ) + "/file" + std::to_string( i );
+        D d = make_digest( path );
+
+        switch( i % 10 )
+        {
+        case 0: // removed
+
+            s1 += make_line( path, d );
+            m1[ path ] = d;
+            break;
+
+        case 1: // added
+
+            s2 += make_line( path, d );
+            m2[ path ] = d;
+            break;
+
+        case 2: // changed
+        {
+            D d2 = make_digest( path + "'" );
+
+            s1 += make_line( path, d );
+            s2 += make_line( path, d2 );
+
+            m1[ path ] = d;
+            m2[ path ] = d2;
+            break;
+        }
+
+        default:
+
+            s1 += make_line( path, d );
+            s2 += make_line( path, d );
+
+            m1[ path ] = d;
+            m2[ path ] = d;
+        }
+    }
+
+    manifest<32> a, b;
+
+    a.parse( s1.data(), s1.size(), threads );
+    b.parse( s2.data(), s2.size(), threads );
+
+    BOOST_TEST_EQ( a.malformed(), 0u );
+    BOOST_TEST_EQ( b.malformed(), 0u );
+
+    // parsing in parallel gives the same entries
+
+    BOOST_TEST( to_map( a ) == m1 );
+    BOOST_TEST( to_map( b ) == m2 );
+
+    a.sort( threads );
+    b.sort( threads );
+
+    BOOST_TEST( to_map( a ) == m1 );
+
+    for( std::size_t i = 1; i < a.size(); ++i )
+    {
+        BOOST_TEST_LT( a.compare( i - 1, a, i ), 0 );
+    }
+
+    manifest_difference r = manifest_diff( a, b, threads );
+
+    std::size_t added = 0, removed = 0, changed = 0;
+
+    for( auto const& x: m2 )
+    {
+        auto it = m1.find( x.first );
+
+        if( it == m1.end() )
+        {
+            ++added;
+        }
+        else if( it->second != x.second )
+        {
+            ++changed;
+        }
+    }
+
+    for( auto const& x: m1 )
+    {
+        if( m2.find( x.first ) == m2.end() ) ++removed;
+    }
+
+    BOOST_TEST_EQ( r.added.size(), added );
+    BOOST_TEST_EQ( r.removed.size(), removed );
+    BOOST_TEST_EQ( r.changed.size(), changed );
+
+    for( std::size_t j: r.added )
+    {
+        BOOST_TEST( m1.find( b.path( j ) ) == m1.end() );
+    }
+
+    for( std::size_t i: r.removed )
+    {
+        BOOST_TEST( m2.find( a.path( i ) ) == m2.end() );
+    }
+
+    for( auto const& x: r.changed )
+    {
+        BOOST_TEST_EQ( a.path( x.first ), b.path( x.second ) );
+        BOOST_TEST_NE( a.value( x.first ), b.value( x.second ) );
+    }
+
+    // a manifest doesn't differ from itself
+
+    {
+        manifest_difference r2 = manifest_diff( a, a, threads );
+
+        BOOST_TEST( r2.added.empty() );
+        BOOST_TEST( r2.removed.empty() );
+        BOOST_TEST( r2.changed.empty() );
+    }
+
+    // swapping the manifests swaps added and removed
+
+    {
+        manifest_difference r2 = manifest_diff( b, a, threads );
+
+        BOOST_TEST( r2.added == r.removed );
+        BOOST_TEST( r2.removed == r.added );
+        BOOST_TEST_EQ( r2.changed.size(), r.changed.size() );
+    }
+}
+
+static void test_push_back()
+{
+    manifest<32> a, b;
+
+    D const d1 = make_digest( "1" );
+    D const d2 = make_digest( "2" );
+
+    a.push_back( "x", 1, d1 );
+    a.push_back( "y", 1, d1 );
+    a.push_back( "y", 1, d1 );
+
+    b.push_back( "y", 1, d2 );
+    b.push_back( "z", 1, d2 );
+
+    a.sort();
+    b.sort();
+
+    manifest_difference r = manifest_diff( a, b );
+
+    // "y" occurs twice in a, once in b
+
+    BOOST_TEST_EQ( r.added.size(), 1u );
+    BOOST_TEST_EQ( r.removed.size(), 2u );
+    BOOST_TEST_EQ( r.changed.size(), 1u );
+
+    BOOST_TEST_EQ( b.path( r.added[ 0 ] ), std::string( "z" ) );
+
+    a.clear();
+
+    BOOST_TEST( a.empty() );
+    BOOST_TEST( a.sorted() );
+
+    r = manifest_diff( a, b );
+
+    BOOST_TEST_EQ( r.added.size(), 2u );
+    BOOST_TEST( r.removed.empty() );
+    BOOST_TEST( r.changed.empty() );
+}
+
+int main()
+{
+    test_parse();
+    test_push_back();
+
+    test_diff( 0, 1 );
+    test_diff( 1000, 1 );
+    test_diff( 1000, 4 );
+    test_diff( 200000, 4 );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,195 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/mapped_digest_index.hpp>
+#include <boost/config/pragma_message.hpp>
+
+#if !defined(BOOST_HASH2_HAS_POSIX_FILES)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_HASH2_HAS_POSIX_FILES is not defined" )
+int main() {}
+
+#else
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <system_error>
+#include <thread>
+#include <cstdint>
+#include <cstdio>
+
+using namespace boost::hash2;
+
+static char const* const fn = "mapped_digest_index_test.tmp";
+
+static digest<32> key( std::uint64_t i )
+{
+    sha2_256 h;
+    h.update( &i, sizeof( i ) );
+
+    return h.result();
+}
+
+int main()
+{
+    std::remove( fn );
+
+    std::size_t const n = 10000;
+
+    {
+        mapped_digest_index<32, std::uint64_t> ix;
+
+        BOOST_TEST( !ix.is_open() );
+        BOOST_TEST( ix.find( key( 0 ) ) == nullptr );
+
+        std::error_code ec;
+        ix.create( fn, n, ec );
+
+        BOOST_TEST( !ec ) && BOOST_TEST( ix.is_open() ) && BOOST_TEST( ix.is_writable() );
+        BOOST_TEST_GE( ix.capacity(), n );
+        BOOST_TEST_EQ( ix.size(), 0u );
+
+        for( std::size_t i = 0; i < n / 2; ++i )
+        {
+            std::pair<std::uint64_t const*, bool> r = ix.insert( key( i ), i * 7 );
+
+            BOOST_TEST( r.second );
+            BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, i * 7 );
+        }
+
+        BOOST_TEST_EQ( ix.size(), n / 2 );
+
+        // present keys aren't replaced
+
+        {
+            std::pair<std::uint64_t const*, bool> r = ix.insert( key( 1 ), 1000 );
+
+            BOOST_TEST( !r.second );
+            BOOST_TEST( r.first != nullptr ) && BOOST_TEST_EQ( *r.first, 7u );
+        }
+
+        // the file exists, so it isn't created again
+
+        mapped_digest_index<32, std::uint64_t> ix2;
+
+        ix2.create( fn, n, ec );
+        BOOST_TEST( ec );
+
+        // and there can only be one writer
+
+        ix2.open_writable( fn, ec );
+        BOOST_TEST( ec ) && BOOST_TEST( !ix2.is_open() );
+
+        // readers see the entries, and those inserted later
+
+        mapped_digest_index<32, std::uint64_t> rd;
+
+        rd.open( fn, ec );
+
+        BOOST_TEST( !ec ) && BOOST_TEST( rd.is_open() ) && BOOST_TEST( !rd.is_writable() );
+        BOOST_TEST_EQ( rd.size(), n / 2 );
+        BOOST_TEST_EQ( rd.capacity(), ix.capacity() );
+
+        for( std::size_t i = 0; i < n / 2; ++i )
+        {
+            std::uint64_t const* p = rd.find( key( i ) );
+            BOOST_TEST( p != nullptr ) && BOOST_TEST_EQ( *p, i * 7 );
+        }
+
+        BOOST_TEST( !rd.contains( key( n ) ) );
+
+        BOOST_TEST( !rd.insert( key( n ), 0 ).second );
+
+        std::atomic<bool> done( false );
+        std::size_t errors = 0;
+
+        std::thread th( [&]{
+
+            // an entry seen by a reader is complete
+
+            while( !done.load() )
+            {
+                for( std::size_t i = n / 2; i < n; ++i )
+                {
+                    std::uint64_t const* p = rd.find( key( i ) );
+                    if( p && *p != i * 7 ) ++errors;
+                }
+            }
+
+        });
+
+        for( std::size_t i = n / 2; i < n; ++i )
+        {
+            BOOST_TEST( ix.insert( key( i ), i * 7 ).second );
+        }
+
+        done.store( true );
+        th.join();
+
+        BOOST_TEST_EQ( errors, 0u );
+        BOOST_TEST_EQ( rd.size(), n );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            std::uint64_t const* p = rd.find( key( i ) );
+            BOOST_TEST( p != nullptr ) && BOOST_TEST_EQ( *p, i * 7 );
+        }
+
+        ix.flush( ec );
+        BOOST_TEST( !ec );
+    }
+
+    // the index persists, and a new writer can add to it until it's full
+
+    {
+        mapped_digest_index<32, std::uint64_t> ix;
+
+        std::error_code ec;
+        ix.open_writable( fn, ec );
+
+        BOOST_TEST( !ec ) && BOOST_TEST( ix.is_writable() );
+        BOOST_TEST_EQ( ix.size(), n );
+
+        std::size_t i = n;
+
+        while( ix.insert( key( i ), i * 7 ).second ) ++i;
+
+        BOOST_TEST_EQ( ix.size(), ix.capacity() );
+        BOOST_TEST( ix.insert( key( i ), 0 ).first == nullptr );
+
+        for( std::size_t j = 0; j < i; ++j )
+        {
+            std::uint64_t const* p = ix.find( key( j ) );
+            BOOST_TEST( p != nullptr ) && BOOST_TEST_EQ( *p, j * 7 );
+        }
+    }
+
+    // the key and value sizes are checked
+
+    {
+        std::error_code ec;
+
+        mapped_digest_index<20, std::uint64_t> ix1;
+        ix1.open( fn, ec );
+
+        BOOST_TEST( ec == std::errc::invalid_argument );
+
+        mapped_digest_index<32, std::uint32_t> ix2;
+        ix2.open( fn, ec );
+
+        BOOST_TEST( ec == std::errc::invalid_argument );
+
+        mapped_digest_index<32, std::uint64_t> ix3;
+        ix3.open( "mapped_digest_index_test.missing", ec );
+
+        BOOST_TEST( ec ) && BOOST_TEST( !ix3.is_open() );
+    }
+
+    std::remove( fn );
+
+    return boost::report_errors();
+}
+
+#endif
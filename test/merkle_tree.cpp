@@ -0,0 +1,160 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/merkle_tree.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::vector<unsigned char> make_data( std::size_t n, std::uint32_t seed )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint32_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return v;
+}
+
+// MTH from RFC 6962, section 2.1
+
+template<class H> static typename H::result_type mth( std::vector<typename H::result_type> const& leaves, std::size_t first, std::size_t last )
+{
+    std::size_t const n = last - first;
+
+    if( n == 1 ) return leaves[ first ];
+
+    std::size_t k = 1;
+    while( 2 * k < n ) k *= 2;
+
+    typename H::result_type l = mth<H>( leaves, first, first + k );
+    typename H::result_type r = mth<H>( leaves, first + k, last );
+
+    unsigned char const prefix = 0x01;
+
+    H h;
+
+    h.update( &prefix, 1 );
+    h.update( l.data(), l.size() );
+    h.update( r.data(), r.size() );
+
+    return h.result();
+}
+
+template<class H> static void test( std::size_t block_size, std::size_t n, unsigned threads )
+{
+    using T = merkle_tree<H>;
+
+    std::vector<unsigned char> v = make_data( n, 1 );
+
+    T t( block_size );
+    t.build( v.data(), v.size(), threads );
+
+    std::size_t const m = ( n + block_size - 1 ) / block_size;
+
+    BOOST_TEST_EQ( t.leaf_count(), m );
+    BOOST_TEST_EQ( t.block_size(), block_size );
+
+    std::vector<typename H::result_type> leaves;
+
+    for( std::size_t i = 0; i < m; ++i )
+    {
+        std::size_t k = i * block_size;
+        leaves.push_back( T::hash_leaf( v.data() + k, n - k < block_size? n - k: block_size ) );
+
+        BOOST_TEST( t.leaf( i ) == leaves[ i ] );
+    }
+
+    if( m == 0 ) return;
+
+    BOOST_TEST( t.root() == mth<H>( leaves, 0, m ) );
+
+    // assign
+
+    {
+        T t2( block_size );
+        t2.assign( leaves.begin(), leaves.end() );
+
+        BOOST_TEST( t2.root() == t.root() );
+    }
+
+    // proofs
+
+    for( std::size_t i = 0; i < m; ++i )
+    {
+        std::vector<typename H::result_type> p = t.proof( i );
+
+        BOOST_TEST( T::verify( leaves[ i ], i, m, p, t.root() ) );
+
+        if( m > 1 )
+        {
+            BOOST_TEST( !T::verify( leaves[ ( i + 1 ) % m ], i, m, p, t.root() ) );
+        }
+    }
+
+    // incremental update
+
+    for( std::size_t i = 0; i < m; i += 3 )
+    {
+        std::size_t k = i * block_size;
+        std::size_t s = n - k < block_size? n - k: block_size;
+
+        std::vector<unsigned char> w = make_data( s, static_cast<std::uint32_t>( i + 2 ) );
+
+        std::copy( w.begin(), w.end(), v.begin() + k );
+        t.update_block( i, w.data(), w.size() );
+
+        leaves[ i ] = T::hash_leaf( w.data(), w.size() );
+    }
+
+    BOOST_TEST( t.root() == mth<H>( leaves, 0, m ) );
+
+    {
+        T t2( block_size );
+        t2.build( v.data(), v.size(), threads );
+
+        BOOST_TEST( t2.root() == t.root() );
+    }
+}
+
+int main()
+{
+    // RFC 6962 test vectors
+
+    {
+        merkle_tree<sha2_256> t;
+
+        BOOST_TEST_EQ( to_string( t.root() ), std::string( "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" ) );
+
+        t.build( "", 0 );
+        BOOST_TEST_EQ( t.leaf_count(), 0u );
+
+        BOOST_TEST_EQ( to_string( merkle_tree<sha2_256>::hash_leaf( "", 0 ) ), std::string( "6e340b9cffb37a989ca544e6bb780a2c78901d3fb33738768511a30617afa01d" ) );
+    }
+
+    for( unsigned threads: { 1, 3, 0 } )
+    {
+        for( std::size_t n: { 0, 1, 63, 64, 65, 1000, 4096, 5000, 64 * 13 + 5 } )
+        {
+            test<sha2_256>( 64, n, threads );
+            test<sha2_512_256>( 64, n, threads );
+            test<blake3>( 100, n, threads );
+        }
+    }
+
+    test<sha2_256>( 1024 * 1024, 5 * 1024 * 1024 + 17, 0 );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,162 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/minhash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <set>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+// the scalar signature, for comparison with the vectorized one
+
+template<class H, std::size_t K> static void test_scalar( minhash<H, K> const& mh, std::vector<int> const& v, std::uint64_t seed )
+{
+    std::uint32_t a[ K ], b[ K ];
+
+    std::uint64_t x = 0;
+
+    for( std::size_t i = 0; i < K; ++i )
+    {
+        x += 0x9E3779B97F4A7C15ull;
+
+        std::uint64_t z = x;
+
+        z = ( z ^ ( z >> 30 ) ) * 0xBF58476D1CE4E5B9ull;
+        z = ( z ^ ( z >> 27 ) ) * 0x94D049BB133111EBull;
+        z = z ^ ( z >> 31 );
+
+        a[ i ] = static_cast<std::uint32_t>( z ) | 1;
+        b[ i ] = static_cast<std::uint32_t>( z >> 32 );
+    }
+
+    typename minhash<H, K>::signature_type s = minhash<H, K>::empty_signature();
+
+    for( int y: v )
+    {
+        std::uint64_t h = hash<int, H>( seed )( y );
+
+        for( std::size_t i = 0; i < K; ++i )
+        {
+            std::uint32_t r = boost::hash2::detail::minhash_permute( static_cast<std::uint32_t>( h ), static_cast<std::uint32_t>( h >> 32 ), a[ i ], b[ i ] );
+            if( r < s[ i ] ) s[ i ] = r;
+        }
+    }
+
+    BOOST_TEST( mh.signature( v ) == s );
+}
+
+template<class H, std::size_t K> static void test( double tolerance )
+{
+    using M = minhash<H, K>;
+
+    M mh( 7 );
+
+    BOOST_TEST_EQ( mh.size, K );
+
+    // A = [0, 1000), B = [500, 1500); J = 500 / 1500
+
+    std::vector<int> a, b;
+
+    for( int i = 0; i < 1000; ++i )
+    {
+        a.push_back( i );
+        b.push_back( i + 500 );
+    }
+
+    auto sa = mh.signature( a );
+    auto sb = mh.signature( b );
+
+    BOOST_TEST_EQ( M::similarity( sa, sa ), 1.0 );
+    BOOST_TEST_LT( std::abs( M::similarity( sa, sb ) - 1.0 / 3 ), tolerance );
+
+    // order and duplicates don't matter
+
+    {
+        std::vector<int> c( a.rbegin(), a.rend() );
+        c.insert( c.end(), a.begin(), a.begin() + 100 );
+
+        BOOST_TEST( mh.signature( c.begin(), c.end() ) == sa );
+
+        std::set<int> d( a.begin(), a.end() );
+        BOOST_TEST( mh.signature( d ) == sa );
+    }
+
+    // incremental update
+
+    {
+        auto s = M::empty_signature();
+
+        for( int x: a )
+        {
+            mh.update( s, x );
+        }
+
+        BOOST_TEST( s == sa );
+    }
+
+    // merge
+
+    {
+        std::vector<int> c( a );
+        c.insert( c.end(), b.begin(), b.end() );
+
+        BOOST_TEST( M::merge( sa, sb ) == mh.signature( c ) );
+    }
+
+    // disjoint sets
+
+    {
+        std::vector<int> c;
+
+        for( int i = 0; i < 1000; ++i )
+        {
+            c.push_back( i + 10000 );
+        }
+
+        BOOST_TEST_LT( M::similarity( sa, mh.signature( c ) ), tolerance );
+    }
+
+    // different seeds give different signatures
+
+    BOOST_TEST( M( 8 ).signature( a ) != sa );
+
+    test_scalar( mh, a, 7 );
+    test_scalar( mh, b, 7 );
+}
+
+int main()
+{
+    test<xxhash_64, 128>( 0.15 );
+    test<xxh3_128, 256>( 0.1 );
+    test<siphash_64, 61>( 0.2 );
+    test<siphash_64, 3>( 0.7 );
+
+    {
+        minhash<xxhash_64, 64> mh;
+
+        std::vector<std::string> s1{ "the quick", "quick brown", "brown fox", "fox jumps" };
+        std::vector<std::string> s2{ "the quick", "quick brown", "brown fox", "fox jumps" };
+
+        BOOST_TEST( mh.signature( s1 ) == mh.signature( s2 ) );
+
+        std::string const s3[] = { "the quick", "quick brown", "brown fox", "fox jumps" };
+
+        BOOST_TEST( mh.signature( s3 ) == mh.signature( s1 ) );
+    }
+
+    {
+        std::vector<int> v;
+        BOOST_TEST( minhash<xxhash_64>().signature( v ) == minhash<xxhash_64>::empty_signature() );
+    }
+
+    return boost::report_errors();
+}
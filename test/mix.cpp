@@ -0,0 +1,162 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+using boost::hash2::mix32;
+using boost::hash2::mix64;
+
+template<class H> static void test( char const * s, std::uint64_t seed, typename H::result_type r )
+{
+    std::size_t n = std::strlen( s );
+
+    {
+        H h( seed );
+
+        h.update( s, n );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    // byte at a time, and every split point
+
+    {
+        H h( seed );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            h.update( s + i, 1 );
+        }
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    for( std::size_t i = 0; i <= n; ++i )
+    {
+        H h( seed );
+
+        h.update( s, i );
+        h.update( s + i, n - i );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    BOOST_TEST_EQ( H::hash( s, n, seed ), r );
+}
+
+static std::uint32_t fmix32( std::uint32_t h )
+{
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+
+    return h;
+}
+
+static std::uint64_t splitmix64( std::uint64_t h )
+{
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBull;
+    h ^= h >> 31;
+
+    return h;
+}
+
+template<class H> static void test_update_word()
+{
+    // zero padding of the last word doesn't collide
+
+    {
+        unsigned char const v[ 3 ] = { 'a', 'b', 0 };
+        BOOST_TEST_NE( H::hash( v, 2 ), H::hash( v, 3 ) );
+    }
+
+    // update_word is equivalent to update( p, 8 )
+
+    for( std::size_t i = 0; i < 8; ++i )
+    {
+        unsigned char const v[ 16 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01 };
+
+        H h1, h2;
+
+        h1.update( v, i );
+        h2.update( v, i );
+
+        h1.update( v + 8, 8 );
+        h2.update_word( 0x0123456789ABCDEFull );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+}
+
+int main()
+{
+    // reference values
+
+    test<mix32>( "", 0, 0x00000000u );
+    test<mix32>( "a", 0, 0x7e0066a0u );
+    test<mix32>( "abc", 0, 0x980d3fc2u );
+    test<mix32>( "message digest", 0, 0xae3a5e2du );
+    test<mix32>( "abcdefghijklmnopqrstuvwxyz", 0, 0x0a67b955u );
+    test<mix32>( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0, 0x7e55cf58u );
+
+    test<mix32>( "", 7, 0x96f4d176u );
+    test<mix32>( "a", 7, 0x08684d80u );
+    test<mix32>( "abc", 7, 0x52060ad6u );
+    test<mix32>( "message digest", 7, 0xcef3daa1u );
+    test<mix32>( "abcdefghijklmnopqrstuvwxyz", 7, 0x707cd0b1u );
+    test<mix32>( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 7, 0x10329377u );
+
+    test<mix64>( "", 0, 0x0000000000000000ull );
+    test<mix64>( "a", 0, 0x30c804f22438908cull );
+    test<mix64>( "abc", 0, 0x62bcdf981457ea89ull );
+    test<mix64>( "message digest", 0, 0x3682827ba0673817ull );
+    test<mix64>( "abcdefghijklmnopqrstuvwxyz", 0, 0x8b3b6728c9df83b1ull );
+    test<mix64>( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0, 0x71ef397a95507900ull );
+
+    test<mix64>( "", 7, 0xe315fde881443fbcull );
+    test<mix64>( "a", 7, 0xf002d9bb155c883full );
+    test<mix64>( "abc", 7, 0xfe4c678930f84690ull );
+    test<mix64>( "message digest", 7, 0xccbc82badeee9354ull );
+    test<mix64>( "abcdefghijklmnopqrstuvwxyz", 7, 0x492c727548c246dbull );
+    test<mix64>( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 7, 0xb41e9652cb38a80dull );
+
+    test_update_word<mix32>();
+    test_update_word<mix64>();
+
+    // an integer key passed through hash_append is a single
+    // finalizer call, xored with a multiple of its size
+
+    for( std::uint64_t i = 0; i < 64; ++i )
+    {
+        std::uint64_t const w = i * 0x9E3779B97F4A7C15ull;
+
+        {
+            mix64 h;
+            boost::hash2::hash_append( h, {}, w );
+
+            BOOST_TEST_EQ( h.result(), splitmix64( w ) ^ 8 * 0x9E3779B97F4A7C15ull );
+        }
+
+        {
+            std::uint32_t const v = static_cast<std::uint32_t>( w >> 32 );
+
+            mix32 h;
+            boost::hash2::hash_append( h, {}, v );
+
+            BOOST_TEST_EQ( h.result(), fmix32( v ) ^ 4 * 0x9E3779B9u );
+        }
+    }
+
+    return boost::report_errors();
+}
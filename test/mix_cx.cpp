@@ -0,0 +1,66 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/mix.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N );
+
+    return h.result();
+}
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test_hash( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    return H::hash( v, N, seed );
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v1[] = { 0 };
+    constexpr unsigned char v4[] = { 0, 1, 2, 3 };
+    constexpr unsigned char v16[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+    TEST_EQ( test<mix32>( 0, v1 ), 0x9e3779b9u );
+    TEST_EQ( test<mix32>( 0, v4 ), 0x66c9d639u );
+    TEST_EQ( test<mix32>( 0, v16 ), 0x5754f6d0u );
+
+    TEST_EQ( test<mix32>( 7, v1 ), 0x3f152b73u );
+    TEST_EQ( test<mix32>( 7, v4 ), 0xdab19500u );
+    TEST_EQ( test<mix32>( 7, v16 ), 0x9950e462u );
+
+    TEST_EQ( test_hash<mix32>( 0, v16 ), 0x5754f6d0u );
+    TEST_EQ( test_hash<mix32>( 7, v16 ), 0x9950e462u );
+
+    TEST_EQ( test<mix64>( 0, v1 ), 0x9e3779b97f4a7c15ull );
+    TEST_EQ( test<mix64>( 0, v4 ), 0x662d879b0b8998c0ull );
+    TEST_EQ( test<mix64>( 0, v16 ), 0xa7088002f62b2061ull );
+
+    TEST_EQ( test<mix64>( 7, v1 ), 0x3878d8bddfeebb3aull );
+    TEST_EQ( test<mix64>( 7, v4 ), 0x329dead00d0a576bull );
+    TEST_EQ( test<mix64>( 7, v16 ), 0xbca98ee595202291ull );
+
+    TEST_EQ( test_hash<mix64>( 0, v16 ), 0xa7088002f62b2061ull );
+    TEST_EQ( test_hash<mix64>( 7, v16 ), 0xbca98ee595202291ull );
+
+    return boost::report_errors();
+}
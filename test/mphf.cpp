@@ -0,0 +1,198 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/mphf.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <list>
+#include <algorithm>
+#include <iostream>
+#include <cstdint>
+#include <cstddef>
+
+template<class F, class It> void test_keys( F const& f, It first, It last, std::size_t n )
+{
+    BOOST_TEST_EQ( f.size(), n );
+
+    std::vector<char> seen( n );
+
+    for( ; first != last; ++first )
+    {
+        std::size_t i = f( *first );
+
+        if( BOOST_TEST_LT( i, n ) )
+        {
+            seen[ i ] = 1;
+        }
+    }
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST( seen[ i ] ) || ( std::cerr << "slot " << i << " not taken\n", true );
+    }
+}
+
+template<class H> void test_strings( std::size_t n, unsigned threads )
+{
+    std::vector<std::string> v;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v.push_back( "key_" + std::to_string( i ) );
+    }
+
+    boost::hash2::mphf<std::string, H> const f( v.begin(), v.end(), threads );
+
+    test_keys( f, v.begin(), v.end(), n );
+
+    // bits per key, including the headers
+
+    if( n >= 100000 )
+    {
+        BOOST_TEST_LT( f.data_size() * 8.0 / n, 3.0 );
+    }
+
+    // a non-key maps somewhere in [0, n)
+
+    if( n > 0 )
+    {
+        BOOST_TEST_LT( f( "not a key" ), n );
+    }
+
+    // queried in place
+
+    boost::hash2::mphf_view<std::string, H> w;
+
+    BOOST_TEST( w.load( f.data(), f.data_size() ) );
+    BOOST_TEST_EQ( w.size(), n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_EQ( w( v[ i ] ), f( v[ i ] ) );
+    }
+}
+
+template<class H> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 2, 3, 5, 17, 100, 2047, 2048, 2049, 10000, 150000 };
+
+    for( std::size_t n: sizes )
+    {
+        test_strings<H>( n, 1 );
+        test_strings<H>( n, 4 );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_64>();
+    test<xxhash_64>();
+    test<siphash_64>();
+
+    // the same function on one thread and on several
+
+    {
+        std::vector<std::uint64_t> v;
+
+        for( std::uint64_t i = 0; i < 50000; ++i )
+        {
+            v.push_back( i * 0x9E3779B97F4A7C15ull );
+        }
+
+        mphf<std::uint64_t, xxhash_64> const f1( v.begin(), v.end(), 1 );
+        mphf<std::uint64_t, xxhash_64> const f2( v.begin(), v.end(), 8 );
+
+        BOOST_TEST_EQ( f1.data_size(), f2.data_size() );
+        BOOST_TEST( std::equal( f1.data(), f1.data() + f1.data_size(), f2.data() ) );
+
+        test_keys( f1, v.begin(), v.end(), v.size() );
+    }
+
+    // keys from a non-random access range
+
+    {
+        std::list<int> v;
+
+        for( int i = 0; i < 5000; ++i )
+        {
+            v.push_back( i * 3 );
+        }
+
+        mphf<int, fnv1a_64> const f( v.begin(), v.end() );
+        test_keys( f, v.begin(), v.end(), v.size() );
+    }
+
+    // repeated keys are counted once
+
+    {
+        std::vector<int> v;
+
+        for( int i = 0; i < 3000; ++i )
+        {
+            v.push_back( i % 1000 );
+        }
+
+        mphf<int, fnv1a_64> const f( v.begin(), v.end() );
+        test_keys( f, v.begin(), v.begin() + 1000, 1000 );
+
+        BOOST_TEST_LT( f( 5 ), 1000u );
+    }
+
+    // copies
+
+    {
+        std::vector<std::string> v = { "alpha", "beta", "gamma", "delta" };
+
+        mphf<std::string, siphash_64> f( v.begin(), v.end() );
+        mphf<std::string, siphash_64> f2( f );
+
+        std::size_t const i = f( "gamma" );
+
+        f = mphf<std::string, siphash_64>( v.begin(), v.begin() + 1 );
+
+        BOOST_TEST_EQ( f2( "gamma" ), i );
+        BOOST_TEST_EQ( f( "alpha" ), 0u );
+    }
+
+    // invalid serialized forms are rejected
+
+    {
+        std::vector<int> v;
+
+        for( int i = 0; i < 10000; ++i )
+        {
+            v.push_back( i );
+        }
+
+        mphf<int, fnv1a_64> const f( v.begin(), v.end() );
+        std::vector<unsigned char> d( f.data(), f.data() + f.data_size() );
+
+        mphf_view<int, fnv1a_64> w;
+
+        BOOST_TEST( w.load( d.data(), d.size() ) );
+
+        BOOST_TEST( !w.load( d.data(), d.size() - 1 ) );
+        BOOST_TEST( !w.load( d.data(), 16 ) );
+
+        for( std::size_t i: { 0, 8, 24, 32, 40, 48, 56 } )
+        {
+            std::vector<unsigned char> d2( d );
+            d2[ i ] ^= 1;
+
+            BOOST_TEST( !w.load( d2.data(), d2.size() ) );
+        }
+
+        // a failed load leaves the view as it was
+
+        test_keys( w, v.begin(), v.end(), v.size() );
+    }
+
+    return boost::report_errors();
+}
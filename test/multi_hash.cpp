@@ -0,0 +1,204 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/multi_hash.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/crc32.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <tuple>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+using M = multi_hash<md5_128, sha1_160, sha2_256, xxhash_64, fnv1a_32>;
+
+static std::vector<unsigned char> make_data( std::size_t n )
+{
+    std::vector<unsigned char> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    return v;
+}
+
+template<class H> static void update( H& h, std::vector<unsigned char> const& v, std::size_t step )
+{
+    for( std::size_t i = 0; i < v.size(); i += step )
+    {
+        std::size_t n = v.size() - i < step? v.size() - i: step;
+        h.update( v.data() + i, n );
+    }
+}
+
+template<class H, std::size_t I> static void check( M::result_type const& r, H h )
+{
+    BOOST_TEST( std::get<I>( r ) == h.result() );
+}
+
+static void check( M::result_type const& r, md5_128 h1, sha1_160 h2, sha2_256 h3, xxhash_64 h4, fnv1a_32 h5 )
+{
+    check<md5_128, 0>( r, h1 );
+    check<sha1_160, 1>( r, h2 );
+    check<sha2_256, 2>( r, h3 );
+    check<xxhash_64, 3>( r, h4 );
+    check<fnv1a_32, 4>( r, h5 );
+}
+
+static void test( std::size_t n, std::size_t step )
+{
+    std::vector<unsigned char> v = make_data( n );
+
+    {
+        M m;
+        update( m, v, step );
+
+        md5_128 h1;
+        sha1_160 h2;
+        sha2_256 h3;
+        xxhash_64 h4;
+        fnv1a_32 h5;
+
+        update( h1, v, n + 1 );
+        update( h2, v, n + 1 );
+        update( h3, v, n + 1 );
+        update( h4, v, n + 1 );
+        update( h5, v, n + 1 );
+
+        check( m.result(), h1, h2, h3, h4, h5 );
+
+        // result can be called repeatedly, as for the members
+
+        h1.result();
+        h2.result();
+        h3.result();
+        h4.result();
+        h5.result();
+
+        check( m.result(), h1, h2, h3, h4, h5 );
+    }
+
+    {
+        M m( 7 );
+        update( m, v, step );
+
+        md5_128 h1( 7 );
+        sha1_160 h2( 7 );
+        sha2_256 h3( 7 );
+        xxhash_64 h4( 7 );
+        fnv1a_32 h5( 7 );
+
+        update( h1, v, n + 1 );
+        update( h2, v, n + 1 );
+        update( h3, v, n + 1 );
+        update( h4, v, n + 1 );
+        update( h5, v, n + 1 );
+
+        check( m.result(), h1, h2, h3, h4, h5 );
+    }
+
+    {
+        unsigned char const seed[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+        M m( seed, sizeof( seed ) );
+        update( m, v, step );
+
+        md5_128 h1( seed, sizeof( seed ) );
+        sha1_160 h2( seed, sizeof( seed ) );
+        sha2_256 h3( seed, sizeof( seed ) );
+        xxhash_64 h4( seed, sizeof( seed ) );
+        fnv1a_32 h5( seed, sizeof( seed ) );
+
+        update( h1, v, n + 1 );
+        update( h2, v, n + 1 );
+        update( h3, v, n + 1 );
+        update( h4, v, n + 1 );
+        update( h5, v, n + 1 );
+
+        check( m.result(), h1, h2, h3, h4, h5 );
+    }
+}
+
+int main()
+{
+    BOOST_TEST_TRAIT_SAME( M::result_type, std::tuple<md5_128::result_type, sha1_160::result_type, sha2_256::result_type, xxhash_64::result_type, fnv1a_32::result_type> );
+
+    std::size_t const sizes[] = { 0, 1, 63, 64, 65, 16383, 16384, 16385, 100000 };
+    std::size_t const steps[] = { 1, 7, 64, 1000, 16384, 1000000 };
+
+    for( std::size_t n: sizes )
+    {
+        for( std::size_t step: steps )
+        {
+            if( step == 1 && n > 20000 ) continue;
+            test( n, step );
+        }
+    }
+
+    // hash_append
+
+    {
+        std::string const s( "multi_hash" );
+
+        M m;
+        hash_append( m, {}, s );
+
+        sha2_256 h;
+        hash_append( h, {}, s );
+
+        BOOST_TEST( std::get<2>( m.result() ) == h.result() );
+    }
+
+    // hashers
+
+    {
+        M m;
+        m.update( "abc", 3 );
+
+        sha1_160 h( std::get<1>( m.hashers() ) );
+
+        sha1_160 h2;
+        h2.update( "abc", 3 );
+
+        BOOST_TEST( h.result() == h2.result() );
+    }
+
+    // the checksums of an archive format, in one pass
+
+    {
+        std::vector<unsigned char> v = make_data( 100000 );
+
+        multi_hash<crc32, crc64_xz, adler32> m;
+        update( m, v, 1000 );
+
+        crc32 h1;
+        crc64_xz h2;
+        adler32 h3;
+
+        update( h1, v, v.size() );
+        update( h2, v, v.size() );
+        update( h3, v, v.size() );
+
+        auto r = m.result();
+
+        BOOST_TEST_EQ( std::get<0>( r ), h1.result() );
+        BOOST_TEST_EQ( std::get<1>( r ), h2.result() );
+        BOOST_TEST_EQ( std::get<2>( r ), h3.result() );
+    }
+
+    return boost::report_errors();
+}
@@ -4,11 +4,28 @@
 
 #include <boost/hash2/fnv1a.hpp>
 #include <boost/hash2/siphash.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/ghash.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/highwayhash.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
 #include <boost/hash2/sha2.hpp>
 #include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/crc32.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/hash2/adler32.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <algorithm>
 #include <cstddef>
@@ -94,10 +111,31 @@ int main()
 {
     test<boost::hash2::fnv1a_32>();
     test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::fnv1a_64_wide>();
+    test<boost::hash2::tabulation_64>();
+    test<boost::hash2::mix32>();
+    test<boost::hash2::mix64>();
+    test<boost::hash2::polymur_64>();
+    test<boost::hash2::poly1305>();
+    test<boost::hash2::ghash>();
     test<boost::hash2::xxhash_32>();
     test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxh3_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::rapidhash_64>();
+    test<boost::hash2::aes_hash_128>();
+    test<boost::hash2::highwayhash_64>();
+    test<boost::hash2::highwayhash_128>();
+    test<boost::hash2::highwayhash_256>();
     test<boost::hash2::siphash_32>();
     test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_32>();
+    test<boost::hash2::siphash13_64>();
+    test<boost::hash2::crc32c>();
+    test<boost::hash2::crc32>();
+    test<boost::hash2::crc64_xz>();
+    test<boost::hash2::crc64_nvme>();
+    test<boost::hash2::adler32>();
 
     test<boost::hash2::md5_128>();
     test<boost::hash2::sha1_160>();
@@ -109,6 +147,16 @@ int main()
     test<boost::hash2::sha2_512_256>();
     test<boost::hash2::ripemd_160>();
     test<boost::hash2::ripemd_128>();
+    test<boost::hash2::blake2b_512>();
+    test<boost::hash2::blake2s_256>();
+    test<boost::hash2::blake3>();
+    test<boost::hash2::sha3_256>();
+    test<boost::hash2::sha3_224>();
+    test<boost::hash2::sha3_512>();
+    test<boost::hash2::sha3_384>();
+    test<boost::hash2::shake128>();
+    test<boost::hash2::shake256>();
+    test<boost::hash2::k12>();
 
     test<boost::hash2::hmac_md5_128>();
     test<boost::hash2::hmac_sha1_160>();
@@ -120,6 +168,12 @@ int main()
     test<boost::hash2::hmac_sha2_512_256>();
     test<boost::hash2::hmac_ripemd_160>();
     test<boost::hash2::hmac_ripemd_128>();
+    test<boost::hash2::hmac_blake2b_512>();
+    test<boost::hash2::hmac_blake2s_256>();
+    test<boost::hash2::hmac_sha3_256>();
+    test<boost::hash2::hmac_sha3_224>();
+    test<boost::hash2::hmac_sha3_512>();
+    test<boost::hash2::hmac_sha3_384>();
 
     return boost::report_errors();
 }
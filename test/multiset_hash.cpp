@@ -0,0 +1,137 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/multiset_hash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <string>
+#include <vector>
+
+struct sip_flavor: boost::hash2::default_flavor
+{
+    using unordered_element_hash = boost::hash2::siphash_64;
+};
+
+struct xx_big_flavor: boost::hash2::big_endian_flavor
+{
+    using unordered_element_hash = boost::hash2::xxhash_64;
+};
+
+// the result of a copy of h after hash_append( h, f, s )
+
+template<class Hash, class Flavor, class S> typename Hash::result_type container_result( Hash h, S const& s )
+{
+    hash_append( h, Flavor(), s );
+    return h.result();
+}
+
+template<class Hash, class Flavor> void test()
+{
+    using boost::hash2::multiset_hash;
+
+    std::vector<std::string> v;
+
+    for( int i = 0; i < 97; ++i )
+    {
+        v.push_back( std::to_string( i * 7919 ) );
+    }
+
+    // same as hash_append of an unordered_multiset, as elements come and go
+
+    {
+        Hash h0( 7 );
+        h0.update( "prefix", 6 );
+
+        multiset_hash<Hash, Flavor> ms( h0 );
+        std::unordered_multiset<std::string> s;
+
+        BOOST_TEST( ms.result() == (container_result<Hash, Flavor>( h0, s )) );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            ms.add( v[ i ] );
+            s.insert( v[ i ] );
+
+            if( i % 3 == 0 )
+            {
+                ms.add( v[ i / 2 ] );
+                s.insert( v[ i / 2 ] );
+            }
+
+            if( i % 5 == 4 )
+            {
+                ms.remove( v[ i - 2 ] );
+                s.erase( s.find( v[ i - 2 ] ) );
+            }
+
+            BOOST_TEST_EQ( ms.size(), s.size() );
+            BOOST_TEST( ms.result() == (container_result<Hash, Flavor>( h0, s )) );
+        }
+
+        Hash h1( h0 );
+        ms.append_to( h1 );
+
+        Hash h2( h0 );
+        boost::hash2::hash_append_unordered_range( h2, Flavor(), s.begin(), s.end() );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    // seeded constructors
+
+    {
+        std::unordered_set<std::string> s( v.begin(), v.end() );
+
+        multiset_hash<Hash, Flavor> ms1( 11 );
+        multiset_hash<Hash, Flavor> ms2( reinterpret_cast<unsigned char const*>( "0123456789abcdef" ), 16 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            ms1.add( v[ i ] );
+            ms2.add( v[ i ] );
+        }
+
+        BOOST_TEST( ms1.result() == (container_result<Hash, Flavor>( Hash( 11 ), s )) );
+        BOOST_TEST( ms2.result() == (container_result<Hash, Flavor>( Hash( reinterpret_cast<unsigned char const*>( "0123456789abcdef" ), 16 ), s )) );
+    }
+
+    // merge, comparison, clear
+
+    {
+        multiset_hash<Hash, Flavor> ms1, ms2, ms3;
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            ms1.add( v[ i ] );
+            ( i % 2 == 0? ms2: ms3 ).add( v[ v.size() - 1 - i ] );
+        }
+
+        BOOST_TEST( ms1 != ms2 );
+
+        ms2.merge( ms3 );
+
+        BOOST_TEST( ms1 == ms2 );
+        BOOST_TEST_EQ( ms1.sum(), ms2.sum() );
+        BOOST_TEST( ms1.result() == ms2.result() );
+
+        ms1.clear();
+
+        BOOST_TEST_EQ( ms1.size(), 0u );
+        BOOST_TEST( ms1 == (multiset_hash<Hash, Flavor>()) );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_64, boost::hash2::default_flavor>();
+    test<boost::hash2::siphash_64, boost::hash2::default_flavor>();
+    test<boost::hash2::sha2_256, sip_flavor>();
+    test<boost::hash2::sha2_256, xx_big_flavor>();
+
+    return boost::report_errors();
+}
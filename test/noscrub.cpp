@@ -0,0 +1,93 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/buffered_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+// The _noscrub variants produce the same results as the
+// scrubbing ones, including for repeated calls to result()
+
+template<class H1, class H2> void test( std::size_t n, std::size_t k )
+{
+    unsigned char buffer[ 1024 ] = {};
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+    }
+
+    {
+        H1 h1;
+        H2 h2;
+
+        for( std::size_t i = 0; i < n; i += k )
+        {
+            std::size_t m = n - i < k? n - i: k;
+
+            h1.update( buffer + i, m );
+            h2.update( buffer + i, m );
+        }
+
+        for( int j = 0; j < 3; ++j )
+        {
+            BOOST_TEST( h1.result() == h2.result() );
+        }
+
+        h1.update( buffer, n );
+        h2.update( buffer, n );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        H1 h1( 7 );
+        H2 h2( 7 );
+
+        h1.update( buffer, n );
+        h2.update( buffer, n );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+
+    {
+        H1 h1( buffer, n );
+        H2 h2( buffer, n );
+
+        h1.update( buffer, n );
+        h2.update( buffer, n );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+}
+
+template<class H1, class H2> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 3, 4, 15, 16, 17, 31, 32, 33, 64, 129, 240, 241, 255, 256, 257, 511, 1024 };
+    std::size_t const steps[] = { 1, 5, 64, 1024 };
+
+    for( std::size_t n: sizes )
+    {
+        for( std::size_t k: steps )
+        {
+            test<H1, H2>( n, k );
+        }
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<xxhash_32, xxhash_32_noscrub>();
+    test<xxhash_64, xxhash_64_noscrub>();
+    test<xxh3_64, xxh3_64_noscrub>();
+    test<xxh3_128, xxh3_128_noscrub>();
+
+    test< buffered_hash<xxhash_64>, buffered_hash<xxhash_64_noscrub, 64, false> >();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,87 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+
+static unsigned char buffer[ 300 ];
+
+template<class H> void test_seeded( std::uint64_t seed )
+{
+    for( std::size_t i = 0; i < 300; ++i )
+    {
+        // vary the alignment of the input as well as its length
+
+        for( std::size_t j = 0; j < 8 && i + j <= 300; j += 3 )
+        {
+            H h( seed );
+            h.update( buffer + j, i );
+
+            typename H::result_type r = h.result();
+
+            BOOST_TEST_EQ( H::hash( buffer + j, i, seed ), r );
+            BOOST_TEST_EQ( H::hash( static_cast<void const*>( buffer + j ), i, seed ), r );
+        }
+    }
+}
+
+template<class H> void test_seeded()
+{
+    BOOST_TEST_EQ( H::hash( buffer, 0 ), H().result() );
+    BOOST_TEST_EQ( H::hash( buffer, 17 ), H::hash( buffer, 17, 0 ) );
+
+    test_seeded<H>( 0 );
+    test_seeded<H>( 7 );
+    test_seeded<H>( 0xFFFFFFFFu );
+    test_seeded<H>( 0x0123456789ABCDEFull );
+}
+
+template<class H, std::size_t N> void test_keyed()
+{
+    unsigned char key[ N ] = {};
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i * 17 + 5 );
+    }
+
+    for( std::size_t i = 0; i < 300; ++i )
+    {
+        for( std::size_t j = 0; j < 8 && i + j <= 300; j += 3 )
+        {
+            H h( key, N );
+            h.update( buffer + j, i );
+
+            typename H::result_type r = h.result();
+
+            BOOST_TEST_EQ( H::hash( key, buffer + j, i ), r );
+            BOOST_TEST_EQ( H::hash( key, static_cast<void const*>( buffer + j ), i ), r );
+        }
+    }
+}
+
+int main()
+{
+    for( int i = 0; i < 300; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    test_seeded<boost::hash2::fnv1a_32>();
+    test_seeded<boost::hash2::fnv1a_64>();
+    test_seeded<boost::hash2::fnv1a_64_wide>();
+    test_seeded<boost::hash2::xxhash_32>();
+    test_seeded<boost::hash2::xxhash_64>();
+
+    test_keyed<boost::hash2::siphash_32, 8>();
+    test_keyed<boost::hash2::siphash_64, 16>();
+    test_keyed<boost::hash2::siphash13_32, 8>();
+    test_keyed<boost::hash2::siphash13_64, 16>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,79 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(disable: 4307) // integral constant overflow
+#endif
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N );
+
+    return h.result();
+}
+
+template<class H, std::size_t K, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( unsigned char const (&key)[ K ], unsigned char const (&v)[ N ] )
+{
+    H h( key, K );
+
+    h.update( v, N );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char k8[ 8 ] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+    constexpr unsigned char k16[ 16 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16 };
+
+    constexpr unsigned char v3[ 3 ] = { 1, 2, 3 };
+    constexpr unsigned char v21[ 21 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21 };
+    constexpr unsigned char v45[ 45 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21 };
+
+    TEST_EQ( fnv1a_32::hash( v21, 21, 7 ), test<fnv1a_32>( 7, v21 ) );
+    TEST_EQ( fnv1a_64::hash( v21, 21, 7 ), test<fnv1a_64>( 7, v21 ) );
+    TEST_EQ( fnv1a_64_wide::hash( v21, 21, 7 ), test<fnv1a_64_wide>( 7, v21 ) );
+
+    TEST_EQ( xxhash_32::hash( v3, 3, 7 ), test<xxhash_32>( 7, v3 ) );
+    TEST_EQ( xxhash_32::hash( v21, 21, 7 ), test<xxhash_32>( 7, v21 ) );
+    TEST_EQ( xxhash_32::hash( v45, 45, 7 ), test<xxhash_32>( 7, v45 ) );
+
+    TEST_EQ( xxhash_64::hash( v3, 3, 7 ), test<xxhash_64>( 7, v3 ) );
+    TEST_EQ( xxhash_64::hash( v21, 21, 7 ), test<xxhash_64>( 7, v21 ) );
+    TEST_EQ( xxhash_64::hash( v45, 45, 7 ), test<xxhash_64>( 7, v45 ) );
+
+    TEST_EQ( siphash_32::hash( k8, v3, 3 ), test<siphash_32>( k8, v3 ) );
+    TEST_EQ( siphash_32::hash( k8, v21, 21 ), test<siphash_32>( k8, v21 ) );
+    TEST_EQ( siphash_32::hash( k8, v45, 45 ), test<siphash_32>( k8, v45 ) );
+
+    TEST_EQ( siphash_64::hash( k16, v3, 3 ), test<siphash_64>( k16, v3 ) );
+    TEST_EQ( siphash_64::hash( k16, v21, 21 ), test<siphash_64>( k16, v21 ) );
+    TEST_EQ( siphash_64::hash( k16, v45, 45 ), test<siphash_64>( k16, v45 ) );
+
+    TEST_EQ( siphash13_64::hash( k16, v21, 21 ), test<siphash13_64>( k16, v21 ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,73 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/parallel_hash.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+#include <vector>
+#include <cstddef>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+STATIC_ASSERT( boost::hash2::has_update_parallel<boost::hash2::crc32c>::value );
+STATIC_ASSERT( boost::hash2::has_update_parallel<boost::hash2::blake3>::value );
+STATIC_ASSERT( boost::hash2::has_update_parallel<boost::hash2::k12>::value );
+
+STATIC_ASSERT( !boost::hash2::has_update_parallel<boost::hash2::sha2_256>::value );
+STATIC_ASSERT( !boost::hash2::has_update_parallel<boost::hash2::xxh3_128>::value );
+STATIC_ASSERT( !boost::hash2::has_update_parallel<boost::hash2::fnv1a_64>::value );
+
+#if defined(BOOST_NO_CXX17_HDR_EXECUTION)
+
+BOOST_PRAGMA_MESSAGE( "Skipping parallel_hash tests, because BOOST_NO_CXX17_HDR_EXECUTION is defined" )
+int main() {}
+
+#else
+
+#include <execution>
+
+template<class H> void test( std::vector<unsigned char> const& v, std::uint64_t seed )
+{
+    H h( seed );
+    h.update( v.data(), v.size() );
+
+    typename H::result_type const r = h.result();
+
+    BOOST_TEST( boost::hash2::parallel_hash<H>( std::execution::seq, v.data(), v.size(), seed ) == r );
+    BOOST_TEST( boost::hash2::parallel_hash<H>( std::execution::par, v.data(), v.size(), seed ) == r );
+    BOOST_TEST( boost::hash2::parallel_hash<H>( std::execution::par_unseq, v.data(), v.size(), seed ) == r );
+}
+
+int main()
+{
+    // large enough to be split by all three parallel algorithms
+
+    std::vector<unsigned char> v( 3 * 1024 * 1024 + 11 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 31 + ( i >> 9 ) );
+    }
+
+    for( std::uint64_t seed: { 0, 7 } )
+    {
+        test<boost::hash2::crc32c>( v, seed );
+        test<boost::hash2::blake3>( v, seed );
+        test<boost::hash2::k12>( v, seed );
+
+        test<boost::hash2::sha2_256>( v, seed );
+        test<boost::hash2::xxh3_128>( v, seed );
+    }
+
+    return boost::report_errors();
+}
+
+#endif
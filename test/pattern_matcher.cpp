@@ -0,0 +1,137 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/pattern_matcher.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <map>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+// text over a four letter alphabet, so that short patterns occur
+
+static std::string make_text( std::size_t n, std::uint32_t seed )
+{
+    std::string s( n, 0 );
+
+    std::uint32_t x = seed;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        s[ i ] = "acgt"[ x >> 30 ];
+    }
+
+    return s;
+}
+
+static std::vector<pattern_match> brute_force( std::map<std::string, std::size_t> const& m, std::string const& s, std::size_t w )
+{
+    std::vector<pattern_match> r;
+
+    for( std::size_t i = 0; i + w <= s.size(); ++i )
+    {
+        auto it = m.find( s.substr( i, w ) );
+
+        if( it != m.end() )
+        {
+            pattern_match x = { i, it->second };
+            r.push_back( x );
+        }
+    }
+
+    return r;
+}
+
+template<class R> static void test( std::size_t w, std::size_t k, std::size_t n, unsigned threads )
+{
+    pattern_matcher<R> pm( w, 7 );
+
+    BOOST_TEST_EQ( pm.length(), w );
+    BOOST_TEST( pm.empty() );
+
+    std::map<std::string, std::size_t> m;
+
+    std::string const patterns = make_text( k * w, 0x1234 );
+
+    for( std::size_t i = 0; i < k; ++i )
+    {
+        std::string const s = patterns.substr( i * w, w );
+
+        std::size_t const j = pm.add( s.data(), s.size() );
+
+        auto r = m.insert( { s, j } );
+
+        // an equal pattern gets the index of the first
+
+        BOOST_TEST_EQ( j, r.first->second );
+        BOOST_TEST_EQ( std::string( reinterpret_cast<char const*>( pm.pattern( j ) ), w ), s );
+    }
+
+    BOOST_TEST_EQ( pm.size(), m.size() );
+
+    std::string const text = make_text( n, 0x5678 );
+
+    std::vector<pattern_match> const r0 = brute_force( m, text, w );
+
+    {
+        std::vector<pattern_match> r;
+
+        pm.search( text.data(), text.size(), [&]( std::size_t offset, std::size_t pattern ){
+
+            pattern_match x = { offset, pattern };
+            r.push_back( x );
+        });
+
+        BOOST_TEST( r == r0 );
+    }
+
+    {
+        std::vector<pattern_match> r = pm.find_all( text.data(), text.size(), threads );
+
+        BOOST_TEST_EQ( r.size(), r0.size() );
+        BOOST_TEST( r == r0 );
+    }
+}
+
+int main()
+{
+    // nothing to find
+
+    {
+        pattern_matcher<> pm( 4 );
+
+        BOOST_TEST( pm.find_all( "abcdefgh", 8 ).empty() );
+
+        pm.add( "efgh", 4 );
+
+        BOOST_TEST( pm.find_all( "efg", 3 ).empty() );
+        BOOST_TEST_EQ( pm.find_all( "efgh", 4 ).size(), 1u );
+        BOOST_TEST_EQ( pm.find_all( "abcdefghefgh", 12 ).size(), 2u );
+    }
+
+    for( std::size_t w: { 1, 3, 8, 12, 32 } )
+    {
+        for( std::size_t n: { 0, 1, 7, 100, 1000, 70000 } )
+        {
+            test<rabin_karp_64>( w, 50, n, 1 );
+            test<buzhash_64>( w, 50, n, 1 );
+        }
+    }
+
+    // enough patterns to grow the table several times
+
+    test<rabin_karp_64>( 8, 20000, 300000, 1 );
+    test<rabin_karp_64>( 12, 20000, 300000, 1 );
+
+    // enough text to be split between threads, and to span blocks
+
+    test<rabin_karp_64>( 10, 1000, 3 * 1024 * 1024 + 17, 4 );
+    test<buzhash_64>( 16, 1000, 3 * 1024 * 1024 + 17, 4 );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,67 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/pbkdf2.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+template<class H> std::string pbkdf2( std::string const& p, std::string const& s, std::size_t iterations, std::size_t n )
+{
+    std::vector<unsigned char> out( n );
+    boost::hash2::pbkdf2<H>( p.data(), p.size(), s.data(), s.size(), iterations, out.data(), n );
+
+    char const* digits = "0123456789abcdef";
+
+    std::string r;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        r += digits[ out[ i ] >> 4 ];
+        r += digits[ out[ i ] & 0x0F ];
+    }
+
+    return r;
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // https://tools.ietf.org/html/rfc6070
+
+    BOOST_TEST_EQ( pbkdf2<sha1_160>( "password", "salt", 1, 20 ), std::string( "0c60c80f961f0e71f3a9b524af6012062fe037a6" ) );
+    BOOST_TEST_EQ( pbkdf2<sha1_160>( "password", "salt", 4096, 20 ), std::string( "4b007901b765489abead49d926f721d065a429c1" ) );
+    BOOST_TEST_EQ( pbkdf2<sha1_160>( "passwordPASSWORDpassword", "saltSALTsaltSALTsaltSALTsaltSALTsalt", 4096, 25 ), std::string( "3d2eec4fe41c849b80c8d83662c0e44a8b291a964cf2f07038" ) );
+    BOOST_TEST_EQ( pbkdf2<sha1_160>( std::string( "pass\0word", 9 ), std::string( "sa\0lt", 5 ), 4096, 16 ), std::string( "56fa6aa75548099dcc37d7f03425e0c3" ) );
+
+    // https://tools.ietf.org/html/rfc7914#section-11
+
+    BOOST_TEST_EQ( pbkdf2<sha2_256>( "passwd", "salt", 1, 64 ), std::string( "55ac046e56e3089fec1691c22544b605f94185216dde0465e68b9d57c20dacbc49ca9cccf179b645991664b39d77ef317c71b845b1e30bd509112041d3a19783" ) );
+    BOOST_TEST_EQ( pbkdf2<sha2_256>( "Password", "NaCl", 80000, 64 ), std::string( "4ddcd8f60b98be21830cee5ef22701f9641a4418d04c0414aeff08876b34ab56a1d425a1225833549adb841b51c9b3176a272bdebba1d078478f62b397f33c8d" ) );
+
+    BOOST_TEST_EQ( pbkdf2<sha2_256>( std::string( "pass\0word", 9 ), std::string( "sa\0lt", 5 ), 4096, 16 ), std::string( "89b69d0516f829893c696226650a8687" ) );
+
+    // derived keys of several blocks; those of SHA-256 are computed
+    // in multi-buffer groups of eight and two blocks
+
+    BOOST_TEST_EQ( pbkdf2<sha2_256>( "password", "salt", 3, 300 ), std::string( "ad35240ac683febfaf3cd49d845473fbbbaa2437f5f82d5a415ae00ac76c6bfccf9a9b8d6d2fe4a1e700c4460b040dbed692c1cb85a747f35588c08930fcfc41ac48082086069b111a9c752f1856237f3af8adc86757f26c60870d3eb52a7c2060c3749b9d56ebb7047cc886f41cdc195fa5c45eec2079a3fa5e0b814ed6a7ae922281bd2fb3ce593f8a30472255f2dc9044149bc9b7cc060371793775734361ee66353e89992c62aee73021c168708a4d94581963aaba85c9a83cadc7828ee1b143eb3c3b11c72f68372369396f02e64ff1b872a432b5444052a32c79542aab949c9ba94c7b42199947772ad4678388701e2efc2789307d7ed7157b54920bebac9c177b4c4bf6919c429b0690f778465a01ad05888dcda2614a98c856715e4fc4c37b34cc08b60ef234a783" ) );
+    BOOST_TEST_EQ( pbkdf2<sha2_512>( "password", "salt", 3, 150 ), std::string( "b6b07cb2cebf4ad84468391a543824fccffe0e0769dbe6bddf10a65673c4b648e612d44918f9ce9a19a1294cf5140628084ba994c3b21a4ef4741220b811c633cfc0641fccbcc4164f1bbfcb1f33f595ae9aa4a33ddcce570157775980362c0ee28aa340c842a3ae84710167aea2f9ba34833cbf66a8922e5f165d886868fd3fd426f9ba2a82a5e97ef8eda7d02d982ff13f1a96f0ea" ) );
+
+    // prefixes of a long derived key
+
+    {
+        std::string const r = pbkdf2<sha2_256>( "password", "salt", 3, 300 );
+
+        for( std::size_t n = 0; n <= 300; n += 13 )
+        {
+            BOOST_TEST_EQ( pbkdf2<sha2_256>( "password", "salt", 3, n ), r.substr( 0, 2 * n ) );
+        }
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,148 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/perfect_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+# include <string_view>
+#endif
+
+template<class H> void test_methods()
+{
+    auto const ph = boost::hash2::make_perfect_hash<H>({ "GET", "PUT", "POST", "DELETE", "HEAD", "OPTIONS", "PATCH", "TRACE", "CONNECT" });
+
+    BOOST_TEST_EQ( ph.size(), 9u );
+
+    BOOST_TEST_EQ( ph.find( "GET" ), 0u );
+    BOOST_TEST_EQ( ph.find( "PUT" ), 1u );
+    BOOST_TEST_EQ( ph.find( "POST" ), 2u );
+    BOOST_TEST_EQ( ph.find( "DELETE" ), 3u );
+    BOOST_TEST_EQ( ph.find( "HEAD" ), 4u );
+    BOOST_TEST_EQ( ph.find( "OPTIONS" ), 5u );
+    BOOST_TEST_EQ( ph.find( "PATCH" ), 6u );
+    BOOST_TEST_EQ( ph.find( "TRACE" ), 7u );
+    BOOST_TEST_EQ( ph.find( "CONNECT" ), 8u );
+
+    BOOST_TEST_EQ( ph.find( std::string( "PATCH" ) ), 6u );
+    BOOST_TEST_EQ( ph.find( "POSTX", 4 ), 2u );
+
+    BOOST_TEST_EQ( ph.find( "" ), ph.npos );
+    BOOST_TEST_EQ( ph.find( "get" ), ph.npos );
+    BOOST_TEST_EQ( ph.find( "GE" ), ph.npos );
+    BOOST_TEST_EQ( ph.find( "GETS" ), ph.npos );
+    BOOST_TEST_EQ( ph.find( "POSTX" ), ph.npos );
+}
+
+template<class H, std::size_t N> void test_words()
+{
+    std::vector<std::string> w;
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        w.push_back( "keyword_" + std::to_string( i * 7919 % 100003 ) );
+    }
+
+    std::vector<char const*> p;
+    std::vector<std::size_t> n;
+
+    for( std::string const& s: w )
+    {
+        p.push_back( s.data() );
+        n.push_back( s.size() );
+    }
+
+    boost::hash2::perfect_hash<H, N> const ph( p.data(), n.data() );
+
+    for( std::size_t i = 0; i < N; ++i )
+    {
+        BOOST_TEST_EQ( ph.find( w[ i ] ), i );
+        BOOST_TEST_EQ( ph.find( w[ i ] + "!" ), ph.npos );
+    }
+
+    BOOST_TEST_EQ( ph.find( "keyword_" ), ph.npos );
+}
+
+template<class H> void test()
+{
+    test_methods<H>();
+
+    test_words<H, 1>();
+    test_words<H, 2>();
+    test_words<H, 3>();
+    test_words<H, 17>();
+    test_words<H, 256>();
+    test_words<H, 1031>();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_64>();
+    test<siphash_64>();
+    test<sha2_256>();
+
+    // no keys
+
+    {
+        perfect_hash<fnv1a_64, 0> const ph( nullptr, nullptr );
+
+        BOOST_TEST_EQ( ph.size(), 0u );
+        BOOST_TEST_EQ( ph.find( "" ), ph.npos );
+        BOOST_TEST_EQ( ph.find( "x" ), ph.npos );
+    }
+
+    // the empty string as a key
+
+    {
+        auto const ph = make_perfect_hash<fnv1a_64>({ "", "x", "xx" });
+
+        BOOST_TEST_EQ( ph.find( "" ), 0u );
+        BOOST_TEST_EQ( ph.find( "x" ), 1u );
+        BOOST_TEST_EQ( ph.find( "xx" ), 2u );
+        BOOST_TEST_EQ( ph.find( "xxx" ), ph.npos );
+    }
+
+    // a repeated key keeps its first index
+
+    {
+        auto const ph = make_perfect_hash<fnv1a_64>({ "a", "b", "a", "c", "b" });
+
+        BOOST_TEST_EQ( ph.find( "a" ), 0u );
+        BOOST_TEST_EQ( ph.find( "b" ), 1u );
+        BOOST_TEST_EQ( ph.find( "c" ), 3u );
+        BOOST_TEST_EQ( ph.find( "d" ), ph.npos );
+    }
+
+#if !defined(BOOST_NO_CXX17_HDR_STRING_VIEW)
+
+    {
+        using namespace std::string_view_literals;
+
+        std::array<std::string_view, 4> const keys = { "alpha"sv, "beta"sv, "gamma"sv, "del\0ta"sv };
+
+        auto const ph = make_perfect_hash<xxhash_64>( keys );
+
+        BOOST_TEST_EQ( ph.find( "alpha"sv ), 0u );
+        BOOST_TEST_EQ( ph.find( "beta"sv ), 1u );
+        BOOST_TEST_EQ( ph.find( "gamma"sv ), 2u );
+        BOOST_TEST_EQ( ph.find( "del\0ta"sv ), 3u );
+        BOOST_TEST_EQ( ph.find( "del"sv ), ph.npos );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,60 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/perfect_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(disable: 4307) // integral constant overflow
+#endif
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+template<class H> BOOST_CXX14_CONSTEXPR boost::hash2::perfect_hash<H, 12> keywords()
+{
+    return boost::hash2::make_perfect_hash<H>({
+        "if", "else", "for", "while", "do", "switch", "case", "default", "break", "continue", "return", "goto"
+    });
+}
+
+template<class H> BOOST_CXX14_CONSTEXPR std::size_t test( char const* s )
+{
+    return keywords<H>().find( s );
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    TEST_EQ( test<fnv1a_32>( "if" ), 0u );
+    TEST_EQ( test<fnv1a_32>( "goto" ), 11u );
+    TEST_EQ( test<fnv1a_32>( "then" ), keywords<fnv1a_32>().npos );
+
+    TEST_EQ( test<fnv1a_64>( "while" ), 3u );
+    TEST_EQ( test<fnv1a_64>( "default" ), 7u );
+    TEST_EQ( test<fnv1a_64>( "defaults" ), keywords<fnv1a_64>().npos );
+
+    TEST_EQ( test<xxhash_64>( "switch" ), 5u );
+    TEST_EQ( test<xxhash_64>( "continue" ), 9u );
+    TEST_EQ( test<xxhash_64>( "" ), keywords<xxhash_64>().npos );
+
+    TEST_EQ( test<sha2_256>( "return" ), 10u );
+    TEST_EQ( test<sha2_256>( "Return" ), keywords<sha2_256>().npos );
+
+    return boost::report_errors();
+}
@@ -5,10 +5,20 @@
 #include <boost/hash2/fnv1a.hpp>
 #include <boost/hash2/siphash.hpp>
 #include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/highwayhash.hpp>
 #include <boost/hash2/md5.hpp>
 #include <boost/hash2/sha1.hpp>
 #include <boost/hash2/sha2.hpp>
 #include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/buffered_hash.hpp>
 #include <boost/core/lightweight_test.hpp>
 #include <algorithm>
 #include <cstddef>
@@ -56,14 +66,54 @@ template<class H> void test()
     }
 }
 
+// The _noscrub variants retain the buffered plaintext
+
+template<class H> void test_retained()
+{
+    char const * s = "xxxx";
+
+    {
+        H h;
+
+        h.update( s, 4 );
+
+        h.result();
+
+        unsigned char const * p = reinterpret_cast<unsigned char const*>( &h );
+        std::size_t n = sizeof( h );
+
+        BOOST_TEST_NE( std::search( p, p + n, s, s + 4 ) - p, n );
+    }
+
+    {
+        H h( reinterpret_cast<unsigned char const*>( s ), 4 );
+
+        unsigned char const * p = reinterpret_cast<unsigned char const*>( &h );
+        std::size_t n = sizeof( h );
+
+        BOOST_TEST_NE( std::search( p, p + n, s, s + 4 ) - p, n );
+    }
+}
+
 int main()
 {
     test<boost::hash2::fnv1a_32>();
     test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::fnv1a_64_wide>();
     test<boost::hash2::xxhash_32>();
     test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxh3_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::rapidhash_64>();
+    test<boost::hash2::aes_hash_128>();
+    test<boost::hash2::highwayhash_64>();
+    test<boost::hash2::highwayhash_128>();
+    test<boost::hash2::highwayhash_256>();
     test<boost::hash2::siphash_32>();
     test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_32>();
+    test<boost::hash2::siphash13_64>();
+    test<boost::hash2::crc32c>();
 
     test<boost::hash2::md5_128>();
     test<boost::hash2::sha1_160>();
@@ -75,6 +125,16 @@ int main()
     test<boost::hash2::sha2_512_256>();
     test<boost::hash2::ripemd_160>();
     test<boost::hash2::ripemd_128>();
+    test<boost::hash2::blake2b_512>();
+    test<boost::hash2::blake2s_256>();
+    test<boost::hash2::blake3>();
+    test<boost::hash2::sha3_256>();
+    test<boost::hash2::sha3_224>();
+    test<boost::hash2::sha3_512>();
+    test<boost::hash2::sha3_384>();
+    test<boost::hash2::shake128>();
+    test<boost::hash2::shake256>();
+    test<boost::hash2::k12>();
 
     test<boost::hash2::hmac_md5_128>();
     test<boost::hash2::hmac_sha1_160>();
@@ -86,6 +146,20 @@ int main()
     test<boost::hash2::hmac_sha2_512_256>();
     test<boost::hash2::hmac_ripemd_160>();
     test<boost::hash2::hmac_ripemd_128>();
+    test<boost::hash2::hmac_blake2b_512>();
+    test<boost::hash2::hmac_blake2s_256>();
+    test<boost::hash2::hmac_sha3_256>();
+    test<boost::hash2::hmac_sha3_224>();
+    test<boost::hash2::hmac_sha3_512>();
+    test<boost::hash2::hmac_sha3_384>();
+
+    test< boost::hash2::buffered_hash<boost::hash2::xxhash_64> >();
+    test< boost::hash2::buffered_hash<boost::hash2::siphash_64, 64> >();
+    test< boost::hash2::buffered_hash<boost::hash2::sha2_256> >();
+
+    test_retained<boost::hash2::xxhash_32_noscrub>();
+    test_retained<boost::hash2::xxhash_64_noscrub>();
+    test_retained< boost::hash2::buffered_hash<boost::hash2::xxhash_64_noscrub, 64, false> >();
 
     return boost::report_errors();
 }
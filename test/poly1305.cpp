@@ -0,0 +1,175 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+using boost::hash2::poly1305;
+
+static std::string tag( unsigned char const* key, void const* p, std::size_t n )
+{
+    poly1305 h( key, 32 );
+    h.update( p, n );
+
+    return to_string( h.result() );
+}
+
+static std::string tag( char const* s )
+{
+    poly1305 h;
+    h.update( s, std::strlen( s ) );
+
+    return to_string( h.result() );
+}
+
+// r = x, s = 0 or all ones
+
+static std::string tag( unsigned x, bool s, unsigned char const* p, std::size_t n )
+{
+    unsigned char key[ 32 ] = { static_cast<unsigned char>( x ) };
+
+    if( s )
+    {
+        std::memset( key + 16, 0xFF, 16 );
+    }
+
+    return tag( key, p, n );
+}
+
+static void test_incremental( unsigned char const* p, std::size_t n )
+{
+    unsigned char key[ 32 ];
+
+    for( int i = 0; i < 32; ++i )
+    {
+        key[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+    }
+
+    for( std::size_t m = 0; m <= n; m += m < 80? 1: 37 )
+    {
+        std::string const r = tag( key, p, m );
+
+        for( std::size_t k = 1; k < 80; k += 7 )
+        {
+            poly1305 h( key, 32 );
+
+            std::size_t i = 0;
+
+            for( ; i + k <= m; i += k )
+            {
+                h.update( p + i, k );
+            }
+
+            h.update( p + i, m - i );
+
+            BOOST_TEST_EQ( to_string( h.result() ), r );
+        }
+    }
+}
+
+int main()
+{
+    // RFC 8439, section 2.5.2; this is also the default key
+
+    {
+        unsigned char const key[ 32 ] =
+        {
+            0x85, 0xd6, 0xbe, 0x78, 0x57, 0x55, 0x6d, 0x33, 0x7f, 0x44, 0x52, 0xfe, 0x42, 0xd5, 0x06, 0xa8,
+            0x01, 0x03, 0x80, 0x8a, 0xfb, 0x0d, 0xb2, 0xfd, 0x4a, 0xbf, 0xf6, 0xaf, 0x41, 0x49, 0xf5, 0x1b,
+        };
+
+        char const* msg = "Cryptographic Forum Research Group";
+
+        BOOST_TEST_EQ( tag( key, msg, std::strlen( msg ) ), std::string( "a8061dc1305136c6c22b8baf0c0127a9" ) );
+        BOOST_TEST_EQ( tag( msg ), std::string( "a8061dc1305136c6c22b8baf0c0127a9" ) );
+    }
+
+    // RFC 8439, appendix A.3, the vectors that exercise the final reduction
+
+    {
+        unsigned char m[ 48 ];
+
+        std::memset( m, 0xFF, 16 );
+        BOOST_TEST_EQ( tag( 2, false, m, 16 ), std::string( "03000000000000000000000000000000" ) );
+
+        std::memset( m, 0, 16 ); m[ 0 ] = 2;
+        BOOST_TEST_EQ( tag( 2, true, m, 16 ), std::string( "03000000000000000000000000000000" ) );
+
+        std::memset( m, 0xFF, 32 ); m[ 16 ] = 0xF0;
+        std::memset( m + 32, 0, 16 ); m[ 32 ] = 0x11;
+        BOOST_TEST_EQ( tag( 1, false, m, 48 ), std::string( "05000000000000000000000000000000" ) );
+
+        std::memset( m, 0xFF, 16 );
+        std::memset( m + 16, 0xFE, 16 ); m[ 16 ] = 0xFB;
+        std::memset( m + 32, 0x01, 16 );
+        BOOST_TEST_EQ( tag( 1, false, m, 48 ), std::string( "00000000000000000000000000000000" ) );
+
+        std::memset( m, 0xFF, 16 ); m[ 0 ] = 0xFD;
+        BOOST_TEST_EQ( tag( 2, false, m, 16 ), std::string( "faffffffffffffffffffffffffffffff" ) );
+    }
+
+    // reference values
+
+    BOOST_TEST_EQ( tag( "" ), std::string( "0103808afb0db2fd4abff6af4149f51b" ) );
+    BOOST_TEST_EQ( tag( "a" ), std::string( "70d0a599dbb674b74b2e676f9556612d" ) );
+    BOOST_TEST_EQ( tag( "abc" ), std::string( "15236b63cfae517835ec52931778027c" ) );
+    BOOST_TEST_EQ( tag( "message digest" ), std::string( "f14833e412bd3d83474d78943ee8b5bf" ) );
+    BOOST_TEST_EQ( tag( "abcdefghijklmnopqrstuvwxyz" ), std::string( "505ee5616a02d63fcdfa5e58acd56b51" ) );
+    BOOST_TEST_EQ( tag( "12345678901234567890123456789012345678901234567890123456789012345678901234567890" ), std::string( "97c1178ff1233ab795f687ee07745414" ) );
+
+    {
+        std::vector<unsigned char> v( 4096 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+        }
+
+        std::size_t const n[] = { 64, 255, 256, 1024, 4096 };
+
+        char const* const r[] =
+        {
+            "cf75236c3458e27ee2abd611d0d672b7",
+            "26f3a685414a74691ab404918e6a61a2",
+            "a8e25cc793f59118c906ef82119963ae",
+            "186415488f5d636c96b443ef181b3b67",
+            "1bffd16d5f8f2118a63799a010c55350",
+        };
+
+        for( int i = 0; i < 5; ++i )
+        {
+            poly1305 h;
+            h.update( v.data(), n[ i ] );
+
+            BOOST_TEST_EQ( to_string( h.result() ), std::string( r[ i ] ) );
+        }
+
+        test_incremental( v.data(), 600 );
+    }
+
+    // the integer seed is a prefix of the message
+
+    {
+        poly1305 h1( 7 ), h2;
+
+        unsigned char const seed[ 8 ] = { 7 };
+        h2.update( seed, 8 );
+
+        h1.update( "abc", 3 );
+        h2.update( "abc", 3 );
+
+        std::string const r = to_string( h1.result() );
+
+        BOOST_TEST_EQ( r, to_string( h2.result() ) );
+        BOOST_TEST_EQ( r, std::string( "c618eb23d3ddbf4dc7be21edd5bec4ce" ) );
+    }
+
+    return boost::report_errors();
+}
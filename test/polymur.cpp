@@ -0,0 +1,156 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/polymur.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+using boost::hash2::polymur_64;
+
+static void test( char const * s, std::uint64_t seed, std::uint64_t r )
+{
+    std::size_t n = std::strlen( s );
+
+    {
+        polymur_64 h( seed );
+
+        h.update( s, n );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    // byte at a time, and every split point
+
+    {
+        polymur_64 h( seed );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            h.update( s + i, 1 );
+        }
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    for( std::size_t i = 0; i <= n; ++i )
+    {
+        polymur_64 h( seed );
+
+        h.update( s, i );
+        h.update( s + i, n - i );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    BOOST_TEST_EQ( polymur_64::hash( s, n, seed ), r );
+}
+
+static void test_long( std::size_t n, std::uint64_t seed, std::uint64_t r )
+{
+    std::vector<unsigned char> v( n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+    }
+
+    BOOST_TEST_EQ( polymur_64::hash( v.data(), n, seed ), r );
+
+    // across the block boundaries, at offsets that don't divide 49
+
+    for( std::size_t k = 1; k < 64; k += 5 )
+    {
+        polymur_64 h( seed );
+
+        for( std::size_t i = 0; i < n; i += k )
+        {
+            h.update( v.data() + i, n - i < k? n - i: k );
+        }
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+}
+
+int main()
+{
+    // reference values
+
+    test( "", 0, 0x7ed8458a06e5deb6ull );
+    test( "a", 0, 0x0fa2f345c5c804d4ull );
+    test( "abc", 0, 0x2c25a02cb5ae2f5cull );
+    test( "message digest", 0, 0xa72fb1c9c5f0cf71ull );
+    test( "abcdefghijklmnopqrstuvwxyz", 0, 0xb6157457a0546074ull );
+    test( "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 0, 0xf4f0227c78e98538ull );
+    test( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0, 0xca86b535609eb12aull );
+
+    test( "", 7, 0xe02c97c98df0b18bull );
+    test( "a", 7, 0x94e8e6dcab6c4a9cull );
+    test( "abc", 7, 0x9c5611bfc9289349ull );
+    test( "message digest", 7, 0x09ec8bb90d27fd03ull );
+    test( "abcdefghijklmnopqrstuvwxyz", 7, 0x5b8da32f49adb0a5ull );
+    test( "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", 7, 0x27bef2589dd538f4ull );
+    test( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 7, 0x0f3056a8828a8adbull );
+
+    test( "", 0xFFFFFFFFFFFFFFFFull, 0xf088d03d1aacd7edull );
+    test( "a", 0xFFFFFFFFFFFFFFFFull, 0x545a1f22e4c19d62ull );
+    test( "abc", 0xFFFFFFFFFFFFFFFFull, 0xc130655177c8e2bdull );
+    test( "message digest", 0xFFFFFFFFFFFFFFFFull, 0x4b8bf249aeec3aa6ull );
+
+    test_long( 48, 0, 0x574314ca5ab85dddull );
+    test_long( 49, 0, 0x84ac82649abe6fd1ull );
+    test_long( 50, 0, 0x8ac43e4e77b48d4aull );
+    test_long( 97, 0, 0x0ccfa81482671a0cull );
+    test_long( 98, 0, 0xa2d84ae7c861e4d5ull );
+    test_long( 1024, 0, 0x9d188d3fa9f2b0abull );
+
+    test_long( 48, 7, 0xcc87b21bd7521077ull );
+    test_long( 49, 7, 0x95103468629ab876ull );
+    test_long( 50, 7, 0x3eb48ff55f2a0974ull );
+    test_long( 97, 7, 0xf4f1d745fa04d66dull );
+    test_long( 98, 7, 0xfdea43fa42914b8full );
+    test_long( 1024, 7, 0xbfd37f90f761b874ull );
+
+    // the default constructor is equivalent to seed 0
+
+    {
+        polymur_64 h1, h2( 0 );
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // a 16 byte seed gives the two keys directly
+
+    {
+        unsigned char const key[ 16 ] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+        polymur_64 h( key, 16 );
+
+        h.update( "abc", 3 );
+        BOOST_TEST_EQ( h.result(), 0x5ed68600b833f126ull );
+    }
+
+    // other byte seeds rekey, rather than prefix the message
+
+    {
+        unsigned char const key[ 3 ] = { 'a', 'b', 'c' };
+
+        polymur_64 h1( key, 3 ), h2( key, 3 ), h3;
+
+        h3.update( key, 3 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+        BOOST_TEST_NE( h1.result(), h3.result() );
+    }
+
+    // zero padding of the last limb doesn't collide
+
+    {
+        unsigned char const v[ 3 ] = { 'a', 'b', 0 };
+        BOOST_TEST_NE( polymur_64::hash( v, 2 ), polymur_64::hash( v, 3 ) );
+    }
+
+    return boost::report_errors();
+}
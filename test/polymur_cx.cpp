@@ -0,0 +1,75 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/polymur.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N );
+
+    return h.result();
+}
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( unsigned char const (&k)[ 16 ], unsigned char const (&v)[ N ] )
+{
+    H h( k, 16 );
+
+    h.update( v, N );
+
+    return h.result();
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR std::uint64_t test_hash( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    return boost::hash2::polymur_64::hash( v, N, seed );
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v1[] = { 0 };
+    constexpr unsigned char v4[] = { 0, 1, 2, 3 };
+    constexpr unsigned char v16[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    constexpr unsigned char v64[] =
+    {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+        48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+    };
+
+    TEST_EQ( test<polymur_64>( 0, v1 ), 0xaed5adbde1cdf7b3ull );
+    TEST_EQ( test<polymur_64>( 0, v4 ), 0x0338d26fc6531778ull );
+    TEST_EQ( test<polymur_64>( 0, v16 ), 0xb91f15fa280d862dull );
+    TEST_EQ( test<polymur_64>( 0, v64 ), 0x0b262966a816ca53ull );
+
+    TEST_EQ( test<polymur_64>( 7, v1 ), 0x968e40f8d487da53ull );
+    TEST_EQ( test<polymur_64>( 7, v4 ), 0xb8ac6d670f2bf473ull );
+    TEST_EQ( test<polymur_64>( 7, v16 ), 0x020b56ad4b456afeull );
+    TEST_EQ( test<polymur_64>( 7, v64 ), 0x45ffb81c03cf69cdull );
+
+    TEST_EQ( test<polymur_64>( v16, v16 ), 0xb857930f691c030dull );
+
+    TEST_EQ( test_hash( 0, v64 ), 0x0b262966a816ca53ull );
+    TEST_EQ( test_hash( 7, v64 ), 0x45ffb81c03cf69cdull );
+
+    return boost::report_errors();
+}
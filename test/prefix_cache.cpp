@@ -0,0 +1,114 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/prefix_cache.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+static unsigned char buffer[ 4096 ];
+
+// get( p, n ) followed by update( q, m ) is the same as hashing p, then q
+
+template<class H> void test( boost::hash2::prefix_cache<H>& c, H const& h0 )
+{
+    std::size_t const prefixes[][ 2 ] = { { 0, 1024 }, { 7, 1024 }, { 0, 1024 }, { 0, 0 }, { 100, 63 }, { 0, 1023 }, { 7, 1024 }, { 100, 63 }, { 0, 0 } };
+
+    for( std::size_t i = 0; i < sizeof( prefixes ) / sizeof( prefixes[0] ); ++i )
+    {
+        unsigned char const* p = buffer + prefixes[ i ][ 0 ];
+        std::size_t n = prefixes[ i ][ 1 ];
+
+        for( std::size_t m = 0; m < 200; m += 37 )
+        {
+            H h = c.get( p, n );
+            h.update( buffer + 2048, m );
+
+            H h2( h0 );
+            h2.update( p, n );
+            h2.update( buffer + 2048, m );
+
+            BOOST_TEST( h.result() == h2.result() );
+        }
+
+        BOOST_TEST( c.contains( p, n ) );
+    }
+}
+
+int main()
+{
+    for( std::size_t i = 0; i < sizeof( buffer ); ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    using namespace boost::hash2;
+
+    {
+        prefix_cache<sha2_256> c;
+        test( c, sha2_256() );
+
+        BOOST_TEST_EQ( c.size(), 5u );
+    }
+
+    {
+        prefix_cache<md5_128> c( 2 );
+        test( c, md5_128() );
+
+        BOOST_TEST_EQ( c.size(), 2u );
+        BOOST_TEST_EQ( c.capacity(), 2u );
+    }
+
+    {
+        prefix_cache<ripemd_160> c( 1 );
+        test( c, ripemd_160() );
+
+        BOOST_TEST_EQ( c.size(), 1u );
+    }
+
+    {
+        prefix_cache<fnv1a_64> c( fnv1a_64( 7 ), 3 );
+        test( c, fnv1a_64( 7 ) );
+    }
+
+    // seeded
+
+    {
+        unsigned char const key[] = { 1, 2, 3, 4, 5 };
+
+        hmac_sha2_256 h0( key, sizeof( key ) );
+
+        prefix_cache<hmac_sha2_256> c( h0 );
+        test( c, h0 );
+    }
+
+    // least recently used eviction
+
+    {
+        prefix_cache<sha2_256> c( 2 );
+
+        c.get( buffer, 100 );
+        c.get( buffer, 200 );
+        c.get( buffer, 100 );
+        c.get( buffer, 300 );
+
+        BOOST_TEST( c.contains( buffer, 100 ) );
+        BOOST_TEST( !c.contains( buffer, 200 ) );
+        BOOST_TEST( c.contains( buffer, 300 ) );
+
+        // same length, different bytes
+
+        BOOST_TEST( !c.contains( buffer + 1, 100 ) );
+
+        c.clear();
+
+        BOOST_TEST_EQ( c.size(), 0u );
+        BOOST_TEST( !c.contains( buffer, 100 ) );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,98 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/random_seed.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+
+using namespace boost::hash2;
+
+template<class H> static void test()
+{
+    digest<32> const& s = random_seed_bytes();
+
+    randomly_seeded<H> h1;
+    H h2( s.data(), s.size() );
+
+    h1.update( "abc", 3 );
+    h2.update( "abc", 3 );
+
+    BOOST_TEST( h1.result() == h2.result() );
+
+    // the other constructors are those of H
+
+    randomly_seeded<H> h3( 7 );
+    H h4( 7 );
+
+    BOOST_TEST( h3.result() == h4.result() );
+
+    randomly_seeded<H> h5( s.data(), 5 );
+    H h6( s.data(), 5 );
+
+    BOOST_TEST( h5.result() == h6.result() );
+}
+
+int main()
+{
+    digest<32> const& s = random_seed_bytes();
+
+    // the same object, with the same value, on each call
+
+    BOOST_TEST_EQ( &random_seed_bytes(), &s );
+    BOOST_TEST_EQ( random_seed(), detail::read64le( s.data() ) );
+
+    {
+        int zero = 0;
+
+        for( std::size_t i = 0; i < s.size(); ++i )
+        {
+            zero += s[ i ] == 0;
+        }
+
+        // 32 zero bytes out of 32 has probability 2^-256
+
+        BOOST_TEST_LT( zero, 32 );
+    }
+
+    // and in other threads
+
+    {
+        std::vector<std::thread> th;
+        std::uint64_t r[ 4 ] = {};
+
+        for( int i = 0; i < 4; ++i )
+        {
+            th.emplace_back( [&r, i]{ r[ i ] = random_seed(); } );
+        }
+
+        for( auto& x: th ) x.join();
+
+        for( int i = 0; i < 4; ++i )
+        {
+            BOOST_TEST_EQ( r[ i ], random_seed() );
+        }
+    }
+
+    test<siphash_64>();
+    test<xxhash_64>();
+
+    {
+        std::unordered_set< std::string, boost::hash2::hash< std::string, randomly_seeded<siphash_64> > > st;
+
+        st.insert( "a" );
+        st.insert( "b" );
+
+        BOOST_TEST_EQ( st.count( "a" ), 1u );
+        BOOST_TEST_EQ( st.count( "c" ), 0u );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,303 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// rapidhash_withSeed, transcribed from the reference implementation,
+// https://github.com/Nicoshev/rapidhash/blob/master/rapidhash.h
+
+static std::uint64_t const rapid_secret[ 3 ] = { 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull };
+
+static void rapid_mum( std::uint64_t* A, std::uint64_t* B )
+{
+    std::uint64_t ha = *A >> 32, hb = *B >> 32, la = static_cast<std::uint32_t>( *A ), lb = static_cast<std::uint32_t>( *B ), hi, lo;
+    std::uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + ( rm0 << 32 ), c = t < rl;
+    lo = t + ( rm1 << 32 );
+    c += lo < t;
+    hi = rh + ( rm0 >> 32 ) + ( rm1 >> 32 ) + c;
+    *A = lo;
+    *B = hi;
+}
+
+static std::uint64_t rapid_mix( std::uint64_t A, std::uint64_t B )
+{
+    rapid_mum( &A, &B );
+    return A ^ B;
+}
+
+static std::uint64_t rapid_read64( unsigned char const* p )
+{
+    std::uint64_t v = 0;
+
+    for( int i = 7; i >= 0; --i )
+    {
+        v = v << 8 | p[ i ];
+    }
+
+    return v;
+}
+
+static std::uint64_t rapid_read32( unsigned char const* p )
+{
+    std::uint64_t v = 0;
+
+    for( int i = 3; i >= 0; --i )
+    {
+        v = v << 8 | p[ i ];
+    }
+
+    return v;
+}
+
+static std::uint64_t rapid_readSmall( unsigned char const* p, std::size_t k )
+{
+    return ( static_cast<std::uint64_t>( p[ 0 ] ) << 56 ) | ( static_cast<std::uint64_t>( p[ k >> 1 ] ) << 32 ) | p[ k - 1 ];
+}
+
+static std::uint64_t rapidhash_internal( unsigned char const* p, std::size_t len, std::uint64_t seed, std::uint64_t const* secret )
+{
+    seed ^= rapid_mix( seed ^ secret[ 0 ], secret[ 1 ] ) ^ len;
+
+    std::uint64_t a, b;
+
+    if( len <= 16 )
+    {
+        if( len >= 4 )
+        {
+            unsigned char const* plast = p + len - 4;
+            a = ( rapid_read32( p ) << 32 ) | rapid_read32( plast );
+            std::uint64_t const delta = ( ( len & 24 ) >> ( len >> 3 ) );
+            b = ( ( rapid_read32( p + delta ) << 32 ) | rapid_read32( plast - delta ) );
+        }
+        else if( len > 0 )
+        {
+            a = rapid_readSmall( p, len );
+            b = 0;
+        }
+        else
+        {
+            a = b = 0;
+        }
+    }
+    else
+    {
+        std::size_t i = len;
+
+        if( i > 48 )
+        {
+            std::uint64_t see1 = seed, see2 = seed;
+
+            while( i >= 96 )
+            {
+                seed = rapid_mix( rapid_read64( p ) ^ secret[ 0 ], rapid_read64( p + 8 ) ^ seed );
+                see1 = rapid_mix( rapid_read64( p + 16 ) ^ secret[ 1 ], rapid_read64( p + 24 ) ^ see1 );
+                see2 = rapid_mix( rapid_read64( p + 32 ) ^ secret[ 2 ], rapid_read64( p + 40 ) ^ see2 );
+                seed = rapid_mix( rapid_read64( p + 48 ) ^ secret[ 0 ], rapid_read64( p + 56 ) ^ seed );
+                see1 = rapid_mix( rapid_read64( p + 64 ) ^ secret[ 1 ], rapid_read64( p + 72 ) ^ see1 );
+                see2 = rapid_mix( rapid_read64( p + 80 ) ^ secret[ 2 ], rapid_read64( p + 88 ) ^ see2 );
+                p += 96;
+                i -= 96;
+            }
+
+            if( i >= 48 )
+            {
+                seed = rapid_mix( rapid_read64( p ) ^ secret[ 0 ], rapid_read64( p + 8 ) ^ seed );
+                see1 = rapid_mix( rapid_read64( p + 16 ) ^ secret[ 1 ], rapid_read64( p + 24 ) ^ see1 );
+                see2 = rapid_mix( rapid_read64( p + 32 ) ^ secret[ 2 ], rapid_read64( p + 40 ) ^ see2 );
+                p += 48;
+                i -= 48;
+            }
+
+            seed ^= see1 ^ see2;
+        }
+
+        if( i > 16 )
+        {
+            seed = rapid_mix( rapid_read64( p ) ^ secret[ 2 ], rapid_read64( p + 8 ) ^ seed ^ secret[ 1 ] );
+
+            if( i > 32 )
+            {
+                seed = rapid_mix( rapid_read64( p + 16 ) ^ secret[ 2 ], rapid_read64( p + 24 ) ^ seed );
+            }
+        }
+
+        a = rapid_read64( p + i - 16 );
+        b = rapid_read64( p + i - 8 );
+    }
+
+    a ^= secret[ 1 ];
+    b ^= seed;
+
+    rapid_mum( &a, &b );
+
+    return rapid_mix( a ^ secret[ 0 ] ^ len, b ^ secret[ 1 ] );
+}
+
+static std::uint64_t rapidhash_withSeed( unsigned char const* p, std::size_t len, std::uint64_t seed )
+{
+    return rapidhash_internal( p, len, seed, rapid_secret );
+}
+
+int main()
+{
+    using boost::hash2::rapidhash_64;
+
+    unsigned char buffer[ 1024 ];
+
+    for( int i = 0; i < 1024; ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    std::uint64_t const seeds[] = { 0, 1, 7, 0xbdd89aa982704029ull, 0xFFFFFFFFFFFFFFFFull };
+
+    // up to 112 bytes, the same as rapidhash_withSeed
+
+    for( std::uint64_t seed: seeds )
+    {
+        for( std::size_t n = 0; n <= 112; ++n )
+        {
+            std::uint64_t const r = rapidhash_withSeed( buffer, n, seed );
+
+            {
+                rapidhash_64 h( seed );
+                h.update( buffer, n );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            BOOST_TEST_EQ( rapidhash_64::hash( buffer, n, seed ), r );
+            BOOST_TEST_EQ( rapidhash_64::hash( static_cast<void const*>( buffer ), n, seed ), r );
+        }
+    }
+
+    // the default seed is 0
+
+    {
+        rapidhash_64 h1;
+        rapidhash_64 h2( 0 );
+
+        h1.update( buffer, 17 );
+        h2.update( buffer, 17 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // incremental updates, across the blocks, are equivalent to a single one
+
+    for( std::uint64_t seed: seeds )
+    {
+        for( std::size_t n = 0; n <= 400; ++n )
+        {
+            std::uint64_t const r = rapidhash_64::hash( buffer, n, seed );
+
+            {
+                rapidhash_64 h( seed );
+                h.update( buffer, n );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            for( std::size_t k = 1; k < 100; k += 7 )
+            {
+                rapidhash_64 h( seed );
+
+                std::size_t i = 0;
+
+                for( ; i + k <= n; i += k )
+                {
+                    h.update( buffer + i, k );
+                }
+
+                h.update( buffer + i, n - i );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+
+            {
+                rapidhash_64 h( seed );
+
+                h.update( buffer, n / 3 );
+                h.update( static_cast<void const*>( buffer + n / 3 ), n - n / 3 );
+
+                BOOST_TEST_EQ( h.result(), r );
+            }
+        }
+    }
+
+    // inputs longer than 112 bytes differ from rapidhash_withSeed only
+    // in not mixing their length into the initial seed
+
+    {
+        std::size_t const n = 1000;
+
+        std::uint64_t const r1 = rapidhash_64::hash( buffer, n, 7 );
+        std::uint64_t const r2 = rapidhash_withSeed( buffer, n, 7 );
+
+        BOOST_TEST_NE( r1, r2 );
+    }
+
+    // repeated calls to result
+
+    {
+        rapidhash_64 h1( 7 );
+        rapidhash_64 h2( 7 );
+
+        h1.update( buffer, 200 );
+        h2.update( buffer, 200 );
+
+        std::uint64_t const r1 = h1.result();
+        std::uint64_t const r2 = h1.result();
+        std::uint64_t const r3 = h1.result();
+
+        BOOST_TEST_NE( r1, r2 );
+        BOOST_TEST_NE( r2, r3 );
+
+        BOOST_TEST_EQ( h2.result(), r1 );
+        BOOST_TEST_EQ( h2.result(), r2 );
+        BOOST_TEST_EQ( h2.result(), r3 );
+    }
+
+    // byte sequence seeds
+
+    {
+        rapidhash_64 h1( buffer, 0 );
+        rapidhash_64 h2;
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        rapidhash_64 h1( buffer, 16 );
+        rapidhash_64 h2;
+
+        h2.update( buffer, 16 );
+        h2.result();
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    {
+        rapidhash_64 h1( buffer, 16 );
+        rapidhash_64 h2( buffer, 17 );
+
+        h1.update( buffer, 5 );
+        h2.update( buffer, 5 );
+
+        BOOST_TEST_NE( h1.result(), h2.result() );
+    }
+
+    return boost::report_errors();
+}
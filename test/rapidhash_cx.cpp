@@ -0,0 +1,54 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstdint>
+#include <cstddef>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v21[ 21 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v200[ 200 ] = {};
+
+    TEST_EQ( test<rapidhash_64>( 0, v21 ), 8175800390163325144ull );
+    TEST_EQ( test<rapidhash_64>( 0, v45 ), 15354471760198167794ull );
+    TEST_EQ( test<rapidhash_64>( 0, v200 ), 3160376925426307991ull );
+
+    TEST_EQ( test<rapidhash_64>( 7, v21 ), 10518987247094522874ull );
+    TEST_EQ( test<rapidhash_64>( 7, v45 ), 5913116707701333103ull );
+    TEST_EQ( test<rapidhash_64>( 7, v200 ), 15126750755190250354ull );
+
+    TEST_EQ( rapidhash_64::hash( v21, 21, 7 ), test<rapidhash_64>( 7, v21 ) );
+    TEST_EQ( rapidhash_64::hash( v45, 45, 7 ), test<rapidhash_64>( 7, v45 ) );
+    TEST_EQ( rapidhash_64::hash( v200, 200, 7 ), test<rapidhash_64>( 7, v200 ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,183 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/recording_hash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+struct X
+{
+    std::uint16_t a;
+    std::string b;
+};
+
+template<class Hash, class Flavor> void tag_invoke( boost::hash2::hash_append_tag const&, Hash& h, Flavor const& f, X const& v )
+{
+    boost::hash2::hash_append( h, f, v.a );
+    boost::hash2::hash_append( h, f, v.b );
+}
+
+template<class H, class Flavor, class T> void test_same_result( T const& v )
+{
+    H h1;
+    boost::hash2::recording_hash<H> h2;
+
+    boost::hash2::hash_append( h1, Flavor(), v );
+    boost::hash2::hash_append( h2, Flavor(), v );
+
+    // the recorded bytes produce the same result
+
+    H h3;
+    h3.update( h2.bytes().data(), h2.bytes().size() );
+
+    typename H::result_type const r = h1.result();
+
+    BOOST_TEST( h2.result() == r );
+    BOOST_TEST( h3.result() == r );
+}
+
+template<class R> static void test_span( R const& h, std::size_t i, char const* name, std::size_t first, std::size_t last, int depth )
+{
+    BOOST_TEST_LT( i, h.spans().size() );
+
+    if( i < h.spans().size() )
+    {
+        boost::hash2::recorded_span const& s = h.spans()[ i ];
+
+        BOOST_TEST_CSTR_EQ( s.name, name );
+        BOOST_TEST_EQ( s.first, first );
+        BOOST_TEST_EQ( s.last, last );
+        BOOST_TEST_EQ( s.depth, depth );
+    }
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    BOOST_TEST( recording_hash<sha2_256>::block_size == sha2_256::block_size );
+    BOOST_TEST_TRAIT_SAME( recording_hash<sha2_256>::result_type, sha2_256::result_type );
+
+    // little endian, 32 bit sizes
+
+    {
+        recording_hash<fnv1a_64> h;
+
+        std::tuple<std::uint16_t, std::string> const v( 0x0102, "ab" );
+        hash_append( h, little_endian_flavor_32(), v );
+
+        unsigned char const expected[] = { 0x02, 0x01, 'a', 'b', 0x02, 0x00, 0x00, 0x00 };
+
+        BOOST_TEST_EQ( h.bytes().size(), sizeof( expected ) );
+        BOOST_TEST( std::memcmp( h.bytes().data(), expected, sizeof( expected ) ) == 0 );
+
+        BOOST_TEST_EQ( h.spans().size(), 5u );
+
+        test_span( h, 0, "tuple_like", 0, 8, 0 );
+        test_span( h, 1, "contiguously_hashable", 0, 2, 1 );
+        test_span( h, 2, "contiguous_range", 2, 8, 1 );
+        test_span( h, 3, "size", 4, 8, 2 );
+        test_span( h, 4, "contiguously_hashable", 4, 8, 3 );
+
+        BOOST_TEST_EQ( to_string( h ),
+            "tuple_like [0, 8)\n"
+            "  contiguously_hashable [0, 2)\n"
+            "    02 01\n"
+            "  contiguous_range [2, 8)\n"
+            "    61 62\n"
+            "    size [4, 8)\n"
+            "      contiguously_hashable [4, 8)\n"
+            "        02 00 00 00\n"
+        );
+    }
+
+    // big endian, 64 bit sizes
+
+    {
+        recording_hash<sha2_256> h;
+
+        X const v = { 0x0102, "ab" };
+        hash_append( h, big_endian_flavor(), v );
+
+        unsigned char const expected[] = { 0x01, 0x02, 'a', 'b', 0, 0, 0, 0, 0, 0, 0, 0x02 };
+
+        BOOST_TEST_EQ( h.bytes().size(), sizeof( expected ) );
+        BOOST_TEST( std::memcmp( h.bytes().data(), expected, sizeof( expected ) ) == 0 );
+
+        BOOST_TEST_EQ( h.spans().size(), 5u );
+
+        test_span( h, 0, "tag_invoke", 0, 12, 0 );
+        test_span( h, 1, "integral", 0, 2, 1 );
+        test_span( h, 2, "contiguous_range", 2, 12, 1 );
+        test_span( h, 3, "size", 4, 12, 2 );
+        test_span( h, 4, "integral", 4, 12, 3 );
+    }
+
+    // direct update calls are recorded outside any span
+
+    {
+        recording_hash<fnv1a_64> h;
+
+        unsigned char const data[] = { 1, 2, 3 };
+
+        h.update( data, 3 );
+        hash_append( h, {}, std::uint8_t( 4 ) );
+        h.update( data, 1 );
+
+        BOOST_TEST_EQ( h.bytes().size(), 5u );
+        BOOST_TEST_EQ( h.spans().size(), 1u );
+
+        BOOST_TEST_EQ( to_string( h ),
+            "01 02 03\n"
+            "contiguously_hashable [3, 4)\n"
+            "  04\n"
+            "01\n"
+        );
+
+        h.clear();
+
+        BOOST_TEST( h.bytes().empty() );
+        BOOST_TEST( h.spans().empty() );
+        BOOST_TEST_EQ( to_string( h ), std::string() );
+    }
+
+    // update_word
+
+    {
+        unsigned char const tmp[ 8 ] = { 0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01 };
+
+        fnv1a_64 h1;
+        recording_hash<fnv1a_64> h2;
+
+        h1.update( tmp, 8 );
+        h2.update_word( 0x0123456789ABCDEFull );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+
+        BOOST_TEST_EQ( h2.bytes().size(), 8u );
+        BOOST_TEST( std::memcmp( h2.bytes().data(), tmp, 8 ) == 0 );
+    }
+
+    // the results are those of H
+
+    {
+        std::vector<X> const v = { { 1, "one" }, { 2, "two" }, { 3, "" } };
+
+        test_same_result<fnv1a_64, default_flavor>( v );
+        test_same_result<fnv1a_64, big_endian_flavor>( v );
+        test_same_result<sha2_256, little_endian_flavor>( v );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,121 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/reduce.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+void test_reduce()
+{
+    using boost::hash2::reduce;
+    using boost::hash2::get_integral_result;
+
+    std::size_t const ns[] = { 1, 2, 3, 7, 100, 1000, 65537, 1u << 31, static_cast<std::size_t>( -1 ) };
+
+    for( std::size_t n: ns )
+    {
+        for( std::uint64_t i = 0; i < 1000; ++i )
+        {
+            std::uint64_t x = i * 0x9E3779B97F4A7C15ull;
+
+            BOOST_TEST_LT( reduce( x, n ), n );
+            BOOST_TEST_LT( reduce( static_cast<std::uint32_t>( x ), n ), n );
+        }
+
+        BOOST_TEST_EQ( reduce( std::uint64_t( 0 ), n ), 0u );
+        BOOST_TEST_EQ( reduce( ~std::uint64_t( 0 ), n ), n - 1 );
+    }
+
+    // the high bits of the 64 bit result, mixed from a shorter one
+
+    BOOST_TEST_EQ( reduce( std::uint64_t( 1 ) << 63, 10 ), 5u );
+    BOOST_TEST_EQ( reduce( std::uint32_t( 0x12345678 ), 1000 ), reduce( get_integral_result<std::uint64_t>( std::uint32_t( 0x12345678 ) ), 1000 ) );
+
+    // an array-like result
+
+    {
+        boost::hash2::sha2_256 h;
+        h.update( "abc", 3 );
+
+        auto r = h.result();
+
+        BOOST_TEST_EQ( reduce( r, 12345 ), reduce( get_integral_result<std::uint64_t>( r ), 12345 ) );
+    }
+}
+
+// consecutive 32 bit results spread evenly over the buckets
+
+void test_distribution()
+{
+    std::size_t const n = 97;
+    std::vector<std::size_t> count( n );
+
+    for( std::uint32_t i = 0; i < 97000; ++i )
+    {
+        boost::hash2::fnv1a_32 h;
+        h.update( &i, sizeof( i ) );
+
+        ++count[ boost::hash2::reduce( h.result(), n ) ];
+    }
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST_GT( count[ i ], 800u );
+        BOOST_TEST_LT( count[ i ], 1200u );
+    }
+}
+
+void test_fastmod()
+{
+    using boost::hash2::fastmod;
+    using boost::hash2::get_integral_result;
+
+    std::uint32_t const ns[] = { 1, 2, 3, 5, 7, 10, 100, 641, 65535, 65536, 65537, 1000003, 0x7FFFFFFFu, 0x80000000u, 0xFFFFFFFEu, 0xFFFFFFFFu };
+
+    for( std::uint32_t n: ns )
+    {
+        fastmod const f( n );
+
+        BOOST_TEST_EQ( f.divisor(), n );
+
+        for( std::uint32_t i = 0; i < 10000; ++i )
+        {
+            std::uint32_t x = i * 0x9E3779B9u;
+            BOOST_TEST_EQ( f( x ), x % n );
+        }
+
+        BOOST_TEST_EQ( f( std::uint32_t( 0 ) ), 0u );
+        BOOST_TEST_EQ( f( std::uint32_t( n - 1 ) ), n - 1 );
+        BOOST_TEST_EQ( f( std::uint32_t( 0xFFFFFFFFu ) ), 0xFFFFFFFFu % n );
+
+        for( std::uint64_t i = 0; i < 1000; ++i )
+        {
+            std::uint64_t x = i * 0x9E3779B97F4A7C15ull;
+            BOOST_TEST_EQ( f( x ), get_integral_result<std::uint32_t>( x ) % n );
+        }
+    }
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+STATIC_ASSERT( boost::hash2::reduce( std::uint64_t( 1 ) << 63, 10 ) == 5 );
+STATIC_ASSERT( boost::hash2::fastmod( 7 )( std::uint32_t( 100 ) ) == 2 );
+
+#endif
+
+int main()
+{
+    test_reduce();
+    test_distribution();
+    test_fastmod();
+
+    return boost::report_errors();
+}
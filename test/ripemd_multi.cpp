@@ -0,0 +1,150 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/ripemd.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template<class H, class Hm, std::size_t N = Hm::lanes> void test( std::size_t n, std::size_t split, std::uint64_t seed )
+{
+    std::vector<unsigned char> v[ N ];
+    unsigned char const* p[ N ];
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        v[ j ].resize( n + 1 );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            v[ j ][ i ] = static_cast<unsigned char>( i * 7 + j * 31 + 1 );
+        }
+
+        p[ j ] = v[ j ].data();
+    }
+
+    Hm h( seed );
+
+    h.update( p, split );
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        p[ j ] += split;
+    }
+
+    h.update( p, n - split );
+
+    typename Hm::result_type r = h.result();
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        H h2( seed );
+
+        h2.update( v[ j ].data(), n );
+
+        BOOST_TEST_EQ( r[ j ], h2.result() );
+    }
+}
+
+template<class H, class Hm> void test()
+{
+    std::size_t const lengths[] = { 0, 1, 55, 56, 63, 64, 65, 111, 112, 127, 128, 129, 200, 1000 };
+
+    for( std::size_t n: lengths )
+    {
+        test<H, Hm>( n, 0, 0 );
+        test<H, Hm>( n, n / 3, 0 );
+        test<H, Hm>( n, n / 2, 7 );
+    }
+}
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+// the kernels against the portable transform
+
+template<std::size_t N, class F> static void test_lanes( F f )
+{
+    using namespace boost::hash2;
+
+    unsigned char buffer[ N ][ 64 ];
+    unsigned char const* block[ N ];
+
+    std::uint32_t st[ 5 * N ];
+    std::uint32_t st2[ N ][ 5 ];
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        for( std::size_t i = 0; i < 64; ++i )
+        {
+            buffer[ j ][ i ] = static_cast<unsigned char>( i * 13 + j * 5 );
+        }
+
+        block[ j ] = buffer[ j ];
+
+        for( std::size_t i = 0; i < 5; ++i )
+        {
+            st[ i * N + j ] = st2[ j ][ i ] = static_cast<std::uint32_t>( i * 0x01010101u + j );
+        }
+    }
+
+    for( int k = 0; k < 4; ++k )
+    {
+        f( block, st, N );
+
+        for( std::size_t j = 0; j < N; ++j )
+        {
+            detail::ripemd_160_lanes::transform( block[ j ], st2[ j ] );
+        }
+    }
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        for( std::size_t i = 0; i < 5; ++i )
+        {
+            BOOST_TEST_EQ( st[ i * N + j ], st2[ j ][ i ] );
+        }
+    }
+}
+
+static void test_avx2()
+{
+    if( !boost::hash2::detail::has_x86_avx2() ) return;
+    test_lanes<8>( boost::hash2::detail::ripemd_160_transform_avx2 );
+}
+
+static void test_avx512()
+{
+    if( !boost::hash2::detail::has_x86_avx512f() ) return;
+    test_lanes<16>( boost::hash2::detail::ripemd_160_transform_avx512 );
+}
+
+#else
+
+static void test_avx2()
+{
+}
+
+static void test_avx512()
+{
+}
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<ripemd_160, ripemd_160_multi<1>>();
+    test<ripemd_160, ripemd_160_multi<3>>();
+    test<ripemd_160, ripemd_160_multi<8>>();
+    test<ripemd_160, ripemd_160_multi<11>>();
+    test<ripemd_160, ripemd_160_multi<16>>();
+    test<ripemd_160, ripemd_160_multi<27>>();
+
+    test_avx2();
+    test_avx512();
+
+    return boost::report_errors();
+}
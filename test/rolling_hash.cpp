@@ -0,0 +1,118 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/rolling_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+static std::vector<unsigned char> make_data( std::size_t n )
+{
+    std::vector<unsigned char> v( n );
+
+    std::uint32_t x = 1;
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        x = x * 1664525 + 1013904223;
+        v[ i ] = static_cast<unsigned char>( x >> 24 );
+    }
+
+    return v;
+}
+
+// rolling over the data gives the same values as hashing each window anew
+
+template<class R> static void test( R const& r0 )
+{
+    std::size_t const w = r0.window_size();
+
+    std::vector<unsigned char> v = make_data( 1000 );
+
+    R r( r0 );
+    r.update( v.data(), w );
+
+    {
+        R r2( r0 );
+
+        for( std::size_t i = 0; i < w; ++i )
+        {
+            r2.update( v[ i ] );
+        }
+
+        BOOST_TEST_EQ( r.value(), r2.value() );
+    }
+
+    for( std::size_t i = w; i < v.size(); ++i )
+    {
+        r.roll( v[ i - w ], v[ i ] );
+
+        R r2( r0 );
+        r2.update( v.data() + i + 1 - w, w );
+
+        BOOST_TEST_EQ( r.value(), r2.value() );
+    }
+
+    // equal windows give equal values, at any offset
+
+    {
+        std::vector<unsigned char> v2( v.begin() + 100, v.begin() + 100 + w );
+
+        R r2( r0 );
+        r2.update( v2.data(), w );
+
+        R r3( r0 );
+        r3.update( v.data() + 100, w );
+
+        BOOST_TEST_EQ( r2.value(), r3.value() );
+    }
+
+    r.reset();
+    BOOST_TEST_EQ( r.value(), 0u );
+}
+
+int main()
+{
+    for( std::size_t w: { 1, 16, 48, 63, 64, 65, 128 } )
+    {
+        test( rabin_karp_64( w ) );
+        test( rabin_karp_64( w, 7 ) );
+        test( buzhash_64( w ) );
+        test( buzhash_64( w, 7 ) );
+    }
+
+    test( gear_hash_64() );
+    test( gear_hash_64( 7 ) );
+
+    BOOST_TEST_EQ( gear_hash_64().window_size(), 64u );
+
+    // different seeds give different values
+
+    {
+        std::vector<unsigned char> v = make_data( 64 );
+
+        rabin_karp_64 r1( 64 ), r2( 64, 1 );
+        r1.update( v.data(), v.size() );
+        r2.update( v.data(), v.size() );
+
+        BOOST_TEST_NE( r1.value(), r2.value() );
+
+        buzhash_64 b1( 64 ), b2( 64, 1 );
+        b1.update( v.data(), v.size() );
+        b2.update( v.data(), v.size() );
+
+        BOOST_TEST_NE( b1.value(), b2.value() );
+
+        gear_hash_64 g1, g2( 1 );
+        g1.update( v.data(), v.size() );
+        g2.update( v.data(), v.size() );
+
+        BOOST_TEST_NE( g1.value(), g2.value() );
+    }
+
+    return boost::report_errors();
+}
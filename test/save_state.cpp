@@ -0,0 +1,208 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/ghash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/crc32.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/hash2/toeplitz.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/hash2/buffered_hash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+template<class H> void test( std::size_t n )
+{
+    unsigned char buffer[ 1024 ];
+
+    for( std::size_t i = 0; i < sizeof( buffer ); ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+    }
+
+    unsigned char state[ H::state_size ];
+
+    // uninterrupted
+
+    H h1( 7 );
+
+    h1.update( buffer, n );
+    h1.update( buffer + n, sizeof( buffer ) - n );
+
+    typename H::result_type const r1 = h1.result();
+
+    // checkpointed after n bytes, resumed in a fresh object
+
+    H h2( 7 );
+
+    h2.update( buffer, n );
+    h2.save_state( state );
+
+    H h3;
+
+    BOOST_TEST( h3.load_state( state, sizeof( state ) ) );
+
+    h3.update( buffer + n, sizeof( buffer ) - n );
+
+    BOOST_TEST( h3.result() == r1 );
+
+    // the result after resuming doesn't depend on the original
+
+    h2.update( buffer + n, sizeof( buffer ) - n );
+    BOOST_TEST( h2.result() == r1 );
+
+    // a state saved after result() continues the result sequence
+
+    h1.save_state( state );
+
+    H h4;
+    BOOST_TEST( h4.load_state( state, sizeof( state ) ) );
+
+    BOOST_TEST( h1.result() == h4.result() );
+
+    // invalid states are rejected, and leave the object unchanged
+
+    {
+        H h5( 7 );
+        h5.update( buffer, n );
+
+        H h6( h5 );
+
+        BOOST_TEST( !h6.load_state( state, sizeof( state ) - 1 ) );
+        BOOST_TEST( h5.result() == h6.result() );
+
+        state[ 0 ] ^= 0xFF;
+
+        BOOST_TEST( !h6.load_state( state, sizeof( state ) ) );
+        BOOST_TEST( h5.result() == h6.result() );
+
+        state[ 0 ] ^= 0xFF;
+    }
+}
+
+template<class H> void test()
+{
+    std::size_t const ns[] = { 0, 1, 3, 4, 7, 8, 15, 16, 31, 32, 63, 64, 65, 127, 128, 129, 200, 511, 1023, 1024 };
+
+    for( std::size_t i = 0; i < sizeof( ns ) / sizeof( ns[ 0 ] ); ++i )
+    {
+        test<H>( ns[ i ] );
+    }
+}
+
+// a buffered count past the end of the buffer is rejected
+
+template<class H> void test_invalid_count( std::size_t offset )
+{
+    unsigned char state[ H::state_size ];
+
+    H h1;
+    h1.update( "abc", 3 );
+    h1.save_state( state );
+
+    // the low byte of the little endian count
+    state[ offset ] = 0xFF;
+
+    H h2;
+    BOOST_TEST( !h2.load_state( state, sizeof( state ) ) );
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_32>();
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::fnv1a_64_wide>();
+    test<boost::hash2::tabulation_64>();
+    test<boost::hash2::mix32>();
+    test<boost::hash2::mix64>();
+    test<boost::hash2::polymur_64>();
+    test<boost::hash2::poly1305>();
+    test<boost::hash2::ghash>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxh3_64>();
+    test<boost::hash2::xxh3_128>();
+    test<boost::hash2::rapidhash_64>();
+    test<boost::hash2::aes_hash_128>();
+    test<boost::hash2::highwayhash_64>();
+    test<boost::hash2::highwayhash_128>();
+    test<boost::hash2::highwayhash_256>();
+    test<boost::hash2::xxhash_32_noscrub>();
+    test<boost::hash2::xxhash_64_noscrub>();
+    test<boost::hash2::xxh3_64_noscrub>();
+    test<boost::hash2::xxh3_128_noscrub>();
+    test<boost::hash2::siphash_32>();
+    test<boost::hash2::siphash_64>();
+    test<boost::hash2::siphash13_32>();
+    test<boost::hash2::siphash13_64>();
+    test<boost::hash2::crc32c>();
+    test<boost::hash2::crc32>();
+    test<boost::hash2::crc64_xz>();
+    test<boost::hash2::crc64_nvme>();
+    test<boost::hash2::adler32>();
+    test<boost::hash2::toeplitz_32>();
+
+    test<boost::hash2::md5_128>();
+    test<boost::hash2::sha1_160>();
+    test<boost::hash2::sha2_256>();
+    test<boost::hash2::sha2_224>();
+    test<boost::hash2::sha2_512>();
+    test<boost::hash2::sha2_384>();
+    test<boost::hash2::sha2_512_224>();
+    test<boost::hash2::sha2_512_256>();
+    test<boost::hash2::ripemd_160>();
+    test<boost::hash2::ripemd_128>();
+    test<boost::hash2::blake2b_512>();
+    test<boost::hash2::blake2s_256>();
+    test<boost::hash2::blake3>();
+    test<boost::hash2::sha3_256>();
+    test<boost::hash2::sha3_224>();
+    test<boost::hash2::sha3_512>();
+    test<boost::hash2::sha3_384>();
+    test<boost::hash2::shake128>();
+    test<boost::hash2::shake256>();
+    test<boost::hash2::k12>();
+
+    test<boost::hash2::hmac_md5_128>();
+    test<boost::hash2::hmac_sha2_256>();
+    test<boost::hash2::hmac_sha2_512>();
+    test<boost::hash2::hmac_blake2s_256>();
+    test<boost::hash2::hmac_sha3_256>();
+
+    test< boost::hash2::buffered_hash<boost::hash2::xxhash_64> >();
+    test< boost::hash2::buffered_hash<boost::hash2::sha2_256, 16> >();
+
+    // the last field of blake2 and sha3 is the buffered count
+    test_invalid_count<boost::hash2::blake2s_256>( boost::hash2::blake2s_256::state_size - 8 );
+    test_invalid_count<boost::hash2::sha3_256>( boost::hash2::sha3_256::state_size - 8 );
+    test_invalid_count< boost::hash2::buffered_hash<boost::hash2::xxhash_64> >( boost::hash2::buffered_hash<boost::hash2::xxhash_64>::state_size - 8 );
+
+    // the key position of toeplitz_32 must be within the key
+    test_invalid_count<boost::hash2::toeplitz_32>( boost::hash2::toeplitz_32::state_size - 8 );
+
+    // the sums of adler32 must be reduced modulo 65521
+    test_invalid_count<boost::hash2::adler32>( 3 );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,140 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/hmac.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <boost/config/pragma_message.hpp>
+#include <boost/config/workaround.hpp>
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+BOOST_PRAGMA_MESSAGE( "Test skipped, because BOOST_NO_CXX14_CONSTEXPR is defined" )
+int main() {}
+
+#else
+
+// seeded instances as compile time constants; copying one must be
+// the same as constructing with the seed at run time
+
+constexpr unsigned char key[ 80 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21 };
+
+template<class H> void test()
+{
+    static constexpr H h1( 0x9E3779B97F4A7C15ull );
+    static constexpr H h2( key, 17 );
+    static constexpr H h3( key, sizeof( key ) );
+
+    unsigned char const msg[] = { 'a', 'b', 'c' };
+
+    {
+        H h( h1 );
+        h.update( msg, 3 );
+
+        H h0( 0x9E3779B97F4A7C15ull );
+        h0.update( msg, 3 );
+
+        BOOST_TEST( h.result() == h0.result() );
+    }
+
+    {
+        H h( h2 );
+        h.update( msg, 3 );
+
+        H h0( key, 17 );
+        h0.update( msg, 3 );
+
+        BOOST_TEST( h.result() == h0.result() );
+    }
+
+    {
+        H h( h3 );
+        h.update( msg, 3 );
+
+        H h0( key, sizeof( key ) );
+        h0.update( msg, 3 );
+
+        BOOST_TEST( h.result() == h0.result() );
+    }
+}
+
+#if !BOOST_WORKAROUND(BOOST_GCC, < 60000)
+
+template<class H> void test_hmac()
+{
+    test< boost::hash2::hmac<H> >();
+
+    // both padded states of the key, precomputed
+
+    static constexpr boost::hash2::hmac_key<H> k( key, 17 );
+
+    unsigned char const msg[] = { 'a', 'b', 'c' };
+
+    boost::hash2::hmac<H> h( k );
+    h.update( msg, 3 );
+
+    boost::hash2::hmac<H> h0( key, 17 );
+    h0.update( msg, 3 );
+
+    BOOST_TEST( h.result() == h0.result() );
+}
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<fnv1a_32>();
+    test<fnv1a_64>();
+    test<xxhash_32>();
+    test<xxhash_64>();
+    test<xxh3_64>();
+    test<xxh3_128>();
+    test<siphash_32>();
+    test<siphash_64>();
+    test<rapidhash_64>();
+    test<highwayhash_64>();
+    test<aes_hash_128>();
+    test<crc32c>();
+    test<md5_128>();
+    test<sha1_160>();
+    test<sha2_256>();
+    test<sha2_512>();
+    test<sha3_256>();
+    test<ripemd_160>();
+    test<blake2b_512>();
+    test<blake2s_256>();
+    test<blake3>();
+    test<k12>();
+
+#if !BOOST_WORKAROUND(BOOST_GCC, < 60000)
+
+    test_hmac<md5_128>();
+    test_hmac<sha1_160>();
+    test_hmac<sha2_256>();
+    test_hmac<sha2_512>();
+
+#endif
+
+    return boost::report_errors();
+}
+
+#endif
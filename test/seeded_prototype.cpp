@@ -0,0 +1,129 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/seeded_prototype.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+template<class H> static typename H::result_type hash_of( H h, int k )
+{
+    h.update( &k, sizeof( k ) );
+    return h.result();
+}
+
+template<class H> static void test()
+{
+    unsigned char const seed[] = "0123456789abcdef0123456789abcdef";
+
+    {
+        seeded_prototype<H> p( 7 );
+
+        for( int k = 0; k < 10; ++k )
+        {
+            BOOST_TEST( hash_of( p.get(), k ) == hash_of( H( 7 ), k ) );
+        }
+
+        std::uint64_t s = p.stamp();
+
+        p.rotate( 8 );
+
+        BOOST_TEST_NE( p.stamp(), s );
+        BOOST_TEST( hash_of( p.get(), 1 ) == hash_of( H( 8 ), 1 ) );
+    }
+
+    {
+        seeded_prototype<H> p( seed, sizeof( seed ) - 1 );
+
+        BOOST_TEST( hash_of( p.get(), 1 ) == hash_of( H( seed, sizeof( seed ) - 1 ), 1 ) );
+
+        p.rotate( seed, 16 );
+
+        BOOST_TEST( hash_of( p.get(), 1 ) == hash_of( H( seed, 16 ), 1 ) );
+    }
+
+    // more prototypes than the cache holds, alternating
+
+    {
+        seeded_prototype<H> p1( 1 ), p2( 2 ), p3( 3 ), p4( 4 ), p5( 5 ), p6( 6 );
+        seeded_prototype<H> const* p[] = { &p1, &p2, &p3, &p4, &p5, &p6 };
+
+        for( int i = 0; i < 30; ++i )
+        {
+            int j = i * 7 % 6;
+            BOOST_TEST( hash_of( p[ j ]->get(), i ) == hash_of( H( j + 1 ), i ) );
+        }
+    }
+
+    // a prototype constructed where a destroyed one was
+
+    for( int i = 0; i < 3; ++i )
+    {
+        seeded_prototype<H> p( static_cast<std::uint64_t>( i ) );
+        BOOST_TEST( hash_of( p.get(), 1 ) == hash_of( H( static_cast<std::uint64_t>( i ) ), 1 ) );
+    }
+}
+
+static void test_threads()
+{
+    seeded_prototype<xxhash_64> p( 0 );
+
+    std::atomic<bool> done( false );
+    std::atomic<int> errors( 0 );
+
+    std::vector<std::thread> th;
+
+    for( int t = 0; t < 4; ++t )
+    {
+        th.emplace_back( [&]{
+
+            while( !done.load() )
+            {
+                // every state handed out is one of the seeded states
+
+                std::uint64_t r = hash_of( p.get(), 5 );
+
+                bool ok = false;
+
+                for( std::uint64_t s = 0; s <= 100 && !ok; ++s )
+                {
+                    ok = r == hash_of( xxhash_64( s ), 5 );
+                }
+
+                if( !ok ) ++errors;
+            }
+        });
+    }
+
+    for( std::uint64_t s = 1; s <= 100; ++s )
+    {
+        p.rotate( s );
+    }
+
+    done.store( true );
+
+    for( auto& x: th ) x.join();
+
+    BOOST_TEST_EQ( errors.load(), 0 );
+    BOOST_TEST_EQ( hash_of( p.get(), 5 ), hash_of( xxhash_64( 100 ), 5 ) );
+}
+
+int main()
+{
+    test<siphash_64>();
+    test<xxhash_64>();
+    test<hmac_sha2_256>();
+
+    test_threads();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,117 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+using boost::hash2::sha2_256;
+
+static unsigned char buffer[ 64 * 21 ];
+
+static sha2_256::result_type reference( unsigned char const* p, std::size_t n )
+{
+    sha2_256 h;
+    h.update( p, n );
+    return h.result();
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+BOOST_CXX14_CONSTEXPR unsigned char const message[ 64 ] = { 0x01, 0x02, 0x03, 0xFE, 0xFF, 0x00, 0x80 };
+
+BOOST_CXX14_CONSTEXPR sha2_256::result_type reference_cx( std::size_t n )
+{
+    sha2_256 h;
+    h.update( message, n );
+    return h.result();
+}
+
+#endif
+
+int main()
+{
+    for( std::size_t i = 0; i < sizeof( buffer ); ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 0x9D + 0x3B );
+    }
+
+    // known answers
+
+    {
+        unsigned char p[ 64 ];
+
+        for( int i = 0; i < 64; ++i )
+        {
+            p[ i ] = static_cast<unsigned char>( i );
+        }
+
+        BOOST_TEST_EQ( to_string( sha2_256::hash64( p ) ), std::string( "fdeab9acf3710362bd2658cdc9a29e8f9c757fcf9811603a8c447cd1d9151108" ) );
+    }
+
+    {
+        // double SHA-256
+
+        sha2_256 h;
+        h.update( "hello", 5 );
+
+        BOOST_TEST_EQ( to_string( sha2_256::hash32( h.result().data() ) ), std::string( "9595c9df90075148eb06860365df33584b75bff782a510c6cd4883a419833d50" ) );
+    }
+
+    // single messages
+
+    for( std::size_t i = 0; i < 21; ++i )
+    {
+        BOOST_TEST( sha2_256::hash64( buffer + i * 64 ) == reference( buffer + i * 64, 64 ) );
+        BOOST_TEST( sha2_256::hash32( buffer + i * 32 ) == reference( buffer + i * 32, 32 ) );
+    }
+
+    // batches, of sizes below, at, and above the lane count
+
+    for( std::size_t n = 0; n <= 21; ++n )
+    {
+        std::vector<sha2_256::result_type> r( n + 1 );
+
+        sha2_256::hash64( buffer, n, r.data() );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST( r[ i ] == reference( buffer + i * 64, 64 ) );
+        }
+
+        BOOST_TEST( r[ n ] == sha2_256::result_type() );
+
+        sha2_256::hash32( buffer, n, r.data() );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            BOOST_TEST( r[ i ] == reference( buffer + i * 32, 32 ) );
+        }
+
+        BOOST_TEST( r[ n ] == sha2_256::result_type() );
+    }
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr sha2_256::result_type r1 = sha2_256::hash64( message );
+        constexpr sha2_256::result_type r2 = sha2_256::hash32( message );
+
+        STATIC_ASSERT( r1 == reference_cx( 64 ) );
+        STATIC_ASSERT( r2 == reference_cx( 32 ) );
+
+        BOOST_TEST( r1 == reference( message, 64 ) );
+        BOOST_TEST( r2 == reference( message, 32 ) );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,191 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/sha2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template<class H, class Hm, std::size_t N = Hm::lanes> void test( std::size_t n, std::size_t split, std::uint64_t seed )
+{
+    std::vector<unsigned char> v[ N ];
+    unsigned char const* p[ N ];
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        v[ j ].resize( n + 1 );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            v[ j ][ i ] = static_cast<unsigned char>( i * 7 + j * 31 + 1 );
+        }
+
+        p[ j ] = v[ j ].data();
+    }
+
+    Hm h( seed );
+
+    h.update( p, split );
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        p[ j ] += split;
+    }
+
+    h.update( p, n - split );
+
+    typename Hm::result_type r = h.result();
+
+    for( std::size_t j = 0; j < N; ++j )
+    {
+        H h2( seed );
+
+        h2.update( v[ j ].data(), n );
+
+        BOOST_TEST_EQ( r[ j ], h2.result() );
+    }
+}
+
+template<class H, class Hm> void test()
+{
+    std::size_t const lengths[] = { 0, 1, 55, 56, 63, 64, 65, 111, 112, 127, 128, 129, 200, 1000 };
+
+    for( std::size_t n: lengths )
+    {
+        test<H, Hm>( n, 0, 0 );
+        test<H, Hm>( n, n / 3, 0 );
+        test<H, Hm>( n, n / 2, 7 );
+    }
+}
+
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+// the AVX2 kernel isn't used by sha2_256_multi when SHA-NI is
+// present, so check it directly against the portable transform
+
+static void test_avx2_256()
+{
+    using namespace boost::hash2;
+
+    if( !detail::has_x86_avx2() ) return;
+
+    unsigned char buffer[ 8 ][ 64 ];
+    unsigned char const* block[ 8 ];
+
+    std::uint32_t st[ 8 * 8 ];
+    std::uint32_t st2[ 8 ][ 8 ];
+
+    for( int j = 0; j < 8; ++j )
+    {
+        for( int i = 0; i < 64; ++i )
+        {
+            buffer[ j ][ i ] = static_cast<unsigned char>( i * 13 + j * 5 );
+        }
+
+        block[ j ] = buffer[ j ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            st[ i * 8 + j ] = st2[ j ][ i ] = static_cast<std::uint32_t>( i * 0x01010101u + j );
+        }
+    }
+
+    for( int k = 0; k < 4; ++k )
+    {
+        detail::sha2_256_transform_avx2( block, st, 8, detail::sha2_256_constants<>::K );
+
+        for( int j = 0; j < 8; ++j )
+        {
+            detail::sha2_256_base::transform( block[ j ], st2[ j ] );
+        }
+    }
+
+    for( int j = 0; j < 8; ++j )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            BOOST_TEST_EQ( st[ i * 8 + j ], st2[ j ][ i ] );
+        }
+    }
+}
+
+static void test_avx2_512()
+{
+    using namespace boost::hash2;
+
+    if( !detail::has_x86_avx2() ) return;
+
+    unsigned char buffer[ 4 ][ 128 ];
+    unsigned char const* block[ 4 ];
+
+    std::uint64_t st[ 8 * 4 ];
+    std::uint64_t st2[ 4 ][ 8 ];
+
+    for( int j = 0; j < 4; ++j )
+    {
+        for( int i = 0; i < 128; ++i )
+        {
+            buffer[ j ][ i ] = static_cast<unsigned char>( i * 13 + j * 5 );
+        }
+
+        block[ j ] = buffer[ j ];
+
+        for( int i = 0; i < 8; ++i )
+        {
+            st[ i * 4 + j ] = st2[ j ][ i ] = i * 0x0101010101010101ull + j;
+        }
+    }
+
+    for( int k = 0; k < 4; ++k )
+    {
+        detail::sha2_512_transform_avx2_x4( block, st, 4, detail::sha2_512_constants<>::K );
+
+        for( int j = 0; j < 4; ++j )
+        {
+            detail::sha2_512_base::transform( block[ j ], st2[ j ] );
+        }
+    }
+
+    for( int j = 0; j < 4; ++j )
+    {
+        for( int i = 0; i < 8; ++i )
+        {
+            BOOST_TEST_EQ( st[ i * 4 + j ], st2[ j ][ i ] );
+        }
+    }
+}
+
+#else
+
+static void test_avx2_256()
+{
+}
+
+static void test_avx2_512()
+{
+}
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test<sha2_256, sha2_256_multi<1>>();
+    test<sha2_256, sha2_256_multi<3>>();
+    test<sha2_256, sha2_256_multi<8>>();
+    test<sha2_256, sha2_256_multi<11>>();
+    test<sha2_256, sha2_256_multi<16>>();
+
+    test<sha2_512, sha2_512_multi<1>>();
+    test<sha2_512, sha2_512_multi<4>>();
+    test<sha2_512, sha2_512_multi<7>>();
+    test<sha2_512, sha2_512_multi<8>>();
+
+    test_avx2_256();
+    test_avx2_512();
+
+    return boost::report_errors();
+}
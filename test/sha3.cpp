@@ -0,0 +1,266 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/sha3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+template<class H> std::string digest( std::string const & s )
+{
+    H h;
+
+    h.update( s.data(), s.size() );
+
+    return to_string( h.result() );
+}
+
+template<class H> std::string digest( unsigned char const* p, std::size_t n, std::size_t split )
+{
+    H h;
+
+    h.update( p, split );
+    h.update( p + split, n - split );
+
+    return to_string( h.result() );
+}
+
+struct test_vector
+{
+    std::size_t n;
+    char const* digest;
+};
+
+template<class H, std::size_t N> void test( test_vector const (&tv)[ N ] )
+{
+    // message is i % 251 for i = 0, 1, ..., n - 1
+
+    unsigned char msg[ 1000 ] = {};
+
+    for( std::size_t i = 0; i < 1000; ++i )
+    {
+        msg[ i ] = static_cast<unsigned char>( i % 251 );
+    }
+
+    for( test_vector const& t: tv )
+    {
+        std::size_t const splits[] = { 0, 1, t.n / 3, t.n / 2, t.n };
+
+        for( std::size_t split: splits )
+        {
+            if( split > t.n ) continue;
+
+            BOOST_TEST_EQ( digest<H>( msg, t.n, split ), std::string( t.digest ) );
+        }
+    }
+}
+
+// successive calls to result() return successive parts of the output
+
+template<class H> void test_squeeze( char const* eighth )
+{
+    H h;
+    h.update( "abc", 3 );
+
+    std::string r = to_string( h.result() );
+
+    for( int i = 1; i < 8; ++i )
+    {
+        r = to_string( h.result() );
+    }
+
+    BOOST_TEST_EQ( r, std::string( eighth ) );
+}
+
+static void test_kernels()
+{
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+    using namespace boost::hash2::detail;
+
+    // the BMI2 permutation must agree with the lane complementing one
+
+    if( has_x86_bmi2() )
+    {
+        std::uint64_t A1[ 25 ] = {};
+        std::uint64_t A2[ 25 ] = {};
+
+        for( int i = 0; i < 25; ++i )
+        {
+            A1[ i ] = A2[ i ] = 0x9E3779B97F4A7C15ull * ( i + 1 );
+        }
+
+        for( int i = 0; i < 16; ++i )
+        {
+            keccak_permute_impl<true>( A1 );
+            keccak_permute_bmi2( A2 );
+        }
+
+        BOOST_TEST_ALL_EQ( A1, A1 + 25, A2, A2 + 25 );
+    }
+
+#endif
+}
+
+int main()
+{
+    using boost::hash2::sha3_224;
+    using boost::hash2::sha3_256;
+    using boost::hash2::sha3_384;
+    using boost::hash2::sha3_512;
+    using boost::hash2::shake128;
+    using boost::hash2::shake256;
+    using boost::hash2::hmac_sha3_256;
+    using boost::hash2::hmac_sha3_512;
+
+    // https://csrc.nist.gov/projects/cryptographic-standards-and-guidelines/example-values
+
+    BOOST_TEST_EQ( digest<sha3_224>( "" ), std::string( "6b4e03423667dbb73b6e15454f0eb1abd4597f9a1b078e3f5b5a6bc7" ) );
+    BOOST_TEST_EQ( digest<sha3_224>( "abc" ), std::string( "e642824c3f8cf24ad09234ee7d3c766fc9a3a5168d0c94ad73b46fdf" ) );
+    BOOST_TEST_EQ( digest<sha3_224>( "The quick brown fox jumps over the lazy dog" ), std::string( "d15dadceaa4d5d7bb3b48f446421d542e08ad8887305e28d58335795" ) );
+
+    BOOST_TEST_EQ( digest<sha3_256>( "" ), std::string( "a7ffc6f8bf1ed76651c14756a061d662f580ff4de43b49fa82d80a4b80f8434a" ) );
+    BOOST_TEST_EQ( digest<sha3_256>( "abc" ), std::string( "3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532" ) );
+    BOOST_TEST_EQ( digest<sha3_256>( "The quick brown fox jumps over the lazy dog" ), std::string( "69070dda01975c8c120c3aada1b282394e7f032fa9cf32f4cb2259a0897dfc04" ) );
+
+    BOOST_TEST_EQ( digest<sha3_384>( "" ), std::string( "0c63a75b845e4f7d01107d852e4c2485c51a50aaaa94fc61995e71bbee983a2ac3713831264adb47fb6bd1e058d5f004" ) );
+    BOOST_TEST_EQ( digest<sha3_384>( "abc" ), std::string( "ec01498288516fc926459f58e2c6ad8df9b473cb0fc08c2596da7cf0e49be4b298d88cea927ac7f539f1edf228376d25" ) );
+    BOOST_TEST_EQ( digest<sha3_384>( "The quick brown fox jumps over the lazy dog" ), std::string( "7063465e08a93bce31cd89d2e3ca8f602498696e253592ed26f07bf7e703cf328581e1471a7ba7ab119b1a9ebdf8be41" ) );
+
+    BOOST_TEST_EQ( digest<sha3_512>( "" ), std::string( "a69f73cca23a9ac5c8b567dc185a756e97c982164fe25859e0d1dcc1475c80a615b2123af1f5f94c11e3e9402c3ac558f500199d95b6d3e301758586281dcd26" ) );
+    BOOST_TEST_EQ( digest<sha3_512>( "abc" ), std::string( "b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0" ) );
+    BOOST_TEST_EQ( digest<sha3_512>( "The quick brown fox jumps over the lazy dog" ), std::string( "01dedd5de4ef14642445ba5f5b97c15e47b9ad931326e4b0727cd94cefc44fff23f07bf543139939b49128caf436dc1bdee54fcb24023a08d9403f9b4bf0d450" ) );
+
+    BOOST_TEST_EQ( digest<shake128>( "" ), std::string( "7f9c2ba4e88f827d616045507605853ed73b8093f6efbc88eb1a6eacfa66ef26" ) );
+    BOOST_TEST_EQ( digest<shake128>( "abc" ), std::string( "5881092dd818bf5cf8a3ddb793fbcba74097d5c526a6d35f97b83351940f2cc8" ) );
+
+    BOOST_TEST_EQ( digest<shake256>( "" ), std::string( "46b9dd2b0ba88d13233b3feb743eeb243fcd52ea62b81b82b50c27646ed5762fd75dc4ddd8c0f200cb05019d67b592f6fc821c49479ab48640292eacb3b7c4be" ) );
+    BOOST_TEST_EQ( digest<shake256>( "abc" ), std::string( "483366601360a8771c6863080cc4114d8db44530f8f1e1ee4f94ea37e78b5739d5a15bef186a5386c75744c0527e1faa9f8726e462a12a4feb06bd8801e751e4" ) );
+
+    {
+        test_vector const tv[] =
+        {
+            { 71, "5e31d4bc8904e6e77531e6b975d3dcdd4330c03620e5204bc047ce2e" },
+            { 72, "0fdd8265d5382246a4eb6580df2452ffc3918cf04edd9fed88f566aa" },
+            { 73, "b1d7edc8a77c2457dd67597772ef2eb3360d6f2c48ce599cbd81f2cb" },
+            { 143, "64d0e8a1be3cf30ef6727b30a6e428f7f068d44634c943d277ad8e7f" },
+            { 144, "5be75e6a08f19913a1d8036c056cc4556b98dc90aeca3f2a0664dedc" },
+            { 145, "90b861ac1b1598459ad8337afa9933ce2f1a6f972c57daf8fc2737e4" },
+            { 1000, "51481b8dbd6b73dd110a967f438aa22facfcdce1eb5d2b36a5ec023f" },
+        };
+
+        test<sha3_224>( tv );
+    }
+
+    {
+        test_vector const tv[] =
+        {
+            { 71, "881ad9ffbd7f090efa51cbdfe93da23a0401f4446f7adf150d1c226851cbfff2" },
+            { 72, "fe58866b2893c6c40ee832ce40fb6eb4c70ff7c4794380d95c2ebeec62decd31" },
+            { 73, "797061b3aad8e724740c79dc697ef3de4c96c4db4483dba4e56f852222c72474" },
+            { 135, "fded8fd9d6551c601eeb3b7c6bc5e5cfd8aad1d015b7e9aaa9c9b9475231d5e2" },
+            { 136, "cf3ccff92480a29160c2d38317c430e14749bfee1788106957dfe73f8c4930e5" },
+            { 137, "ce9d7dc90913ee5d92745019479a5352c6d6279bef18ed07dc0a83ee8084daca" },
+            { 1000, "48e66a01861d0eadaacdb7a6ae7db6b9ac79242ecced4154a9fbb33c4e3cc571" },
+        };
+
+        test<sha3_256>( tv );
+    }
+
+    {
+        test_vector const tv[] =
+        {
+            { 71, "4bb4db01ac1c1d1a5de657436aca5275e4cae772bd6ab9b358e0ed094202be9600724a5bdfef0461ba7f1dc2427cf155" },
+            { 72, "240914a09175ad5bed4cc2486f1cb2160ee182e3b71e17efe5b82dfc0c8f0a8ad30c1e1a03ce42f31e5ea64074cd6f66" },
+            { 73, "8f8ead15c47cd6f89ed7110d454759903df4e1ff3e2229597893776cff5195de326080b897a3833c20325a3a127f9064" },
+            { 103, "1f91ee551ad18f268876d1fc262f137fe196580216c5193819a95ec5222537d2a658dd129c3d8080e65ec7460f1f4704" },
+            { 104, "5b8d0d5cf8b41be507be8fcbfcbdbac3a28eb368d430fed6780aaa78a93a8da4a6c50485949ca344f228be91a96005a3" },
+            { 105, "4a2f0a8f2f1f4cc4605cc2537e0be28cf8b465c30f0a54b494a7128ec54ee4e85706b5e47a5697344d15cbf85680cd40" },
+            { 1000, "43e60a7ef818a0e367fcd4ede8f5fabbdb7090cb45972bb7a84038cc3abf4fc26c4f44b59d3a0306c973b66e84c8890b" },
+        };
+
+        test<sha3_384>( tv );
+    }
+
+    {
+        test_vector const tv[] =
+        {
+            { 71, "3ccc850d53a1287af7b4560b2ef0d43eb5d9a80d62a0e9cf1dbc040135921104d4395168e90bfc871773ebb34bca1bd67056e1cc7dc7a48ff7c3167d389f117c" },
+            { 72, "5d63f2bbe971a983ac6847480106e4e1264ee3a0befd79954914e1d86e795b2e18238f12fc5e46cb9cc78efdec610a93647cc04e1c23d8caaa6a58c21dd26c07" },
+            { 73, "921d9b7b2b0f3066a1646dbb058c979cb3925dec0f8c269faaa7f9648e73465ae55ec527257d5d5e1cfdbf5d6799bea1004b6186f5108c74e3b92fe924166558" },
+            { 144, "e1951b8bcb58ca75a34af80a7a2b765cad4257fe383a79b55bf21f180b75f6e5b08f09598851eeea7d13486387618d6c6bf88cf23c0088a3f783f59a06d60493" },
+            { 145, "1abec62dce93a6775cd2ec0098d7264676a21e644c7c1b80580c305cfde31b7d5848c63af4d0e7cfeda2e5076a32dbd632665fbb1e7f06651b2ed4d7341ac844" },
+            { 1000, "b8030d306ae990bc794bfb3a6100f67851889d6c272257afac7d1077a18660d6ea8d0da5d2299c3ebaa0d34baf62cc58ac1fd4476506cf512a4897bb083a6fc4" },
+        };
+
+        test<sha3_512>( tv );
+    }
+
+    {
+        test_vector const tv[] =
+        {
+            { 135, "d11fafa27f42a8162b8ae013535771de81722c0abc8aa2bca01825462e2f8971" },
+            { 136, "30bdfd69382cab028173fba7c6d53878ec18081358e52c955dc6f5d52b60b029" },
+            { 137, "047a94427406b3ac81270fe1c3aafe1594f121bdca236dcb2c01cd977b41ee02" },
+            { 167, "1e552791cc4e93a0d4a8dc47ae49228c2faa869e40e628f6ace477aec3f1ca7a" },
+            { 168, "f15277eb61c4908d44a2853f3cde071ae2ed7a23461fbe162a1a98cf6875059c" },
+            { 169, "015be3338c986d9846affa0f94b4afc2a76bc289c709e1a596ec9eccf090a773" },
+            { 1000, "a72440f7f5aa7c14c8e0187420611da7e2ba62f5bb2e88a91b9c9448cac30078" },
+        };
+
+        test<shake128>( tv );
+    }
+
+    {
+        test_vector const tv[] =
+        {
+            { 135, "c45dae624ad8a2f5aa7bac9d7557737fd91c96eedb70a6be5574d57a844eade07f4056bf081a1098101cea8132188c422136feb4687d1e2209f3fd28bedfb8f4" },
+            { 136, "b7ff4073b3f5a8eabd6e17705ca7f6761a31058f9df781a6a47e3a3063b9d67a757e8dbf043dac48d2154e46d59c0b9e8bc36ba035153691fbe83b9eff5dae4a" },
+            { 137, "01d90952c642a5eb2a8fc9d713f843a45d7ac05132dddcb2efc9bebc27e37bcbe42130c36f3540250ab11796980e773683f28d07f0f838606fb9c45e452bd38f" },
+            { 167, "989a61fbdb26d1695f841faaef850de4e5ca0095ea4c7511c54f0b0a098e8fade8743cf73f9781dab695685a356ccdd1c7da4790f7f4c7bb0bfa0e044b23c48a" },
+            { 168, "1687771440dbcdaa8af7049dd319414a12a702caa4809a0ded089cb659219ea4b6385175ae6c8bb65d04a1a015d848a52d61b8c60e0a7c748ed963974ea70bb0" },
+            { 169, "d639f47fb6b6836625c047a8240313bba11e3b7e479595b43b48ecd35cc89e9e4a44c78c1fc60e1f4b7c56c9568c78e8581207f66df0fe1bfbec31fab303818f" },
+            { 1000, "34833f03ed88bb5f083ce590c7ae5af93ede33e11f53c70e47916c7044746acbdca19a73ff13905e91f8dc25ce6e41ae59fe75441bd548dda9114aca1da71802" },
+        };
+
+        test<shake256>( tv );
+    }
+
+    // long inputs
+
+    {
+        std::string s( 1000000, 'a' );
+
+        BOOST_TEST_EQ( digest<sha3_224>( s ), std::string( "d69335b93325192e516a912e6d19a15cb51c6ed5c15243e7a7fd653c" ) );
+        BOOST_TEST_EQ( digest<sha3_256>( s ), std::string( "5c8875ae474a3634ba4fd55ec85bffd661f32aca75c6d699d0cdcb6c115891c1" ) );
+        BOOST_TEST_EQ( digest<sha3_384>( s ), std::string( "eee9e24d78c1855337983451df97c8ad9eedf256c6334f8e948d252d5e0e76847aa0774ddb90a842190d2c558b4b8340" ) );
+        BOOST_TEST_EQ( digest<sha3_512>( s ), std::string( "3c3a876da14034ab60627c077bb98f7e120a2a5370212dffb3385a18d4f38859ed311d0a9d5141ce9cc5c66ee689b266a8aa18ace8282a0e0db596c90b0a7b87" ) );
+        BOOST_TEST_EQ( digest<shake128>( s ), std::string( "9d222c79c4ff9d092cf6ca86143aa411e369973808ef97093255826c5572ef58" ) );
+        BOOST_TEST_EQ( digest<shake256>( s ), std::string( "3578a7a4ca9137569cdf76ed617d31bb994fca9c1bbf8b184013de8234dfd13a3fd124d4df76c0a539ee7dd2f6e1ec346124c815d9410e145eb561bcd97b18ab" ) );
+    }
+
+    test_squeeze<shake128>( "75375faad996eb1b9176ecb0f8b2871723d6dbb804e23357e50732f5cfc904b1" );
+    test_squeeze<shake256>( "0549dc2539de9e6a9d1e596111b660cb6b3e0040b4d4916f886dd0b6f1a702849440b99d6088e20203aebafa8e9dffa94ed35ef1f41f5fdf549fbcc5a0f68298" );
+
+    // HMAC, checked against Python's hmac module
+
+    {
+        hmac_sha3_256 h( reinterpret_cast<unsigned char const*>( "key" ), 3 );
+        h.update( "The quick brown fox jumps over the lazy dog", 43 );
+
+        BOOST_TEST_EQ( to_string( h.result() ), std::string( "8c6e0683409427f8931711b10ca92a506eb1fafa48fadd66d76126f47ac2c333" ) );
+    }
+
+    {
+        hmac_sha3_512 h( reinterpret_cast<unsigned char const*>( "key" ), 3 );
+        h.update( "The quick brown fox jumps over the lazy dog", 43 );
+
+        BOOST_TEST_EQ( to_string( h.result() ), std::string( "237a35049c40b3ef5ddd960b3dc893d8284953b9a4756611b1b61bffcf53edd979f93547db714b06ef0a692062c609b70208ab8d4a280ceee40ed8100f293063" ) );
+    }
+
+    test_kernels();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,110 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstring>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+BOOST_CXX14_CONSTEXPR unsigned char to_byte( char c )
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return 0xff;
+}
+
+template<std::size_t N, std::size_t M = ( N - 1 ) / 2>
+BOOST_CXX14_CONSTEXPR boost::hash2::digest<M> digest_from_hex( char const (&str)[ N ] )
+{
+    boost::hash2::digest<M> dgst = {};
+    auto* p = dgst.data();
+    for( unsigned i = 0; i < M; ++i ) {
+        auto c1 = to_byte( str[ 2 * i ] );
+        auto c2 = to_byte( str[ 2 * i + 1 ] );
+        p[ i ] = ( c1 << 4 ) | c2;
+    }
+    return dgst;
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v21[ 21 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v300[ 300 ] = {};
+
+    TEST_EQ( test<sha3_256>( 0, v21 ), digest_from_hex( "e32a0857cae2af23157a707c288e8868ac085324c8681f6b8a4665979c6a071e" ) );
+    TEST_EQ( test<sha3_256>( 0, v45 ), digest_from_hex( "98ae4e8a879690d44b24493d3404d622f4e31c25ddef2e5b3da12f4426e46d98" ) );
+    TEST_EQ( test<sha3_256>( 0, v300 ), digest_from_hex( "ebb604bbfbc08388c91f05a674612a47a4aa6b01b6021d9aaf0ae70952f29b26" ) );
+
+    TEST_EQ( test<sha3_256>( 7, v21 ), digest_from_hex( "4121dabbd4929dfd01caa19f74a4caffe35ec1f6bcb1fdab52a7c7b40f5365e0" ) );
+    TEST_EQ( test<sha3_256>( 7, v45 ), digest_from_hex( "b51e4b6a138ba20f7cddd7652293c8c0e8659b027474d928d8920a473d06bd9d" ) );
+    TEST_EQ( test<sha3_256>( 7, v300 ), digest_from_hex( "25ceff3319d19217acf7f968cf6ed17628bf35f39c8eb9be22d2c20afbaf5b30" ) );
+
+    TEST_EQ( test<sha3_224>( 0, v21 ), digest_from_hex( "b902d12e0b8e719e0952fffa7f842f3f50512ea74877a7c9660ff321" ) );
+    TEST_EQ( test<sha3_224>( 0, v45 ), digest_from_hex( "500bf3d18d5423eaf4dd5b723d25566f68a32b9f8826b5eaeac7452b" ) );
+    TEST_EQ( test<sha3_224>( 0, v300 ), digest_from_hex( "4b2de530dea2eb1eb640658b75b4fd961377d5f7d80e12ee0ba8d4e6" ) );
+
+    TEST_EQ( test<sha3_224>( 7, v21 ), digest_from_hex( "934b11462da9f6f62ec4d5b85027882d52b500a4aec7908a12068d59" ) );
+    TEST_EQ( test<sha3_224>( 7, v45 ), digest_from_hex( "5dbdd2555db6dc9b26e063d6e4b91106d64146eac2b02342d99c7b90" ) );
+    TEST_EQ( test<sha3_224>( 7, v300 ), digest_from_hex( "2e77dde7ea0813eb1ecf7b7c274e13aabd2d354b4232f01f05368a73" ) );
+
+    TEST_EQ( test<sha3_512>( 0, v21 ), digest_from_hex( "fd3d300d34e74e666d8af9092768cd5cdd801af9b05dfcd4f1b7c71bbe0f0cf2648babda613ce2e115b97eacb6040653c56c855d4ed5991c60edfb89d5353b52" ) );
+    TEST_EQ( test<sha3_512>( 0, v45 ), digest_from_hex( "38f653d8fbdf4302cda1b0bff05488f4195c6d9ebcaada3315cf79640f53368755e5b17f438c6b0e2105d3a2803f4c4bf264491dfac774783334ade5e07abf50" ) );
+    TEST_EQ( test<sha3_512>( 0, v300 ), digest_from_hex( "761189d92ddaf62e3d5ed385ca9efcc90d9d03e679dbab3a6b9a693e05dc7ae255b8117c7812abd58a083608270616f747929ad0fe3354e1a5d9e919ac3533f0" ) );
+
+    TEST_EQ( test<sha3_512>( 7, v21 ), digest_from_hex( "ca7ad870d054fda189e60c2e0ea84ec48354a38b9882b268d655b0fc8f8d48358ff90ec1573fdb6fd6d121a4bb8decb6a0e31cfbfd6095adbde0f0ea552a922d" ) );
+    TEST_EQ( test<sha3_512>( 7, v45 ), digest_from_hex( "0c0f404d5dcfcb25a3a433d7428a57815025e6dc3a6d66d219f17ee27d97b423f2dec7fde8aabcc3875c88a858088b66a4d55eaaa65f0d62582a14c05f7314e9" ) );
+    TEST_EQ( test<sha3_512>( 7, v300 ), digest_from_hex( "b02f54cbeba096cbe2677dc39b7da2d5d9be5531ec914e1ebd2fd230d93666087a7f96389184b9a2f732ee39c521bf8c9122396d3fe4f633c5ee58bb5265198c" ) );
+
+    TEST_EQ( test<sha3_384>( 0, v21 ), digest_from_hex( "2ce5d7b60540e06aac274af1553b8613f0acd9fa108697535fcdc672c6331518fd338622f3df7a50f022b0214d731a99" ) );
+    TEST_EQ( test<sha3_384>( 0, v45 ), digest_from_hex( "5be135db5fdac2c6b99e4b12dc8a062aaf685ba9e1b20b32f8946c6a651b38e54a080b095678051a0da0e9cb0259d2bc" ) );
+    TEST_EQ( test<sha3_384>( 0, v300 ), digest_from_hex( "9209a5584be9da90da28ca2d10c99b6ddadaf43f814e99e3b2d440eb8667b60e414609337e4eca92d9a8dc8dd21dca80" ) );
+
+    TEST_EQ( test<sha3_384>( 7, v21 ), digest_from_hex( "02ff5fd69e2ddbe5f9ffbe42d101737d8e8b5ac81475dde66d7910f492e1a181fc00be9f653cdf021cc1dc73c1b489e8" ) );
+    TEST_EQ( test<sha3_384>( 7, v45 ), digest_from_hex( "21a6400a52717f8e0244dd8d3bc6ff16d8f955a012ce3a1c53dc88b0c453f11398e989c87d59eb68d0fcd6d00340c0f4" ) );
+    TEST_EQ( test<sha3_384>( 7, v300 ), digest_from_hex( "0bc4c1affa58816c03239b4b8ee2d36e821dbefd8a42adb1c75bea0ea2b41c12b4d817dc0e68a10ff9a099390ebc6cfc" ) );
+
+    TEST_EQ( test<shake128>( 0, v21 ), digest_from_hex( "bbb5fa1410600373208b3deb7e7bc8551f60c5f7a38cd4eeb50550bee3d19737" ) );
+    TEST_EQ( test<shake128>( 0, v45 ), digest_from_hex( "9438e6144429024d106e0b850008b9747ad5febe4bf4d2ba302ca8e45fefacd4" ) );
+    TEST_EQ( test<shake128>( 0, v300 ), digest_from_hex( "65f5c9301a6a8c9594493e030e4488dbb78363f1809597ded283e1d5bb681b63" ) );
+
+    TEST_EQ( test<shake128>( 7, v21 ), digest_from_hex( "f2ef5bc33326db56d7343ae292b1d1ddea9a69ef7a7afae6e83eeb8c8ce02296" ) );
+    TEST_EQ( test<shake128>( 7, v45 ), digest_from_hex( "8892d0919c1a805a17ec04d547e06b10a2392598ba247fbcdcddb8e264fc26d6" ) );
+    TEST_EQ( test<shake128>( 7, v300 ), digest_from_hex( "fe2efa91e996110bd5904b6c84632161c58ceecb5d13e07967c8b69ef59092a1" ) );
+
+    TEST_EQ( test<shake256>( 0, v21 ), digest_from_hex( "d527d3d7b413dd36d1abaa4b256c1eda2d37359e3fad8ea1d3ebd87f903dfb9a496cafad760540de3769b76fd052cb841ba3835c6358084cc7edaceb71c29e12" ) );
+    TEST_EQ( test<shake256>( 0, v45 ), digest_from_hex( "921ec6e4203bb5bac2bcfc65d8a5a93c031682b3449fa116aeadf7cdc8b5705d8e0460b686bdfcca9a8e33ce98a432eb6c80449979ea1aebce6bb3c7f240149e" ) );
+    TEST_EQ( test<shake256>( 0, v300 ), digest_from_hex( "1c2824e604d1c48747bcd9ddc63743436dc38c1fec0dfa5a24581a6570cee7b068a24aa6849cf4a125cafadc4133e9a4c6ee76e0c68557dd69e436d58f310ba5" ) );
+
+    TEST_EQ( test<shake256>( 7, v21 ), digest_from_hex( "b70f3e142e0e03c9580be01c21ff49429930465a5a19a0a2b40326e1ce314e52859c4f98970445b577e13a279ec23c3db800170c0ca16b305e3bdaea12253263" ) );
+    TEST_EQ( test<shake256>( 7, v45 ), digest_from_hex( "961df12a8a9980c6019a3b4289bc47433ed1066c5b0857d85822c5982561e75c6b3a71a2a332bfc2d21fb87d5c78573d96e350abc792aa4332d641640a6b2c3b" ) );
+    TEST_EQ( test<shake256>( 7, v300 ), digest_from_hex( "6d4298e2d2ca4bddc480c60705961da7db36808a93a57badcd8b2ce34f485b240e7e11a44a4c1a6cc3cbeae1541df8d751f50483a5cdcb2cc20dd4f0b67f9f6a" ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,87 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/simhash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+template<class H> static void test()
+{
+    simhash<H> sh( 7 );
+
+    std::vector<std::string> a;
+
+    for( int i = 0; i < 200; ++i )
+    {
+        a.push_back( "token" + std::to_string( i ) );
+    }
+
+    std::uint64_t sa = sh.signature( a );
+
+    BOOST_TEST_EQ( sh.signature( a.begin(), a.end() ), sa );
+    BOOST_TEST_EQ( simhash<H>::distance( sa, sa ), 0 );
+
+    // a sequence with a few tokens changed is close
+
+    std::vector<std::string> b( a );
+
+    for( int i = 0; i < 10; ++i )
+    {
+        b[ i * 20 ] = "other" + std::to_string( i );
+    }
+
+    int d1 = simhash<H>::distance( sa, sh.signature( b ) );
+
+    // an unrelated sequence is at about 32
+
+    std::vector<std::string> c;
+
+    for( int i = 0; i < 200; ++i )
+    {
+        c.push_back( "unrelated" + std::to_string( i ) );
+    }
+
+    int d2 = simhash<H>::distance( sa, sh.signature( c ) );
+
+    BOOST_TEST_LT( d1, 16 );
+    BOOST_TEST_GT( d2, 16 );
+    BOOST_TEST_LT( d1, d2 );
+
+    // the order doesn't matter
+
+    std::vector<std::string> e( a.rbegin(), a.rend() );
+    BOOST_TEST_EQ( sh.signature( e ), sa );
+
+    // a single token gives its hash value
+
+    {
+        std::string const t[] = { "abc" };
+        BOOST_TEST_EQ( sh.signature( t ), ( hash<std::string, H>( 7 )( t[ 0 ] ) ) );
+    }
+}
+
+int main()
+{
+    test<xxhash_64>();
+    test<xxh3_128>();
+    test<siphash_64>();
+
+    BOOST_TEST_EQ( simhash<xxhash_64>::distance( 0, ~std::uint64_t( 0 ) ), 64 );
+    BOOST_TEST_EQ( simhash<xxhash_64>::distance( 0x0F, 0xF0 ), 8 );
+
+    {
+        std::vector<int> v;
+        BOOST_TEST_EQ( simhash<xxhash_64>().signature( v ), 0u );
+    }
+
+    return boost::report_errors();
+}
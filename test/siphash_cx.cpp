@@ -48,5 +48,11 @@ int main()
     TEST_EQ( test<siphash_64>( seed, v21 ), 17634937937087799533ull );
     TEST_EQ( test<siphash_64>( seed, v45 ), 7083435387605517692 );
 
+    TEST_EQ( test<siphash13_32>( seed, v21 ), 1934976922 );
+    TEST_EQ( test<siphash13_32>( seed, v45 ), 4030336022 );
+
+    TEST_EQ( test<siphash13_64>( seed, v21 ), 9823543503748598921ull );
+    TEST_EQ( test<siphash13_64>( seed, v45 ), 4929931668049837492 );
+
     return boost::report_errors();
 }
@@ -0,0 +1,101 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/tabulation.hpp>
+#include <boost/hash2/mix.hpp>
+#include <boost/hash2/polymur.hpp>
+#include <boost/hash2/poly1305.hpp>
+#include <boost/hash2/ghash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/rapidhash.hpp>
+#include <boost/hash2/aes_hash.hpp>
+#include <boost/hash2/highwayhash.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/ripemd.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/hash2/blake3.hpp>
+#include <boost/hash2/sha3.hpp>
+#include <boost/hash2/k12.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/crc32.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+
+// The documented object sizes, on 64 bit platforms
+
+template<class H> void test( std::size_t n )
+{
+    if( sizeof( void* ) == 8 )
+    {
+        BOOST_TEST_EQ( sizeof( H ), n );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_32>( 4 );
+    test<boost::hash2::fnv1a_64>( 8 );
+    test<boost::hash2::fnv1a_64_wide>( 32 );
+    test<boost::hash2::tabulation_64>( 32 );
+    test<boost::hash2::mix32>( 16 );
+    test<boost::hash2::mix64>( 24 );
+    test<boost::hash2::polymur_64>( 144 );
+    test<boost::hash2::poly1305>( 80 );
+    test<boost::hash2::ghash>( 56 );
+    test<boost::hash2::xxhash_32>( 40 );
+    test<boost::hash2::xxhash_64>( 72 );
+    test<boost::hash2::xxh3_64>( 544 );
+    test<boost::hash2::xxh3_128>( 544 );
+    test<boost::hash2::rapidhash_64>( 152 );
+    test<boost::hash2::aes_hash_128>( 200 );
+    test<boost::hash2::highwayhash_64>( 168 );
+    test<boost::hash2::highwayhash_128>( 168 );
+    test<boost::hash2::highwayhash_256>( 168 );
+    test<boost::hash2::siphash_32>( 28 );
+    test<boost::hash2::siphash_64>( 56 );
+    test<boost::hash2::siphash13_32>( 28 );
+    test<boost::hash2::siphash13_64>( 56 );
+    test<boost::hash2::crc32c>( 4 );
+    test<boost::hash2::crc32>( 4 );
+    test<boost::hash2::crc64_xz>( 8 );
+    test<boost::hash2::crc64_nvme>( 8 );
+    test<boost::hash2::adler32>( 8 );
+
+    test<boost::hash2::md5_128>( 96 );
+    test<boost::hash2::sha1_160>( 104 );
+    test<boost::hash2::sha2_256>( 112 );
+    test<boost::hash2::sha2_224>( 112 );
+    test<boost::hash2::sha2_512>( 208 );
+    test<boost::hash2::sha2_384>( 208 );
+    test<boost::hash2::sha2_512_224>( 208 );
+    test<boost::hash2::sha2_512_256>( 208 );
+    test<boost::hash2::ripemd_160>( 104 );
+    test<boost::hash2::ripemd_128>( 96 );
+    test<boost::hash2::blake2b_512>( 280 );
+    test<boost::hash2::blake2s_256>( 144 );
+    test<boost::hash2::blake3>( 1856 );
+    test<boost::hash2::sha3_256>( 344 );
+    test<boost::hash2::sha3_224>( 352 );
+    test<boost::hash2::sha3_512>( 280 );
+    test<boost::hash2::sha3_384>( 312 );
+    test<boost::hash2::shake128>( 392 );
+    test<boost::hash2::shake256>( 360 );
+    test<boost::hash2::k12>( 776 );
+
+    test<boost::hash2::xxhash_32_noscrub>( sizeof( boost::hash2::xxhash_32 ) );
+    test<boost::hash2::xxhash_64_noscrub>( sizeof( boost::hash2::xxhash_64 ) );
+    test<boost::hash2::xxh3_64_noscrub>( sizeof( boost::hash2::xxh3_64 ) );
+    test<boost::hash2::xxh3_128_noscrub>( sizeof( boost::hash2::xxh3_128 ) );
+
+    test<boost::hash2::hmac_sha2_256>( 2 * sizeof( boost::hash2::sha2_256 ) );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,139 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/snapshot_result.hpp>
+#include <boost/hash2/md5.hpp>
+#include <boost/hash2/sha1.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/blake2.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <boost/config.hpp>
+#include <cstddef>
+
+template<class H> void test()
+{
+    using namespace boost::hash2;
+
+    unsigned char buffer[ 1024 ];
+
+    for( std::size_t i = 0; i < sizeof( buffer ); ++i )
+    {
+        buffer[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+    }
+
+    H h;
+
+    // intermediate digests after updates of all sizes, so that every
+    // position in the block, and both paddings, are covered
+
+    std::size_t n = 0;
+
+    for( std::size_t k = 0; n + k <= sizeof( buffer ); ++k )
+    {
+        h.update( buffer + n, k );
+        n += k;
+
+        H h2( h );
+        typename H::result_type r = h2.result();
+
+        BOOST_TEST( h.snapshot_result() == r );
+        BOOST_TEST( snapshot_result( h ) == r );
+
+        // h is unchanged
+
+        H h3;
+        h3.update( buffer, n );
+
+        BOOST_TEST( h.snapshot_result() == h3.result() );
+    }
+
+    {
+        H h2;
+        h2.update( buffer, n );
+
+        BOOST_TEST( h.result() == h2.result() );
+    }
+
+    // after result()
+
+    {
+        H h2( h );
+
+        BOOST_TEST( h.snapshot_result() == h2.result() );
+    }
+}
+
+// algorithms without the member function are copied
+
+template<class H> void test_copy()
+{
+    using namespace boost::hash2;
+
+    BOOST_TEST_TRAIT_FALSE(( detail::has_snapshot_result<H> ));
+
+    H h;
+    h.update( "abc", 3 );
+
+    H h2( h );
+    BOOST_TEST( snapshot_result( h ) == h2.result() );
+
+    // h is unchanged
+
+    h.update( "def", 3 );
+
+    H h3;
+    h3.update( "abcdef", 6 );
+
+    BOOST_TEST( h.result() == h3.result() );
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+template<class H> BOOST_CXX14_CONSTEXPR typename H::result_type constexpr_snapshot()
+{
+    H h;
+
+    unsigned char const p[] = { 'a', 'b', 'c' };
+    h.update( p, 3 );
+
+    return h.snapshot_result();
+}
+
+#endif
+
+int main()
+{
+    test<boost::hash2::md5_128>();
+    test<boost::hash2::sha1_160>();
+    test<boost::hash2::sha2_256>();
+    test<boost::hash2::sha2_224>();
+    test<boost::hash2::sha2_512>();
+    test<boost::hash2::sha2_384>();
+    test<boost::hash2::sha2_512_224>();
+    test<boost::hash2::sha2_512_256>();
+    test<boost::hash2::xxhash_32>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxhash_64_noscrub>();
+
+    test_copy<boost::hash2::fnv1a_64>();
+    test_copy<boost::hash2::blake2b_512>();
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+    {
+        constexpr auto r = constexpr_snapshot<boost::hash2::sha2_256>();
+
+        boost::hash2::sha2_256 h;
+        h.update( "abc", 3 );
+
+        BOOST_TEST( r == h.result() );
+    }
+
+#endif
+
+    return boost::report_errors();
+}
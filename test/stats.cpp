@@ -0,0 +1,170 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_HASH2_ENABLE_STATS
+
+#include <boost/hash2/stats.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/crc32.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <thread>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+using boost::hash2::algorithm_stats;
+
+static algorithm_stats get( char const* name )
+{
+    std::vector<algorithm_stats> v = boost::hash2::stats_snapshot();
+
+    for( algorithm_stats const& s: v )
+    {
+        if( std::strcmp( s.name, name ) == 0 ) return s;
+    }
+
+    algorithm_stats s = { name, 0, 0, 0 };
+    return s;
+}
+
+// the counts of `name` since s0
+
+static void test_delta( algorithm_stats const& s0, std::uint64_t update_calls, std::uint64_t bytes, std::uint64_t result_calls )
+{
+    algorithm_stats s1 = get( s0.name );
+
+    BOOST_TEST_EQ( s1.update_calls - s0.update_calls, update_calls );
+    BOOST_TEST_EQ( s1.bytes - s0.bytes, bytes );
+    BOOST_TEST_EQ( s1.result_calls - s0.result_calls, result_calls );
+}
+
+int main()
+{
+    unsigned char buffer[ 256 ] = {};
+
+    // update and result
+
+    {
+        algorithm_stats s0 = get( "sha2_256" );
+
+        boost::hash2::sha2_256 h;
+
+        h.update( buffer, 3 );
+        h.update( buffer, 100 );
+        h.result();
+
+        test_delta( s0, 2, 103, 1 );
+    }
+
+    // seeding and padding aren't counted
+
+    {
+        algorithm_stats s0 = get( "sha2_256" );
+
+        boost::hash2::sha2_256 h1( 7 );
+        boost::hash2::sha2_256 h2( buffer, 50 );
+
+        test_delta( s0, 0, 0, 0 );
+
+        h1.update( buffer, 1 );
+        h1.result();
+        h1.result();
+
+        test_delta( s0, 1, 1, 2 );
+    }
+
+    {
+        algorithm_stats s0 = get( "crc32" );
+
+        boost::hash2::crc32 h( 1 );
+
+        h.update( buffer, 10 );
+        h.result();
+
+        test_delta( s0, 1, 10, 1 );
+    }
+
+    // update_word counts as an update of 8 bytes
+
+    {
+        algorithm_stats s0 = get( "fnv1a_64" );
+
+        boost::hash2::fnv1a_64 h;
+
+        h.update_word( 1 );
+        h.update( buffer, 5 );
+        h.result();
+
+        test_delta( s0, 2, 13, 1 );
+    }
+
+    // one-shot hashing counts as an update and a result
+
+    {
+        unsigned char const key[ 16 ] = {};
+
+        algorithm_stats s0 = get( "siphash_64" );
+
+        boost::hash2::siphash_64::hash( key, buffer, 40 );
+
+        test_delta( s0, 1, 40, 1 );
+    }
+
+    // the counts of a thread remain after it exits
+
+    {
+        algorithm_stats s0 = get( "xxhash_64" );
+
+        std::thread th( [&]{
+
+            boost::hash2::xxhash_64 h;
+
+            h.update( buffer, 17 );
+            h.result();
+
+        });
+
+        th.join();
+
+        test_delta( s0, 1, 17, 1 );
+    }
+
+    // and are summed with those of the other threads
+
+    {
+        algorithm_stats s0 = get( "xxhash_64" );
+
+        std::thread th[ 4 ];
+
+        for( int i = 0; i < 4; ++i )
+        {
+            th[ i ] = std::thread( [&]{
+
+                for( int j = 0; j < 100; ++j )
+                {
+                    boost::hash2::xxhash_64 h;
+
+                    h.update( buffer, 2 );
+                    h.result();
+                }
+
+            });
+        }
+
+        boost::hash2::xxhash_64 h;
+        h.update( buffer, 1 );
+
+        for( int i = 0; i < 4; ++i )
+        {
+            th[ i ].join();
+        }
+
+        test_delta( s0, 401, 801, 400 );
+    }
+
+    return boost::report_errors();
+}
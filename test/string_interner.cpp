@@ -0,0 +1,154 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/string_interner.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <unordered_set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstddef>
+
+template<class H> void test()
+{
+    using namespace boost::hash2;
+
+    string_interner<H> si;
+
+    interned_string a = si.intern( "foo" );
+    interned_string b = si.intern( std::string( "bar" ) );
+    interned_string c = si.intern( "foobar", 3 );
+    interned_string e = si.intern( "" );
+
+    BOOST_TEST( a );
+    BOOST_TEST( b );
+    BOOST_TEST( e );
+
+    BOOST_TEST( a == c );
+    BOOST_TEST( a != b );
+    BOOST_TEST( a != e );
+
+    BOOST_TEST_EQ( a.str(), std::string( "foo" ) );
+    BOOST_TEST_EQ( std::string( b.c_str() ), std::string( "bar" ) );
+    BOOST_TEST_EQ( a.size(), 3u );
+    BOOST_TEST( e.empty() );
+    BOOST_TEST_EQ( e.size(), 0u );
+
+    BOOST_TEST_EQ( si.size(), 3u );
+
+    // the stored hash values are those of the hasher
+
+    typename string_interner<H>::hasher hf;
+
+    BOOST_TEST_EQ( a.hash_value(), hf( std::string( "foo" ) ) );
+    BOOST_TEST_EQ( b.hash_value(), hf( std::string( "bar" ) ) );
+    BOOST_TEST_EQ( e.hash_value(), hf( std::string() ) );
+
+    BOOST_TEST_EQ( (hash<interned_string, H>()( a )), a.hash_value() );
+
+    // find
+
+    BOOST_TEST( si.find( "foo" ) == a );
+    BOOST_TEST( si.find( std::string( "bar" ) ) == b );
+    BOOST_TEST( !si.find( "baz" ) );
+
+    interned_string d;
+
+    BOOST_TEST( !d );
+    BOOST_TEST( d.empty() );
+    BOOST_TEST_EQ( d.hash_value(), 0u );
+    BOOST_TEST_EQ( std::string( d.c_str() ), std::string() );
+
+    // the tables grow, and the handles remain valid
+
+    std::vector<interned_string> v;
+
+    for( int i = 0; i < 20000; ++i )
+    {
+        v.push_back( si.intern( std::to_string( i ) ) );
+    }
+
+    BOOST_TEST_EQ( si.size(), 20003u );
+
+    BOOST_TEST( si.intern( "foo" ) == a );
+
+    for( int i = 0; i < 20000; ++i )
+    {
+        std::string s = std::to_string( i );
+
+        BOOST_TEST( si.intern( s ) == v[ i ] );
+        BOOST_TEST( si.find( s ) == v[ i ] );
+        BOOST_TEST_EQ( v[ i ].str(), s );
+        BOOST_TEST_EQ( v[ i ].hash_value(), hf( s ) );
+    }
+
+    // long strings
+
+    {
+        std::string s( 100000, 'x' );
+
+        interned_string x = si.intern( s );
+
+        BOOST_TEST_EQ( x.str(), s );
+        BOOST_TEST( si.intern( s ) == x );
+    }
+
+    // the handles are keys
+
+    std::unordered_set< interned_string, hash<interned_string, H> > st( v.begin(), v.end() );
+    BOOST_TEST_EQ( st.size(), 20000u );
+}
+
+static void test_threads()
+{
+    using namespace boost::hash2;
+
+    string_interner<xxhash_64, default_flavor, 8> si;
+
+    std::size_t const n = 10000;
+
+    std::vector< std::vector<interned_string> > r( 4, std::vector<interned_string>( n ) );
+    std::vector<std::thread> th;
+
+    for( std::size_t t = 0; t < 4; ++t )
+    {
+        th.emplace_back( [&, t]{
+
+            for( std::size_t i = 0; i < n; ++i )
+            {
+                // in a different order in each thread
+
+                std::size_t j = t & 1? n - 1 - i: i;
+                r[ t ][ j ] = si.intern( std::to_string( j ) );
+            }
+
+        });
+    }
+
+    for( auto& x: th ) x.join();
+
+    BOOST_TEST_EQ( si.size(), n );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        BOOST_TEST( r[ 0 ][ i ] == r[ 1 ][ i ] );
+        BOOST_TEST( r[ 0 ][ i ] == r[ 2 ][ i ] );
+        BOOST_TEST( r[ 0 ][ i ] == r[ 3 ][ i ] );
+
+        BOOST_TEST_EQ( r[ 0 ][ i ].str(), std::to_string( i ) );
+    }
+}
+
+int main()
+{
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::xxhash_64>();
+    test<boost::hash2::xxhash_32>();
+
+    test_threads();
+
+    return boost::report_errors();
+}
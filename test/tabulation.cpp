@@ -0,0 +1,195 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/tabulation.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+using boost::hash2::tabulation_64;
+
+static void test( char const * s, std::uint64_t seed, std::uint64_t r )
+{
+    std::size_t n = std::strlen( s );
+
+    {
+        tabulation_64 h( seed );
+
+        h.update( s, n );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    // byte at a time, and every split point
+
+    {
+        tabulation_64 h( seed );
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            h.update( s + i, 1 );
+        }
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    for( std::size_t i = 0; i <= n; ++i )
+    {
+        tabulation_64 h( seed );
+
+        h.update( s, i );
+        h.update( s + i, n - i );
+
+        BOOST_TEST_EQ( h.result(), r );
+    }
+
+    BOOST_TEST_EQ( tabulation_64::hash( s, n, seed ), r );
+}
+
+// the simple tabulation hash of x
+
+static std::uint64_t tabulate( std::uint64_t x )
+{
+    std::uint64_t r = 0;
+
+    for( int j = 0; j < 8; ++j )
+    {
+        r ^= boost::hash2::detail::tabulation_constants<>::table[ j ][ ( x >> ( j * 8 ) ) & 0xFF ];
+    }
+
+    return r;
+}
+
+static void test_batch( std::uint64_t seed )
+{
+    tabulation_64 const h0( seed );
+
+    std::vector<unsigned char> v( 64 * 16 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 37 + 11 );
+    }
+
+    // keys of eight bytes, of fewer, and runs of them broken by
+    // an empty or a longer key
+
+    std::size_t const sizes[][ 3 ] = { { 8, 8, 8 }, { 1, 4, 8 }, { 4, 4, 4 }, { 8, 0, 8 }, { 8, 13, 8 }, { 3, 16, 0 } };
+
+    for( auto const& s: sizes )
+    {
+        for( std::size_t k = 0; k <= 64; ++k )
+        {
+            unsigned char const* p[ 64 ];
+            std::size_t n[ 64 ];
+            std::uint64_t out[ 64 ];
+
+            for( std::size_t i = 0; i < k; ++i )
+            {
+                p[ i ] = v.data() + i * 16;
+                n[ i ] = i % 11 == 10? s[ 1 ]: i % 3 == 2? s[ 2 ]: s[ 0 ];
+            }
+
+            h0.hash_batch( p, n, k, out );
+
+            for( std::size_t i = 0; i < k; ++i )
+            {
+                tabulation_64 h( h0 );
+
+                h.update( p[ i ], n[ i ] );
+                BOOST_TEST_EQ( out[ i ], h.result() );
+            }
+        }
+    }
+
+    // a partial word in the hash object
+
+    {
+        tabulation_64 h1( h0 );
+        h1.update( "abc", 3 );
+
+        unsigned char const* p[ 16 ];
+        std::size_t n[ 16 ];
+        std::uint64_t out[ 16 ];
+
+        for( std::size_t i = 0; i < 16; ++i )
+        {
+            p[ i ] = v.data() + i * 8;
+            n[ i ] = 8;
+        }
+
+        h1.hash_batch( p, n, 16, out );
+
+        for( std::size_t i = 0; i < 16; ++i )
+        {
+            tabulation_64 h( h1 );
+
+            h.update( p[ i ], n[ i ] );
+            BOOST_TEST_EQ( out[ i ], h.result() );
+        }
+    }
+}
+
+int main()
+{
+    // reference values
+
+    test( "", 0, 0x0000000000000000ull );
+    test( "a", 0, 0x32a28636f7598d6aull );
+    test( "abc", 0, 0x4800d01c77af3d91ull );
+    test( "message digest", 0, 0x2bbe64ea93ce8f7aull );
+    test( "abcdefghijklmnopqrstuvwxyz", 0, 0x20fc8a7a03c435e5ull );
+    test( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 0, 0xe0179361c3e6d9a4ull );
+
+    test( "", 7, 0x76260ad1d8155f28ull );
+    test( "a", 7, 0xa60a657a63ca0221ull );
+    test( "abc", 7, 0xf38aee0dff682bf4ull );
+    test( "message digest", 7, 0x77d1bad3b8b757c0ull );
+    test( "abcdefghijklmnopqrstuvwxyz", 7, 0x65034180f637654eull );
+    test( "12345678901234567890123456789012345678901234567890123456789012345678901234567890", 7, 0x82f220e0602ed905ull );
+
+    // a single word is hashed by simple tabulation, xored with
+    // a multiple of its length
+
+    for( std::uint64_t i = 0; i < 64; ++i )
+    {
+        std::uint64_t const w = i * 0x9E3779B97F4A7C15ull;
+
+        tabulation_64 h;
+        h.update_word( w );
+
+        BOOST_TEST_EQ( h.result(), tabulate( w ) ^ 8 * 0x9E3779B97F4A7C15ull );
+    }
+
+    // zero padding of the last word doesn't collide
+
+    {
+        unsigned char const v[ 3 ] = { 'a', 'b', 0 };
+        BOOST_TEST_NE( tabulation_64::hash( v, 2 ), tabulation_64::hash( v, 3 ) );
+    }
+
+    // update_word is equivalent to update( p, 8 )
+
+    for( std::size_t i = 0; i < 8; ++i )
+    {
+        unsigned char const v[ 16 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 0xEF, 0xCD, 0xAB, 0x89, 0x67, 0x45, 0x23, 0x01 };
+
+        tabulation_64 h1, h2;
+
+        h1.update( v, i );
+        h2.update( v, i );
+
+        h1.update( v + 8, 8 );
+        h2.update_word( 0x0123456789ABCDEFull );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    test_batch( 0 );
+    test_batch( 7 );
+
+    return boost::report_errors();
+}
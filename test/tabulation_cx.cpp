@@ -0,0 +1,55 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/tabulation.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N );
+
+    return h.result();
+}
+
+template<std::size_t N> BOOST_CXX14_CONSTEXPR std::uint64_t test_hash( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    return boost::hash2::tabulation_64::hash( v, N, seed );
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v1[] = { 0 };
+    constexpr unsigned char v4[] = { 0, 1, 2, 3 };
+    constexpr unsigned char v16[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+    TEST_EQ( test<tabulation_64>( 0, v1 ), 0x3e0e05a0ef07a506ull );
+    TEST_EQ( test<tabulation_64>( 0, v4 ), 0xfbdf76998d0f104aull );
+    TEST_EQ( test<tabulation_64>( 0, v16 ), 0x5f44054a3a437f96ull );
+
+    TEST_EQ( test<tabulation_64>( 7, v1 ), 0x9723f663db8b5fc8ull );
+    TEST_EQ( test<tabulation_64>( 7, v4 ), 0x5ba84741f316e976ull );
+    TEST_EQ( test<tabulation_64>( 7, v16 ), 0x0f71797b12baa347ull );
+
+    TEST_EQ( test_hash( 0, v16 ), 0x5f44054a3a437f96ull );
+    TEST_EQ( test_hash( 7, v16 ), 0x0f71797b12baa347ull );
+
+    return boost::report_errors();
+}
@@ -0,0 +1,304 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/toeplitz.hpp>
+#include <boost/hash2/hash_append.hpp>
+#include <boost/hash2/hash_batch.hpp>
+#include <boost/hash2/flavor.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <tuple>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+
+using boost::hash2::toeplitz_32;
+
+// the definition, bit by bit
+
+static std::uint32_t toeplitz_bitwise( unsigned char const* key, std::size_t k, unsigned char const* p, std::size_t n )
+{
+    std::uint32_t r = 0;
+
+    for( std::size_t i = 0; i < n * 8; ++i )
+    {
+        if( p[ i / 8 ] & ( 0x80 >> ( i % 8 ) ) )
+        {
+            std::uint32_t w = 0;
+
+            for( std::size_t j = 0; j < 32; ++j )
+            {
+                std::size_t const m = ( i + j ) % ( k * 8 );
+                w = ( w << 1 ) | ( ( key[ m / 8 ] >> ( 7 - m % 8 ) ) & 1 );
+            }
+
+            r ^= w;
+        }
+    }
+
+    return r;
+}
+
+static std::uint32_t digest( toeplitz_32 h, void const* p, std::size_t n )
+{
+    h.update( p, n );
+    return h.result();
+}
+
+static void ipv4( char const* src, std::uint16_t sport, char const* dst, std::uint16_t dport, std::uint32_t r1, std::uint32_t r2 )
+{
+    unsigned char v[ 12 ] = {};
+
+    unsigned a, b, c, d;
+
+    std::sscanf( src, "%u.%u.%u.%u", &a, &b, &c, &d );
+    v[ 0 ] = static_cast<unsigned char>( a ); v[ 1 ] = static_cast<unsigned char>( b ); v[ 2 ] = static_cast<unsigned char>( c ); v[ 3 ] = static_cast<unsigned char>( d );
+
+    std::sscanf( dst, "%u.%u.%u.%u", &a, &b, &c, &d );
+    v[ 4 ] = static_cast<unsigned char>( a ); v[ 5 ] = static_cast<unsigned char>( b ); v[ 6 ] = static_cast<unsigned char>( c ); v[ 7 ] = static_cast<unsigned char>( d );
+
+    v[ 8 ] = static_cast<unsigned char>( sport >> 8 ); v[ 9 ] = static_cast<unsigned char>( sport );
+    v[ 10 ] = static_cast<unsigned char>( dport >> 8 ); v[ 11 ] = static_cast<unsigned char>( dport );
+
+    BOOST_TEST_EQ( digest( toeplitz_32(), v, 12 ), r1 );
+    BOOST_TEST_EQ( digest( toeplitz_32(), v, 8 ), r2 );
+
+    // the same tuple, as integers in network byte order
+
+    std::uint32_t const s = static_cast<std::uint32_t>( v[ 0 ] ) << 24 | static_cast<std::uint32_t>( v[ 1 ] ) << 16 | static_cast<std::uint32_t>( v[ 2 ] ) << 8 | v[ 3 ];
+    std::uint32_t const t = static_cast<std::uint32_t>( v[ 4 ] ) << 24 | static_cast<std::uint32_t>( v[ 5 ] ) << 16 | static_cast<std::uint32_t>( v[ 6 ] ) << 8 | v[ 7 ];
+
+    {
+        toeplitz_32 h;
+        boost::hash2::hash_append( h, boost::hash2::big_endian_flavor(), std::make_tuple( s, t, sport, dport ) );
+
+        BOOST_TEST_EQ( h.result(), r1 );
+    }
+}
+
+int main()
+{
+    // https://learn.microsoft.com/en-us/windows-hardware/drivers/network/verifying-the-rss-hash-calculation
+
+    ipv4( "66.9.149.187", 2794, "161.142.100.80", 1766, 0x51ccc178, 0x323e8fc2 );
+    ipv4( "199.92.111.2", 14230, "65.69.140.83", 4739, 0xc626b0ea, 0xd718262a );
+    ipv4( "24.19.198.95", 12898, "12.22.207.184", 38024, 0x5c2b394a, 0xd2d0a5de );
+    ipv4( "38.27.205.30", 48228, "209.142.163.6", 2217, 0xafc7327f, 0x82989176 );
+    ipv4( "153.39.163.191", 44251, "202.188.127.2", 1303, 0x10e828a2, 0x5d1809c5 );
+
+    {
+        unsigned char const v[ 36 ] =
+        {
+            0x3f, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, // 3ffe:2501:200:1fff::7
+            0x3f, 0xfe, 0x25, 0x01, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, // 3ffe:2501:200:3::1
+            0x0a, 0xea, 0x06, 0xe6, // 2794, 1766
+        };
+
+        BOOST_TEST_EQ( digest( toeplitz_32(), v, 36 ), 0x40207d3d );
+        BOOST_TEST_EQ( digest( toeplitz_32(), v, 32 ), 0x2cc18cd5 );
+
+        toeplitz_32 h;
+
+        BOOST_TEST_EQ( h.hash( v, 36 ), 0x40207d3d );
+        BOOST_TEST_EQ( h.hash( v, 32 ), 0x2cc18cd5 );
+    }
+
+    // seeds and keys
+
+    {
+        BOOST_TEST_EQ( toeplitz_32().key_size(), 40u );
+        BOOST_TEST_EQ( toeplitz_32( 0 ).key_size(), 40u );
+        BOOST_TEST_EQ( toeplitz_32( nullptr, 0 ).key_size(), 40u );
+
+        unsigned char const v[ 4 ] = { 1, 2, 3, 4 };
+
+        BOOST_TEST_EQ( digest( toeplitz_32( 0 ), v, 4 ), digest( toeplitz_32(), v, 4 ) );
+        BOOST_TEST_NE( digest( toeplitz_32( 1 ), v, 4 ), digest( toeplitz_32(), v, 4 ) );
+
+        // the empty message hashes to zero under any key
+
+        BOOST_TEST_EQ( digest( toeplitz_32( 1 ), v, 0 ), 0u );
+
+        unsigned char key[ 100 ];
+
+        for( int i = 0; i < 100; ++i )
+        {
+            key[ i ] = static_cast<unsigned char>( i * 73 + 5 );
+        }
+
+        BOOST_TEST_EQ( toeplitz_32( key, 100 ).key_size(), 64u );
+
+        unsigned char folded[ 64 ];
+        std::memcpy( folded, key, 64 );
+
+        for( int i = 64; i < 100; ++i )
+        {
+            folded[ i - 64 ] ^= key[ i ];
+        }
+
+        BOOST_TEST_EQ( digest( toeplitz_32( key, 100 ), v, 4 ), digest( toeplitz_32( folded, 64 ), v, 4 ) );
+    }
+
+    // long messages, with keys shorter than them, against the definition
+
+    {
+        std::vector<unsigned char> v( 700 );
+
+        for( std::size_t i = 0; i < v.size(); ++i )
+        {
+            v[ i ] = static_cast<unsigned char>( i * 37 + ( i >> 5 ) );
+        }
+
+        unsigned char key[ 64 ];
+
+        for( int i = 0; i < 64; ++i )
+        {
+            key[ i ] = static_cast<unsigned char>( i * 131 + 17 );
+        }
+
+        std::size_t const key_sizes[] = { 1, 3, 4, 5, 8, 11, 12, 13, 40, 52, 64 };
+        std::size_t const lengths[] = { 0, 1, 7, 8, 9, 15, 16, 17, 24, 36, 63, 64, 65, 200, 700 };
+
+        for( std::size_t k: key_sizes )
+        {
+            toeplitz_32 const h0( key, k );
+
+            for( std::size_t n: lengths )
+            {
+                std::uint32_t const r = toeplitz_bitwise( key, k, v.data(), n );
+
+                BOOST_TEST_EQ( digest( h0, v.data(), n ), r );
+                BOOST_TEST_EQ( digest( h0, v.data() + 1, n ), toeplitz_bitwise( key, k, v.data() + 1, n ) );
+                BOOST_TEST_EQ( h0.hash( v.data(), n ), r );
+
+                std::size_t const splits[] = { 0, 1, 5, n / 3, n / 2, n };
+
+                for( std::size_t split: splits )
+                {
+                    if( split > n ) continue;
+
+                    toeplitz_32 h( h0 );
+
+                    h.update( v.data(), split );
+                    h.update( v.data() + split, n - split );
+
+                    BOOST_TEST_EQ( h.result(), r );
+                }
+            }
+        }
+    }
+
+    // the kernels agree with one another
+
+    {
+#if defined(BOOST_HASH2_HAS_X86_INTRINSICS)
+
+        using namespace boost::hash2::detail;
+
+        if( has_x86_ssse3_pclmul() )
+        {
+            std::vector<unsigned char> v( 4096 );
+
+            for( std::size_t i = 0; i < v.size(); ++i )
+            {
+                v[ i ] = static_cast<unsigned char>( i * 97 + ( i >> 7 ) );
+            }
+
+            unsigned char key[ 64 ];
+
+            for( int i = 0; i < 64; ++i )
+            {
+                key[ i ] = static_cast<unsigned char>( i * 29 + 3 );
+            }
+
+            for( std::uint32_t k = 1; k <= 64; k += 7 )
+            {
+                std::uint64_t w[ 64 ] = {};
+
+                for( std::uint32_t i = 0; i < k; ++i )
+                {
+                    for( std::uint32_t j = 0; j < 8; ++j )
+                    {
+                        w[ i ] = ( w[ i ] << 8 ) | key[ ( i + j ) % k ];
+                    }
+                }
+
+                for( std::size_t n = 0; n <= v.size(); n += 8 * 61 )
+                {
+                    std::uint32_t const r = toeplitz_bitwise( key, k, v.data(), n );
+
+                    BOOST_TEST_EQ( toeplitz_update_ssse3( w, k, 0, v.data(), n ), r );
+
+                    if( has_x86_gfni_pclmul() )
+                    {
+                        BOOST_TEST_EQ( toeplitz_update_gfni( w, k, 0, v.data(), n ), r );
+                    }
+                }
+            }
+        }
+
+#endif
+    }
+
+    // a burst of 5-tuples
+
+    {
+        using flow = std::tuple<std::uint32_t, std::uint32_t, std::uint16_t, std::uint16_t>;
+
+        std::vector<flow> flows;
+
+        for( std::uint32_t i = 0; i < 50; ++i )
+        {
+            flows.push_back( flow( 0x0a000001u + i * 7, 0xc0a80101u ^ i, static_cast<std::uint16_t>( 1024 + i ), 443 ) );
+        }
+
+        std::vector<std::uint32_t> r1( flows.size() );
+
+        boost::hash2::hash_batch<toeplitz_32, boost::hash2::big_endian_flavor>( flows.begin(), flows.end(), r1.begin() );
+
+        std::vector<unsigned char> bytes( flows.size() * 12 );
+        std::vector<unsigned char const*> p( flows.size() );
+        std::vector<std::size_t> n( flows.size(), 12 );
+
+        for( std::size_t i = 0; i < flows.size(); ++i )
+        {
+            unsigned char* q = bytes.data() + i * 12;
+
+            boost::hash2::detail::write32be( q + 0, std::get<0>( flows[ i ] ) );
+            boost::hash2::detail::write32be( q + 4, std::get<1>( flows[ i ] ) );
+            boost::hash2::detail::write16be( q + 8, std::get<2>( flows[ i ] ) );
+            boost::hash2::detail::write16be( q + 10, std::get<3>( flows[ i ] ) );
+
+            p[ i ] = q;
+        }
+
+        std::vector<std::uint64_t> r2( flows.size() );
+
+        toeplitz_32 const h;
+        h.hash_batch( p.data(), n.data(), p.size(), r2.data() );
+
+        for( std::size_t i = 0; i < flows.size(); ++i )
+        {
+            BOOST_TEST_EQ( r1[ i ], r2[ i ] );
+            BOOST_TEST_EQ( r1[ i ], digest( h, p[ i ], 12 ) );
+        }
+    }
+
+    // repeated result() calls
+
+    {
+        toeplitz_32 h;
+
+        unsigned char const v[ 12 ] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+        h.update( v, 12 );
+
+        std::uint32_t const r1 = h.result();
+        std::uint32_t const r2 = h.result();
+
+        BOOST_TEST_NE( r1, r2 );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,143 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/type_hash.hpp>
+#include <boost/hash2/literal.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/hash2/xxhash.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace app
+{
+
+struct widget {};
+class gadget {};
+union variant { int x; float y; };
+enum color { red };
+enum class shape { circle };
+
+template<class T> struct box {};
+
+struct renamed {};
+
+} // namespace app
+
+namespace boost
+{
+namespace hash2
+{
+
+template<> struct type_hash_name<app::renamed>
+{
+    static constexpr char const* name() { return "app::v2::renamed"; }
+};
+
+} // namespace hash2
+} // namespace boost
+
+template<class H> void test()
+{
+    using namespace boost::hash2;
+
+    std::uint64_t const h[] =
+    {
+        type_hash<int, H>(),
+        type_hash<int const, H>(),
+        type_hash<int*, H>(),
+        type_hash<int&, H>(),
+        type_hash<long, H>(),
+        type_hash<unsigned, H>(),
+        type_hash<std::string, H>(),
+        type_hash<std::vector<int>, H>(),
+        type_hash<app::widget, H>(),
+        type_hash<app::gadget, H>(),
+        type_hash<app::variant, H>(),
+        type_hash<app::color, H>(),
+        type_hash<app::shape, H>(),
+        type_hash<app::box<app::widget>, H>(),
+        type_hash<app::box<app::gadget>, H>(),
+        type_hash<app::renamed, H>(),
+    };
+
+    std::size_t const n = sizeof( h ) / sizeof( h[ 0 ] );
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        for( std::size_t j = 0; j < i; ++j )
+        {
+            BOOST_TEST_NE( h[ i ], h[ j ] );
+        }
+    }
+
+    BOOST_TEST_EQ( ( type_hash<int, H>() ), ( type_hash<signed int, H>() ) );
+    BOOST_TEST_EQ( ( type_hash<app::widget const, H>() ), ( type_hash<const app::widget, H>() ) );
+
+    // the stable names of class and enumeration types are their qualified
+    // names, whatever the compiler
+
+    BOOST_TEST_EQ( ( stable_type_hash<app::widget, H>() ), literal<H>( "app::widget" ) );
+    BOOST_TEST_EQ( ( stable_type_hash<app::gadget, H>() ), literal<H>( "app::gadget" ) );
+    BOOST_TEST_EQ( ( stable_type_hash<app::variant, H>() ), literal<H>( "app::variant" ) );
+    BOOST_TEST_EQ( ( stable_type_hash<app::color, H>() ), literal<H>( "app::color" ) );
+    BOOST_TEST_EQ( ( stable_type_hash<app::shape, H>() ), literal<H>( "app::shape" ) );
+    BOOST_TEST_EQ( ( stable_type_hash<app::box<app::widget>, H>() ), literal<H>( "app::box<app::widget>" ) );
+
+    BOOST_TEST_EQ( ( stable_type_hash<int, H>() ), literal<H>( "int" ) );
+
+    // unless they are given one
+
+    BOOST_TEST_EQ( ( stable_type_hash<app::renamed, H>() ), literal<H>( "app::v2::renamed" ) );
+}
+
+#if !defined(BOOST_NO_CXX14_CONSTEXPR)
+
+// a registry keyed by type, as a sorted array searched at compile time
+
+struct entry
+{
+    std::uint64_t key;
+    int value;
+};
+
+constexpr entry registry[] =
+{
+    { boost::hash2::stable_type_hash<app::widget>() < boost::hash2::stable_type_hash<app::gadget>()? boost::hash2::stable_type_hash<app::widget>(): boost::hash2::stable_type_hash<app::gadget>(), 0 },
+    { boost::hash2::stable_type_hash<app::widget>() < boost::hash2::stable_type_hash<app::gadget>()? boost::hash2::stable_type_hash<app::gadget>(): boost::hash2::stable_type_hash<app::widget>(), 1 },
+};
+
+constexpr int lookup( std::uint64_t k )
+{
+    std::size_t first = 0, last = sizeof( registry ) / sizeof( registry[ 0 ] );
+
+    while( first < last )
+    {
+        std::size_t mid = first + ( last - first ) / 2;
+
+        if( registry[ mid ].key < k ) first = mid + 1; else last = mid;
+    }
+
+    return first < sizeof( registry ) / sizeof( registry[ 0 ] ) && registry[ first ].key == k? registry[ first ].value: -1;
+}
+
+static_assert( boost::hash2::type_hash<int>() != boost::hash2::type_hash<long>(), "type_hash<int>() == type_hash<long>()" );
+static_assert( boost::hash2::stable_type_hash<app::widget>() == boost::hash2::literal( "app::widget" ), "stable_type_hash<app::widget>()" );
+static_assert( boost::hash2::stable_type_hash<app::renamed>() == boost::hash2::literal( "app::v2::renamed" ), "stable_type_hash<app::renamed>()" );
+
+static_assert( lookup( boost::hash2::stable_type_hash<app::widget>() ) != -1, "lookup( widget )" );
+static_assert( lookup( boost::hash2::stable_type_hash<app::gadget>() ) != -1, "lookup( gadget )" );
+static_assert( lookup( boost::hash2::stable_type_hash<app::color>() ) == -1, "lookup( color )" );
+
+#endif
+
+int main()
+{
+    test<boost::hash2::fnv1a_64>();
+    test<boost::hash2::xxhash_64>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,227 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/update_buffers.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/siphash.hpp>
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/fnv1a.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <array>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+using namespace boost::hash2;
+
+// as struct iovec
+
+struct iov
+{
+    void* iov_base;
+    std::size_t iov_len;
+};
+
+// as boost::asio::const_buffer
+
+class const_buffer
+{
+private:
+
+    void const* p_;
+    std::size_t n_;
+
+public:
+
+    const_buffer( void const* p, std::size_t n ): p_( p ), n_( n )
+    {
+    }
+
+    void const* data() const noexcept
+    {
+        return p_;
+    }
+
+    std::size_t size() const noexcept
+    {
+        return n_;
+    }
+};
+
+// splits [0, n) at the given fragment sizes, repeated
+
+static std::vector<std::size_t> split( std::size_t n, std::vector<std::size_t> const& sizes )
+{
+    std::vector<std::size_t> r;
+
+    for( std::size_t i = 0, j = 0; i < n; ++j )
+    {
+        std::size_t m = sizes[ j % sizes.size() ];
+
+        if( m > n - i ) m = n - i;
+
+        r.push_back( m );
+        i += m;
+    }
+
+    return r;
+}
+
+template<class H> static void test( std::vector<unsigned char> const& v, std::vector<std::size_t> const& sizes )
+{
+    std::vector<std::size_t> const s = split( v.size(), sizes );
+
+    H h0( 7 );
+
+    for( std::size_t i = 0, j = 0; j < s.size(); ++j )
+    {
+        h0.update( v.data() + i, s[ j ] );
+        i += s[ j ];
+    }
+
+    typename H::result_type const r0 = h0.result();
+
+    std::vector<iov> b1;
+    std::vector<const_buffer> b2;
+    std::vector<std::string> b3;
+
+    for( std::size_t i = 0, j = 0; j < s.size(); ++j )
+    {
+        iov x = { const_cast<unsigned char*>( v.data() + i ), s[ j ] };
+        b1.push_back( x );
+
+        b2.push_back( const_buffer( v.data() + i, s[ j ] ) );
+        b3.push_back( std::string( v.begin() + i, v.begin() + i + s[ j ] ) );
+
+        i += s[ j ];
+    }
+
+    {
+        H h( 7 );
+        update_buffers( h, b1.data(), b1.size() );
+
+        BOOST_TEST( h.result() == r0 );
+    }
+
+    {
+        H h( 7 );
+        update_buffers( h, b1.begin(), b1.end() );
+
+        BOOST_TEST( h.result() == r0 );
+    }
+
+    {
+        H h( 7 );
+        update_buffers( h, b1 );
+
+        BOOST_TEST( h.result() == r0 );
+    }
+
+    {
+        H h( 7 );
+        update_buffers( h, b2 );
+
+        BOOST_TEST( h.result() == r0 );
+    }
+
+    {
+        H h( 7 );
+        update_buffers( h, b3 );
+
+        BOOST_TEST( h.result() == r0 );
+    }
+
+    // the state can be continued after update_buffers
+
+    {
+        H h1( 7 );
+
+        update_buffers( h1, b1 );
+        h1.update( v.data(), v.size() );
+
+        h0 = H( 7 );
+
+        h0.update( v.data(), v.size() );
+        h0.update( v.data(), v.size() );
+
+        BOOST_TEST( h1.result() == h0.result() );
+    }
+}
+
+template<class H> static void test()
+{
+    std::vector<unsigned char> v( 9000 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 7 + ( i >> 8 ) );
+    }
+
+    // packets of 1500 bytes, as headers and payloads
+
+    std::vector<std::size_t> const sizes[] =
+    {
+        { 1 },
+        { 0, 3 },
+        { 17 },
+        { 63, 64, 65 },
+        { 14, 20, 20, 1446 },
+        { 1500 },
+        { 5, 1024, 1, 1023 },
+        { 9000 },
+    };
+
+    for( std::size_t n: { 0, 1, 63, 64, 100, 1500, 3000, 9000 } )
+    {
+        std::vector<unsigned char> const v2( v.begin(), v.begin() + n );
+
+        for( auto const& s: sizes )
+        {
+            test<H>( v2, s );
+        }
+    }
+}
+
+int main()
+{
+    test<fnv1a_64>();
+    test<siphash_64>();
+    test<xxh3_128>();
+    test<sha2_256>();
+    test<sha2_512>();
+
+    // a single buffer
+
+    {
+        std::string const s( "0123456789" );
+
+        xxh3_64 h1;
+        update_buffers( h1, s );
+
+        xxh3_64 h2;
+        h2.update( s.data(), s.size() );
+
+        xxh3_64 h3;
+        update_buffers( h3, const_buffer( s.data(), s.size() ) );
+
+        auto const r = h2.result();
+
+        BOOST_TEST_EQ( h1.result(), r );
+        BOOST_TEST_EQ( h3.result(), r );
+    }
+
+    // an empty sequence
+
+    {
+        std::array<iov, 0> const b = {};
+
+        sha2_256 h1;
+        update_buffers( h1, b );
+
+        BOOST_TEST( h1.result() == sha2_256().result() );
+    }
+
+    return boost::report_errors();
+}
@@ -0,0 +1,87 @@
+// Copyright 2024 Peter Dimov.
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/crc32.hpp>
+#include <boost/hash2/crc32c.hpp>
+#include <boost/hash2/crc64.hpp>
+#include <boost/hash2/adler32.hpp>
+#include <boost/hash2/sha2.hpp>
+#include <boost/hash2/detail/update_zeros.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/lightweight_test_trait.hpp>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+template<class H> void test()
+{
+    std::size_t const sizes[] = { 0, 1, 7, 8, 15, 16, 100, 4096, 65535, 65536, 65537, 1000000 };
+
+    for( std::size_t n: sizes )
+    {
+        std::vector<unsigned char> v( n );
+
+        H h1;
+        h1.update( "abc", 3 );
+        h1.update( v.data(), n );
+        h1.update( "d", 1 );
+
+        H h2;
+        h2.update( "abc", 3 );
+        boost::hash2::detail::update_zeros( h2, n );
+        h2.update( "d", 1 );
+
+        BOOST_TEST( h1.result() == h2.result() );
+    }
+}
+
+template<class H> void test_member()
+{
+    BOOST_TEST_TRAIT_TRUE(( boost::hash2::detail::has_update_zeros<H> ));
+
+    for( std::uint64_t n = 0; n < 300; n += 7 )
+    {
+        std::vector<unsigned char> v( static_cast<std::size_t>( n ) );
+
+        H h1( 5 );
+        h1.update( v.data(), v.size() );
+
+        H h2( 5 );
+        h2.update_zeros( n );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    // a run much longer than any file, in O(log n)
+
+    {
+        H h1;
+        h1.update_zeros( 1ull << 40 );
+        h1.update_zeros( 1ull << 40 );
+
+        H h2;
+        h2.update_zeros( 1ull << 41 );
+
+        BOOST_TEST_EQ( h1.result(), h2.result() );
+    }
+
+    test<H>();
+}
+
+int main()
+{
+    using namespace boost::hash2;
+
+    test_member<crc32>();
+    test_member<crc32c>();
+    test_member<crc64_xz>();
+    test_member<crc64_nvme>();
+    test_member<adler32>();
+
+    BOOST_TEST_TRAIT_FALSE(( detail::has_update_zeros<sha2_256> ));
+
+    test<sha2_256>();
+
+    return boost::report_errors();
+}
@@ -0,0 +1,154 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/xxh3.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+template<class H> typename H::result_type hash( char const * s, std::uint64_t seed )
+{
+    H h( seed );
+
+    h.update( s, std::strlen( s ) );
+
+    return h.result();
+}
+
+template<class H> typename H::result_type hash( std::vector<unsigned char> const& v, std::size_t n, std::size_t split, std::uint64_t seed )
+{
+    H h( seed );
+
+    h.update( v.data(), split );
+    h.update( v.data() + split, n - split );
+
+    return h.result();
+}
+
+struct test_vector
+{
+    std::size_t n;
+    std::uint64_t seed;
+    std::uint64_t h64;
+    char const* h128;
+};
+
+int main()
+{
+    using namespace boost::hash2;
+
+    // Test vectors computed with the reference implementation, XXH3_64bits_withSeed and XXH3_128bits_withSeed
+
+    BOOST_TEST_EQ( hash<xxh3_64>( "", 0 ), 0x2d06800538d394c2ull );
+    BOOST_TEST_EQ( hash<xxh3_64>( "", 7 ), 0x913ae0873e9b7eb8ull );
+    BOOST_TEST_EQ( hash<xxh3_64>( "abc", 0 ), 0x78af5f94892f3950ull );
+    BOOST_TEST_EQ( hash<xxh3_64>( "abc", 7 ), 0x48ff56f569e39912ull );
+    BOOST_TEST_EQ( hash<xxh3_64>( "The quick brown fox jumps over the lazy dog", 0 ), 0xce7d19a5418fb365ull );
+    BOOST_TEST_EQ( hash<xxh3_64>( "The quick brown fox jumps over the lazy dog", 7 ), 0xccefeb269f944e83ull );
+
+    BOOST_TEST_EQ( to_string( hash<xxh3_128>( "", 0 ) ), std::string( "99aa06d3014798d86001c324468d497f" ) );
+    BOOST_TEST_EQ( to_string( hash<xxh3_128>( "", 7 ) ), std::string( "76a30bdf56cdfa2ccb4aa04fe72c771f" ) );
+    BOOST_TEST_EQ( to_string( hash<xxh3_128>( "abc", 0 ) ), std::string( "06b05ab6733a618578af5f94892f3950" ) );
+    BOOST_TEST_EQ( to_string( hash<xxh3_128>( "abc", 7 ) ), std::string( "8a3c1b87ceb230ee48ff56f569e39912" ) );
+    BOOST_TEST_EQ( to_string( hash<xxh3_128>( "The quick brown fox jumps over the lazy dog", 0 ) ), std::string( "ddd650205ca3e7fa24a1cc2e3a8a7651" ) );
+    BOOST_TEST_EQ( to_string( hash<xxh3_128>( "The quick brown fox jumps over the lazy dog", 7 ) ), std::string( "5f6b0a448872458642a5e17a4f6b2b53" ) );
+
+    // v[ i ] = i * 7 + 1
+
+    std::vector<unsigned char> v( 10000 );
+
+    for( std::size_t i = 0; i < v.size(); ++i )
+    {
+        v[ i ] = static_cast<unsigned char>( i * 7 + 1 );
+    }
+
+    test_vector const tv[] =
+    {
+        { 1, 0, 0xe12ef9d2eb86ceebull, "51025a4491835505e12ef9d2eb86ceeb" },
+        { 1, 7, 0xcd212f8dd32fd172ull, "d5b78bdea9181961cd212f8dd32fd172" },
+        { 3, 0, 0x5c83885a0fb5d516ull, "f727126d6288a4bd5c83885a0fb5d516" },
+        { 3, 7, 0xb24faed64a611b52ull, "46487f798e607c98b24faed64a611b52" },
+        { 4, 0, 0x244f36de481e7522ull, "6a20c426eb2da17d217908f07519e96e" },
+        { 4, 7, 0xa09f1f5376d35336ull, "4c29d24ce9c8741f4938a8a789f6fd40" },
+        { 8, 0, 0x96cc97a6768fd7a9ull, "dd669d5507e0e9404506373ef0af21f8" },
+        { 8, 7, 0xccf8f842109dab0aull, "4edd495bde8e017666683131cda43815" },
+        { 9, 0, 0x4781d83b8e99d495ull, "781bfd0e8d95a9ada51b142882780bcb" },
+        { 9, 7, 0x8ee2168487940fe1ull, "1e865e9f9031e724047cac56f1207d89" },
+        { 16, 0, 0x913bd4a8038027a7ull, "6c53b945f90d679849bf196d35649b79" },
+        { 16, 7, 0x826cffa69f69ac10ull, "d1bcdabff339744a9617eca5481ab9b0" },
+        { 17, 0, 0x2bf6f66973a6179dull, "f889d91b7faf208294ad051aea796d7e" },
+        { 17, 7, 0x5a8d08ad6fb5cc86ull, "8a6aff35bab9bdee675bf571f56a9b00" },
+        { 32, 0, 0x5d503b89ae6f56c6ull, "2cb559bb64d293e9369cab951c511911" },
+        { 32, 7, 0x88e09aa42fc14fbeull, "5ae55babb442e53a2d40e25b3cfa560b" },
+        { 33, 0, 0xb192963ede5ed5abull, "60f5a4577ba82b1c2ef00541392ecc50" },
+        { 33, 7, 0xb0f1f8df8a0438faull, "b1a3e816dd1c87b8f4d77ef6fc41ce8e" },
+        { 64, 0, 0x13886553e7dc3fa3ull, "49b043631b5d4d5192fd891d246fb531" },
+        { 64, 7, 0x784e6a6026cf03e1ull, "d80ce74f66b02ebf23d55d71da966e7e" },
+        { 65, 0, 0x1c6516cc715d0a0eull, "28457563c6ecae375b07dd3aa17b0b34" },
+        { 65, 7, 0xa265cb34bd395d20ull, "a8be5767ae8c090a77d6ccbf7a0a48c8" },
+        { 96, 0, 0xdf49263b54999fcdull, "1939f2a73ddc43eca88b752cfafc28c3" },
+        { 96, 7, 0xf4c4987e9609ea4full, "aabdf859a3dc34dbe9ac76631eccc2a4" },
+        { 97, 0, 0x74f3d6ff540707b9ull, "0dd98837fd4f559e4d36251a2e320331" },
+        { 97, 7, 0x5dc3b31221e1470bull, "e7cbde988f3ff4e6a8fffeb384a5e04c" },
+        { 128, 0, 0xc4399c7829d0628full, "776e5a2cae08df3bd480e3bdeadbf37f" },
+        { 128, 7, 0xc21d4f1b34662591ull, "b22d78b0efb8c4b82cd4edb6b1dd823c" },
+        { 129, 0, 0x8433489056750b32ull, "b550da2f042256556a4dda91524c13ef" },
+        { 129, 7, 0xd0819de89317e2d2ull, "ba32fbef47d97cf252894a2cf273ed44" },
+        { 160, 0, 0x13d314029718f121ull, "1cbbc2b4950bdb766cc4a404001acef7" },
+        { 160, 7, 0x48467003a5037efbull, "700be5900af2af6115b94460eb9fb30b" },
+        { 240, 0, 0x3c0bb96864e543a1ull, "3f558c88fda1da664f23bfd3609734e8" },
+        { 240, 7, 0x67053a3755f2aefaull, "8e850d3813854f9d66be5e4f2e507e22" },
+        { 241, 0, 0xbff7215089202d8full, "9ea4272027cb71fcbff7215089202d8f" },
+        { 241, 7, 0x51770c6489aa7cb7ull, "830a09c3d80b6d7551770c6489aa7cb7" },
+        { 255, 0, 0x1729eaa78df50a51ull, "b90e8455122712431729eaa78df50a51" },
+        { 255, 7, 0xbab536f322c2c27full, "e35dfc5b81334ac3bab536f322c2c27f" },
+        { 256, 0, 0xc03402b5dce3dbfaull, "64c166f4724707e6c03402b5dce3dbfa" },
+        { 256, 7, 0xb7f3d90a5a83150cull, "440238ca1b39bceeb7f3d90a5a83150c" },
+        { 257, 0, 0x78ebbc62dbd8326dull, "3491f6ac974f534478ebbc62dbd8326d" },
+        { 257, 7, 0x8594ea76a9c196full, "b9f05092c7400a5b08594ea76a9c196f" },
+        { 1023, 0, 0xc03ae6f4a48a2f77ull, "2c4f620c707738c7c03ae6f4a48a2f77" },
+        { 1023, 7, 0x2cbefc805b0bdc4aull, "d0b2159772c47d652cbefc805b0bdc4a" },
+        { 1024, 0, 0xac8e32e4ea3ba062ull, "418876ca5eaea67dac8e32e4ea3ba062" },
+        { 1024, 7, 0xca3fed4da5af2cd5ull, "7308bc09ce451e83ca3fed4da5af2cd5" },
+        { 1025, 0, 0xc856c953bbdbc807ull, "f66a602aa3eda73bc856c953bbdbc807" },
+        { 1025, 7, 0x4604b6cc9e483a93ull, "cec5a893f3d8fb274604b6cc9e483a93" },
+        { 2048, 0, 0xecd56acc708567ffull, "17991a411b1648d3ecd56acc708567ff" },
+        { 2048, 7, 0xcbd300e81856f576ull, "3a087fbf6210722ccbd300e81856f576" },
+        { 10000, 0, 0x76d2759ef5e1104bull, "b99cac69c5d390d376d2759ef5e1104b" },
+        { 10000, 7, 0xa73656c0fd55bdc1ull, "184481a501625e2da73656c0fd55bdc1" },
+    };
+
+    for( test_vector const& t: tv )
+    {
+        std::size_t const splits[] = { 0, 1, t.n / 3, t.n / 2, t.n - 1, t.n };
+
+        for( std::size_t split: splits )
+        {
+            BOOST_TEST_EQ( hash<xxh3_64>( v, t.n, split, t.seed ), t.h64 );
+            BOOST_TEST_EQ( to_string( hash<xxh3_128>( v, t.n, split, t.seed ) ), std::string( t.h128 ) );
+        }
+    }
+
+    // byte-at-a-time updates agree with a single update
+
+    for( std::size_t n = 0; n < 1100; ++n )
+    {
+        xxh3_64 h1;
+        xxh3_128 h2;
+
+        for( std::size_t i = 0; i < n; ++i )
+        {
+            h1.update( v.data() + i, 1 );
+            h2.update( v.data() + i, 1 );
+        }
+
+        BOOST_TEST_EQ( h1.result(), hash<xxh3_64>( v, n, 0, 0 ) );
+        BOOST_TEST_EQ( h2.result(), hash<xxh3_128>( v, n, 0, 0 ) );
+    }
+
+    return boost::report_errors();
+}
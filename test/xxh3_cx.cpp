@@ -0,0 +1,82 @@
+// Copyright 2024 Peter Dimov
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/hash2/xxh3.hpp>
+#include <boost/hash2/digest.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/config.hpp>
+#include <cstring>
+
+#if defined(BOOST_MSVC) && BOOST_MSVC < 1920
+# pragma warning(disable: 4307) // integral constant overflow
+#endif
+
+template<class H, std::size_t N> BOOST_CXX14_CONSTEXPR typename H::result_type test( std::uint64_t seed, unsigned char const (&v)[ N ] )
+{
+    H h( seed );
+
+    h.update( v, N / 3 );
+    h.update( v + N / 3, N - N / 3 );
+
+    return h.result();
+}
+
+BOOST_CXX14_CONSTEXPR unsigned char to_byte( char c )
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return 0xff;
+}
+
+template<std::size_t N, std::size_t M = ( N - 1 ) / 2>
+BOOST_CXX14_CONSTEXPR boost::hash2::digest<M> digest_from_hex( char const (&str)[ N ] )
+{
+    boost::hash2::digest<M> dgst = {};
+    auto* p = dgst.data();
+    for( unsigned i = 0; i < M; ++i ) {
+        auto c1 = to_byte( str[ 2 * i ] );
+        auto c2 = to_byte( str[ 2 * i + 1 ] );
+        p[ i ] = ( c1 << 4 ) | c2;
+    }
+    return dgst;
+}
+
+#define STATIC_ASSERT(...) static_assert(__VA_ARGS__, #__VA_ARGS__)
+
+#if defined(BOOST_NO_CXX14_CONSTEXPR)
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2)
+
+#else
+
+# define TEST_EQ(x1, x2) BOOST_TEST_EQ(x1, x2); STATIC_ASSERT(x1 == x2)
+
+#endif
+
+int main()
+{
+    using namespace boost::hash2;
+
+    constexpr unsigned char v21[ 21 ] = {};
+    constexpr unsigned char v45[ 45 ] = {};
+    constexpr unsigned char v300[ 300 ] = {};
+
+    TEST_EQ( test<xxh3_64>( 0, v21 ), 1701225043353072438ull );
+    TEST_EQ( test<xxh3_64>( 0, v45 ), 6923731869513544786ull );
+    TEST_EQ( test<xxh3_64>( 0, v300 ), 6255629810010709905ull );
+
+    TEST_EQ( test<xxh3_64>( 7, v21 ), 2033816572490763880ull );
+    TEST_EQ( test<xxh3_64>( 7, v45 ), 6496253504278074704ull );
+    TEST_EQ( test<xxh3_64>( 7, v300 ), 17564453511229815282ull );
+
+    TEST_EQ( test<xxh3_128>( 0, v21 ), digest_from_hex( "5feaa38006f558d7179bf729d80ef336" ) );
+    TEST_EQ( test<xxh3_128>( 0, v45 ), digest_from_hex( "5922351d5386e86260160973aa67f452" ) );
+    TEST_EQ( test<xxh3_128>( 0, v300 ), digest_from_hex( "be8945035b2f421f56d0762b20085f91" ) );
+
+    TEST_EQ( test<xxh3_128>( 7, v21 ), digest_from_hex( "6f78ab2d6b576c021c399165a59d4e68" ) );
+    TEST_EQ( test<xxh3_128>( 7, v45 ), digest_from_hex( "9a49f4e9032111e75a275424bd619550" ) );
+    TEST_EQ( test<xxh3_128>( 7, v300 ), digest_from_hex( "c8b293e1aede28d4f3c1796872b739f2" ) );
+
+    return boost::report_errors();
+}